@@ -0,0 +1,19 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+
+#include "FunctionLibraries/PubnubChatAsyncHandleUtilities.h"
+
+void UPubnubChatAsyncHandleUtilities::CancelAsyncOperation(const FPubnubChatAsyncHandle& AsyncHandle)
+{
+	AsyncHandle.Cancel();
+}
+
+bool UPubnubChatAsyncHandleUtilities::IsAsyncOperationCancelled(const FPubnubChatAsyncHandle& AsyncHandle)
+{
+	return AsyncHandle.IsCancelled();
+}
+
+bool UPubnubChatAsyncHandleUtilities::IsAsyncOperationStarted(const FPubnubChatAsyncHandle& AsyncHandle)
+{
+	return AsyncHandle.IsStarted();
+}
@@ -4,6 +4,7 @@
 #include "FunctionLibraries/PubnubChatInternalUtilities.h"
 #include "Dom/JsonObject.h"
 #include "FunctionLibraries/PubnubJsonUtilities.h"
+#include "FunctionLibraries/PubnubChatJsonReader.h"
 #include "Internationalization/Regex.h"
 #include "PubnubChatVersion.h"
 #include "PubnubChatConst.h"
@@ -14,8 +15,38 @@
 #include "StructLibraries/PubnubChatChannelStructLibrary.h"
 #include "StructLibraries/PubnubChatUserStructLibrary.h"
 #include "Algo/Sort.h"
+#include "Algo/StableSort.h"
 
 
+namespace
+{
+	//Event type names are compared against every received message, so they are created only once
+	const TArray<FString>& GetChatEventTypeStrings()
+	{
+		static const TArray<FString> EventTypeStrings = []()
+		{
+			TArray<FString> Strings;
+			for (EPubnubChatEventType EventType : TEnumRange<EPubnubChatEventType>())
+			{
+				Strings.Add(UPubnubChatInternalConverters::ChatEventTypeToString(EventType));
+			}
+			return Strings;
+		}();
+		return EventTypeStrings;
+	}
+
+	void FillEventTypeAndPayloadFromMessage(const FString& Message, FPubnubChatEvent& Event)
+	{
+		//Type is in Message content, so we need to extract it from there
+		FString Type;
+		FPubnubChatJsonReader::TryGetStringField(Message, ANSI_TO_TCHAR("type"), Type);
+		Event.Type = UPubnubChatInternalConverters::StringToChatEventType(Type);
+
+		//Event type shouldn't be in the payload, so we have to remove it. Remaining message content is the payload
+		Event.Payload = FPubnubChatJsonReader::RemoveField(Message, ANSI_TO_TCHAR("type"));
+	}
+}
+
 FString UPubnubChatInternalUtilities::GetFilterForUserID(const FString& UserID)
 {
 	return FString::Printf(TEXT("uuid.id == %s"), *UPubnubJsonUtilities::SerializeString(UserID));
@@ -75,9 +106,23 @@ FString UPubnubChatInternalUtilities::ChatMessageToPublishString(const FString C
 
 FString UPubnubChatInternalUtilities::PublishedStringToChatMessage(const FString PublishedMessage)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-	UPubnubJsonUtilities::StringToJsonObject(PublishedMessage, JsonObject);
-	return JsonObject->GetStringField(ANSI_TO_TCHAR("text"));
+	FString Text;
+	FPubnubChatJsonReader::TryGetStringField(PublishedMessage, ANSI_TO_TCHAR("text"), Text);
+	return Text;
+}
+
+bool UPubnubChatInternalUtilities::IsUserMentionedInPublishedMessage(const FString& PublishedMessage, const FString& UserID)
+{
+	if (UserID.IsEmpty())
+	{ return false; }
+	
+	FString Text;
+	if (!FPubnubChatJsonReader::TryGetStringField(PublishedMessage, ANSI_TO_TCHAR("text"), Text))
+	{ return false; }
+	
+	//Mention link has format [text](pn-user://UserID), with backslashes and closing parentheses of UserID escaped
+	const FString EscapedUserID = UserID.Replace(TEXT("\\"), TEXT("\\\\")).Replace(TEXT(")"), TEXT("\\)"));
+	return Text.Contains(FString::Printf(TEXT("](%s%s)"), *Pubnub_Schema_User, *EscapedUserID), ESearchCase::CaseSensitive);
 }
 
 FString UPubnubChatInternalUtilities::SendTextMetaFromParams(const FPubnubChatSendTextParams& SendTextParams, UPubnubChatMessage* QuotedMessage)
@@ -117,6 +162,27 @@ FString UPubnubChatInternalUtilities::SendTextMetaFromParams(const FPubnubChatSe
 	return "";
 }
 
+FString UPubnubChatInternalUtilities::AddClientMessageIDToMeta(const FString& Meta, const FString& ClientMessageID)
+{
+	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+	if (!Meta.IsEmpty())
+	{
+		UPubnubJsonUtilities::StringToJsonObject(Meta, JsonObject);
+	}
+	JsonObject->SetStringField(ANSI_TO_TCHAR("clientMessageId"), ClientMessageID);
+	return UPubnubJsonUtilities::JsonObjectToString(JsonObject);
+}
+
+FString UPubnubChatInternalUtilities::GetClientMessageIDFromMeta(const FString& Meta)
+{
+	FString ClientMessageID;
+	if (!Meta.IsEmpty())
+	{
+		FPubnubChatJsonReader::TryGetStringField(Meta, ANSI_TO_TCHAR("clientMessageId"), ClientMessageID);
+	}
+	return ClientMessageID;
+}
+
 FPubnubChatQuotedMessageData UPubnubChatInternalUtilities::GetQuotedMessageDataFromMeta(const FString& Meta)
 {
 	FPubnubChatQuotedMessageData Out;
@@ -125,21 +191,24 @@ FPubnubChatQuotedMessageData UPubnubChatInternalUtilities::GetQuotedMessageDataF
 		return Out;
 	}
 
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-	if (!UPubnubJsonUtilities::StringToJsonObject(Meta, JsonObject))
+	FPubnubChatJsonReader Reader(Meta);
+	if (!Reader.ReadObjectStart() || !Reader.FindKey(ANSI_TO_TCHAR("quotedMessage")) || !Reader.ReadObjectStart())
 	{
 		return Out;
 	}
 
-	const TSharedPtr<FJsonObject>* QuotedObj = nullptr;
-	if (!JsonObject->TryGetObjectField(ANSI_TO_TCHAR("quotedMessage"), QuotedObj) || !QuotedObj || !(*QuotedObj).IsValid())
+	//Read all quoted message fields in a single pass
+	while (Reader.ReadNextKey())
 	{
-		return Out;
+		if (Reader.ValueEquals(ANSI_TO_TCHAR("timetoken")))
+		{ Reader.TryReadString(Out.Timetoken); }
+		else if (Reader.ValueEquals(ANSI_TO_TCHAR("text")))
+		{ Reader.TryReadString(Out.Text); }
+		else if (Reader.ValueEquals(ANSI_TO_TCHAR("userID")))
+		{ Reader.TryReadString(Out.UserID); }
+		else
+		{ Reader.SkipNextValue(); }
 	}
-
-	(*QuotedObj)->TryGetStringField(ANSI_TO_TCHAR("timetoken"), Out.Timetoken);
-	(*QuotedObj)->TryGetStringField(ANSI_TO_TCHAR("text"), Out.Text);
-	(*QuotedObj)->TryGetStringField(ANSI_TO_TCHAR("userID"), Out.UserID);
 	return Out;
 }
 
@@ -219,18 +288,7 @@ FPubnubChatEvent UPubnubChatInternalUtilities::GetEventFromPubnubMessageData(con
 	Event.Timetoken = MessageData.Timetoken;
 	Event.ChannelID = MessageData.Channel;
 	Event.UserID = MessageData.UserID;
-
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-	UPubnubJsonUtilities::StringToJsonObject(MessageData.Message, JsonObject);
-
-	//Type is in Message content, so we need to extract it from there
-	FString Type;
-	JsonObject->TryGetStringField(ANSI_TO_TCHAR("type"), Type);
-	Event.Type = UPubnubChatInternalConverters::StringToChatEventType(Type);
-
-	//Event type shouldn't be in the payload, so we have to remove it. Remaining message content is the payload
-	JsonObject->RemoveField(ANSI_TO_TCHAR("type"));
-	Event.Payload = UPubnubJsonUtilities::JsonObjectToString(JsonObject);
+	FillEventTypeAndPayloadFromMessage(MessageData.Message, Event);
 
 	return Event;
 }
@@ -242,18 +300,7 @@ FPubnubChatEvent UPubnubChatInternalUtilities::GetEventFromPubnubHistoryMessageD
 	Event.ChannelID = MessageData.Channel;
 	Event.UserID = MessageData.UserID;
 	Event.Timetoken = MessageData.Timetoken;
-	
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-	UPubnubJsonUtilities::StringToJsonObject(MessageData.Message, JsonObject);
-	
-	//Get Event type and remove it from the Payload
-	FString Type;
-	JsonObject->TryGetStringField(ANSI_TO_TCHAR("type"), Type);
-	Event.Type = UPubnubChatInternalConverters::StringToChatEventType(Type);
-
-	//Event type shouldn't be in the payload, so we have to remove it. Remaining message content is the payload
-	JsonObject->RemoveField(ANSI_TO_TCHAR("type"));
-	Event.Payload = UPubnubJsonUtilities::JsonObjectToString(JsonObject);
+	FillEventTypeAndPayloadFromMessage(MessageData.Message, Event);
 	
 	return Event;
 }
@@ -365,19 +412,7 @@ FPubnubChatRestriction UPubnubChatInternalUtilities::GetRestrictionFromModeratio
 
 bool UPubnubChatInternalUtilities::IsCustomEventMessage(const FString& MessageContent)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-	if (!UPubnubJsonUtilities::StringToJsonObject(MessageContent, JsonObject))
-	{
-		return false;
-	}
-
-	FString Type;
-	if (!JsonObject->TryGetStringField(ANSI_TO_TCHAR("type"), Type))
-	{
-		return false;
-	}
-
-	return Type == "custom";
+	return FPubnubChatJsonReader::IsStringFieldEqual(MessageContent, ANSI_TO_TCHAR("type"), ANSI_TO_TCHAR("custom"));
 }
 
 FPubnubChatCustomEvent UPubnubChatInternalUtilities::GetCustomEventFromPubnubMessageData(const FPubnubMessageData& MessageData)
@@ -418,17 +453,18 @@ FString UPubnubChatInternalUtilities::GetModerationEventPayload(const FString Mo
 
 bool UPubnubChatInternalUtilities::IsThisEventMessage(const FString& MessageContent)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-	UPubnubJsonUtilities::StringToJsonObject(MessageContent, JsonObject);
-	
-	FString Type;
-	if (!JsonObject->TryGetStringField(ANSI_TO_TCHAR("type"), Type))
+	FPubnubChatJsonReader Reader(MessageContent);
+	if (!Reader.ReadObjectStart() || !Reader.FindKey(ANSI_TO_TCHAR("type")))
+	{ return false; }
+
+	EPubnubChatJsonToken Token;
+	if (!Reader.ReadNext(Token) || Token != EPubnubChatJsonToken::String)
 	{ return false; }
 	
 	//Message is an event if it has type field that matches any actual event type
-	for (EPubnubChatEventType EventType : TEnumRange<EPubnubChatEventType>())
+	for (const FString& EventTypeString : GetChatEventTypeStrings())
 	{
-		if (Type == UPubnubChatInternalConverters::ChatEventTypeToString(EventType))
+		if (Reader.ValueEquals(EventTypeString))
 		{
 			return true;
 		}
@@ -472,35 +508,55 @@ FString UPubnubChatInternalUtilities::GetTypingEventPayload(const bool IsTyping)
 
 bool UPubnubChatInternalUtilities::GetIsTypingFromEventPayload(const FString& EventPayload)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-	UPubnubJsonUtilities::StringToJsonObject(EventPayload, JsonObject);
-	bool IsTyping;
-	JsonObject->TryGetBoolField(ANSI_TO_TCHAR("value"), IsTyping);
+	bool IsTyping = false;
+	FPubnubChatJsonReader::TryGetBoolField(EventPayload, ANSI_TO_TCHAR("value"), IsTyping);
 	return IsTyping;
 }
 
 void UPubnubChatInternalUtilities::UpdateUserIDByPresenceEvent(TArray<FString>& UserIDs, const FString& EventContent)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-	UPubnubJsonUtilities::StringToJsonObject(EventContent, JsonObject);
-	
-	FString PresenceAction;
-	if (!JsonObject->TryGetStringField(ANSI_TO_TCHAR("action"), PresenceAction))
+	FPubnubChatJsonReader Reader(EventContent);
+	if (!Reader.ReadObjectStart())
 	{ return; }
 	
+	//Only the action is compared, so it's kept as a view of the event content
+	bool HasAction = false;
+	bool IsJoin = false;
+	bool IsLeave = false;
 	FString UserID;
-	if (!JsonObject->TryGetStringField(ANSI_TO_TCHAR("uuid"), UserID))
+	bool HasUserID = false;
+	while (Reader.ReadNextKey())
+	{
+		if (Reader.ValueEquals(ANSI_TO_TCHAR("action")))
+		{
+			EPubnubChatJsonToken Token;
+			HasAction = Reader.ReadNext(Token) && Token == EPubnubChatJsonToken::String;
+			IsJoin = HasAction && Reader.ValueEquals(ANSI_TO_TCHAR("join"));
+			IsLeave = HasAction && (Reader.ValueEquals(ANSI_TO_TCHAR("leave")) || Reader.ValueEquals(ANSI_TO_TCHAR("timeout")));
+			Reader.SkipValue(Token);
+		}
+		else if (Reader.ValueEquals(ANSI_TO_TCHAR("uuid")))
+		{
+			HasUserID = Reader.TryReadString(UserID);
+		}
+		else
+		{
+			Reader.SkipNextValue();
+		}
+	}
+	
+	if (!HasAction || !HasUserID)
 	{ return; }
 	
 	// If new user joined, add him to the list
-	if (PresenceAction == "join")
+	if (IsJoin)
 	{
 		UserIDs.AddUnique(UserID);
 		return;
 	}
 	
 	// If user left or disconnected remove him from the list
-	if (PresenceAction == "leave" || PresenceAction == "timeout")
+	if (IsLeave)
 	{
 		UserIDs.Remove(UserID);
 	}
@@ -650,6 +706,14 @@ bool UPubnubChatInternalUtilities::IsChatMessageActionEqualPubnubAction(const FP
 	return false;
 }
 
+bool UPubnubChatInternalUtilities::AreChatMessageActionsEqual(const FPubnubChatMessageAction& FirstAction, const FPubnubChatMessageAction& SecondAction)
+{
+	return FirstAction.Type == SecondAction.Type
+		&& FirstAction.Timetoken == SecondAction.Timetoken
+		&& FirstAction.UserID == SecondAction.UserID
+		&& FirstAction.Value == SecondAction.Value;
+}
+
 TArray<FPubnubChatMessageReaction> UPubnubChatInternalUtilities::GetMessageReactionsFromMessageActions(const FString& CurrentUserID, const TArray<FPubnubChatMessageAction>& MessageActions)
 {
 	TArray<FPubnubChatMessageReaction> FinalReactions;
@@ -700,88 +764,61 @@ FPubnubChatMessageReaction UPubnubChatInternalUtilities::GetReactionFromArrayByV
 
 bool UPubnubChatInternalUtilities::IsPubnubMessageChannelUpdate(const FString& MessageContent)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-	UPubnubJsonUtilities::StringToJsonObject(MessageContent, JsonObject);
-	
-	FString Source;
-	FString Type;
-	if (!JsonObject->TryGetStringField(ANSI_TO_TCHAR("source"), Source))
-	{ return false; }
-	if (!JsonObject->TryGetStringField(ANSI_TO_TCHAR("type"), Type))
-	{ return false; }
-	
 	//Pubnub Core SDK Message is Channel Update if those 2 fields are exactly matching
-	if (Source == "objects" && Type == "channel")
-	{ return true; }
-	
-	return false;
+	return FPubnubChatJsonReader::IsStringFieldEqual(MessageContent, ANSI_TO_TCHAR("source"), ANSI_TO_TCHAR("objects"))
+		&& FPubnubChatJsonReader::IsStringFieldEqual(MessageContent, ANSI_TO_TCHAR("type"), ANSI_TO_TCHAR("channel"));
 }
 
 bool UPubnubChatInternalUtilities::IsPubnubMessageUserUpdate(const FString& MessageContent)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-	UPubnubJsonUtilities::StringToJsonObject(MessageContent, JsonObject);
-	
-	FString Source;
-	FString Type;
-	if (!JsonObject->TryGetStringField(ANSI_TO_TCHAR("source"), Source))
-	{ return false; }
-	if (!JsonObject->TryGetStringField(ANSI_TO_TCHAR("type"), Type))
-	{ return false; }
-	
 	//Pubnub Core SDK Message is User Update if those 2 fields are exactly matching
-	if (Source == "objects" && Type == "uuid")
-	{ return true; }
-	
-	return false;
+	return FPubnubChatJsonReader::IsStringFieldEqual(MessageContent, ANSI_TO_TCHAR("source"), ANSI_TO_TCHAR("objects"))
+		&& FPubnubChatJsonReader::IsStringFieldEqual(MessageContent, ANSI_TO_TCHAR("type"), ANSI_TO_TCHAR("uuid"));
 }
 
 bool UPubnubChatInternalUtilities::IsPubnubMessageMembershipUpdate(const FString& MessageContent)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-	UPubnubJsonUtilities::StringToJsonObject(MessageContent, JsonObject);
-	
-	FString Source;
-	FString Type;
-	if (!JsonObject->TryGetStringField(ANSI_TO_TCHAR("source"), Source))
-	{ return false; }
-	if (!JsonObject->TryGetStringField(ANSI_TO_TCHAR("type"), Type))
-	{ return false; }
-	
 	//Pubnub Core SDK Message is Membership Update if those 2 fields are exactly matching
-	if (Source == "objects" && Type == "membership")
-	{ return true; }
-	
-	return false;
+	return FPubnubChatJsonReader::IsStringFieldEqual(MessageContent, ANSI_TO_TCHAR("source"), ANSI_TO_TCHAR("objects"))
+		&& FPubnubChatJsonReader::IsStringFieldEqual(MessageContent, ANSI_TO_TCHAR("type"), ANSI_TO_TCHAR("membership"));
 }
 
-bool UPubnubChatInternalUtilities::IsPubnubMessageChatMessageUpdate(const FString& MessageContent)
+FString UPubnubChatInternalUtilities::GetUserIDFromMembershipUpdate(const FString& MessageContent)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-	UPubnubJsonUtilities::StringToJsonObject(MessageContent, JsonObject);
+	//Membership update has format: {"data": {"channel": {"id": ...}, "uuid": {"id": ...}, ...}, ...}
+	FPubnubChatJsonReader Reader(MessageContent);
+	if (!Reader.ReadObjectStart() || !Reader.FindKey(ANSI_TO_TCHAR("data")) || !Reader.ReadObjectStart())
+	{ return ""; }
 	
-	FString Source;
-	if (!JsonObject->TryGetStringField(ANSI_TO_TCHAR("source"), Source))
-	{ return false; }
+	if (!Reader.FindKey(ANSI_TO_TCHAR("uuid")) || !Reader.ReadObjectStart())
+	{ return ""; }
 	
+	FString UserID;
+	if (Reader.FindKey(ANSI_TO_TCHAR("id")))
+	{ Reader.TryReadString(UserID); }
+	return UserID;
+}
+
+bool UPubnubChatInternalUtilities::IsPubnubMessageChatMessageUpdate(const FString& MessageContent)
+{
 	//ChatMessage update is actually adding or removing a message action
-	if (Source == "actions")
-	{ return true; }
-	
-	return false;
+	return FPubnubChatJsonReader::IsStringFieldEqual(MessageContent, ANSI_TO_TCHAR("source"), ANSI_TO_TCHAR("actions"));
 }
 
 bool UPubnubChatInternalUtilities::IsPubnubMessageDeleteEvent(const FString& MessageContent)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-	UPubnubJsonUtilities::StringToJsonObject(MessageContent, JsonObject);
-	
-	FString EventType;
-	if (JsonObject->TryGetStringField(ANSI_TO_TCHAR("event"), EventType))
+	return FPubnubChatJsonReader::IsStringFieldEqual(MessageContent, ANSI_TO_TCHAR("event"), ANSI_TO_TCHAR("delete"));
+}
+
+FString UPubnubChatInternalUtilities::GetObjectsEventServerUpdated(const FString& MessageContent)
+{
+	FString ServerUpdated;
+	FStringView EventData;
+	if (FPubnubChatJsonReader::TryGetObjectField(MessageContent, ANSI_TO_TCHAR("data"), EventData))
 	{
-		return EventType == "delete";
+		FPubnubChatJsonReader::TryGetStringField(EventData, ANSI_TO_TCHAR("updated"), ServerUpdated);
 	}
-	return false;
+	return ServerUpdated;
 }
 
 void UPubnubChatInternalUtilities::UpdateChatChannelFromPubnubChannelUpdateData(const FPubnubChannelUpdateData& PubnubChannelUpdateData, FPubnubChatChannelData& ChannelData)
@@ -949,38 +986,33 @@ bool UPubnubChatInternalUtilities::IsChannelAThread(const FString& ChannelID)
 }
 
 
-bool UPubnubChatInternalUtilities::CheckResourcePermission(const TSharedPtr<FJsonObject>& ResourcesObject, const FString& ResourceTypeStr, const FString& ResourceName, const FString& PermissionStr)
+bool UPubnubChatInternalUtilities::CheckResourcePermission(FStringView ResourcesJson, const FString& ResourceTypeStr, const FString& ResourceName, const FString& PermissionStr)
 {
-	if(!ResourcesObject.IsValid() || ResourceTypeStr.IsEmpty() || ResourceName.IsEmpty() || PermissionStr.IsEmpty())
+	if(ResourcesJson.IsEmpty() || ResourceTypeStr.IsEmpty() || ResourceName.IsEmpty() || PermissionStr.IsEmpty())
 	{
 		return false;
 	}
 
-	// Get the resource type object (Channels or Uuids)
-	const TSharedPtr<FJsonObject>* ResourceTypeObjectPtr = nullptr;
-	if(!ResourcesObject->TryGetObjectField(ResourceTypeStr, ResourceTypeObjectPtr) || !ResourceTypeObjectPtr || !(*ResourceTypeObjectPtr).IsValid())
+	// Go down through the resource type object (Channels or Uuids) and the specific resource object
+	FPubnubChatJsonReader Reader(ResourcesJson);
+	if(!Reader.ReadObjectStart() || !Reader.FindKey(ResourceTypeStr) || !Reader.ReadObjectStart())
 	{
 		return false;
 	}
 
-	const TSharedPtr<FJsonObject>& ResourceTypeObject = *ResourceTypeObjectPtr;
-
-	// Get the specific resource object
-	const TSharedPtr<FJsonObject>* ResourceObjectPtr = nullptr;
-	if(!ResourceTypeObject->TryGetObjectField(ResourceName, ResourceObjectPtr) || !ResourceObjectPtr || !(*ResourceObjectPtr).IsValid())
+	if(!Reader.FindKey(ResourceName) || !Reader.ReadObjectStart())
 	{
 		return false;
 	}
 
-	const TSharedPtr<FJsonObject>& ResourceObject = *ResourceObjectPtr;
-
 	// Check if the permission field exists and is true
-	if(!ResourceObject->HasField(PermissionStr))
+	bool HasPermission = false;
+	if(!Reader.FindKey(PermissionStr) || !Reader.TryReadBool(HasPermission))
 	{
 		return false;
 	}
 
-	return ResourceObject->GetBoolField(PermissionStr);
+	return HasPermission;
 }
 
 bool UPubnubChatInternalUtilities::CheckPatternPermission(const TSharedPtr<FJsonObject>& PatternsObject, const FString& ResourceTypeStr, const FString& ResourceName, const FString& PermissionStr)
@@ -1085,24 +1117,78 @@ uint64 UPubnubChatInternalUtilities::HashString(const FString& Str, int32 Seed)
 
 void UPubnubChatInternalUtilities::SortMessageActionsByTimetoken(TArray<FPubnubChatMessageAction>& MessageActions)
 {
-	Algo::Sort(MessageActions, [](const FPubnubChatMessageAction& A, const FPubnubChatMessageAction& B)
+	if (MessageActions.Num() < 2)
 	{
-		// Convert timetokens to int64 for proper numeric comparison
-		int64 TimetokenA = 0;
-		int64 TimetokenB = 0;
-		
-		if (!A.Timetoken.IsEmpty() && A.Timetoken.IsNumeric())
-		{
-			LexFromString(TimetokenA, *A.Timetoken);
-		}
-		
-		if (!B.Timetoken.IsEmpty() && B.Timetoken.IsNumeric())
+		return;
+	}
+	
+	// Convert every timetoken to int64 once, then sort the keys instead of parsing strings in every comparison
+	TArray<TPair<int64, int32>> SortKeys;
+	SortKeys.Reserve(MessageActions.Num());
+	for (int32 i = 0; i < MessageActions.Num(); ++i)
+	{
+		SortKeys.Add(TPair<int64, int32>(TimetokenToInt64(MessageActions[i].Timetoken), i));
+	}
+	
+	Algo::StableSort(SortKeys, [](const TPair<int64, int32>& A, const TPair<int64, int32>& B)
+	{
+		return A.Key < B.Key;
+	});
+	
+	TArray<FPubnubChatMessageAction> SortedActions;
+	SortedActions.Reserve(MessageActions.Num());
+	for (const TPair<int64, int32>& SortKey : SortKeys)
+	{
+		SortedActions.Add(MoveTemp(MessageActions[SortKey.Value]));
+	}
+	MessageActions = MoveTemp(SortedActions);
+}
+
+bool UPubnubChatInternalUtilities::TryParseTimetoken(FStringView Timetoken, int64& OutTimetoken)
+{
+	const int32 Length = Timetoken.Len();
+	// int64 can hold at most 18 digits without overflow checks
+	if (Length == 0 || Length > 18)
+	{
+		return false;
+	}
+	
+	const TCHAR* Chars = Timetoken.GetData();
+	int64 Value = 0;
+	for (int32 i = 0; i < Length; ++i)
+	{
+		const TCHAR Char = Chars[i];
+		if (Char < TEXT('0') || Char > TEXT('9'))
 		{
-			LexFromString(TimetokenB, *B.Timetoken);
+			return false;
 		}
-		
-		return TimetokenA < TimetokenB;
-	});
+		Value = Value * 10 + (Char - TEXT('0'));
+	}
+	
+	OutTimetoken = Value;
+	return true;
+}
+
+int64 UPubnubChatInternalUtilities::TimetokenToInt64(const FString& Timetoken)
+{
+	int64 Value = 0;
+	return TryParseTimetoken(Timetoken, Value) ? Value : 0;
+}
+
+FString UPubnubChatInternalUtilities::Int64ToTimetoken(const int64 Timetoken)
+{
+	return LexToString(Timetoken);
+}
+
+FString UPubnubChatInternalUtilities::AddIntToTimetoken(const FString& Timetoken, const int64 Value)
+{
+	int64 TimetokenValue = 0;
+	if (!TryParseTimetoken(Timetoken, TimetokenValue))
+	{
+		return Timetoken;
+	}
+	
+	return Int64ToTimetoken(TimetokenValue + Value);
 }
 
 FString UPubnubChatInternalUtilities::GetLastActiveTimestampPropertyKey()
@@ -1117,14 +1203,8 @@ FString UPubnubChatInternalUtilities::GetLastActiveTimestampFromCustom(const FSt
 		return FString();
 	}
 
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-	if (!UPubnubJsonUtilities::StringToJsonObject(CurrentCustom, JsonObject))
-	{
-		return FString();
-	}
-
 	FString Timestamp;
-	if (JsonObject->TryGetStringField(GetLastActiveTimestampPropertyKey(), Timestamp))
+	if (FPubnubChatJsonReader::TryGetStringField(CurrentCustom, Pubnub_Chat_LastActiveTimestamp_Property_Name, Timestamp))
 	{
 		return Timestamp;
 	}
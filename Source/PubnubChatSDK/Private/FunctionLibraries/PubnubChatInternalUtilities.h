@@ -10,6 +10,7 @@
 #include "StructLibraries/PubnubChatChannelStructLibrary.h"
 #include "StructLibraries/PubnubChatMessageStructLibrary.h"
 #include "StructLibraries/PubnubChatUserStructLibrary.h"
+#include "FunctionLibraries/PubnubUtilities.h"
 #include "PubnubChatInternalUtilities.generated.h"
 
 class FJsonObject;
@@ -39,6 +40,8 @@ public:
 	static FString PublishedStringToChatMessage(const FString PublishedMessage);
 	static FString SendTextMetaFromParams(const FPubnubChatSendTextParams& SendTextParams, UPubnubChatMessage* QuotedMessage = nullptr);
 	static FString GetForwardedMessageMeta(const FString& OriginalMessageMeta, const FString& UserID, const FString& ChannelID);
+	/** True if text of given published message contains a mention link of given user, as created by message drafts */
+	static bool IsUserMentionedInPublishedMessage(const FString& PublishedMessage, const FString& UserID);
 
 	/**
 	 * Parses message metadata JSON and extracts quoted message data if present.
@@ -47,6 +50,10 @@ public:
 	 * @return Quoted message data; all fields empty if Meta is empty or quotedMessage is missing.
 	 */
 	static FPubnubChatQuotedMessageData GetQuotedMessageDataFromMeta(const FString& Meta);
+	/** Adds client generated ID of a locally echoed message to the message Meta */
+	static FString AddClientMessageIDToMeta(const FString& Meta, const FString& ClientMessageID);
+	/** Gets client generated ID of a locally echoed message from the message Meta, empty if there is none */
+	static FString GetClientMessageIDFromMeta(const FString& Meta);
 	
 	
 	/* RESTRICTIONS */
@@ -102,6 +109,7 @@ public:
 	static FPubnubChatMessageAction GetMessageReactionForUserID(const TArray<FPubnubChatMessageAction>& MessageReactions, const FString& Reaction, const FString& UserID);
 	static bool RemoveReactionFromReactionsArray(TArray<FPubnubChatMessageAction>& MessageReactions, const FPubnubChatMessageAction& Reaction);
 	static bool IsChatMessageActionEqualPubnubAction(const FPubnubChatMessageAction& ChatAction, const FPubnubMessageActionData& PubnubAction);
+	static bool AreChatMessageActionsEqual(const FPubnubChatMessageAction& FirstAction, const FPubnubChatMessageAction& SecondAction);
 	static TArray<FPubnubChatMessageReaction> GetMessageReactionsFromMessageActions(const FString& CurrentUserID, const TArray<FPubnubChatMessageAction>& MessageActions);
 	static FPubnubChatMessageReaction GetReactionFromArrayByValue(const FString& Value, const TArray<FPubnubChatMessageReaction>& Reactions);
 	
@@ -112,6 +120,10 @@ public:
 	static bool IsPubnubMessageMembershipUpdate(const FString& MessageContent);
 	static bool IsPubnubMessageChatMessageUpdate(const FString& MessageContent);
 	static bool IsPubnubMessageDeleteEvent(const FString& MessageContent);
+	/** Gets server "updated" timestamp from data of App Context event, empty if the event doesn't have it */
+	static FString GetObjectsEventServerUpdated(const FString& MessageContent);
+	/** Returns UserID of the membership that given membership update is about, or empty string if it can't be found */
+	static FString GetUserIDFromMembershipUpdate(const FString& MessageContent);
 	static void UpdateChatChannelFromPubnubChannelUpdateData(const FPubnubChannelUpdateData& PubnubChannelUpdateData, FPubnubChatChannelData& ChannelData);
 	static void UpdateChatUserFromPubnubUserUpdateData(const FPubnubUserUpdateData& PubnubUserUpdateData, FPubnubChatUserData& UserData);
 	static void UpdateChatMembershipFromPubnubMembershipUpdateData(const FPubnubMembershipUpdateData& PubnubMembershipUpdateData, FPubnubChatMembershipData& MembershipData);
@@ -138,8 +150,9 @@ public:
 
 	/**
 	 * Checks if a permission exists and is true for a given resource in Resources (exact match).
+	 * @param ResourcesJson Text of the token's Resources object. It's read in place, without parsing the whole token.
 	 */
-	static bool CheckResourcePermission(const TSharedPtr<FJsonObject>& ResourcesObject, const FString& ResourceTypeStr, const FString& ResourceName, const FString& PermissionStr);
+	static bool CheckResourcePermission(FStringView ResourcesJson, const FString& ResourceTypeStr, const FString& ResourceName, const FString& PermissionStr);
 
 	/**
 	 * Checks if a permission exists and is true for a given resource in Patterns (regex match).
@@ -182,11 +195,38 @@ public:
 
 	/**
 	 * Sorts message actions by timetoken in ascending order (oldest first, most recent last).
-	 * Timetokens are compared numerically after conversion to int64.
+	 * Every timetoken is converted to int64 only once, before sorting.
 	 * @param MessageActions Array of message actions to sort (modified in place)
 	 */
 	static void SortMessageActionsByTimetoken(TArray<FPubnubChatMessageAction>& MessageActions);
 
+	/* TIMETOKENS */
+
+	/**
+	 * Parses timetoken string into int64 without any allocations.
+	 * @param Timetoken Timetoken string (only digits are accepted)
+	 * @param OutTimetoken Parsed timetoken value
+	 * @return True if Timetoken is a valid non-negative integer that fits into int64
+	 */
+	static bool TryParseTimetoken(FStringView Timetoken, int64& OutTimetoken);
+
+	/**
+	 * Converts timetoken string to int64.
+	 * @return Parsed timetoken value, or 0 if Timetoken is not a valid number
+	 */
+	static int64 TimetokenToInt64(const FString& Timetoken);
+
+	/**
+	 * Converts int64 timetoken to its string representation used by the Blueprint API and server.
+	 */
+	static FString Int64ToTimetoken(const int64 Timetoken);
+
+	/**
+	 * Adds integer value to the timetoken using int64 arithmetic.
+	 * @return Timetoken increased by Value, or unchanged Timetoken if it's not a valid number
+	 */
+	static FString AddIntToTimetoken(const FString& Timetoken, const int64 Value);
+
 
 	/* TEMPLATES */
 	
@@ -204,4 +244,21 @@ public:
 
 		return ObjectsArrayCopy;
 	}
+
+	/**
+	 * Calls the callback of an async operation that was skipped, with the cancelled result from AsyncHandle.
+	 * Works for callbacks taking FPubnubChatOperationResult and for result structs with FPubnubChatOperationResult Result field.
+	 */
+	template<typename ResultType>
+	static void CallCancelledDelegate(const TDelegate<void(const ResultType&)>& Delegate, const FPubnubChatAsyncHandle& AsyncHandle)
+	{
+		ResultType CancelledResult{};
+		SetChatOperationResult(CancelledResult, AsyncHandle.CreateCancelledResult());
+		UPubnubUtilities::CallPubnubDelegate(Delegate, CancelledResult);
+	}
+
+private:
+	static void SetChatOperationResult(FPubnubChatOperationResult& Result, const FPubnubChatOperationResult& OperationResult) { Result = OperationResult; }
+	template<typename ResultType>
+	static void SetChatOperationResult(ResultType& Result, const FPubnubChatOperationResult& OperationResult) { Result.Result = OperationResult; }
 };
@@ -0,0 +1,500 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+
+#include "FunctionLibraries/PubnubChatJsonReader.h"
+#include "Misc/Parse.h"
+
+
+namespace
+{
+	bool ParseHexCodeUnit(FStringView Text, int32 Start, uint32& OutCodeUnit)
+	{
+		if (Start + 4 > Text.Len())
+		{
+			return false;
+		}
+
+		OutCodeUnit = 0;
+		for (int32 Index = Start; Index < Start + 4; ++Index)
+		{
+			if (!FChar::IsHexDigit(Text[Index]))
+			{
+				return false;
+			}
+			OutCodeUnit = (OutCodeUnit << 4) | FParse::HexDigit(Text[Index]);
+		}
+		return true;
+	}
+}
+
+FPubnubChatJsonReader::FPubnubChatJsonReader(FStringView InJson)
+	: Json(InJson)
+{
+}
+
+bool FPubnubChatJsonReader::ReadNext(EPubnubChatJsonToken& OutToken)
+{
+	if (bHasError)
+	{
+		OutToken = EPubnubChatJsonToken::Error;
+		return false;
+	}
+
+	//Separators only decide if the next string is a key or a value
+	while (true)
+	{
+		SkipWhitespace();
+		if (Position >= Json.Len())
+		{
+			OutToken = EPubnubChatJsonToken::None;
+			return false;
+		}
+
+		const TCHAR Char = Json[Position];
+		if (Char == TEXT(','))
+		{
+			bExpectKey = !Containers.IsEmpty() && Containers.Last() == EContainer::Object;
+			++Position;
+		}
+		else if (Char == TEXT(':'))
+		{
+			bExpectKey = false;
+			++Position;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	TokenStart = Position;
+	RawValue = FStringView();
+	bRawValueHasEscapes = false;
+
+	const TCHAR Char = Json[Position];
+	switch (Char)
+	{
+	case TEXT('{'):
+		Containers.Push(EContainer::Object);
+		bExpectKey = true;
+		++Position;
+		OutToken = EPubnubChatJsonToken::BeginObject;
+		return true;
+	case TEXT('}'):
+		if (!CloseContainer(EContainer::Object))
+		{
+			return SetError(OutToken);
+		}
+		OutToken = EPubnubChatJsonToken::EndObject;
+		return true;
+	case TEXT('['):
+		Containers.Push(EContainer::Array);
+		bExpectKey = false;
+		++Position;
+		OutToken = EPubnubChatJsonToken::BeginArray;
+		return true;
+	case TEXT(']'):
+		if (!CloseContainer(EContainer::Array))
+		{
+			return SetError(OutToken);
+		}
+		OutToken = EPubnubChatJsonToken::EndArray;
+		return true;
+	case TEXT('"'):
+		{
+			const bool bIsKey = bExpectKey;
+			if (!ReadStringToken())
+			{
+				return SetError(OutToken);
+			}
+			bExpectKey = false;
+			OutToken = bIsKey ? EPubnubChatJsonToken::Key : EPubnubChatJsonToken::String;
+			return true;
+		}
+	case TEXT('t'):
+		OutToken = EPubnubChatJsonToken::True;
+		return ReadLiteralToken(TEXT("true")) || SetError(OutToken);
+	case TEXT('f'):
+		OutToken = EPubnubChatJsonToken::False;
+		return ReadLiteralToken(TEXT("false")) || SetError(OutToken);
+	case TEXT('n'):
+		OutToken = EPubnubChatJsonToken::Null;
+		return ReadLiteralToken(TEXT("null")) || SetError(OutToken);
+	default:
+		if (Char == TEXT('-') || FChar::IsDigit(Char))
+		{
+			OutToken = EPubnubChatJsonToken::Number;
+			return ReadNumberToken() || SetError(OutToken);
+		}
+		return SetError(OutToken);
+	}
+}
+
+bool FPubnubChatJsonReader::ReadObjectStart()
+{
+	EPubnubChatJsonToken Token;
+	return ReadNext(Token) && Token == EPubnubChatJsonToken::BeginObject;
+}
+
+bool FPubnubChatJsonReader::ReadNextKey()
+{
+	EPubnubChatJsonToken Token;
+	if (!ReadNext(Token))
+	{
+		return false;
+	}
+
+	if (Token == EPubnubChatJsonToken::Key)
+	{
+		return true;
+	}
+
+	//Anything other than the end of the object is malformed input
+	if (Token != EPubnubChatJsonToken::EndObject)
+	{
+		bHasError = true;
+	}
+	return false;
+}
+
+bool FPubnubChatJsonReader::SkipNextValue()
+{
+	EPubnubChatJsonToken Token;
+	return ReadNext(Token) && SkipValue(Token);
+}
+
+bool FPubnubChatJsonReader::SkipValue(EPubnubChatJsonToken Token)
+{
+	if (Token != EPubnubChatJsonToken::BeginObject && Token != EPubnubChatJsonToken::BeginArray)
+	{
+		return Token != EPubnubChatJsonToken::None && Token != EPubnubChatJsonToken::Error;
+	}
+
+	//Read until the container started by this token is closed
+	const int32 Depth = Containers.Num();
+	while (Containers.Num() >= Depth)
+	{
+		EPubnubChatJsonToken NestedToken;
+		if (!ReadNext(NestedToken))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FPubnubChatJsonReader::FindKey(FStringView Key)
+{
+	while (ReadNextKey())
+	{
+		if (ValueEquals(Key))
+		{
+			return true;
+		}
+		if (!SkipNextValue())
+		{
+			return false;
+		}
+	}
+	return false;
+}
+
+bool FPubnubChatJsonReader::TryReadString(FString& OutValue)
+{
+	EPubnubChatJsonToken Token;
+	if (!ReadNext(Token))
+	{
+		return false;
+	}
+
+	switch (Token)
+	{
+	case EPubnubChatJsonToken::String:
+		OutValue = GetStringValue();
+		return true;
+	case EPubnubChatJsonToken::Number:
+	case EPubnubChatJsonToken::True:
+	case EPubnubChatJsonToken::False:
+		OutValue = FString(RawValue);
+		return true;
+	default:
+		SkipValue(Token);
+		return false;
+	}
+}
+
+bool FPubnubChatJsonReader::TryReadBool(bool& OutValue)
+{
+	EPubnubChatJsonToken Token;
+	if (!ReadNext(Token))
+	{
+		return false;
+	}
+
+	if (Token == EPubnubChatJsonToken::True || Token == EPubnubChatJsonToken::False)
+	{
+		OutValue = Token == EPubnubChatJsonToken::True;
+		return true;
+	}
+
+	SkipValue(Token);
+	return false;
+}
+
+bool FPubnubChatJsonReader::TryReadObject(FStringView& OutObject)
+{
+	EPubnubChatJsonToken Token;
+	if (!ReadNext(Token))
+	{
+		return false;
+	}
+
+	const int32 ObjectStart = TokenStart;
+	if (!SkipValue(Token) || Token != EPubnubChatJsonToken::BeginObject)
+	{
+		return false;
+	}
+
+	OutObject = Json.Mid(ObjectStart, Position - ObjectStart);
+	return true;
+}
+
+bool FPubnubChatJsonReader::ValueEquals(FStringView Value, ESearchCase::Type SearchCase) const
+{
+	if (!bRawValueHasEscapes)
+	{
+		return RawValue.Equals(Value, SearchCase);
+	}
+
+	const FString UnescapedValue = GetStringValue();
+	return FStringView(UnescapedValue).Equals(Value, SearchCase);
+}
+
+FString FPubnubChatJsonReader::GetStringValue() const
+{
+	if (!bRawValueHasEscapes)
+	{
+		return FString(RawValue);
+	}
+
+	FString Value;
+	UnescapeString(RawValue, Value);
+	return Value;
+}
+
+bool FPubnubChatJsonReader::TryGetStringField(FStringView Json, FStringView Key, FString& OutValue)
+{
+	FPubnubChatJsonReader Reader(Json);
+	return Reader.ReadObjectStart() && Reader.FindKey(Key) && Reader.TryReadString(OutValue);
+}
+
+bool FPubnubChatJsonReader::TryGetBoolField(FStringView Json, FStringView Key, bool& OutValue)
+{
+	FPubnubChatJsonReader Reader(Json);
+	return Reader.ReadObjectStart() && Reader.FindKey(Key) && Reader.TryReadBool(OutValue);
+}
+
+bool FPubnubChatJsonReader::TryGetObjectField(FStringView Json, FStringView Key, FStringView& OutObject)
+{
+	FPubnubChatJsonReader Reader(Json);
+	return Reader.ReadObjectStart() && Reader.FindKey(Key) && Reader.TryReadObject(OutObject);
+}
+
+bool FPubnubChatJsonReader::IsStringFieldEqual(FStringView Json, FStringView Key, FStringView Value)
+{
+	FPubnubChatJsonReader Reader(Json);
+	if (!Reader.ReadObjectStart() || !Reader.FindKey(Key))
+	{
+		return false;
+	}
+
+	EPubnubChatJsonToken Token;
+	return Reader.ReadNext(Token) && Token == EPubnubChatJsonToken::String && Reader.ValueEquals(Value);
+}
+
+FString FPubnubChatJsonReader::RemoveField(FStringView Json, FStringView Key)
+{
+	FPubnubChatJsonReader Reader(Json);
+	if (!Reader.ReadObjectStart())
+	{
+		return TEXT("{}");
+	}
+
+	while (Reader.ReadNextKey())
+	{
+		const int32 FieldStart = Reader.GetTokenStart();
+		const bool bIsRemovedField = Reader.ValueEquals(Key);
+		if (!Reader.SkipNextValue())
+		{
+			break;
+		}
+		if (!bIsRemovedField)
+		{
+			continue;
+		}
+
+		//Remove the separator after the field, or the one before it if this is the last field
+		int32 RemoveStart = FieldStart;
+		int32 RemoveEnd = Reader.GetPosition();
+		int32 NextIndex = RemoveEnd;
+		while (NextIndex < Json.Len() && FChar::IsWhitespace(Json[NextIndex]))
+		{
+			++NextIndex;
+		}
+		if (NextIndex < Json.Len() && Json[NextIndex] == TEXT(','))
+		{
+			RemoveEnd = NextIndex + 1;
+		}
+		else
+		{
+			int32 PreviousIndex = RemoveStart - 1;
+			while (PreviousIndex >= 0 && FChar::IsWhitespace(Json[PreviousIndex]))
+			{
+				--PreviousIndex;
+			}
+			if (PreviousIndex >= 0 && Json[PreviousIndex] == TEXT(','))
+			{
+				RemoveStart = PreviousIndex;
+			}
+		}
+
+		FString Result;
+		Result.Reserve(Json.Len() - (RemoveEnd - RemoveStart));
+		Result.Append(Json.GetData(), RemoveStart);
+		Result.Append(Json.GetData() + RemoveEnd, Json.Len() - RemoveEnd);
+		return Result;
+	}
+
+	return Reader.HasError() ? FString(TEXT("{}")) : FString(Json);
+}
+
+void FPubnubChatJsonReader::SkipWhitespace()
+{
+	while (Position < Json.Len() && FChar::IsWhitespace(Json[Position]))
+	{
+		++Position;
+	}
+}
+
+bool FPubnubChatJsonReader::ReadStringToken()
+{
+	const int32 ValueStart = Position + 1;
+	for (int32 Index = ValueStart; Index < Json.Len(); ++Index)
+	{
+		const TCHAR Char = Json[Index];
+		if (Char == TEXT('\\'))
+		{
+			bRawValueHasEscapes = true;
+			++Index;
+		}
+		else if (Char == TEXT('"'))
+		{
+			RawValue = Json.Mid(ValueStart, Index - ValueStart);
+			Position = Index + 1;
+			return true;
+		}
+	}
+
+	//Unterminated string
+	return false;
+}
+
+bool FPubnubChatJsonReader::ReadLiteralToken(FStringView Literal)
+{
+	if (!Json.Mid(Position, Literal.Len()).Equals(Literal, ESearchCase::CaseSensitive))
+	{
+		return false;
+	}
+
+	RawValue = Json.Mid(Position, Literal.Len());
+	Position += Literal.Len();
+	return true;
+}
+
+bool FPubnubChatJsonReader::ReadNumberToken()
+{
+	int32 Index = Position;
+	while (Index < Json.Len())
+	{
+		const TCHAR Char = Json[Index];
+		if (!FChar::IsDigit(Char) && Char != TEXT('-') && Char != TEXT('+') && Char != TEXT('.') && Char != TEXT('e') && Char != TEXT('E'))
+		{
+			break;
+		}
+		++Index;
+	}
+
+	RawValue = Json.Mid(Position, Index - Position);
+	Position = Index;
+	return !RawValue.IsEmpty();
+}
+
+bool FPubnubChatJsonReader::SetError(EPubnubChatJsonToken& OutToken)
+{
+	bHasError = true;
+	OutToken = EPubnubChatJsonToken::Error;
+	return false;
+}
+
+bool FPubnubChatJsonReader::CloseContainer(EContainer Container)
+{
+	if (Containers.IsEmpty() || Containers.Last() != Container)
+	{
+		return false;
+	}
+
+	Containers.Pop();
+	bExpectKey = false;
+	++Position;
+	return true;
+}
+
+void FPubnubChatJsonReader::UnescapeString(FStringView Escaped, FString& OutValue)
+{
+	OutValue.Reset(Escaped.Len());
+	for (int32 Index = 0; Index < Escaped.Len(); ++Index)
+	{
+		const TCHAR Char = Escaped[Index];
+		if (Char != TEXT('\\') || Index + 1 >= Escaped.Len())
+		{
+			OutValue.AppendChar(Char);
+			continue;
+		}
+
+		const TCHAR EscapedChar = Escaped[++Index];
+		switch (EscapedChar)
+		{
+		case TEXT('b'): OutValue.AppendChar(TEXT('\b')); break;
+		case TEXT('f'): OutValue.AppendChar(TEXT('\f')); break;
+		case TEXT('n'): OutValue.AppendChar(TEXT('\n')); break;
+		case TEXT('r'): OutValue.AppendChar(TEXT('\r')); break;
+		case TEXT('t'): OutValue.AppendChar(TEXT('\t')); break;
+		case TEXT('u'):
+			{
+				uint32 CodePoint = 0;
+				if (!ParseHexCodeUnit(Escaped, Index + 1, CodePoint))
+				{
+					OutValue.AppendChar(EscapedChar);
+					break;
+				}
+				Index += 4;
+
+				//With 32 bit TCHAR surrogate pair has to be combined into a single character
+				uint32 LowSurrogate = 0;
+				if (sizeof(TCHAR) == 4 && CodePoint >= 0xD800 && CodePoint <= 0xDBFF
+					&& Index + 2 < Escaped.Len() && Escaped[Index + 1] == TEXT('\\') && Escaped[Index + 2] == TEXT('u')
+					&& ParseHexCodeUnit(Escaped, Index + 3, LowSurrogate) && LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+				{
+					CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+					Index += 6;
+				}
+				OutValue.AppendChar(static_cast<TCHAR>(CodePoint));
+				break;
+			}
+		default:
+			//Quote, backslash and slash are kept as they are
+			OutValue.AppendChar(EscapedChar);
+			break;
+		}
+	}
+}
@@ -0,0 +1,136 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Tokens returned by FPubnubChatJsonReader */
+enum class EPubnubChatJsonToken : uint8
+{
+	None,
+	BeginObject,
+	EndObject,
+	BeginArray,
+	EndArray,
+	Key,
+	String,
+	Number,
+	True,
+	False,
+	Null,
+	Error
+};
+
+/**
+ * Lightweight pull reader of JSON text. Reads tokens directly from the given string view without building a DOM,
+ * so extracting a few fields from a message payload doesn't allocate anything except the returned values.
+ * Key and string values are kept as views of the source text, and are unescaped only when requested.
+ * The reader is lenient - it validates only what is needed to find values, not the full JSON grammar.
+ * Source text has to outlive the reader and any views returned from it.
+ *
+ * Typical usage - reading fields of an object:
+ *	FPubnubChatJsonReader Reader(Json);
+ *	if (!Reader.ReadObjectStart()) { return; }
+ *	while (Reader.ReadNextKey())
+ *	{
+ *		if (Reader.ValueEquals(TEXT("text"))) { Reader.TryReadString(Text); }
+ *		else { Reader.SkipNextValue(); }
+ *	}
+ */
+class PUBNUBCHATSDK_API FPubnubChatJsonReader
+{
+public:
+	explicit FPubnubChatJsonReader(FStringView InJson);
+
+	/**
+	 * Reads the next token. Separators (':' and ',') are consumed internally.
+	 * @return False at the end of the input or when the input is malformed (token is None or Error)
+	 */
+	bool ReadNext(EPubnubChatJsonToken& OutToken);
+
+	/** Reads the next token and returns true if it starts an object */
+	bool ReadObjectStart();
+
+	/** Reads the next key of the current object. @return False when the object ends or the input is malformed */
+	bool ReadNextKey();
+
+	/** Skips the value following the last read key (with all nested objects and arrays) */
+	bool SkipNextValue();
+
+	/** Skips the rest of the value started by given token, if it's an object or array. Other tokens are already complete */
+	bool SkipValue(EPubnubChatJsonToken Token);
+
+	/** Reads keys of the current object until given key is found. Reader is then positioned before its value */
+	bool FindKey(FStringView Key);
+
+	/**
+	 * Reads the next value as a string. Numbers and booleans are returned as their text, the same as FJsonObject::TryGetStringField does.
+	 * Other values are skipped. @return False if the value can't be represented as a string
+	 */
+	bool TryReadString(FString& OutValue);
+
+	/** Reads the next value as a bool. Other values are skipped */
+	bool TryReadBool(bool& OutValue);
+
+	/** Reads the next value as an object and returns its whole text (including braces). Other values are skipped */
+	bool TryReadObject(FStringView& OutObject);
+
+	/**
+	 * Compares the last read key or string value with given text, without allocating.
+	 * Comparison ignores case by default, the same as FJsonObject field lookup and FString comparison.
+	 */
+	bool ValueEquals(FStringView Value, ESearchCase::Type SearchCase = ESearchCase::IgnoreCase) const;
+
+	/** Unescaped text of the last read key or string value */
+	FString GetStringValue() const;
+
+	/** Source text of the last read token. For keys and strings it's the text between the quotes, still escaped */
+	FStringView GetRawValue() const { return RawValue; }
+
+	/** Offset of the first character of the last read token in the source text */
+	int32 GetTokenStart() const { return TokenStart; }
+
+	/** Offset of the first character after the last read token in the source text */
+	int32 GetPosition() const { return Position; }
+
+	bool HasError() const { return bHasError; }
+
+
+	/* SINGLE FIELD HELPERS - read given field of the root object */
+
+	static bool TryGetStringField(FStringView Json, FStringView Key, FString& OutValue);
+	static bool TryGetBoolField(FStringView Json, FStringView Key, bool& OutValue);
+	static bool TryGetObjectField(FStringView Json, FStringView Key, FStringView& OutObject);
+	/** True if the root object has given string field with given value */
+	static bool IsStringFieldEqual(FStringView Json, FStringView Key, FStringView Value);
+
+	/**
+	 * Copies the root object without given field (and its separator). Rest of the text is kept exactly as it was.
+	 * @return Unchanged text if the field isn't present, "{}" if the text isn't an object
+	 */
+	static FString RemoveField(FStringView Json, FStringView Key);
+
+private:
+	enum class EContainer : uint8
+	{
+		Object,
+		Array
+	};
+
+	FStringView Json;
+	int32 Position = 0;
+	int32 TokenStart = 0;
+	FStringView RawValue;
+	bool bRawValueHasEscapes = false;
+	bool bExpectKey = false;
+	bool bHasError = false;
+	TArray<EContainer, TInlineAllocator<16>> Containers;
+
+	void SkipWhitespace();
+	bool ReadStringToken();
+	bool ReadLiteralToken(FStringView Literal);
+	bool ReadNumberToken();
+	bool SetError(EPubnubChatJsonToken& OutToken);
+	bool CloseContainer(EContainer Container);
+	static void UnescapeString(FStringView Escaped, FString& OutValue);
+};
@@ -14,6 +14,18 @@
 #include "FunctionLibraries/PubnubChatLogUtilities.h"
 #include "FunctionLibraries/PubnubChatInternalUtilities.h"
 #include "PubnubChatObjectsRepository.h"
+#include "PubnubChatUnreadTracker.h"
+#include "PubnubChatReconnectCatchUp.h"
+#include "PubnubChatActivityHeartbeat.h"
+#include "PubnubChatBootstrap.h"
+#include "PubnubChatOutbox.h"
+#include "PubnubChatReactionCoordinator.h"
+#include "PubnubChatReadMarkerWriter.h"
+#include "PubnubChatFilePersistentStore.h"
+#include "PubnubChatUpdatesStream.h"
+#include "PubnubChatDispatchQueue.h"
+#include "PubnubChatRequestWorkers.h"
+#include "PubnubChatStats.h"
 #include "PubnubChatUser.h"
 #include "PubnubChatChannel.h"
 #include "PubnubChatThreadChannel.h"
@@ -21,29 +33,81 @@
 #include "PubnubChatConst.h"
 #include "PubnubChatMessage.h"
 #include "PubnubChatMembership.h"
+#include "PubnubChatMessageDraft.h"
 #include "Entities/PubnubChannelEntity.h"
 #include "Entities/PubnubSubscription.h"
 #include "FunctionLibraries/PubnubJsonUtilities.h"
 #include "FunctionLibraries/PubnubTimetokenUtilities.h"
-#include "Kismet/GameplayStatics.h"
-#include "Engine/GameInstance.h"
 #include "FunctionLibraries/PubnubUtilities.h"
 #include "FunctionLibraries/PubnubInternalUtilities.h"
 #include "Misc/DateTime.h"
+#include "Algo/BinarySearch.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/GarbageCollection.h"
 #include "Threads/PubnubFunctionThread.h"
 
 DEFINE_LOG_CATEGORY(PubnubChatLog)
+DEFINE_STAT(STAT_PubnubChatLiveMessages);
+DEFINE_STAT(STAT_PubnubChatMessagesCreated);
+DEFINE_STAT(STAT_PubnubChatMessagesReused);
+
+LLM_DEFINE_TAG(PubnubChat);
+LLM_DEFINE_TAG(PubnubChat_Repository, NAME_None, TEXT("PubnubChat"));
+
+static FAutoConsoleCommandWithOutputDevice PubnubChatDumpStatsCommand(
+	TEXT("pubnubchat.dumpstats"),
+	TEXT("Prints memory stats of all initialized PubNub chats: repository entries, live chat objects, subscriptions and cache sizes"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&UPubnubChat::DumpMemoryStats));
 
 
 void UPubnubChat::DestroyChat()
 {
-	// Clear timers for user activity timestamp
-	UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(this);
-	if (GameInstance)
+	ReleaseChatComponents();
+	
+	// Chats created with InitChat own their dedicated client and must release it during teardown.
+	if(PubnubClient && bOwnsPubnubClient)
+	{
+		PubnubClient->DestroyClient();
+	}
+
+	IsInitialized = false;
+	bOwnsPubnubClient = false;
+	PubnubClient = nullptr;
+	
+	OnChatDestroyed.Broadcast(CurrentUserID);
+	OnChatDestroyedNative.Broadcast(CurrentUserID);
+}
+
+void UPubnubChat::ReleaseChatComponents()
+{
+	// Drop pending events before chat objects are cleaned up
+	if (DispatchQueue)
+	{
+		DispatchQueue->Stop();
+		DispatchQueue = nullptr;
+	}
+	
+	// Stop storing user activity timestamps before the async thread is stopped
+	if (ActivityHeartbeat)
+	{
+		ActivityHeartbeat->Stop();
+		ActivityHeartbeat = nullptr;
+	}
+	
+	// Drop reaction toggles that were not sent yet, so the flush ticker doesn't queue them on a stopped thread
+	if (ReactionCoordinator)
+	{
+		ReactionCoordinator->Stop();
+		ReactionCoordinator = nullptr;
+	}
+	
+	// Drop last read markers that were not written yet, so the flush ticker doesn't queue them on a stopped thread
+	if (ReadMarkerWriter)
 	{
-		FTimerManager& TimerManager = GameInstance->GetTimerManager();
-		TimerManager.ClearTimer(LastSavedActivityIntervalTimerHandle);
-		TimerManager.ClearTimer(RunWithDelayTimerHandle);
+		ReadMarkerWriter->Stop();
+		ReadMarkerWriter = nullptr;
 	}
 	
 	if(AsyncFunctionsThread)
@@ -54,15 +118,83 @@ void UPubnubChat::DestroyChat()
 	delete AsyncFunctionsThread;
 	AsyncFunctionsThread = nullptr;
 	
+	//Request workers are only used from async functions and blocking calls, so nothing waits for them anymore
+	if (RequestWorkers)
+	{
+		RequestWorkers->Stop();
+		RequestWorkers = nullptr;
+	}
+	
+	//Outbox is closed after the async thread stopped, so no flush is writing to its journal. Queued mutations stay in the journal
+	if (Outbox)
+	{
+		Outbox->CloseJournal();
+		Outbox = nullptr;
+	}
+	
+	// Unsubscribe unread tracking before the client is released
+	if (UnreadTracker)
+	{
+		if (ObjectsRepository)
+		{
+			ObjectsRepository->OnMembershipDataUpdatedNative.RemoveAll(UnreadTracker);
+		}
+		UnreadTracker->StopTracking();
+		UnreadTracker = nullptr;
+	}
+	
+	if (ReconnectCatchUp)
+	{
+		ReconnectCatchUp->Reset();
+		ReconnectCatchUp = nullptr;
+	}
+	
+	Bootstrap = nullptr;
+	
+	// Stop collection updates streams before the client is released. Stop removes the stream from UpdatesStreams
+	TArray<TObjectPtr<UPubnubChatUpdatesStream>> StreamsToStop;
+	{
+		FScopeLock Lock(&UpdatesStreamsCriticalSection);
+		StreamsToStop = UpdatesStreams;
+	}
+	for (UPubnubChatUpdatesStream* UpdatesStream : StreamsToStop)
+	{
+		if (UpdatesStream)
+		{
+			UpdatesStream->Stop();
+		}
+	}
+	{
+		FScopeLock Lock(&UpdatesStreamsCriticalSection);
+		UpdatesStreams.Empty();
+	}
+	
 	if(PubnubClient)
 	{
 		PubnubClient->OnSubscriptionStatusChanged.RemoveDynamic(this, &UPubnubChat::OnPubnubSubscriptionStatusChanged);
-		
-		// Chats created with InitChat own their dedicated client and must release it during teardown.
-		if(bOwnsPubnubClient)
+	}
+
+	{
+		FScopeLock Lock(&CreatedModerationChannelsCriticalSection);
+		CreatedModerationChannels.Empty();
+	}
+
+	// Forget live message objects - they are cleaned up by OnChatDestroyed
+	{
+		FScopeLock Lock(&LiveMessageObjectsCriticalSection);
+		LiveMessageObjects.Empty();
+		SET_DWORD_STAT(STAT_PubnubChatLiveMessages, 0);
+	}
+
+	// Close persistent store before the repository is cleared - stored data stays for the next session
+	if (PersistentStore)
+	{
+		if (ObjectsRepository)
 		{
-			PubnubClient->DestroyClient();
+			ObjectsRepository->SetPersistentStore(nullptr);
 		}
+		PersistentStore->CloseStore();
+		PersistentStore = nullptr;
 	}
 
 	// Clear repository data
@@ -71,13 +203,149 @@ void UPubnubChat::DestroyChat()
 		ObjectsRepository->ClearAll();
 		ObjectsRepository = nullptr;
 	}
+}
 
-	IsInitialized = false;
-	bOwnsPubnubClient = false;
-	PubnubClient = nullptr;
+FPubnubChatMemoryStats UPubnubChat::GetMemoryStats() const
+{
+	//TObjectIterator is only safe on the game thread
+	check(IsInGameThread());
 	
-	OnChatDestroyed.Broadcast(CurrentUserID);
-	OnChatDestroyedNative.Broadcast(CurrentUserID);
+	FPubnubChatMemoryStats MemoryStats;
+	if (!IsInitialized)
+	{return MemoryStats;}
+	
+	ObjectsRepository->GetMemoryStats(MemoryStats);
+	{
+		FScopeLock Lock(&LiveMessageObjectsCriticalSection);
+		MemoryStats.LiveMessageObjectsCount = LiveMessageObjects.Num();
+	}
+	MemoryStats.ActiveSubscriptionsCount = ListenForEventsSubscriptions.Num();
+	{
+		FScopeLock Lock(&UpdatesStreamsCriticalSection);
+		MemoryStats.UpdatesStreamsCount = UpdatesStreams.Num();
+	}
+	MemoryStats.PendingDispatchEventsCount = DispatchQueue ? DispatchQueue->GetNumPendingEvents() : 0;
+	MemoryStats.PendingReactionsCount = ReactionCoordinator ? ReactionCoordinator->GetNumPendingReactions() : 0;
+	MemoryStats.PendingReadMarkersCount = ReadMarkerWriter ? ReadMarkerWriter->GetNumPendingReadMarkers() : 0;
+	
+	//Chat objects are owned by users of the SDK, so they are found among all live objects
+	for (TObjectIterator<UPubnubChatUser> It; It; ++It)
+	{
+		if (!IsValid(*It) || It->Chat.Get() != this || !It->IsInitialized)
+		{continue;}
+		
+		MemoryStats.UserObjectsCount++;
+		MemoryStats.ActiveSubscriptionsCount += It->UpdatesSubscription ? 1 : 0;
+	}
+	for (TObjectIterator<UPubnubChatChannel> It; It; ++It)
+	{
+		if (!IsValid(*It) || It->Chat.Get() != this || !It->IsInitialized)
+		{continue;}
+		
+		if (It->IsA<UPubnubChatThreadChannel>())
+		{
+			MemoryStats.ThreadChannelObjectsCount++;
+		}
+		else
+		{
+			MemoryStats.ChannelObjectsCount++;
+		}
+		MemoryStats.ActiveSubscriptionsCount += (It->ConnectSubscription ? 1 : 0) + (It->UpdatesSubscription ? 1 : 0)
+			+ (It->PresenceSubscription ? 1 : 0) + (It->CustomEventsSubscription ? 1 : 0);
+		{
+			FScopeLock Lock(&It->StreamPresenceCriticalSection);
+			MemoryStats.StreamPresenceUserIDsCount += It->StreamPresenceUserIDs.Num();
+		}
+		
+		FScopeLock Lock(&It->TypingIndicatorsCriticalSection);
+		MemoryStats.TypingIndicatorsCount += It->TypingIndicators.Num();
+	}
+	for (TObjectIterator<UPubnubChatMessage> It; It; ++It)
+	{
+		if (!IsValid(*It) || It->Chat.Get() != this || !It->IsInitialized)
+		{continue;}
+		
+		if (It->IsA<UPubnubChatThreadMessage>())
+		{
+			MemoryStats.ThreadMessageObjectsCount++;
+		}
+		else
+		{
+			MemoryStats.MessageObjectsCount++;
+		}
+		MemoryStats.ActiveSubscriptionsCount += It->UpdatesSubscription ? 1 : 0;
+	}
+	for (TObjectIterator<UPubnubChatMembership> It; It; ++It)
+	{
+		if (!IsValid(*It) || It->Chat.Get() != this || !It->IsInitialized)
+		{continue;}
+		
+		MemoryStats.MembershipObjectsCount++;
+		MemoryStats.ActiveSubscriptionsCount += It->UpdatesSubscription ? 1 : 0;
+	}
+	for (TObjectIterator<UPubnubChatMessageDraft> It; It; ++It)
+	{
+		if (!IsValid(*It) || !It->Channel || It->Channel->Chat.Get() != this)
+		{continue;}
+		
+		MemoryStats.MessageDraftObjectsCount++;
+		MemoryStats.SuggestionsCacheEntriesCount += It->SuggestionsCache.Num();
+	}
+	
+	return MemoryStats;
+}
+
+void UPubnubChat::DumpMemoryStats(FOutputDevice& OutputDevice)
+{
+	static const TCHAR* ReferenceCountBucketNames[] = {TEXT("0"), TEXT("1"), TEXT("2-3"), TEXT("4-7"), TEXT("8-15"), TEXT("16+")};
+	static_assert(UE_ARRAY_COUNT(ReferenceCountBucketNames) == Pubnub_Chat_Memory_Stats_Reference_Count_Buckets, "Every reference count bucket needs a name");
+	
+	auto EntryStatsToString = [](const FPubnubChatRepositoryEntryStats& EntryStats)
+	{
+		FString Histogram;
+		for (int i = 0; i < EntryStats.ReferenceCountHistogram.Num() && i < Pubnub_Chat_Memory_Stats_Reference_Count_Buckets; ++i)
+		{
+			Histogram += FString::Printf(TEXT(" %s:%d"), ReferenceCountBucketNames[i], EntryStats.ReferenceCountHistogram[i]);
+		}
+		return FString::Printf(TEXT("%d entries, %.1f KB, entries per live objects count [%s ]"), EntryStats.EntriesCount, EntryStats.ApproximateBytes / 1024.0, *Histogram);
+	};
+	
+	int ChatsCount = 0;
+	for (TObjectIterator<UPubnubChat> It; It; ++It)
+	{
+		if (!IsValid(*It) || !It->IsInitialized)
+		{continue;}
+		
+		ChatsCount++;
+		const FPubnubChatMemoryStats MemoryStats = It->GetMemoryStats();
+		OutputDevice.Logf(TEXT("PubnubChat of user %s:"), *It->CurrentUserID);
+		OutputDevice.Logf(TEXT("  Repository: %.1f KB, of which search index %.1f KB"), MemoryStats.RepositoryBytes / 1024.0, MemoryStats.SearchIndexBytes / 1024.0);
+		OutputDevice.Logf(TEXT("    Users: %s"), *EntryStatsToString(MemoryStats.Users));
+		OutputDevice.Logf(TEXT("    Channels: %s"), *EntryStatsToString(MemoryStats.Channels));
+		OutputDevice.Logf(TEXT("    Messages: %s"), *EntryStatsToString(MemoryStats.Messages));
+		OutputDevice.Logf(TEXT("    Memberships: %s"), *EntryStatsToString(MemoryStats.Memberships));
+		OutputDevice.Logf(TEXT("  Objects: %d users, %d channels, %d thread channels, %d messages, %d thread messages, %d memberships, %d message drafts, %d live messages tracked"),
+			MemoryStats.UserObjectsCount, MemoryStats.ChannelObjectsCount, MemoryStats.ThreadChannelObjectsCount, MemoryStats.MessageObjectsCount,
+			MemoryStats.ThreadMessageObjectsCount, MemoryStats.MembershipObjectsCount, MemoryStats.MessageDraftObjectsCount, MemoryStats.LiveMessageObjectsCount);
+		OutputDevice.Logf(TEXT("  Subscriptions: %d active, %d updates streams"), MemoryStats.ActiveSubscriptionsCount, MemoryStats.UpdatesStreamsCount);
+		OutputDevice.Logf(TEXT("  Caches: %d suggestion queries, %d typing indicators, %d present users"),
+			MemoryStats.SuggestionsCacheEntriesCount, MemoryStats.TypingIndicatorsCount, MemoryStats.StreamPresenceUserIDsCount);
+		OutputDevice.Logf(TEXT("  Pending: %d dispatch events, %d reactions, %d read markers"),
+			MemoryStats.PendingDispatchEventsCount, MemoryStats.PendingReactionsCount, MemoryStats.PendingReadMarkersCount);
+	}
+	
+	if (ChatsCount == 0)
+	{
+		OutputDevice.Log(TEXT("There is no initialized PubnubChat"));
+	}
+}
+
+void UPubnubChat::ReportUserActivity()
+{
+	if (ActivityHeartbeat)
+	{
+		ActivityHeartbeat->ReportActivity();
+	}
 }
 
 FPubnubChatUserResult UPubnubChat::CreateUser(FString UserID, FPubnubChatUserData UserData)
@@ -87,7 +355,7 @@ FPubnubChatUserResult UPubnubChat::CreateUser(FString UserID, FPubnubChatUserDat
 	PUBNUB_CHAT_RETURN_WRAPPER_IF_FIELD_EMPTY(FinalResult, UserID);
 
 	//Check if such user doesn't exist. If it does, just return an error
-	FPubnubUserMetadataResult GetUserResult = PubnubClient->GetUserMetadata(UserID, FPubnubGetMetadataInclude::FromValue(true));
+	FPubnubUserMetadataResult GetUserResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Read, "GetUserMetadata", FinalResult.Result, PubnubClient->GetUserMetadata(UserID, FPubnubGetMetadataInclude::FromValue(true)));
 	if(!GetUserResult.Result.Error)
 	{
 		FString ErrorMessage = FString::Printf(TEXT("[%s]: This user already exists. Try using GetUser instead."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__)));
@@ -97,7 +365,7 @@ FPubnubChatUserResult UPubnubChat::CreateUser(FString UserID, FPubnubChatUserDat
 	}
 
 	//SetUserMetadata by PubnubClient
-	FPubnubUserMetadataResult SetUserResult = PubnubClient->SetUserMetadata(UserID, UserData.ToPubnubUserInputData());
+	FPubnubUserMetadataResult SetUserResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "SetUserMetadata", FinalResult.Result, PubnubClient->SetUserMetadata(UserID, UserData.ToPubnubUserInputData()));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, SetUserResult.Result, "SetUserMetadata");
 	
 	//Create user object and return final result
@@ -105,7 +373,7 @@ FPubnubChatUserResult UPubnubChat::CreateUser(FString UserID, FPubnubChatUserDat
 	return FinalResult;
 }
 
-void UPubnubChat::CreateUserAsync(const FString UserID, FOnPubnubChatUserResponse OnUserResponse, FPubnubChatUserData UserData)
+FPubnubChatAsyncHandle UPubnubChat::CreateUserAsync(const FString UserID, FOnPubnubChatUserResponse OnUserResponse, FPubnubChatUserData UserData, float DeadlineSeconds)
 {
 	FOnPubnubChatUserResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnUserResponse](const FPubnubChatUserResult& UserResult)
@@ -113,25 +381,30 @@ void UPubnubChat::CreateUserAsync(const FString UserID, FOnPubnubChatUserRespons
 		OnUserResponse.ExecuteIfBound(UserResult);
 	});
 
-	CreateUserAsync(UserID, NativeCallback, UserData);
+	return CreateUserAsync(UserID, NativeCallback, UserData, DeadlineSeconds);
 }
 
-void UPubnubChat::CreateUserAsync(const FString UserID, FOnPubnubChatUserResponseNative OnUserResponseNative, FPubnubChatUserData UserData)
+FPubnubChatAsyncHandle UPubnubChat::CreateUserAsync(const FString UserID, FOnPubnubChatUserResponseNative OnUserResponseNative, FPubnubChatUserData UserData, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnUserResponseNative, FPubnubChatUserResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, UserID, OnUserResponseNative, UserData = MoveTemp(UserData)]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, UserID, OnUserResponseNative, UserData = MoveTemp(UserData)]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnUserResponseNative);
 		
 		FPubnubChatUserResult CreateUserResult = WeakThis.Get()->CreateUser(UserID, UserData);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnUserResponseNative, CreateUserResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatUserResult UPubnubChat::GetUser(FString UserID)
@@ -141,7 +414,7 @@ FPubnubChatUserResult UPubnubChat::GetUser(FString UserID)
 	PUBNUB_CHAT_RETURN_WRAPPER_IF_FIELD_EMPTY(FinalResult, UserID);
 
 	//GetUserMetadata from PubnubClient
-	FPubnubUserMetadataResult GetUserResult = PubnubClient->GetUserMetadata(UserID, FPubnubGetMetadataInclude::FromValue(true));
+	FPubnubUserMetadataResult GetUserResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Read, "GetUserMetadata", FinalResult.Result, PubnubClient->GetUserMetadata(UserID, FPubnubGetMetadataInclude::FromValue(true)));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, GetUserResult.Result, "GetUserMetadata");
 
 	//Create user object and return final result
@@ -149,7 +422,7 @@ FPubnubChatUserResult UPubnubChat::GetUser(FString UserID)
 	return FinalResult;
 }
 
-void UPubnubChat::GetUserAsync(const FString UserID, FOnPubnubChatUserResponse OnUserResponse)
+FPubnubChatAsyncHandle UPubnubChat::GetUserAsync(const FString UserID, FOnPubnubChatUserResponse OnUserResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatUserResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnUserResponse](const FPubnubChatUserResult& UserResult)
@@ -157,25 +430,45 @@ void UPubnubChat::GetUserAsync(const FString UserID, FOnPubnubChatUserResponse O
 		OnUserResponse.ExecuteIfBound(UserResult);
 	});
 
-	GetUserAsync(UserID, NativeCallback);
+	return GetUserAsync(UserID, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChat::GetUserAsync(const FString UserID, FOnPubnubChatUserResponseNative OnUserResponseNative)
+FPubnubChatAsyncHandle UPubnubChat::GetUserAsync(const FString UserID, FOnPubnubChatUserResponseNative OnUserResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnUserResponseNative, FPubnubChatUserResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, UserID, OnUserResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, UserID, OnUserResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnUserResponseNative);
 		
 		FPubnubChatUserResult GetUserResult = WeakThis.Get()->GetUser(UserID);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnUserResponseNative, GetUserResult);
 	});
+
+	return AsyncHandle;
+}
+
+FPubnubChatUserResult UPubnubChat::GetCachedUser(const FString UserID)
+{
+	FPubnubChatUserResult FinalResult;
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_NOT_INITIALIZED(FinalResult);
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_FIELD_EMPTY(FinalResult, UserID);
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_CONDITION_FAILED(FinalResult, PersistentStore, TEXT("Persistent store is disabled, enable it in FPubnubChatConfig::PersistentStore"));
+
+	FPubnubChatUserData StoredUserData;
+	if (ObjectsRepository->TryLoadStoredUserData(UserID, StoredUserData))
+	{
+		FinalResult.User = CreateUserObject(UserID, StoredUserData);
+	}
+	return FinalResult;
 }
 
 FPubnubChatGetUsersResult UPubnubChat::GetUsers(const int Limit, const FString Filter, FPubnubGetAllSort Sort, FPubnubPage Page)
@@ -183,7 +476,7 @@ FPubnubChatGetUsersResult UPubnubChat::GetUsers(const int Limit, const FString F
 	FPubnubChatGetUsersResult FinalResult;
 	PUBNUB_CHAT_RETURN_WRAPPER_IF_NOT_INITIALIZED(FinalResult);
 
-	FPubnubGetAllUserMetadataResult GetAllUserResult = PubnubClient->GetAllUserMetadata(FPubnubGetAllInclude::FromValue(true), Limit, Filter, Sort, Page);
+	FPubnubGetAllUserMetadataResult GetAllUserResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Read, "GetAllUserMetadata", FinalResult.Result, PubnubClient->GetAllUserMetadata(FPubnubGetAllInclude::FromValue(true), Limit, Filter, Sort, Page));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, GetAllUserResult.Result, "GetAllUserMetadata");
 
 	for (auto &UserData : GetAllUserResult.UsersData)
@@ -198,7 +491,7 @@ FPubnubChatGetUsersResult UPubnubChat::GetUsers(const int Limit, const FString F
 	return FinalResult;
 }
 
-void UPubnubChat::GetUsersAsync(FOnPubnubChatGetUsersResponse OnUsersResponse, const int Limit, const FString Filter, FPubnubGetAllSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChat::GetUsersAsync(FOnPubnubChatGetUsersResponse OnUsersResponse, const int Limit, const FString Filter, FPubnubGetAllSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	FOnPubnubChatGetUsersResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnUsersResponse](const FPubnubChatGetUsersResult& UsersResult)
@@ -206,25 +499,30 @@ void UPubnubChat::GetUsersAsync(FOnPubnubChatGetUsersResponse OnUsersResponse, c
 		OnUsersResponse.ExecuteIfBound(UsersResult);
 	});
 
-	GetUsersAsync(NativeCallback, Limit, Filter, Sort, Page);
+	return GetUsersAsync(NativeCallback, Limit, Filter, Sort, Page, DeadlineSeconds);
 }
 
-void UPubnubChat::GetUsersAsync(FOnPubnubChatGetUsersResponseNative OnUsersResponseNative, const int Limit, const FString Filter, FPubnubGetAllSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChat::GetUsersAsync(FOnPubnubChatGetUsersResponseNative OnUsersResponseNative, const int Limit, const FString Filter, FPubnubGetAllSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnUsersResponseNative, FPubnubChatGetUsersResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnUsersResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnUsersResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnUsersResponseNative);
 		
 		FPubnubChatGetUsersResult GetUsersResult = WeakThis.Get()->GetUsers(Limit, Filter, Sort, Page);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnUsersResponseNative, GetUsersResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatUserResult UPubnubChat::UpdateUser(const FString UserID, FPubnubChatUpdateUserInputData UpdateUserData)
@@ -238,7 +536,7 @@ FPubnubChatUserResult UPubnubChat::UpdateUser(const FString UserID, FPubnubChatU
 	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, GetUserResult.Result);
 	
 	//SetUserMetadata by PubnubClient
-	FPubnubUserMetadataResult SetUserResult = PubnubClient->SetUserMetadata(UserID, UpdateUserData.ToPubnubUserInputData(), FPubnubGetMetadataInclude::FromValue(true));
+	FPubnubUserMetadataResult SetUserResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "SetUserMetadata", FinalResult.Result, PubnubClient->SetUserMetadata(UserID, UpdateUserData.ToPubnubUserInputData(), FPubnubGetMetadataInclude::FromValue(true)));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, SetUserResult.Result, "SetUserMetadata");
 
 	//Create user object and return final result
@@ -246,7 +544,7 @@ FPubnubChatUserResult UPubnubChat::UpdateUser(const FString UserID, FPubnubChatU
 	return FinalResult;
 }
 
-void UPubnubChat::UpdateUserAsync(const FString UserID, FPubnubChatUpdateUserInputData UpdateUserData, FOnPubnubChatUserResponse OnUserResponse)
+FPubnubChatAsyncHandle UPubnubChat::UpdateUserAsync(const FString UserID, FPubnubChatUpdateUserInputData UpdateUserData, FOnPubnubChatUserResponse OnUserResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatUserResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnUserResponse](const FPubnubChatUserResult& UserResult)
@@ -254,25 +552,30 @@ void UPubnubChat::UpdateUserAsync(const FString UserID, FPubnubChatUpdateUserInp
 		OnUserResponse.ExecuteIfBound(UserResult);
 	});
 
-	UpdateUserAsync(UserID, UpdateUserData, NativeCallback);
+	return UpdateUserAsync(UserID, UpdateUserData, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChat::UpdateUserAsync(const FString UserID, FPubnubChatUpdateUserInputData UpdateUserData, FOnPubnubChatUserResponseNative OnUserResponseNative)
+FPubnubChatAsyncHandle UPubnubChat::UpdateUserAsync(const FString UserID, FPubnubChatUpdateUserInputData UpdateUserData, FOnPubnubChatUserResponseNative OnUserResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnUserResponseNative, FPubnubChatUserResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, UserID, UpdateUserData = MoveTemp(UpdateUserData), OnUserResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, UserID, UpdateUserData = MoveTemp(UpdateUserData), OnUserResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnUserResponseNative);
 		
 		FPubnubChatUserResult UpdateUserResult = WeakThis.Get()->UpdateUser(UserID, UpdateUserData);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnUserResponseNative, UpdateUserResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChat::DeleteUser(const FString UserID)
@@ -283,7 +586,7 @@ FPubnubChatOperationResult UPubnubChat::DeleteUser(const FString UserID)
 	FPubnubChatOperationResult FinalResult;
 
 	//RemoveUserMetadata by PubnubClient
-	FPubnubOperationResult RemoveUserResult = PubnubClient->RemoveUserMetadata(UserID);
+	FPubnubOperationResult RemoveUserResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "RemoveUserMetadata", FinalResult, PubnubClient->RemoveUserMetadata(UserID));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, RemoveUserResult, "RemoveUserMetadata");
 
 	//Remove user from repository
@@ -292,7 +595,7 @@ FPubnubChatOperationResult UPubnubChat::DeleteUser(const FString UserID)
 	return FinalResult;
 }
 
-void UPubnubChat::DeleteUserAsync(const FString UserID, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChat::DeleteUserAsync(const FString UserID, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -300,25 +603,30 @@ void UPubnubChat::DeleteUserAsync(const FString UserID, FOnPubnubChatOperationRe
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	DeleteUserAsync(UserID, NativeCallback);
+	return DeleteUserAsync(UserID, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChat::DeleteUserAsync(const FString UserID, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChat::DeleteUserAsync(const FString UserID, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, UserID, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, UserID, OnOperationResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
 
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
+
 		FPubnubChatOperationResult DeleteUserResult = WeakThis.Get()->DeleteUser(UserID);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, DeleteUserResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatGetUserSuggestionsResult UPubnubChat::GetUserSuggestions(const FString Text, int Limit)
@@ -335,7 +643,7 @@ FPubnubChatGetUserSuggestionsResult UPubnubChat::GetUserSuggestions(const FStrin
 	return FinalResult;
 }
 
-void UPubnubChat::GetUserSuggestionsAsync(const FString Text, FOnPubnubChatGetUserSuggestionsResponse OnSuggestionsResponse, int Limit)
+FPubnubChatAsyncHandle UPubnubChat::GetUserSuggestionsAsync(const FString Text, FOnPubnubChatGetUserSuggestionsResponse OnSuggestionsResponse, int Limit, float DeadlineSeconds)
 {
 	FOnPubnubChatGetUserSuggestionsResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnSuggestionsResponse](const FPubnubChatGetUserSuggestionsResult& SuggestionsResult)
@@ -343,25 +651,30 @@ void UPubnubChat::GetUserSuggestionsAsync(const FString Text, FOnPubnubChatGetUs
 		OnSuggestionsResponse.ExecuteIfBound(SuggestionsResult);
 	});
 
-	GetUserSuggestionsAsync(Text, NativeCallback, Limit);
+	return GetUserSuggestionsAsync(Text, NativeCallback, Limit, DeadlineSeconds);
 }
 
-void UPubnubChat::GetUserSuggestionsAsync(const FString Text, FOnPubnubChatGetUserSuggestionsResponseNative OnSuggestionsResponseNative, int Limit)
+FPubnubChatAsyncHandle UPubnubChat::GetUserSuggestionsAsync(const FString Text, FOnPubnubChatGetUserSuggestionsResponseNative OnSuggestionsResponseNative, int Limit, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnSuggestionsResponseNative, FPubnubChatGetUserSuggestionsResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, Text, Limit, OnSuggestionsResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Text, Limit, OnSuggestionsResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnSuggestionsResponseNative);
 		
 		FPubnubChatGetUserSuggestionsResult GetUserSuggestionsResult = WeakThis.Get()->GetUserSuggestions(Text, Limit);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnSuggestionsResponseNative, GetUserSuggestionsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatChannelResult UPubnubChat::CreatePublicConversation(const FString ChannelID, FPubnubChatChannelData ChannelData)
@@ -375,7 +688,7 @@ FPubnubChatChannelResult UPubnubChat::CreatePublicConversation(const FString Cha
 	ChannelData.Type = "public";
 
 	//SetChannelMetadata by PubnubClient
-	FPubnubChannelMetadataResult SetChannelResult = PubnubClient->SetChannelMetadata(ChannelID, ChannelData.ToPubnubChannelInputData());
+	FPubnubChannelMetadataResult SetChannelResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "SetChannelMetadata", FinalResult.Result, PubnubClient->SetChannelMetadata(ChannelID, ChannelData.ToPubnubChannelInputData()));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, SetChannelResult.Result, "SetChannelMetadata");
 	
 	//Create Channel object and return final result
@@ -383,7 +696,7 @@ FPubnubChatChannelResult UPubnubChat::CreatePublicConversation(const FString Cha
 	return FinalResult;
 }
 
-void UPubnubChat::CreatePublicConversationAsync(const FString ChannelID, FOnPubnubChatChannelResponse OnChannelResponse, FPubnubChatChannelData ChannelData)
+FPubnubChatAsyncHandle UPubnubChat::CreatePublicConversationAsync(const FString ChannelID, FOnPubnubChatChannelResponse OnChannelResponse, FPubnubChatChannelData ChannelData, float DeadlineSeconds)
 {
 	FOnPubnubChatChannelResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnChannelResponse](const FPubnubChatChannelResult& ChannelResult)
@@ -391,25 +704,30 @@ void UPubnubChat::CreatePublicConversationAsync(const FString ChannelID, FOnPubn
 		OnChannelResponse.ExecuteIfBound(ChannelResult);
 	});
 
-	CreatePublicConversationAsync(ChannelID, NativeCallback, ChannelData);
+	return CreatePublicConversationAsync(ChannelID, NativeCallback, ChannelData, DeadlineSeconds);
 }
 
-void UPubnubChat::CreatePublicConversationAsync(const FString ChannelID, FOnPubnubChatChannelResponseNative OnChannelResponseNative, FPubnubChatChannelData ChannelData)
+FPubnubChatAsyncHandle UPubnubChat::CreatePublicConversationAsync(const FString ChannelID, FOnPubnubChatChannelResponseNative OnChannelResponseNative, FPubnubChatChannelData ChannelData, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnChannelResponseNative, FPubnubChatChannelResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, ChannelID, ChannelData = MoveTemp(ChannelData), OnChannelResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, ChannelID, ChannelData = MoveTemp(ChannelData), OnChannelResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnChannelResponseNative);
 		
 		FPubnubChatChannelResult CreatePublicConversationResult = WeakThis.Get()->CreatePublicConversation(ChannelID, ChannelData);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnChannelResponseNative, CreatePublicConversationResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatCreateGroupConversationResult UPubnubChat::CreateGroupConversation(TArray<UPubnubChatUser*> Users, const FString ChannelID, FPubnubChatChannelData ChannelData, FPubnubChatMembershipData HostMembershipData)
@@ -429,26 +747,19 @@ FPubnubChatCreateGroupConversationResult UPubnubChat::CreateGroupConversation(TA
 	ChannelData.Type = "group";
 
 	//SetChannelMetadata by PubnubClient and create Channel
-	FPubnubChannelMetadataResult SetChannelResult = PubnubClient->SetChannelMetadata(FinalChannelID, ChannelData.ToPubnubChannelInputData());
+	FPubnubChannelMetadataResult SetChannelResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "SetChannelMetadata", FinalResult.Result, PubnubClient->SetChannelMetadata(FinalChannelID, ChannelData.ToPubnubChannelInputData()));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, SetChannelResult.Result, "SetChannelMetadata");
 	UPubnubChatChannel* CreatedChannel = CreateChannelObject(FinalChannelID, ChannelData);
 	FinalResult.Channel = CreatedChannel;
 
-	//SetMemberships by PubnubClient and create host Membership
-	FPubnubMembershipsResult SetMembershipsResult = PubnubClient->SetMemberships(CurrentUserID, {HostMembershipData.ToPubnubMembershipInputData(FinalChannelID)}, FPubnubMembershipInclude::FromValue(false), 1);
-	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, SetMembershipsResult.Result, "SetMemberships");
-	UPubnubChatMembership* CreatedHostMembership = CreateMembershipObject(CurrentUser, CreatedChannel, HostMembershipData);
-	FinalResult.HostMembership = CreatedHostMembership;
-	
-	//Invite User to created channel
-	FPubnubChatInviteMultipleResult InviteMultipleResult =  CreatedChannel->InviteMultiple(ValidUsers);
-	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, InviteMultipleResult.Result);
-	FinalResult.InviteesMemberships = InviteMultipleResult.Memberships;
+	//Add host and invite Users with a single members write. Nobody can be a member of a channel with generated ID yet
+	FPubnubChatOperationResult BuildMembershipsResult = BuildConversationMemberships(CreatedChannel, HostMembershipData, ValidUsers, !ChannelID.IsEmpty(), FinalResult.HostMembership, FinalResult.InviteesMemberships);
+	FinalResult.Result.Merge(BuildMembershipsResult);
 	
 	return FinalResult;
 }
 
-void UPubnubChat::CreateGroupConversationAsync(TArray<UPubnubChatUser*> Users, FOnPubnubChatCreateGroupConversationResponse OnGroupConversationResponse, const FString ChannelID, FPubnubChatChannelData ChannelData, FPubnubChatMembershipData HostMembershipData)
+FPubnubChatAsyncHandle UPubnubChat::CreateGroupConversationAsync(TArray<UPubnubChatUser*> Users, FOnPubnubChatCreateGroupConversationResponse OnGroupConversationResponse, const FString ChannelID, FPubnubChatChannelData ChannelData, FPubnubChatMembershipData HostMembershipData, float DeadlineSeconds)
 {
 	FOnPubnubChatCreateGroupConversationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnGroupConversationResponse](const FPubnubChatCreateGroupConversationResult& GroupConversationResult)
@@ -456,25 +767,30 @@ void UPubnubChat::CreateGroupConversationAsync(TArray<UPubnubChatUser*> Users, F
 		OnGroupConversationResponse.ExecuteIfBound(GroupConversationResult);
 	});
 
-	CreateGroupConversationAsync(Users, NativeCallback, ChannelID, ChannelData, HostMembershipData);
+	return CreateGroupConversationAsync(Users, NativeCallback, ChannelID, ChannelData, HostMembershipData, DeadlineSeconds);
 }
 
-void UPubnubChat::CreateGroupConversationAsync(TArray<UPubnubChatUser*> Users, FOnPubnubChatCreateGroupConversationResponseNative OnGroupConversationResponseNative, const FString ChannelID, FPubnubChatChannelData ChannelData, FPubnubChatMembershipData HostMembershipData)
+FPubnubChatAsyncHandle UPubnubChat::CreateGroupConversationAsync(TArray<UPubnubChatUser*> Users, FOnPubnubChatCreateGroupConversationResponseNative OnGroupConversationResponseNative, const FString ChannelID, FPubnubChatChannelData ChannelData, FPubnubChatMembershipData HostMembershipData, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnGroupConversationResponseNative, FPubnubChatCreateGroupConversationResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, Users, ChannelID, ChannelData = MoveTemp(ChannelData), HostMembershipData = MoveTemp(HostMembershipData), OnGroupConversationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Users, ChannelID, ChannelData = MoveTemp(ChannelData), HostMembershipData = MoveTemp(HostMembershipData), OnGroupConversationResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnGroupConversationResponseNative);
 		
 		FPubnubChatCreateGroupConversationResult CreateGroupConversationResult = WeakThis.Get()->CreateGroupConversation(Users, ChannelID, ChannelData, HostMembershipData);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnGroupConversationResponseNative, CreateGroupConversationResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatCreateDirectConversationResult UPubnubChat::CreateDirectConversation(UPubnubChatUser* User, const FString ChannelID, FPubnubChatChannelData ChannelData, FPubnubChatMembershipData HostMembershipData)
@@ -499,26 +815,21 @@ FPubnubChatCreateDirectConversationResult UPubnubChat::CreateDirectConversation(
 	ChannelData.Type = "direct";
 
 	//Set channel metadata by PubnubClient and create the channel
-	FPubnubChannelMetadataResult SetChannelResult = PubnubClient->SetChannelMetadata(FinalChannelID, ChannelData.ToPubnubChannelInputData());
+	FPubnubChannelMetadataResult SetChannelResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "SetChannelMetadata", FinalResult.Result, PubnubClient->SetChannelMetadata(FinalChannelID, ChannelData.ToPubnubChannelInputData()));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, SetChannelResult.Result, "SetChannelMetadata");
 	UPubnubChatChannel* CreatedChannel = CreateChannelObject(FinalChannelID, ChannelData);
 	FinalResult.Channel = CreatedChannel;
 
-	//SetMemberships by PubnubClient and create host membership
-	FPubnubMembershipsResult SetMembershipsResult = PubnubClient->SetMemberships(CurrentUserID, {HostMembershipData.ToPubnubMembershipInputData(FinalChannelID)}, FPubnubMembershipInclude::FromValue(false), 1);
-	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, SetMembershipsResult.Result, "SetMemberships");
-	UPubnubChatMembership* CreatedHostMembership = CreateMembershipObject(CurrentUser, CreatedChannel, HostMembershipData);
-	FinalResult.HostMembership = CreatedHostMembership;
-
-	//Invite User to created channel
-	FPubnubChatInviteResult InviteResult =  CreatedChannel->Invite(User);
-	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, InviteResult.Result);
-	FinalResult.InviteeMembership = InviteResult.Membership;
+	//Add host and invite User with a single members write. Direct channel ID is the same for every call, so the User may already be a member
+	TArray<UPubnubChatMembership*> InviteeMemberships;
+	FPubnubChatOperationResult BuildMembershipsResult = BuildConversationMemberships(CreatedChannel, HostMembershipData, {User}, true, FinalResult.HostMembership, InviteeMemberships);
+	FinalResult.Result.Merge(BuildMembershipsResult);
+	FinalResult.InviteeMembership = InviteeMemberships.IsEmpty() ? nullptr : InviteeMemberships[0];
 	
 	return FinalResult;
 }
 
-void UPubnubChat::CreateDirectConversationAsync(UPubnubChatUser* User, FOnPubnubChatCreateDirectConversationResponse OnDirectConversationResponse, const FString ChannelID, FPubnubChatChannelData ChannelData, FPubnubChatMembershipData HostMembershipData)
+FPubnubChatAsyncHandle UPubnubChat::CreateDirectConversationAsync(UPubnubChatUser* User, FOnPubnubChatCreateDirectConversationResponse OnDirectConversationResponse, const FString ChannelID, FPubnubChatChannelData ChannelData, FPubnubChatMembershipData HostMembershipData, float DeadlineSeconds)
 {
 	FOnPubnubChatCreateDirectConversationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnDirectConversationResponse](const FPubnubChatCreateDirectConversationResult& DirectConversationResult)
@@ -526,25 +837,30 @@ void UPubnubChat::CreateDirectConversationAsync(UPubnubChatUser* User, FOnPubnub
 		OnDirectConversationResponse.ExecuteIfBound(DirectConversationResult);
 	});
 
-	CreateDirectConversationAsync(User, NativeCallback, ChannelID, ChannelData, HostMembershipData);
+	return CreateDirectConversationAsync(User, NativeCallback, ChannelID, ChannelData, HostMembershipData, DeadlineSeconds);
 }
 
-void UPubnubChat::CreateDirectConversationAsync(UPubnubChatUser* User, FOnPubnubChatCreateDirectConversationResponseNative OnDirectConversationResponseNative, const FString ChannelID, FPubnubChatChannelData ChannelData, FPubnubChatMembershipData HostMembershipData)
+FPubnubChatAsyncHandle UPubnubChat::CreateDirectConversationAsync(UPubnubChatUser* User, FOnPubnubChatCreateDirectConversationResponseNative OnDirectConversationResponseNative, const FString ChannelID, FPubnubChatChannelData ChannelData, FPubnubChatMembershipData HostMembershipData, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnDirectConversationResponseNative, FPubnubChatCreateDirectConversationResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, User, ChannelID, ChannelData = MoveTemp(ChannelData), HostMembershipData = MoveTemp(HostMembershipData), OnDirectConversationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, User, ChannelID, ChannelData = MoveTemp(ChannelData), HostMembershipData = MoveTemp(HostMembershipData), OnDirectConversationResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnDirectConversationResponseNative);
 		
 		FPubnubChatCreateDirectConversationResult CreateDirectConversationResult = WeakThis.Get()->CreateDirectConversation(User, ChannelID, ChannelData, HostMembershipData);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnDirectConversationResponseNative, CreateDirectConversationResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatChannelResult UPubnubChat::GetChannel(const FString ChannelID)
@@ -554,7 +870,7 @@ FPubnubChatChannelResult UPubnubChat::GetChannel(const FString ChannelID)
 	PUBNUB_CHAT_RETURN_WRAPPER_IF_FIELD_EMPTY(FinalResult, ChannelID);
 
 	//GetChannelMetadata from PubnubClient
-	FPubnubChannelMetadataResult GetChannelResult = PubnubClient->GetChannelMetadata(ChannelID, FPubnubGetMetadataInclude::FromValue(true));
+	FPubnubChannelMetadataResult GetChannelResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Read, "GetChannelMetadata", FinalResult.Result, PubnubClient->GetChannelMetadata(ChannelID, FPubnubGetMetadataInclude::FromValue(true)));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, GetChannelResult.Result, "GetChannelMetadata");
 
 	//Create channel object and return final result
@@ -562,7 +878,7 @@ FPubnubChatChannelResult UPubnubChat::GetChannel(const FString ChannelID)
 	return FinalResult;
 }
 
-void UPubnubChat::GetChannelAsync(const FString ChannelID, FOnPubnubChatChannelResponse OnChannelResponse)
+FPubnubChatAsyncHandle UPubnubChat::GetChannelAsync(const FString ChannelID, FOnPubnubChatChannelResponse OnChannelResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatChannelResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnChannelResponse](const FPubnubChatChannelResult& ChannelResult)
@@ -570,25 +886,45 @@ void UPubnubChat::GetChannelAsync(const FString ChannelID, FOnPubnubChatChannelR
 		OnChannelResponse.ExecuteIfBound(ChannelResult);
 	});
 
-	GetChannelAsync(ChannelID, NativeCallback);
+	return GetChannelAsync(ChannelID, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChat::GetChannelAsync(const FString ChannelID, FOnPubnubChatChannelResponseNative OnChannelResponseNative)
+FPubnubChatAsyncHandle UPubnubChat::GetChannelAsync(const FString ChannelID, FOnPubnubChatChannelResponseNative OnChannelResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnChannelResponseNative, FPubnubChatChannelResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, ChannelID, OnChannelResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, ChannelID, OnChannelResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnChannelResponseNative);
 		
 		FPubnubChatChannelResult GetChannelResult = WeakThis.Get()->GetChannel(ChannelID);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnChannelResponseNative, GetChannelResult);
 	});
+
+	return AsyncHandle;
+}
+
+FPubnubChatChannelResult UPubnubChat::GetCachedChannel(const FString ChannelID)
+{
+	FPubnubChatChannelResult FinalResult;
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_NOT_INITIALIZED(FinalResult);
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_FIELD_EMPTY(FinalResult, ChannelID);
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_CONDITION_FAILED(FinalResult, PersistentStore, TEXT("Persistent store is disabled, enable it in FPubnubChatConfig::PersistentStore"));
+
+	FPubnubChatChannelData StoredChannelData;
+	if (ObjectsRepository->TryLoadStoredChannelData(ChannelID, StoredChannelData))
+	{
+		FinalResult.Channel = CreateChannelObject(ChannelID, StoredChannelData);
+	}
+	return FinalResult;
 }
 
 FPubnubChatGetChannelsResult UPubnubChat::GetChannels(const int Limit, const FString Filter, FPubnubGetAllSort Sort, FPubnubPage Page)
@@ -596,7 +932,7 @@ FPubnubChatGetChannelsResult UPubnubChat::GetChannels(const int Limit, const FSt
 	FPubnubChatGetChannelsResult FinalResult;
 	PUBNUB_CHAT_RETURN_WRAPPER_IF_NOT_INITIALIZED(FinalResult);
 
-	FPubnubGetAllChannelMetadataResult GetAllChannelResult = PubnubClient->GetAllChannelMetadata(FPubnubGetAllInclude::FromValue(true), Limit, Filter, Sort, Page);
+	FPubnubGetAllChannelMetadataResult GetAllChannelResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Read, "GetAllChannelMetadata", FinalResult.Result, PubnubClient->GetAllChannelMetadata(FPubnubGetAllInclude::FromValue(true), Limit, Filter, Sort, Page));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, GetAllChannelResult.Result, "GetAllChannelMetadata");
 
 	for (auto &ChannelData : GetAllChannelResult.ChannelsData)
@@ -611,7 +947,7 @@ FPubnubChatGetChannelsResult UPubnubChat::GetChannels(const int Limit, const FSt
 	return FinalResult;
 }
 
-void UPubnubChat::GetChannelsAsync(FOnPubnubChatGetChannelsResponse OnChannelsResponse, const int Limit, const FString Filter, FPubnubGetAllSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChat::GetChannelsAsync(FOnPubnubChatGetChannelsResponse OnChannelsResponse, const int Limit, const FString Filter, FPubnubGetAllSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	FOnPubnubChatGetChannelsResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnChannelsResponse](const FPubnubChatGetChannelsResult& ChannelsResult)
@@ -619,25 +955,30 @@ void UPubnubChat::GetChannelsAsync(FOnPubnubChatGetChannelsResponse OnChannelsRe
 		OnChannelsResponse.ExecuteIfBound(ChannelsResult);
 	});
 
-	GetChannelsAsync(NativeCallback, Limit, Filter, Sort, Page);
+	return GetChannelsAsync(NativeCallback, Limit, Filter, Sort, Page, DeadlineSeconds);
 }
 
-void UPubnubChat::GetChannelsAsync(FOnPubnubChatGetChannelsResponseNative OnChannelsResponseNative, const int Limit, const FString Filter, FPubnubGetAllSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChat::GetChannelsAsync(FOnPubnubChatGetChannelsResponseNative OnChannelsResponseNative, const int Limit, const FString Filter, FPubnubGetAllSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnChannelsResponseNative, FPubnubChatGetChannelsResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnChannelsResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnChannelsResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnChannelsResponseNative);
 		
 		FPubnubChatGetChannelsResult GetChannelsResult = WeakThis.Get()->GetChannels(Limit, Filter, Sort, Page);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnChannelsResponseNative, GetChannelsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatChannelResult UPubnubChat::UpdateChannel(const FString ChannelID, FPubnubChatUpdateChannelInputData UpdateChannelData)
@@ -651,7 +992,7 @@ FPubnubChatChannelResult UPubnubChat::UpdateChannel(const FString ChannelID, FPu
 	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, GetChannelResult.Result);
 
 	//SetChannelMetadata by PubnubClient - include all fields in response
-	FPubnubChannelMetadataResult SetChannelResult = PubnubClient->SetChannelMetadata(ChannelID, UpdateChannelData.ToPubnubChannelInputData(), FPubnubGetMetadataInclude::FromValue(true));
+	FPubnubChannelMetadataResult SetChannelResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "SetChannelMetadata", FinalResult.Result, PubnubClient->SetChannelMetadata(ChannelID, UpdateChannelData.ToPubnubChannelInputData(), FPubnubGetMetadataInclude::FromValue(true)));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, SetChannelResult.Result, "SetChannelMetadata");
 
 	//Create channel object and return final result
@@ -659,7 +1000,7 @@ FPubnubChatChannelResult UPubnubChat::UpdateChannel(const FString ChannelID, FPu
 	return FinalResult;
 }
 
-void UPubnubChat::UpdateChannelAsync(const FString ChannelID, FPubnubChatUpdateChannelInputData UpdateChannelData, FOnPubnubChatChannelResponse OnChannelResponse)
+FPubnubChatAsyncHandle UPubnubChat::UpdateChannelAsync(const FString ChannelID, FPubnubChatUpdateChannelInputData UpdateChannelData, FOnPubnubChatChannelResponse OnChannelResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatChannelResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnChannelResponse](const FPubnubChatChannelResult& ChannelResult)
@@ -667,25 +1008,30 @@ void UPubnubChat::UpdateChannelAsync(const FString ChannelID, FPubnubChatUpdateC
 		OnChannelResponse.ExecuteIfBound(ChannelResult);
 	});
 
-	UpdateChannelAsync(ChannelID, UpdateChannelData, NativeCallback);
+	return UpdateChannelAsync(ChannelID, UpdateChannelData, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChat::UpdateChannelAsync(const FString ChannelID, FPubnubChatUpdateChannelInputData UpdateChannelData, FOnPubnubChatChannelResponseNative OnChannelResponseNative)
+FPubnubChatAsyncHandle UPubnubChat::UpdateChannelAsync(const FString ChannelID, FPubnubChatUpdateChannelInputData UpdateChannelData, FOnPubnubChatChannelResponseNative OnChannelResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnChannelResponseNative, FPubnubChatChannelResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, ChannelID, UpdateChannelData = MoveTemp(UpdateChannelData), OnChannelResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, ChannelID, UpdateChannelData = MoveTemp(UpdateChannelData), OnChannelResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnChannelResponseNative);
 		
 		FPubnubChatChannelResult UpdateChannelResult = WeakThis.Get()->UpdateChannel(ChannelID, UpdateChannelData);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnChannelResponseNative, UpdateChannelResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChat::DeleteChannel(const FString ChannelID)
@@ -696,7 +1042,7 @@ FPubnubChatOperationResult UPubnubChat::DeleteChannel(const FString ChannelID)
 	FPubnubChatOperationResult FinalResult;
 
 	//RemoveChannelMetadata by PubnubClient
-	FPubnubOperationResult RemoveChannelResult = PubnubClient->RemoveChannelMetadata(ChannelID);
+	FPubnubOperationResult RemoveChannelResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "RemoveChannelMetadata", FinalResult, PubnubClient->RemoveChannelMetadata(ChannelID));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, RemoveChannelResult, "RemoveChannelMetadata");
 
 	//Remove channel from repository
@@ -705,7 +1051,7 @@ FPubnubChatOperationResult UPubnubChat::DeleteChannel(const FString ChannelID)
 	return FinalResult;
 }
 
-void UPubnubChat::DeleteChannelAsync(const FString ChannelID, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChat::DeleteChannelAsync(const FString ChannelID, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -713,25 +1059,30 @@ void UPubnubChat::DeleteChannelAsync(const FString ChannelID, FOnPubnubChatOpera
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	DeleteChannelAsync(ChannelID, NativeCallback);
+	return DeleteChannelAsync(ChannelID, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChat::DeleteChannelAsync(const FString ChannelID, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChat::DeleteChannelAsync(const FString ChannelID, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, ChannelID, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, ChannelID, OnOperationResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
 
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
+
 		FPubnubChatOperationResult DeleteChannelResult = WeakThis.Get()->DeleteChannel(ChannelID);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, DeleteChannelResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChat::PinMessageToChannel(UPubnubChatMessage* Message, UPubnubChatChannel* Channel)
@@ -743,7 +1094,7 @@ FPubnubChatOperationResult UPubnubChat::PinMessageToChannel(UPubnubChatMessage*
 	return Channel->PinMessage(Message);
 }
 
-void UPubnubChat::PinMessageToChannelAsync(UPubnubChatMessage* Message, UPubnubChatChannel* Channel, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChat::PinMessageToChannelAsync(UPubnubChatMessage* Message, UPubnubChatChannel* Channel, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -751,25 +1102,30 @@ void UPubnubChat::PinMessageToChannelAsync(UPubnubChatMessage* Message, UPubnubC
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	PinMessageToChannelAsync(Message, Channel, NativeCallback);
+	return PinMessageToChannelAsync(Message, Channel, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChat::PinMessageToChannelAsync(UPubnubChatMessage* Message, UPubnubChatChannel* Channel, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChat::PinMessageToChannelAsync(UPubnubChatMessage* Message, UPubnubChatChannel* Channel, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, Message, Channel, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Message, Channel, OnOperationResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult PinMessageResult = WeakThis.Get()->PinMessageToChannel(Message, Channel);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, PinMessageResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChat::UnpinMessageFromChannel(UPubnubChatChannel* Channel)
@@ -779,7 +1135,7 @@ FPubnubChatOperationResult UPubnubChat::UnpinMessageFromChannel(UPubnubChatChann
 	return Channel->UnpinMessage();
 }
 
-void UPubnubChat::UnpinMessageFromChannelAsync(UPubnubChatChannel* Channel, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChat::UnpinMessageFromChannelAsync(UPubnubChatChannel* Channel, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -787,25 +1143,30 @@ void UPubnubChat::UnpinMessageFromChannelAsync(UPubnubChatChannel* Channel, FOnP
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	UnpinMessageFromChannelAsync(Channel, NativeCallback);
+	return UnpinMessageFromChannelAsync(Channel, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChat::UnpinMessageFromChannelAsync(UPubnubChatChannel* Channel, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChat::UnpinMessageFromChannelAsync(UPubnubChatChannel* Channel, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, Channel, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Channel, OnOperationResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult UnpinMessageResult = WeakThis.Get()->UnpinMessageFromChannel(Channel);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, UnpinMessageResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatGetChannelSuggestionsResult UPubnubChat::GetChannelSuggestions(const FString Text, int Limit)
@@ -822,7 +1183,7 @@ FPubnubChatGetChannelSuggestionsResult UPubnubChat::GetChannelSuggestions(const
 	return FinalResult;
 }
 
-void UPubnubChat::GetChannelSuggestionsAsync(const FString Text, FOnPubnubChatGetChannelSuggestionsResponse OnSuggestionsResponse, int Limit)
+FPubnubChatAsyncHandle UPubnubChat::GetChannelSuggestionsAsync(const FString Text, FOnPubnubChatGetChannelSuggestionsResponse OnSuggestionsResponse, int Limit, float DeadlineSeconds)
 {
 	FOnPubnubChatGetChannelSuggestionsResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnSuggestionsResponse](const FPubnubChatGetChannelSuggestionsResult& SuggestionsResult)
@@ -830,25 +1191,30 @@ void UPubnubChat::GetChannelSuggestionsAsync(const FString Text, FOnPubnubChatGe
 		OnSuggestionsResponse.ExecuteIfBound(SuggestionsResult);
 	});
 
-	GetChannelSuggestionsAsync(Text, NativeCallback, Limit);
+	return GetChannelSuggestionsAsync(Text, NativeCallback, Limit, DeadlineSeconds);
 }
 
-void UPubnubChat::GetChannelSuggestionsAsync(const FString Text, FOnPubnubChatGetChannelSuggestionsResponseNative OnSuggestionsResponseNative, int Limit)
+FPubnubChatAsyncHandle UPubnubChat::GetChannelSuggestionsAsync(const FString Text, FOnPubnubChatGetChannelSuggestionsResponseNative OnSuggestionsResponseNative, int Limit, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnSuggestionsResponseNative, FPubnubChatGetChannelSuggestionsResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, Text, Limit, OnSuggestionsResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Text, Limit, OnSuggestionsResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnSuggestionsResponseNative);
 		
 		FPubnubChatGetChannelSuggestionsResult GetChannelSuggestionsResult = WeakThis.Get()->GetChannelSuggestions(Text, Limit);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnSuggestionsResponseNative, GetChannelSuggestionsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatWherePresentResult UPubnubChat::WherePresent(const FString UserID)
@@ -858,14 +1224,14 @@ FPubnubChatWherePresentResult UPubnubChat::WherePresent(const FString UserID)
 	PUBNUB_CHAT_RETURN_WRAPPER_IF_FIELD_EMPTY(FinalResult, UserID);
 	
 	//Use PubnubClient ListUserSubscribedChannels (WhereNow) to get all subscribed channels
-	FPubnubListUsersSubscribedChannelsResult WhereNowResult = PubnubClient->ListUserSubscribedChannels(UserID);
+	FPubnubListUsersSubscribedChannelsResult WhereNowResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Read, "ListUserSubscribedChannels", FinalResult.Result, PubnubClient->ListUserSubscribedChannels(UserID));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, WhereNowResult.Result, "ListUserSubscribedChannels");
 	
 	FinalResult.Channels = WhereNowResult.Channels;
 	return FinalResult;
 }
 
-void UPubnubChat::WherePresentAsync(const FString UserID, FOnPubnubChatWherePresentResponse OnWherePresentResponse)
+FPubnubChatAsyncHandle UPubnubChat::WherePresentAsync(const FString UserID, FOnPubnubChatWherePresentResponse OnWherePresentResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatWherePresentResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnWherePresentResponse](const FPubnubChatWherePresentResult& WherePresentResult)
@@ -873,25 +1239,30 @@ void UPubnubChat::WherePresentAsync(const FString UserID, FOnPubnubChatWherePres
 		OnWherePresentResponse.ExecuteIfBound(WherePresentResult);
 	});
 
-	WherePresentAsync(UserID, NativeCallback);
+	return WherePresentAsync(UserID, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChat::WherePresentAsync(const FString UserID, FOnPubnubChatWherePresentResponseNative OnWherePresentResponseNative)
+FPubnubChatAsyncHandle UPubnubChat::WherePresentAsync(const FString UserID, FOnPubnubChatWherePresentResponseNative OnWherePresentResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnWherePresentResponseNative, FPubnubChatWherePresentResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, UserID, OnWherePresentResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, UserID, OnWherePresentResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnWherePresentResponseNative);
 		
 		FPubnubChatWherePresentResult WherePresentResult = WeakThis.Get()->WherePresent(UserID);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnWherePresentResponseNative, WherePresentResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatWhoIsPresentResult UPubnubChat::WhoIsPresent(const FString ChannelID, int Limit, int Offset)
@@ -905,7 +1276,7 @@ FPubnubChatWhoIsPresentResult UPubnubChat::WhoIsPresent(const FString ChannelID,
 	HereNowSettings.DisableUserID = false;
 	HereNowSettings.Limit = Limit;
 	HereNowSettings.Offset = Offset;
-	FPubnubListUsersFromChannelResult HereNowResult = PubnubClient->ListUsersFromChannel(ChannelID, HereNowSettings);
+	FPubnubListUsersFromChannelResult HereNowResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Read, "ListUsersFromChannel", FinalResult.Result, PubnubClient->ListUsersFromChannel(ChannelID, HereNowSettings));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, HereNowResult.Result, "ListUserSubscribedChannels");
 	
 	//Add all Users into the FinalResult
@@ -914,7 +1285,7 @@ FPubnubChatWhoIsPresentResult UPubnubChat::WhoIsPresent(const FString ChannelID,
 	return FinalResult;
 }
 
-void UPubnubChat::WhoIsPresentAsync(const FString ChannelID, FOnPubnubChatWhoIsPresentResponse OnWhoIsPresentResponse, int Limit, int Offset)
+FPubnubChatAsyncHandle UPubnubChat::WhoIsPresentAsync(const FString ChannelID, FOnPubnubChatWhoIsPresentResponse OnWhoIsPresentResponse, int Limit, int Offset, float DeadlineSeconds)
 {
 	FOnPubnubChatWhoIsPresentResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnWhoIsPresentResponse](const FPubnubChatWhoIsPresentResult& WhoIsPresentResult)
@@ -922,25 +1293,30 @@ void UPubnubChat::WhoIsPresentAsync(const FString ChannelID, FOnPubnubChatWhoIsP
 		OnWhoIsPresentResponse.ExecuteIfBound(WhoIsPresentResult);
 	});
 
-	WhoIsPresentAsync(ChannelID, NativeCallback, Limit, Offset);
+	return WhoIsPresentAsync(ChannelID, NativeCallback, Limit, Offset, DeadlineSeconds);
 }
 
-void UPubnubChat::WhoIsPresentAsync(const FString ChannelID, FOnPubnubChatWhoIsPresentResponseNative OnWhoIsPresentResponseNative, int Limit, int Offset)
+FPubnubChatAsyncHandle UPubnubChat::WhoIsPresentAsync(const FString ChannelID, FOnPubnubChatWhoIsPresentResponseNative OnWhoIsPresentResponseNative, int Limit, int Offset, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnWhoIsPresentResponseNative, FPubnubChatWhoIsPresentResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, ChannelID, Limit, Offset, OnWhoIsPresentResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, ChannelID, Limit, Offset, OnWhoIsPresentResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnWhoIsPresentResponseNative);
 		
 		FPubnubChatWhoIsPresentResult WhoIsPresentResult = WeakThis.Get()->WhoIsPresent(ChannelID, Limit, Offset);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnWhoIsPresentResponseNative, WhoIsPresentResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatIsPresentResult UPubnubChat::IsPresent(const FString UserID, const FString ChannelID)
@@ -959,7 +1335,7 @@ FPubnubChatIsPresentResult UPubnubChat::IsPresent(const FString UserID, const FS
 	return FinalResult;
 }
 
-void UPubnubChat::IsPresentAsync(const FString UserID, const FString ChannelID, FOnPubnubChatIsPresentResponse OnIsPresentResponse)
+FPubnubChatAsyncHandle UPubnubChat::IsPresentAsync(const FString UserID, const FString ChannelID, FOnPubnubChatIsPresentResponse OnIsPresentResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatIsPresentResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnIsPresentResponse](const FPubnubChatIsPresentResult& IsPresentResult)
@@ -967,25 +1343,30 @@ void UPubnubChat::IsPresentAsync(const FString UserID, const FString ChannelID,
 		OnIsPresentResponse.ExecuteIfBound(IsPresentResult);
 	});
 
-	IsPresentAsync(UserID, ChannelID, NativeCallback);
+	return IsPresentAsync(UserID, ChannelID, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChat::IsPresentAsync(const FString UserID, const FString ChannelID, FOnPubnubChatIsPresentResponseNative OnIsPresentResponseNative)
+FPubnubChatAsyncHandle UPubnubChat::IsPresentAsync(const FString UserID, const FString ChannelID, FOnPubnubChatIsPresentResponseNative OnIsPresentResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnIsPresentResponseNative, FPubnubChatIsPresentResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, UserID, ChannelID, OnIsPresentResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, UserID, ChannelID, OnIsPresentResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnIsPresentResponseNative);
 		
 		FPubnubChatIsPresentResult IsPresentResult = WeakThis.Get()->IsPresent(UserID, ChannelID);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnIsPresentResponseNative, IsPresentResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChat::SetRestrictions(FPubnubChatRestriction Restriction)
@@ -998,19 +1379,15 @@ FPubnubChatOperationResult UPubnubChat::SetRestrictions(FPubnubChatRestriction R
 	FString ModerationChannelID = UPubnubChatInternalUtilities::GetRestrictionsChannelForChannelID(Restriction.ChannelID);
 	
 	//Make sure moderation channel exists
-	FPubnubChannelMetadataResult ChannelMetadataResult =  PubnubClient->SetChannelMetadata(ModerationChannelID, FPubnubChannelInputData());
-	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, ChannelMetadataResult.Result, "SetChannelMetadata");
-	
-	FString RestrictionType;
+	FPubnubChatOperationResult EnsureChannelResult = EnsureModerationChannelExists(ModerationChannelID);
+	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, EnsureChannelResult);
 	
 	//Lift restrictions if ban and mute are false
 	if (!Restriction.Ban && !Restriction.Mute)
 	{
 		//Lifting restriction is simply removing this user membership from moderation channel
-		FPubnubChannelMembersResult RemoveChannelMembersResult = PubnubClient->RemoveChannelMembers(ModerationChannelID, {Restriction.UserID}, FPubnubMemberInclude::FromValue(false), 1);
+		FPubnubChannelMembersResult RemoveChannelMembersResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "RemoveChannelMembers", FinalResult, PubnubClient->RemoveChannelMembers(ModerationChannelID, {Restriction.UserID}, FPubnubMemberInclude::FromValue(false), 1));
 		PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, RemoveChannelMembersResult.Result, "RemoveChannelMembers");
-		
-		RestrictionType = "lifted";
 	}
 	else
 	{
@@ -1019,22 +1396,18 @@ FPubnubChatOperationResult UPubnubChat::SetRestrictions(FPubnubChatRestriction R
 		ModerationMemberInputData.User = Restriction.UserID;
 		ModerationMemberInputData.Custom = UPubnubChatInternalUtilities::GetChannelMemberCustomForRestriction(Restriction);
 	
-		FPubnubChannelMembersResult SetChannelMembersResult = PubnubClient->SetChannelMembers(ModerationChannelID, {ModerationMemberInputData}, FPubnubMemberInclude::FromValue(false), 1);
+		FPubnubChannelMembersResult SetChannelMembersResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "SetChannelMembers", FinalResult, PubnubClient->SetChannelMembers(ModerationChannelID, {ModerationMemberInputData}, FPubnubMemberInclude::FromValue(false), 1));
 		PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, SetChannelMembersResult.Result, "SetChannelMembers");
-		
-		RestrictionType = Restriction.Ban? "banned" : "muted";
 	}
 	
-	//Emit moderation event that restriction was lifted
-	FString ModerationEventChannel = UPubnubChatInternalUtilities::GetModerationEventChannelForUserID(Restriction.UserID);
-	FString EventPayload = UPubnubChatInternalUtilities::GetModerationEventPayload(ModerationChannelID, RestrictionType, Restriction.Reason);
-	FPubnubChatOperationResult EmitResult =  EmitChatEvent(EPubnubChatEventType::PCET_Moderation, ModerationEventChannel, EventPayload);
+	//Emit moderation event about changed restriction
+	FPubnubChatOperationResult EmitResult = EmitModerationEvent(Restriction, ModerationChannelID);
 	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, EmitResult);
 	
 	return FinalResult;
 }
 
-void UPubnubChat::SetRestrictionsAsync(FPubnubChatRestriction Restriction, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChat::SetRestrictionsAsync(FPubnubChatRestriction Restriction, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1042,25 +1415,157 @@ void UPubnubChat::SetRestrictionsAsync(FPubnubChatRestriction Restriction, FOnPu
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	SetRestrictionsAsync(Restriction, NativeCallback);
+	return SetRestrictionsAsync(Restriction, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChat::SetRestrictionsAsync(FPubnubChatRestriction Restriction, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChat::SetRestrictionsAsync(FPubnubChatRestriction Restriction, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, Restriction = MoveTemp(Restriction), OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Restriction = MoveTemp(Restriction), OnOperationResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult SetRestrictionsResult = WeakThis.Get()->SetRestrictions(Restriction);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, SetRestrictionsResult);
 	});
+
+	return AsyncHandle;
+}
+
+FPubnubChatOperationResult UPubnubChat::SetRestrictionsBulk(const TArray<FPubnubChatRestriction>& Restrictions)
+{
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
+	for (const FPubnubChatRestriction& Restriction : Restrictions)
+	{
+		PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(!Restriction.UserID.IsEmpty(), TEXT("UserID in all provided Restrictions can't be empty"));
+		PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(!Restriction.ChannelID.IsEmpty(), TEXT("ChannelID in all provided Restrictions can't be empty"));
+	}
+	
+	FPubnubChatOperationResult FinalResult;
+	
+	//Group restrictions by moderation channel. Inner map is keyed by UserID, so the last entry for given user wins
+	TMap<FString, TMap<FString, FPubnubChatRestriction>> RestrictionsByModerationChannel;
+	for (const FPubnubChatRestriction& Restriction : Restrictions)
+	{
+		const FString ModerationChannelID = UPubnubChatInternalUtilities::GetRestrictionsChannelForChannelID(Restriction.ChannelID);
+		RestrictionsByModerationChannel.FindOrAdd(ModerationChannelID).Add(Restriction.UserID, Restriction);
+	}
+	
+	//Pairs of ModerationChannelID and Restriction that were successfully applied and need an event
+	TArray<TPair<FString, FPubnubChatRestriction>> EventsToEmit;
+	
+	for (const TPair<FString, TMap<FString, FPubnubChatRestriction>>& ChannelRestrictions : RestrictionsByModerationChannel)
+	{
+		const FString& ModerationChannelID = ChannelRestrictions.Key;
+		
+		FPubnubChatOperationResult EnsureChannelResult = EnsureModerationChannelExists(ModerationChannelID);
+		FinalResult.Merge(EnsureChannelResult);
+		if (EnsureChannelResult.Error)
+		{break;}
+		
+		TArray<FString> MembersToRemove;
+		TArray<FPubnubChannelMemberInputData> MembersToSet;
+		for (const TPair<FString, FPubnubChatRestriction>& UserRestriction : ChannelRestrictions.Value)
+		{
+			const FPubnubChatRestriction& Restriction = UserRestriction.Value;
+			if (!Restriction.Ban && !Restriction.Mute)
+			{
+				MembersToRemove.Add(Restriction.UserID);
+			}
+			else
+			{
+				FPubnubChannelMemberInputData ModerationMemberInputData;
+				ModerationMemberInputData.User = Restriction.UserID;
+				ModerationMemberInputData.Custom = UPubnubChatInternalUtilities::GetChannelMemberCustomForRestriction(Restriction);
+				MembersToSet.Add(ModerationMemberInputData);
+			}
+		}
+		
+		if (!MembersToRemove.IsEmpty())
+		{
+			FPubnubChannelMembersResult RemoveChannelMembersResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "RemoveChannelMembers", FinalResult, PubnubClient->RemoveChannelMembers(ModerationChannelID, MembersToRemove, FPubnubMemberInclude::FromValue(false), 1));
+			FinalResult.AddStep("RemoveChannelMembers", RemoveChannelMembersResult.Result);
+			if (RemoveChannelMembersResult.Result.Error)
+			{break;}
+		}
+		
+		if (!MembersToSet.IsEmpty())
+		{
+			FPubnubChannelMembersResult SetChannelMembersResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "SetChannelMembers", FinalResult, PubnubClient->SetChannelMembers(ModerationChannelID, MembersToSet, FPubnubMemberInclude::FromValue(false), 1));
+			FinalResult.AddStep("SetChannelMembers", SetChannelMembersResult.Result);
+			if (SetChannelMembersResult.Result.Error)
+			{
+				//Removals for this channel already succeeded, so their events still have to be sent
+				for (const FString& UserID : MembersToRemove)
+				{
+					EventsToEmit.Add(TPair<FString, FPubnubChatRestriction>(ModerationChannelID, ChannelRestrictions.Value[UserID]));
+				}
+				break;
+			}
+		}
+		
+		for (const TPair<FString, FPubnubChatRestriction>& UserRestriction : ChannelRestrictions.Value)
+		{
+			EventsToEmit.Add(TPair<FString, FPubnubChatRestriction>(ModerationChannelID, UserRestriction.Value));
+		}
+	}
+	
+	//Moderation events are independent of each other, emit them concurrently. Results are merged in restrictions order
+	TArray<FPubnubChatOperationResult> EmitResults;
+	EmitResults.SetNum(EventsToEmit.Num());
+	RunConcurrentRequests(EventsToEmit.Num(), [this, &EventsToEmit, &EmitResults](int32 RequestIndex)
+	{
+		EmitResults[RequestIndex] = EmitModerationEvent(EventsToEmit[RequestIndex].Value, EventsToEmit[RequestIndex].Key);
+	});
+	for (const FPubnubChatOperationResult& EmitResult : EmitResults)
+	{
+		FinalResult.Merge(EmitResult);
+	}
+	
+	return FinalResult;
+}
+
+FPubnubChatAsyncHandle UPubnubChat::SetRestrictionsBulkAsync(const TArray<FPubnubChatRestriction>& Restrictions, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
+{
+	FOnPubnubChatOperationResponseNative NativeCallback;
+	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
+	{
+		OnOperationResponse.ExecuteIfBound(OperationResult);
+	});
+
+	return SetRestrictionsBulkAsync(Restrictions, NativeCallback, DeadlineSeconds);
+}
+
+FPubnubChatAsyncHandle UPubnubChat::SetRestrictionsBulkAsync(const TArray<FPubnubChatRestriction>& Restrictions, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
+{
+	PUBNUB_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
+	
+	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
+
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Restrictions, OnOperationResponseNative]
+	{
+		if(!WeakThis.IsValid())
+		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
+		
+		FPubnubChatOperationResult SetRestrictionsResult = WeakThis.Get()->SetRestrictionsBulk(Restrictions);
+
+		//Execute provided delegate with results
+		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, SetRestrictionsResult);
+	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatEventsResult UPubnubChat::GetEventsHistory(const FString ChannelID, const FString StartTimetoken, const FString EndTimetoken, const int Count)
@@ -1076,7 +1581,7 @@ FPubnubChatEventsResult UPubnubChat::GetEventsHistory(const FString ChannelID, c
 	FetchHistorySettings.Start = StartTimetoken;
 	FetchHistorySettings.End = EndTimetoken;
 	FetchHistorySettings.IncludeUserID = true; //Include UserID so events can have their UserID populated
-	FPubnubFetchHistoryResult FetchHistoryResult = PubnubClient->FetchHistory(ChannelID, FetchHistorySettings);
+	FPubnubFetchHistoryResult FetchHistoryResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Read, "FetchHistory", FinalResult.Result, PubnubClient->FetchHistory(ChannelID, FetchHistorySettings));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, FetchHistoryResult.Result, "FetchHistory");
 	
 	for (auto& Message : FetchHistoryResult.Messages)
@@ -1093,7 +1598,7 @@ FPubnubChatEventsResult UPubnubChat::GetEventsHistory(const FString ChannelID, c
 	return FinalResult;
 }
 
-void UPubnubChat::GetEventsHistoryAsync(const FString ChannelID, const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatEventsResponse OnEventsResponse, int Count)
+FPubnubChatAsyncHandle UPubnubChat::GetEventsHistoryAsync(const FString ChannelID, const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatEventsResponse OnEventsResponse, int Count, float DeadlineSeconds)
 {
 	FOnPubnubChatEventsResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnEventsResponse](const FPubnubChatEventsResult& EventsResult)
@@ -1101,25 +1606,30 @@ void UPubnubChat::GetEventsHistoryAsync(const FString ChannelID, const FString S
 		OnEventsResponse.ExecuteIfBound(EventsResult);
 	});
 
-	GetEventsHistoryAsync(ChannelID, StartTimetoken, EndTimetoken, NativeCallback, Count);
+	return GetEventsHistoryAsync(ChannelID, StartTimetoken, EndTimetoken, NativeCallback, Count, DeadlineSeconds);
 }
 
-void UPubnubChat::GetEventsHistoryAsync(const FString ChannelID, const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatEventsResponseNative OnEventsResponseNative, int Count)
+FPubnubChatAsyncHandle UPubnubChat::GetEventsHistoryAsync(const FString ChannelID, const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatEventsResponseNative OnEventsResponseNative, int Count, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnEventsResponseNative, FPubnubChatEventsResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, ChannelID, StartTimetoken, EndTimetoken, Count, OnEventsResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, ChannelID, StartTimetoken, EndTimetoken, Count, OnEventsResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnEventsResponseNative);
 		
 		FPubnubChatEventsResult GetEventsHistoryResult = WeakThis.Get()->GetEventsHistory(ChannelID, StartTimetoken, EndTimetoken, Count);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnEventsResponseNative, GetEventsHistoryResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChat::ForwardMessage(UPubnubChatMessage* Message, UPubnubChatChannel* Channel)
@@ -1135,15 +1645,14 @@ FPubnubChatOperationResult UPubnubChat::ForwardMessage(UPubnubChatMessage* Messa
 	//PublishMessage by PubnubClient
 	FPubnubPublishSettings PublishSettings;
 	PublishSettings.MetaData = UPubnubChatInternalUtilities::GetForwardedMessageMeta(MessageData.Meta, MessageData.UserID, MessageData.ChannelID);
-	FPubnubPublishMessageResult PublishResult =  PubnubClient->PublishMessage(Channel->GetChannelID(), UPubnubChatInternalUtilities::ChatMessageToPublishString(Message->GetCurrentText()), PublishSettings);
-
 	FPubnubChatOperationResult FinalResult;
+	FPubnubPublishMessageResult PublishResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Publish, "PublishMessage", FinalResult, PubnubClient->PublishMessage(Channel->GetChannelID(), UPubnubChatInternalUtilities::ChatMessageToPublishString(Message->GetCurrentText()), PublishSettings));
 	FinalResult.AddStep("PublishMessage", PublishResult.Result);
 	
 	return FinalResult;
 }
 
-void UPubnubChat::ForwardMessageAsync(UPubnubChatMessage* Message, UPubnubChatChannel* Channel, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChat::ForwardMessageAsync(UPubnubChatMessage* Message, UPubnubChatChannel* Channel, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1151,31 +1660,252 @@ void UPubnubChat::ForwardMessageAsync(UPubnubChatMessage* Message, UPubnubChatCh
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	ForwardMessageAsync(Message, Channel, NativeCallback);
+	return ForwardMessageAsync(Message, Channel, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChat::ForwardMessageAsync(UPubnubChatMessage* Message, UPubnubChatChannel* Channel, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChat::ForwardMessageAsync(UPubnubChatMessage* Message, UPubnubChatChannel* Channel, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, Message, Channel, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Message, Channel, OnOperationResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult ForwardMessageResult = WeakThis.Get()->ForwardMessage(Message, Channel);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, ForwardMessageResult);
 	});
+
+	return AsyncHandle;
 }
 
-FPubnubChatGetUnreadMessagesCountsResult UPubnubChat::GetUnreadMessagesCounts(const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page)
+FPubnubChatOperationResult UPubnubChat::DeleteMessages(const TArray<UPubnubChatMessage*>& Messages)
 {
-	FPubnubChatGetUnreadMessagesCountsResult FinalResult;
-	PUBNUB_CHAT_RETURN_WRAPPER_IF_NOT_INITIALIZED(FinalResult);
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
+	
+	FPubnubChatOperationResult FinalResult;
+	
+	//Group timetokens by channel. Timetoken is read once, a local echo confirmed meanwhile keeps the timetoken it was grouped with
+	TMap<FString, TArray<int64>> TimetokensPerChannel;
+	for (UPubnubChatMessage* Message : UPubnubChatInternalUtilities::RemoveInvalidObjects(Messages))
+	{
+		//Delete range is built from the timetoken, without a valid one it would cover the whole channel history
+		const int64 MessageTimetokenValue = Message->GetTimetokenValue();
+		if (Message->IsInitialized && MessageTimetokenValue > 0)
+		{
+			TimetokensPerChannel.FindOrAdd(Message->ChannelID).AddUnique(MessageTimetokenValue);
+		}
+	}
+	
+	struct FChannelDeletion
+	{
+		FString ChannelID;
+		TArray<int64> Timetokens;
+		TArray<int64> DeletedTimetokens;
+		FPubnubChatOperationResult Result;
+	};
+	TArray<FChannelDeletion> ChannelDeletions;
+	for (TPair<FString, TArray<int64>>& ChannelTimetokensPair : TimetokensPerChannel)
+	{
+		FChannelDeletion& ChannelDeletion = ChannelDeletions.AddDefaulted_GetRef();
+		ChannelDeletion.ChannelID = ChannelTimetokensPair.Key;
+		ChannelDeletion.Timetokens = MoveTemp(ChannelTimetokensPair.Value);
+		ChannelDeletion.Timetokens.Sort();
+	}
+	
+	//Channels are independent of each other, their ranges are deleted concurrently. Repository is updated on the calling thread afterwards
+	RunConcurrentRequests(ChannelDeletions.Num(), [this, &ChannelDeletions](int32 RequestIndex)
+	{
+		FChannelDeletion& ChannelDeletion = ChannelDeletions[RequestIndex];
+		const TArray<int64>& Timetokens = ChannelDeletion.Timetokens;
+		
+		//Messages that are kept split delete ranges, so find all messages between the first and the last deleted one
+		TArray<int64> KeptTimetokens;
+		bool bKeptTimetokensKnown = Timetokens.Num() > 1;
+		if (bKeptTimetokensKnown)
+		{
+			FPubnubFetchHistorySettings FetchHistorySettings;
+			FetchHistorySettings.End = UPubnubChatInternalUtilities::Int64ToTimetoken(Timetokens[0]);
+			FetchHistorySettings.MaxPerChannel = Pubnub_Chat_Max_History_Page;
+			FString PageStartTimetoken = UPubnubChatInternalUtilities::Int64ToTimetoken(Timetokens.Last());
+			while (true)
+			{
+				FetchHistorySettings.Start = PageStartTimetoken;
+				FPubnubFetchHistoryResult FetchHistoryResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Read, "FetchHistory", ChannelDeletion.Result, PubnubClient->FetchHistory(ChannelDeletion.ChannelID, FetchHistorySettings));
+				if (FetchHistoryResult.Result.Error)
+				{
+					UE_LOG(PubnubChatLog, Warning, TEXT("Failed to fetch messages between deleted messages of channel %s, only messages with consecutive timetokens will share a delete request."), *ChannelDeletion.ChannelID);
+					bKeptTimetokensKnown = false;
+					break;
+				}
+				
+				int64 OldestTimetoken = MAX_int64;
+				for (const FPubnubHistoryMessageData& HistoryMessage : FetchHistoryResult.Messages)
+				{
+					const int64 HistoryTimetoken = UPubnubChatInternalUtilities::TimetokenToInt64(HistoryMessage.Timetoken);
+					if (Algo::BinarySearch(Timetokens, HistoryTimetoken) == INDEX_NONE)
+					{
+						KeptTimetokens.Add(HistoryTimetoken);
+					}
+					OldestTimetoken = FMath::Min(OldestTimetoken, HistoryTimetoken);
+				}
+				
+				if (FetchHistoryResult.Messages.Num() < FetchHistorySettings.MaxPerChannel || OldestTimetoken <= Timetokens[0])
+				{ break; }
+				
+				PageStartTimetoken = UPubnubChatInternalUtilities::Int64ToTimetoken(OldestTimetoken);
+			}
+			KeptTimetokens.Sort();
+		}
+		
+		//Range ends where a kept message lies before the next deleted one. Without known kept messages any gap could contain one
+		auto IsRangeEnd = [&Timetokens, &KeptTimetokens, bKeptTimetokensKnown](int32 Index)
+		{
+			if (Index == Timetokens.Num() - 1)
+			{ return true; }
+			if (!bKeptTimetokensKnown)
+			{ return Timetokens[Index + 1] > Timetokens[Index] + 1; }
+			const int32 KeptIndex = Algo::LowerBound(KeptTimetokens, Timetokens[Index] + 1);
+			return KeptTimetokens.IsValidIndex(KeptIndex) && KeptTimetokens[KeptIndex] < Timetokens[Index + 1];
+		};
+		
+		int32 RangeStartIndex = 0;
+		for (int32 i = 0; i < Timetokens.Num(); ++i)
+		{
+			if (!IsRangeEnd(i))
+			{ continue; }
+			
+			FPubnubDeleteMessagesSettings DeleteSettings;
+			DeleteSettings.Start = UPubnubChatInternalUtilities::Int64ToTimetoken(Timetokens[i] + 1);
+			DeleteSettings.End = UPubnubChatInternalUtilities::Int64ToTimetoken(Timetokens[RangeStartIndex]);
+			FPubnubOperationResult DeleteResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "DeleteMessages", ChannelDeletion.Result, PubnubClient->DeleteMessages(ChannelDeletion.ChannelID, DeleteSettings));
+			ChannelDeletion.Result.AddStep("DeleteMessages", DeleteResult);
+			if (!DeleteResult.Error)
+			{
+				ChannelDeletion.DeletedTimetokens.Append(&Timetokens[RangeStartIndex], i - RangeStartIndex + 1);
+			}
+			
+			RangeStartIndex = i + 1;
+		}
+	});
+	
+	TArray<FString> ThreadChannelIDs;
+	for (const FChannelDeletion& ChannelDeletion : ChannelDeletions)
+	{
+		FinalResult.Merge(ChannelDeletion.Result);
+		for (const int64 DeletedTimetokenValue : ChannelDeletion.DeletedTimetokens)
+		{
+			const FString DeletedTimetoken = UPubnubChatInternalUtilities::Int64ToTimetoken(DeletedTimetokenValue);
+			const FString DeletedMessageID = FString::Printf(TEXT("%s.%s"), *ChannelDeletion.ChannelID, *DeletedTimetoken);
+			
+			//Thread existence is known from threadRootId action, so there is no need to fetch the thread first
+			FPubnubChatMessageData DeletedMessageData;
+			if (ObjectsRepository->TryGetMessageData(DeletedMessageID, DeletedMessageData)
+				&& UPubnubChatInternalUtilities::HasThreadRootMessageAction(DeletedMessageData.MessageActions))
+			{
+				ThreadChannelIDs.AddUnique(UPubnubChatInternalUtilities::GetThreadID(ChannelDeletion.ChannelID, DeletedTimetoken));
+			}
+			
+			ObjectsRepository->RemoveMessageData(DeletedMessageID);
+		}
+	}
+	
+	if (ThreadChannelIDs.IsEmpty())
+	{ return FinalResult; }
+	
+	//Thread channels are independent of each other, remove them concurrently
+	TArray<FPubnubChatOperationResult> RemoveThreadResults;
+	RemoveThreadResults.SetNum(ThreadChannelIDs.Num());
+	RunConcurrentRequests(ThreadChannelIDs.Num(), [this, &ThreadChannelIDs, &RemoveThreadResults](int32 RequestIndex)
+	{
+		FPubnubChatOperationResult& RemoveThreadResult = RemoveThreadResults[RequestIndex];
+		FPubnubOperationResult RemoveChannelMetadataResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "RemoveChannelMetadata", RemoveThreadResult, PubnubClient->RemoveChannelMetadata(ThreadChannelIDs[RequestIndex]));
+		RemoveThreadResult.AddStep("RemoveChannelMetadata", RemoveChannelMetadataResult);
+	});
+	
+	for (int32 i = 0; i < ThreadChannelIDs.Num(); ++i)
+	{
+		FinalResult.Merge(RemoveThreadResults[i]);
+		if (!RemoveThreadResults[i].Error)
+		{
+			ObjectsRepository->RemoveChannelData(ThreadChannelIDs[i]);
+		}
+	}
+	
+	return FinalResult;
+}
+
+FPubnubChatAsyncHandle UPubnubChat::DeleteMessagesAsync(const TArray<UPubnubChatMessage*>& Messages, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
+{
+	FOnPubnubChatOperationResponseNative NativeCallback;
+	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
+	{
+		OnOperationResponse.ExecuteIfBound(OperationResult);
+	});
+
+	return DeleteMessagesAsync(Messages, NativeCallback, DeadlineSeconds);
+}
+
+FPubnubChatAsyncHandle UPubnubChat::DeleteMessagesAsync(const TArray<UPubnubChatMessage*>& Messages, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
+{
+	PUBNUB_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
+	
+	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
+
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Messages, OnOperationResponseNative]
+	{
+		if(!WeakThis.IsValid())
+		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
+		
+		FPubnubChatOperationResult DeleteMessagesResult = WeakThis.Get()->DeleteMessages(Messages);
+
+		//Execute provided delegate with results
+		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, DeleteMessagesResult);
+	});
+
+	return AsyncHandle;
+}
+
+FPubnubChatSearchMessagesResult UPubnubChat::SearchMessages(const FString Query, const FString ChannelFilter, const int Limit)
+{
+	FPubnubChatSearchMessagesResult FinalResult;
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_NOT_INITIALIZED(FinalResult);
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_FIELD_EMPTY(FinalResult, Query);
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_CONDITION_FAILED(FinalResult, ObjectsRepository->IsSearchIndexEnabled(), TEXT("Search index is disabled, enable it in FPubnubChatConfig::SearchIndex"));
+
+	TArray<FPubnubChatSearchIndexHit> Hits;
+	ObjectsRepository->SearchMessages(Query, ChannelFilter, FMath::Clamp(Limit, 1, Pubnub_Chat_Max_Search_Results), Hits);
+
+	// Messages found in thread channels have to be ThreadMessages
+	for (const FPubnubChatSearchIndexHit& Hit : Hits)
+	{
+		if (UPubnubChatInternalUtilities::IsChannelAThread(Hit.ChannelID))
+		{
+			FinalResult.Messages.Add(GetOrCreateThreadMessageObject(Hit.ChannelID, Hit.Timetoken, Hit.MessageData, UPubnubChatInternalUtilities::GetParentChannelIDFromThreadID(Hit.ChannelID)));
+		}
+		else
+		{
+			FinalResult.Messages.Add(GetOrCreateMessageObject(Hit.ChannelID, Hit.Timetoken, Hit.MessageData));
+		}
+	}
+
+	return FinalResult;
+}
+
+FPubnubChatGetUnreadMessagesCountsResult UPubnubChat::GetUnreadMessagesCounts(const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page)
+{
+	FPubnubChatGetUnreadMessagesCountsResult FinalResult;
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_NOT_INITIALIZED(FinalResult);
 
 	FPubnubChatMembershipsResult GetMembershipsResult = CurrentUser->GetMemberships(Limit, Filter, Sort, Page);
 	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, GetMembershipsResult.Result);
@@ -1200,7 +1930,7 @@ FPubnubChatGetUnreadMessagesCountsResult UPubnubChat::GetUnreadMessagesCounts(co
 	}
 	
 	//Use PubnubClient to get "MessageCounts" - unread messages since provided timetoken
-	FPubnubMessageCountsMultipleResult MessageCountsResult = PubnubClient->MessageCountsMultiple(Channels, Timetokens);
+	FPubnubMessageCountsMultipleResult MessageCountsResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Read, "MessageCountsMultiple", FinalResult.Result, PubnubClient->MessageCountsMultiple(Channels, Timetokens));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, MessageCountsResult.Result, "MessageCountsMultiple");
 	
 	//Find value of Unread Message Counts for each membeship
@@ -1217,7 +1947,7 @@ FPubnubChatGetUnreadMessagesCountsResult UPubnubChat::GetUnreadMessagesCounts(co
 	return FinalResult;
 }
 
-void UPubnubChat::GetUnreadMessagesCountsAsync(FOnPubnubChatGetUnreadMessagesCountsResponse OnUnreadMessagesCountsResponse, const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChat::GetUnreadMessagesCountsAsync(FOnPubnubChatGetUnreadMessagesCountsResponse OnUnreadMessagesCountsResponse, const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	FOnPubnubChatGetUnreadMessagesCountsResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnUnreadMessagesCountsResponse](const FPubnubChatGetUnreadMessagesCountsResult& UnreadMessagesCountsResult)
@@ -1225,25 +1955,30 @@ void UPubnubChat::GetUnreadMessagesCountsAsync(FOnPubnubChatGetUnreadMessagesCou
 		OnUnreadMessagesCountsResponse.ExecuteIfBound(UnreadMessagesCountsResult);
 	});
 
-	GetUnreadMessagesCountsAsync(NativeCallback, Limit, Filter, Sort, Page);
+	return GetUnreadMessagesCountsAsync(NativeCallback, Limit, Filter, Sort, Page, DeadlineSeconds);
 }
 
-void UPubnubChat::GetUnreadMessagesCountsAsync(FOnPubnubChatGetUnreadMessagesCountsResponseNative OnUnreadMessagesCountsResponseNative, const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChat::GetUnreadMessagesCountsAsync(FOnPubnubChatGetUnreadMessagesCountsResponseNative OnUnreadMessagesCountsResponseNative, const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnUnreadMessagesCountsResponseNative, FPubnubChatGetUnreadMessagesCountsResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnUnreadMessagesCountsResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnUnreadMessagesCountsResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnUnreadMessagesCountsResponseNative);
 		
 		FPubnubChatGetUnreadMessagesCountsResult GetUnreadMessagesCountsResult = WeakThis.Get()->GetUnreadMessagesCounts(Limit, Filter, Sort, Page);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnUnreadMessagesCountsResponseNative, GetUnreadMessagesCountsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatMarkAllMessagesAsReadResult UPubnubChat::MarkAllMessagesAsRead(const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page)
@@ -1266,7 +2001,7 @@ FPubnubChatMarkAllMessagesAsReadResult UPubnubChat::MarkAllMessagesAsRead(const
 	}
 	
 	//Use PubnubClient to update all memberships
-	FPubnubMembershipsResult SetMembershipsResult = PubnubClient->SetMemberships(CurrentUserID, SetMembershipsChannels, FPubnubMembershipInclude::FromValue(true), Limit, Filter, Sort, Page);
+	FPubnubMembershipsResult SetMembershipsResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "SetMemberships", FinalResult.Result, PubnubClient->SetMemberships(CurrentUserID, SetMembershipsChannels, FPubnubMembershipInclude::FromValue(true), Limit, Filter, Sort, Page));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, SetMembershipsResult.Result, "SetMembershipsResult");
 	
 	//Create new Membership objects and send Receipt event for every Membership
@@ -1295,7 +2030,7 @@ FPubnubChatMarkAllMessagesAsReadResult UPubnubChat::MarkAllMessagesAsRead(const
 	return FinalResult;
 }
 
-void UPubnubChat::MarkAllMessagesAsReadAsync(FOnPubnubChatMarkAllMessagesAsReadResponse OnMarkAllMessagesAsReadResponse, const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChat::MarkAllMessagesAsReadAsync(FOnPubnubChatMarkAllMessagesAsReadResponse OnMarkAllMessagesAsReadResponse, const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	FOnPubnubChatMarkAllMessagesAsReadResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnMarkAllMessagesAsReadResponse](const FPubnubChatMarkAllMessagesAsReadResult& MarkAllMessagesAsReadResult)
@@ -1303,25 +2038,109 @@ void UPubnubChat::MarkAllMessagesAsReadAsync(FOnPubnubChatMarkAllMessagesAsReadR
 		OnMarkAllMessagesAsReadResponse.ExecuteIfBound(MarkAllMessagesAsReadResult);
 	});
 
-	MarkAllMessagesAsReadAsync(NativeCallback, Limit, Filter, Sort, Page);
+	return MarkAllMessagesAsReadAsync(NativeCallback, Limit, Filter, Sort, Page, DeadlineSeconds);
 }
 
-void UPubnubChat::MarkAllMessagesAsReadAsync(FOnPubnubChatMarkAllMessagesAsReadResponseNative OnMarkAllMessagesAsReadResponseNative, const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChat::MarkAllMessagesAsReadAsync(FOnPubnubChatMarkAllMessagesAsReadResponseNative OnMarkAllMessagesAsReadResponseNative, const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnMarkAllMessagesAsReadResponseNative, FPubnubChatMarkAllMessagesAsReadResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnMarkAllMessagesAsReadResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnMarkAllMessagesAsReadResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnMarkAllMessagesAsReadResponseNative);
 		
 		FPubnubChatMarkAllMessagesAsReadResult MarkAllMessagesAsReadResult = WeakThis.Get()->MarkAllMessagesAsRead(Limit, Filter, Sort, Page);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnMarkAllMessagesAsReadResponseNative, MarkAllMessagesAsReadResult);
 	});
+
+	return AsyncHandle;
+}
+
+FPubnubChatOperationResult UPubnubChat::StartUnreadMessagesTracking(const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page)
+{
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
+	FPubnubChatOperationResult FinalResult;
+	
+	//Messages older than this timetoken are included in the counts returned by the server. It's compared with timetokens of received messages, so it has to come from the server
+	int64 SyncedAtTimetokenValue = 0;
+	FPubnubChatOperationResult TimeResult = FetchServerTimetoken(SyncedAtTimetokenValue);
+	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, TimeResult);
+	const FString SyncedAtTimetoken = UPubnubChatInternalUtilities::Int64ToTimetoken(SyncedAtTimetokenValue);
+	
+	FPubnubChatGetUnreadMessagesCountsResult GetUnreadMessagesCountsResult = GetUnreadMessagesCounts(Limit, Filter, Sort, Page);
+	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, GetUnreadMessagesCountsResult.Result);
+	
+	TArray<FString> TrackedChannelIDs;
+	for (const FPubnubChatUnreadMessagesCountsWrapper& UnreadMessagesCounts : GetUnreadMessagesCountsResult.UnreadMessagesCounts)
+	{
+		if (!UnreadMessagesCounts.Channel || !UnreadMessagesCounts.Membership)
+		{ continue; }
+		
+		const FString ChannelID = UnreadMessagesCounts.Channel->GetChannelID();
+		UnreadTracker->SeedChannel(ChannelID, UnreadMessagesCounts.Membership->GetLastReadMessageTimetoken(), UnreadMessagesCounts.Count, SyncedAtTimetoken);
+		TrackedChannelIDs.Add(ChannelID);
+	}
+	
+	//All tracked channels share one subscription set
+	FPubnubChatOperationResult SubscribeResult = UnreadTracker->SubscribeToChannels(TrackedChannelIDs);
+	FinalResult.Merge(SubscribeResult);
+	
+	return FinalResult;
+}
+
+FPubnubChatAsyncHandle UPubnubChat::StartUnreadMessagesTrackingAsync(FOnPubnubChatOperationResponse OnOperationResponse, const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page, float DeadlineSeconds)
+{
+	FOnPubnubChatOperationResponseNative NativeCallback;
+	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
+	{
+		OnOperationResponse.ExecuteIfBound(OperationResult);
+	});
+
+	return StartUnreadMessagesTrackingAsync(NativeCallback, Limit, Filter, Sort, Page, DeadlineSeconds);
+}
+
+FPubnubChatAsyncHandle UPubnubChat::StartUnreadMessagesTrackingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page, float DeadlineSeconds)
+{
+	PUBNUB_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
+	
+	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
+
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnOperationResponseNative]
+	{
+		if(!WeakThis.IsValid())
+		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
+		
+		FPubnubChatOperationResult StartTrackingResult = WeakThis.Get()->StartUnreadMessagesTracking(Limit, Filter, Sort, Page);
+
+		//Execute provided delegate with results
+		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StartTrackingResult);
+	});
+
+	return AsyncHandle;
+}
+
+void UPubnubChat::StopUnreadMessagesTracking()
+{
+	if (UnreadTracker)
+	{
+		UnreadTracker->StopTracking();
+	}
+}
+
+int UPubnubChat::GetTrackedUnreadMessagesCount(const FString ChannelID) const
+{
+	return UnreadTracker ? UnreadTracker->GetUnreadMessagesCount(ChannelID) : 0;
 }
 
 FPubnubChatThreadChannelResult UPubnubChat::CreateThreadChannel(UPubnubChatMessage* Message)
@@ -1350,7 +2169,7 @@ FPubnubChatThreadChannelResult UPubnubChat::CreateThreadChannel(UPubnubChatMessa
 	return FinalResult;
 }
 
-void UPubnubChat::CreateThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatThreadChannelResponse OnThreadChannelResponse)
+FPubnubChatAsyncHandle UPubnubChat::CreateThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatThreadChannelResponse OnThreadChannelResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatThreadChannelResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnThreadChannelResponse](const FPubnubChatThreadChannelResult& ThreadChannelResult)
@@ -1358,25 +2177,30 @@ void UPubnubChat::CreateThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnu
 		OnThreadChannelResponse.ExecuteIfBound(ThreadChannelResult);
 	});
 
-	CreateThreadChannelAsync(Message, NativeCallback);
+	return CreateThreadChannelAsync(Message, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChat::CreateThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatThreadChannelResponseNative OnThreadChannelResponseNative)
+FPubnubChatAsyncHandle UPubnubChat::CreateThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatThreadChannelResponseNative OnThreadChannelResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnThreadChannelResponseNative, FPubnubChatThreadChannelResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, Message, OnThreadChannelResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Message, OnThreadChannelResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnThreadChannelResponseNative);
 		
 		FPubnubChatThreadChannelResult CreateThreadChannelResult = WeakThis.Get()->CreateThreadChannel(Message);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnThreadChannelResponseNative, CreateThreadChannelResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatThreadChannelResult UPubnubChat::GetThreadChannel(UPubnubChatMessage* Message)
@@ -1389,7 +2213,7 @@ FPubnubChatThreadChannelResult UPubnubChat::GetThreadChannel(UPubnubChatMessage*
 	FString ThreadChannelID = UPubnubChatInternalUtilities::GetThreadID(MessageData.ChannelID, Message->GetMessageTimetoken());
 	
 	//GetChannelMetadata from PubnubClient
-	FPubnubChannelMetadataResult GetChannelResult = PubnubClient->GetChannelMetadata(ThreadChannelID, FPubnubGetMetadataInclude::FromValue(true));
+	FPubnubChannelMetadataResult GetChannelResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Read, "GetChannelMetadata", FinalResult.Result, PubnubClient->GetChannelMetadata(ThreadChannelID, FPubnubGetMetadataInclude::FromValue(true)));
 
 	if (GetChannelResult.Result.Error)
 	{
@@ -1404,7 +2228,7 @@ FPubnubChatThreadChannelResult UPubnubChat::GetThreadChannel(UPubnubChatMessage*
 	return FinalResult;
 }
 
-void UPubnubChat::GetThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatThreadChannelResponse OnThreadChannelResponse)
+FPubnubChatAsyncHandle UPubnubChat::GetThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatThreadChannelResponse OnThreadChannelResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatThreadChannelResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnThreadChannelResponse](const FPubnubChatThreadChannelResult& ThreadChannelResult)
@@ -1412,25 +2236,30 @@ void UPubnubChat::GetThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubCh
 		OnThreadChannelResponse.ExecuteIfBound(ThreadChannelResult);
 	});
 
-	GetThreadChannelAsync(Message, NativeCallback);
+	return GetThreadChannelAsync(Message, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChat::GetThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatThreadChannelResponseNative OnThreadChannelResponseNative)
+FPubnubChatAsyncHandle UPubnubChat::GetThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatThreadChannelResponseNative OnThreadChannelResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnThreadChannelResponseNative, FPubnubChatThreadChannelResult());
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, Message, OnThreadChannelResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Message, OnThreadChannelResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnThreadChannelResponseNative);
 		
 		FPubnubChatThreadChannelResult GetThreadChannelResult = WeakThis.Get()->GetThreadChannel(Message);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnThreadChannelResponseNative, GetThreadChannelResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChat::RemoveThreadChannel(UPubnubChatMessage* Message)
@@ -1449,12 +2278,14 @@ FPubnubChatOperationResult UPubnubChat::RemoveThreadChannel(UPubnubChatMessage*
 	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(!ThreadRootMessageAction.Timetoken.IsEmpty(), TEXT("This Message has invalid ThreadRoot MessageAction - Timetoken is empty"));
 	
 	//Remove ThreadRoot MessageAction using PubnubClient
-	FPubnubOperationResult RemoveActionResult = PubnubClient->RemoveMessageAction(MessageData.ChannelID, Message->GetMessageTimetoken(), ThreadRootMessageAction.Timetoken);
+	FPubnubOperationResult RemoveActionResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "RemoveMessageAction", FinalResult, PubnubClient->RemoveMessageAction(MessageData.ChannelID, Message->GetMessageTimetoken(), ThreadRootMessageAction.Timetoken));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, RemoveActionResult, "RemoveMessageAction");
 	
-	//Update MessageData (remove that action) and update repository
-	UPubnubChatInternalUtilities::RemoveThreadRootFromMessageActions(MessageData.MessageActions);
-	Message->UpdateMessageData(MessageData);
+	//Remove that action from the stored MessageData
+	ObjectsRepository->MutateMessageData(Message->GetInternalMessageID(), [](FPubnubChatMessageData& StoredMessageData)
+	{
+		UPubnubChatInternalUtilities::RemoveThreadRootFromMessageActions(StoredMessageData.MessageActions);
+	});
 	
 	//Delete ThreadChannel
 	FString ThreadChannelID = UPubnubChatInternalUtilities::GetThreadID(MessageData.ChannelID, Message->GetMessageTimetoken());
@@ -1464,7 +2295,7 @@ FPubnubChatOperationResult UPubnubChat::RemoveThreadChannel(UPubnubChatMessage*
 	return FinalResult;
 }
 
-void UPubnubChat::RemoveThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChat::RemoveThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1472,25 +2303,30 @@ void UPubnubChat::RemoveThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnu
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	RemoveThreadChannelAsync(Message, NativeCallback);
+	return RemoveThreadChannelAsync(Message, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChat::RemoveThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChat::RemoveThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, Message, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Message, OnOperationResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult RemoveThreadChannelResult = WeakThis.Get()->RemoveThreadChannel(Message);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, RemoveThreadChannelResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChat::ReconnectSubscriptions(const FString Timetoken)
@@ -1504,7 +2340,7 @@ FPubnubChatOperationResult UPubnubChat::ReconnectSubscriptions(const FString Tim
 	return FinalResult;
 }
 
-void UPubnubChat::ReconnectSubscriptionsAsync(FOnPubnubChatOperationResponse OnOperationResponse, const FString Timetoken)
+FPubnubChatAsyncHandle UPubnubChat::ReconnectSubscriptionsAsync(FOnPubnubChatOperationResponse OnOperationResponse, const FString Timetoken, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1512,25 +2348,30 @@ void UPubnubChat::ReconnectSubscriptionsAsync(FOnPubnubChatOperationResponse OnO
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	ReconnectSubscriptionsAsync(NativeCallback, Timetoken);
+	return ReconnectSubscriptionsAsync(NativeCallback, Timetoken, DeadlineSeconds);
 }
 
-void UPubnubChat::ReconnectSubscriptionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, const FString Timetoken)
+FPubnubChatAsyncHandle UPubnubChat::ReconnectSubscriptionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, const FString Timetoken, float DeadlineSeconds)
 {
 	PUBNUB_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, Timetoken, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, Timetoken, OnOperationResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult ReconnectSubscriptionsResult = WeakThis.Get()->ReconnectSubscriptions(Timetoken);
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, ReconnectSubscriptionsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChat::DisconnectSubscriptions()
@@ -1544,7 +2385,7 @@ FPubnubChatOperationResult UPubnubChat::DisconnectSubscriptions()
 	return FinalResult;
 }
 
-void UPubnubChat::DisconnectSubscriptionsAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChat::DisconnectSubscriptionsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1552,25 +2393,30 @@ void UPubnubChat::DisconnectSubscriptionsAsync(FOnPubnubChatOperationResponse On
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	DisconnectSubscriptionsAsync(NativeCallback);
+	return DisconnectSubscriptionsAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChat::DisconnectSubscriptionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChat::DisconnectSubscriptionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr<UPubnubChat>(this);
 
-	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = CreateAsyncHandle(DeadlineSeconds);
+	AsyncFunctionsThread->AddFunctionToQueue( [WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult DisconnectSubscriptionsResult = WeakThis.Get()->DisconnectSubscriptions();
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, DisconnectSubscriptionsResult);
 	});
+
+	return AsyncHandle;
 }
 
 
@@ -1587,10 +2433,29 @@ void UPubnubChat::OnPubnubSubscriptionStatusChanged(EPubnubSubscriptionStatus St
 	const FPubnubChatConnectionStatusData ChatStatusData = UPubnubChatInternalConverters::SubscriptionStatusDataToChatConnectionStatusData(StatusData);
 	OnConnectionStatusChanged.Broadcast(ChatStatus, ChatStatusData);
 	OnConnectionStatusChangedNative.Broadcast(ChatStatus, ChatStatusData);
+	
+	//Unread counts may miss messages published during a connection gap
+	if (UnreadTracker)
+	{
+		UnreadTracker->HandleConnectionStatusChanged(ChatStatus);
+	}
+	
+	//Messages published during a connection gap were not delivered to connected channels
+	if (ReconnectCatchUp)
+	{
+		ReconnectCatchUp->HandleConnectionStatusChanged(ChatStatus);
+	}
+	
+	//Mutations made while offline are queued in the outbox and sent when the connection is back
+	if (Outbox)
+	{
+		Outbox->HandleConnectionStatusChanged(ChatStatus);
+	}
 }
 
 FPubnubChatInitChatResult UPubnubChat::InitChat(const FString InUserID, const FPubnubChatConfig& InChatConfig, UPubnubClient* InPubnubClient, bool bInOwnsPubnubClient)
 {
+	LLM_SCOPE_BYTAG(PubnubChat);
 	FPubnubChatInitChatResult FinalResult;
 	
 	if(!InPubnubClient)
@@ -1600,14 +2465,70 @@ FPubnubChatInitChatResult UPubnubChat::InitChat(const FString InUserID, const FP
 		FinalResult.Result = FPubnubChatOperationResult::CreateError(ErrorMessage);
 		return FinalResult;
 	}
-
+	
 	ChatConfig = InChatConfig;
 	PubnubClient = InPubnubClient;
 	bOwnsPubnubClient = bInOwnsPubnubClient;
 	CurrentUserID = InUserID;
 	
+	//Create retry policy before any request is made
+	RetryPolicy = MakeShared<FPubnubChatRetryPolicy, ESPMode::ThreadSafe>(ChatConfig.Retry);
+	
+	//Create threads for independent requests of bulk operations - bootstrap already sends its requests with them
+	RequestWorkers = MakeShared<FPubnubChatRequestWorkers, ESPMode::ThreadSafe>(Pubnub_Chat_Max_Concurrent_Requests);
+	
 	//Create repository for managing shared User and Channel data
 	ObjectsRepository = UPubnubInternalUtilities::SafeNewObject<UPubnubChatObjectsRepository>(this);
+	
+	//Open persistent store of this user - repository writes all data updates through to it
+	if (ChatConfig.PersistentStore.Enabled)
+	{
+		PersistentStore = UPubnubInternalUtilities::SafeNewObject<UPubnubChatFilePersistentStore>(this);
+		if (PersistentStore->OpenStore(UPubnubChatPersistentStore::GetStoreDirectory(CurrentUserID), static_cast<int64>(ChatConfig.PersistentStore.MaxSizeMB) * 1024 * 1024))
+		{
+			ObjectsRepository->SetPersistentStore(PersistentStore);
+		}
+		else
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("Failed to open persistent store of user %s, chat data will not be persisted."), *CurrentUserID);
+			PersistentStore = nullptr;
+		}
+	}
+
+	//Index text of messages stored in the repository for local search
+	if (ChatConfig.SearchIndex.Enabled)
+	{
+		ObjectsRepository->EnableSearchIndex(static_cast<int64>(ChatConfig.SearchIndex.MaxMemoryMB) * 1024 * 1024);
+	}
+
+	//Create Unread Tracker - it follows last read message timetoken changes of all memberships stored in the repository
+	UnreadTracker = UPubnubInternalUtilities::SafeNewObject<UPubnubChatUnreadTracker>(this);
+	UnreadTracker->InitUnreadTracker(PubnubClient, this, CurrentUserID);
+	ObjectsRepository->OnMembershipDataUpdatedNative.AddUObject(UnreadTracker.Get(), &UPubnubChatUnreadTracker::HandleMembershipDataUpdated);
+
+	//Create Reconnect Catch Up - it replays messages missed by connected channels after a connection gap
+	ReconnectCatchUp = UPubnubInternalUtilities::SafeNewObject<UPubnubChatReconnectCatchUp>(this);
+	ReconnectCatchUp->InitReconnectCatchUp(PubnubClient, this);
+	ReconnectCatchUp->SetReplayLimits(ChatConfig.ReconnectReplayWindow, ChatConfig.ReconnectReplayMaxMessages);
+	
+	ActivityHeartbeat = UPubnubInternalUtilities::SafeNewObject<UPubnubChatActivityHeartbeat>(this);
+	ActivityHeartbeat->InitActivityHeartbeat(PubnubClient, this, CurrentUserID);
+	ActivityHeartbeat->SetActivityLimits(ChatConfig.StoreUserActivityInterval, ChatConfig.UserActivityIdleTimeout);
+
+	//Create Reaction Coordinator - it applies reaction toggles locally and sends only their net change
+	ReactionCoordinator = UPubnubInternalUtilities::SafeNewObject<UPubnubChatReactionCoordinator>(this);
+	ReactionCoordinator->InitReactionCoordinator(PubnubClient, this, CurrentUserID, ChatConfig.ReactionToggleDebounce);
+
+	//Create Read Marker Writer - it keeps only the highest last read message timetoken of each membership and writes it at most once per interval
+	ReadMarkerWriter = UPubnubInternalUtilities::SafeNewObject<UPubnubChatReadMarkerWriter>(this);
+	ReadMarkerWriter->InitReadMarkerWriter(PubnubClient, this, ChatConfig.ReadMarkerFlushInterval);
+
+	//Create Dispatch Queue - it delivers received events to delegates under a per-frame budget
+	if (ChatConfig.Dispatch.Enabled)
+	{
+		DispatchQueue = UPubnubInternalUtilities::SafeNewObject<UPubnubChatDispatchQueue>(this);
+		DispatchQueue->InitDispatchQueue(ChatConfig.Dispatch.FrameBudgetMs);
+	}
 
 	//Create Access Manager
 	AccessManager = UPubnubInternalUtilities::SafeNewObject<UPubnubChatAccessManager>(this);
@@ -1619,13 +2540,51 @@ FPubnubChatInitChatResult UPubnubChat::InitChat(const FString InUserID, const FP
 		AccessManager->SetAuthToken(InChatConfig.AuthKey);
 	}
 	
+	//Open outbox journal of this user - mutations queued by the previous session are sent once the chat is initialized
+	if (ChatConfig.Outbox.Enabled)
+	{
+		Outbox = UPubnubInternalUtilities::SafeNewObject<UPubnubChatOutbox>(this);
+		Outbox->InitOutbox(PubnubClient, this, ChatConfig.Outbox);
+		if (!Outbox->OpenJournal(UPubnubChatOutbox::GetJournalFilePath(CurrentUserID)))
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("Failed to open outbox journal, mutations made while offline won't be queued."));
+		}
+	}
+	
 	//Add callback for subscription status - it will be translated to chat connection status
 	PubnubClient->OnSubscriptionStatusChanged.AddDynamic(this, &UPubnubChat::OnPubnubSubscriptionStatusChanged);
 
-	//Get or create user for this chat instance
-	FPubnubChatUserResult GetUserForInitResult = GetUserForInit(InUserID);
+	//Get or create user for this chat instance, with bootstrap data if it's enabled
+	FPubnubChatUserResult GetUserForInitResult;
+	bool bWarmStarted = false;
+	if (ChatConfig.Bootstrap.PrefetchOnInit)
+	{
+		Bootstrap = UPubnubInternalUtilities::SafeNewObject<UPubnubChatBootstrap>(this);
+		Bootstrap->InitBootstrap(PubnubClient, this, CurrentUserID, ChatConfig.Bootstrap);
+		
+		//Warm start returns data saved by the previous session, fresh data is fetched when the chat is initialized
+		if (ChatConfig.Bootstrap.WarmStartFromSnapshot)
+		{
+			bWarmStarted = Bootstrap->LoadSnapshot(GetUserForInitResult.User, FinalResult.Bootstrap);
+		}
+		if (!bWarmStarted)
+		{
+			FinalResult.Bootstrap = Bootstrap->FetchBootstrapData(GetUserForInitResult);
+		}
+	}
+	else
+	{
+		GetUserForInitResult = GetUserForInit(InUserID);
+	}
 
-	//Return if any error happened on the way
+	//Return if any error happened on the way. Components created above are released, so no ticker or client callback outlives the failed init.
+	//Owned client is destroyed by the caller of InitChat
+	if (GetUserForInitResult.Result.Error)
+	{
+		ReleaseChatComponents();
+		bOwnsPubnubClient = false;
+		PubnubClient = nullptr;
+	}
 	PUBNUB_CHAT_RETURN_WRAPPER_IF_RESULT_FAILED(FinalResult, GetUserForInitResult);
 
 	FinalResult.Result.Merge(GetUserForInitResult.Result);
@@ -1634,26 +2593,65 @@ FPubnubChatInitChatResult UPubnubChat::InitChat(const FString InUserID, const FP
 	IsInitialized = true;
 	FinalResult.Chat = this;
 
-	// Start storing user activity timestamps if enabled
+	//Create new thread to queue all async chat operations
+	AsyncFunctionsThread = new FPubnubFunctionThread;
+	
+	if (DispatchQueue)
+	{
+		DispatchQueue->Start();
+	}
+	
+	// Start storing user activity timestamps if enabled - writes are queued on the async thread
 	if (ChatConfig.StoreUserActivityTimestamps)
 	{
-		StoreUserActivityTimestamp();
+		ActivityHeartbeat->Start();
 	}
 	
-	//Create new thread to queue all async chat operations
-	AsyncFunctionsThread = new FPubnubFunctionThread;
+	if (bWarmStarted)
+	{
+		Bootstrap->RequestRefresh();
+	}
+	else if (Bootstrap && !FinalResult.Bootstrap.Result.Error)
+	{
+		Bootstrap->SaveSnapshot(CurrentUser, FinalResult.Bootstrap);
+	}
 	
+	if (Outbox && Outbox->GetNumQueuedEntries() > 0)
+	{
+		Outbox->RequestFlush();
+	}
 
 	return FinalResult;
 }
 
+FPubnubChatAsyncHandle UPubnubChat::CreateAsyncHandle(float DeadlineSeconds) const
+{
+	return FPubnubChatAsyncHandle::Create(DeadlineSeconds < 0.0f ? ChatConfig.AsyncOperationDeadline / 1000.0f : DeadlineSeconds);
+}
+
+void UPubnubChat::RunConcurrentRequests(int32 NumRequests, TFunctionRef<void(int32 RequestIndex)> Request)
+{
+	//Keep workers alive in case the chat is destroyed from another thread while requests are running
+	TSharedPtr<FPubnubChatRequestWorkers, ESPMode::ThreadSafe> Workers = RequestWorkers;
+	if (!Workers)
+	{
+		for (int32 RequestIndex = 0; RequestIndex < NumRequests; ++RequestIndex)
+		{
+			Request(RequestIndex);
+		}
+		return;
+	}
+	
+	Workers->RunTasks(NumRequests, Request);
+}
+
 FPubnubChatUserResult UPubnubChat::GetUserForInit(const FString InUserID)
 {
 	FPubnubChatUserResult FinalResult;
 	FPubnubUserData FinalUserData;
 	
 	//Try to get user from the server
-	FPubnubUserMetadataResult GetUserResult = PubnubClient->GetUserMetadata(InUserID, FPubnubGetMetadataInclude::FromValue(true));
+	FPubnubUserMetadataResult GetUserResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Read, "GetUserMetadata", FinalResult.Result, PubnubClient->GetUserMetadata(InUserID, FPubnubGetMetadataInclude::FromValue(true)));
 	if(!GetUserResult.Result.Error)
 	{
 		FinalUserData = GetUserResult.UserData;
@@ -1662,7 +2660,7 @@ FPubnubChatUserResult UPubnubChat::GetUserForInit(const FString InUserID)
 	else
 	{
 		//If user doesn't exist on the server, just create it
-		FPubnubUserMetadataResult SetUserResult = PubnubClient->SetUserMetadata(InUserID, FPubnubUserInputData());
+		FPubnubUserMetadataResult SetUserResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "SetUserMetadata", FinalResult.Result, PubnubClient->SetUserMetadata(InUserID, FPubnubUserInputData()));
 		PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, SetUserResult.Result, "SetUserMetadata");
 		
 		FinalUserData = SetUserResult.UserData;
@@ -1675,6 +2673,7 @@ FPubnubChatUserResult UPubnubChat::GetUserForInit(const FString InUserID)
 
 UPubnubChatUser* UPubnubChat::CreateUserObject(const FString UserID, const FPubnubChatUserData& ChatUserData)
 {
+	LLM_SCOPE_BYTAG(PubnubChat);
 	//Update repository with updated user data
 	ObjectsRepository->UpdateUserData(UserID, ChatUserData);
 
@@ -1686,8 +2685,9 @@ UPubnubChatUser* UPubnubChat::CreateUserObject(const FString UserID, const FPubn
 
 UPubnubChatUser* UPubnubChat::CreateUserObject(const FString UserID, const FPubnubUserData& UserData)
 {
+	LLM_SCOPE_BYTAG(PubnubChat);
 	//Update repository with updated user data
-	ObjectsRepository->UpdateUserData(UserID, FPubnubChatUserData::FromPubnubUserData(UserData));
+	ObjectsRepository->UpdateUserData(UserID, FPubnubChatUserData::FromPubnubUserData(UserData), UserData.Updated);
 
 
 	//Create and return the user object
@@ -1698,6 +2698,7 @@ UPubnubChatUser* UPubnubChat::CreateUserObject(const FString UserID, const FPubn
 
 UPubnubChatChannel* UPubnubChat::CreateChannelObject(const FString ChannelID, const FPubnubChatChannelData& ChatChannelData)
 {
+	LLM_SCOPE_BYTAG(PubnubChat);
 	//Update repository with updated channel data
 	ObjectsRepository->UpdateChannelData(ChannelID, ChatChannelData);
 
@@ -1709,8 +2710,9 @@ UPubnubChatChannel* UPubnubChat::CreateChannelObject(const FString ChannelID, co
 
 UPubnubChatChannel* UPubnubChat::CreateChannelObject(const FString ChannelID, const FPubnubChannelData& ChannelData)
 {
+	LLM_SCOPE_BYTAG(PubnubChat);
 	//Update repository with updated channel data
-	ObjectsRepository->UpdateChannelData(ChannelID, FPubnubChatChannelData::FromPubnubChannelData(ChannelData));
+	ObjectsRepository->UpdateChannelData(ChannelID, FPubnubChatChannelData::FromPubnubChannelData(ChannelData), ChannelData.Updated);
 
 	//Create and return the channel object
 	UPubnubChatChannel* NewChannel = UPubnubInternalUtilities::SafeNewObject<UPubnubChatChannel>(this);
@@ -1720,42 +2722,63 @@ UPubnubChatChannel* UPubnubChat::CreateChannelObject(const FString ChannelID, co
 
 UPubnubChatMessage* UPubnubChat::CreateMessageObject(const FString Timetoken, const FPubnubChatMessageData& ChatMessageData)
 {
-	//Create and init the message object
-	UPubnubChatMessage* NewMessage = UPubnubInternalUtilities::SafeNewObject<UPubnubChatMessage>(this);
-	NewMessage->InitMessage(PubnubClient, this, ChatMessageData.ChannelID, Timetoken);
-	
-	//Update repository with updated message data
-	ObjectsRepository->UpdateMessageData(NewMessage->GetInternalMessageID(), ChatMessageData);
-
-	return NewMessage;
+	return GetOrCreateMessageObject(ChatMessageData.ChannelID, Timetoken, ChatMessageData);
 }
 
 UPubnubChatMessage* UPubnubChat::CreateMessageObject(const FString Timetoken, const FPubnubMessageData& MessageData)
 {
-	//Create and init the message object
-	UPubnubChatMessage* NewMessage = UPubnubInternalUtilities::SafeNewObject<UPubnubChatMessage>(this);
-	NewMessage->InitMessage(PubnubClient, this, MessageData.Channel, Timetoken);
-	
-	//Update repository with updated message data
-	ObjectsRepository->UpdateMessageData(NewMessage->GetInternalMessageID(), FPubnubChatMessageData::FromPubnubMessageData(MessageData));
-
-	return NewMessage;
+	return GetOrCreateMessageObject(MessageData.Channel, Timetoken, FPubnubChatMessageData::FromPubnubMessageData(MessageData));
 }
 
 UPubnubChatMessage* UPubnubChat::CreateMessageObject(const FString Timetoken, const FPubnubHistoryMessageData& HistoryMessageData)
 {
-	//Create and init the message object
-	UPubnubChatMessage* NewMessage = UPubnubInternalUtilities::SafeNewObject<UPubnubChatMessage>(this);
-	NewMessage->InitMessage(PubnubClient, this, HistoryMessageData.Channel, Timetoken);
-	
-	//Update repository with updated message data
-	ObjectsRepository->UpdateMessageData(NewMessage->GetInternalMessageID(), FPubnubChatMessageData::FromPubnubHistoryMessageData(HistoryMessageData));
+	return GetOrCreateMessageObject(HistoryMessageData.Channel, Timetoken, FPubnubChatMessageData::FromPubnubHistoryMessageData(HistoryMessageData));
+}
 
-	return NewMessage;
+TArray<UPubnubChatMessage*> UPubnubChat::CreateMessageObjects(const TArray<FPubnubHistoryMessageData>& HistoryMessagesData)
+{
+	LLM_SCOPE_BYTAG(PubnubChat);
+	TArray<UPubnubChatMessage*> FinalMessages;
+	TArray<FString> MessageIDs;
+	TArray<FPubnubChatMessageData> MessagesData;
+	TArray<FString> MessageIDsToRegister;
+	FinalMessages.Reserve(HistoryMessagesData.Num());
+	MessageIDs.Reserve(HistoryMessagesData.Num());
+	MessagesData.Reserve(HistoryMessagesData.Num());
+	
+	for (const FPubnubHistoryMessageData& HistoryMessageData : HistoryMessagesData)
+	{
+		MessageIDs.Add(FString::Printf(TEXT("%s.%s"), *HistoryMessageData.Channel, *HistoryMessageData.Timetoken));
+		MessagesData.Add(FPubnubChatMessageData::FromPubnubHistoryMessageData(HistoryMessageData));
+	}
+	
+	TArray<bool> WasCreated;
+	const TArray<UPubnubChatMessage*> Messages = GetOrCreateLiveMessageObjects(MessageIDs, UPubnubChatMessage::StaticClass(), [this, &HistoryMessagesData](int32 Index)
+	{
+		//Repository registration is done below for the whole page at once
+		UPubnubChatMessage* Message = UPubnubInternalUtilities::SafeNewObject<UPubnubChatMessage>(this);
+		Message->InitMessage(PubnubClient, this, HistoryMessagesData[Index].Channel, HistoryMessagesData[Index].Timetoken, false);
+		return Message;
+	}, WasCreated);
+	
+	for (int32 i = 0; i < Messages.Num(); ++i)
+	{
+		FinalMessages.Add(Messages[i]);
+		if (WasCreated[i])
+		{
+			MessageIDsToRegister.Add(MessageIDs[i]);
+		}
+	}
+	
+	//Update repository with the whole page under a single lock
+	ObjectsRepository->RegisterAndUpdateMessages(MessageIDs, MessagesData, MessageIDsToRegister);
+	
+	return FinalMessages;
 }
 
 UPubnubChatMembership* UPubnubChat::CreateMembershipObject(UPubnubChatUser* User, UPubnubChatChannel* Channel, const FPubnubChatMembershipData& ChatMembershipData)
 {
+	LLM_SCOPE_BYTAG(PubnubChat);
 	//Create and init the membership object
 	UPubnubChatMembership* NewMembership = UPubnubInternalUtilities::SafeNewObject<UPubnubChatMembership>(this);
 	NewMembership->InitMembership(PubnubClient, this, User, Channel);
@@ -1768,30 +2791,33 @@ UPubnubChatMembership* UPubnubChat::CreateMembershipObject(UPubnubChatUser* User
 
 UPubnubChatMembership* UPubnubChat::CreateMembershipObject(UPubnubChatUser* User, UPubnubChatChannel* Channel, const FPubnubMembershipData& MembershipData)
 {
+	LLM_SCOPE_BYTAG(PubnubChat);
 	//Create and init the membership object
 	UPubnubChatMembership* NewMembership = UPubnubInternalUtilities::SafeNewObject<UPubnubChatMembership>(this);
 	NewMembership->InitMembership(PubnubClient, this, User, Channel);
 	
 	//Update repository with updated membership data
-	ObjectsRepository->UpdateMembershipData(NewMembership->GetInternalMembershipID(), FPubnubChatMembershipData::FromPubnubMembershipData(MembershipData));
+	ObjectsRepository->UpdateMembershipData(NewMembership->GetInternalMembershipID(), FPubnubChatMembershipData::FromPubnubMembershipData(MembershipData), MembershipData.Updated);
 
 	return NewMembership;
 }
 
 UPubnubChatMembership* UPubnubChat::CreateMembershipObject(UPubnubChatUser* User, UPubnubChatChannel* Channel, const FPubnubChannelMemberData& ChannelMemberData)
 {
+	LLM_SCOPE_BYTAG(PubnubChat);
 	//Create and init the membership object
 	UPubnubChatMembership* NewMembership = UPubnubInternalUtilities::SafeNewObject<UPubnubChatMembership>(this);
 	NewMembership->InitMembership(PubnubClient, this, User, Channel);
 	
 	//Update repository with updated membership data
-	ObjectsRepository->UpdateMembershipData(NewMembership->GetInternalMembershipID(), FPubnubChatMembershipData::FromPubnubChannelMemberData(ChannelMemberData));
+	ObjectsRepository->UpdateMembershipData(NewMembership->GetInternalMembershipID(), FPubnubChatMembershipData::FromPubnubChannelMemberData(ChannelMemberData), ChannelMemberData.Updated);
 
 	return NewMembership;
 }
 
 UPubnubChatThreadChannel* UPubnubChat::CreateThreadChannelObject(const FString ThreadChannelID, const FPubnubChatChannelData& ThreadChannelData, UPubnubChatMessage* Message, bool IsThreadAlreadyConfirmed)
 {
+	LLM_SCOPE_BYTAG(PubnubChat);
 	//Update repository with updated thread channel data (for ObjectsRepository we treat ThreadChannels as regular Channels)
 	ObjectsRepository->UpdateChannelData(ThreadChannelID, ThreadChannelData);
 
@@ -1804,8 +2830,9 @@ UPubnubChatThreadChannel* UPubnubChat::CreateThreadChannelObject(const FString T
 
 UPubnubChatThreadChannel* UPubnubChat::CreateThreadChannelObject(const FString ThreadChannelID, const FPubnubChannelData& ChannelData, UPubnubChatMessage* Message, bool IsThreadAlreadyConfirmed)
 {
+	LLM_SCOPE_BYTAG(PubnubChat);
 	//Update repository with updated thread channel data (for ObjectsRepository we treat ThreadChannels as regular Channels)
-	ObjectsRepository->UpdateChannelData(ThreadChannelID, FPubnubChatChannelData::FromPubnubChannelData(ChannelData));
+	ObjectsRepository->UpdateChannelData(ThreadChannelID, FPubnubChatChannelData::FromPubnubChannelData(ChannelData), ChannelData.Updated);
 
 	//Create and return the thread channel object
 	UPubnubChatThreadChannel* NewThreadChannel = UPubnubInternalUtilities::SafeNewObject<UPubnubChatThreadChannel>(this);
@@ -1816,165 +2843,273 @@ UPubnubChatThreadChannel* UPubnubChat::CreateThreadChannelObject(const FString T
 
 UPubnubChatThreadMessage* UPubnubChat::CreateThreadMessageObject(const FString Timetoken, const FPubnubChatMessageData& ChatMessageData, const FString ParentChannelID)
 {
-	//Create and init the message object (for ObjectsRepository we treat ThreadMessages as regular Messages)
-	UPubnubChatThreadMessage* NewThreadMessage = UPubnubInternalUtilities::SafeNewObject<UPubnubChatThreadMessage>(this);
-	NewThreadMessage->InitThreadMessage(PubnubClient, this, ChatMessageData.ChannelID, Timetoken, ParentChannelID);
-	
-	//Update repository with updated message data
-	ObjectsRepository->UpdateMessageData(NewThreadMessage->GetInternalMessageID(), ChatMessageData);
-
-	return NewThreadMessage;
+	return GetOrCreateThreadMessageObject(ChatMessageData.ChannelID, Timetoken, ChatMessageData, ParentChannelID);
 }
 
 UPubnubChatThreadMessage* UPubnubChat::CreateThreadMessageObject(const FString Timetoken, const FPubnubMessageData& MessageData, const FString ParentChannelID)
 {
-	//Create and init the message object (for ObjectsRepository we treat ThreadMessages as regular Messages)
-	UPubnubChatThreadMessage* NewThreadMessage = UPubnubInternalUtilities::SafeNewObject<UPubnubChatThreadMessage>(this);
-	NewThreadMessage->InitThreadMessage(PubnubClient, this, MessageData.Channel, Timetoken, ParentChannelID);
-	
-	//Update repository with updated message data
-	ObjectsRepository->UpdateMessageData(NewThreadMessage->GetInternalMessageID(), FPubnubChatMessageData::FromPubnubMessageData(MessageData));
-
-	return NewThreadMessage;
+	return GetOrCreateThreadMessageObject(MessageData.Channel, Timetoken, FPubnubChatMessageData::FromPubnubMessageData(MessageData), ParentChannelID);
 }
 
 UPubnubChatThreadMessage* UPubnubChat::CreateThreadMessageObject(const FString Timetoken, const FPubnubHistoryMessageData& HistoryMessageData, const FString ParentChannelID)
 {
-	//Create and init the message object (for ObjectsRepository we treat ThreadMessages as regular Messages)
-	UPubnubChatThreadMessage* NewThreadMessage = UPubnubInternalUtilities::SafeNewObject<UPubnubChatThreadMessage>(this);
-	NewThreadMessage->InitThreadMessage(PubnubClient, this, HistoryMessageData.Channel, Timetoken, ParentChannelID);
-	
-	//Update repository with updated message data
-	ObjectsRepository->UpdateMessageData(NewThreadMessage->GetInternalMessageID(), FPubnubChatMessageData::FromPubnubHistoryMessageData(HistoryMessageData));
-
-	return NewThreadMessage;
+	return GetOrCreateThreadMessageObject(HistoryMessageData.Channel, Timetoken, FPubnubChatMessageData::FromPubnubHistoryMessageData(HistoryMessageData), ParentChannelID);
 }
 
-void UPubnubChat::StoreUserActivityTimestamp()
+TArray<UPubnubChatThreadMessage*> UPubnubChat::CreateThreadMessageObjects(const TArray<FPubnubHistoryMessageData>& HistoryMessagesData, const FString ParentChannelID)
 {
-	if (!IsInitialized || !CurrentUser)
-	{ return; }
-
-	// Clear any existing timers
-	UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(this);
-	if (!GameInstance)
-	{ return; }
+	LLM_SCOPE_BYTAG(PubnubChat);
+	TArray<UPubnubChatThreadMessage*> FinalThreadMessages;
+	TArray<FString> MessageIDs;
+	TArray<FPubnubChatMessageData> MessagesData;
+	TArray<FString> MessageIDsToRegister;
+	FinalThreadMessages.Reserve(HistoryMessagesData.Num());
+	MessageIDs.Reserve(HistoryMessagesData.Num());
+	MessagesData.Reserve(HistoryMessagesData.Num());
+	
+	//For ObjectsRepository and live message objects we treat ThreadMessages as regular Messages
+	for (const FPubnubHistoryMessageData& HistoryMessageData : HistoryMessagesData)
+	{
+		MessageIDs.Add(FString::Printf(TEXT("%s.%s"), *HistoryMessageData.Channel, *HistoryMessageData.Timetoken));
+		MessagesData.Add(FPubnubChatMessageData::FromPubnubHistoryMessageData(HistoryMessageData));
+	}
+	
+	TArray<bool> WasCreated;
+	const TArray<UPubnubChatMessage*> Messages = GetOrCreateLiveMessageObjects(MessageIDs, UPubnubChatThreadMessage::StaticClass(), [this, &HistoryMessagesData, &ParentChannelID](int32 Index)
+	{
+		//Repository registration is done below for the whole page at once
+		UPubnubChatThreadMessage* ThreadMessage = UPubnubInternalUtilities::SafeNewObject<UPubnubChatThreadMessage>(this);
+		ThreadMessage->InitThreadMessage(PubnubClient, this, HistoryMessagesData[Index].Channel, HistoryMessagesData[Index].Timetoken, ParentChannelID, false);
+		return ThreadMessage;
+	}, WasCreated);
+	
+	for (int32 i = 0; i < Messages.Num(); ++i)
+	{
+		FinalThreadMessages.Add(CastChecked<UPubnubChatThreadMessage>(Messages[i]));
+		if (WasCreated[i])
+		{
+			MessageIDsToRegister.Add(MessageIDs[i]);
+		}
+	}
+	
+	//Update repository with the whole page under a single lock
+	ObjectsRepository->RegisterAndUpdateMessages(MessageIDs, MessagesData, MessageIDsToRegister);
+	
+	return FinalThreadMessages;
+}
 
-	FTimerManager& TimerManager = GameInstance->GetTimerManager();
-	TimerManager.ClearTimer(LastSavedActivityIntervalTimerHandle);
-	TimerManager.ClearTimer(RunWithDelayTimerHandle);
+UPubnubChatMessage* UPubnubChat::FindLiveMessageObject(const FString& MessageID, const UClass* MessageClass)
+{
+	UPubnubChatMessage** LiveMessagePtr = LiveMessageObjects.Find(MessageID);
+	if (!LiveMessagePtr)
+	{ return nullptr; }
+	
+	UPubnubChatMessage* LiveMessage = *LiveMessagePtr;
+	
+	//Object found unreachable by the last GC is destroyed soon, it can't be handed out anymore.
+	//Only share initialized objects of exactly the same class that belong to this chat
+	if (!IsValid(LiveMessage) || LiveMessage->IsUnreachable() || !LiveMessage->IsInitialized || LiveMessage->Chat != this || LiveMessage->GetClass() != MessageClass)
+	{ return nullptr; }
+	
+	MessageObjectsReusedCount++;
+	INC_DWORD_STAT(STAT_PubnubChatMessagesReused);
+	return LiveMessage;
+}
 
-	// Get current user data
-	FPubnubChatUserData UserData = CurrentUser->GetUserData();
-	FString LastActiveTimestamp = UPubnubChatInternalUtilities::GetLastActiveTimestampFromCustom(UserData.Custom);
+void UPubnubChat::AddLiveMessageObject(UPubnubChatMessage* Message)
+{
+	LiveMessageObjects.Add(Message->GetInternalMessageID(), Message);
+	MessageObjectsCreatedCount++;
+	INC_DWORD_STAT(STAT_PubnubChatMessagesCreated);
+	SET_DWORD_STAT(STAT_PubnubChatLiveMessages, LiveMessageObjects.Num());
+}
 
-	if (LastActiveTimestamp.IsEmpty())
+void UPubnubChat::ReleaseLiveMessageObject(UPubnubChatMessage* Message)
+{
+	FScopeLock Lock(&LiveMessageObjectsCriticalSection);
+	
+	//Entry may already belong to a newer object of the same message, created while this one was waiting for destruction
+	const FString MessageID = Message->GetInternalMessageID();
+	UPubnubChatMessage** LiveMessagePtr = LiveMessageObjects.Find(MessageID);
+	if (LiveMessagePtr && *LiveMessagePtr == Message)
 	{
-		// No timestamp exists, start the interval immediately
-		RunSaveTimestampInterval();
-		return;
+		LiveMessageObjects.Remove(MessageID);
+		SET_DWORD_STAT(STAT_PubnubChatLiveMessages, LiveMessageObjects.Num());
 	}
+}
 
-	// Calculate elapsed time since last check
-	if (!LastActiveTimestamp.IsNumeric())
+TArray<UPubnubChatMessage*> UPubnubChat::FindLiveMessageObjects(const TArray<FString>& MessageIDs)
+{
+	TArray<UPubnubChatMessage*> Messages;
+	Messages.SetNumZeroed(MessageIDs.Num());
+	
+	//Off the game thread GC can't run reachability analysis while objects are resolved
+	TOptional<FGCScopeGuard> GCGuard;
+	if (!IsInGameThread())
 	{
-		// Invalid timestamp format, start interval immediately
-		RunSaveTimestampInterval();
-		return;
+		GCGuard.Emplace();
 	}
-
-	int64 LastTimestampValue = 0;
-	LexFromString(LastTimestampValue, *LastActiveTimestamp);
-
-	// Get current timetoken (17-digit format in 100ns units)
-	FString CurrentTimetokenString = UPubnubTimetokenUtilities::GetCurrentUnixTimetoken();
-	int64 CurrentTimetoken = 0;
-	if (!CurrentTimetokenString.IsNumeric())
+	
+	FScopeLock Lock(&LiveMessageObjectsCriticalSection);
+	for (int32 i = 0; i < MessageIDs.Num(); ++i)
 	{
-		// Fallback to immediate save if timetoken generation fails
-		RunSaveTimestampInterval();
-		return;
+		UPubnubChatMessage** LiveMessagePtr = LiveMessageObjects.Find(MessageIDs[i]);
+		UPubnubChatMessage* LiveMessage = LiveMessagePtr ? *LiveMessagePtr : nullptr;
+		if (IsValid(LiveMessage) && !LiveMessage->IsUnreachable() && LiveMessage->IsInitialized && LiveMessage->Chat == this)
+		{
+			Messages[i] = LiveMessage;
+		}
 	}
-	LexFromString(CurrentTimetoken, *CurrentTimetokenString);
-
-	// Calculate elapsed time in timetoken units (100ns), then convert to milliseconds
-	// 1 millisecond = 10,000 timetoken units (100ns units)
-	int64 ElapsedTimeTimetokenUnits = CurrentTimetoken - LastTimestampValue;
-	int64 ElapsedTimeMs = ElapsedTimeTimetokenUnits / 10000LL;
+	
+	return Messages;
+}
 
-	if (ElapsedTimeMs >= ChatConfig.StoreUserActivityInterval)
+TArray<UPubnubChatMessage*> UPubnubChat::GetOrCreateLiveMessageObjects(const TArray<FString>& MessageIDs, const UClass* MessageClass, TFunctionRef<UPubnubChatMessage*(int32 Index)> CreateMessage, TArray<bool>& OutCreated)
+{
+	TArray<UPubnubChatMessage*> Messages;
+	Messages.SetNumZeroed(MessageIDs.Num());
+	OutCreated.Init(false, MessageIDs.Num());
+	
+	//Off the game thread GC can't run reachability analysis while objects are resolved and created
+	TOptional<FGCScopeGuard> GCGuard;
+	if (!IsInGameThread())
 	{
-		// Enough time has passed, start interval immediately
-		RunSaveTimestampInterval();
-		return;
+		GCGuard.Emplace();
 	}
-
-	// Schedule timer for remaining time
-	int64 RemainingTimeMs = ChatConfig.StoreUserActivityInterval - ElapsedTimeMs;
-	float RemainingTimeSeconds = RemainingTimeMs / 1000.0f;
-
-	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr(this);
-	FTimerDelegate TimerDelegate;
-	TimerDelegate.BindLambda([WeakThis]()
+	
+	FScopeLock Lock(&LiveMessageObjectsCriticalSection);
+	for (int32 i = 0; i < MessageIDs.Num(); ++i)
 	{
-		if (WeakThis.IsValid())
+		Messages[i] = FindLiveMessageObject(MessageIDs[i], MessageClass);
+		if (!Messages[i])
 		{
-			WeakThis->RunSaveTimestampInterval();
+			Messages[i] = CreateMessage(i);
+			AddLiveMessageObject(Messages[i]);
+			OutCreated[i] = true;
 		}
-	});
-
-	TimerManager.SetTimer(RunWithDelayTimerHandle, TimerDelegate, RemainingTimeSeconds, false);
+	}
+	
+	return Messages;
 }
 
-void UPubnubChat::SaveTimestamp()
+UPubnubChatMessage* UPubnubChat::GetOrCreateMessageObject(const FString& ChannelID, const FString& Timetoken, const FPubnubChatMessageData& ChatMessageData)
 {
-	if (!IsInitialized || !CurrentUser)
-	{ return; }
-
-	// Get current timetoken in 17-digit format (100ns units) - standard PubNub format
-	FString TimestampString = UPubnubTimetokenUtilities::GetCurrentUnixTimetoken();
-
-	// Get current user data
-	FPubnubChatUserData UserData = CurrentUser->GetUserData();
+	LLM_SCOPE_BYTAG(PubnubChat);
+	TArray<bool> WasCreated;
+	UPubnubChatMessage* NewMessage = GetOrCreateLiveMessageObjects({FString::Printf(TEXT("%s.%s"), *ChannelID, *Timetoken)}, UPubnubChatMessage::StaticClass(), [this, &ChannelID, &Timetoken](int32)
+	{
+		//Create and init the message object
+		UPubnubChatMessage* Message = UPubnubInternalUtilities::SafeNewObject<UPubnubChatMessage>(this);
+		Message->InitMessage(PubnubClient, this, ChannelID, Timetoken);
+		return Message;
+	}, WasCreated)[0];
+	
+	//Update repository with updated message data
+	ObjectsRepository->UpdateMessageData(NewMessage->GetInternalMessageID(), ChatMessageData);
 
-	// Add timestamp to custom data
-	FString UpdatedCustom = UPubnubChatInternalUtilities::AddLastActiveTimestampToCustom(UserData.Custom, TimestampString);
+	return NewMessage;
+}
 
-	// Update user with new custom data
-	FPubnubChatUpdateUserInputData UpdateUserData;
-	UpdateUserData.Custom = UpdatedCustom;
-	UpdateUserData.ForceSetCustom = true;
+UPubnubChatThreadMessage* UPubnubChat::GetOrCreateThreadMessageObject(const FString& ChannelID, const FString& Timetoken, const FPubnubChatMessageData& ChatMessageData, const FString& ParentChannelID)
+{
+	LLM_SCOPE_BYTAG(PubnubChat);
+	TArray<bool> WasCreated;
+	UPubnubChatThreadMessage* NewThreadMessage = CastChecked<UPubnubChatThreadMessage>(GetOrCreateLiveMessageObjects({FString::Printf(TEXT("%s.%s"), *ChannelID, *Timetoken)}, UPubnubChatThreadMessage::StaticClass(), [this, &ChannelID, &Timetoken, &ParentChannelID](int32)
+	{
+		//Create and init the message object (for ObjectsRepository we treat ThreadMessages as regular Messages)
+		UPubnubChatThreadMessage* ThreadMessage = UPubnubInternalUtilities::SafeNewObject<UPubnubChatThreadMessage>(this);
+		ThreadMessage->InitThreadMessage(PubnubClient, this, ChannelID, Timetoken, ParentChannelID);
+		return ThreadMessage;
+	}, WasCreated)[0]);
+	
+	//Update repository with updated message data
+	ObjectsRepository->UpdateMessageData(NewThreadMessage->GetInternalMessageID(), ChatMessageData);
 
-	// Update user asynchronously (don't wait for result)
-	CurrentUser->Update(UpdateUserData);
+	return NewThreadMessage;
 }
 
-void UPubnubChat::RunSaveTimestampInterval()
+void UPubnubChat::RekeyMessageObject(UPubnubChatMessage* Message, const FString& NewTimetoken)
 {
-	// Save timestamp immediately
-	SaveTimestamp();
-
-	// Schedule periodic timer
-	UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(this);
-	if (!GameInstance)
+	if (!Message || NewTimetoken.IsEmpty() || Message->GetMessageTimetoken() == NewTimetoken)
 	{ return; }
+	
+	const FString OldMessageID = Message->GetInternalMessageID();
+	const FString NewMessageID = FString::Printf(TEXT("%s.%s"), *Message->ChannelID, *NewTimetoken);
+	FPubnubChatMessageData MessageData = Message->GetMessageData();
+	
+	//Identity is swapped under the message lock, async operations of this message read it through the locked getters
+	{
+		FScopeLock Lock(&LiveMessageObjectsCriticalSection);
+		LiveMessageObjects.Remove(OldMessageID);
+		Message->SetTimetoken(NewTimetoken);
+		LiveMessageObjects.Add(NewMessageID, Message);
+	}
+	
+	//Data is moved under the new ID before the provisional entry is released, so readers never miss it
+	ObjectsRepository->RegisterMessage(NewMessageID);
+	ObjectsRepository->UpdateMessageData(NewMessageID, MessageData);
+	ObjectsRepository->UnregisterMessage(OldMessageID);
+	ObjectsRepository->RemoveMessageData(OldMessageID);
+}
 
-	FTimerManager& TimerManager = GameInstance->GetTimerManager();
-	float IntervalSeconds = ChatConfig.StoreUserActivityInterval / 1000.0f;
+void UPubnubChat::DispatchEvent(UObject* Listener, TFunction<void()> Function, const FString& CoalesceKey, bool bDroppable)
+{
+	if (DispatchQueue)
+	{
+		DispatchQueue->Enqueue(Listener, MoveTemp(Function), CoalesceKey, bDroppable);
+		return;
+	}
+	
+	Function();
+}
 
-	TWeakObjectPtr<UPubnubChat> WeakThis = MakeWeakObjectPtr(this);
-	FTimerDelegate TimerDelegate;
-	TimerDelegate.BindLambda([WeakThis]()
+FPubnubChatOperationResult UPubnubChat::EnsureModerationChannelExists(const FString& ModerationChannelID)
+{
+	FPubnubChatOperationResult FinalResult;
+	
 	{
-		if (WeakThis.IsValid())
+		FScopeLock Lock(&CreatedModerationChannelsCriticalSection);
+		if (CreatedModerationChannels.Contains(ModerationChannelID))
 		{
-			WeakThis->SaveTimestamp();
+			return FinalResult;
 		}
-	});
+	}
+	
+	FPubnubChannelMetadataResult ChannelMetadataResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "SetChannelMetadata", FinalResult, PubnubClient->SetChannelMetadata(ModerationChannelID, FPubnubChannelInputData()));
+	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, ChannelMetadataResult.Result, "SetChannelMetadata");
+	
+	FScopeLock Lock(&CreatedModerationChannelsCriticalSection);
+	CreatedModerationChannels.Add(ModerationChannelID);
+	
+	return FinalResult;
+}
 
-	TimerManager.SetTimer(LastSavedActivityIntervalTimerHandle, TimerDelegate, IntervalSeconds, true);
+FPubnubChatOperationResult UPubnubChat::FetchServerTimetoken(int64& OutTimetoken)
+{
+	FPubnubChatOperationResult FinalResult;
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
+	
+	FPubnubTimeResult TimeResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Read, "Time", FinalResult, PubnubClient->Time());
+	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, TimeResult.Result, "Time");
+	
+	OutTimetoken = UPubnubChatInternalUtilities::TimetokenToInt64(TimeResult.Timetoken);
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(OutTimetoken > 0, TEXT("Server returned invalid Timetoken"));
+	
+	return FinalResult;
 }
 
+FPubnubChatOperationResult UPubnubChat::EmitModerationEvent(const FPubnubChatRestriction& Restriction, const FString& ModerationChannelID)
+{
+	FString RestrictionType = "lifted";
+	if (Restriction.Ban || Restriction.Mute)
+	{
+		RestrictionType = Restriction.Ban? "banned" : "muted";
+	}
+	
+	FString ModerationEventChannel = UPubnubChatInternalUtilities::GetModerationEventChannelForUserID(Restriction.UserID);
+	FString EventPayload = UPubnubChatInternalUtilities::GetModerationEventPayload(ModerationChannelID, RestrictionType, Restriction.Reason);
+	return EmitChatEvent(EPubnubChatEventType::PCET_Moderation, ModerationEventChannel, EventPayload);
+}
 
 FPubnubChatOperationResult UPubnubChat::EmitChatEvent(EPubnubChatEventType EventType, const FString ChannelID, const FString Payload, EPubnubChatEventMethod EventMethod)
 {
@@ -1997,18 +3132,141 @@ FPubnubChatOperationResult UPubnubChat::EmitChatEvent(EPubnubChatEventType Event
 	//Use Publish or Signal for sending event depending on specified method
 	if(EventMethod == EPubnubChatEventMethod::PCEM_Publish)
 	{
-		FPubnubPublishMessageResult PublishResult =  PubnubClient->PublishMessage(ChannelID, UPubnubJsonUtilities::JsonObjectToString(JsonObject));
+		FPubnubPublishMessageResult PublishResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Publish, "PublishMessage", FinalResult, PubnubClient->PublishMessage(ChannelID, UPubnubJsonUtilities::JsonObjectToString(JsonObject)));
 		FinalResult.AddStep("PublishMessage", PublishResult.Result);
 	}
 	else
 	{
-		FPubnubSignalResult SignalResult =  PubnubClient->Signal(ChannelID, UPubnubJsonUtilities::JsonObjectToString(JsonObject));
+		FPubnubSignalResult SignalResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Publish, "Signal", FinalResult, PubnubClient->Signal(ChannelID, UPubnubJsonUtilities::JsonObjectToString(JsonObject)));
 		FinalResult.AddStep("Signal", SignalResult.Result);
 	}
 
 	return FinalResult;
 }
 
+FPubnubChatOperationResult UPubnubChat::BuildConversationMemberships(UPubnubChatChannel* Channel, const FPubnubChatMembershipData& HostMembershipData, const TArray<UPubnubChatUser*>& Invitees, bool bCheckExistingMembers, UPubnubChatMembership*& OutHostMembership, TArray<UPubnubChatMembership*>& OutInviteeMemberships)
+{
+	FPubnubChatOperationResult FinalResult;
+	const FString ChannelID = Channel->GetChannelID();
+
+	//Host is added as a member, not invited, and every other user is invited only once
+	TArray<UPubnubChatUser*> UniqueInvitees;
+	TSet<FString> InviteeIDs;
+	for (UPubnubChatUser* User : Invitees)
+	{
+		if (User && User->GetUserID() != CurrentUserID && !InviteeIDs.Contains(User->GetUserID()))
+		{
+			InviteeIDs.Add(User->GetUserID());
+			UniqueInvitees.Add(User);
+		}
+	}
+
+	//Find invitees that are already members - they were written by a previous attempt or have already joined
+	TMap<FString, FPubnubChannelMemberData> ExistingMembers;
+	if (bCheckExistingMembers)
+	{
+		FPubnubMemberInclude Include;
+		Include.IncludeCustom = true;
+		Include.IncludeStatus = true;
+		Include.IncludeType = true;
+		for (int32 ChunkStart = 0; ChunkStart < UniqueInvitees.Num(); ChunkStart += Pubnub_Chat_Max_Channel_Members_Per_Request)
+		{
+			TArray<UPubnubChatUser*> ChunkUsers(UniqueInvitees.GetData() + ChunkStart, FMath::Min(Pubnub_Chat_Max_Channel_Members_Per_Request, UniqueInvitees.Num() - ChunkStart));
+			FPubnubChannelMembersResult GetMembersResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Read, "GetChannelMembers", FinalResult, PubnubClient->GetChannelMembers(ChannelID, Include, Pubnub_Chat_Max_Channel_Members_Per_Request, UPubnubChatInternalUtilities::GetFilterForMultipleUsersID(ChunkUsers)));
+			PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, GetMembersResult.Result, "GetChannelMembers");
+			for (const FPubnubChannelMemberData& MemberData : GetMembersResult.MembersData)
+			{
+				ExistingMembers.Add(MemberData.User.UserID, MemberData);
+			}
+		}
+	}
+
+	//Invitees get "pending" status and last read message timetoken in the same write, so no separate update per user is needed
+	FPubnubChatMembershipData InviteeMembershipData;
+	InviteeMembershipData.Status = Pubnub_Chat_Invited_User_Membership_status;
+	UPubnubChatInternalUtilities::AddLastReadMessageTimetokenToMembershipData(InviteeMembershipData, UPubnubTimetokenUtilities::GetCurrentUnixTimetoken());
+
+	//Existing members are not written again, but the ones that didn't accept the invite yet are notified again
+	TArray<FPubnubChannelMemberInputData> MembersInput;
+	MembersInput.Add(HostMembershipData.ToPubnubChannelMemberInputData(CurrentUserID));
+	TArray<FString> UserIDsToNotify;
+	for (UPubnubChatUser* User : UniqueInvitees)
+	{
+		const FPubnubChannelMemberData* ExistingMember = ExistingMembers.Find(User->GetUserID());
+		if (!ExistingMember)
+		{
+			MembersInput.Add(InviteeMembershipData.ToPubnubChannelMemberInputData(User->GetUserID()));
+			UserIDsToNotify.Add(User->GetUserID());
+		}
+		else if (ExistingMember->Status == Pubnub_Chat_Invited_User_Membership_status)
+		{
+			UserIDsToNotify.Add(User->GetUserID());
+		}
+	}
+
+	for (int32 ChunkStart = 0; ChunkStart < MembersInput.Num(); ChunkStart += Pubnub_Chat_Max_Channel_Members_Per_Request)
+	{
+		TArray<FPubnubChannelMemberInputData> ChunkInput(MembersInput.GetData() + ChunkStart, FMath::Min(Pubnub_Chat_Max_Channel_Members_Per_Request, MembersInput.Num() - ChunkStart));
+		FPubnubChannelMembersResult SetMembersResult = PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy.Get(), PCROT_Write, "SetChannelMembers", FinalResult, PubnubClient->SetChannelMembers(ChannelID, ChunkInput, FPubnubMemberInclude::FromValue(false), 1));
+		PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, SetMembersResult.Result, "SetChannelMembers");
+	}
+
+	OutHostMembership = CreateMembershipObject(CurrentUser, Channel, HostMembershipData);
+	for (UPubnubChatUser* User : UniqueInvitees)
+	{
+		const FPubnubChannelMemberData* ExistingMember = ExistingMembers.Find(User->GetUserID());
+		OutInviteeMemberships.Add(ExistingMember ? CreateMembershipObject(User, Channel, *ExistingMember) : CreateMembershipObject(User, Channel, InviteeMembershipData));
+	}
+
+	//Invite events are independent of each other, emit them concurrently. Results are merged in invitees order
+	const FString InvitePayload = UPubnubChatInternalUtilities::GetInviteEventPayload(ChannelID, Channel->GetChannelData().Type);
+	TArray<FPubnubChatOperationResult> InviteResults;
+	InviteResults.SetNum(UserIDsToNotify.Num());
+	RunConcurrentRequests(UserIDsToNotify.Num(), [this, &UserIDsToNotify, &InvitePayload, &InviteResults](int32 RequestIndex)
+	{
+		InviteResults[RequestIndex] = EmitChatEvent(EPubnubChatEventType::PCET_Invite, UserIDsToNotify[RequestIndex], InvitePayload);
+	});
+	for (const FPubnubChatOperationResult& InviteResult : InviteResults)
+	{
+		FinalResult.Merge(InviteResult);
+	}
+
+	return FinalResult;
+}
+
+UPubnubChatUpdatesStream* UPubnubChat::CreateUpdatesStream()
+{
+	UPubnubChatUpdatesStream* UpdatesStream = UPubnubInternalUtilities::SafeNewObject<UPubnubChatUpdatesStream>(this);
+	if (UpdatesStream)
+	{
+		FScopeLock Lock(&UpdatesStreamsCriticalSection);
+		UpdatesStreams.Add(UpdatesStream);
+	}
+	return UpdatesStream;
+}
+
+FPubnubChatOperationResult UPubnubChat::RemoveFromUpdatesStreams(UObject* Object)
+{
+	FPubnubChatOperationResult FinalResult;
+	
+	TArray<TObjectPtr<UPubnubChatUpdatesStream>> Streams;
+	{
+		FScopeLock Lock(&UpdatesStreamsCriticalSection);
+		Streams = UpdatesStreams;
+	}
+	
+	//Stop removes the stream from UpdatesStreams, so it's called outside of the lock
+	for (UPubnubChatUpdatesStream* UpdatesStream : Streams)
+	{
+		if (UpdatesStream && UpdatesStream->RemoveObject(Object))
+		{
+			FinalResult.Merge(UpdatesStream->Stop());
+		}
+	}
+	
+	return FinalResult;
+}
+
 FPubnubChatListenForEventsResult UPubnubChat::ListenForEvents(const FString ChannelID, EPubnubChatEventType EventType, FOnPubnubChatEventReceivedNative EventCallbackNative)
 {
 	FPubnubChatListenForEventsResult FinalResult;
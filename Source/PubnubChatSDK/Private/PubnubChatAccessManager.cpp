@@ -7,6 +7,7 @@
 #include "PubnubClient.h"
 #include "FunctionLibraries/PubnubJsonUtilities.h"
 #include "FunctionLibraries/PubnubChatInternalConverters.h"
+#include "FunctionLibraries/PubnubChatJsonReader.h"
 #include "FunctionLibraries/PubnubChatInternalUtilities.h"
 #include "FunctionLibraries/PubnubChatLogUtilities.h"
 
@@ -25,9 +26,26 @@ bool UPubnubChatAccessManager::CanI(EPubnubChatAccessManagerPermission Permissio
 	//Parse Current Auth Token into string
 	FString ParsedToken = ParseToken(CurrentAuthToken);
 
-	//Check if parsed token has required fields
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-	if(!UPubnubJsonUtilities::StringToJsonObject(ParsedToken, JsonObject))
+	//Check if parsed token has required fields. Both are kept as views of the token text, so only Patterns are parsed when needed
+	FStringView ResourcesJson;
+	FStringView PatternsJson;
+	bool HasResources = false;
+	bool HasPatterns = false;
+	FPubnubChatJsonReader Reader(ParsedToken);
+	if(!Reader.ReadObjectStart())
+	{return true;}
+
+	while(Reader.ReadNextKey())
+	{
+		if(Reader.ValueEquals(ANSI_TO_TCHAR("Resources")))
+		{HasResources = Reader.TryReadObject(ResourcesJson);}
+		else if(Reader.ValueEquals(ANSI_TO_TCHAR("Patterns")))
+		{HasPatterns = Reader.TryReadObject(PatternsJson);}
+		else
+		{Reader.SkipNextValue();}
+	}
+
+	if(Reader.HasError())
 	{return true;}
 
 	//Convert enums to strings
@@ -39,14 +57,6 @@ bool UPubnubChatAccessManager::CanI(EPubnubChatAccessManagerPermission Permissio
 		return false;
 	}
 
-	//Get Resources object (optional - may not exist)
-	const TSharedPtr<FJsonObject>* ResourcesObjectPtr = nullptr;
-	bool HasResources = JsonObject->TryGetObjectField(ANSI_TO_TCHAR("Resources"), ResourcesObjectPtr) && ResourcesObjectPtr && (*ResourcesObjectPtr).IsValid();
-
-	//Get Patterns object (optional - may not exist)
-	const TSharedPtr<FJsonObject>* PatternsObjectPtr = nullptr;
-	bool HasPatterns = JsonObject->TryGetObjectField(ANSI_TO_TCHAR("Patterns"), PatternsObjectPtr) && PatternsObjectPtr && (*PatternsObjectPtr).IsValid();
-
 	//If both Resources and Patterns are missing/invalid
 	if(!HasResources && !HasPatterns)
 	{
@@ -56,8 +66,7 @@ bool UPubnubChatAccessManager::CanI(EPubnubChatAccessManagerPermission Permissio
 	//First, check Resources for exact match (if it exists)
 	if(HasResources)
 	{
-		const TSharedPtr<FJsonObject>& ResourcesObject = *ResourcesObjectPtr;
-		bool HasPermission = UPubnubChatInternalUtilities::CheckResourcePermission(ResourcesObject, ResourceTypeStr, ResourceName, PermissionStr);
+		bool HasPermission = UPubnubChatInternalUtilities::CheckResourcePermission(ResourcesJson, ResourceTypeStr, ResourceName, PermissionStr);
 		if(HasPermission)
 		{
 			return HasPermission;
@@ -67,7 +76,11 @@ bool UPubnubChatAccessManager::CanI(EPubnubChatAccessManagerPermission Permissio
 	//If not found in Resources (or Resources doesn't exist), check Patterns for regex match (if it exists)
 	if(HasPatterns)
 	{
-		const TSharedPtr<FJsonObject>& PatternsObject = *PatternsObjectPtr;
+		//Patterns are matched with regex against every key, so they are parsed into an object
+		TSharedPtr<FJsonObject> PatternsObject = MakeShareable(new FJsonObject);
+		if(!UPubnubJsonUtilities::StringToJsonObject(FString(PatternsJson), PatternsObject))
+		{return false;}
+
 		bool HasPermission = UPubnubChatInternalUtilities::CheckPatternPermission(PatternsObject, ResourceTypeStr, ResourceName, PermissionStr);
 		return HasPermission;
 	}
@@ -0,0 +1,219 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatActivityHeartbeat.h"
+#include "PubnubClient.h"
+#include "PubnubChat.h"
+#include "PubnubChatConst.h"
+#include "PubnubChatInternalMacros.h"
+#include "PubnubChatObjectsRepository.h"
+#include "PubnubChatSubsystem.h"
+#include "FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "FunctionLibraries/PubnubTimetokenUtilities.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeExit.h"
+#include "Threads/PubnubFunctionThread.h"
+
+
+void UPubnubChatActivityHeartbeat::BeginDestroy()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	Super::BeginDestroy();
+}
+
+void UPubnubChatActivityHeartbeat::InitActivityHeartbeat(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString& InUserID)
+{
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InPubnubClient, TEXT("Can't init ActivityHeartbeat, PubnubClient is invalid"));
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InChat, TEXT("Can't init ActivityHeartbeat, Chat is invalid"));
+
+	PubnubClient = InPubnubClient;
+	Chat = InChat;
+	UserID = InUserID;
+}
+
+void UPubnubChatActivityHeartbeat::SetActivityLimits(int InStoreInterval, int InIdleTimeout)
+{
+	FScopeLock Lock(&HeartbeatCriticalSection);
+	StoreInterval = InStoreInterval;
+	IdleTimeout = InIdleTimeout;
+}
+
+void UPubnubChatActivityHeartbeat::Start()
+{
+	if (TickerHandle.IsValid())
+	{ return; }
+
+	//Logging in counts as activity
+	ReportActivity();
+
+	{
+		FScopeLock Lock(&HeartbeatCriticalSection);
+		bRunning = true;
+	}
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UPubnubChatActivityHeartbeat::OnHeartbeatTicker), Pubnub_Chat_Activity_Heartbeat_Check_Period / 1000.0f);
+}
+
+void UPubnubChatActivityHeartbeat::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	FScopeLock Lock(&HeartbeatCriticalSection);
+	bRunning = false;
+}
+
+bool UPubnubChatActivityHeartbeat::IsRunning() const
+{
+	FScopeLock Lock(&HeartbeatCriticalSection);
+	return bRunning;
+}
+
+void UPubnubChatActivityHeartbeat::ReportActivity()
+{
+	const double CurrentTimeSeconds = FPlatformTime::Seconds();
+
+	FScopeLock Lock(&HeartbeatCriticalSection);
+	LastActivityTimeSeconds = CurrentTimeSeconds;
+}
+
+bool UPubnubChatActivityHeartbeat::ShouldWriteTimestamp(int64 CurrentTimetoken, double CurrentTimeSeconds) const
+{
+	const int64 RepositoryTimestamp = GetRepositoryLastActiveTimestamp();
+
+	FScopeLock Lock(&HeartbeatCriticalSection);
+
+	if (bWriteInFlight || IsIdle(CurrentTimeSeconds))
+	{ return false; }
+
+	const int64 NewestMarkedTimetoken = FMath::Max(LastMarkedTimetoken, RepositoryTimestamp);
+	if (NewestMarkedTimetoken <= 0)
+	{ return true; }
+
+	//Write one check period earlier, so the timestamp is never older than StoreInterval and the user doesn't flicker to inactive
+	const int64 ElapsedTimeMs = (CurrentTimetoken - NewestMarkedTimetoken) / 10000LL;
+	return ElapsedTimeMs >= FMath::Max(StoreInterval - Pubnub_Chat_Activity_Heartbeat_Check_Period, 0);
+}
+
+void UPubnubChatActivityHeartbeat::ApplyToUserUpdate(FPubnubChatUpdateUserInputData& UpdateUserData)
+{
+	//Update that doesn't set Custom keeps the stored timestamp
+	if (!UpdateUserData.ForceSetCustom && UpdateUserData.Custom.IsEmpty())
+	{ return; }
+
+	const int64 CurrentTimetoken = UPubnubChatInternalUtilities::TimetokenToInt64(UPubnubTimetokenUtilities::GetCurrentUnixTimetoken());
+	const double CurrentTimeSeconds = FPlatformTime::Seconds();
+	const int64 RepositoryTimestamp = GetRepositoryLastActiveTimestamp();
+
+	int64 TimestampToStore = 0;
+	{
+		FScopeLock Lock(&HeartbeatCriticalSection);
+		if (!bRunning)
+		{ return; }
+
+		if (IsIdle(CurrentTimeSeconds))
+		{
+			//Idle user keeps the old timestamp, so the update doesn't mark it as active
+			TimestampToStore = FMath::Max(LastMarkedTimetoken, RepositoryTimestamp);
+		}
+		else
+		{
+			//Update carries the fresh timestamp, so the next heartbeat write is not needed
+			TimestampToStore = CurrentTimetoken;
+			LastMarkedTimetoken = FMath::Max(LastMarkedTimetoken, CurrentTimetoken);
+		}
+	}
+
+	if (TimestampToStore > 0)
+	{
+		UpdateUserData.Custom = UPubnubChatInternalUtilities::AddLastActiveTimestampToCustom(UpdateUserData.Custom, UPubnubChatInternalUtilities::Int64ToTimetoken(TimestampToStore));
+	}
+}
+
+FPubnubChatOperationResult UPubnubChatActivityHeartbeat::WriteTimestamp()
+{
+	ON_SCOPE_EXIT
+	{
+		FScopeLock Lock(&HeartbeatCriticalSection);
+		bWriteInFlight = false;
+	};
+
+	FPubnubChatOperationResult FinalResult;
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(PubnubClient, TEXT("ActivityHeartbeat is not initialized"));
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(Chat.IsValid() && Chat->ObjectsRepository, TEXT("Can't write activity timestamp, Chat is invalid"));
+
+	const FString Timestamp = UPubnubTimetokenUtilities::GetCurrentUnixTimetoken();
+
+	//Writes run on the Chat async thread, after all user updates queued before them, so repository has the newest known Custom
+	FPubnubChatUserData UserData;
+	Chat->ObjectsRepository->TryGetUserData(UserID, UserData);
+
+	//Send only Custom - other user fields stay untouched on the server
+	FPubnubUserInputData UserInputData;
+	UserInputData.Custom = UPubnubChatInternalUtilities::AddLastActiveTimestampToCustom(UserData.Custom, Timestamp);
+	UserInputData.ForceSetCustom = true;
+
+	FPubnubUserMetadataResult SetUserResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Write, "SetUserMetadata", FinalResult, PubnubClient->SetUserMetadata(UserID, UserInputData, FPubnubGetMetadataInclude::FromValue(true)));
+	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, SetUserResult.Result, "SetUserMetadata");
+
+	Chat->ObjectsRepository->UpdateUserData(UserID, FPubnubChatUserData::FromPubnubUserData(SetUserResult.UserData), SetUserResult.UserData.Updated);
+
+	{
+		FScopeLock Lock(&HeartbeatCriticalSection);
+		LastMarkedTimetoken = FMath::Max(LastMarkedTimetoken, UPubnubChatInternalUtilities::TimetokenToInt64(Timestamp));
+	}
+
+	return FinalResult;
+}
+
+bool UPubnubChatActivityHeartbeat::OnHeartbeatTicker(float DeltaTime)
+{
+	const int64 CurrentTimetoken = UPubnubChatInternalUtilities::TimetokenToInt64(UPubnubTimetokenUtilities::GetCurrentUnixTimetoken());
+	if (!ShouldWriteTimestamp(CurrentTimetoken, FPlatformTime::Seconds()))
+	{ return true; }
+
+	if (!Chat.IsValid() || !Chat->AsyncFunctionsThread)
+	{ return true; }
+
+	{
+		FScopeLock Lock(&HeartbeatCriticalSection);
+		bWriteInFlight = true;
+	}
+
+	TWeakObjectPtr<UPubnubChatActivityHeartbeat> WeakThis = MakeWeakObjectPtr(this);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis]
+	{
+		if (!WeakThis.IsValid())
+		{ return; }
+
+		FPubnubChatOperationResult WriteResult = WeakThis.Get()->WriteTimestamp();
+		if (WriteResult.Error)
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("Failed to store user activity timestamp: %s"), *WriteResult.ErrorMessage);
+		}
+	});
+
+	return true;
+}
+
+int64 UPubnubChatActivityHeartbeat::GetRepositoryLastActiveTimestamp() const
+{
+	int64 RepositoryTimestamp = 0;
+	if (Chat.IsValid() && Chat->ObjectsRepository)
+	{
+		Chat->ObjectsRepository->TryGetUserLastActiveTimestamp(UserID, RepositoryTimestamp);
+	}
+	return RepositoryTimestamp;
+}
+
+bool UPubnubChatActivityHeartbeat::IsIdle(double CurrentTimeSeconds) const
+{
+	return IdleTimeout > 0 && (CurrentTimeSeconds - LastActivityTimeSeconds) * 1000.0 > IdleTimeout;
+}
@@ -0,0 +1,96 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "HAL/CriticalSection.h"
+#include "Containers/Ticker.h"
+#include "StructLibraries/PubnubChatStructLibrary.h"
+#include "StructLibraries/PubnubChatUserStructLibrary.h"
+#include "PubnubChatActivityHeartbeat.generated.h"
+
+class UPubnubClient;
+class UPubnubChat;
+
+/**
+ * Stores last active timestamp of the current user in its Custom data.
+ * Game thread only checks every few seconds whether a write is due, the write itself runs on the Chat async thread
+ * and sends only the Custom field. Writes are skipped when the user is idle, when the timestamp was marked recently
+ * (also by other devices of the same user) or when it was already added to a pending user update.
+ *
+ * This is an internal class and should not be used directly. Enable it with FPubnubChatConfig::StoreUserActivityTimestamps.
+ */
+UCLASS()
+class PUBNUBCHATSDK_API UPubnubChatActivityHeartbeat : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual void BeginDestroy() override;
+
+	void InitActivityHeartbeat(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString& InUserID);
+
+	/**
+	 * @param InStoreInterval Interval in milliseconds between timestamp writes
+	 * @param InIdleTimeout Time in milliseconds without reported activity after which writes are skipped. 0 means the user is never idle.
+	 */
+	void SetActivityLimits(int InStoreInterval, int InIdleTimeout);
+
+	/** Starts checking every few seconds whether the timestamp has to be written. Game thread only. */
+	void Start();
+	/** Stops writing timestamps. Game thread only. */
+	void Stop();
+	bool IsRunning() const;
+
+	/** Marks the current user as active now. Can be called from any thread. */
+	void ReportActivity();
+
+	/**
+	 * Checks if the timestamp should be written at given time.
+	 * @param CurrentTimetoken Current time as timetoken
+	 * @param CurrentTimeSeconds Current time in FPlatformTime::Seconds, used for idle detection
+	 */
+	bool ShouldWriteTimestamp(int64 CurrentTimetoken, double CurrentTimeSeconds) const;
+
+	/**
+	 * Adds activity timestamp to an update of the current user that replaces Custom, so the update doesn't remove it
+	 * and the next heartbeat write is not needed. Can be called from any thread.
+	 */
+	void ApplyToUserUpdate(FPubnubChatUpdateUserInputData& UpdateUserData);
+
+	/**
+	 * Writes current timestamp to Custom of the current user. Only the Custom field is sent.
+	 * Blocking: performs network requests on the calling thread.
+	 */
+	FPubnubChatOperationResult WriteTimestamp();
+
+private:
+	UPROPERTY()
+	TObjectPtr<UPubnubClient> PubnubClient = nullptr;
+	TWeakObjectPtr<UPubnubChat> Chat = nullptr;
+	FString UserID = "";
+	int StoreInterval = 0;
+	int IdleTimeout = 0;
+
+	/** Newest timestamp written by this heartbeat or added to a user update */
+	int64 LastMarkedTimetoken = 0;
+	/** FPlatformTime::Seconds of the last reported activity */
+	double LastActivityTimeSeconds = 0.0;
+	/** True between Start and Stop */
+	bool bRunning = false;
+	/** True while a write is queued or running, so checks don't queue another one */
+	bool bWriteInFlight = false;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	mutable FCriticalSection HeartbeatCriticalSection;
+
+	bool OnHeartbeatTicker(float DeltaTime);
+	/**
+	 * Timestamp stored in the repository, it can also be written by other devices of the same user.
+	 * Has to be called without HeartbeatCriticalSection locked, as it takes the repository lock.
+	 */
+	int64 GetRepositoryLastActiveTimestamp() const;
+	bool IsIdle(double CurrentTimeSeconds) const;
+};
@@ -0,0 +1,33 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatAsyncOperationScope.h"
+
+
+namespace
+{
+	thread_local const FPubnubChatAsyncHandle* CurrentAsyncHandle = nullptr;
+}
+
+FPubnubChatAsyncOperationScope::FPubnubChatAsyncOperationScope(const FPubnubChatAsyncHandle& InAsyncHandle)
+	: AsyncHandle(InAsyncHandle)
+{
+	bStarted = AsyncHandle.TryStart();
+	if (bStarted)
+	{
+		PreviousAsyncHandle = CurrentAsyncHandle;
+		CurrentAsyncHandle = &AsyncHandle;
+	}
+}
+
+FPubnubChatAsyncOperationScope::~FPubnubChatAsyncOperationScope()
+{
+	if (bStarted)
+	{
+		CurrentAsyncHandle = PreviousAsyncHandle;
+	}
+}
+
+bool FPubnubChatAsyncOperationScope::IsCurrentOperationCancelled()
+{
+	return CurrentAsyncHandle && CurrentAsyncHandle->IsCancelled();
+}
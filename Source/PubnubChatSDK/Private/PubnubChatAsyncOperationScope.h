@@ -0,0 +1,45 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StructLibraries/PubnubChatStructLibrary.h"
+
+/**
+ * Starts an operation queued by an *Async function and makes it the current operation of the thread until the scope ends,
+ * so requests made by the operation can stop retrying once it's cancelled.
+ *
+ * This is an internal class and should not be used directly.
+ */
+class PUBNUBCHATSDK_API FPubnubChatAsyncOperationScope
+{
+public:
+	explicit FPubnubChatAsyncOperationScope(const FPubnubChatAsyncHandle& InAsyncHandle);
+	~FPubnubChatAsyncOperationScope();
+
+	FPubnubChatAsyncOperationScope(const FPubnubChatAsyncOperationScope&) = delete;
+	FPubnubChatAsyncOperationScope& operator=(const FPubnubChatAsyncOperationScope&) = delete;
+
+	/** False if the operation was cancelled or its deadline passed before the scope started, it should be skipped then */
+	bool IsStarted() const { return bStarted; }
+
+	/** True if the operation running on this thread was cancelled */
+	static bool IsCurrentOperationCancelled();
+
+private:
+	FPubnubChatAsyncHandle AsyncHandle;
+	const FPubnubChatAsyncHandle* PreviousAsyncHandle = nullptr;
+	bool bStarted = false;
+};
+
+/**
+ * Starts the operation of AsyncHandle for the rest of the enclosing scope. If it was cancelled or its deadline passed,
+ * calls OnResponseNative with the cancelled result and returns. Used at the start of functions queued by *Async functions.
+ */
+#define PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnResponseNative) \
+	FPubnubChatAsyncOperationScope AsyncOperationScope(AsyncHandle); \
+	if (!AsyncOperationScope.IsStarted()) \
+	{ \
+		UPubnubChatInternalUtilities::CallCancelledDelegate(OnResponseNative, AsyncHandle); \
+		return; \
+	}
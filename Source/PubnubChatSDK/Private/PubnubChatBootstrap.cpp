@@ -0,0 +1,310 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatBootstrap.h"
+#include "PubnubClient.h"
+#include "PubnubChat.h"
+#include "PubnubChatUser.h"
+#include "PubnubChatChannel.h"
+#include "PubnubChatMembership.h"
+#include "PubnubChatMessage.h"
+#include "PubnubChatConst.h"
+#include "PubnubChatInternalMacros.h"
+#include "PubnubChatSubsystem.h"
+#include "FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "FunctionLibraries/PubnubTimetokenUtilities.h"
+#include "Async/Async.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Threads/PubnubFunctionThread.h"
+
+
+void UPubnubChatBootstrap::InitBootstrap(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString& InUserID, const FPubnubChatBootstrapConfig& InBootstrapConfig)
+{
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InPubnubClient, TEXT("Can't init Bootstrap, PubnubClient is invalid"));
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InChat, TEXT("Can't init Bootstrap, Chat is invalid"));
+
+	PubnubClient = InPubnubClient;
+	Chat = InChat;
+	UserID = InUserID;
+	BootstrapConfig = InBootstrapConfig;
+}
+
+FPubnubChatBootstrapResult UPubnubChatBootstrap::FetchBootstrapData(FPubnubChatUserResult& OutUserResult)
+{
+	FPubnubChatBootstrapResult FinalResult;
+	if (!PubnubClient || !Chat.IsValid())
+	{
+		OutUserResult.Result = FPubnubChatOperationResult::CreateError(TEXT("Bootstrap is not initialized"));
+		FinalResult.Result = OutUserResult.Result;
+		return FinalResult;
+	}
+
+	//User and the first page of its memberships don't depend on each other, fetch them concurrently
+	FPubnubMembershipsResult GetMembershipsResult;
+	FPubnubChatOperationResult GetMembershipsChatResult;
+	Chat->RunConcurrentRequests(2, [this, &OutUserResult, &GetMembershipsResult, &GetMembershipsChatResult](int32 RequestIndex)
+	{
+		if (RequestIndex == 0)
+		{
+			OutUserResult = Chat->GetUserForInit(UserID);
+		}
+		else
+		{
+			GetMembershipsResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Read, "GetMemberships", GetMembershipsChatResult, PubnubClient->GetMemberships(UserID, FPubnubMembershipInclude::FromValue(true), BootstrapConfig.MembershipsLimit, "", FPubnubMembershipSort(), FPubnubPage()));
+		}
+	});
+
+	if (OutUserResult.Result.Error || !OutUserResult.User)
+	{
+		FinalResult.Result = FPubnubChatOperationResult::CreateError(TEXT("Can't bootstrap, failed to get current user"));
+		return FinalResult;
+	}
+
+	FinalResult.Result.Merge(GetMembershipsChatResult);
+	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, GetMembershipsResult.Result, "GetMemberships");
+
+	//Memberships of an already initialized chat (refresh after warm start) belong to its current user object
+	UPubnubChatUser* MembershipsUser = Chat->CurrentUser ? Chat->CurrentUser.Get() : OutUserResult.User;
+	for (const FPubnubMembershipData& MembershipData : GetMembershipsResult.MembershipsData)
+	{
+		UPubnubChatChannel* Channel = Chat->CreateChannelObject(MembershipData.Channel.ChannelID, MembershipData.Channel);
+		FinalResult.Memberships.Add(Chat->CreateMembershipObject(MembershipsUser, Channel, MembershipData));
+	}
+
+	FetchMembershipChannelsData(FinalResult.Memberships, FinalResult);
+	return FinalResult;
+}
+
+void UPubnubChatBootstrap::FetchMembershipChannelsData(const TArray<UPubnubChatMembership*>& Memberships, FPubnubChatBootstrapResult& OutBootstrapResult)
+{
+	TArray<FString> Channels;
+	TArray<FString> Timetokens;
+	for (UPubnubChatMembership* Membership : Memberships)
+	{
+		//Skip our internal channels
+		if (UPubnubChatInternalUtilities::IsPubnubInternalChannel(Membership->GetChannelID()))
+		{ continue; }
+
+		const FString Timetoken = Membership->GetLastReadMessageTimetoken();
+		Timetokens.Add(Timetoken.IsEmpty() ? Pubnub_Chat_Empty_Timetoken : Timetoken);
+		Channels.Add(Membership->GetChannelID());
+	}
+
+	if (Channels.IsEmpty())
+	{ return; }
+
+	FPubnubFetchHistorySettings FetchHistorySettings;
+	FetchHistorySettings.MaxPerChannel = BootstrapConfig.LastMessagesCount;
+	FetchHistorySettings.IncludeUserID = true;
+	FetchHistorySettings.IncludeMessageActions = true;
+	FetchHistorySettings.IncludeMeta = true;
+
+	//Unread counts of all channels are a single request, sent together with history requests of every channel.
+	//Request 0 is the counts, request N is history of channel N-1
+	const int32 NumHistoryRequests = BootstrapConfig.LastMessagesCount > 0 ? Channels.Num() : 0;
+	FPubnubMessageCountsMultipleResult MessageCountsResult;
+	TArray<FPubnubFetchHistoryResult> FetchHistoryResults;
+	FetchHistoryResults.SetNum(NumHistoryRequests);
+	TArray<FPubnubChatOperationResult> RequestResults;
+	RequestResults.SetNum(NumHistoryRequests + 1);
+	Chat->RunConcurrentRequests(NumHistoryRequests + 1, [this, &Channels, &Timetokens, &FetchHistorySettings, &MessageCountsResult, &FetchHistoryResults, &RequestResults](int32 RequestIndex)
+	{
+		FPubnubChatOperationResult& RequestResult = RequestResults[RequestIndex];
+		if (RequestIndex == 0)
+		{
+			MessageCountsResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Read, "MessageCountsMultiple", RequestResult, PubnubClient->MessageCountsMultiple(Channels, Timetokens));
+			RequestResult.AddStep("MessageCountsMultiple", MessageCountsResult.Result);
+			return;
+		}
+
+		FPubnubFetchHistoryResult& FetchHistoryResult = FetchHistoryResults[RequestIndex - 1];
+		FetchHistoryResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Read, "FetchHistory", RequestResult, PubnubClient->FetchHistory(Channels[RequestIndex - 1], FetchHistorySettings));
+		RequestResult.AddStep("FetchHistory", FetchHistoryResult.Result);
+	});
+
+	for (const FPubnubChatOperationResult& RequestResult : RequestResults)
+	{
+		OutBootstrapResult.Result.Merge(RequestResult);
+	}
+
+	if (!MessageCountsResult.Result.Error)
+	{
+		OutBootstrapResult.UnreadMessagesCounts = MessageCountsResult.MessageCountsPerChannel;
+	}
+
+	//Failed channel doesn't stop the others, its error is reported in the result steps
+	for (int32 i = 0; i < NumHistoryRequests; ++i)
+	{
+		if (FetchHistoryResults[i].Result.Error)
+		{ continue; }
+
+		//Messages of thread channels have to be ThreadMessages
+		const FString& ChannelID = Channels[i];
+		if (UPubnubChatInternalUtilities::IsChannelAThread(ChannelID))
+		{
+			OutBootstrapResult.LastMessages.Append(Chat->CreateThreadMessageObjects(FetchHistoryResults[i].Messages, UPubnubChatInternalUtilities::GetParentChannelIDFromThreadID(ChannelID)));
+		}
+		else
+		{
+			OutBootstrapResult.LastMessages.Append(Chat->CreateMessageObjects(FetchHistoryResults[i].Messages));
+		}
+	}
+}
+
+bool UPubnubChatBootstrap::LoadSnapshot(UPubnubChatUser*& OutCurrentUser, FPubnubChatBootstrapResult& OutBootstrapResult)
+{
+	if (!Chat.IsValid())
+	{ return false; }
+
+	FString SnapshotJson;
+	if (!FFileHelper::LoadFileToString(SnapshotJson, *GetSnapshotFilePath(UserID)))
+	{ return false; }
+
+	FPubnubChatInternalBootstrapSnapshot Snapshot;
+	if (!DeserializeSnapshot(SnapshotJson, UserID, Snapshot))
+	{
+		UE_LOG(PubnubChatLog, Warning, TEXT("Bootstrap snapshot of user %s is invalid or outdated, it will be replaced."), *UserID);
+		return false;
+	}
+
+	OutCurrentUser = Chat->CreateUserObject(UserID, Snapshot.UserData);
+
+	OutBootstrapResult = FPubnubChatBootstrapResult();
+	OutBootstrapResult.FromSnapshot = true;
+	for (const FPubnubChatInternalSnapshotMembership& SnapshotMembership : Snapshot.Memberships)
+	{
+		UPubnubChatChannel* Channel = Chat->CreateChannelObject(SnapshotMembership.ChannelID, SnapshotMembership.ChannelData);
+		OutBootstrapResult.Memberships.Add(Chat->CreateMembershipObject(OutCurrentUser, Channel, SnapshotMembership.MembershipData));
+		if (SnapshotMembership.UnreadMessagesCount >= 0)
+		{
+			OutBootstrapResult.UnreadMessagesCounts.Add(SnapshotMembership.ChannelID, SnapshotMembership.UnreadMessagesCount);
+		}
+	}
+
+	for (const FPubnubChatInternalSnapshotMessage& SnapshotMessage : Snapshot.LastMessages)
+	{
+		const FString& ChannelID = SnapshotMessage.MessageData.ChannelID;
+		if (UPubnubChatInternalUtilities::IsChannelAThread(ChannelID))
+		{
+			OutBootstrapResult.LastMessages.Add(Chat->GetOrCreateThreadMessageObject(ChannelID, SnapshotMessage.Timetoken, SnapshotMessage.MessageData, UPubnubChatInternalUtilities::GetParentChannelIDFromThreadID(ChannelID)));
+		}
+		else
+		{
+			OutBootstrapResult.LastMessages.Add(Chat->GetOrCreateMessageObject(ChannelID, SnapshotMessage.Timetoken, SnapshotMessage.MessageData));
+		}
+	}
+
+	return true;
+}
+
+void UPubnubChatBootstrap::SaveSnapshot(UPubnubChatUser* CurrentUser, const FPubnubChatBootstrapResult& BootstrapResult)
+{
+	if (!BootstrapConfig.WarmStartFromSnapshot || !CurrentUser)
+	{ return; }
+
+	FPubnubChatInternalBootstrapSnapshot Snapshot;
+	Snapshot.Version = Pubnub_Chat_Bootstrap_Snapshot_Version;
+	Snapshot.UserID = UserID;
+	Snapshot.UserData = CurrentUser->GetUserData();
+	Snapshot.SavedTimetoken = UPubnubTimetokenUtilities::GetCurrentUnixTimetoken();
+
+	for (UPubnubChatMembership* Membership : BootstrapResult.Memberships)
+	{
+		if (!Membership || !Membership->GetChannel())
+		{ continue; }
+
+		FPubnubChatInternalSnapshotMembership& SnapshotMembership = Snapshot.Memberships.AddDefaulted_GetRef();
+		SnapshotMembership.ChannelID = Membership->GetChannelID();
+		SnapshotMembership.ChannelData = Membership->GetChannel()->GetChannelData();
+		SnapshotMembership.MembershipData = Membership->GetMembershipData();
+		if (const int* UnreadMessagesCount = BootstrapResult.UnreadMessagesCounts.Find(SnapshotMembership.ChannelID))
+		{
+			SnapshotMembership.UnreadMessagesCount = *UnreadMessagesCount;
+		}
+	}
+
+	for (UPubnubChatMessage* Message : BootstrapResult.LastMessages)
+	{
+		if (!Message)
+		{ continue; }
+
+		FPubnubChatInternalSnapshotMessage& SnapshotMessage = Snapshot.LastMessages.AddDefaulted_GetRef();
+		SnapshotMessage.Timetoken = Message->GetMessageTimetoken();
+		SnapshotMessage.MessageData = Message->GetMessageData();
+	}
+
+	//File is written on the async thread, so InitChat doesn't wait for the disk. Writes of the same chat stay in order
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(Chat.IsValid() && Chat->AsyncFunctionsThread, TEXT("Can't save bootstrap snapshot, Chat is not initialized"));
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([SnapshotJson = SerializeSnapshot(Snapshot), SnapshotFilePath = GetSnapshotFilePath(UserID), SnapshotUserID = UserID]
+	{
+		if (!FFileHelper::SaveStringToFile(SnapshotJson, *SnapshotFilePath))
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("Failed to save bootstrap snapshot of user %s."), *SnapshotUserID);
+		}
+	});
+}
+
+void UPubnubChatBootstrap::RequestRefresh()
+{
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(Chat.IsValid() && Chat->AsyncFunctionsThread, TEXT("Can't refresh bootstrap data, Chat is not initialized"));
+
+	TWeakObjectPtr<UPubnubChatBootstrap> WeakThis = MakeWeakObjectPtr(this);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis]
+	{
+		if (!WeakThis.IsValid() || !WeakThis->Chat.IsValid())
+		{ return; }
+
+		FPubnubChatUserResult UserResult;
+		FPubnubChatBootstrapResult BootstrapResult = WeakThis->FetchBootstrapData(UserResult);
+		if (BootstrapResult.Result.Error)
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("Failed to refresh bootstrap data: %s"), *BootstrapResult.Result.ErrorMessage);
+		}
+		else
+		{
+			WeakThis->SaveSnapshot(WeakThis->Chat->CurrentUser, BootstrapResult);
+		}
+
+		//Keep created objects alive until the result is broadcast on the game thread
+		TArray<TStrongObjectPtr<UObject>> BootstrapObjects;
+		for (UPubnubChatMembership* Membership : BootstrapResult.Memberships)
+		{
+			BootstrapObjects.Emplace(Membership);
+		}
+		for (UPubnubChatMessage* Message : BootstrapResult.LastMessages)
+		{
+			BootstrapObjects.Emplace(Message);
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, BootstrapResult, BootstrapObjects = MoveTemp(BootstrapObjects)]()
+		{
+			if (!WeakThis.IsValid() || !WeakThis->Chat.IsValid())
+			{ return; }
+
+			WeakThis->Chat->OnBootstrapCompleted.Broadcast(BootstrapResult);
+			WeakThis->Chat->OnBootstrapCompletedNative.Broadcast(BootstrapResult);
+		});
+	});
+}
+
+FString UPubnubChatBootstrap::GetSnapshotFilePath(const FString& UserID)
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), Pubnub_Chat_Bootstrap_Snapshot_Directory, FPaths::MakeValidFileName(UserID) + TEXT(".json"));
+}
+
+FString UPubnubChatBootstrap::SerializeSnapshot(const FPubnubChatInternalBootstrapSnapshot& Snapshot)
+{
+	FString SnapshotJson;
+	FJsonObjectConverter::UStructToJsonObjectString(Snapshot, SnapshotJson, 0, 0, 0, nullptr, false);
+	return SnapshotJson;
+}
+
+bool UPubnubChatBootstrap::DeserializeSnapshot(const FString& Json, const FString& ExpectedUserID, FPubnubChatInternalBootstrapSnapshot& OutSnapshot)
+{
+	if (Json.IsEmpty() || !FJsonObjectConverter::JsonObjectStringToUStruct(Json, &OutSnapshot, 0, 0))
+	{ return false; }
+
+	return OutSnapshot.Version == Pubnub_Chat_Bootstrap_Snapshot_Version && OutSnapshot.UserID == ExpectedUserID;
+}
@@ -0,0 +1,71 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "StructLibraries/PubnubChatStructLibrary.h"
+#include "StructLibraries/PubnubChatInternalStructLibrary.h"
+#include "PubnubChatBootstrap.generated.h"
+
+class UPubnubClient;
+class UPubnubChat;
+class UPubnubChatUser;
+
+/**
+ * Fetches data needed right after InitChat together with the current user.
+ * The current user and the first page of its memberships are fetched concurrently, then unread messages counts of all membership channels
+ * in a single request together with last messages of every channel. Requests run on the Chat request workers, the calling thread only waits
+ * for them and creates chat objects from their results.
+ * Optionally saves the result as a snapshot in Saved/, so the next InitChat of the same user can return it
+ * without waiting for the network and refresh it in the background.
+ *
+ * This is an internal class and should not be used directly. Configure it with FPubnubChatConfig::Bootstrap.
+ */
+UCLASS()
+class PUBNUBCHATSDK_API UPubnubChatBootstrap : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	void InitBootstrap(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString& InUserID, const FPubnubChatBootstrapConfig& InBootstrapConfig);
+
+	/**
+	 * Fetches the current user and bootstrap data.
+	 * Blocking: waits for network requests sent by the Chat request workers.
+	 * @param OutUserResult Receives result of getting (or creating) the current user. Bootstrap data is empty if it failed.
+	 */
+	FPubnubChatBootstrapResult FetchBootstrapData(FPubnubChatUserResult& OutUserResult);
+
+	/**
+	 * Creates the current user and bootstrap data from the snapshot saved by the previous session of the same user.
+	 * Local: reads the snapshot file, does not perform any network requests.
+	 * @return False if there is no valid snapshot
+	 */
+	bool LoadSnapshot(UPubnubChatUser*& OutCurrentUser, FPubnubChatBootstrapResult& OutBootstrapResult);
+
+	/**
+	 * Saves bootstrap data as the snapshot for the next session. Does nothing if warm start is disabled.
+	 * The snapshot is created on the calling thread, the file is written on the Chat async thread.
+	 */
+	void SaveSnapshot(UPubnubChatUser* CurrentUser, const FPubnubChatBootstrapResult& BootstrapResult);
+
+	/** Queues fetching of fresh bootstrap data on the Chat async thread and broadcasts UPubnubChat::OnBootstrapCompleted with it. */
+	void RequestRefresh();
+
+	/** Path of the snapshot file of given user */
+	static FString GetSnapshotFilePath(const FString& UserID);
+	static FString SerializeSnapshot(const FPubnubChatInternalBootstrapSnapshot& Snapshot);
+	/** @return False if Json is not a valid snapshot of ExpectedUserID in the current snapshot version */
+	static bool DeserializeSnapshot(const FString& Json, const FString& ExpectedUserID, FPubnubChatInternalBootstrapSnapshot& OutSnapshot);
+
+private:
+	UPROPERTY()
+	TObjectPtr<UPubnubClient> PubnubClient = nullptr;
+	TWeakObjectPtr<UPubnubChat> Chat = nullptr;
+	FString UserID = "";
+	FPubnubChatBootstrapConfig BootstrapConfig;
+
+	/** Fetches unread messages counts and last messages of given memberships. */
+	void FetchMembershipChannelsData(const TArray<UPubnubChatMembership*>& Memberships, FPubnubChatBootstrapResult& OutBootstrapResult);
+};
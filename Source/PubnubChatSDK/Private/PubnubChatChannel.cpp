@@ -12,11 +12,19 @@
 #include "PubnubChatSubsystem.h"
 #include "PubnubChatObjectsRepository.h"
 #include "PubnubChatMessage.h"
+#include "PubnubChatOutbox.h"
 #include "PubnubChatUser.h"
+#include "PubnubChatThreadChannel.h"
 #include "PubnubChatThreadMessage.h"
+#include "PubnubChatUpdatesStream.h"
+#include "PubnubChatReconnectCatchUp.h"
+#include "PubnubChatDispatchQueue.h"
+#include "PubnubChatPersistentStore.h"
+#include "PubnubChatReadMarkerWriter.h"
 #include "Entities/PubnubChannelEntity.h"
 #include "Entities/PubnubSubscription.h"
 #include "FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "FunctionLibraries/PubnubChatJsonReader.h"
 #include "FunctionLibraries/PubnubChatLogUtilities.h"
 #include "FunctionLibraries/PubnubJsonUtilities.h"
 #include "FunctionLibraries/PubnubTimetokenUtilities.h"
@@ -24,6 +32,8 @@
 #include "FunctionLibraries/PubnubInternalUtilities.h"
 #include "HAL/CriticalSection.h"
 #include "HAL/PlatformProcess.h"
+#include "Async/Async.h"
+#include "UObject/StrongObjectPtr.h"
 #include <cmath> 
 
 #include "PubnubChatMessageDraft.h"
@@ -51,22 +61,29 @@ FPubnubChatChannelData UPubnubChatChannel::GetChannelData() const
 	return FPubnubChatChannelData();
 }
 
+int64 UPubnubChatChannel::GetDataVersion() const
+{
+	PUBNUB_CHAT_OBJECT_RETURN_IF_NOT_INITIALIZED(0);
+
+	return Chat->ObjectsRepository->GetChannelDataVersion(ChannelID);
+}
+
 FPubnubChatOperationResult UPubnubChatChannel::Update(FPubnubChatUpdateChannelInputData UpdateChannelData)
 {
 	FPubnubChatOperationResult FinalResult;
 	PUBNUB_CHAT_OBJECT_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
 	
 	//SetChannelMetadata by PubnubClient - include all fields in response
-	FPubnubChannelMetadataResult SetChannelResult = PubnubClient->SetChannelMetadata(ChannelID, UpdateChannelData.ToPubnubChannelInputData(), FPubnubGetMetadataInclude::FromValue(true));
+	FPubnubChannelMetadataResult SetChannelResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Write, "SetChannelMetadata", FinalResult, PubnubClient->SetChannelMetadata(ChannelID, UpdateChannelData.ToPubnubChannelInputData(), FPubnubGetMetadataInclude::FromValue(true)));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, SetChannelResult.Result, "SetChannelMetadata");
 	
 	//Update repository with updated channel data
-	Chat->ObjectsRepository->UpdateChannelData(ChannelID, FPubnubChatChannelData::FromPubnubChannelData(SetChannelResult.ChannelData));
+	Chat->ObjectsRepository->UpdateChannelData(ChannelID, FPubnubChatChannelData::FromPubnubChannelData(SetChannelResult.ChannelData), SetChannelResult.ChannelData.Updated);
 
 	return FinalResult;
 }
 
-void UPubnubChatChannel::UpdateAsync(FPubnubChatUpdateChannelInputData UpdateChannelData, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::UpdateAsync(FPubnubChatUpdateChannelInputData UpdateChannelData, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -74,23 +91,28 @@ void UPubnubChatChannel::UpdateAsync(FPubnubChatUpdateChannelInputData UpdateCha
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	UpdateAsync(UpdateChannelData, NativeCallback);
+	return UpdateAsync(UpdateChannelData, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::UpdateAsync(FPubnubChatUpdateChannelInputData UpdateChannelData, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::UpdateAsync(FPubnubChatUpdateChannelInputData UpdateChannelData, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, UpdateChannelData = MoveTemp(UpdateChannelData), OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, UpdateChannelData = MoveTemp(UpdateChannelData), OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult UpdateResult = WeakThis.Get()->Update(UpdateChannelData);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, UpdateResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::Connect()
@@ -107,16 +129,33 @@ FPubnubChatOperationResult UPubnubChatChannel::Connect()
 	//Add lister to subscription with provided callback
 	AddOnMessageReceivedLambdaToSubscription(ThisWeak);
 	
+	//Server time from before the subscription marks the oldest message this channel can miss. Without it the whole replay window is replayed
+	int64 ConnectedTimetoken = 0;
+	if (Chat->ReconnectCatchUp && Chat->ReconnectCatchUp->IsEnabled())
+	{
+		FPubnubChatOperationResult TimeResult = Chat->FetchServerTimetoken(ConnectedTimetoken);
+		if (TimeResult.Error)
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("Failed to get server time for channel %s, messages missed during connection gaps are replayed from the whole replay window: %s"), *ChannelID, *TimeResult.ErrorMessage);
+		}
+	}
+	
 	//Subscribe with this channel Subscription
 	FPubnubOperationResult SubscribeResult = ConnectSubscription->Subscribe();
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, SubscribeResult, "Subscribe");
 	
 	IsConnected = true;
 	
+	//Messages missed by this channel during connection gaps will be replayed after reconnect
+	if (Chat->ReconnectCatchUp)
+	{
+		Chat->ReconnectCatchUp->RegisterChannel(this, ConnectedTimetoken);
+	}
+	
 	return FinalResult;
 }
 
-void UPubnubChatChannel::ConnectAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::ConnectAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -124,23 +163,28 @@ void UPubnubChatChannel::ConnectAsync(FOnPubnubChatOperationResponse OnOperation
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	ConnectAsync(NativeCallback);
+	return ConnectAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::ConnectAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::ConnectAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult ConnectResult = WeakThis.Get()->Connect();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, ConnectResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatJoinResult UPubnubChatChannel::Join(FPubnubChatMembershipData MembershipData)
@@ -152,7 +196,7 @@ FPubnubChatJoinResult UPubnubChatChannel::Join(FPubnubChatMembershipData Members
 	FPubnubMembershipInputData MembershipInputData = MembershipData.ToPubnubMembershipInputData(ChannelID);
 	//This forces to reset status if not provided by User. Otherwise, Status could stay as "pending" for previously invited user.
 	MembershipInputData.ForceSetStatus = true;
-	FPubnubMembershipsResult SetMembershipResult = PubnubClient->SetMemberships(Chat->CurrentUserID, {MembershipInputData}, FPubnubMembershipInclude::FromValue(false), 1);
+	FPubnubMembershipsResult SetMembershipResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Write, "SetMemberships", FinalResult.Result, PubnubClient->SetMemberships(Chat->CurrentUserID, {MembershipInputData}, FPubnubMembershipInclude::FromValue(false), 1));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, SetMembershipResult.Result, "SetMemberships");
 
 	//Create membership objects
@@ -168,7 +212,7 @@ FPubnubChatJoinResult UPubnubChatChannel::Join(FPubnubChatMembershipData Members
 	return FinalResult;
 }
 
-void UPubnubChatChannel::JoinAsync(FOnPubnubChatJoinResponse OnJoinResponse, FPubnubChatMembershipData MembershipData)
+FPubnubChatAsyncHandle UPubnubChatChannel::JoinAsync(FOnPubnubChatJoinResponse OnJoinResponse, FPubnubChatMembershipData MembershipData, float DeadlineSeconds)
 {
 	FOnPubnubChatJoinResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnJoinResponse](const FPubnubChatJoinResult& JoinResult)
@@ -176,23 +220,28 @@ void UPubnubChatChannel::JoinAsync(FOnPubnubChatJoinResponse OnJoinResponse, FPu
 		OnJoinResponse.ExecuteIfBound(JoinResult);
 	});
 
-	JoinAsync(NativeCallback, MembershipData);
+	return JoinAsync(NativeCallback, MembershipData, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::JoinAsync(FOnPubnubChatJoinResponseNative OnJoinResponseNative, FPubnubChatMembershipData MembershipData)
+FPubnubChatAsyncHandle UPubnubChatChannel::JoinAsync(FOnPubnubChatJoinResponseNative OnJoinResponseNative, FPubnubChatMembershipData MembershipData, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnJoinResponseNative, FPubnubChatJoinResult());
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, MembershipData = MoveTemp(MembershipData), OnJoinResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, MembershipData = MoveTemp(MembershipData), OnJoinResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnJoinResponseNative);
 		
 		FPubnubChatJoinResult JoinResult = WeakThis.Get()->Join(MembershipData);
 		UPubnubUtilities::CallPubnubDelegate(OnJoinResponseNative, JoinResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::Disconnect()
@@ -203,18 +252,42 @@ FPubnubChatOperationResult UPubnubChatChannel::Disconnect()
 	//Remove message related delegates
 	ConnectSubscription->OnPubnubMessageNative.Clear();
 	
+	//Last read markers of the channel are written right away, without waiting for the flush interval
+	if (Chat->ReadMarkerWriter)
+	{
+		Chat->ReadMarkerWriter->FlushChannel(ChannelID);
+	}
+	
 	//Skip if it's not connected
 	if (!IsConnected)
 	{ return FinalResult; }
 
+	if (Chat->ReconnectCatchUp)
+	{
+		Chat->ReconnectCatchUp->UnregisterChannel(this);
+	}
+
 	//Unsubscribe and return result
 	FPubnubOperationResult UnsubscribeResult = ConnectSubscription->Unsubscribe();
 	FinalResult.AddStep("Unsubscribe", UnsubscribeResult);
 	IsConnected = false;
+	
+	//Echoes of already published messages won't be received anymore, failed ones are kept so they can be sent again
+	{
+		FScopeLock Lock(&LocalEchoCriticalSection);
+		for (auto It = PendingLocalEchoes.CreateIterator(); It; ++It)
+		{
+			if (It->Value.bPublished)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+	
 	return FinalResult;
 }
 
-void UPubnubChatChannel::DisconnectAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::DisconnectAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -222,23 +295,28 @@ void UPubnubChatChannel::DisconnectAsync(FOnPubnubChatOperationResponse OnOperat
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	DisconnectAsync(NativeCallback);
+	return DisconnectAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::DisconnectAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::DisconnectAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult DisconnectResult = WeakThis.Get()->Disconnect();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, DisconnectResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::Leave()
@@ -247,14 +325,20 @@ FPubnubChatOperationResult UPubnubChatChannel::Leave()
 
 	FPubnubChatOperationResult FinalResult;
 
+	//Last read markers that were not written yet would create the membership again
+	if (Chat->ReadMarkerWriter)
+	{
+		Chat->ReadMarkerWriter->DiscardChannel(ChannelID, Chat->CurrentUserID);
+	}
+
 	//RemoveMemberships by PubnubClient
-	FPubnubMembershipsResult RemoveMembershipsResult = PubnubClient->RemoveMemberships(Chat->CurrentUserID, {ChannelID}, FPubnubMembershipInclude::FromValue(false), 1);
+	FPubnubMembershipsResult RemoveMembershipsResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Write, "RemoveMemberships", FinalResult, PubnubClient->RemoveMemberships(Chat->CurrentUserID, {ChannelID}, FPubnubMembershipInclude::FromValue(false), 1));
 	FinalResult.AddStep("RemoveMemberships", RemoveMembershipsResult.Result);
 
 	return FinalResult;
 }
 
-void UPubnubChatChannel::LeaveAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::LeaveAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -262,23 +346,28 @@ void UPubnubChatChannel::LeaveAsync(FOnPubnubChatOperationResponse OnOperationRe
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	LeaveAsync(NativeCallback);
+	return LeaveAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::LeaveAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::LeaveAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult LeaveResult = WeakThis.Get()->Leave();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, LeaveResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::SendText(const FString Message, FPubnubChatSendTextParams SendTextParams)
@@ -286,7 +375,7 @@ FPubnubChatOperationResult UPubnubChatChannel::SendText(const FString Message, F
 	return SendTextInternal(Message, SendTextParams);
 }
 
-void UPubnubChatChannel::SendTextAsync(const FString Message, FOnPubnubChatOperationResponse OnOperationResponse, FPubnubChatSendTextParams SendTextParams)
+FPubnubChatAsyncHandle UPubnubChatChannel::SendTextAsync(const FString Message, FOnPubnubChatOperationResponse OnOperationResponse, FPubnubChatSendTextParams SendTextParams, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -294,23 +383,35 @@ void UPubnubChatChannel::SendTextAsync(const FString Message, FOnPubnubChatOpera
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	SendTextAsync(Message, NativeCallback, SendTextParams);
+	return SendTextAsync(Message, NativeCallback, SendTextParams, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::SendTextAsync(const FString Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative, FPubnubChatSendTextParams SendTextParams)
+FPubnubChatAsyncHandle UPubnubChatChannel::SendTextAsync(const FString Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative, FPubnubChatSendTextParams SendTextParams, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
+	//Local echo is created right away, so it's shown before the queued send starts
+	FString LocalEchoID;
+	if (SendTextParams.LocalEcho && !Message.IsEmpty())
+	{
+		LocalEchoID = CreateLocalEcho(Message, SendTextParams, nullptr, TMap<FString, FString>());
+	}
+	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Message, SendTextParams = MoveTemp(SendTextParams), OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Message, SendTextParams = MoveTemp(SendTextParams), LocalEchoID, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
-		FPubnubChatOperationResult SendTextResult = WeakThis.Get()->SendText(Message, SendTextParams);
+		FPubnubChatOperationResult SendTextResult = WeakThis.Get()->SendTextInternal(Message, SendTextParams, nullptr, TMap<FString, FString>(), LocalEchoID);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, SendTextResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatInviteResult UPubnubChatChannel::Invite(UPubnubChatUser* User)
@@ -325,7 +426,7 @@ FPubnubChatInviteResult UPubnubChatChannel::Invite(UPubnubChatUser* User)
 	Include.IncludeCustom = true;
 	Include.IncludeStatus = true;
 	Include.IncludeType = true;
-	FPubnubChannelMembersResult GetChannelMembersResult = PubnubClient->GetChannelMembers(ChannelID, Include, 1, Filter);
+	FPubnubChannelMembersResult GetChannelMembersResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Read, "GetChannelMembers", FinalResult.Result, PubnubClient->GetChannelMembers(ChannelID, Include, 1, Filter));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, GetChannelMembersResult.Result, "GetChannelMembers");
 	
 	//If User is already member of that channel, we just return the membership
@@ -340,7 +441,7 @@ FPubnubChatInviteResult UPubnubChatChannel::Invite(UPubnubChatUser* User)
 	MembershipData.Status = Pubnub_Chat_Invited_User_Membership_status;
 	
 	//SetMemberships by PubnubClient
-	FPubnubMembershipsResult SetMembershipResult = PubnubClient->SetMemberships(User->GetUserID(), {MembershipData.ToPubnubMembershipInputData(ChannelID)}, FPubnubMembershipInclude::FromValue(false), 1);
+	FPubnubMembershipsResult SetMembershipResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Write, "SetMemberships", FinalResult.Result, PubnubClient->SetMemberships(User->GetUserID(), {MembershipData.ToPubnubMembershipInputData(ChannelID)}, FPubnubMembershipInclude::FromValue(false), 1));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, SetMembershipResult.Result, "SetMemberships");
 
 	//Emit Invite event
@@ -357,7 +458,7 @@ FPubnubChatInviteResult UPubnubChatChannel::Invite(UPubnubChatUser* User)
 	return FinalResult;
 }
 
-void UPubnubChatChannel::InviteAsync(UPubnubChatUser* User, FOnPubnubChatInviteResponse OnInviteResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::InviteAsync(UPubnubChatUser* User, FOnPubnubChatInviteResponse OnInviteResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatInviteResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnInviteResponse](const FPubnubChatInviteResult& InviteResult)
@@ -365,23 +466,28 @@ void UPubnubChatChannel::InviteAsync(UPubnubChatUser* User, FOnPubnubChatInviteR
 		OnInviteResponse.ExecuteIfBound(InviteResult);
 	});
 
-	InviteAsync(User, NativeCallback);
+	return InviteAsync(User, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::InviteAsync(UPubnubChatUser* User, FOnPubnubChatInviteResponseNative OnInviteResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::InviteAsync(UPubnubChatUser* User, FOnPubnubChatInviteResponseNative OnInviteResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnInviteResponseNative, FPubnubChatInviteResult());
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, User, OnInviteResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, User, OnInviteResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnInviteResponseNative);
 		
 		FPubnubChatInviteResult InviteResult = WeakThis.Get()->Invite(User);
 		UPubnubUtilities::CallPubnubDelegate(OnInviteResponseNative, InviteResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatInviteMultipleResult UPubnubChatChannel::InviteMultiple(TArray<UPubnubChatUser*> Users)
@@ -404,7 +510,7 @@ FPubnubChatInviteMultipleResult UPubnubChatChannel::InviteMultiple(TArray<UPubnu
 	}
 
 	//SetChannelMembers by PubnubClient
-	FPubnubChannelMembersResult SetMembersResult = PubnubClient->SetChannelMembers(ChannelID, MembersInput, FPubnubMemberInclude::FromValue(false), 1);
+	FPubnubChannelMembersResult SetMembersResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Write, "SetChannelMembers", FinalResult.Result, PubnubClient->SetChannelMembers(ChannelID, MembersInput, FPubnubMemberInclude::FromValue(false), 1));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, SetMembersResult.Result, "SetChannelMembers");
 
 	//For every invited user create a Membership and send invitation events
@@ -425,7 +531,7 @@ FPubnubChatInviteMultipleResult UPubnubChatChannel::InviteMultiple(TArray<UPubnu
 	return FinalResult;
 }
 
-void UPubnubChatChannel::InviteMultipleAsync(TArray<UPubnubChatUser*> Users, FOnPubnubChatInviteMultipleResponse OnInviteMultipleResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::InviteMultipleAsync(TArray<UPubnubChatUser*> Users, FOnPubnubChatInviteMultipleResponse OnInviteMultipleResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatInviteMultipleResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnInviteMultipleResponse](const FPubnubChatInviteMultipleResult& InviteMultipleResult)
@@ -433,23 +539,28 @@ void UPubnubChatChannel::InviteMultipleAsync(TArray<UPubnubChatUser*> Users, FOn
 		OnInviteMultipleResponse.ExecuteIfBound(InviteMultipleResult);
 	});
 
-	InviteMultipleAsync(Users, NativeCallback);
+	return InviteMultipleAsync(Users, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::InviteMultipleAsync(TArray<UPubnubChatUser*> Users, FOnPubnubChatInviteMultipleResponseNative OnInviteMultipleResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::InviteMultipleAsync(TArray<UPubnubChatUser*> Users, FOnPubnubChatInviteMultipleResponseNative OnInviteMultipleResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnInviteMultipleResponseNative, FPubnubChatInviteMultipleResult());
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Users, OnInviteMultipleResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Users, OnInviteMultipleResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnInviteMultipleResponseNative);
 		
 		FPubnubChatInviteMultipleResult InviteMultipleResult = WeakThis.Get()->InviteMultiple(Users);
 		UPubnubUtilities::CallPubnubDelegate(OnInviteMultipleResponseNative, InviteMultipleResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::PinMessage(UPubnubChatMessage* Message)
@@ -483,7 +594,7 @@ FPubnubChatOperationResult UPubnubChatChannel::PinMessage(UPubnubChatMessage* Me
 	return FinalResult;
 }
 
-void UPubnubChatChannel::PinMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::PinMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -491,23 +602,28 @@ void UPubnubChatChannel::PinMessageAsync(UPubnubChatMessage* Message, FOnPubnubC
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	PinMessageAsync(Message, NativeCallback);
+	return PinMessageAsync(Message, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::PinMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::PinMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Message, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Message, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult PinResult = WeakThis.Get()->PinMessage(Message);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, PinResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::UnpinMessage()
@@ -529,7 +645,7 @@ FPubnubChatOperationResult UPubnubChatChannel::UnpinMessage()
 	return FinalResult;
 }
 
-void UPubnubChatChannel::UnpinMessageAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::UnpinMessageAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -537,23 +653,28 @@ void UPubnubChatChannel::UnpinMessageAsync(FOnPubnubChatOperationResponse OnOper
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	UnpinMessageAsync(NativeCallback);
+	return UnpinMessageAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::UnpinMessageAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::UnpinMessageAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult UnpinResult = WeakThis.Get()->UnpinMessage();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, UnpinResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatMessageResult UPubnubChatChannel::GetPinnedMessage()
@@ -598,7 +719,7 @@ FPubnubChatMessageResult UPubnubChatChannel::GetPinnedMessage()
 	return FinalResult;
 }
 
-void UPubnubChatChannel::GetPinnedMessageAsync(FOnPubnubChatMessageResponse OnMessageResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetPinnedMessageAsync(FOnPubnubChatMessageResponse OnMessageResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatMessageResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnMessageResponse](const FPubnubChatMessageResult& MessageResult)
@@ -606,23 +727,28 @@ void UPubnubChatChannel::GetPinnedMessageAsync(FOnPubnubChatMessageResponse OnMe
 		OnMessageResponse.ExecuteIfBound(MessageResult);
 	});
 
-	GetPinnedMessageAsync(NativeCallback);
+	return GetPinnedMessageAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::GetPinnedMessageAsync(FOnPubnubChatMessageResponseNative OnMessageResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetPinnedMessageAsync(FOnPubnubChatMessageResponseNative OnMessageResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnMessageResponseNative, FPubnubChatMessageResult());
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnMessageResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnMessageResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnMessageResponseNative);
 		
 		FPubnubChatMessageResult MessageResult = WeakThis.Get()->GetPinnedMessage();
 		UPubnubUtilities::CallPubnubDelegate(OnMessageResponseNative, MessageResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatWhoIsPresentResult UPubnubChatChannel::WhoIsPresent(int Limit, int Offset)
@@ -633,7 +759,7 @@ FPubnubChatWhoIsPresentResult UPubnubChatChannel::WhoIsPresent(int Limit, int Of
 	return Chat->WhoIsPresent(ChannelID, Limit, Offset);
 }
 
-void UPubnubChatChannel::WhoIsPresentAsync(FOnPubnubChatWhoIsPresentResponse OnWhoIsPresentResponse, int Limit, int Offset)
+FPubnubChatAsyncHandle UPubnubChatChannel::WhoIsPresentAsync(FOnPubnubChatWhoIsPresentResponse OnWhoIsPresentResponse, int Limit, int Offset, float DeadlineSeconds)
 {
 	FOnPubnubChatWhoIsPresentResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnWhoIsPresentResponse](const FPubnubChatWhoIsPresentResult& WhoIsPresentResult)
@@ -641,23 +767,28 @@ void UPubnubChatChannel::WhoIsPresentAsync(FOnPubnubChatWhoIsPresentResponse OnW
 		OnWhoIsPresentResponse.ExecuteIfBound(WhoIsPresentResult);
 	});
 
-	WhoIsPresentAsync(NativeCallback, Limit, Offset);
+	return WhoIsPresentAsync(NativeCallback, Limit, Offset, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::WhoIsPresentAsync(FOnPubnubChatWhoIsPresentResponseNative OnWhoIsPresentResponseNative, int Limit, int Offset)
+FPubnubChatAsyncHandle UPubnubChatChannel::WhoIsPresentAsync(FOnPubnubChatWhoIsPresentResponseNative OnWhoIsPresentResponseNative, int Limit, int Offset, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnWhoIsPresentResponseNative, FPubnubChatWhoIsPresentResult());
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Limit, Offset, OnWhoIsPresentResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Limit, Offset, OnWhoIsPresentResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnWhoIsPresentResponseNative);
 		
 		FPubnubChatWhoIsPresentResult WhoIsPresentResult = WeakThis.Get()->WhoIsPresent(Limit, Offset);
 		UPubnubUtilities::CallPubnubDelegate(OnWhoIsPresentResponseNative, WhoIsPresentResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatIsPresentResult UPubnubChatChannel::IsPresent(const FString UserID)
@@ -668,7 +799,7 @@ FPubnubChatIsPresentResult UPubnubChatChannel::IsPresent(const FString UserID)
 	return Chat->IsPresent(UserID, ChannelID);
 }
 
-void UPubnubChatChannel::IsPresentAsync(const FString UserID, FOnPubnubChatIsPresentResponse OnIsPresentResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::IsPresentAsync(const FString UserID, FOnPubnubChatIsPresentResponse OnIsPresentResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatIsPresentResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnIsPresentResponse](const FPubnubChatIsPresentResult& IsPresentResult)
@@ -676,23 +807,28 @@ void UPubnubChatChannel::IsPresentAsync(const FString UserID, FOnPubnubChatIsPre
 		OnIsPresentResponse.ExecuteIfBound(IsPresentResult);
 	});
 
-	IsPresentAsync(UserID, NativeCallback);
+	return IsPresentAsync(UserID, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::IsPresentAsync(const FString UserID, FOnPubnubChatIsPresentResponseNative OnIsPresentResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::IsPresentAsync(const FString UserID, FOnPubnubChatIsPresentResponseNative OnIsPresentResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnIsPresentResponseNative, FPubnubChatIsPresentResult());
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, UserID, OnIsPresentResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, UserID, OnIsPresentResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnIsPresentResponseNative);
 		
 		FPubnubChatIsPresentResult IsPresentResult = WeakThis.Get()->IsPresent(UserID);
 		UPubnubUtilities::CallPubnubDelegate(OnIsPresentResponseNative, IsPresentResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::Delete()
@@ -703,7 +839,7 @@ FPubnubChatOperationResult UPubnubChatChannel::Delete()
 	return DeleteChannelResult;
 }
 
-void UPubnubChatChannel::DeleteAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::DeleteAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -711,23 +847,28 @@ void UPubnubChatChannel::DeleteAsync(FOnPubnubChatOperationResponse OnOperationR
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	DeleteAsync(NativeCallback);
+	return DeleteAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::DeleteAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::DeleteAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
 
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
+
 		FPubnubChatOperationResult DeleteResult = WeakThis.Get()->Delete();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, DeleteResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatMembershipsResult UPubnubChatChannel::GetMembers(const int Limit, const FString Filter, FPubnubMemberSort Sort, FPubnubPage Page)
@@ -736,7 +877,7 @@ FPubnubChatMembershipsResult UPubnubChatChannel::GetMembers(const int Limit, con
 	PUBNUB_CHAT_OBJECT_RETURN_WRAPPER_IF_NOT_INITIALIZED(FinalResult);
 	
 	//GetChannelMembers using PubnubClient
-	FPubnubChannelMembersResult GetMembersResult = PubnubClient->GetChannelMembers(ChannelID, FPubnubMemberInclude::FromValue(true), Limit, Filter, Sort, Page);
+	FPubnubChannelMembersResult GetMembersResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Read, "GetChannelMembers", FinalResult.Result, PubnubClient->GetChannelMembers(ChannelID, FPubnubMemberInclude::FromValue(true), Limit, Filter, Sort, Page));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, GetMembersResult.Result, "GetChannelMembers");
 	
 	//Create corresponding Chat objects for all returned memberships
@@ -752,7 +893,7 @@ FPubnubChatMembershipsResult UPubnubChatChannel::GetMembers(const int Limit, con
 	return FinalResult;
 }
 
-void UPubnubChatChannel::GetMembersAsync(FOnPubnubChatMembershipsResponse OnMembershipsResponse, const int Limit, const FString Filter, FPubnubMemberSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetMembersAsync(FOnPubnubChatMembershipsResponse OnMembershipsResponse, const int Limit, const FString Filter, FPubnubMemberSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	FOnPubnubChatMembershipsResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnMembershipsResponse](const FPubnubChatMembershipsResult& MembershipsResult)
@@ -760,23 +901,28 @@ void UPubnubChatChannel::GetMembersAsync(FOnPubnubChatMembershipsResponse OnMemb
 		OnMembershipsResponse.ExecuteIfBound(MembershipsResult);
 	});
 
-	GetMembersAsync(NativeCallback, Limit, Filter, Sort, Page);
+	return GetMembersAsync(NativeCallback, Limit, Filter, Sort, Page, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::GetMembersAsync(FOnPubnubChatMembershipsResponseNative OnMembershipsResponseNative, const int Limit, const FString Filter, FPubnubMemberSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetMembersAsync(FOnPubnubChatMembershipsResponseNative OnMembershipsResponseNative, const int Limit, const FString Filter, FPubnubMemberSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnMembershipsResponseNative, FPubnubChatMembershipsResult());
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnMembershipsResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnMembershipsResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnMembershipsResponseNative);
 		
 		FPubnubChatMembershipsResult MembersResult = WeakThis.Get()->GetMembers(Limit, Filter, Sort, Page);
 		UPubnubUtilities::CallPubnubDelegate(OnMembershipsResponseNative, MembersResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatMembershipResult UPubnubChatChannel::GetMember(const FString UserID)
@@ -797,7 +943,7 @@ FPubnubChatMembershipResult UPubnubChatChannel::GetMember(const FString UserID)
 	return FinalResult;
 }
 
-void UPubnubChatChannel::GetMemberAsync(const FString UserID, FOnPubnubChatMembershipResponse OnMembershipResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetMemberAsync(const FString UserID, FOnPubnubChatMembershipResponse OnMembershipResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatMembershipResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnMembershipResponse](const FPubnubChatMembershipResult& MembershipResult)
@@ -805,23 +951,28 @@ void UPubnubChatChannel::GetMemberAsync(const FString UserID, FOnPubnubChatMembe
 		OnMembershipResponse.ExecuteIfBound(MembershipResult);
 	});
 
-	GetMemberAsync(UserID, NativeCallback);
+	return GetMemberAsync(UserID, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::GetMemberAsync(const FString UserID, FOnPubnubChatMembershipResponseNative OnMembershipResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetMemberAsync(const FString UserID, FOnPubnubChatMembershipResponseNative OnMembershipResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnMembershipResponseNative, FPubnubChatMembershipResult());
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, UserID, OnMembershipResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, UserID, OnMembershipResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnMembershipResponseNative);
 		
 		FPubnubChatMembershipResult MembershipResult = WeakThis.Get()->GetMember(UserID);
 		UPubnubUtilities::CallPubnubDelegate(OnMembershipResponseNative, MembershipResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatHasMemberResult UPubnubChatChannel::HasMember(const FString UserID)
@@ -836,7 +987,7 @@ FPubnubChatHasMemberResult UPubnubChatChannel::HasMember(const FString UserID)
 	return FinalResult;
 }
 
-void UPubnubChatChannel::HasMemberAsync(const FString UserID, FOnPubnubChatHasMemberResponse OnHasMemberResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::HasMemberAsync(const FString UserID, FOnPubnubChatHasMemberResponse OnHasMemberResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatHasMemberResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnHasMemberResponse](const FPubnubChatHasMemberResult& HasMemberResult)
@@ -844,23 +995,28 @@ void UPubnubChatChannel::HasMemberAsync(const FString UserID, FOnPubnubChatHasMe
 		OnHasMemberResponse.ExecuteIfBound(HasMemberResult);
 	});
 
-	HasMemberAsync(UserID, NativeCallback);
+	return HasMemberAsync(UserID, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::HasMemberAsync(const FString UserID, FOnPubnubChatHasMemberResponseNative OnHasMemberResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::HasMemberAsync(const FString UserID, FOnPubnubChatHasMemberResponseNative OnHasMemberResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnHasMemberResponseNative, FPubnubChatHasMemberResult());
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, UserID, OnHasMemberResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, UserID, OnHasMemberResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnHasMemberResponseNative);
 		
 		FPubnubChatHasMemberResult HasMemberResult = WeakThis.Get()->HasMember(UserID);
 		UPubnubUtilities::CallPubnubDelegate(OnHasMemberResponseNative, HasMemberResult);
 	});
+
+	return AsyncHandle;
 }
 
 
@@ -880,7 +1036,7 @@ FPubnubChatMembershipsResult UPubnubChatChannel::GetInvitees(const int Limit, co
 	return GetMembers(Limit, FinalFilter, Sort, Page);
 }
 
-void UPubnubChatChannel::GetInviteesAsync(FOnPubnubChatMembershipsResponse OnMembershipsResponse, const int Limit, const FString Filter, FPubnubMemberSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetInviteesAsync(FOnPubnubChatMembershipsResponse OnMembershipsResponse, const int Limit, const FString Filter, FPubnubMemberSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	FOnPubnubChatMembershipsResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnMembershipsResponse](const FPubnubChatMembershipsResult& MembershipsResult)
@@ -888,23 +1044,28 @@ void UPubnubChatChannel::GetInviteesAsync(FOnPubnubChatMembershipsResponse OnMem
 		OnMembershipsResponse.ExecuteIfBound(MembershipsResult);
 	});
 
-	GetInviteesAsync(NativeCallback, Limit, Filter, Sort, Page);
+	return GetInviteesAsync(NativeCallback, Limit, Filter, Sort, Page, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::GetInviteesAsync(FOnPubnubChatMembershipsResponseNative OnMembershipsResponseNative, const int Limit, const FString Filter, FPubnubMemberSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetInviteesAsync(FOnPubnubChatMembershipsResponseNative OnMembershipsResponseNative, const int Limit, const FString Filter, FPubnubMemberSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnMembershipsResponseNative, FPubnubChatMembershipsResult());
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnMembershipsResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnMembershipsResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnMembershipsResponseNative);
 		
 		FPubnubChatMembershipsResult InviteesResult = WeakThis.Get()->GetInvitees(Limit, Filter, Sort, Page);
 		UPubnubUtilities::CallPubnubDelegate(OnMembershipsResponseNative, InviteesResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatFetchReadReceiptsResult UPubnubChatChannel::FetchReadReceipts(const int Limit, const FString Filter, FPubnubMemberSort Sort, FPubnubPage Page)
@@ -935,7 +1096,7 @@ FPubnubChatFetchReadReceiptsResult UPubnubChatChannel::FetchReadReceipts(const i
 	return FinalResult;
 }
 
-void UPubnubChatChannel::FetchReadReceiptsAsync(FOnPubnubChatFetchReadReceiptsResponse OnFetchReadReceiptsResponse, const int Limit, const FString Filter, FPubnubMemberSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChatChannel::FetchReadReceiptsAsync(FOnPubnubChatFetchReadReceiptsResponse OnFetchReadReceiptsResponse, const int Limit, const FString Filter, FPubnubMemberSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	FOnPubnubChatFetchReadReceiptsResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnFetchReadReceiptsResponse](const FPubnubChatFetchReadReceiptsResult& FetchReadReceiptsResult)
@@ -943,23 +1104,28 @@ void UPubnubChatChannel::FetchReadReceiptsAsync(FOnPubnubChatFetchReadReceiptsRe
 		OnFetchReadReceiptsResponse.ExecuteIfBound(FetchReadReceiptsResult);
 	});
 
-	FetchReadReceiptsAsync(NativeCallback, Limit, Filter, Sort, Page);
+	return FetchReadReceiptsAsync(NativeCallback, Limit, Filter, Sort, Page, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::FetchReadReceiptsAsync(FOnPubnubChatFetchReadReceiptsResponseNative OnFetchReadReceiptsResponseNative, const int Limit, const FString Filter, FPubnubMemberSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChatChannel::FetchReadReceiptsAsync(FOnPubnubChatFetchReadReceiptsResponseNative OnFetchReadReceiptsResponseNative, const int Limit, const FString Filter, FPubnubMemberSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnFetchReadReceiptsResponseNative, FPubnubChatFetchReadReceiptsResult());
 
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnFetchReadReceiptsResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnFetchReadReceiptsResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
 
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnFetchReadReceiptsResponseNative);
+
 		FPubnubChatFetchReadReceiptsResult FetchReadReceiptsResult = WeakThis.Get()->FetchReadReceipts(Limit, Filter, Sort, Page);
 		UPubnubUtilities::CallPubnubDelegate(OnFetchReadReceiptsResponseNative, FetchReadReceiptsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::SetRestrictions(const FString UserID, bool Ban, bool Mute, FString Reason)
@@ -970,7 +1136,7 @@ FPubnubChatOperationResult UPubnubChatChannel::SetRestrictions(const FString Use
 	return Chat->SetRestrictions(FPubnubChatRestriction({UserID, ChannelID, Ban, Mute, Reason}));
 }
 
-void UPubnubChatChannel::SetRestrictionsAsync(const FString UserID, bool Ban, bool Mute, FOnPubnubChatOperationResponse OnOperationResponse, FString Reason)
+FPubnubChatAsyncHandle UPubnubChatChannel::SetRestrictionsAsync(const FString UserID, bool Ban, bool Mute, FOnPubnubChatOperationResponse OnOperationResponse, FString Reason, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -978,23 +1144,28 @@ void UPubnubChatChannel::SetRestrictionsAsync(const FString UserID, bool Ban, bo
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	SetRestrictionsAsync(UserID, Ban, Mute, NativeCallback, Reason);
+	return SetRestrictionsAsync(UserID, Ban, Mute, NativeCallback, Reason, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::SetRestrictionsAsync(const FString UserID, bool Ban, bool Mute, FOnPubnubChatOperationResponseNative OnOperationResponseNative, FString Reason)
+FPubnubChatAsyncHandle UPubnubChatChannel::SetRestrictionsAsync(const FString UserID, bool Ban, bool Mute, FOnPubnubChatOperationResponseNative OnOperationResponseNative, FString Reason, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, UserID, Ban, Mute, Reason, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, UserID, Ban, Mute, Reason, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult SetRestrictionsResult = WeakThis.Get()->SetRestrictions(UserID, Ban, Mute, Reason);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, SetRestrictionsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatGetRestrictionResult UPubnubChatChannel::GetUserRestrictions(UPubnubChatUser* User)
@@ -1022,7 +1193,7 @@ FPubnubChatGetRestrictionResult UPubnubChatChannel::GetUserRestrictions(UPubnubC
 	return FinalResult;
 }
 
-void UPubnubChatChannel::GetUserRestrictionsAsync(UPubnubChatUser* User, FOnPubnubChatGetRestrictionResponse OnRestrictionResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetUserRestrictionsAsync(UPubnubChatUser* User, FOnPubnubChatGetRestrictionResponse OnRestrictionResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatGetRestrictionResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnRestrictionResponse](const FPubnubChatGetRestrictionResult& RestrictionResult)
@@ -1030,23 +1201,28 @@ void UPubnubChatChannel::GetUserRestrictionsAsync(UPubnubChatUser* User, FOnPubn
 		OnRestrictionResponse.ExecuteIfBound(RestrictionResult);
 	});
 
-	GetUserRestrictionsAsync(User, NativeCallback);
+	return GetUserRestrictionsAsync(User, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::GetUserRestrictionsAsync(UPubnubChatUser* User, FOnPubnubChatGetRestrictionResponseNative OnRestrictionResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetUserRestrictionsAsync(UPubnubChatUser* User, FOnPubnubChatGetRestrictionResponseNative OnRestrictionResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnRestrictionResponseNative, FPubnubChatGetRestrictionResult());
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, User, OnRestrictionResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, User, OnRestrictionResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnRestrictionResponseNative);
 		
 		FPubnubChatGetRestrictionResult RestrictionResult = WeakThis.Get()->GetUserRestrictions(User);
 		UPubnubUtilities::CallPubnubDelegate(OnRestrictionResponseNative, RestrictionResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatGetRestrictionsResult UPubnubChatChannel::GetUsersRestrictions(const int Limit, FPubnubMemberSort Sort, FPubnubPage Page)
@@ -1057,7 +1233,7 @@ FPubnubChatGetRestrictionsResult UPubnubChatChannel::GetUsersRestrictions(const
 	return GetRestrictions(Limit, "", Sort, Page);
 }
 
-void UPubnubChatChannel::GetUsersRestrictionsAsync(FOnPubnubChatGetRestrictionsResponse OnRestrictionsResponse, const int Limit, FPubnubMemberSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetUsersRestrictionsAsync(FOnPubnubChatGetRestrictionsResponse OnRestrictionsResponse, const int Limit, FPubnubMemberSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	FOnPubnubChatGetRestrictionsResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnRestrictionsResponse](const FPubnubChatGetRestrictionsResult& RestrictionsResult)
@@ -1065,23 +1241,28 @@ void UPubnubChatChannel::GetUsersRestrictionsAsync(FOnPubnubChatGetRestrictionsR
 		OnRestrictionsResponse.ExecuteIfBound(RestrictionsResult);
 	});
 
-	GetUsersRestrictionsAsync(NativeCallback, Limit, Sort, Page);
+	return GetUsersRestrictionsAsync(NativeCallback, Limit, Sort, Page, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::GetUsersRestrictionsAsync(FOnPubnubChatGetRestrictionsResponseNative OnRestrictionsResponseNative, const int Limit, FPubnubMemberSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetUsersRestrictionsAsync(FOnPubnubChatGetRestrictionsResponseNative OnRestrictionsResponseNative, const int Limit, FPubnubMemberSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnRestrictionsResponseNative, FPubnubChatGetRestrictionsResult());
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Limit, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnRestrictionsResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Limit, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnRestrictionsResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnRestrictionsResponseNative);
 		
 		FPubnubChatGetRestrictionsResult RestrictionsResult = WeakThis.Get()->GetUsersRestrictions(Limit, Sort, Page);
 		UPubnubUtilities::CallPubnubDelegate(OnRestrictionsResponseNative, RestrictionsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatGetHistoryResult UPubnubChatChannel::GetHistory(const FString StartTimetoken, const FString EndTimetoken, const int Count)
@@ -1098,7 +1279,7 @@ FPubnubChatGetHistoryResult UPubnubChatChannel::GetHistory(const FString StartTi
 	FetchHistorySettings.IncludeUserID = true;
 	FetchHistorySettings.IncludeMessageActions = true;
 	FetchHistorySettings.IncludeMeta = true;
-	FPubnubFetchHistoryResult FetchHistoryResult = PubnubClient->FetchHistory(ChannelID, FetchHistorySettings);
+	FPubnubFetchHistoryResult FetchHistoryResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Read, "FetchHistory", FinalResult.Result, PubnubClient->FetchHistory(ChannelID, FetchHistorySettings));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, FetchHistoryResult.Result, "FetchHistory");
 	
 	// Check if this Channel is a ThreadChannel, if so parse ID to get ParentChannelID
@@ -1109,22 +1290,39 @@ FPubnubChatGetHistoryResult UPubnubChatChannel::GetHistory(const FString StartTi
 		ParentChannelID = UPubnubChatInternalUtilities::GetParentChannelIDFromThreadID(ChannelID);
 	}
 	
-	for (auto& MessageData : FetchHistoryResult.Messages)
+	// Create Messages for the whole page at once, if this channel is a thread, these have to be ThreadMessages
+	if (IsThreadChannel)
 	{
-		// Create Messages, if this channel is a thread, these have to be ThreadMessages
-		UPubnubChatMessage* Message = IsThreadChannel ? Chat->CreateThreadMessageObject(MessageData.Timetoken, MessageData, ParentChannelID)
-		: Chat->CreateMessageObject(MessageData.Timetoken, MessageData);
-
-		FinalResult.Messages.Add(Message);
+		FinalResult.Messages.Append(Chat->CreateThreadMessageObjects(FetchHistoryResult.Messages, ParentChannelID));
+	}
+	else
+	{
+		FinalResult.Messages = Chat->CreateMessageObjects(FetchHistoryResult.Messages);
 	}
 	
 	//If we got the exact amount of messages as specified count, probably there are more events in a given range
 	FinalResult.IsMore = FetchHistoryResult.Messages.Num() == Count;
 	
+	//Returned messages were already written to the persistent store, remove stored ones that were deleted on the server.
+	//Server doesn't return message at StartTimetoken and a full page covers the range only down to its oldest message
+	if (Chat->PersistentStore)
+	{
+		TSet<int64> ServerTimetokens;
+		int64 OldestServerTimetoken = MAX_int64;
+		for (const FPubnubHistoryMessageData& HistoryMessage : FetchHistoryResult.Messages)
+		{
+			const int64 MessageTimetoken = UPubnubChatInternalUtilities::TimetokenToInt64(HistoryMessage.Timetoken);
+			ServerTimetokens.Add(MessageTimetoken);
+			OldestServerTimetoken = FMath::Min(OldestServerTimetoken, MessageTimetoken);
+		}
+		const int64 CoveredEndTimetoken = FinalResult.IsMore ? OldestServerTimetoken : UPubnubChatInternalUtilities::TimetokenToInt64(EndTimetoken);
+		Chat->ObjectsRepository->ReconcileStoredMessages(ChannelID, UPubnubChatInternalUtilities::TimetokenToInt64(StartTimetoken) - 1, CoveredEndTimetoken, ServerTimetokens);
+	}
+	
 	return FinalResult;
 }
 
-void UPubnubChatChannel::GetHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatGetHistoryResponse OnHistoryResponse, const int Count)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatGetHistoryResponse OnHistoryResponse, const int Count, float DeadlineSeconds)
 {
 	FOnPubnubChatGetHistoryResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnHistoryResponse](const FPubnubChatGetHistoryResult& HistoryResult)
@@ -1132,23 +1330,60 @@ void UPubnubChatChannel::GetHistoryAsync(const FString StartTimetoken, const FSt
 		OnHistoryResponse.ExecuteIfBound(HistoryResult);
 	});
 
-	GetHistoryAsync(StartTimetoken, EndTimetoken, NativeCallback, Count);
+	return GetHistoryAsync(StartTimetoken, EndTimetoken, NativeCallback, Count, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::GetHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatGetHistoryResponseNative OnHistoryResponseNative, const int Count)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatGetHistoryResponseNative OnHistoryResponseNative, const int Count, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnHistoryResponseNative, FPubnubChatGetHistoryResult());
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, StartTimetoken, EndTimetoken, Count, OnHistoryResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, StartTimetoken, EndTimetoken, Count, OnHistoryResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnHistoryResponseNative);
 		
 		FPubnubChatGetHistoryResult HistoryResult = WeakThis.Get()->GetHistory(StartTimetoken, EndTimetoken, Count);
 		UPubnubUtilities::CallPubnubDelegate(OnHistoryResponseNative, HistoryResult);
 	});
+
+	return AsyncHandle;
+}
+
+FPubnubChatGetHistoryResult UPubnubChatChannel::GetCachedHistory(const FString StartTimetoken, const FString EndTimetoken, const int Count)
+{
+	FPubnubChatGetHistoryResult FinalResult;
+	PUBNUB_CHAT_OBJECT_RETURN_WRAPPER_IF_NOT_INITIALIZED(FinalResult);
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_FIELD_EMPTY(FinalResult, StartTimetoken);
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_FIELD_EMPTY(FinalResult, EndTimetoken);
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_CONDITION_FAILED(FinalResult, Chat->PersistentStore, TEXT("Persistent store is disabled, enable it in FPubnubChatConfig::PersistentStore"));
+	
+	TArray<FString> StoredTimetokens;
+	TArray<FPubnubChatMessageData> StoredMessagesData;
+	Chat->ObjectsRepository->LoadStoredMessages(ChannelID, UPubnubChatInternalUtilities::TimetokenToInt64(StartTimetoken), UPubnubChatInternalUtilities::TimetokenToInt64(EndTimetoken), Count, StoredTimetokens, StoredMessagesData);
+	
+	// If this channel is a thread, stored messages have to be ThreadMessages
+	const bool IsThreadChannel = UPubnubChatInternalUtilities::IsChannelAThread(ChannelID);
+	const FString ParentChannelID = IsThreadChannel ? UPubnubChatInternalUtilities::GetParentChannelIDFromThreadID(ChannelID) : FString();
+	for (int32 i = 0; i < StoredTimetokens.Num(); ++i)
+	{
+		if (IsThreadChannel)
+		{
+			FinalResult.Messages.Add(Chat->GetOrCreateThreadMessageObject(ChannelID, StoredTimetokens[i], StoredMessagesData[i], ParentChannelID));
+		}
+		else
+		{
+			FinalResult.Messages.Add(Chat->GetOrCreateMessageObject(ChannelID, StoredTimetokens[i], StoredMessagesData[i]));
+		}
+	}
+	
+	FinalResult.IsMore = StoredTimetokens.Num() == Count;
+	
+	return FinalResult;
 }
 
 FPubnubChatMessageResult UPubnubChatChannel::GetMessage(const FString Timetoken)
@@ -1157,7 +1392,7 @@ FPubnubChatMessageResult UPubnubChatChannel::GetMessage(const FString Timetoken)
 	PUBNUB_CHAT_OBJECT_RETURN_WRAPPER_IF_NOT_INITIALIZED(FinalResult);
 	PUBNUB_CHAT_RETURN_WRAPPER_IF_FIELD_EMPTY(FinalResult, Timetoken);
 	
-	FString StartTimetoken = UPubnubTimetokenUtilities::AddIntToTimetoken(Timetoken, 1);
+	FString StartTimetoken = UPubnubChatInternalUtilities::AddIntToTimetoken(Timetoken, 1);
 	FPubnubChatGetHistoryResult GetHistoryResult = GetHistory(StartTimetoken, Timetoken, 1);
 	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, GetHistoryResult.Result);
 	
@@ -1169,7 +1404,7 @@ FPubnubChatMessageResult UPubnubChatChannel::GetMessage(const FString Timetoken)
 	return FinalResult;
 }
 
-void UPubnubChatChannel::GetMessageAsync(const FString Timetoken, FOnPubnubChatMessageResponse OnMessageResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetMessageAsync(const FString Timetoken, FOnPubnubChatMessageResponse OnMessageResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatMessageResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnMessageResponse](const FPubnubChatMessageResult& MessageResult)
@@ -1177,23 +1412,28 @@ void UPubnubChatChannel::GetMessageAsync(const FString Timetoken, FOnPubnubChatM
 		OnMessageResponse.ExecuteIfBound(MessageResult);
 	});
 
-	GetMessageAsync(Timetoken, NativeCallback);
+	return GetMessageAsync(Timetoken, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::GetMessageAsync(const FString Timetoken, FOnPubnubChatMessageResponseNative OnMessageResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetMessageAsync(const FString Timetoken, FOnPubnubChatMessageResponseNative OnMessageResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnMessageResponseNative, FPubnubChatMessageResult());
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Timetoken, OnMessageResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Timetoken, OnMessageResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnMessageResponseNative);
 		
 		FPubnubChatMessageResult MessageResult = WeakThis.Get()->GetMessage(Timetoken);
 		UPubnubUtilities::CallPubnubDelegate(OnMessageResponseNative, MessageResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::ForwardMessage(UPubnubChatMessage* Message)
@@ -1204,7 +1444,7 @@ FPubnubChatOperationResult UPubnubChatChannel::ForwardMessage(UPubnubChatMessage
 	return Chat->ForwardMessage(Message, this);
 }
 
-void UPubnubChatChannel::ForwardMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::ForwardMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1212,23 +1452,28 @@ void UPubnubChatChannel::ForwardMessageAsync(UPubnubChatMessage* Message, FOnPub
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	ForwardMessageAsync(Message, NativeCallback);
+	return ForwardMessageAsync(Message, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::ForwardMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::ForwardMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Message, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Message, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult ForwardResult = WeakThis.Get()->ForwardMessage(Message);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, ForwardResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::EmitCustomEvent(FString Payload, FString Type, bool StoreInHistory)
@@ -1245,13 +1490,13 @@ FPubnubChatOperationResult UPubnubChatChannel::EmitCustomEvent(FString Payload,
 	UPubnubJsonUtilities::StringToJsonObject(Payload, JsonObject);
 	JsonObject->SetStringField(ANSI_TO_TCHAR("type"), ANSI_TO_TCHAR("custom"));
 
-	FPubnubPublishMessageResult PublishResult = PubnubClient->PublishMessage(ChannelID, UPubnubJsonUtilities::JsonObjectToString(JsonObject), PublishSettings);
 	FPubnubChatOperationResult FinalResult;
+	FPubnubPublishMessageResult PublishResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Publish, "PublishMessage", FinalResult, PubnubClient->PublishMessage(ChannelID, UPubnubJsonUtilities::JsonObjectToString(JsonObject), PublishSettings));
 	FinalResult.AddStep("PublishMessage", PublishResult.Result);
 	return FinalResult;
 }
 
-void UPubnubChatChannel::EmitCustomEventAsync(FString Payload, FOnPubnubChatOperationResponse OnOperationResponse, FString Type, bool StoreInHistory)
+FPubnubChatAsyncHandle UPubnubChatChannel::EmitCustomEventAsync(FString Payload, FOnPubnubChatOperationResponse OnOperationResponse, FString Type, bool StoreInHistory, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1259,23 +1504,28 @@ void UPubnubChatChannel::EmitCustomEventAsync(FString Payload, FOnPubnubChatOper
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	EmitCustomEventAsync(Payload, NativeCallback, Type, StoreInHistory);
+	return EmitCustomEventAsync(Payload, NativeCallback, Type, StoreInHistory, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::EmitCustomEventAsync(FString Payload, FOnPubnubChatOperationResponseNative OnOperationResponseNative, FString Type, bool StoreInHistory)
+FPubnubChatAsyncHandle UPubnubChatChannel::EmitCustomEventAsync(FString Payload, FOnPubnubChatOperationResponseNative OnOperationResponseNative, FString Type, bool StoreInHistory, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Payload = MoveTemp(Payload), OnOperationResponseNative, Type = MoveTemp(Type), StoreInHistory]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Payload = MoveTemp(Payload), OnOperationResponseNative, Type = MoveTemp(Type), StoreInHistory]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult EmitResult = WeakThis.Get()->EmitCustomEvent(Payload, Type, StoreInHistory);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, EmitResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::EmitUserMention(const FString UserID, const FString Timetoken, const FString Text)
@@ -1289,7 +1539,7 @@ FPubnubChatOperationResult UPubnubChatChannel::EmitUserMention(const FString Use
 	return Chat->EmitChatEvent(EPubnubChatEventType::PCET_Mention, UserID, EventPayload);
 }
 
-void UPubnubChatChannel::EmitUserMentionAsync(const FString UserID, const FString Timetoken, const FString Text, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::EmitUserMentionAsync(const FString UserID, const FString Timetoken, const FString Text, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1297,23 +1547,28 @@ void UPubnubChatChannel::EmitUserMentionAsync(const FString UserID, const FStrin
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	EmitUserMentionAsync(UserID, Timetoken, Text, NativeCallback);
+	return EmitUserMentionAsync(UserID, Timetoken, Text, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::EmitUserMentionAsync(const FString UserID, const FString Timetoken, const FString Text, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::EmitUserMentionAsync(const FString UserID, const FString Timetoken, const FString Text, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, UserID, Timetoken, Text, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, UserID, Timetoken, Text, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult EmitResult = WeakThis.Get()->EmitUserMention(UserID, Timetoken, Text);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, EmitResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::StreamUpdates()
@@ -1338,34 +1593,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StreamUpdates()
 		if(!ThisChannel->IsInitialized || !ThisChannel->Chat || !ThisChannel->IsStreamingUpdates)
 		{return;}
 		
-		//If this is not ChannelUpdate, just ignore this message
-		if (UPubnubChatInternalUtilities::IsPubnubMessageChannelUpdate(MessageData.Message))
-		{
-			//Check if channel was deleted or updated
-			if (UPubnubChatInternalUtilities::IsPubnubMessageDeleteEvent(MessageData.Message))
-			{
-				//Remove this channel from repository
-				ThisChannel->Chat->ObjectsRepository->RemoveChannelData(ThisChannel->ChannelID);
-				
-				//Call OnDeleted delegates
-				ThisChannel->OnDeleted.Broadcast();
-				ThisChannel->OnDeletedNative.Broadcast();
-			}
-			else
-			{
-				//Adjust this channel data based on the update message
-				FPubnubChatChannelData ChatChannelData = ThisChannel->GetChannelData();
-				FPubnubChannelUpdateData ChannelUpdateData = UPubnubJsonUtilities::GetChannelUpdateDataFromMessageContent(MessageData.Message);
-				UPubnubChatInternalUtilities::UpdateChatChannelFromPubnubChannelUpdateData(ChannelUpdateData, ChatChannelData);
-							
-				//Update repository with new channel data
-				ThisChannel->Chat->ObjectsRepository->UpdateChannelData(ThisChannel->ChannelID, ChatChannelData);
-							
-				//Call OnUpdated delegates with new channel data
-				ThisChannel->OnUpdated.Broadcast(ThisChannel->ChannelID, ChatChannelData);
-				ThisChannel->OnUpdatedNative.Broadcast(ThisChannel->ChannelID, ChatChannelData);
-			}
-		}
+		ThisChannel->HandleUpdatesEvent(MessageData);
 	});
 	
 	FPubnubOperationResult SubscribeResult = UpdatesSubscription->Subscribe();
@@ -1381,7 +1609,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StreamUpdates()
 	return FinalResult;
 }
 
-void UPubnubChatChannel::StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1389,23 +1617,28 @@ void UPubnubChatChannel::StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOpe
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StreamUpdatesAsync(NativeCallback);
+	return StreamUpdatesAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::StreamUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::StreamUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StreamUpdatesResult = WeakThis.Get()->StreamUpdates();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StreamUpdatesResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::StreamUpdatesOn(const TArray<UPubnubChatChannel*>& Channels)
@@ -1420,11 +1653,107 @@ FPubnubChatOperationResult UPubnubChatChannel::StreamUpdatesOn(const TArray<UPub
 	return FinalResult;
 }
 
+FPubnubChatListenForEventsResult UPubnubChatChannel::StartUpdatesStreamOn(const TArray<UPubnubChatChannel*>& Channels, FOnPubnubChatChannelsUpdated OnChannelsUpdated)
+{
+	FOnPubnubChatChannelsUpdatedNative NativeCallback;
+	NativeCallback.BindLambda([OnChannelsUpdated](const TArray<UPubnubChatChannel*>& UpdatedChannels)
+	{
+		OnChannelsUpdated.ExecuteIfBound(UpdatedChannels);
+	});
+	
+	return StartUpdatesStreamOn(Channels, NativeCallback);
+}
+
+FPubnubChatListenForEventsResult UPubnubChatChannel::StartUpdatesStreamOn(const TArray<UPubnubChatChannel*>& Channels, FOnPubnubChatChannelsUpdatedNative OnChannelsUpdatedNative)
+{
+	FPubnubChatListenForEventsResult FinalResult;
+	
+	//Nothing to stream on
+	if (Channels.IsEmpty())
+	{ return FinalResult; }
+	
+	//Skip channels that can't stream updates, all others share one stream of the first valid channel's Chat
+	TArray<UPubnubChatChannel*> ValidChannels;
+	for (UPubnubChatChannel* Channel : Channels)
+	{
+		if (!Channel || !Channel->IsInitialized || !Channel->Chat || !Channel->PubnubClient)
+		{
+			//Not initialized object is reported as error, but doesn't stop streaming on all others
+			FString ErrorLogMessage = FString::Printf(TEXT("[%s]: Skipping channel that is not initialized."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__)));
+			UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage);
+			FinalResult.Result.Merge(FPubnubChatOperationResult::CreateError(ErrorLogMessage));
+			continue;
+		}
+		if (!ValidChannels.IsEmpty() && Channel->Chat != ValidChannels[0]->Chat)
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("[%s]: Skipping channel %s that belongs to a different Chat."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__)), *Channel->ChannelID);
+			continue;
+		}
+		ValidChannels.Add(Channel);
+	}
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_CONDITION_FAILED(FinalResult, !ValidChannels.IsEmpty(), TEXT("None of given channels is initialized"));
+	
+	UPubnubChatUpdatesStream* UpdatesStream = ValidChannels[0]->Chat->CreateUpdatesStream();
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_CONDITION_FAILED(FinalResult, UpdatesStream, TEXT("Failed to create UpdatesStream"));
+	
+	//Channel updates are published on the channel itself, so ChannelID is both the routing and subscribed ID
+	auto GetRoutingID = [](const FPubnubMessageData& MessageData)
+	{
+		return MessageData.Channel;
+	};
+	auto ApplyUpdate = [](UObject* Object, const FPubnubMessageData& MessageData)
+	{
+		UPubnubChatChannel* Channel = Cast<UPubnubChatChannel>(Object);
+		if (!Channel || !Channel->IsInitialized || !Channel->Chat)
+		{ return false; }
+		
+		//Channel that streams updates on its own already applied this event through its UpdatesSubscription
+		if (Channel->IsStreamingUpdates)
+		{ return UPubnubChatInternalUtilities::IsPubnubMessageChannelUpdate(MessageData.Message); }
+		
+		return Channel->HandleUpdatesEvent(MessageData);
+	};
+	auto OnUpdatesBatch = [OnChannelsUpdatedNative](const TArray<UObject*>& Objects)
+	{
+		TArray<UPubnubChatChannel*> UpdatedChannels;
+		UpdatedChannels.Reserve(Objects.Num());
+		for (UObject* Object : Objects)
+		{
+			if (UPubnubChatChannel* Channel = Cast<UPubnubChatChannel>(Object))
+			{
+				UpdatedChannels.Add(Channel);
+			}
+		}
+		OnChannelsUpdatedNative.ExecuteIfBound(UpdatedChannels);
+	};
+	UpdatesStream->InitUpdatesStream(ValidChannels[0]->Chat, false, GetRoutingID, ApplyUpdate, OnUpdatesBatch);
+	
+	for (UPubnubChatChannel* Channel : ValidChannels)
+	{
+		UpdatesStream->AddObject(Channel->ChannelID, Channel->ChannelID, Channel);
+	}
+	
+	FPubnubChatOperationResult StartResult = UpdatesStream->Start();
+	FinalResult.Result.Merge(StartResult);
+	if (StartResult.Error)
+	{
+		UpdatesStream->Stop();
+		return FinalResult;
+	}
+	
+	FinalResult.CallbackStop = UpdatesStream->CreateCallbackStop();
+	
+	return FinalResult;
+}
+
 FPubnubChatOperationResult UPubnubChatChannel::StopStreamingUpdates()
 {
 	PUBNUB_CHAT_OBJECT_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
 	FPubnubChatOperationResult FinalResult;
 
+	//Stop routing updates from streams started with StartUpdatesStreamOn, streams without any channel left are stopped
+	FinalResult.Merge(Chat->RemoveFromUpdatesStreams(this));
+
 	//Remove message related delegates
 	UpdatesSubscription->OnPubnubObjectEventNative.Clear();
 	
@@ -1439,7 +1768,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StopStreamingUpdates()
 	return FinalResult;
 }
 
-void UPubnubChatChannel::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1447,23 +1776,28 @@ void UPubnubChatChannel::StopStreamingUpdatesAsync(FOnPubnubChatOperationRespons
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StopStreamingUpdatesAsync(NativeCallback);
+	return StopStreamingUpdatesAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StopResult = WeakThis.Get()->StopStreamingUpdates();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StopResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::StreamPresence()
@@ -1481,7 +1815,10 @@ FPubnubChatOperationResult UPubnubChatChannel::StreamPresence()
 	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, WhoIsPresentResult.Result);
 	
 	//Save currently present users
-	StreamPresenceUserIDs = WhoIsPresentResult.Users;
+	{
+		FScopeLock Lock(&StreamPresenceCriticalSection);
+		StreamPresenceUserIDs = WhoIsPresentResult.Users;
+	}
 	
 	TWeakObjectPtr<UPubnubChatChannel> ThisWeak = MakeWeakObjectPtr(this);
 	
@@ -1495,9 +1832,13 @@ FPubnubChatOperationResult UPubnubChatChannel::StreamPresence()
 		if(!ThisChannel->IsInitialized || !ThisChannel->Chat || !ThisChannel->IsStreamingPresence)
 		{return;}
 		
-		UPubnubChatInternalUtilities::UpdateUserIDByPresenceEvent(ThisChannel->StreamPresenceUserIDs, Message.Message);
-		ThisChannel->OnPresenceChanged.Broadcast(ThisChannel->StreamPresenceUserIDs);
-		ThisChannel->OnPresenceChangedNative.Broadcast(ThisChannel->StreamPresenceUserIDs);
+		TArray<FString> PresentUserIDs;
+		{
+			FScopeLock Lock(&ThisChannel->StreamPresenceCriticalSection);
+			UPubnubChatInternalUtilities::UpdateUserIDByPresenceEvent(ThisChannel->StreamPresenceUserIDs, Message.Message);
+			PresentUserIDs = ThisChannel->StreamPresenceUserIDs;
+		}
+		ThisChannel->DispatchPresenceChanged(PresentUserIDs);
 	});
 
 	FPubnubOperationResult SubscribeResult = PresenceSubscription->Subscribe();
@@ -1505,6 +1846,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StreamPresence()
 	if (SubscribeResult.Error)
 	{
 		PresenceSubscription->OnPubnubPresenceEventNative.Clear();
+		FScopeLock Lock(&StreamPresenceCriticalSection);
 		StreamPresenceUserIDs.Empty();
 		return FinalResult;
 	}
@@ -1513,7 +1855,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StreamPresence()
 	return FinalResult;
 }
 
-void UPubnubChatChannel::StreamPresenceAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::StreamPresenceAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1521,23 +1863,28 @@ void UPubnubChatChannel::StreamPresenceAsync(FOnPubnubChatOperationResponse OnOp
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StreamPresenceAsync(NativeCallback);
+	return StreamPresenceAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::StreamPresenceAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::StreamPresenceAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StreamPresenceResult = WeakThis.Get()->StreamPresence();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StreamPresenceResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::StopStreamingPresence()
@@ -1559,7 +1906,10 @@ FPubnubChatOperationResult UPubnubChatChannel::StopStreamingPresence()
 	{ return FinalResult; }
 	
 	// Removed cached PresentUsers 
-	StreamPresenceUserIDs.Empty();
+	{
+		FScopeLock Lock(&StreamPresenceCriticalSection);
+		StreamPresenceUserIDs.Empty();
+	}
 
 	//Unsubscribe and return result
 	FPubnubOperationResult UnsubscribeResult = PresenceSubscription->Unsubscribe();
@@ -1568,7 +1918,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StopStreamingPresence()
 	return FinalResult;
 }
 
-void UPubnubChatChannel::StopStreamingPresenceAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::StopStreamingPresenceAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1576,23 +1926,28 @@ void UPubnubChatChannel::StopStreamingPresenceAsync(FOnPubnubChatOperationRespon
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StopStreamingPresenceAsync(NativeCallback);
+	return StopStreamingPresenceAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::StopStreamingPresenceAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::StopStreamingPresenceAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StopResult = WeakThis.Get()->StopStreamingPresence();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StopResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::StartTyping()
@@ -1621,7 +1976,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StartTyping()
 	return FinalResult;
 }
 
-void UPubnubChatChannel::StartTypingAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::StartTypingAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1629,23 +1984,28 @@ void UPubnubChatChannel::StartTypingAsync(FOnPubnubChatOperationResponse OnOpera
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StartTypingAsync(NativeCallback);
+	return StartTypingAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::StartTypingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::StartTypingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StartTypingResult = WeakThis.Get()->StartTyping();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StartTypingResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::StopTyping()
@@ -1676,7 +2036,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StopTyping()
 	return FinalResult;
 }
 
-void UPubnubChatChannel::StopTypingAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::StopTypingAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1684,23 +2044,28 @@ void UPubnubChatChannel::StopTypingAsync(FOnPubnubChatOperationResponse OnOperat
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StopTypingAsync(NativeCallback);
+	return StopTypingAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::StopTypingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::StopTypingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StopTypingResult = WeakThis.Get()->StopTyping();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StopTypingResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::StreamTyping()
@@ -1784,8 +2149,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StreamTyping()
 					} //Lock released here
 					
 					//Broadcast updated typing users list (Fix #2: Broadcast delegates when timer expires)
-					ThisChannel->OnTypingChanged.Broadcast(TypingUsersList);
-					ThisChannel->OnTypingChangedNative.Broadcast(TypingUsersList);
+					ThisChannel->DispatchTypingChanged(TypingUsersList);
 				});
 				FTimerHandle TimerHandle;
 				float TimerDelay = ThisChannel->Chat->ChatConfig.TypingTimeout + 10.0f; // Add 10 MS to be sure that it will really expire
@@ -1800,8 +2164,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StreamTyping()
 		} //Lock released here
 		
 		//Call delegates with typing users (outside of lock)
-		ThisChannel->OnTypingChanged.Broadcast(TypingUsers);
-		ThisChannel->OnTypingChangedNative.Broadcast(TypingUsers);
+		ThisChannel->DispatchTypingChanged(TypingUsers);
 	});
 	
 	FPubnubChatListenForEventsResult ListenForEventsResult = Chat->ListenForEvents(ChannelID, EPubnubChatEventType::PCET_Typing, OnEventReceived);
@@ -1813,7 +2176,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StreamTyping()
 	return FinalResult;
 }
 
-void UPubnubChatChannel::StreamTypingAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::StreamTypingAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1821,23 +2184,28 @@ void UPubnubChatChannel::StreamTypingAsync(FOnPubnubChatOperationResponse OnOper
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StreamTypingAsync(NativeCallback);
+	return StreamTypingAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::StreamTypingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::StreamTypingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StreamTypingResult = WeakThis.Get()->StreamTyping();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StreamTypingResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::StopStreamingTyping()
@@ -1860,7 +2228,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StopStreamingTyping()
 	return FinalResult;
 }
 
-void UPubnubChatChannel::StopStreamingTypingAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::StopStreamingTypingAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1868,23 +2236,28 @@ void UPubnubChatChannel::StopStreamingTypingAsync(FOnPubnubChatOperationResponse
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StopStreamingTypingAsync(NativeCallback);
+	return StopStreamingTypingAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::StopStreamingTypingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::StopStreamingTypingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StopTypingResult = WeakThis.Get()->StopStreamingTyping();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StopTypingResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::StreamReadReceipts()
@@ -1912,19 +2285,20 @@ FPubnubChatOperationResult UPubnubChatChannel::StreamReadReceipts()
 		FPubnubChatReadReceipt ReadReceipt;
 		ReadReceipt.UserID = Event.UserID;
 
-		TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-		if (!UPubnubJsonUtilities::StringToJsonObject(Event.Payload, JsonObject))
+		if (!FPubnubChatJsonReader::TryGetStringField(Event.Payload, TEXT("messageTimetoken"), ReadReceipt.LastReadTimetoken))
 		{
 			return;
 		}
 
-		if (!JsonObject->TryGetStringField(ANSI_TO_TCHAR("messageTimetoken"), ReadReceipt.LastReadTimetoken))
+		//Only the newest pending receipt of every user is delivered
+		ThisChannel->Chat->DispatchEvent(ThisChannel, [ThisWeak, ReadReceipt]()
 		{
-			return;
-		}
-
-		ThisChannel->OnReadReceiptReceived.Broadcast(ReadReceipt);
-		ThisChannel->OnReadReceiptReceivedNative.Broadcast(ReadReceipt);
+			if(!ThisWeak.IsValid() || !ThisWeak->IsStreamingReadReceipts)
+			{return;}
+			
+			ThisWeak->OnReadReceiptReceived.Broadcast(ReadReceipt);
+			ThisWeak->OnReadReceiptReceivedNative.Broadcast(ReadReceipt);
+		}, Pubnub_Chat_Dispatch_Read_Receipt_Key_Prefix + ReadReceipt.UserID);
 	});
 
 	FPubnubChatListenForEventsResult ListenForEventsResult = Chat->ListenForEvents(ChannelID, EPubnubChatEventType::PCET_Receipt, OnEventReceived);
@@ -1937,7 +2311,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StreamReadReceipts()
 	return FinalResult;
 }
 
-void UPubnubChatChannel::StreamReadReceiptsAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::StreamReadReceiptsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1945,23 +2319,28 @@ void UPubnubChatChannel::StreamReadReceiptsAsync(FOnPubnubChatOperationResponse
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StreamReadReceiptsAsync(NativeCallback);
+	return StreamReadReceiptsAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::StreamReadReceiptsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::StreamReadReceiptsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StreamReadReceiptsResult = WeakThis.Get()->StreamReadReceipts();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StreamReadReceiptsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::StopStreamingReadReceipts()
@@ -1987,7 +2366,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StopStreamingReadReceipts()
 	return FinalResult;
 }
 
-void UPubnubChatChannel::StopStreamingReadReceiptsAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::StopStreamingReadReceiptsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -1995,23 +2374,28 @@ void UPubnubChatChannel::StopStreamingReadReceiptsAsync(FOnPubnubChatOperationRe
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StopStreamingReadReceiptsAsync(NativeCallback);
+	return StopStreamingReadReceiptsAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::StopStreamingReadReceiptsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::StopStreamingReadReceiptsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StopReadReceiptsResult = WeakThis.Get()->StopStreamingReadReceipts();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StopReadReceiptsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::StreamMessageReports()
@@ -2051,7 +2435,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StreamMessageReports()
 	return FinalResult;
 }
 
-void UPubnubChatChannel::StreamMessageReportsAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::StreamMessageReportsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -2059,23 +2443,28 @@ void UPubnubChatChannel::StreamMessageReportsAsync(FOnPubnubChatOperationRespons
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StreamMessageReportsAsync(NativeCallback);
+	return StreamMessageReportsAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::StreamMessageReportsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::StreamMessageReportsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StreamMessageReportsResult = WeakThis.Get()->StreamMessageReports();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StreamMessageReportsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::StopStreamingMessageReports()
@@ -2098,7 +2487,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StopStreamingMessageReports()
 	return FinalResult;
 }
 
-void UPubnubChatChannel::StopStreamingMessageReportsAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::StopStreamingMessageReportsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -2106,23 +2495,28 @@ void UPubnubChatChannel::StopStreamingMessageReportsAsync(FOnPubnubChatOperation
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StopStreamingMessageReportsAsync(NativeCallback);
+	return StopStreamingMessageReportsAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::StopStreamingMessageReportsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::StopStreamingMessageReportsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StopMessageReportsResult = WeakThis.Get()->StopStreamingMessageReports();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StopMessageReportsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatEventsResult UPubnubChatChannel::GetMessageReportsHistory(const FString StartTimetoken, const FString EndTimetoken, const int Count)
@@ -2136,7 +2530,7 @@ FPubnubChatEventsResult UPubnubChatChannel::GetMessageReportsHistory(const FStri
 	return Chat->GetEventsHistory(ModerationChannelID, StartTimetoken, EndTimetoken, Count);
 }
 
-void UPubnubChatChannel::GetMessageReportsHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatEventsResponse OnEventsResponse, const int Count)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetMessageReportsHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatEventsResponse OnEventsResponse, const int Count, float DeadlineSeconds)
 {
 	FOnPubnubChatEventsResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnEventsResponse](const FPubnubChatEventsResult& EventsResult)
@@ -2144,23 +2538,28 @@ void UPubnubChatChannel::GetMessageReportsHistoryAsync(const FString StartTimeto
 		OnEventsResponse.ExecuteIfBound(EventsResult);
 	});
 
-	GetMessageReportsHistoryAsync(StartTimetoken, EndTimetoken, NativeCallback, Count);
+	return GetMessageReportsHistoryAsync(StartTimetoken, EndTimetoken, NativeCallback, Count, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::GetMessageReportsHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatEventsResponseNative OnEventsResponseNative, const int Count)
+FPubnubChatAsyncHandle UPubnubChatChannel::GetMessageReportsHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatEventsResponseNative OnEventsResponseNative, const int Count, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnEventsResponseNative, FPubnubChatEventsResult());
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, StartTimetoken, EndTimetoken, Count, OnEventsResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, StartTimetoken, EndTimetoken, Count, OnEventsResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnEventsResponseNative);
 		
 		FPubnubChatEventsResult EventsResult = WeakThis.Get()->GetMessageReportsHistory(StartTimetoken, EndTimetoken, Count);
 		UPubnubUtilities::CallPubnubDelegate(OnEventsResponseNative, EventsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::StreamCustomEvents()
@@ -2214,7 +2613,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StreamCustomEvents()
 	return FinalResult;
 }
 
-void UPubnubChatChannel::StreamCustomEventsAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::StreamCustomEventsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -2222,23 +2621,28 @@ void UPubnubChatChannel::StreamCustomEventsAsync(FOnPubnubChatOperationResponse
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StreamCustomEventsAsync(NativeCallback);
+	return StreamCustomEventsAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::StreamCustomEventsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::StreamCustomEventsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StreamCustomEventsResult = WeakThis.Get()->StreamCustomEvents();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StreamCustomEventsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatChannel::StopStreamingCustomEvents()
@@ -2265,7 +2669,7 @@ FPubnubChatOperationResult UPubnubChatChannel::StopStreamingCustomEvents()
 	return FinalResult;
 }
 
-void UPubnubChatChannel::StopStreamingCustomEventsAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatChannel::StopStreamingCustomEventsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -2273,23 +2677,28 @@ void UPubnubChatChannel::StopStreamingCustomEventsAsync(FOnPubnubChatOperationRe
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StopStreamingCustomEventsAsync(NativeCallback);
+	return StopStreamingCustomEventsAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatChannel::StopStreamingCustomEventsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatChannel::StopStreamingCustomEventsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StopCustomEventsResult = WeakThis.Get()->StopStreamingCustomEvents();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StopCustomEventsResult);
 	});
+
+	return AsyncHandle;
 }
 
 UPubnubChatMessageDraft* UPubnubChatChannel::CreateMessageDraft(FPubnubChatMessageDraftConfig MessageDraftConfig)
@@ -2302,6 +2711,41 @@ UPubnubChatMessageDraft* UPubnubChatChannel::CreateMessageDraft(FPubnubChatMessa
 	return MessageDraft;
 }
 
+bool UPubnubChatChannel::HandleUpdatesEvent(const FPubnubMessageData& MessageData)
+{
+	//If this is not ChannelUpdate, just ignore this message
+	if (!UPubnubChatInternalUtilities::IsPubnubMessageChannelUpdate(MessageData.Message))
+	{ return false; }
+	
+	//Check if channel was deleted or updated
+	if (UPubnubChatInternalUtilities::IsPubnubMessageDeleteEvent(MessageData.Message))
+	{
+		//Remove this channel from repository
+		Chat->ObjectsRepository->RemoveChannelData(ChannelID);
+		
+		//Call OnDeleted delegates
+		OnDeleted.Broadcast();
+		OnDeletedNative.Broadcast();
+	}
+	else
+	{
+		//Adjust this channel data based on the update message
+		FPubnubChatChannelData ChatChannelData = GetChannelData();
+		FPubnubChannelUpdateData ChannelUpdateData = UPubnubJsonUtilities::GetChannelUpdateDataFromMessageContent(MessageData.Message);
+		UPubnubChatInternalUtilities::UpdateChatChannelFromPubnubChannelUpdateData(ChannelUpdateData, ChatChannelData);
+					
+		//Update repository with new channel data, skip the event if repository already has newer data
+		if (!Chat->ObjectsRepository->UpdateChannelData(ChannelID, ChatChannelData, UPubnubChatInternalUtilities::GetObjectsEventServerUpdated(MessageData.Message)))
+		{ return false; }
+					
+		//Call OnUpdated delegates with new channel data
+		OnUpdated.Broadcast(ChannelID, ChatChannelData);
+		OnUpdatedNative.Broadcast(ChannelID, ChatChannelData);
+	}
+	
+	return true;
+}
+
 void UPubnubChatChannel::InitChannel(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString InChannelID)
 {
 	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InPubnubClient, TEXT("Can't init Channel, PubnubClient is invalid"));
@@ -2337,6 +2781,7 @@ void UPubnubChatChannel::InitChannel(UPubnubClient* InPubnubClient, UPubnubChat*
 	
 	//Add delegate to OnChatDestroyed to this object is cleaned up as well
 	Chat->OnChatDestroyed.AddDynamic(this, &UPubnubChatChannel::OnChatDestroyed);
+	Chat->OnUnreadMessagesCountChangedNative.AddUObject(this, &UPubnubChatChannel::OnChatUnreadMessagesCountChanged);
 	
 	IsInitialized = true;
 }
@@ -2350,7 +2795,7 @@ FPubnubChatGetRestrictionsResult UPubnubChatChannel::GetRestrictions(const int L
 	FPubnubMemberInclude Include;
 	Include.IncludeCustom = true;
 	Include.IncludeTotalCount = true;
-	FPubnubChannelMembersResult GetMembersResult = PubnubClient->GetChannelMembers(ModerationChannelID, Include, Limit, Filter, Sort, Page);
+	FPubnubChannelMembersResult GetMembersResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Read, "GetChannelMembers", FinalResult.Result, PubnubClient->GetChannelMembers(ModerationChannelID, Include, Limit, Filter, Sort, Page));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, GetMembersResult.Result, "GetChannelMembers");
 	
 	//Convert Custom fields to Restrictions
@@ -2368,9 +2813,30 @@ FPubnubChatGetRestrictionsResult UPubnubChatChannel::GetRestrictions(const int L
 	return FinalResult;
 }
 
-FPubnubChatOperationResult UPubnubChatChannel::SendTextInternal(const FString Message, FPubnubChatSendTextParams SendTextParams, UPubnubChatMessage* QuotedMessage, TMap<FString,FString> MentionedUsers)
+FPubnubChatOperationResult UPubnubChatChannel::SendTextInternal(const FString Message, FPubnubChatSendTextParams SendTextParams, UPubnubChatMessage* QuotedMessage, TMap<FString,FString> MentionedUsers, const FString& LocalEchoID)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
+	
+	//Local echo is created before the rate limiter delay and the publish, so the message is shown right away
+	FString ClientMessageID = LocalEchoID;
+	if (ClientMessageID.IsEmpty() && SendTextParams.LocalEcho && !Message.IsEmpty())
+	{
+		ClientMessageID = CreateLocalEcho(Message, SendTextParams, QuotedMessage, MentionedUsers);
+	}
+	
+	FPubnubChatOperationResult FinalResult = PublishText(Message, SendTextParams, QuotedMessage, MentionedUsers, ClientMessageID);
+	
+	//Local echo that was already confirmed stays sent even if a later step (e.g. mention event) failed
+	if (FinalResult.Error && !ClientMessageID.IsEmpty())
+	{
+		FailLocalEcho(ClientMessageID);
+	}
+	
+	return FinalResult;
+}
+
+FPubnubChatOperationResult UPubnubChatChannel::PublishText(const FString& Message, const FPubnubChatSendTextParams& SendTextParams, UPubnubChatMessage* QuotedMessage, const TMap<FString,FString>& MentionedUsers, const FString& LocalEchoID)
+{
 	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(Message);
 	FPubnubChatOperationResult FinalResult;
 	
@@ -2381,6 +2847,28 @@ FPubnubChatOperationResult UPubnubChatChannel::SendTextInternal(const FString Me
 		PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED((!QuotedMessage->GetMessageTimetoken().IsEmpty()), TEXT("Quoted message has empty invalid timetoken"));
 	}
 
+	//Sending a message counts as user activity
+	Chat->ReportUserActivity();
+
+	//While offline, message is queued in the outbox. Its local echo stays pending until the outbox publishes it
+	if (Chat->Outbox && Chat->Outbox->ShouldQueue(ChannelID))
+	{
+		FPubnubChatInternalOutboxEntry OutboxEntry;
+		OutboxEntry.EntryID = LocalEchoID.IsEmpty() ? FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower) : LocalEchoID;
+		OutboxEntry.Operation = EPubnubChatOutboxOperation::PCOO_SendText;
+		OutboxEntry.ChannelID = ChannelID;
+		OutboxEntry.Text = Message;
+		OutboxEntry.Meta = UPubnubChatInternalUtilities::AddClientMessageIDToMeta(UPubnubChatInternalUtilities::SendTextMetaFromParams(SendTextParams, QuotedMessage), OutboxEntry.EntryID);
+		OutboxEntry.StoreInHistory = SendTextParams.StoreInHistory;
+		OutboxEntry.SendByPost = SendTextParams.SendByPost;
+		OutboxEntry.MentionedUsers = MentionedUsers;
+		if (UPubnubChatThreadChannel* ThreadChannel = Cast<UPubnubChatThreadChannel>(this))
+		{
+			OutboxEntry.ParentChannelID = ThreadChannel->GetParentChannelID();
+		}
+		return Chat->Outbox->Enqueue(OutboxEntry, this);
+	}
+
 	//Calculate if SendText should be delayed by the RateLimiter
 	float DelaySeconds = CalculateSendTextRateLimiterDelay();
 	if (DelaySeconds > 0.0f)
@@ -2391,15 +2879,25 @@ FPubnubChatOperationResult UPubnubChatChannel::SendTextInternal(const FString Me
 	//Configure settings specified in the params
 	FPubnubPublishSettings PublishSettings;
 	PublishSettings.MetaData = UPubnubChatInternalUtilities::SendTextMetaFromParams(SendTextParams, QuotedMessage);
+	if (!LocalEchoID.IsEmpty())
+	{
+		//Client generated ID lets the channel recognize the server echo of its local echo
+		PublishSettings.MetaData = UPubnubChatInternalUtilities::AddClientMessageIDToMeta(PublishSettings.MetaData, LocalEchoID);
+	}
 	PublishSettings.StoreInHistory = SendTextParams.StoreInHistory;
 	if(SendTextParams.SendByPost)
 	{
 		PublishSettings.PublishMethod = EPubnubPublishMethod::PPM_SendViaPOST;
 	}
 
-	FPubnubPublishMessageResult PublishResult = PubnubClient->PublishMessage(ChannelID, UPubnubChatInternalUtilities::ChatMessageToPublishString(Message), PublishSettings);
+	FPubnubPublishMessageResult PublishResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Publish, "PublishMessage", FinalResult, PubnubClient->PublishMessage(ChannelID, UPubnubChatInternalUtilities::ChatMessageToPublishString(Message), PublishSettings));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, PublishResult.Result, "PublishMessage");
 
+	if (!LocalEchoID.IsEmpty())
+	{
+		ConfirmLocalEcho(LocalEchoID, PublishResult.PublishedMessage.Timetoken);
+	}
+
 	//Update RateLimiter state after successful send
 	{
 		FScopeLock Lock(&SendTextRateLimitCriticalSection);
@@ -2419,6 +2917,190 @@ FPubnubChatOperationResult UPubnubChatChannel::SendTextInternal(const FString Me
 	return FinalResult;
 }
 
+FString UPubnubChatChannel::CreateLocalEcho(const FString& Message, const FPubnubChatSendTextParams& SendTextParams, UPubnubChatMessage* QuotedMessage, const TMap<FString,FString>& MentionedUsers)
+{
+	//Local echo is delivered through OnMessageReceived, so there is no one to show it to when not connected
+	if (!IsInitialized || !IsConnected || !Chat)
+	{ return ""; }
+	
+	const FString ClientMessageID = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower);
+	
+	FPubnubChatMessageData MessageData;
+	MessageData.Text = Message;
+	MessageData.ChannelID = ChannelID;
+	MessageData.UserID = Chat->CurrentUserID;
+	MessageData.Meta = UPubnubChatInternalUtilities::AddClientMessageIDToMeta(UPubnubChatInternalUtilities::SendTextMetaFromParams(SendTextParams, QuotedMessage), ClientMessageID);
+	
+	//Provisional timetoken keeps the message ordered by send time until the server assigns the real one
+	UPubnubChatMessage* EchoMessage = CreateLocalEchoMessageObject(UPubnubTimetokenUtilities::GetCurrentUnixTimetoken(), MessageData);
+	if (!EchoMessage)
+	{ return ""; }
+	
+	EchoMessage->SendState = EPubnubChatMessageSendState::PCMSS_Pending;
+	EchoMessage->ClientMessageID = ClientMessageID;
+	EchoMessage->LocalEchoChannel = this;
+	
+	{
+		FScopeLock Lock(&LocalEchoCriticalSection);
+		FPubnubChatPendingLocalEcho& LocalEcho = PendingLocalEchoes.Add(ClientMessageID);
+		LocalEcho.Message = EchoMessage;
+		LocalEcho.ProvisionalMessageID = EchoMessage->GetInternalMessageID();
+		LocalEcho.Text = Message;
+		LocalEcho.SendTextParams = SendTextParams;
+		LocalEcho.QuotedMessage = QuotedMessage;
+		LocalEcho.MentionedUsers = MentionedUsers;
+	}
+	
+	//Own messages are never dropped by flow control
+	DispatchMessageReceived(EchoMessage, false);
+	
+	return ClientMessageID;
+}
+
+UPubnubChatMessage* UPubnubChatChannel::CreateLocalEchoMessageObject(const FString& ProvisionalTimetoken, const FPubnubChatMessageData& MessageData)
+{
+	return Chat->CreateMessageObject(ProvisionalTimetoken, MessageData);
+}
+
+void UPubnubChatChannel::ConfirmLocalEcho(const FString& LocalEchoID, const FString& ServerTimetoken)
+{
+	FScopeLock Lock(&LocalEchoCriticalSection);
+	FPubnubChatPendingLocalEcho* LocalEcho = PendingLocalEchoes.Find(LocalEchoID);
+	if (!LocalEcho)
+	{ return; }
+	
+	LocalEcho->bPublished = true;
+	if (LocalEcho->SendState != EPubnubChatMessageSendState::PCMSS_Sent)
+	{
+		ApplyLocalEchoSent(*LocalEcho, ServerTimetoken);
+		LocalEcho->SendState = EPubnubChatMessageSendState::PCMSS_Sent;
+	}
+	
+	//Server echo was received before the publish returned, nothing else will refer to this local echo
+	if (LocalEcho->bEchoReceived)
+	{
+		PendingLocalEchoes.Remove(LocalEchoID);
+	}
+}
+
+void UPubnubChatChannel::FailLocalEcho(const FString& LocalEchoID)
+{
+	FScopeLock Lock(&LocalEchoCriticalSection);
+	FPubnubChatPendingLocalEcho* LocalEcho = PendingLocalEchoes.Find(LocalEchoID);
+	if (!LocalEcho || LocalEcho->SendState != EPubnubChatMessageSendState::PCMSS_Pending)
+	{ return; }
+	
+	LocalEcho->SendState = EPubnubChatMessageSendState::PCMSS_Failed;
+	DispatchLocalEchoSendState(LocalEcho->Message, EPubnubChatMessageSendState::PCMSS_Failed);
+}
+
+bool UPubnubChatChannel::ConsumeLocalEcho(const FString& Meta, const FString& ServerTimetoken)
+{
+	const FString LocalEchoID = UPubnubChatInternalUtilities::GetClientMessageIDFromMeta(Meta);
+	if (LocalEchoID.IsEmpty())
+	{ return false; }
+	
+	FScopeLock Lock(&LocalEchoCriticalSection);
+	FPubnubChatPendingLocalEcho* LocalEcho = PendingLocalEchoes.Find(LocalEchoID);
+	if (!LocalEcho)
+	{ return false; }
+	
+	//Echo can arrive before the publish returns, or after the publish reported an error even though the message was sent
+	LocalEcho->bEchoReceived = true;
+	if (LocalEcho->SendState != EPubnubChatMessageSendState::PCMSS_Sent)
+	{
+		ApplyLocalEchoSent(*LocalEcho, ServerTimetoken);
+		LocalEcho->SendState = EPubnubChatMessageSendState::PCMSS_Sent;
+	}
+	
+	if (LocalEcho->bPublished)
+	{
+		PendingLocalEchoes.Remove(LocalEchoID);
+	}
+	return true;
+}
+
+void UPubnubChatChannel::ApplyLocalEchoSent(const FPubnubChatPendingLocalEcho& LocalEcho, const FString& ServerTimetoken)
+{
+	TWeakObjectPtr<UPubnubChatChannel> ThisChannelWeak = MakeWeakObjectPtr(this);
+	TWeakObjectPtr<UPubnubChatMessage> MessageWeak = LocalEcho.Message;
+	FString ProvisionalMessageID = LocalEcho.ProvisionalMessageID;
+	AsyncTask(ENamedThreads::GameThread, [ThisChannelWeak, MessageWeak, ProvisionalMessageID, ServerTimetoken]()
+	{
+		if(!ThisChannelWeak.IsValid())
+		{return;}
+		
+		UPubnubChatChannel* ThisChannel = ThisChannelWeak.Get();
+		if(!ThisChannel->IsInitialized || !ThisChannel->Chat)
+		{return;}
+		
+		UPubnubChatMessage* Message = MessageWeak.Get();
+		if (Message && Message->IsInitialized)
+		{
+			ThisChannel->Chat->RekeyMessageObject(Message, ServerTimetoken);
+			Message->SetSendState(EPubnubChatMessageSendState::PCMSS_Sent);
+		}
+		else if (ThisChannel->Chat->ObjectsRepository)
+		{
+			//Provisional message object is already gone, only its stored copy has to be removed
+			ThisChannel->Chat->ObjectsRepository->RemoveMessageData(ProvisionalMessageID);
+		}
+	});
+}
+
+FPubnubChatOperationResult UPubnubChatChannel::RetryLocalEcho(const FString& LocalEchoID)
+{
+	PUBNUB_CHAT_OBJECT_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
+	
+	FPubnubChatPendingLocalEcho LocalEcho;
+	{
+		FScopeLock Lock(&LocalEchoCriticalSection);
+		FPubnubChatPendingLocalEcho* LocalEchoPtr = PendingLocalEchoes.Find(LocalEchoID);
+		PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED((LocalEchoPtr && LocalEchoPtr->SendState == EPubnubChatMessageSendState::PCMSS_Failed), TEXT("Only messages whose send failed can be sent again"));
+		
+		LocalEchoPtr->SendState = EPubnubChatMessageSendState::PCMSS_Pending;
+		LocalEcho = *LocalEchoPtr;
+	}
+	DispatchLocalEchoSendState(LocalEcho.Message, EPubnubChatMessageSendState::PCMSS_Pending);
+	
+	return SendTextInternal(LocalEcho.Text, LocalEcho.SendTextParams, LocalEcho.QuotedMessage.Get(), LocalEcho.MentionedUsers, LocalEchoID);
+}
+
+FPubnubChatOperationResult UPubnubChatChannel::DiscardLocalEcho(const FString& LocalEchoID)
+{
+	PUBNUB_CHAT_OBJECT_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
+	
+	FPubnubChatPendingLocalEcho LocalEcho;
+	{
+		FScopeLock Lock(&LocalEchoCriticalSection);
+		FPubnubChatPendingLocalEcho* LocalEchoPtr = PendingLocalEchoes.Find(LocalEchoID);
+		PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED((LocalEchoPtr && LocalEchoPtr->SendState == EPubnubChatMessageSendState::PCMSS_Failed), TEXT("Only messages whose send failed can be discarded"));
+		
+		LocalEcho = *LocalEchoPtr;
+		PendingLocalEchoes.Remove(LocalEchoID);
+	}
+	
+	if (UPubnubChatMessage* Message = LocalEcho.Message.Get())
+	{
+		Message->CleanUp();
+	}
+	Chat->ObjectsRepository->RemoveMessageData(LocalEcho.ProvisionalMessageID);
+	
+	return FPubnubChatOperationResult();
+}
+
+void UPubnubChatChannel::DispatchLocalEchoSendState(const TWeakObjectPtr<UPubnubChatMessage>& Message, EPubnubChatMessageSendState SendState)
+{
+	TWeakObjectPtr<UPubnubChatMessage> MessageWeak = Message;
+	AsyncTask(ENamedThreads::GameThread, [MessageWeak, SendState]()
+	{
+		if (UPubnubChatMessage* EchoMessage = MessageWeak.Get())
+		{
+			EchoMessage->SetSendState(SendState);
+		}
+	});
+}
+
 FPubnubChatOperationResult UPubnubChatChannel::OnSendText()
 {
 	return FPubnubChatOperationResult();
@@ -2440,17 +3122,239 @@ void UPubnubChatChannel::AddOnMessageReceivedLambdaToSubscription(TWeakObjectPtr
 
 		if(!ThisChannel->IsInitialized || !ThisChannel->Chat || !ThisChannel->IsConnected)
 		{return;}
-			
-		ThisChannel->OnMessageReceived.Broadcast(ThisChannel->Chat->CreateMessageObject(MessageData.Timetoken, MessageData));
-		ThisChannel->OnMessageReceivedNative.Broadcast(ThisChannel->Chat->CreateMessageObject(MessageData.Timetoken, MessageData));
+		
+		//Skip messages that were already replayed after a connection gap, or wait with them until the replay is broadcast
+		if(ThisChannel->Chat->ReconnectCatchUp && !ThisChannel->Chat->ReconnectCatchUp->HandleMessageDelivered(ThisChannel, MessageData))
+		{return;}
+		
+		ThisChannel->DeliverLiveMessage(MessageData);
+	});
+}
+
+void UPubnubChatChannel::DeliverLiveMessage(const FPubnubMessageData& MessageData)
+{
+	//Server echo of a locally echoed message updates the already delivered provisional message
+	if(ConsumeLocalEcho(MessageData.Metadata, MessageData.Timetoken))
+	{return;}
+	
+	//Dropped messages are skipped before their objects are created
+	bool bDroppable = true;
+	if(!AdmitReceivedMessage(MessageData, bDroppable))
+	{return;}
+		
+	DispatchMessageReceived(Chat->CreateMessageObject(MessageData.Timetoken, MessageData), bDroppable);
+}
+
+void UPubnubChatChannel::ReplayMissedMessages(const TArray<FPubnubHistoryMessageData>& HistoryMessages)
+{
+	//Server echoes of locally echoed messages were already delivered as provisional messages
+	TArray<FPubnubHistoryMessageData> MessagesToReplay;
+	for (const FPubnubHistoryMessageData& HistoryMessage : HistoryMessages)
+	{
+		if (!ConsumeLocalEcho(HistoryMessage.Meta, HistoryMessage.Timetoken))
+		{
+			MessagesToReplay.Add(HistoryMessage);
+		}
+	}
+	
+	//Keep created messages alive until they are broadcast on the game thread
+	TArray<TStrongObjectPtr<UPubnubChatMessage>> Messages;
+	for (UPubnubChatMessage* Message : Chat->CreateMessageObjects(MessagesToReplay))
+	{
+		Messages.Emplace(Message);
+	}
+	
+	TWeakObjectPtr<UPubnubChatChannel> ThisChannelWeak = MakeWeakObjectPtr(this);
+	AsyncTask(ENamedThreads::GameThread, [ThisChannelWeak, Messages = MoveTemp(Messages)]()
+	{
+		if(!ThisChannelWeak.IsValid())
+		{return;}
+		
+		UPubnubChatChannel* ThisChannel = ThisChannelWeak.Get();
+		if(!ThisChannel->IsInitialized || !ThisChannel->IsConnected)
+		{return;}
+		
+		for (const TStrongObjectPtr<UPubnubChatMessage>& Message : Messages)
+		{
+			ThisChannel->DispatchMessageReceived(Message.Get());
+		}
+		
+		//Live messages received during the replay are newer, so they are delivered after it
+		if(ThisChannel->Chat && ThisChannel->Chat->ReconnectCatchUp)
+		{
+			for (const FPubnubMessageData& MessageData : ThisChannel->Chat->ReconnectCatchUp->FinishReplay(ThisChannel))
+			{
+				ThisChannel->DeliverLiveMessage(MessageData);
+			}
+		}
 	});
 }
 
+bool UPubnubChatChannel::AdmitReceivedMessage(const FPubnubMessageData& MessageData, bool& bOutDroppable)
+{
+	bOutDroppable = true;
+	
+	//Flow control limits only messages waiting in the dispatch queue
+	const FPubnubChatFlowControlConfig& FlowControl = Chat->ChatConfig.FlowControl;
+	if (FlowControl.MaxQueuedMessages <= 0 || !Chat->DispatchQueue)
+	{ return true; }
+	
+	if (FlowControl.ExemptMentionsOfCurrentUser && UPubnubChatInternalUtilities::IsUserMentionedInPublishedMessage(MessageData.Message, Chat->CurrentUserID))
+	{
+		bOutDroppable = false;
+		return true;
+	}
+	
+	FScopeLock Lock(&FlowControlCriticalSection);
+	
+	if (Chat->DispatchQueue->GetNumDroppableEvents(this) < FlowControl.MaxQueuedMessages)
+	{ return true; }
+	
+	switch (FlowControl.DropPolicy)
+	{
+	case EPubnubChatDropPolicy::PCDP_DropNewest:
+		DroppedMessagesCount++;
+		return false;
+	case EPubnubChatDropPolicy::PCDP_Sample:
+		//Keep every SampleRate-th overflowing message, so a slow listener still sees the live flow
+		SampledOverflowCount = (SampledOverflowCount + 1) % FlowControl.SampleRate;
+		if (SampledOverflowCount != 0)
+		{
+			DroppedMessagesCount++;
+			return false;
+		}
+		break;
+	default:
+		break;
+	}
+	
+	if (Chat->DispatchQueue->DropOldestEvent(this))
+	{
+		DroppedMessagesCount++;
+	}
+	return true;
+}
+
+FPubnubChatFlowControlStats UPubnubChatChannel::GetFlowControlStats() const
+{
+	FPubnubChatFlowControlStats Stats;
+	if (Chat && Chat->DispatchQueue)
+	{
+		Stats.QueueDepth = Chat->DispatchQueue->GetNumPendingEvents(this);
+	}
+	
+	FScopeLock Lock(&FlowControlCriticalSection);
+	Stats.DroppedMessagesCount = DroppedMessagesCount;
+	return Stats;
+}
+
+void UPubnubChatChannel::DispatchMessageReceived(UPubnubChatMessage* Message, bool bDroppable)
+{
+	if (!Message || !Chat)
+	{return;}
+	
+	//Keep the message alive until it's delivered
+	TStrongObjectPtr<UPubnubChatMessage> MessagePtr(Message);
+	TWeakObjectPtr<UPubnubChatChannel> ThisChannelWeak = MakeWeakObjectPtr(this);
+	Chat->DispatchEvent(this, [ThisChannelWeak, MessagePtr]()
+	{
+		if(!ThisChannelWeak.IsValid())
+		{return;}
+		
+		UPubnubChatChannel* ThisChannel = ThisChannelWeak.Get();
+		if(!ThisChannel->IsInitialized || !ThisChannel->IsConnected)
+		{return;}
+		
+		ThisChannel->BroadcastMessageReceived(MessagePtr.Get());
+		
+		if (ThisChannel->OnMessagesReceivedBatch.IsBound() || ThisChannel->OnMessagesReceivedBatchNative.IsBound())
+		{
+			ThisChannel->PendingBatchMessages.Add(MessagePtr.Get());
+		}
+	}, "", bDroppable);
+	
+	//Batch is coalesced, so it's delivered once after all messages queued before it
+	Chat->DispatchEvent(this, [ThisChannelWeak]()
+	{
+		if(!ThisChannelWeak.IsValid())
+		{return;}
+		
+		ThisChannelWeak.Get()->BroadcastMessagesBatch();
+	}, Pubnub_Chat_Dispatch_Messages_Batch_Key);
+}
+
+void UPubnubChatChannel::BroadcastMessageReceived(UPubnubChatMessage* Message)
+{
+	OnMessageReceived.Broadcast(Message);
+	OnMessageReceivedNative.Broadcast(Message);
+}
+
+void UPubnubChatChannel::BroadcastMessagesBatch()
+{
+	if (PendingBatchMessages.IsEmpty())
+	{return;}
+	
+	TArray<UPubnubChatMessage*> Messages = MoveTemp(PendingBatchMessages);
+	PendingBatchMessages.Reset();
+	
+	OnMessagesReceivedBatch.Broadcast(Messages);
+	OnMessagesReceivedBatchNative.Broadcast(Messages);
+}
+
+void UPubnubChatChannel::DispatchTypingChanged(const TArray<FString>& TypingUserIDs)
+{
+	if (!Chat)
+	{return;}
+	
+	TWeakObjectPtr<UPubnubChatChannel> ThisChannelWeak = MakeWeakObjectPtr(this);
+	Chat->DispatchEvent(this, [ThisChannelWeak, TypingUserIDs]()
+	{
+		if(!ThisChannelWeak.IsValid())
+		{return;}
+		
+		UPubnubChatChannel* ThisChannel = ThisChannelWeak.Get();
+		if (!ThisChannel->IsInitialized || !ThisChannel->IsStreamingTyping)
+		{return;}
+		
+		ThisChannel->OnTypingChanged.Broadcast(TypingUserIDs);
+		ThisChannel->OnTypingChangedNative.Broadcast(TypingUserIDs);
+	}, Pubnub_Chat_Dispatch_Typing_Key);
+}
+
+void UPubnubChatChannel::DispatchPresenceChanged(const TArray<FString>& UserIDs)
+{
+	if (!Chat)
+	{return;}
+	
+	TWeakObjectPtr<UPubnubChatChannel> ThisChannelWeak = MakeWeakObjectPtr(this);
+	Chat->DispatchEvent(this, [ThisChannelWeak, UserIDs]()
+	{
+		if(!ThisChannelWeak.IsValid())
+		{return;}
+		
+		UPubnubChatChannel* ThisChannel = ThisChannelWeak.Get();
+		if (!ThisChannel->IsInitialized || !ThisChannel->IsStreamingPresence)
+		{return;}
+		
+		ThisChannel->OnPresenceChanged.Broadcast(UserIDs);
+		ThisChannel->OnPresenceChangedNative.Broadcast(UserIDs);
+	}, Pubnub_Chat_Dispatch_Presence_Key);
+}
+
 void UPubnubChatChannel::OnChatDestroyed(FString UserID)
 {
 	CleanUp();
 }
 
+void UPubnubChatChannel::OnChatUnreadMessagesCountChanged(const FString& InChannelID, int Count)
+{
+	if (InChannelID != ChannelID)
+	{return;}
+	
+	OnUnreadMessagesCountChanged.Broadcast(Count);
+	OnUnreadMessagesCountChangedNative.Broadcast(Count);
+}
+
 void UPubnubChatChannel::ClearAllSubscriptions()
 {
 	if (ConnectSubscription)
@@ -2458,6 +3362,10 @@ void UPubnubChatChannel::ClearAllSubscriptions()
 		ConnectSubscription->OnPubnubMessageNative.Clear();
 		if (IsConnected)
 		{
+			if (Chat && Chat->ReconnectCatchUp)
+			{
+				Chat->ReconnectCatchUp->UnregisterChannel(this);
+			}
 			ConnectSubscription->Unsubscribe();
 			IsConnected = false;
 		}
@@ -2536,6 +3444,8 @@ void UPubnubChatChannel::ClearAllSubscriptions()
 	IsStreamingReadReceipts = false;
 	IsStreamingMessageReports = false;
 	IsStreamingCustomEvents = false;
+	
+	PendingBatchMessages.Empty();
 }
 
 float UPubnubChatChannel::CalculateSendTextRateLimiterDelay()
@@ -2593,10 +3503,16 @@ void UPubnubChatChannel::CleanUp()
 		ClearAllSubscriptions();
 	}
 	
+	{
+		FScopeLock Lock(&LocalEchoCriticalSection);
+		PendingLocalEchoes.Empty();
+	}
+	
 	//Unregister from repository before destruction
 	if (IsInitialized && Chat && Chat->ObjectsRepository && !ChannelID.IsEmpty())
 	{
 		Chat->OnChatDestroyed.RemoveDynamic(this, &UPubnubChatChannel::OnChatDestroyed);
+		Chat->OnUnreadMessagesCountChangedNative.RemoveAll(this);
 		Chat->ObjectsRepository->UnregisterChannel(ChannelID);
 	}
 	
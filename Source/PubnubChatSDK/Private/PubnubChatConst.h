@@ -31,6 +31,60 @@ constexpr int Pubnub_Chat_Max_Rate_Limiter_Delay = 10000;
 const FString Pubnub_Chat_LastActiveTimestamp_Property_Name = "lastActiveTimestamp";
 //Minimum StoreUserActivityInterval in milliseconds (1 minute)
 constexpr int Pubnub_Chat_Min_StoreUserActivityInterval = 60000;
+//How often in milliseconds the activity heartbeat checks if the user activity timestamp has to be stored
+constexpr int Pubnub_Chat_Activity_Heartbeat_Check_Period = 5000;
+//Period in milliseconds of checks whether toggled reactions are due to be sent
+constexpr int Pubnub_Chat_Reaction_Flush_Check_Period = 50;
+//Period in milliseconds of checks whether last read message timetokens are due to be written
+constexpr int Pubnub_Chat_Read_Marker_Flush_Check_Period = 100;
+//Number of buckets of reference count histograms in memory stats: 0, 1, 2-3, 4-7, 8-15 and 16 or more live objects
+constexpr int Pubnub_Chat_Memory_Stats_Reference_Count_Buckets = 6;
+//Maximum number of members written or read by a single SetChannelMembers or GetChannelMembers request
+constexpr int Pubnub_Chat_Max_Channel_Members_Per_Request = 100;
+//Maximum number of messages returned by a single FetchHistory page when message actions are included
+constexpr int Pubnub_Chat_Max_History_Page_With_Actions = 25;
+//Maximum number of messages returned by a single FetchHistory page of one channel without message actions
+constexpr int Pubnub_Chat_Max_History_Page = 100;
+//Maximum number of message actions returned by a single GetMessageActions page
+constexpr int Pubnub_Chat_Max_Message_Actions_Page = 100;
+//Version of the bootstrap snapshot file. Snapshots with other version are ignored
+constexpr int Pubnub_Chat_Bootstrap_Snapshot_Version = 1;
+//Directory in Saved/ where bootstrap snapshots are stored
+const FString Pubnub_Chat_Bootstrap_Snapshot_Directory = "PubnubChat/Snapshots";
+//Directory in Saved/ where persistent stores of users are kept
+const FString Pubnub_Chat_Persistent_Store_Directory = "PubnubChat/Store";
+//Version of the persistent store files format. Stores with other version are discarded
+constexpr int Pubnub_Chat_Persistent_Store_Version = 1;
+//Percentage of the maximum size that a persistent store is compacted to, so compaction doesn't run again right after the next write
+constexpr int Pubnub_Chat_Persistent_Store_Compaction_Target_Percent = 75;
+//Magic numbers at the beginning of persistent store log ("PNCL") and index ("PNCI") files
+constexpr uint32 Pubnub_Chat_Persistent_Store_Log_Magic = 0x504E434C;
+constexpr uint32 Pubnub_Chat_Persistent_Store_Index_Magic = 0x504E4349;
+//Coalesce keys of the chat dispatch queue - only the latest pending event of a chat object with the same key is delivered
+const FString Pubnub_Chat_Dispatch_Typing_Key = "Typing";
+const FString Pubnub_Chat_Dispatch_Presence_Key = "Presence";
+const FString Pubnub_Chat_Dispatch_Messages_Batch_Key = "MessagesBatch";
+const FString Pubnub_Chat_Dispatch_Read_Receipt_Key_Prefix = "ReadReceipt.";
+const FString Pubnub_Chat_Dispatch_Message_Updated_Key = "MessageUpdated";
+const FString Pubnub_Chat_Dispatch_Message_Send_State_Key = "MessageSendState";
+//Maximum length of a single word stored in the search index. Longer words are truncated, so they still match by prefix
+constexpr int Pubnub_Chat_Search_Index_Max_Token_Length = 32;
+//Percentage of the memory budget that the search index is trimmed to when the budget is exceeded
+constexpr int Pubnub_Chat_Search_Index_Eviction_Target_Percent = 90;
+//Maximum number of messages returned by a single SearchMessages call
+constexpr int Pubnub_Chat_Max_Search_Results = 100;
+//Directory in Saved/ where outbox journals of users are kept
+const FString Pubnub_Chat_Outbox_Directory = "PubnubChat/Outbox";
+//Version of the outbox journal records. Records with other version are ignored
+constexpr int Pubnub_Chat_Outbox_Version = 1;
+//Number of flush attempts after which a queued mutation that keeps failing is dropped
+constexpr int Pubnub_Chat_Outbox_Max_Attempts = 5;
+//Number of records of finished mutations after which the outbox journal is rewritten with only the queued ones
+constexpr int Pubnub_Chat_Outbox_Compaction_Threshold = 64;
+//Margin in seconds added to the window in which started outbox mutations are looked up on the server, covers drift of the local clock
+constexpr int Pubnub_Chat_Outbox_Lookup_Margin_Seconds = 600;
+//Number of request worker threads of the chat - independent requests of a single bulk operation sent at the same time
+constexpr int Pubnub_Chat_Max_Concurrent_Requests = 8;
 // Message draft markdown link URL schemas for mentions (user/channel)
 const FString Pubnub_Schema_User = TEXT("pn-user://");
 const FString Pubnub_Schema_Channel = TEXT("pn-channel://");
\ No newline at end of file
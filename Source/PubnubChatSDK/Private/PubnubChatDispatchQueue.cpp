@@ -0,0 +1,249 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatDispatchQueue.h"
+#include "PubnubChatInternalMacros.h"
+#include "PubnubChatSubsystem.h"
+#include "HAL/PlatformTime.h"
+
+
+void UPubnubChatDispatchQueue::BeginDestroy()
+{
+	if (DispatchTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DispatchTickerHandle);
+		DispatchTickerHandle.Reset();
+	}
+
+	Super::BeginDestroy();
+}
+
+void UPubnubChatDispatchQueue::InitDispatchQueue(float InFrameBudgetMs)
+{
+	FScopeLock Lock(&DispatchQueueCriticalSection);
+	FrameBudgetMs = InFrameBudgetMs;
+}
+
+void UPubnubChatDispatchQueue::Start()
+{
+	if (DispatchTickerHandle.IsValid())
+	{ return; }
+
+	DispatchTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UPubnubChatDispatchQueue::OnDispatchTicker));
+}
+
+void UPubnubChatDispatchQueue::Stop()
+{
+	if (DispatchTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DispatchTickerHandle);
+		DispatchTickerHandle.Reset();
+	}
+
+	FScopeLock Lock(&DispatchQueueCriticalSection);
+	ListenerQueues.Empty();
+	NumPendingEvents = 0;
+}
+
+void UPubnubChatDispatchQueue::Enqueue(UObject* Listener, FDispatchFunction Function, const FString& CoalesceKey, bool bDroppable)
+{
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(Listener, TEXT("Can't enqueue event to DispatchQueue, Listener is invalid"));
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(Function, TEXT("Can't enqueue event to DispatchQueue, Function is invalid"));
+
+	FScopeLock Lock(&DispatchQueueCriticalSection);
+
+	FListenerQueue& ListenerQueue = ListenerQueues.FindOrAdd(FObjectKey(Listener));
+	if (!ListenerQueue.Listener.IsValid())
+	{
+		ListenerQueue.Listener = Listener;
+	}
+
+	FDispatchEntry& Entry = ListenerQueue.Entries.AddDefaulted_GetRef();
+	Entry.Sequence = NextSequence++;
+
+	if (CoalesceKey.IsEmpty())
+	{
+		Entry.Function = MoveTemp(Function);
+		Entry.bDroppable = bDroppable;
+		if (bDroppable)
+		{
+			ListenerQueue.NumDroppableEvents++;
+		}
+	}
+	else
+	{
+		//Superseded entry stays in the queue, but is skipped as its sequence doesn't match anymore
+		Entry.CoalesceKey = CoalesceKey;
+		FCoalescedFunction* CoalescedFunction = ListenerQueue.CoalescedFunctions.Find(CoalesceKey);
+		if (CoalescedFunction)
+		{
+			CoalescedFunction->Sequence = Entry.Sequence;
+			CoalescedFunction->Function = MoveTemp(Function);
+			return;
+		}
+		ListenerQueue.CoalescedFunctions.Add(CoalesceKey, FCoalescedFunction{Entry.Sequence, MoveTemp(Function)});
+	}
+
+	ListenerQueue.NumPendingEvents++;
+	NumPendingEvents++;
+}
+
+bool UPubnubChatDispatchQueue::DropOldestEvent(UObject* Listener)
+{
+	//Dropped function is destroyed outside of the lock
+	FDispatchFunction DroppedFunction;
+	{
+		FScopeLock Lock(&DispatchQueueCriticalSection);
+		FListenerQueue* ListenerQueue = ListenerQueues.Find(FObjectKey(Listener));
+		if (!ListenerQueue || ListenerQueue->NumDroppableEvents <= 0)
+		{ return false; }
+
+		for (int32 i = FMath::Max(ListenerQueue->FirstEntryIndex, ListenerQueue->DropSearchIndex); i < ListenerQueue->Entries.Num(); ++i)
+		{
+			FDispatchEntry& Entry = ListenerQueue->Entries[i];
+			if (!Entry.bDroppable || Entry.bDropped)
+			{ continue; }
+
+			Entry.bDropped = true;
+			DroppedFunction = MoveTemp(Entry.Function);
+			ListenerQueue->DropSearchIndex = i + 1;
+			ListenerQueue->NumDroppableEvents--;
+			ListenerQueue->NumPendingEvents--;
+			NumPendingEvents--;
+			return true;
+		}
+	}
+	return false;
+}
+
+int UPubnubChatDispatchQueue::DispatchPendingEvents(double BudgetSeconds)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	int DispatchedCount = 0;
+
+	//Deliver one event of every listener per turn, until nothing is pending or the budget is used
+	bool bAnyDispatched = true;
+	while (bAnyDispatched)
+	{
+		bAnyDispatched = false;
+
+		TArray<FObjectKey> ListenerKeys;
+		{
+			FScopeLock Lock(&DispatchQueueCriticalSection);
+			ListenerQueues.GenerateKeyArray(ListenerKeys);
+		}
+
+		for (const FObjectKey& ListenerKey : ListenerKeys)
+		{
+			FDispatchFunction Function;
+			{
+				FScopeLock Lock(&DispatchQueueCriticalSection);
+				FListenerQueue* ListenerQueue = ListenerQueues.Find(ListenerKey);
+				if (!ListenerQueue)
+				{ continue; }
+
+				//Events of destroyed listeners are dropped
+				if (!ListenerQueue->Listener.IsValid() || !PopNextFunction(*ListenerQueue, Function))
+				{
+					RemoveListenerQueue(ListenerKey);
+					continue;
+				}
+			}
+
+			//Delegates are called outside of the lock, so they can enqueue new events
+			Function();
+			DispatchedCount++;
+			bAnyDispatched = true;
+
+			if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+			{ return DispatchedCount; }
+		}
+	}
+
+	return DispatchedCount;
+}
+
+int UPubnubChatDispatchQueue::GetNumPendingEvents() const
+{
+	FScopeLock Lock(&DispatchQueueCriticalSection);
+	return NumPendingEvents;
+}
+
+int UPubnubChatDispatchQueue::GetNumPendingEvents(const UObject* Listener) const
+{
+	FScopeLock Lock(&DispatchQueueCriticalSection);
+	const FListenerQueue* ListenerQueue = ListenerQueues.Find(FObjectKey(Listener));
+	return ListenerQueue ? ListenerQueue->NumPendingEvents : 0;
+}
+
+int UPubnubChatDispatchQueue::GetNumDroppableEvents(const UObject* Listener) const
+{
+	FScopeLock Lock(&DispatchQueueCriticalSection);
+	const FListenerQueue* ListenerQueue = ListenerQueues.Find(FObjectKey(Listener));
+	return ListenerQueue ? ListenerQueue->NumDroppableEvents : 0;
+}
+
+bool UPubnubChatDispatchQueue::OnDispatchTicker(float DeltaTime)
+{
+	double BudgetSeconds;
+	{
+		FScopeLock Lock(&DispatchQueueCriticalSection);
+		BudgetSeconds = FrameBudgetMs / 1000.0;
+	}
+
+	DispatchPendingEvents(BudgetSeconds);
+	return true;
+}
+
+bool UPubnubChatDispatchQueue::PopNextFunction(FListenerQueue& ListenerQueue, FDispatchFunction& OutFunction)
+{
+	bool bFound = false;
+	while (!bFound && ListenerQueue.FirstEntryIndex < ListenerQueue.Entries.Num())
+	{
+		FDispatchEntry& Entry = ListenerQueue.Entries[ListenerQueue.FirstEntryIndex++];
+		if (Entry.bDropped)
+		{ continue; }
+
+		if (Entry.CoalesceKey.IsEmpty())
+		{
+			OutFunction = MoveTemp(Entry.Function);
+			if (Entry.bDroppable)
+			{
+				ListenerQueue.NumDroppableEvents--;
+			}
+			bFound = true;
+			continue;
+		}
+
+		//Skip entries superseded by a newer event with the same key
+		FCoalescedFunction* CoalescedFunction = ListenerQueue.CoalescedFunctions.Find(Entry.CoalesceKey);
+		if (CoalescedFunction && CoalescedFunction->Sequence == Entry.Sequence)
+		{
+			OutFunction = MoveTemp(CoalescedFunction->Function);
+			ListenerQueue.CoalescedFunctions.Remove(Entry.CoalesceKey);
+			bFound = true;
+		}
+	}
+
+	if (ListenerQueue.FirstEntryIndex >= ListenerQueue.Entries.Num())
+	{
+		ListenerQueue.Entries.Reset();
+		ListenerQueue.FirstEntryIndex = 0;
+		ListenerQueue.DropSearchIndex = 0;
+	}
+
+	if (bFound)
+	{
+		ListenerQueue.NumPendingEvents--;
+		NumPendingEvents--;
+	}
+	return bFound;
+}
+
+void UPubnubChatDispatchQueue::RemoveListenerQueue(const FObjectKey& ListenerKey)
+{
+	if (FListenerQueue* ListenerQueue = ListenerQueues.Find(ListenerKey))
+	{
+		NumPendingEvents -= ListenerQueue->NumPendingEvents;
+		ListenerQueues.Remove(ListenerKey);
+	}
+}
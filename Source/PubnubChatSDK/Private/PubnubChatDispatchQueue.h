@@ -0,0 +1,110 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "UObject/ObjectKey.h"
+#include "HAL/CriticalSection.h"
+#include "Containers/Ticker.h"
+#include "PubnubChatDispatchQueue.generated.h"
+
+/**
+ * Delivers received events to chat object delegates on the game thread under a per-frame time budget.
+ * Events are buffered per listener (the chat object that broadcasts them) and listeners are drained in turns,
+ * so a burst on one channel doesn't delay typing or presence updates of other channels.
+ * Events of destroyed listeners are dropped. Droppable events (received messages) can be dropped by flow control
+ * when the listener falls behind.
+ * Events enqueued with a coalesce key supersede the pending event of the same listener with the same key -
+ * only the latest one is delivered, in the position of the latest one.
+ *
+ * This is an internal class and should not be used directly. Configure it with FPubnubChatConfig::Dispatch.
+ */
+UCLASS()
+class PUBNUBCHATSDK_API UPubnubChatDispatchQueue : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Calls delegates of the listener. Has to check that the listener is still in a state to receive the event */
+	using FDispatchFunction = TFunction<void()>;
+
+	virtual void BeginDestroy() override;
+
+	/** @param InFrameBudgetMs Time in milliseconds that can be spent on delivering events in a single frame */
+	void InitDispatchQueue(float InFrameBudgetMs);
+
+	/** Starts delivering pending events every frame. Game thread only. */
+	void Start();
+	/** Stops delivering events and drops all pending ones. Game thread only. */
+	void Stop();
+	bool IsRunning() const { return DispatchTickerHandle.IsValid(); }
+
+	/**
+	 * Adds event to the queue of given listener. Can be called from any thread.
+	 * @param CoalesceKey If not empty, pending event of this listener with the same key is replaced by this one
+	 * @param bDroppable True if the event can be removed by DropOldestEvent. Ignored for coalesced events
+	 */
+	void Enqueue(UObject* Listener, FDispatchFunction Function, const FString& CoalesceKey = "", bool bDroppable = false);
+
+	/** Removes the oldest pending droppable event of given listener. Can be called from any thread. @return False if there was none */
+	bool DropOldestEvent(UObject* Listener);
+
+	/**
+	 * Delivers pending events until all are delivered or the budget is used. At least one event is delivered if any is pending.
+	 * Called every frame while running. Game thread only.
+	 * @return Number of delivered events
+	 */
+	int DispatchPendingEvents(double BudgetSeconds);
+
+	int GetNumPendingEvents() const;
+	int GetNumPendingEvents(const UObject* Listener) const;
+	int GetNumDroppableEvents(const UObject* Listener) const;
+
+private:
+	struct FDispatchEntry
+	{
+		FString CoalesceKey;
+		uint64 Sequence = 0;
+		bool bDroppable = false;
+		bool bDropped = false;
+		/** Empty for coalesced and dropped entries - their function is kept in FListenerQueue::CoalescedFunctions */
+		FDispatchFunction Function;
+	};
+
+	struct FCoalescedFunction
+	{
+		uint64 Sequence = 0;
+		FDispatchFunction Function;
+	};
+
+	struct FListenerQueue
+	{
+		TWeakObjectPtr<UObject> Listener;
+		TArray<FDispatchEntry> Entries;
+		/** Index of the first entry that wasn't delivered yet. Entries are reset when all are delivered */
+		int32 FirstEntryIndex = 0;
+		/** Latest function for every pending coalesce key. Entries with older sequence are skipped */
+		TMap<FString, FCoalescedFunction> CoalescedFunctions;
+		int32 NumPendingEvents = 0;
+		int32 NumDroppableEvents = 0;
+		/** Entries before this index are not droppable anymore, so DropOldestEvent doesn't search them again */
+		int32 DropSearchIndex = 0;
+	};
+
+	float FrameBudgetMs = 2.0f;
+	uint64 NextSequence = 0;
+	int32 NumPendingEvents = 0;
+
+	TMap<FObjectKey, FListenerQueue> ListenerQueues;
+
+	FTSTicker::FDelegateHandle DispatchTickerHandle;
+
+	mutable FCriticalSection DispatchQueueCriticalSection;
+
+	bool OnDispatchTicker(float DeltaTime);
+	/** Takes the next function to deliver from given queue. Has to be called with DispatchQueueCriticalSection locked */
+	bool PopNextFunction(FListenerQueue& ListenerQueue, FDispatchFunction& OutFunction);
+	/** Has to be called with DispatchQueueCriticalSection locked */
+	void RemoveListenerQueue(const FObjectKey& ListenerKey);
+};
@@ -0,0 +1,766 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatFilePersistentStore.h"
+#include "PubnubChatConst.h"
+#include "PubnubChatSubsystem.h"
+#include "FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Reverse.h"
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UnrealType.h"
+
+
+static uint32 HashStructLayout(const UStruct* Struct, uint32 Hash);
+
+static uint32 HashPropertyLayout(const FProperty* Property, uint32 Hash)
+{
+	Hash = HashCombine(Hash, GetTypeHash(Property->GetName()));
+	Hash = HashCombine(Hash, GetTypeHash(Property->GetClass()->GetName()));
+
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		Hash = HashStructLayout(StructProperty->Struct, Hash);
+	}
+	else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		Hash = HashPropertyLayout(ArrayProperty->Inner, Hash);
+	}
+	else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+	{
+		Hash = HashPropertyLayout(SetProperty->ElementProp, Hash);
+	}
+	else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		Hash = HashPropertyLayout(MapProperty->KeyProp, Hash);
+		Hash = HashPropertyLayout(MapProperty->ValueProp, Hash);
+	}
+	return Hash;
+}
+
+static uint32 HashStructLayout(const UStruct* Struct, uint32 Hash)
+{
+	for (TFieldIterator<FProperty> It(Struct); It; ++It)
+	{
+		Hash = HashPropertyLayout(*It, Hash);
+	}
+	return Hash;
+}
+
+void UPubnubChatFilePersistentStore::BeginDestroy()
+{
+	CloseStore();
+
+	Super::BeginDestroy();
+}
+
+bool UPubnubChatFilePersistentStore::OpenStore(const FString& StoreDirectory, int64 MaxSizeBytes)
+{
+	FScopeLock Lock(&StoreCriticalSection);
+	if (bIsOpen)
+	{ return true; }
+
+	IFileManager& FileManager = IFileManager::Get();
+	if (!FileManager.MakeDirectory(*StoreDirectory, true))
+	{
+		UE_LOG(PubnubChatLog, Warning, TEXT("Failed to create persistent store directory %s."), *StoreDirectory);
+		return false;
+	}
+
+	LogFilePath = FPaths::Combine(StoreDirectory, TEXT("Store.log"));
+	IndexFilePath = FPaths::Combine(StoreDirectory, TEXT("Store.idx"));
+	MaxStoreSize = FMath::Max<int64>(MaxSizeBytes, FileHeaderSize);
+	Entries.Empty();
+	ChannelMessages.Empty();
+	AccessClock = 0;
+
+	//Store written by other version of the SDK can't be read, it's started from scratch
+	bool bIsLogValid = false;
+	{
+		TUniquePtr<FArchive> LogReader(FileManager.CreateFileReader(*LogFilePath, FILEREAD_Silent | FILEREAD_AllowWrite));
+		bIsLogValid = LogReader && LogReader->TotalSize() >= FileHeaderSize && ReadFileHeader(*LogReader, Pubnub_Chat_Persistent_Store_Log_Magic);
+	}
+	if (!bIsLogValid)
+	{
+		FileManager.Delete(*IndexFilePath, false, true, true);
+
+		TUniquePtr<FArchive> NewLogWriter(FileManager.CreateFileWriter(*LogFilePath));
+		if (!NewLogWriter)
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("Failed to create persistent store log %s."), *LogFilePath);
+			return false;
+		}
+		WriteFileHeader(*NewLogWriter, Pubnub_Chat_Persistent_Store_Log_Magic);
+	}
+	LogSize = FileManager.FileSize(*LogFilePath);
+
+	int64 IndexedLogSize = FileHeaderSize;
+	if (!LoadIndex(IndexedLogSize))
+	{
+		Entries.Empty();
+		ChannelMessages.Empty();
+		IndexedLogSize = FileHeaderSize;
+	}
+
+	//Records appended after the index was saved (or all of them if the previous session didn't close the store) are read from the log
+	const bool bIsLogComplete = ScanLog(IndexedLogSize);
+
+	//Index is saved again on close, so a crash of this session never leaves an outdated index next to the log
+	FileManager.Delete(*IndexFilePath, false, true, true);
+
+	LogWriter.Reset(FileManager.CreateFileWriter(*LogFilePath, FILEWRITE_Append | FILEWRITE_AllowRead));
+	if (!LogWriter)
+	{
+		UE_LOG(PubnubChatLog, Warning, TEXT("Failed to open persistent store log %s."), *LogFilePath);
+		return false;
+	}
+	bIsOpen = true;
+
+	//Broken record at the end of the log (e.g. crash during write) is dropped by rewriting the log with indexed records only
+	if (!bIsLogComplete || LogSize > MaxStoreSize)
+	{
+		Compact();
+	}
+
+	return bIsOpen;
+}
+
+void UPubnubChatFilePersistentStore::CloseStore()
+{
+	FScopeLock Lock(&StoreCriticalSection);
+	if (!bIsOpen)
+	{ return; }
+
+	LogWriter.Reset();
+	bHasUnflushedWrites = false;
+	SaveIndex();
+
+	Entries.Empty();
+	ChannelMessages.Empty();
+	bIsOpen = false;
+}
+
+void UPubnubChatFilePersistentStore::StoreUser(const FPubnubChatInternalUser& User)
+{
+	FScopeLock Lock(&StoreCriticalSection);
+	StoreRecord(EPubnubChatStoreRecordType::User, User.UserID, FPubnubChatInternalUser::StaticStruct(), &User, FPubnubChatUserData::StaticStruct(), &User.UserData);
+}
+
+bool UPubnubChatFilePersistentStore::LoadUser(const FString& UserID, FPubnubChatInternalUser& OutUser)
+{
+	FScopeLock Lock(&StoreCriticalSection);
+	return LoadRecord(EPubnubChatStoreRecordType::User, UserID, FPubnubChatInternalUser::StaticStruct(), &OutUser);
+}
+
+void UPubnubChatFilePersistentStore::RemoveUser(const FString& UserID)
+{
+	FScopeLock Lock(&StoreCriticalSection);
+	RemoveRecord(EPubnubChatStoreRecordType::User, UserID);
+}
+
+void UPubnubChatFilePersistentStore::StoreChannel(const FPubnubChatInternalChannel& Channel)
+{
+	FScopeLock Lock(&StoreCriticalSection);
+	StoreRecord(EPubnubChatStoreRecordType::Channel, Channel.ChannelID, FPubnubChatInternalChannel::StaticStruct(), &Channel, FPubnubChatChannelData::StaticStruct(), &Channel.ChannelData);
+}
+
+bool UPubnubChatFilePersistentStore::LoadChannel(const FString& ChannelID, FPubnubChatInternalChannel& OutChannel)
+{
+	FScopeLock Lock(&StoreCriticalSection);
+	return LoadRecord(EPubnubChatStoreRecordType::Channel, ChannelID, FPubnubChatInternalChannel::StaticStruct(), &OutChannel);
+}
+
+void UPubnubChatFilePersistentStore::RemoveChannel(const FString& ChannelID)
+{
+	FScopeLock Lock(&StoreCriticalSection);
+	RemoveRecord(EPubnubChatStoreRecordType::Channel, ChannelID);
+}
+
+void UPubnubChatFilePersistentStore::StoreMessages(const TArray<FPubnubChatInternalMessage>& Messages)
+{
+	FScopeLock Lock(&StoreCriticalSection);
+	for (const FPubnubChatInternalMessage& Message : Messages)
+	{
+		StoreRecord(EPubnubChatStoreRecordType::Message, MakeMessageID(Message.ChannelID, Message.Timetoken), FPubnubChatInternalMessage::StaticStruct(), &Message, FPubnubChatMessageData::StaticStruct(), &Message.MessageData);
+	}
+}
+
+void UPubnubChatFilePersistentStore::RemoveMessage(const FString& MessageID)
+{
+	FScopeLock Lock(&StoreCriticalSection);
+	RemoveRecord(EPubnubChatStoreRecordType::Message, MessageID);
+}
+
+void UPubnubChatFilePersistentStore::LoadMessages(const FString& ChannelID, int64 StartTimetoken, int64 EndTimetoken, int Count, TArray<FPubnubChatInternalMessage>& OutMessages)
+{
+	OutMessages.Empty();
+
+	FScopeLock Lock(&StoreCriticalSection);
+	if (!bIsOpen || Count <= 0)
+	{ return; }
+
+	const TArray<int64>* Timetokens = ChannelMessages.Find(ChannelID);
+	if (!Timetokens)
+	{ return; }
+
+	//Newest messages of the range are taken, the same way the server returns history pages
+	TArray<const FPubnubChatStoreEntry*> EntriesToRead;
+	for (int32 Index = Algo::UpperBound(*Timetokens, StartTimetoken) - 1; Index >= 0 && EntriesToRead.Num() < Count && (*Timetokens)[Index] >= EndTimetoken; --Index)
+	{
+		if (FPubnubChatStoreEntry* Entry = Entries.Find(MakeEntryKey(EPubnubChatStoreRecordType::Message, MakeMessageID(ChannelID, (*Timetokens)[Index]))))
+		{
+			Entry->LastAccess = ++AccessClock;
+			EntriesToRead.Add(Entry);
+		}
+	}
+	Algo::Reverse(EntriesToRead);
+
+	OutMessages.Reserve(EntriesToRead.Num());
+	ReadPayloads(EntriesToRead, [&OutMessages](const FPubnubChatStoreEntry& Entry, TArrayView<const uint8> Payload)
+	{
+		FMemoryReaderView PayloadReader(Payload);
+		FPubnubChatInternalMessage& Message = OutMessages.AddDefaulted_GetRef();
+		FPubnubChatInternalMessage::StaticStruct()->SerializeBin(PayloadReader, &Message);
+		if (PayloadReader.IsError())
+		{
+			OutMessages.Pop();
+		}
+	});
+}
+
+void UPubnubChatFilePersistentStore::ReconcileMessages(const FString& ChannelID, int64 StartTimetoken, int64 EndTimetoken, const TSet<int64>& ServerTimetokens)
+{
+	FScopeLock Lock(&StoreCriticalSection);
+	if (!bIsOpen)
+	{ return; }
+
+	const TArray<int64>* Timetokens = ChannelMessages.Find(ChannelID);
+	if (!Timetokens)
+	{ return; }
+
+	//Stored messages the server doesn't have anymore were deleted while this device wasn't listening
+	TArray<int64> TimetokensToRemove;
+	for (int32 Index = Algo::LowerBound(*Timetokens, EndTimetoken); Index < Timetokens->Num() && (*Timetokens)[Index] <= StartTimetoken; ++Index)
+	{
+		if (!ServerTimetokens.Contains((*Timetokens)[Index]))
+		{
+			TimetokensToRemove.Add((*Timetokens)[Index]);
+		}
+	}
+
+	for (const int64 Timetoken : TimetokensToRemove)
+	{
+		RemoveRecord(EPubnubChatStoreRecordType::Message, MakeMessageID(ChannelID, Timetoken));
+	}
+}
+
+void UPubnubChatFilePersistentStore::CompactStore()
+{
+	FScopeLock Lock(&StoreCriticalSection);
+	bCompactionScheduled = false;
+	if (bIsOpen)
+	{
+		Compact();
+	}
+}
+
+int64 UPubnubChatFilePersistentStore::GetStoreSize() const
+{
+	FScopeLock Lock(&StoreCriticalSection);
+	return LogSize;
+}
+
+uint32 UPubnubChatFilePersistentStore::GetStoredStructsLayoutHash()
+{
+	static const uint32 LayoutHash = HashStructLayout(FPubnubChatInternalMessage::StaticStruct(), HashStructLayout(FPubnubChatInternalChannel::StaticStruct(), HashStructLayout(FPubnubChatInternalUser::StaticStruct(), 0)));
+	return LayoutHash;
+}
+
+void UPubnubChatFilePersistentStore::StoreRecord(EPubnubChatStoreRecordType Type, const FString& Key, const UScriptStruct* Struct, const void* Data, const UScriptStruct* ContentStruct, const void* ContentData)
+{
+	if (!bIsOpen || Key.IsEmpty())
+	{ return; }
+
+	TArray<uint8> ContentBytes;
+	FMemoryWriter ContentWriter(ContentBytes);
+	ContentStruct->SerializeBin(ContentWriter, const_cast<void*>(ContentData));
+	const uint32 ContentCrc = FCrc::MemCrc32(ContentBytes.GetData(), ContentBytes.Num());
+
+	if (FPubnubChatStoreEntry* Entry = Entries.Find(MakeEntryKey(Type, Key)))
+	{
+		if (Entry->ContentCrc == ContentCrc)
+		{
+			Entry->LastAccess = ++AccessClock;
+			return;
+		}
+	}
+
+	TArray<uint8> Payload;
+	FMemoryWriter PayloadWriter(Payload);
+	Struct->SerializeBin(PayloadWriter, const_cast<void*>(Data));
+
+	int32 RecordSize = 0;
+	const int64 PayloadOffset = AppendRecord(Type, Key, false, Payload, RecordSize);
+	ApplyRecordToIndex(Type, Key, false, PayloadOffset, Payload.Num(), RecordSize, ContentCrc);
+	ScheduleCompactionIfNeeded();
+}
+
+bool UPubnubChatFilePersistentStore::LoadRecord(EPubnubChatStoreRecordType Type, const FString& Key, const UScriptStruct* Struct, void* OutData)
+{
+	if (!bIsOpen)
+	{ return false; }
+
+	FPubnubChatStoreEntry* Entry = Entries.Find(MakeEntryKey(Type, Key));
+	if (!Entry)
+	{ return false; }
+
+	Entry->LastAccess = ++AccessClock;
+
+	bool bLoaded = false;
+	ReadPayloads({Entry}, [Struct, OutData, &bLoaded](const FPubnubChatStoreEntry& ReadEntry, TArrayView<const uint8> Payload)
+	{
+		FMemoryReaderView PayloadReader(Payload);
+		Struct->SerializeBin(PayloadReader, OutData);
+		bLoaded = !PayloadReader.IsError();
+	});
+	return bLoaded;
+}
+
+void UPubnubChatFilePersistentStore::RemoveRecord(EPubnubChatStoreRecordType Type, const FString& Key)
+{
+	if (!bIsOpen || !Entries.Contains(MakeEntryKey(Type, Key)))
+	{ return; }
+
+	int32 RecordSize = 0;
+	const int64 PayloadOffset = AppendRecord(Type, Key, true, TArrayView<const uint8>(), RecordSize);
+	ApplyRecordToIndex(Type, Key, true, PayloadOffset, 0, RecordSize, 0);
+	ScheduleCompactionIfNeeded();
+}
+
+int64 UPubnubChatFilePersistentStore::AppendRecord(EPubnubChatStoreRecordType Type, const FString& Key, bool bRemoved, TArrayView<const uint8> Payload, int32& OutRecordSize)
+{
+	//Header is built in memory first, so its size is known without querying the file
+	TArray<uint8> RecordHeader;
+	FMemoryWriter RecordHeaderWriter(RecordHeader);
+	SerializeRecordHeader(RecordHeaderWriter, Type, Key, bRemoved, Payload.Num());
+
+	LogWriter->Serialize(RecordHeader.GetData(), RecordHeader.Num());
+	if (Payload.Num() > 0)
+	{
+		LogWriter->Serialize(const_cast<uint8*>(Payload.GetData()), Payload.Num());
+	}
+	bHasUnflushedWrites = true;
+
+	const int64 PayloadOffset = LogSize + RecordHeader.Num();
+	OutRecordSize = RecordHeader.Num() + Payload.Num();
+	LogSize += OutRecordSize;
+	return PayloadOffset;
+}
+
+void UPubnubChatFilePersistentStore::ApplyRecordToIndex(EPubnubChatStoreRecordType Type, const FString& Key, bool bRemoved, int64 PayloadOffset, int32 PayloadSize, int32 RecordSize, uint32 ContentCrc)
+{
+	const FString EntryKey = MakeEntryKey(Type, Key);
+	FString ChannelID;
+	int64 Timetoken = 0;
+	const bool bIsMessage = Type == EPubnubChatStoreRecordType::Message && SplitMessageID(Key, ChannelID, Timetoken);
+
+	if (bRemoved)
+	{
+		if (Entries.Remove(EntryKey) > 0 && bIsMessage)
+		{
+			if (TArray<int64>* Timetokens = ChannelMessages.Find(ChannelID))
+			{
+				const int32 TimetokenIndex = Algo::BinarySearch(*Timetokens, Timetoken);
+				if (TimetokenIndex != INDEX_NONE)
+				{
+					Timetokens->RemoveAt(TimetokenIndex);
+				}
+				if (Timetokens->IsEmpty())
+				{
+					ChannelMessages.Remove(ChannelID);
+				}
+			}
+		}
+		return;
+	}
+
+	FPubnubChatStoreEntry* Entry = Entries.Find(EntryKey);
+	if (!Entry)
+	{
+		Entry = &Entries.Add(EntryKey);
+		Entry->Type = Type;
+		Entry->Key = Key;
+
+		//Messages are mostly stored in timetoken order, so this is usually an append
+		if (bIsMessage)
+		{
+			TArray<int64>& Timetokens = ChannelMessages.FindOrAdd(ChannelID);
+			Timetokens.Insert(Timetoken, Algo::LowerBound(Timetokens, Timetoken));
+		}
+	}
+
+	Entry->PayloadOffset = PayloadOffset;
+	Entry->PayloadSize = PayloadSize;
+	Entry->RecordSize = RecordSize;
+	Entry->ContentCrc = ContentCrc;
+	Entry->LastAccess = ++AccessClock;
+}
+
+bool UPubnubChatFilePersistentStore::ReadPayloads(const TArray<const FPubnubChatStoreEntry*>& EntriesToRead, TFunctionRef<void(const FPubnubChatStoreEntry&, TArrayView<const uint8>)> PayloadCallback)
+{
+	if (EntriesToRead.IsEmpty())
+	{ return true; }
+
+	//Buffered records have to reach the file before it's read
+	FlushLogWriter();
+
+	int64 RegionStart = MAX_int64;
+	int64 RegionEnd = 0;
+	for (const FPubnubChatStoreEntry* Entry : EntriesToRead)
+	{
+		RegionStart = FMath::Min(RegionStart, Entry->PayloadOffset);
+		RegionEnd = FMath::Max(RegionEnd, Entry->PayloadOffset + Entry->PayloadSize);
+	}
+
+	//Single mapped region covers all requested records - compaction keeps records of a channel next to each other, so it stays small for history ranges
+	{
+		TUniquePtr<IMappedFileHandle> MappedLog = OpenMappedLog();
+		TUniquePtr<IMappedFileRegion> MappedRegion;
+		if (MappedLog && MappedLog->GetFileSize() >= RegionEnd)
+		{
+			MappedRegion.Reset(MappedLog->MapRegion(RegionStart, RegionEnd - RegionStart));
+		}
+
+		if (MappedRegion)
+		{
+			const uint8* RegionData = MappedRegion->GetMappedPtr();
+			for (const FPubnubChatStoreEntry* Entry : EntriesToRead)
+			{
+				PayloadCallback(*Entry, TArrayView<const uint8>(RegionData + (Entry->PayloadOffset - RegionStart), Entry->PayloadSize));
+			}
+			return true;
+		}
+	}
+
+	//Platforms without memory-mapped files read records one by one
+	TUniquePtr<FArchive> LogReader(IFileManager::Get().CreateFileReader(*LogFilePath, FILEREAD_AllowWrite));
+	if (!LogReader)
+	{
+		UE_LOG(PubnubChatLog, Warning, TEXT("Failed to read persistent store log %s."), *LogFilePath);
+		return false;
+	}
+
+	TArray<uint8> Payload;
+	for (const FPubnubChatStoreEntry* Entry : EntriesToRead)
+	{
+		Payload.SetNumUninitialized(Entry->PayloadSize);
+		LogReader->Seek(Entry->PayloadOffset);
+		LogReader->Serialize(Payload.GetData(), Entry->PayloadSize);
+		if (LogReader->IsError())
+		{ return false; }
+
+		PayloadCallback(*Entry, Payload);
+	}
+	return true;
+}
+
+bool UPubnubChatFilePersistentStore::ScanLog(int64 StartOffset)
+{
+	TUniquePtr<FArchive> LogReader(IFileManager::Get().CreateFileReader(*LogFilePath, FILEREAD_AllowWrite));
+	if (!LogReader)
+	{ return false; }
+
+	const int64 FileSize = LogReader->TotalSize();
+	int64 RecordOffset = StartOffset;
+	LogReader->Seek(RecordOffset);
+
+	while (RecordOffset < FileSize)
+	{
+		uint8 TypeValue = 0;
+		uint8 RemovedValue = 0;
+		FString Key;
+		int32 PayloadSize = 0;
+		*LogReader << TypeValue << RemovedValue << Key << PayloadSize;
+
+		const int64 PayloadOffset = LogReader->Tell();
+		const bool bIsValidType = TypeValue >= static_cast<uint8>(EPubnubChatStoreRecordType::User) && TypeValue <= static_cast<uint8>(EPubnubChatStoreRecordType::Message);
+		if (LogReader->IsError() || !bIsValidType || PayloadSize < 0 || PayloadOffset + PayloadSize > FileSize)
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("Persistent store log %s is broken at offset %lld, later records are dropped."), *LogFilePath, RecordOffset);
+			LogSize = RecordOffset;
+			return false;
+		}
+
+		//Content checksum is not known without deserializing the record, so the next write of the same data appends it once more
+		ApplyRecordToIndex(static_cast<EPubnubChatStoreRecordType>(TypeValue), Key, RemovedValue != 0, PayloadOffset, PayloadSize, PayloadOffset + PayloadSize - RecordOffset, 0);
+
+		RecordOffset = PayloadOffset + PayloadSize;
+		LogReader->Seek(RecordOffset);
+	}
+
+	LogSize = RecordOffset;
+	return true;
+}
+
+bool UPubnubChatFilePersistentStore::LoadIndex(int64& OutIndexedLogSize)
+{
+	TArray<uint8> IndexData;
+	if (!FFileHelper::LoadFileToArray(IndexData, *IndexFilePath, FILEREAD_Silent))
+	{ return false; }
+
+	FMemoryReader IndexReader(IndexData);
+	if (IndexData.Num() < FileHeaderSize || !ReadFileHeader(IndexReader, Pubnub_Chat_Persistent_Store_Index_Magic))
+	{ return false; }
+
+	int64 IndexedLogSize = 0;
+	int64 SavedAccessClock = 0;
+	int32 EntriesCount = 0;
+	IndexReader << IndexedLogSize << SavedAccessClock << EntriesCount;
+	if (IndexReader.IsError() || IndexedLogSize < FileHeaderSize || IndexedLogSize > LogSize || EntriesCount < 0)
+	{ return false; }
+
+	Entries.Reserve(EntriesCount);
+	for (int32 i = 0; i < EntriesCount; ++i)
+	{
+		FPubnubChatStoreEntry Entry;
+		uint8 TypeValue = 0;
+		IndexReader << TypeValue << Entry.Key << Entry.PayloadOffset << Entry.PayloadSize << Entry.RecordSize << Entry.ContentCrc << Entry.LastAccess;
+		if (IndexReader.IsError() || TypeValue < static_cast<uint8>(EPubnubChatStoreRecordType::User) || TypeValue > static_cast<uint8>(EPubnubChatStoreRecordType::Message)
+			|| Entry.PayloadOffset + Entry.PayloadSize > IndexedLogSize)
+		{ return false; }
+		Entry.Type = static_cast<EPubnubChatStoreRecordType>(TypeValue);
+
+		FString ChannelID;
+		int64 Timetoken = 0;
+		if (Entry.Type == EPubnubChatStoreRecordType::Message && SplitMessageID(Entry.Key, ChannelID, Timetoken))
+		{
+			ChannelMessages.FindOrAdd(ChannelID).Add(Timetoken);
+		}
+		Entries.Add(MakeEntryKey(Entry.Type, Entry.Key), MoveTemp(Entry));
+	}
+
+	for (TPair<FString, TArray<int64>>& ChannelTimetokens : ChannelMessages)
+	{
+		ChannelTimetokens.Value.Sort();
+	}
+
+	AccessClock = SavedAccessClock;
+	OutIndexedLogSize = IndexedLogSize;
+	return true;
+}
+
+void UPubnubChatFilePersistentStore::SaveIndex()
+{
+	TArray<uint8> IndexData;
+	FMemoryWriter IndexWriter(IndexData);
+	WriteFileHeader(IndexWriter, Pubnub_Chat_Persistent_Store_Index_Magic);
+
+	int32 EntriesCount = Entries.Num();
+	IndexWriter << LogSize << AccessClock << EntriesCount;
+	for (TPair<FString, FPubnubChatStoreEntry>& EntryPair : Entries)
+	{
+		FPubnubChatStoreEntry& Entry = EntryPair.Value;
+		uint8 TypeValue = static_cast<uint8>(Entry.Type);
+		IndexWriter << TypeValue << Entry.Key << Entry.PayloadOffset << Entry.PayloadSize << Entry.RecordSize << Entry.ContentCrc << Entry.LastAccess;
+	}
+
+	if (!FFileHelper::SaveArrayToFile(IndexData, *IndexFilePath))
+	{
+		UE_LOG(PubnubChatLog, Warning, TEXT("Failed to save persistent store index %s, it will be rebuilt from the log."), *IndexFilePath);
+	}
+}
+
+void UPubnubChatFilePersistentStore::Compact()
+{
+	FlushLogWriter();
+	LogWriter.Reset();
+
+	IFileManager& FileManager = IFileManager::Get();
+
+	//Most recently used entries are kept until the target size is reached
+	TArray<const FPubnubChatStoreEntry*> SortedEntries;
+	SortedEntries.Reserve(Entries.Num());
+	for (const TPair<FString, FPubnubChatStoreEntry>& EntryPair : Entries)
+	{
+		SortedEntries.Add(&EntryPair.Value);
+	}
+	SortedEntries.Sort([](const FPubnubChatStoreEntry& A, const FPubnubChatStoreEntry& B)
+	{
+		return A.LastAccess > B.LastAccess;
+	});
+
+	const int64 TargetSize = MaxStoreSize * Pubnub_Chat_Persistent_Store_Compaction_Target_Percent / 100;
+	int64 KeptSize = FileHeaderSize;
+	TArray<const FPubnubChatStoreEntry*> KeptEntries;
+	for (const FPubnubChatStoreEntry* Entry : SortedEntries)
+	{
+		if (KeptSize + Entry->RecordSize > TargetSize)
+		{ break; }
+
+		KeptSize += Entry->RecordSize;
+		KeptEntries.Add(Entry);
+	}
+
+	//Records of the same channel are written next to each other and ordered by timetoken, so history ranges map as one small region
+	KeptEntries.Sort([](const FPubnubChatStoreEntry& A, const FPubnubChatStoreEntry& B)
+	{
+		return A.Type != B.Type ? A.Type < B.Type : A.Key < B.Key;
+	});
+
+	const FString CompactedLogFilePath = LogFilePath + TEXT(".tmp");
+	TMap<FString, FPubnubChatStoreEntry> CompactedEntries;
+	int64 CompactedLogSize = FileHeaderSize;
+	bool bCompacted = false;
+	{
+		TUniquePtr<FArchive> CompactedLogWriter(FileManager.CreateFileWriter(*CompactedLogFilePath));
+		if (CompactedLogWriter)
+		{
+			WriteFileHeader(*CompactedLogWriter, Pubnub_Chat_Persistent_Store_Log_Magic);
+			bCompacted = ReadPayloads(KeptEntries, [&CompactedLogWriter, &CompactedEntries, &CompactedLogSize](const FPubnubChatStoreEntry& Entry, TArrayView<const uint8> Payload)
+			{
+				TArray<uint8> RecordHeader;
+				FMemoryWriter RecordHeaderWriter(RecordHeader);
+				SerializeRecordHeader(RecordHeaderWriter, Entry.Type, Entry.Key, false, Payload.Num());
+				CompactedLogWriter->Serialize(RecordHeader.GetData(), RecordHeader.Num());
+				CompactedLogWriter->Serialize(const_cast<uint8*>(Payload.GetData()), Payload.Num());
+
+				FPubnubChatStoreEntry CompactedEntry = Entry;
+				CompactedEntry.PayloadOffset = CompactedLogSize + RecordHeader.Num();
+				CompactedEntry.RecordSize = RecordHeader.Num() + Payload.Num();
+				CompactedLogSize += CompactedEntry.RecordSize;
+				CompactedEntries.Add(MakeEntryKey(Entry.Type, Entry.Key), MoveTemp(CompactedEntry));
+			});
+			bCompacted = CompactedLogWriter->Close() && bCompacted;
+		}
+	}
+
+	if (bCompacted && FileManager.Move(*LogFilePath, *CompactedLogFilePath, true, true))
+	{
+		Entries = MoveTemp(CompactedEntries);
+		LogSize = CompactedLogSize;
+
+		ChannelMessages.Empty();
+		for (const TPair<FString, FPubnubChatStoreEntry>& EntryPair : Entries)
+		{
+			FString ChannelID;
+			int64 Timetoken = 0;
+			if (EntryPair.Value.Type == EPubnubChatStoreRecordType::Message && SplitMessageID(EntryPair.Value.Key, ChannelID, Timetoken))
+			{
+				ChannelMessages.FindOrAdd(ChannelID).Add(Timetoken);
+			}
+		}
+		for (TPair<FString, TArray<int64>>& ChannelTimetokens : ChannelMessages)
+		{
+			ChannelTimetokens.Value.Sort();
+		}
+	}
+	else
+	{
+		UE_LOG(PubnubChatLog, Warning, TEXT("Failed to compact persistent store log %s."), *LogFilePath);
+		FileManager.Delete(*CompactedLogFilePath, false, true, true);
+		//Old log stays, new records are appended at its real end
+		LogSize = FileManager.FileSize(*LogFilePath);
+	}
+
+	LogWriter.Reset(FileManager.CreateFileWriter(*LogFilePath, FILEWRITE_Append | FILEWRITE_AllowRead));
+	if (!LogWriter)
+	{
+		UE_LOG(PubnubChatLog, Warning, TEXT("Failed to open persistent store log %s, store is closed."), *LogFilePath);
+		Entries.Empty();
+		ChannelMessages.Empty();
+		bIsOpen = false;
+	}
+}
+
+void UPubnubChatFilePersistentStore::FlushLogWriter()
+{
+	if (LogWriter && bHasUnflushedWrites)
+	{
+		LogWriter->Flush();
+		bHasUnflushedWrites = false;
+	}
+}
+
+void UPubnubChatFilePersistentStore::ScheduleCompactionIfNeeded()
+{
+	if (bCompactionScheduled || LogSize <= MaxStoreSize)
+	{ return; }
+
+	//Compaction rewrites the whole log, so it never runs on the thread that writes the data. It's a single task at a time, guarded by bCompactionScheduled.
+	//Store is kept alive until the task finishes - a weak pointer could be collected while the log is being rewritten
+	bCompactionScheduled = true;
+	TStrongObjectPtr<UPubnubChatFilePersistentStore> StrongThis(this);
+	Async(EAsyncExecution::ThreadPool, [StrongThis = MoveTemp(StrongThis)]
+	{
+		StrongThis->CompactStore();
+	});
+}
+
+TUniquePtr<IMappedFileHandle> UPubnubChatFilePersistentStore::OpenMappedLog() const
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+#if UE_VERSION_OLDER_THAN(5, 3, 0)
+	return TUniquePtr<IMappedFileHandle>(PlatformFile.OpenMapped(*LogFilePath));
+#else
+	FOpenMappedResult OpenResult = PlatformFile.OpenMappedEx(*LogFilePath);
+	if (OpenResult.HasError())
+	{ return nullptr; }
+	return OpenResult.StealValue();
+#endif
+}
+
+void UPubnubChatFilePersistentStore::WriteFileHeader(FArchive& Ar, uint32 Magic)
+{
+	uint32 MagicValue = Magic;
+	int32 Version = Pubnub_Chat_Persistent_Store_Version;
+	uint32 LayoutHash = GetStoredStructsLayoutHash();
+	Ar << MagicValue << Version << LayoutHash;
+}
+
+bool UPubnubChatFilePersistentStore::ReadFileHeader(FArchive& Ar, uint32 Magic)
+{
+	uint32 MagicValue = 0;
+	int32 Version = 0;
+	uint32 LayoutHash = 0;
+	Ar << MagicValue << Version << LayoutHash;
+	return !Ar.IsError() && MagicValue == Magic && Version == Pubnub_Chat_Persistent_Store_Version && LayoutHash == GetStoredStructsLayoutHash();
+}
+
+void UPubnubChatFilePersistentStore::SerializeRecordHeader(FArchive& Ar, EPubnubChatStoreRecordType Type, const FString& Key, bool bRemoved, int32 PayloadSize)
+{
+	uint8 TypeValue = static_cast<uint8>(Type);
+	uint8 RemovedValue = bRemoved ? 1 : 0;
+	FString KeyValue = Key;
+	Ar << TypeValue << RemovedValue << KeyValue << PayloadSize;
+}
+
+FString UPubnubChatFilePersistentStore::MakeEntryKey(EPubnubChatStoreRecordType Type, const FString& Key)
+{
+	return FString::Printf(TEXT("%d:%s"), static_cast<int32>(Type), *Key);
+}
+
+bool UPubnubChatFilePersistentStore::SplitMessageID(const FString& MessageID, FString& OutChannelID, int64& OutTimetoken)
+{
+	//ChannelID can contain dots, timetoken can't
+	int32 SeparatorIndex = INDEX_NONE;
+	if (!MessageID.FindLastChar(TEXT('.'), SeparatorIndex))
+	{ return false; }
+
+	OutChannelID = MessageID.Left(SeparatorIndex);
+	return UPubnubChatInternalUtilities::TryParseTimetoken(MessageID.Mid(SeparatorIndex + 1), OutTimetoken);
+}
+
+FString UPubnubChatFilePersistentStore::MakeMessageID(const FString& ChannelID, int64 Timetoken)
+{
+	return FString::Printf(TEXT("%s.%s"), *ChannelID, *UPubnubChatInternalUtilities::Int64ToTimetoken(Timetoken));
+}
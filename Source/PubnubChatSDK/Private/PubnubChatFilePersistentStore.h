@@ -0,0 +1,138 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "PubnubChatPersistentStore.h"
+#include "PubnubChatFilePersistentStore.generated.h"
+
+class IMappedFileHandle;
+
+/** Kinds of records kept in the persistent store log */
+enum class EPubnubChatStoreRecordType : uint8
+{
+	User = 1,
+	Channel = 2,
+	Message = 3
+};
+
+/** Location of the newest record of a single stored object in the log */
+struct FPubnubChatStoreEntry
+{
+	EPubnubChatStoreRecordType Type = EPubnubChatStoreRecordType::User;
+	FString Key = "";
+	/** Offset of the record payload in the log file */
+	int64 PayloadOffset = 0;
+	int32 PayloadSize = 0;
+	/** Size of the whole record (header and payload), used for compaction */
+	int32 RecordSize = 0;
+	/** Checksum of the stored content, so writing the same data again doesn't append a new record. 0 if unknown (entry was rebuilt from the log) */
+	uint32 ContentCrc = 0;
+	/** Value of the store access clock when the entry was last written or read, used for LRU compaction */
+	int64 LastAccess = 0;
+};
+
+/**
+ * Persistent store kept in an append-only log file with an index file next to it.
+ * Every write appends a compact binary record (untagged serialization of the FPubnubChatInternal* struct) to the log,
+ * and the in-memory index points to the newest record of every object. The index is saved when the store is closed,
+ * after a crash it's rebuilt from the log. When the log grows over the maximum size, it's rewritten with only
+ * the most recently used objects, grouped by channel so history ranges are read from a single memory-mapped region.
+ *
+ * This is an internal class and should not be used directly. Configure it with FPubnubChatConfig::PersistentStore.
+ */
+UCLASS()
+class PUBNUBCHATSDK_API UPubnubChatFilePersistentStore : public UPubnubChatPersistentStore
+{
+	GENERATED_BODY()
+
+public:
+	virtual void BeginDestroy() override;
+
+	virtual bool OpenStore(const FString& StoreDirectory, int64 MaxSizeBytes) override;
+	virtual void CloseStore() override;
+
+	virtual void StoreUser(const FPubnubChatInternalUser& User) override;
+	virtual bool LoadUser(const FString& UserID, FPubnubChatInternalUser& OutUser) override;
+	virtual void RemoveUser(const FString& UserID) override;
+
+	virtual void StoreChannel(const FPubnubChatInternalChannel& Channel) override;
+	virtual bool LoadChannel(const FString& ChannelID, FPubnubChatInternalChannel& OutChannel) override;
+	virtual void RemoveChannel(const FString& ChannelID) override;
+
+	virtual void StoreMessages(const TArray<FPubnubChatInternalMessage>& Messages) override;
+	virtual void RemoveMessage(const FString& MessageID) override;
+	virtual void LoadMessages(const FString& ChannelID, int64 StartTimetoken, int64 EndTimetoken, int Count, TArray<FPubnubChatInternalMessage>& OutMessages) override;
+	virtual void ReconcileMessages(const FString& ChannelID, int64 StartTimetoken, int64 EndTimetoken, const TSet<int64>& ServerTimetokens) override;
+
+	/** Rewrites the log with only the most recently used objects that fit into the compaction target size. */
+	void CompactStore();
+
+	/** Current size of the log file in bytes */
+	int64 GetStoreSize() const;
+
+	/** Hash of the layout of all stored structs - stores written with other layout are discarded, as records are serialized untagged */
+	static uint32 GetStoredStructsLayoutHash();
+
+private:
+	FString LogFilePath = "";
+	FString IndexFilePath = "";
+	int64 MaxStoreSize = 0;
+	bool bIsOpen = false;
+
+	TUniquePtr<FArchive> LogWriter;
+	int64 LogSize = 0;
+	bool bHasUnflushedWrites = false;
+	bool bCompactionScheduled = false;
+
+	/** Newest record of every stored object, keyed with MakeEntryKey */
+	TMap<FString, FPubnubChatStoreEntry> Entries;
+	/** Sorted (oldest first) timetokens of stored messages of every channel */
+	TMap<FString, TArray<int64>> ChannelMessages;
+	/** Increased on every access, so entries can be ordered from least to most recently used */
+	int64 AccessClock = 0;
+
+	mutable FCriticalSection StoreCriticalSection;
+
+	/**
+	 * Serializes given struct to a record payload and appends it, unless the newest record has the same content.
+	 * Content is the data part of the struct, so bookkeeping fields like Version don't cause rewrites. Has to be called with StoreCriticalSection locked
+	 */
+	void StoreRecord(EPubnubChatStoreRecordType Type, const FString& Key, const UScriptStruct* Struct, const void* Data, const UScriptStruct* ContentStruct, const void* ContentData);
+	/** Finds newest record of given object and deserializes it to given struct. Has to be called with StoreCriticalSection locked */
+	bool LoadRecord(EPubnubChatStoreRecordType Type, const FString& Key, const UScriptStruct* Struct, void* OutData);
+	/** Appends removal record of given object. Has to be called with StoreCriticalSection locked */
+	void RemoveRecord(EPubnubChatStoreRecordType Type, const FString& Key);
+
+	/** Appends a record to the log and returns offset of its payload. Has to be called with StoreCriticalSection locked */
+	int64 AppendRecord(EPubnubChatStoreRecordType Type, const FString& Key, bool bRemoved, TArrayView<const uint8> Payload, int32& OutRecordSize);
+	/** Applies a record read from the log or appended to it to the index. Has to be called with StoreCriticalSection locked */
+	void ApplyRecordToIndex(EPubnubChatStoreRecordType Type, const FString& Key, bool bRemoved, int64 PayloadOffset, int32 PayloadSize, int32 RecordSize, uint32 ContentCrc);
+	/**
+	 * Reads payloads of given entries, memory-mapping the log region that contains all of them.
+	 * Falls back to regular file reads on platforms where the log can't be mapped. Has to be called with StoreCriticalSection locked
+	 */
+	bool ReadPayloads(const TArray<const FPubnubChatStoreEntry*>& EntriesToRead, TFunctionRef<void(const FPubnubChatStoreEntry&, TArrayView<const uint8>)> PayloadCallback);
+
+	/** Reads records of the log starting from given offset into the index. @return False if the log has a broken record */
+	bool ScanLog(int64 StartOffset);
+	bool LoadIndex(int64& OutIndexedLogSize);
+	void SaveIndex();
+	/** Has to be called with StoreCriticalSection locked */
+	void Compact();
+	/** Has to be called with StoreCriticalSection locked */
+	void FlushLogWriter();
+	/** Has to be called with StoreCriticalSection locked */
+	void ScheduleCompactionIfNeeded();
+	TUniquePtr<IMappedFileHandle> OpenMappedLog() const;
+
+	static constexpr int32 FileHeaderSize = sizeof(uint32) + sizeof(int32) + sizeof(uint32);
+	static void WriteFileHeader(FArchive& Ar, uint32 Magic);
+	static bool ReadFileHeader(FArchive& Ar, uint32 Magic);
+	static void SerializeRecordHeader(FArchive& Ar, EPubnubChatStoreRecordType Type, const FString& Key, bool bRemoved, int32 PayloadSize);
+	static FString MakeEntryKey(EPubnubChatStoreRecordType Type, const FString& Key);
+	/** Splits composite MessageID ("[ChannelID].[Timetoken]") */
+	static bool SplitMessageID(const FString& MessageID, FString& OutChannelID, int64& OutTimetoken);
+	static FString MakeMessageID(const FString& ChannelID, int64 Timetoken);
+};
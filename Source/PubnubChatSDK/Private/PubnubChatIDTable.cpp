@@ -0,0 +1,121 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatIDTable.h"
+#include "PubnubChatStats.h"
+#include "Misc/Crc.h"
+
+FPubnubChatIDHandle FPubnubChatIDTable::Intern(FStringView ID)
+{
+	if (ID.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	const uint32 Hash = HashID(ID);
+	LLM_SCOPE_BYTAG(PubnubChat_Repository);
+	//Write lock also for IDs that are already interned, as the reference count changes
+	FWriteScopeLock WriteLock(Lock);
+
+	FPubnubChatIDHandle Handle = FindLocked(ID, Hash);
+	if (Handle == INDEX_NONE)
+	{
+		if (!FreeHandles.IsEmpty())
+		{
+			Handle = FreeHandles.Pop();
+			IDs[Handle] = ID;
+		}
+		else
+		{
+			Handle = IDs.Emplace(ID);
+			ReferenceCounts.Add(0);
+		}
+		HandlesByHash.Add(Hash, Handle);
+	}
+	++ReferenceCounts[Handle];
+	return Handle;
+}
+
+void FPubnubChatIDTable::AddReference(FPubnubChatIDHandle Handle)
+{
+	FWriteScopeLock WriteLock(Lock);
+	if (ReferenceCounts.IsValidIndex(Handle) && ReferenceCounts[Handle] > 0)
+	{
+		++ReferenceCounts[Handle];
+	}
+}
+
+void FPubnubChatIDTable::Release(FPubnubChatIDHandle Handle)
+{
+	FWriteScopeLock WriteLock(Lock);
+	if (!ReferenceCounts.IsValidIndex(Handle) || ReferenceCounts[Handle] <= 0)
+	{
+		return;
+	}
+
+	if (--ReferenceCounts[Handle] == 0)
+	{
+		HandlesByHash.RemoveSingle(HashID(IDs[Handle]), Handle);
+		IDs[Handle].Empty();
+		FreeHandles.Add(Handle);
+	}
+}
+
+FPubnubChatIDHandle FPubnubChatIDTable::Find(FStringView ID) const
+{
+	if (ID.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	FReadScopeLock ReadLock(Lock);
+	return FindLocked(ID, HashID(ID));
+}
+
+FString FPubnubChatIDTable::Resolve(FPubnubChatIDHandle Handle) const
+{
+	FReadScopeLock ReadLock(Lock);
+	return IDs.IsValidIndex(Handle) ? IDs[Handle] : FString();
+}
+
+int32 FPubnubChatIDTable::Num() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return IDs.Num() - FreeHandles.Num();
+}
+
+int64 FPubnubChatIDTable::GetMemorySize() const
+{
+	FReadScopeLock ReadLock(Lock);
+	int64 Size = IDs.GetAllocatedSize() + ReferenceCounts.GetAllocatedSize() + FreeHandles.GetAllocatedSize() + HandlesByHash.GetAllocatedSize();
+	for (const FString& ID : IDs)
+	{
+		Size += ID.GetAllocatedSize();
+	}
+	return Size;
+}
+
+void FPubnubChatIDTable::Clear()
+{
+	FWriteScopeLock WriteLock(Lock);
+	IDs.Empty();
+	ReferenceCounts.Empty();
+	FreeHandles.Empty();
+	HandlesByHash.Empty();
+}
+
+FPubnubChatIDHandle FPubnubChatIDTable::FindLocked(FStringView ID, uint32 Hash) const
+{
+	for (auto It = HandlesByHash.CreateConstKeyIterator(Hash); It; ++It)
+	{
+		if (FStringView(IDs[It.Value()]).Equals(ID, ESearchCase::CaseSensitive))
+		{
+			return It.Value();
+		}
+	}
+	return INDEX_NONE;
+}
+
+uint32 FPubnubChatIDTable::HashID(FStringView ID)
+{
+	return FCrc::MemCrc32(ID.GetData(), ID.Len() * sizeof(TCHAR));
+}
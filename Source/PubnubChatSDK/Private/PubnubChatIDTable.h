@@ -0,0 +1,81 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+
+/** Handle of an ID interned in FPubnubChatIDTable. Handles are only valid in the table that created them */
+typedef int32 FPubnubChatIDHandle;
+
+/** Key of a message in the repository: interned ChannelID and numeric timetoken, instead of the composite "[ChannelID].[Timetoken]" string */
+struct FPubnubChatMessageKey
+{
+	FPubnubChatIDHandle ChannelHandle = INDEX_NONE;
+	int64 Timetoken = 0;
+
+	bool operator==(const FPubnubChatMessageKey& Other) const
+	{
+		return ChannelHandle == Other.ChannelHandle && Timetoken == Other.Timetoken;
+	}
+
+	friend uint32 GetTypeHash(const FPubnubChatMessageKey& Key)
+	{
+		return HashCombineFast(::GetTypeHash(Key.ChannelHandle), ::GetTypeHash(Key.Timetoken));
+	}
+};
+
+/**
+ * Table of interned IDs (users, channels, memberships). Every distinct ID string is stored once and referenced by a stable int32 handle,
+ * so repository maps hash and compare integers instead of strings. IDs are compared case-sensitively, as PubNub IDs are case-sensitive.
+ * Lookups don't allocate. IDs are reference counted: an ID is removed when its last reference is released, and its handle is reused for IDs interned later.
+ * All functions are thread-safe.
+ *
+ * This is an internal class and should not be used directly.
+ */
+class PUBNUBCHATSDK_API FPubnubChatIDTable
+{
+public:
+	/**
+	 * Adds a reference of the ID, which has to be released with Release.
+	 * @return Handle of the ID, added to the table if it's not there yet. INDEX_NONE for empty ID
+	 */
+	FPubnubChatIDHandle Intern(FStringView ID);
+
+	/** Adds a reference of already interned ID. Caller has to hold a reference of it, so the handle can't be reused meanwhile */
+	void AddReference(FPubnubChatIDHandle Handle);
+
+	/** Releases a reference of the ID. After the last one the ID is removed and the handle can be given to other ID. Invalid handles are ignored */
+	void Release(FPubnubChatIDHandle Handle);
+
+	/** @return Handle of the ID, or INDEX_NONE if it's not interned. Doesn't add a reference */
+	FPubnubChatIDHandle Find(FStringView ID) const;
+
+	/** @return Copy of the interned ID, empty string for invalid handle */
+	FString Resolve(FPubnubChatIDHandle Handle) const;
+
+	/** @return Number of interned IDs that have references */
+	int32 Num() const;
+	/** Approximate memory used by the interned strings and the lookup */
+	int64 GetMemorySize() const;
+
+	/** Removes all IDs, also the ones that still have references. Handles returned before are no longer valid */
+	void Clear();
+
+private:
+	/** Has to be called with the lock taken */
+	FPubnubChatIDHandle FindLocked(FStringView ID, uint32 Hash) const;
+
+	static uint32 HashID(FStringView ID);
+
+	/** Interned IDs, handle is the index. Released IDs are empty */
+	TArray<FString> IDs;
+	/** Reference counts of interned IDs, matching IDs by index */
+	TArray<int32> ReferenceCounts;
+	/** Handles of released IDs, reused before IDs grows */
+	TArray<FPubnubChatIDHandle> FreeHandles;
+	/** Handles by case-sensitive hash of the ID. Multi map, so hash collisions are resolved by comparing the strings */
+	TMultiMap<uint32, FPubnubChatIDHandle> HandlesByHash;
+
+	mutable FRWLock Lock;
+};
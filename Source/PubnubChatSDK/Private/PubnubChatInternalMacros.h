@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "PubnubChatRetryPolicy.h"
 
 
 #define PUBNUB_CHAT_RETURN_WRAPPER_IF_NOT_INITIALIZED(ReturnWrapper) \
@@ -209,6 +210,9 @@
 		} \
 	} while (false)
 
+#define PUBNUB_CHAT_CALL_WITH_RETRY(RetryPolicy, OperationType, StepName, OperationResult, ...) \
+	FPubnubChatRetryPolicy::Execute(RetryPolicy, EPubnubChatRetryOperationType::OperationType, TEXT(StepName), OperationResult, [&]() { return __VA_ARGS__; })
+
 #define PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(ReturnWrapper, PubnubResult, MethodName) \
 	do { \
 		ReturnWrapper.Result.AddStep(MethodName, PubnubResult); \
@@ -255,7 +259,7 @@
 			UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage); \
 			ReturnWrapper.Result = FPubnubChatOperationResult::CreateError(ErrorLogMessage); \
 			UPubnubUtilities::CallPubnubDelegate(Delegate, ReturnWrapper); \
-			return; \
+			return FPubnubChatAsyncHandle(); \
 		} \
 		if (!AsyncFunctionsThread) \
 		{ \
@@ -263,7 +267,7 @@
 			UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage); \
 			ReturnWrapper.Result = FPubnubChatOperationResult::CreateError(ErrorLogMessage); \
 			UPubnubUtilities::CallPubnubDelegate(Delegate, ReturnWrapper); \
-			return; \
+			return FPubnubChatAsyncHandle(); \
 		} \
 	} while (false)
 
@@ -275,7 +279,7 @@
 			UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage); \
 			ReturnWrapper.Result = FPubnubChatOperationResult::CreateError(ErrorLogMessage); \
 			UPubnubUtilities::CallPubnubDelegate(Delegate, ReturnWrapper); \
-			return; \
+			return FPubnubChatAsyncHandle(); \
 		} \
 		if (!PubnubClient) \
 		{ \
@@ -283,7 +287,7 @@
 			UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage); \
 			ReturnWrapper.Result = FPubnubChatOperationResult::CreateError(ErrorLogMessage); \
 			UPubnubUtilities::CallPubnubDelegate(Delegate, ReturnWrapper); \
-			return; \
+			return FPubnubChatAsyncHandle(); \
 		} \
 		if (!Chat) \
 		{ \
@@ -291,7 +295,7 @@
 			UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage); \
 			ReturnWrapper.Result = FPubnubChatOperationResult::CreateError(ErrorLogMessage); \
 			UPubnubUtilities::CallPubnubDelegate(Delegate, ReturnWrapper); \
-			return; \
+			return FPubnubChatAsyncHandle(); \
 		} \
 		if (!Chat->AsyncFunctionsThread) \
 		{ \
@@ -299,7 +303,7 @@
 			UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage); \
 			ReturnWrapper.Result = FPubnubChatOperationResult::CreateError(ErrorLogMessage); \
 			UPubnubUtilities::CallPubnubDelegate(Delegate, ReturnWrapper); \
-			return; \
+			return FPubnubChatAsyncHandle(); \
 		} \
 	} while (false)
 
@@ -310,14 +314,14 @@
 			FString ErrorLogMessage = FString::Printf(TEXT("[%s]: Not initialized. Aborting operation. This object was already destroyed or was not initialized correctly."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__))); \
 			UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage); \
 			UPubnubUtilities::CallPubnubDelegate(Delegate, FPubnubChatOperationResult::CreateError(ErrorLogMessage)); \
-			return; \
+			return FPubnubChatAsyncHandle(); \
 		} \
 		if (!AsyncFunctionsThread) \
 		{ \
 			FString ErrorLogMessage = FString::Printf(TEXT("[%s]: AsyncFunctionsThread is invalid. Aborting operation. This object was already destroyed or was not initialized correctly."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__))); \
 			UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage); \
 			UPubnubUtilities::CallPubnubDelegate(Delegate, FPubnubChatOperationResult::CreateError(ErrorLogMessage)); \
-			return; \
+			return FPubnubChatAsyncHandle(); \
 		} \
 	} while (false)
 
@@ -329,27 +333,27 @@
 			FString ErrorLogMessage = FString::Printf(TEXT("[%s]: Not initialized. Aborting operation. This object was already destroyed or was not initialized correctly."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__))); \
 			UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage); \
 			UPubnubUtilities::CallPubnubDelegate(Delegate, FPubnubChatOperationResult::CreateError(ErrorLogMessage)); \
-			return; \
+			return FPubnubChatAsyncHandle(); \
 		} \
 		if (!PubnubClient) \
 		{ \
 			FString ErrorLogMessage = FString::Printf(TEXT("[%s]: Pubnub Client is invalid. Aborting operation. This object was already destroyed or was not initialized correctly."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__))); \
 			UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage); \
 			UPubnubUtilities::CallPubnubDelegate(Delegate, FPubnubChatOperationResult::CreateError(ErrorLogMessage)); \
-			return; \
+			return FPubnubChatAsyncHandle(); \
 		} \
 		if (!Chat) \
 		{ \
 			FString ErrorLogMessage = FString::Printf(TEXT("[%s]: Chat is invalid. Aborting operation. This object was already destroyed or was not initialized correctly."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__))); \
 			UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage); \
 			UPubnubUtilities::CallPubnubDelegate(Delegate, FPubnubChatOperationResult::CreateError(ErrorLogMessage)); \
-			return; \
+			return FPubnubChatAsyncHandle(); \
 		} \
 		if (!Chat->AsyncFunctionsThread) \
 		{ \
 			FString ErrorLogMessage = FString::Printf(TEXT("[%s]: AsyncFunctionsThread is invalid. Aborting operation. This object was already destroyed or was not initialized correctly."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__))); \
 			UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage); \
 			UPubnubUtilities::CallPubnubDelegate(Delegate, FPubnubChatOperationResult::CreateError(ErrorLogMessage)); \
-			return; \
+			return FPubnubChatAsyncHandle(); \
 		} \
 	} while (false)
\ No newline at end of file
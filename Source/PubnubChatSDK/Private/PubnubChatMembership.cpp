@@ -7,10 +7,13 @@
 #include "PubnubChatInternalMacros.h"
 #include "PubnubChatSubsystem.h"
 #include "PubnubChatObjectsRepository.h"
+#include "PubnubChatOutbox.h"
+#include "PubnubChatReadMarkerWriter.h"
 #include "PubnubChatUser.h"
 #include "PubnubChatChannel.h"
 #include "PubnubChatConst.h"
 #include "PubnubChatMessage.h"
+#include "PubnubChatUpdatesStream.h"
 #include "FunctionLibraries/PubnubChatInternalUtilities.h"
 #include "FunctionLibraries/PubnubChatLogUtilities.h"
 #include "FunctionLibraries/PubnubJsonUtilities.h"
@@ -52,6 +55,13 @@ FPubnubChatMembershipData UPubnubChatMembership::GetMembershipData() const
 	return FPubnubChatMembershipData();
 }
 
+int64 UPubnubChatMembership::GetDataVersion() const
+{
+	PUBNUB_CHAT_OBJECT_RETURN_IF_NOT_INITIALIZED(0);
+
+	return Chat->ObjectsRepository->GetMembershipDataVersion(GetInternalMembershipID());
+}
+
 FString UPubnubChatMembership::GetUserID() const
 {
 	return User ? User->GetUserID() : TEXT("");
@@ -64,7 +74,17 @@ FString UPubnubChatMembership::GetChannelID() const
 
 FString UPubnubChatMembership::GetLastReadMessageTimetoken() const
 {
-	return UPubnubChatInternalUtilities::GetLastReadMessageTimetokenFromMembershipData(GetMembershipData());
+	//Repository keeps the timetoken parsed, so reading it doesn't copy the whole MembershipData
+	int64 StoredTimetokenValue = 0;
+	const FString StoredTimetoken = Chat && Chat->ObjectsRepository && Chat->ObjectsRepository->TryGetLastReadMessageTimetoken(GetInternalMembershipID(), StoredTimetokenValue)
+		? UPubnubChatInternalUtilities::Int64ToTimetoken(StoredTimetokenValue) : FString();
+
+	//Marker that is not written yet is returned right away, even if membership data was updated from the server in the meantime
+	if (Chat && Chat->ReadMarkerWriter)
+	{
+		return Chat->ReadMarkerWriter->ApplyPendingReadMarker(GetInternalMembershipID(), StoredTimetoken);
+	}
+	return StoredTimetoken;
 }
 
 FPubnubChatOperationResult UPubnubChatMembership::Delete()
@@ -73,13 +93,13 @@ FPubnubChatOperationResult UPubnubChatMembership::Delete()
 	FPubnubChatOperationResult FinalResult;
 	
 	//RemoveMemberships by PubnubClient
-	FPubnubMembershipsResult RemoveMembershipResult = PubnubClient->RemoveMemberships(GetUserID(), {GetChannelID()}, FPubnubMembershipInclude::FromValue(false), 1);
+	FPubnubMembershipsResult RemoveMembershipResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Write, "RemoveMemberships", FinalResult, PubnubClient->RemoveMemberships(GetUserID(), {GetChannelID()}, FPubnubMembershipInclude::FromValue(false), 1));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, RemoveMembershipResult.Result, "RemoveMemberships");
 
 	return FinalResult;
 }
 
-void UPubnubChatMembership::DeleteAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatMembership::DeleteAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -87,23 +107,28 @@ void UPubnubChatMembership::DeleteAsync(FOnPubnubChatOperationResponse OnOperati
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	DeleteAsync(NativeCallback);
+	return DeleteAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMembership::DeleteAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMembership::DeleteAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatMembership> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult DeleteResult = WeakThis.Get()->Delete();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, DeleteResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatMembership::Update(const FPubnubChatUpdateMembershipInputData& UpdateMembershipData)
@@ -113,7 +138,7 @@ FPubnubChatOperationResult UPubnubChatMembership::Update(const FPubnubChatUpdate
 
 	//SetMemberships by PubnubClient
 	FString Filter = UPubnubChatInternalUtilities::GetFilterForChannelID(GetChannelID());
-	FPubnubMembershipsResult SetMembershipResult = PubnubClient->SetMemberships(GetUserID(), {UpdateMembershipData.ToPubnubMembershipInputData(GetChannelID())}, FPubnubMembershipInclude::FromValue(true), 1, Filter);
+	FPubnubMembershipsResult SetMembershipResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Write, "SetMemberships", FinalResult, PubnubClient->SetMemberships(GetUserID(), {UpdateMembershipData.ToPubnubMembershipInputData(GetChannelID())}, FPubnubMembershipInclude::FromValue(true), 1, Filter));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, SetMembershipResult.Result, "SetMemberships");
 	
 	//This should never happen in case of successful SetMemberships, but check just in case
@@ -125,12 +150,12 @@ FPubnubChatOperationResult UPubnubChatMembership::Update(const FPubnubChatUpdate
 	}
 
 	//Update repository with updated membership data
-	Chat->ObjectsRepository->UpdateMembershipData(GetInternalMembershipID(), FPubnubChatMembershipData::FromPubnubMembershipData(SetMembershipResult.MembershipsData[0]));
+	Chat->ObjectsRepository->UpdateMembershipData(GetInternalMembershipID(), FPubnubChatMembershipData::FromPubnubMembershipData(SetMembershipResult.MembershipsData[0]), SetMembershipResult.MembershipsData[0].Updated);
 	
 	return FinalResult;
 }
 
-void UPubnubChatMembership::UpdateAsync(const FPubnubChatUpdateMembershipInputData& UpdateMembershipData, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatMembership::UpdateAsync(const FPubnubChatUpdateMembershipInputData& UpdateMembershipData, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -138,23 +163,28 @@ void UPubnubChatMembership::UpdateAsync(const FPubnubChatUpdateMembershipInputDa
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	UpdateAsync(UpdateMembershipData, NativeCallback);
+	return UpdateAsync(UpdateMembershipData, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMembership::UpdateAsync(const FPubnubChatUpdateMembershipInputData& UpdateMembershipData, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMembership::UpdateAsync(const FPubnubChatUpdateMembershipInputData& UpdateMembershipData, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatMembership> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, UpdateMembershipData, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, UpdateMembershipData, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult UpdateResult = WeakThis.Get()->Update(UpdateMembershipData);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, UpdateResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatMembership::SetLastReadMessageTimetoken(const FString Timetoken)
@@ -163,37 +193,43 @@ FPubnubChatOperationResult UPubnubChatMembership::SetLastReadMessageTimetoken(co
 	PUBNUB_CHAT_OBJECT_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
 	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(Timetoken);
 
-	//Add Timetoken to MembershipData
-	FPubnubChatMembershipData MembershipData = GetMembershipData();
-	UPubnubChatInternalUtilities::AddLastReadMessageTimetokenToMembershipData(MembershipData, Timetoken);
-
-	//Update Membership with new data
-	FPubnubChatOperationResult UpdateResult = Update(FPubnubChatUpdateMembershipInputData::FromChatMembershipData(MembershipData));
-	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, UpdateResult);
+	//Marker never moves back, so there is nothing to write
+	if (!UPubnubChatReadMarkerWriter::IsNewerTimetoken(Timetoken, GetLastReadMessageTimetoken()))
+	{
+		//It's not an error, but add it to the result
+		FinalResult.AddStep("SetLastReadMessageTimetoken", FPubnubOperationResult({0, false, TEXT("Timetoken is not newer than the last read message timetoken, nothing to write.")}));
+		return FinalResult;
+	}
 
-	//Send Receipt event if it specified for this channel type in config
-	if (UPubnubChatInternalUtilities::CanEmitReceiptEvent(Channel->GetChannelData().Type, Chat->ChatConfig))
+	//While offline, update is queued in the outbox. Receipt permissions are checked now, with the current token
+	if (Chat->Outbox && Chat->Outbox->ShouldQueue(GetChannelID()))
 	{
-		//Check if event can be emitted with provided AccessToken
-		bool CanIEmit = Chat->AccessManager->CanI(EPubnubChatAccessManagerPermission::PCAMP_Write, EPubnubChatAccessManagerResourceType::PCAMRT_Channels, GetChannelID());
-		FPubnubChatOperationResult EmitEventResult;
-		if(CanIEmit)
+		//Add Timetoken to the stored MembershipData, so the update is sent with Custom fields that arrived in the meantime
+		FPubnubChatMembershipData MembershipData;
+		Chat->ObjectsRepository->MutateMembershipData(GetInternalMembershipID(), [&](FPubnubChatMembershipData& StoredMembershipData)
 		{
-			EmitEventResult = Chat->EmitChatEvent(EPubnubChatEventType::PCET_Receipt, GetChannelID(), UPubnubChatInternalUtilities::GetReceiptEventPayload(Timetoken));
-		}
-		else
-		{
-			//It's not an error, but add it to the result
-			EmitEventResult.AddStep("EmitChatEvent", FPubnubOperationResult({0, false, TEXT("Can't emit chat event, user doesn't have permissions")}));
-		}
-
-		FinalResult.Merge(EmitEventResult);
+			UPubnubChatInternalUtilities::AddLastReadMessageTimetokenToMembershipData(StoredMembershipData, Timetoken);
+			MembershipData = StoredMembershipData;
+		});
+
+		FPubnubChatInternalOutboxEntry OutboxEntry;
+		OutboxEntry.EntryID = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower);
+		OutboxEntry.Operation = EPubnubChatOutboxOperation::PCOO_SetLastReadMessageTimetoken;
+		OutboxEntry.ChannelID = GetChannelID();
+		OutboxEntry.MessageTimetoken = Timetoken;
+		OutboxEntry.MembershipUserID = GetUserID();
+		OutboxEntry.MembershipData = MembershipData;
+		OutboxEntry.EmitReceiptEvent = UPubnubChatInternalUtilities::CanEmitReceiptEvent(Channel->GetChannelData().Type, Chat->ChatConfig)
+			&& Chat->AccessManager->CanI(EPubnubChatAccessManagerPermission::PCAMP_Write, EPubnubChatAccessManagerResourceType::PCAMRT_Channels, GetChannelID());
+		return Chat->Outbox->Enqueue(OutboxEntry);
 	}
-	
-	return FinalResult;
+
+	//Marker is set locally right away and written together with async writes of this membership collected before
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(Chat->ReadMarkerWriter, TEXT("Can't set last read message timetoken, ReadMarkerWriter is invalid"));
+	return Chat->ReadMarkerWriter->WriteReadMarker(GetInternalMembershipID(), GetChannelID(), GetUserID(), Channel->GetChannelData().Type, Timetoken);
 }
 
-void UPubnubChatMembership::SetLastReadMessageTimetokenAsync(const FString Timetoken, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatMembership::SetLastReadMessageTimetokenAsync(const FString Timetoken, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -201,23 +237,38 @@ void UPubnubChatMembership::SetLastReadMessageTimetokenAsync(const FString Timet
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	SetLastReadMessageTimetokenAsync(Timetoken, NativeCallback);
+	return SetLastReadMessageTimetokenAsync(Timetoken, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMembership::SetLastReadMessageTimetokenAsync(const FString Timetoken, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMembership::SetLastReadMessageTimetokenAsync(const FString Timetoken, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	
+	//Online marker is applied to GetLastReadMessageTimetoken right away, only the highest one is written once per flush interval.
+	//It can't be cancelled, as it may be already merged with other markers of this membership
+	if (!Timetoken.IsEmpty() && Chat->ReadMarkerWriter && !(Chat->Outbox && Chat->Outbox->ShouldQueue(GetChannelID())))
+	{
+		AsyncHandle.TryStart();
+		Chat->ReadMarkerWriter->WriteReadMarkerDebounced(GetInternalMembershipID(), GetChannelID(), GetUserID(), Channel->GetChannelData().Type, Timetoken, OnOperationResponseNative);
+		return AsyncHandle;
+	}
+	
 	TWeakObjectPtr<UPubnubChatMembership> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Timetoken, OnOperationResponseNative]
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Timetoken, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult SetTimetokenResult = WeakThis.Get()->SetLastReadMessageTimetoken(Timetoken);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, SetTimetokenResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatMembership::SetLastReadMessage(UPubnubChatMessage* Message)
@@ -229,7 +280,7 @@ FPubnubChatOperationResult UPubnubChatMembership::SetLastReadMessage(UPubnubChat
 	return SetLastReadMessageTimetoken(Message->GetMessageTimetoken());
 }
 
-void UPubnubChatMembership::SetLastReadMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatMembership::SetLastReadMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -237,23 +288,28 @@ void UPubnubChatMembership::SetLastReadMessageAsync(UPubnubChatMessage* Message,
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	SetLastReadMessageAsync(Message, NativeCallback);
+	return SetLastReadMessageAsync(Message, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMembership::SetLastReadMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMembership::SetLastReadMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatMembership> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Message, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Message, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult SetMessageResult = WeakThis.Get()->SetLastReadMessage(Message);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, SetMessageResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatMembership::StreamUpdates()
@@ -278,34 +334,7 @@ FPubnubChatOperationResult UPubnubChatMembership::StreamUpdates()
 		if(!ThisMembership->IsInitialized || !ThisMembership->Chat || !ThisMembership->IsStreamingUpdates)
 		{return;}
 		
-		//If this is not MembershipUpdate, just ignore this message
-		if (UPubnubChatInternalUtilities::IsPubnubMessageMembershipUpdate(MessageData.Message))
-		{
-			//Check if membership was deleted or updated
-			if (UPubnubChatInternalUtilities::IsPubnubMessageDeleteEvent(MessageData.Message))
-			{
-				//Remove this membership from repository
-				ThisMembership->Chat->ObjectsRepository->RemoveMembershipData(ThisMembership->GetInternalMembershipID());
-				
-				//Call OnDeleted delegates
-				ThisMembership->OnDeleted.Broadcast();
-				ThisMembership->OnDeletedNative.Broadcast();
-			}
-			else
-			{
-				//Adjust this membership data based on the update message
-				FPubnubChatMembershipData ChatMembershipData = ThisMembership->GetMembershipData();
-				FPubnubMembershipUpdateData MembershipUpdateData = UPubnubJsonUtilities::GetMembershipUpdateDataFromMessageContent(MessageData.Message);
-				UPubnubChatInternalUtilities::UpdateChatMembershipFromPubnubMembershipUpdateData(MembershipUpdateData, ChatMembershipData);
-							
-				//Update repository with new membership data
-				ThisMembership->Chat->ObjectsRepository->UpdateMembershipData(ThisMembership->GetInternalMembershipID(), ChatMembershipData);
-				
-				//Call OnUpdated delegates with new data
-				ThisMembership->OnUpdated.Broadcast(ThisMembership->GetChannelID(), ThisMembership->GetUserID(), ChatMembershipData);
-				ThisMembership->OnUpdatedNative.Broadcast(ThisMembership->GetChannelID(), ThisMembership->GetUserID(), ChatMembershipData);
-			}
-		}
+		ThisMembership->HandleUpdatesEvent(MessageData);
 	});
 	
 	//Subscribe with UpdatesSubscription to receive membership metadata updates
@@ -317,7 +346,7 @@ FPubnubChatOperationResult UPubnubChatMembership::StreamUpdates()
 	return FinalResult;
 }
 
-void UPubnubChatMembership::StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatMembership::StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -325,23 +354,28 @@ void UPubnubChatMembership::StreamUpdatesAsync(FOnPubnubChatOperationResponse On
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StreamUpdatesAsync(NativeCallback);
+	return StreamUpdatesAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMembership::StreamUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMembership::StreamUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatMembership> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StreamUpdatesResult = WeakThis.Get()->StreamUpdates();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StreamUpdatesResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatMembership::StreamUpdatesOn(const TArray<UPubnubChatMembership*>& Memberships)
@@ -356,11 +390,112 @@ FPubnubChatOperationResult UPubnubChatMembership::StreamUpdatesOn(const TArray<U
 	return FinalResult;
 }
 
+FPubnubChatListenForEventsResult UPubnubChatMembership::StartUpdatesStreamOn(const TArray<UPubnubChatMembership*>& Memberships, FOnPubnubChatMembershipsUpdated OnMembershipsUpdated)
+{
+	FOnPubnubChatMembershipsUpdatedNative NativeCallback;
+	NativeCallback.BindLambda([OnMembershipsUpdated](const TArray<UPubnubChatMembership*>& UpdatedMemberships)
+	{
+		OnMembershipsUpdated.ExecuteIfBound(UpdatedMemberships);
+	});
+	
+	return StartUpdatesStreamOn(Memberships, NativeCallback);
+}
+
+FPubnubChatListenForEventsResult UPubnubChatMembership::StartUpdatesStreamOn(const TArray<UPubnubChatMembership*>& Memberships, FOnPubnubChatMembershipsUpdatedNative OnMembershipsUpdatedNative)
+{
+	FPubnubChatListenForEventsResult FinalResult;
+	
+	//Nothing to stream on
+	if (Memberships.IsEmpty())
+	{ return FinalResult; }
+	
+	//Skip memberships that can't stream updates, all others share one stream of the first valid membership's Chat
+	TArray<UPubnubChatMembership*> ValidMemberships;
+	for (UPubnubChatMembership* Membership : Memberships)
+	{
+		if (!Membership || !Membership->IsInitialized || !Membership->Chat || !Membership->PubnubClient)
+		{
+			//Not initialized object is reported as error, but doesn't stop streaming on all others
+			FString ErrorLogMessage = FString::Printf(TEXT("[%s]: Skipping membership that is not initialized."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__)));
+			UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage);
+			FinalResult.Result.Merge(FPubnubChatOperationResult::CreateError(ErrorLogMessage));
+			continue;
+		}
+		if (!ValidMemberships.IsEmpty() && Membership->Chat != ValidMemberships[0]->Chat)
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("[%s]: Skipping membership %s that belongs to a different Chat."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__)), *Membership->GetInternalMembershipID());
+			continue;
+		}
+		ValidMemberships.Add(Membership);
+	}
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_CONDITION_FAILED(FinalResult, !ValidMemberships.IsEmpty(), TEXT("None of given memberships is initialized"));
+	
+	UPubnubChatUpdatesStream* UpdatesStream = ValidMemberships[0]->Chat->CreateUpdatesStream();
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_CONDITION_FAILED(FinalResult, UpdatesStream, TEXT("Failed to create UpdatesStream"));
+	
+	//Membership updates are published on the membership channel. Many memberships can share the same channel,
+	//so they are routed by the composite MembershipID (format: "[ChannelID].[UserID]")
+	auto GetRoutingID = [](const FPubnubMessageData& MessageData)
+	{
+		const FString UserID = UPubnubChatInternalUtilities::GetUserIDFromMembershipUpdate(MessageData.Message);
+		if (UserID.IsEmpty())
+		{ return FString(); }
+		
+		return FString::Printf(TEXT("%s.%s"), *MessageData.Channel, *UserID);
+	};
+	auto ApplyUpdate = [](UObject* Object, const FPubnubMessageData& MessageData)
+	{
+		UPubnubChatMembership* Membership = Cast<UPubnubChatMembership>(Object);
+		if (!Membership || !Membership->IsInitialized || !Membership->Chat)
+		{ return false; }
+		
+		//Membership that streams updates on its own already applied this event through its UpdatesSubscription
+		if (Membership->IsStreamingUpdates)
+		{ return UPubnubChatInternalUtilities::IsPubnubMessageMembershipUpdate(MessageData.Message); }
+		
+		return Membership->HandleUpdatesEvent(MessageData);
+	};
+	auto OnUpdatesBatch = [OnMembershipsUpdatedNative](const TArray<UObject*>& Objects)
+	{
+		TArray<UPubnubChatMembership*> UpdatedMemberships;
+		UpdatedMemberships.Reserve(Objects.Num());
+		for (UObject* Object : Objects)
+		{
+			if (UPubnubChatMembership* Membership = Cast<UPubnubChatMembership>(Object))
+			{
+				UpdatedMemberships.Add(Membership);
+			}
+		}
+		OnMembershipsUpdatedNative.ExecuteIfBound(UpdatedMemberships);
+	};
+	UpdatesStream->InitUpdatesStream(ValidMemberships[0]->Chat, false, GetRoutingID, ApplyUpdate, OnUpdatesBatch);
+	
+	for (UPubnubChatMembership* Membership : ValidMemberships)
+	{
+		UpdatesStream->AddObject(Membership->GetInternalMembershipID(), Membership->GetChannelID(), Membership);
+	}
+	
+	FPubnubChatOperationResult StartResult = UpdatesStream->Start();
+	FinalResult.Result.Merge(StartResult);
+	if (StartResult.Error)
+	{
+		UpdatesStream->Stop();
+		return FinalResult;
+	}
+	
+	FinalResult.CallbackStop = UpdatesStream->CreateCallbackStop();
+	
+	return FinalResult;
+}
+
 FPubnubChatOperationResult UPubnubChatMembership::StopStreamingUpdates()
 {
 	PUBNUB_CHAT_OBJECT_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
 	FPubnubChatOperationResult FinalResult;
 
+	//Stop routing updates from streams started with StartUpdatesStreamOn, streams without any membership left are stopped
+	FinalResult.Merge(Chat->RemoveFromUpdatesStreams(this));
+
 	//Remove message related delegates
 	UpdatesSubscription->OnPubnubObjectEventNative.Clear();
 	
@@ -375,7 +510,7 @@ FPubnubChatOperationResult UPubnubChatMembership::StopStreamingUpdates()
 	return FinalResult;
 }
 
-void UPubnubChatMembership::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatMembership::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -383,23 +518,28 @@ void UPubnubChatMembership::StopStreamingUpdatesAsync(FOnPubnubChatOperationResp
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StopStreamingUpdatesAsync(NativeCallback);
+	return StopStreamingUpdatesAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMembership::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMembership::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatMembership> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StopResult = WeakThis.Get()->StopStreamingUpdates();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StopResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatGetUnreadMessagesCountResult UPubnubChatMembership::GetUnreadMessagesCount()
@@ -408,14 +548,14 @@ FPubnubChatGetUnreadMessagesCountResult UPubnubChatMembership::GetUnreadMessages
 	PUBNUB_CHAT_OBJECT_RETURN_WRAPPER_IF_NOT_INITIALIZED(FinalResult);
 	
 	FString LRMTimetoken = GetLastReadMessageTimetoken().IsEmpty() ? Pubnub_Chat_Empty_Timetoken : GetLastReadMessageTimetoken();
-	FPubnubMessageCountsResult MessageCountsResult = PubnubClient->MessageCounts(GetChannelID(), LRMTimetoken);
+	FPubnubMessageCountsResult MessageCountsResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Read, "MessageCounts", FinalResult.Result, PubnubClient->MessageCounts(GetChannelID(), LRMTimetoken));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, MessageCountsResult.Result, "MessageCounts");
 	
 	FinalResult.Count = MessageCountsResult.MessageCounts;
 	return FinalResult;
 }
 
-void UPubnubChatMembership::GetUnreadMessagesCountAsync(FOnPubnubChatGetUnreadMessagesCountResponse OnUnreadMessagesCountResponse)
+FPubnubChatAsyncHandle UPubnubChatMembership::GetUnreadMessagesCountAsync(FOnPubnubChatGetUnreadMessagesCountResponse OnUnreadMessagesCountResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatGetUnreadMessagesCountResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnUnreadMessagesCountResponse](const FPubnubChatGetUnreadMessagesCountResult& UnreadMessagesCountResult)
@@ -423,23 +563,66 @@ void UPubnubChatMembership::GetUnreadMessagesCountAsync(FOnPubnubChatGetUnreadMe
 		OnUnreadMessagesCountResponse.ExecuteIfBound(UnreadMessagesCountResult);
 	});
 
-	GetUnreadMessagesCountAsync(NativeCallback);
+	return GetUnreadMessagesCountAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMembership::GetUnreadMessagesCountAsync(FOnPubnubChatGetUnreadMessagesCountResponseNative OnUnreadMessagesCountResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMembership::GetUnreadMessagesCountAsync(FOnPubnubChatGetUnreadMessagesCountResponseNative OnUnreadMessagesCountResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnUnreadMessagesCountResponseNative, FPubnubChatGetUnreadMessagesCountResult());
 	
 	TWeakObjectPtr<UPubnubChatMembership> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnUnreadMessagesCountResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnUnreadMessagesCountResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnUnreadMessagesCountResponseNative);
 		
 		FPubnubChatGetUnreadMessagesCountResult UnreadMessagesCountResult = WeakThis.Get()->GetUnreadMessagesCount();
 		UPubnubUtilities::CallPubnubDelegate(OnUnreadMessagesCountResponseNative, UnreadMessagesCountResult);
 	});
+
+	return AsyncHandle;
+}
+
+bool UPubnubChatMembership::HandleUpdatesEvent(const FPubnubMessageData& MessageData)
+{
+	//If this is not MembershipUpdate, just ignore this message
+	if (!UPubnubChatInternalUtilities::IsPubnubMessageMembershipUpdate(MessageData.Message))
+	{ return false; }
+	
+	//Check if membership was deleted or updated
+	if (UPubnubChatInternalUtilities::IsPubnubMessageDeleteEvent(MessageData.Message))
+	{
+		//Remove this membership from repository
+		Chat->ObjectsRepository->RemoveMembershipData(GetInternalMembershipID());
+		
+		//Call OnDeleted delegates
+		OnDeleted.Broadcast();
+		OnDeletedNative.Broadcast();
+	}
+	else
+	{
+		//Adjust stored membership data based on the update message, skip the event if repository already has newer data
+		FPubnubMembershipUpdateData MembershipUpdateData = UPubnubJsonUtilities::GetMembershipUpdateDataFromMessageContent(MessageData.Message);
+		FPubnubChatMembershipData ChatMembershipData;
+		const bool IsMembershipUpdated = Chat->ObjectsRepository->MutateMembershipData(GetInternalMembershipID(), [&](FPubnubChatMembershipData& StoredMembershipData)
+		{
+			UPubnubChatInternalUtilities::UpdateChatMembershipFromPubnubMembershipUpdateData(MembershipUpdateData, StoredMembershipData);
+			ChatMembershipData = StoredMembershipData;
+		}, UPubnubChatInternalUtilities::GetObjectsEventServerUpdated(MessageData.Message));
+		
+		if (!IsMembershipUpdated)
+		{ return false; }
+		
+		//Call OnUpdated delegates with new data
+		OnUpdated.Broadcast(GetChannelID(), GetUserID(), ChatMembershipData);
+		OnUpdatedNative.Broadcast(GetChannelID(), GetUserID(), ChatMembershipData);
+	}
+	
+	return true;
 }
 
 void UPubnubChatMembership::InitMembership(UPubnubClient* InPubnubClient, UPubnubChat* InChat, UPubnubChatUser* InUser, UPubnubChatChannel* InChannel)
@@ -8,22 +8,48 @@
 #include "PubnubChatInternalMacros.h"
 #include "PubnubChatSubsystem.h"
 #include "PubnubChatObjectsRepository.h"
+#include "PubnubChatOutbox.h"
+#include "PubnubChatReactionCoordinator.h"
 #include "PubnubChatThreadChannel.h"
 #include "PubnubChatUser.h"
+#include "PubnubChatUpdatesStream.h"
 #include "Entities/PubnubChannelEntity.h"
 #include "Entities/PubnubSubscription.h"
 #include "FunctionLibraries/PubnubChatInternalConverters.h"
 #include "FunctionLibraries/PubnubChatLogUtilities.h"
 #include "FunctionLibraries/PubnubChatInternalUtilities.h"
 #include "FunctionLibraries/PubnubChatMessageDraftUtilities.h"
+#include "FunctionLibraries/PubnubJsonUtilities.h"
 #include "FunctionLibraries/PubnubTimetokenUtilities.h"
 #include "FunctionLibraries/PubnubUtilities.h"
 #include "Threads/PubnubFunctionThread.h"
+#include "Async/Async.h"
 
 
+FString UPubnubChatMessage::GetMessageTimetoken() const
+{
+	FReadScopeLock ReadLock(IdentityLock);
+	return Timetoken;
+}
+
 FString UPubnubChatMessage::GetInternalMessageID() const
 {
-	return FString::Printf(TEXT("%s.%s"), *ChannelID, *Timetoken);
+	FReadScopeLock ReadLock(IdentityLock);
+	return InternalMessageID;
+}
+
+int64 UPubnubChatMessage::GetTimetokenValue() const
+{
+	FReadScopeLock ReadLock(IdentityLock);
+	return TimetokenValue;
+}
+
+void UPubnubChatMessage::SetTimetoken(const FString& InTimetoken)
+{
+	FWriteScopeLock WriteLock(IdentityLock);
+	Timetoken = InTimetoken;
+	InternalMessageID = FString::Printf(TEXT("%s.%s"), *ChannelID, *Timetoken);
+	TimetokenValue = UPubnubChatInternalUtilities::TimetokenToInt64(Timetoken);
 }
 
 void UPubnubChatMessage::BeginDestroy()
@@ -43,10 +69,17 @@ FPubnubChatMessageData UPubnubChatMessage::GetMessageData() const
 		return MessageData;
 	}
 
-	UE_LOG(PubnubChatLog, Error, TEXT("Message data not found in repository for ChannelID: %s, Timetoken: %s"), *ChannelID, *Timetoken);
+	UE_LOG(PubnubChatLog, Error, TEXT("Message data not found in repository for ChannelID: %s, Timetoken: %s"), *ChannelID, *GetMessageTimetoken());
 	return FPubnubChatMessageData();
 }
 
+int64 UPubnubChatMessage::GetDataVersion() const
+{
+	PUBNUB_CHAT_OBJECT_RETURN_IF_NOT_INITIALIZED(0);
+
+	return Chat->ObjectsRepository->GetMessageDataVersion(GetInternalMessageID());
+}
+
 FPubnubChatQuotedMessageData UPubnubChatMessage::GetQuotedMessage() const
 {
 	FPubnubChatMessageData MessageData = GetMessageData();
@@ -102,19 +135,30 @@ FPubnubChatOperationResult UPubnubChatMessage::EditText(const FString NewText)
 	FPubnubChatOperationResult FinalResult;
 	FPubnubChatMessageData CurrentMessageData = GetMessageData();
 	
+	//While offline, edit is queued in the outbox and applied when the server confirms it
+	if (Chat->Outbox && Chat->Outbox->ShouldQueue(CurrentMessageData.ChannelID))
+	{
+		FPubnubChatInternalOutboxEntry OutboxEntry;
+		OutboxEntry.EntryID = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower);
+		OutboxEntry.Operation = EPubnubChatOutboxOperation::PCOO_EditText;
+		OutboxEntry.ChannelID = CurrentMessageData.ChannelID;
+		OutboxEntry.MessageTimetoken = GetMessageTimetoken();
+		OutboxEntry.Text = NewText;
+		return Chat->Outbox->Enqueue(OutboxEntry);
+	}
+	
 	//Add message action by Pubnub Client
 	FString ActionType = UPubnubChatInternalConverters::ChatMessageActionTypeToString(EPubnubChatMessageActionType::PCMAT_Edited);
-	FPubnubAddMessageActionResult AddActionResult =  PubnubClient->AddMessageAction(CurrentMessageData.ChannelID, GetMessageTimetoken(), ActionType, NewText);
+	FPubnubAddMessageActionResult AddActionResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Publish, "AddMessageAction", FinalResult, PubnubClient->AddMessageAction(CurrentMessageData.ChannelID, GetMessageTimetoken(), ActionType, NewText));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, AddActionResult.Result, "AddMessageAction");
 	
-	//Add this new message action to MessageData and update ObjectsRepository
-	CurrentMessageData.MessageActions.Add(FPubnubChatMessageAction::FromPubnubMessageActionData(AddActionResult.MessageActionData));
-	Chat->ObjectsRepository->UpdateMessageData(GetInternalMessageID(), CurrentMessageData);
+	//Add this new message action to the stored MessageData, keeping actions that arrived in the meantime
+	Chat->ObjectsRepository->AppendMessageAction(GetInternalMessageID(), FPubnubChatMessageAction::FromPubnubMessageActionData(AddActionResult.MessageActionData));
 	
 	return FinalResult;
 }
 
-void UPubnubChatMessage::EditTextAsync(const FString NewText, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatMessage::EditTextAsync(const FString NewText, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -122,23 +166,28 @@ void UPubnubChatMessage::EditTextAsync(const FString NewText, FOnPubnubChatOpera
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	EditTextAsync(NewText, NativeCallback);
+	return EditTextAsync(NewText, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMessage::EditTextAsync(const FString NewText, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMessage::EditTextAsync(const FString NewText, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatMessage> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, NewText, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, NewText, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult EditTextResult = WeakThis.Get()->EditText(NewText);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, EditTextResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatMessage::Delete(bool Soft)
@@ -148,26 +197,26 @@ FPubnubChatOperationResult UPubnubChatMessage::Delete(bool Soft)
 	FPubnubChatOperationResult FinalResult;
 	FPubnubChatMessageData CurrentMessageData = GetMessageData();
 	
-	//If Message has thread, also Delete it, but only if Message.Delete succeeded 
-	FPubnubChatThreadChannelResult GetThreadResult = GetThread();
-	
 	if (!Soft)
 	{
 		//Hard Delete - really remove message from the server
+		//Delete range is (Timetoken, Timetoken + 1], without a valid timetoken it would remove the whole channel history
+		const int64 MessageTimetokenValue = GetTimetokenValue();
+		PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(MessageTimetokenValue > 0, TEXT("Can't hard delete Message, its Timetoken is not valid."));
 		
 		FPubnubDeleteMessagesSettings DeleteSettings;
-		DeleteSettings.Start = UPubnubTimetokenUtilities::AddIntToTimetoken(Timetoken, 1);
-		DeleteSettings.End = Timetoken;
-		FPubnubOperationResult DeleteResult = PubnubClient->DeleteMessages(CurrentMessageData.ChannelID, DeleteSettings);
+		DeleteSettings.Start = UPubnubChatInternalUtilities::Int64ToTimetoken(MessageTimetokenValue + 1);
+		DeleteSettings.End = UPubnubChatInternalUtilities::Int64ToTimetoken(MessageTimetokenValue);
+		FPubnubOperationResult DeleteResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Write, "DeleteMessages", FinalResult, PubnubClient->DeleteMessages(CurrentMessageData.ChannelID, DeleteSettings));
 		PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, DeleteResult, "DeleteMessages");
 		
 		//Remove Message data from the repository
 		Chat->ObjectsRepository->RemoveMessageData(GetInternalMessageID());
 		
-		//Now we can Delete thread if it exists
-		if (GetThreadResult.ThreadChannel)
+		//Now we can Delete thread if it exists. Thread existence is known from threadRootId action, so there is no need to fetch the thread first
+		if (UPubnubChatInternalUtilities::HasThreadRootMessageAction(CurrentMessageData.MessageActions))
 		{
-			FPubnubChatOperationResult DeleteThreadResult = GetThreadResult.ThreadChannel->Delete();
+			FPubnubChatOperationResult DeleteThreadResult = Chat->DeleteChannel(UPubnubChatInternalUtilities::GetThreadID(ChannelID, DeleteSettings.End));
 			PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, DeleteThreadResult);
 		}
 	}
@@ -180,18 +229,17 @@ FPubnubChatOperationResult UPubnubChatMessage::Delete(bool Soft)
 		{ return FinalResult; }
 
 		FString ActionType = UPubnubChatInternalConverters::ChatMessageActionTypeToString(EPubnubChatMessageActionType::PCMAT_Deleted);
-		FPubnubAddMessageActionResult AddActionResult =  PubnubClient->AddMessageAction(CurrentMessageData.ChannelID, GetMessageTimetoken(), ActionType, Pubnub_Chat_Soft_Deleted_Action_Value);
+		FPubnubAddMessageActionResult AddActionResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Publish, "AddMessageAction", FinalResult, PubnubClient->AddMessageAction(CurrentMessageData.ChannelID, GetMessageTimetoken(), ActionType, Pubnub_Chat_Soft_Deleted_Action_Value));
 		PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, AddActionResult.Result, "AddMessageAction");
 	
-		//Add this new message action to MessageData and update ObjectsRepository
-		CurrentMessageData.MessageActions.Add(FPubnubChatMessageAction::FromPubnubMessageActionData(AddActionResult.MessageActionData));
-		Chat->ObjectsRepository->UpdateMessageData(GetInternalMessageID(), CurrentMessageData);
+		//Add this new message action to the stored MessageData, keeping actions that arrived in the meantime
+		Chat->ObjectsRepository->AppendMessageAction(GetInternalMessageID(), FPubnubChatMessageAction::FromPubnubMessageActionData(AddActionResult.MessageActionData));
 	}
 	
 	return FinalResult;
 }
 
-void UPubnubChatMessage::DeleteAsync(FOnPubnubChatOperationResponse OnOperationResponse, bool Soft)
+FPubnubChatAsyncHandle UPubnubChatMessage::DeleteAsync(FOnPubnubChatOperationResponse OnOperationResponse, bool Soft, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -199,23 +247,28 @@ void UPubnubChatMessage::DeleteAsync(FOnPubnubChatOperationResponse OnOperationR
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	DeleteAsync(NativeCallback, Soft);
+	return DeleteAsync(NativeCallback, Soft, DeadlineSeconds);
 }
 
-void UPubnubChatMessage::DeleteAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, bool Soft)
+FPubnubChatAsyncHandle UPubnubChatMessage::DeleteAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, bool Soft, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatMessage> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Soft, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Soft, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult DeleteResult = WeakThis.Get()->Delete(Soft);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, DeleteResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatMessage::Restore()
@@ -224,24 +277,22 @@ FPubnubChatOperationResult UPubnubChatMessage::Restore()
 	FPubnubChatOperationResult FinalResult;
 	FPubnubChatMessageData CurrentMessageData = GetMessageData();
 	
-	//Remove all "deleted" message actions
+	//Remove all "deleted" message actions, each one from the repository right after it's removed from the server
 	for (int i = CurrentMessageData.MessageActions.Num() - 1; i >= 0; i--)
 	{
-		if (CurrentMessageData.MessageActions[i].Type == EPubnubChatMessageActionType::PCMAT_Deleted)
+		const FPubnubChatMessageAction& MessageAction = CurrentMessageData.MessageActions[i];
+		if (MessageAction.Type == EPubnubChatMessageActionType::PCMAT_Deleted)
 		{
-			FPubnubOperationResult RemoveActionResult = PubnubClient->RemoveMessageAction(CurrentMessageData.ChannelID, Timetoken, CurrentMessageData.MessageActions[i].Timetoken);
+			FPubnubOperationResult RemoveActionResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Write, "RemoveMessageAction", FinalResult, PubnubClient->RemoveMessageAction(CurrentMessageData.ChannelID, GetMessageTimetoken(), MessageAction.Timetoken));
 			PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, RemoveActionResult, "RemoveMessageAction");
-			CurrentMessageData.MessageActions.RemoveAt(i);
+			Chat->ObjectsRepository->RemoveMessageAction(GetInternalMessageID(), MessageAction);
 		}
 	}
 	
-	//Update repository with new data
-	Chat->ObjectsRepository->UpdateMessageData(GetInternalMessageID(), CurrentMessageData);
-	
 	return FinalResult;
 }
 
-void UPubnubChatMessage::RestoreAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatMessage::RestoreAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -249,23 +300,28 @@ void UPubnubChatMessage::RestoreAsync(FOnPubnubChatOperationResponse OnOperation
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	RestoreAsync(NativeCallback);
+	return RestoreAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMessage::RestoreAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMessage::RestoreAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatMessage> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult RestoreResult = WeakThis.Get()->Restore();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, RestoreResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatIsDeletedResult UPubnubChatMessage::IsDeleted()
@@ -310,7 +366,7 @@ FPubnubChatOperationResult UPubnubChatMessage::Pin()
 	return FinalResult;
 }
 
-void UPubnubChatMessage::PinAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatMessage::PinAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -318,23 +374,28 @@ void UPubnubChatMessage::PinAsync(FOnPubnubChatOperationResponse OnOperationResp
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	PinAsync(NativeCallback);
+	return PinAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMessage::PinAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMessage::PinAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatMessage> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult PinResult = WeakThis.Get()->Pin();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, PinResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatMessage::Unpin()
@@ -351,7 +412,7 @@ FPubnubChatOperationResult UPubnubChatMessage::Unpin()
 	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, PinnedMessageResult.Result);
 	
 	//Unpin message only if this message is actually pinned to the channel
-	if (PinnedMessageResult.Message && PinnedMessageResult.Message->Timetoken == Timetoken)
+	if (PinnedMessageResult.Message && PinnedMessageResult.Message->GetMessageTimetoken() == GetMessageTimetoken())
 	{
 		FPubnubChatOperationResult PinResult = ChannelResult.Channel->UnpinMessage();
 		PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, PinResult);
@@ -360,7 +421,7 @@ FPubnubChatOperationResult UPubnubChatMessage::Unpin()
 	return FinalResult;
 }
 
-void UPubnubChatMessage::UnpinAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatMessage::UnpinAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -368,23 +429,28 @@ void UPubnubChatMessage::UnpinAsync(FOnPubnubChatOperationResponse OnOperationRe
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	UnpinAsync(NativeCallback);
+	return UnpinAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMessage::UnpinAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMessage::UnpinAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatMessage> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult UnpinResult = WeakThis.Get()->Unpin();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, UnpinResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatMessage::ToggleReaction(const FString Reaction)
@@ -395,35 +461,33 @@ FPubnubChatOperationResult UPubnubChatMessage::ToggleReaction(const FString Reac
 	FPubnubChatOperationResult FinalResult;
 	FPubnubChatMessageData CurrentMessageData = GetMessageData();
 	
-	//Find if there is a MessageAction with provided Reaction for CurrentUserID
-	TArray<FPubnubChatMessageAction> FilteredMessageActions = UPubnubChatInternalUtilities::FilterMessageActionsOfType(CurrentMessageData.MessageActions, EPubnubChatMessageActionType::PCMAT_Reaction);
-	FPubnubChatMessageAction ReactionToToggle = UPubnubChatInternalUtilities::GetMessageReactionForUserID(FilteredMessageActions, Reaction, Chat->CurrentUserID);
-	
-	//If there is already such reaction from CurrentUser, we remove it
-	if (!ReactionToToggle.Timetoken.IsEmpty())
+	//While offline, toggle is queued in the outbox. Toggling a reaction that is still queued just cancels it
+	if (Chat->Outbox && Chat->Outbox->ShouldQueue(CurrentMessageData.ChannelID))
 	{
-		FPubnubOperationResult RemoveActionResult = PubnubClient->RemoveMessageAction(CurrentMessageData.ChannelID, Timetoken, ReactionToToggle.Timetoken);
-		PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, RemoveActionResult, "RemoveMessageAction");
+		if (Chat->Outbox->CancelQueuedReaction(CurrentMessageData.ChannelID, GetMessageTimetoken(), Reaction))
+		{
+			return FinalResult;
+		}
 		
-		//Remove this message action from message data
-		UPubnubChatInternalUtilities::RemoveReactionFromReactionsArray(CurrentMessageData.MessageActions, ReactionToToggle);
-	}
-	else
-	{
-		FString ActionType = UPubnubChatInternalConverters::ChatMessageActionTypeToString(EPubnubChatMessageActionType::PCMAT_Reaction);
-		FPubnubAddMessageActionResult AddActionResult = PubnubClient->AddMessageAction(CurrentMessageData.ChannelID, Timetoken, ActionType, Reaction);
-		PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, AddActionResult.Result, "AddMessageAction");
+		//Find if there is a MessageAction with provided Reaction for CurrentUserID
+		TArray<FPubnubChatMessageAction> FilteredMessageActions = UPubnubChatInternalUtilities::FilterMessageActionsOfType(CurrentMessageData.MessageActions, EPubnubChatMessageActionType::PCMAT_Reaction);
+		FPubnubChatMessageAction ReactionToToggle = UPubnubChatInternalUtilities::GetMessageReactionForUserID(FilteredMessageActions, Reaction, Chat->CurrentUserID);
 		
-		CurrentMessageData.MessageActions.Add(FPubnubChatMessageAction::FromPubnubMessageActionData(AddActionResult.MessageActionData));
+		FPubnubChatInternalOutboxEntry OutboxEntry;
+		OutboxEntry.EntryID = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower);
+		OutboxEntry.Operation = ReactionToToggle.Timetoken.IsEmpty() ? EPubnubChatOutboxOperation::PCOO_AddReaction : EPubnubChatOutboxOperation::PCOO_RemoveReaction;
+		OutboxEntry.ChannelID = CurrentMessageData.ChannelID;
+		OutboxEntry.MessageTimetoken = GetMessageTimetoken();
+		OutboxEntry.Text = Reaction;
+		OutboxEntry.ActionTimetoken = ReactionToToggle.Timetoken;
+		return Chat->Outbox->Enqueue(OutboxEntry);
 	}
 	
-	//Update repository with new MessageData (with added or removed message action
-	Chat->ObjectsRepository->UpdateMessageData(GetInternalMessageID(), CurrentMessageData);
-	
-	return FinalResult;
+	//Online toggles go through the coordinator, so they are serialized with async toggles of the same reaction
+	return Chat->ReactionCoordinator->ToggleReaction(GetInternalMessageID(), CurrentMessageData.ChannelID, GetMessageTimetoken(), Reaction);
 }
 
-void UPubnubChatMessage::ToggleReactionAsync(const FString Reaction, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatMessage::ToggleReactionAsync(const FString Reaction, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -431,23 +495,39 @@ void UPubnubChatMessage::ToggleReactionAsync(const FString Reaction, FOnPubnubCh
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	ToggleReactionAsync(Reaction, NativeCallback);
+	return ToggleReactionAsync(Reaction, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMessage::ToggleReactionAsync(const FString Reaction, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMessage::ToggleReactionAsync(const FString Reaction, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	
+	//Online toggle is applied to GetReactions right away, rapid toggles are collected and only their net change is sent.
+	//It can't be cancelled, as it may be already merged with other toggles of the same reaction
+	const FString ChannelID = GetMessageData().ChannelID;
+	if (!Reaction.IsEmpty() && Chat->ReactionCoordinator && !(Chat->Outbox && Chat->Outbox->ShouldQueue(ChannelID)))
+	{
+		AsyncHandle.TryStart();
+		Chat->ReactionCoordinator->ToggleReactionDebounced(GetInternalMessageID(), ChannelID, GetMessageTimetoken(), Reaction, OnOperationResponseNative);
+		return AsyncHandle;
+	}
+	
 	TWeakObjectPtr<UPubnubChatMessage> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Reaction, OnOperationResponseNative]
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Reaction, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult ToggleResult = WeakThis.Get()->ToggleReaction(Reaction);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, ToggleResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatGetReactionsResult UPubnubChatMessage::GetReactions() const
@@ -457,6 +537,12 @@ FPubnubChatGetReactionsResult UPubnubChatMessage::GetReactions() const
 	
 	FPubnubChatMessageData CurrentMessageData = GetMessageData();
 	
+	//Toggles that are not sent yet are shown right away
+	if (Chat->ReactionCoordinator)
+	{
+		Chat->ReactionCoordinator->ApplyPendingReactions(GetInternalMessageID(), CurrentMessageData.MessageActions);
+	}
+	
 	//Filter message actions of type Reaction
 	FinalResult.Reactions = UPubnubChatInternalUtilities::GetMessageReactionsFromMessageActions(Chat->CurrentUserID, CurrentMessageData.MessageActions);
 	
@@ -485,7 +571,7 @@ FPubnubChatOperationResult UPubnubChatMessage::Forward(UPubnubChatChannel* Chann
 	return Chat->ForwardMessage(this, Channel);
 }
 
-void UPubnubChatMessage::ForwardAsync(UPubnubChatChannel* Channel, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatMessage::ForwardAsync(UPubnubChatChannel* Channel, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -493,23 +579,28 @@ void UPubnubChatMessage::ForwardAsync(UPubnubChatChannel* Channel, FOnPubnubChat
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	ForwardAsync(Channel, NativeCallback);
+	return ForwardAsync(Channel, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMessage::ForwardAsync(UPubnubChatChannel* Channel, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMessage::ForwardAsync(UPubnubChatChannel* Channel, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatMessage> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Channel, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Channel, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult ForwardResult = WeakThis.Get()->Forward(Channel);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, ForwardResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatMessage::Report(const FString Reason)
@@ -520,14 +611,14 @@ FPubnubChatOperationResult UPubnubChatMessage::Report(const FString Reason)
 	FPubnubChatMessageData CurrentMessageData = GetMessageData();
 	
 	FString EventChannel = UPubnubChatInternalUtilities::GetRestrictionsChannelForChannelID(CurrentMessageData.ChannelID);
-	FString EventPayload = UPubnubChatInternalUtilities::GetReportMessageEventPayload(GetCurrentText(), Reason, CurrentMessageData.ChannelID, CurrentMessageData.UserID, Timetoken);
+	FString EventPayload = UPubnubChatInternalUtilities::GetReportMessageEventPayload(GetCurrentText(), Reason, CurrentMessageData.ChannelID, CurrentMessageData.UserID, GetMessageTimetoken());
 	FPubnubChatOperationResult EmitEventResult = Chat->EmitChatEvent(EPubnubChatEventType::PCET_Report, EventChannel, EventPayload);
 	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, EmitEventResult);
 	
 	return FinalResult;
 }
 
-void UPubnubChatMessage::ReportAsync(FOnPubnubChatOperationResponse OnOperationResponse, const FString Reason)
+FPubnubChatAsyncHandle UPubnubChatMessage::ReportAsync(FOnPubnubChatOperationResponse OnOperationResponse, const FString Reason, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -535,26 +626,31 @@ void UPubnubChatMessage::ReportAsync(FOnPubnubChatOperationResponse OnOperationR
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	ReportAsync(NativeCallback, Reason);
+	return ReportAsync(NativeCallback, Reason, DeadlineSeconds);
 }
 
-void UPubnubChatMessage::ReportAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, const FString Reason)
+FPubnubChatAsyncHandle UPubnubChatMessage::ReportAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, const FString Reason, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatMessage> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Reason, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Reason, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult ReportResult = WeakThis.Get()->Report(Reason);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, ReportResult);
 	});
+
+	return AsyncHandle;
 }
 
-void UPubnubChatMessage::InitMessage(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString InChannelID, const FString InTimetoken)
+void UPubnubChatMessage::InitMessage(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString InChannelID, const FString InTimetoken, const bool RegisterInRepository)
 {
 	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InPubnubClient, TEXT("Can't init Message, PubnubClient is invalid"));
 	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InChat, TEXT("Can't init Message, Chat is invalid"));
@@ -562,18 +658,12 @@ void UPubnubChatMessage::InitMessage(UPubnubClient* InPubnubClient, UPubnubChat*
 	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(!InTimetoken.IsEmpty(), TEXT("Can't init Message, Timetoken is empty"));
 
 	ChannelID = InChannelID;
-	Timetoken = InTimetoken;
+	SetTimetoken(InTimetoken);
 	PubnubClient = InPubnubClient;
 	Chat = InChat;
-
-	UPubnubChannelEntity* ChannelEntity = PubnubClient->CreateChannelEntity(ChannelID);
-	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(ChannelEntity, TEXT("Can't init Message, Failed to create ChannelEntity"));
-
-	UpdatesSubscription = ChannelEntity->CreateSubscription();
-	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(UpdatesSubscription, TEXT("Can't init Message, Failed to create Updates Subscription"));
 	
 	// Register this message object with the repository
-	if (Chat->ObjectsRepository)
+	if (RegisterInRepository && Chat->ObjectsRepository)
 	{
 		Chat->ObjectsRepository->RegisterMessage(GetInternalMessageID());
 	}
@@ -598,6 +688,8 @@ FPubnubChatOperationResult UPubnubChatMessage::StreamUpdates()
 	if (IsStreamingUpdates)
 	{ return FinalResult; }
 	
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(CreateUpdatesSubscription(), TEXT("Failed to create Updates Subscription"));
+	
 	TWeakObjectPtr<UPubnubChatMessage> ThisWeak = MakeWeakObjectPtr(this);
 	
 	//Add listener to subscription with provided callback
@@ -611,22 +703,7 @@ FPubnubChatOperationResult UPubnubChatMessage::StreamUpdates()
 		if(!ThisMessage->IsInitialized || !ThisMessage->Chat || !ThisMessage->IsStreamingUpdates)
 		{return;}
 		
-		//If this is not MessageUpdate, just ignore this message
-		if (UPubnubChatInternalUtilities::IsPubnubMessageChatMessageUpdate(MessageData.Message))
-		{
-			FPubnubChatMessageData ChatMessageData = ThisMessage->GetMessageData();
-			
-			//Update Message or skip if added/removed action is not related to that Message
-			if (UPubnubChatInternalUtilities::UpdateChatMessageDataFromPubnubMessage(MessageData, ThisMessage->Timetoken, ChatMessageData))
-			{
-				//Update repository with new user data
-				ThisMessage->Chat->ObjectsRepository->UpdateMessageData(ThisMessage->GetInternalMessageID(), ChatMessageData);
-				
-				//Call delegates with new user data
-				ThisMessage->OnUpdated.Broadcast(ThisMessage->Timetoken, ChatMessageData);
-				ThisMessage->OnUpdatedNative.Broadcast(ThisMessage->Timetoken, ChatMessageData);
-			}
-		}
+		ThisMessage->HandleUpdatesEvent(MessageData);
 	});
 	
 	//Subscribe with UpdatesSubscription to receive user metadata updates
@@ -638,7 +715,7 @@ FPubnubChatOperationResult UPubnubChatMessage::StreamUpdates()
 	return FinalResult;
 }
 
-void UPubnubChatMessage::StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatMessage::StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -646,23 +723,28 @@ void UPubnubChatMessage::StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOpe
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StreamUpdatesAsync(NativeCallback);
+	return StreamUpdatesAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMessage::StreamUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMessage::StreamUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatMessage> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StreamUpdatesResult = WeakThis.Get()->StreamUpdates();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StreamUpdatesResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatMessage::StreamUpdatesOn(const TArray<UPubnubChatMessage*>& Messages)
@@ -677,11 +759,112 @@ FPubnubChatOperationResult UPubnubChatMessage::StreamUpdatesOn(const TArray<UPub
 	return FinalResult;
 }
 
+FPubnubChatListenForEventsResult UPubnubChatMessage::StartUpdatesStreamOn(const TArray<UPubnubChatMessage*>& Messages, FOnPubnubChatMessagesUpdated OnMessagesUpdated)
+{
+	FOnPubnubChatMessagesUpdatedNative NativeCallback;
+	NativeCallback.BindLambda([OnMessagesUpdated](const TArray<UPubnubChatMessage*>& UpdatedMessages)
+	{
+		OnMessagesUpdated.ExecuteIfBound(UpdatedMessages);
+	});
+	
+	return StartUpdatesStreamOn(Messages, NativeCallback);
+}
+
+FPubnubChatListenForEventsResult UPubnubChatMessage::StartUpdatesStreamOn(const TArray<UPubnubChatMessage*>& Messages, FOnPubnubChatMessagesUpdatedNative OnMessagesUpdatedNative)
+{
+	FPubnubChatListenForEventsResult FinalResult;
+	
+	//Nothing to stream on
+	if (Messages.IsEmpty())
+	{ return FinalResult; }
+	
+	//Skip messages that can't stream updates, all others share one stream of the first valid message's Chat
+	TArray<UPubnubChatMessage*> ValidMessages;
+	for (UPubnubChatMessage* Message : Messages)
+	{
+		if (!Message || !Message->IsInitialized || !Message->Chat || !Message->PubnubClient)
+		{
+			//Not initialized object is reported as error, but doesn't stop streaming on all others
+			FString ErrorLogMessage = FString::Printf(TEXT("[%s]: Skipping message that is not initialized."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__)));
+			UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage);
+			FinalResult.Result.Merge(FPubnubChatOperationResult::CreateError(ErrorLogMessage));
+			continue;
+		}
+		if (!ValidMessages.IsEmpty() && Message->Chat != ValidMessages[0]->Chat)
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("[%s]: Skipping message %s that belongs to a different Chat."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__)), *Message->GetInternalMessageID());
+			continue;
+		}
+		ValidMessages.Add(Message);
+	}
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_CONDITION_FAILED(FinalResult, !ValidMessages.IsEmpty(), TEXT("None of given messages is initialized"));
+	
+	UPubnubChatUpdatesStream* UpdatesStream = ValidMessages[0]->Chat->CreateUpdatesStream();
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_CONDITION_FAILED(FinalResult, UpdatesStream, TEXT("Failed to create UpdatesStream"));
+	
+	//Message actions are published on the message channel, so all messages of that channel are routed
+	//by the composite MessageID (format: "[ChannelID].[Timetoken]") of the message the action belongs to
+	auto GetRoutingID = [](const FPubnubMessageData& MessageData)
+	{
+		const FPubnubMessageActionData ActionData = UPubnubJsonUtilities::GetMessageActionFromMessageData(MessageData);
+		if (ActionData.MessageTimetoken.IsEmpty())
+		{ return FString(); }
+		
+		return FString::Printf(TEXT("%s.%s"), *MessageData.Channel, *ActionData.MessageTimetoken);
+	};
+	auto ApplyUpdate = [](UObject* Object, const FPubnubMessageData& MessageData)
+	{
+		UPubnubChatMessage* Message = Cast<UPubnubChatMessage>(Object);
+		if (!Message || !Message->IsInitialized || !Message->Chat)
+		{ return false; }
+		
+		//Message that streams updates on its own already applied this event through its UpdatesSubscription
+		if (Message->IsStreamingUpdates)
+		{ return UPubnubChatInternalUtilities::IsPubnubMessageChatMessageUpdate(MessageData.Message); }
+		
+		return Message->HandleUpdatesEvent(MessageData);
+	};
+	auto OnUpdatesBatch = [OnMessagesUpdatedNative](const TArray<UObject*>& Objects)
+	{
+		TArray<UPubnubChatMessage*> UpdatedMessages;
+		UpdatedMessages.Reserve(Objects.Num());
+		for (UObject* Object : Objects)
+		{
+			if (UPubnubChatMessage* Message = Cast<UPubnubChatMessage>(Object))
+			{
+				UpdatedMessages.Add(Message);
+			}
+		}
+		OnMessagesUpdatedNative.ExecuteIfBound(UpdatedMessages);
+	};
+	UpdatesStream->InitUpdatesStream(ValidMessages[0]->Chat, true, GetRoutingID, ApplyUpdate, OnUpdatesBatch);
+	
+	for (UPubnubChatMessage* Message : ValidMessages)
+	{
+		UpdatesStream->AddObject(Message->GetInternalMessageID(), Message->ChannelID, Message);
+	}
+	
+	FPubnubChatOperationResult StartResult = UpdatesStream->Start();
+	FinalResult.Result.Merge(StartResult);
+	if (StartResult.Error)
+	{
+		UpdatesStream->Stop();
+		return FinalResult;
+	}
+	
+	FinalResult.CallbackStop = UpdatesStream->CreateCallbackStop();
+	
+	return FinalResult;
+}
+
 FPubnubChatOperationResult UPubnubChatMessage::StopStreamingUpdates()
 {
 	PUBNUB_CHAT_OBJECT_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
 	FPubnubChatOperationResult FinalResult;
 
+	//Stop routing updates from streams started with StartUpdatesStreamOn, streams without any message left are stopped
+	FinalResult.Merge(Chat->RemoveFromUpdatesStreams(this));
+
 	//Remove message related delegates
 	if (UpdatesSubscription)
 	{
@@ -702,7 +885,7 @@ FPubnubChatOperationResult UPubnubChatMessage::StopStreamingUpdates()
 	return FinalResult;
 }
 
-void UPubnubChatMessage::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatMessage::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -710,23 +893,28 @@ void UPubnubChatMessage::StopStreamingUpdatesAsync(FOnPubnubChatOperationRespons
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StopStreamingUpdatesAsync(NativeCallback);
+	return StopStreamingUpdatesAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMessage::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMessage::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatMessage> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StopResult = WeakThis.Get()->StopStreamingUpdates();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StopResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatThreadChannelResult UPubnubChatMessage::CreateThread()
@@ -737,7 +925,7 @@ FPubnubChatThreadChannelResult UPubnubChatMessage::CreateThread()
 	return Chat->CreateThreadChannel(this);
 }
 
-void UPubnubChatMessage::CreateThreadAsync(FOnPubnubChatThreadChannelResponse OnThreadChannelResponse)
+FPubnubChatAsyncHandle UPubnubChatMessage::CreateThreadAsync(FOnPubnubChatThreadChannelResponse OnThreadChannelResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatThreadChannelResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnThreadChannelResponse](const FPubnubChatThreadChannelResult& ThreadChannelResult)
@@ -745,23 +933,28 @@ void UPubnubChatMessage::CreateThreadAsync(FOnPubnubChatThreadChannelResponse On
 		OnThreadChannelResponse.ExecuteIfBound(ThreadChannelResult);
 	});
 
-	CreateThreadAsync(NativeCallback);
+	return CreateThreadAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMessage::CreateThreadAsync(FOnPubnubChatThreadChannelResponseNative OnThreadChannelResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMessage::CreateThreadAsync(FOnPubnubChatThreadChannelResponseNative OnThreadChannelResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnThreadChannelResponseNative, FPubnubChatThreadChannelResult());
 	
 	TWeakObjectPtr<UPubnubChatMessage> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnThreadChannelResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnThreadChannelResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnThreadChannelResponseNative);
 		
 		FPubnubChatThreadChannelResult ThreadChannelResult = WeakThis.Get()->CreateThread();
 		UPubnubUtilities::CallPubnubDelegate(OnThreadChannelResponseNative, ThreadChannelResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatThreadChannelResult UPubnubChatMessage::GetThread()
@@ -772,7 +965,7 @@ FPubnubChatThreadChannelResult UPubnubChatMessage::GetThread()
 	return Chat->GetThreadChannel(this);
 }
 
-void UPubnubChatMessage::GetThreadAsync(FOnPubnubChatThreadChannelResponse OnThreadChannelResponse)
+FPubnubChatAsyncHandle UPubnubChatMessage::GetThreadAsync(FOnPubnubChatThreadChannelResponse OnThreadChannelResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatThreadChannelResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnThreadChannelResponse](const FPubnubChatThreadChannelResult& ThreadChannelResult)
@@ -780,23 +973,28 @@ void UPubnubChatMessage::GetThreadAsync(FOnPubnubChatThreadChannelResponse OnThr
 		OnThreadChannelResponse.ExecuteIfBound(ThreadChannelResult);
 	});
 
-	GetThreadAsync(NativeCallback);
+	return GetThreadAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMessage::GetThreadAsync(FOnPubnubChatThreadChannelResponseNative OnThreadChannelResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMessage::GetThreadAsync(FOnPubnubChatThreadChannelResponseNative OnThreadChannelResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnThreadChannelResponseNative, FPubnubChatThreadChannelResult());
 	
 	TWeakObjectPtr<UPubnubChatMessage> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnThreadChannelResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnThreadChannelResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnThreadChannelResponseNative);
 		
 		FPubnubChatThreadChannelResult ThreadChannelResult = WeakThis.Get()->GetThread();
 		UPubnubUtilities::CallPubnubDelegate(OnThreadChannelResponseNative, ThreadChannelResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatHasThreadResult UPubnubChatMessage::HasThread() const
@@ -816,7 +1014,7 @@ FPubnubChatOperationResult UPubnubChatMessage::RemoveThread()
 	return Chat->RemoveThreadChannel(this);
 }
 
-void UPubnubChatMessage::RemoveThreadAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatMessage::RemoveThreadAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -824,23 +1022,76 @@ void UPubnubChatMessage::RemoveThreadAsync(FOnPubnubChatOperationResponse OnOper
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	RemoveThreadAsync(NativeCallback);
+	return RemoveThreadAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatMessage::RemoveThreadAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatMessage::RemoveThreadAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatMessage> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult RemoveThreadResult = WeakThis.Get()->RemoveThread();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, RemoveThreadResult);
 	});
+
+	return AsyncHandle;
+}
+
+FPubnubChatOperationResult UPubnubChatMessage::RetrySend()
+{
+	PUBNUB_CHAT_OBJECT_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(LocalEchoChannel.IsValid(), TEXT("Only failed locally echoed messages can be sent again"));
+	
+	return LocalEchoChannel->RetryLocalEcho(ClientMessageID);
+}
+
+FPubnubChatAsyncHandle UPubnubChatMessage::RetrySendAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
+{
+	FOnPubnubChatOperationResponseNative NativeCallback;
+	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
+	{
+		OnOperationResponse.ExecuteIfBound(OperationResult);
+	});
+
+	return RetrySendAsync(NativeCallback, DeadlineSeconds);
+}
+
+FPubnubChatAsyncHandle UPubnubChatMessage::RetrySendAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
+{
+	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
+	
+	TWeakObjectPtr<UPubnubChatMessage> WeakThis = MakeWeakObjectPtr(this);
+
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
+	{
+		if (!WeakThis.IsValid())
+		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
+		
+		FPubnubChatOperationResult RetrySendResult = WeakThis.Get()->RetrySend();
+		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, RetrySendResult);
+	});
+
+	return AsyncHandle;
+}
+
+FPubnubChatOperationResult UPubnubChatMessage::DiscardSend()
+{
+	PUBNUB_CHAT_OBJECT_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(LocalEchoChannel.IsValid(), TEXT("Only failed locally echoed messages can be discarded"));
+	
+	return LocalEchoChannel->DiscardLocalEcho(ClientMessageID);
 }
 
 void UPubnubChatMessage::OnChatDestroyed(FString InUserID)
@@ -848,6 +1099,104 @@ void UPubnubChatMessage::OnChatDestroyed(FString InUserID)
 	CleanUp();
 }
 
+bool UPubnubChatMessage::HandleUpdatesEvent(const FPubnubMessageData& MessageData)
+{
+	//If this is not MessageUpdate, just ignore this message
+	if (!UPubnubChatInternalUtilities::IsPubnubMessageChatMessageUpdate(MessageData.Message))
+	{ return false; }
+	
+	//Update Message in the repository or skip if added/removed action is not related to that Message
+	FPubnubChatMessageData ChatMessageData;
+	bool IsMessageUpdated = false;
+	const FString MessageTimetoken = GetMessageTimetoken();
+	Chat->ObjectsRepository->MutateMessageData(GetInternalMessageID(), [&](FPubnubChatMessageData& StoredMessageData)
+	{
+		IsMessageUpdated = UPubnubChatInternalUtilities::UpdateChatMessageDataFromPubnubMessage(MessageData, MessageTimetoken, StoredMessageData);
+		ChatMessageData = StoredMessageData;
+	});
+	
+	if (!IsMessageUpdated)
+	{ return false; }
+	
+	//Call delegates with new message data
+	DispatchUpdated(ChatMessageData);
+	
+	return true;
+}
+
+bool UPubnubChatMessage::ApplyMissedMessageAction(const FPubnubMessageActionData& ActionData)
+{
+	if (!IsInitialized || ActionData.MessageTimetoken != GetMessageTimetoken())
+	{ return false; }
+	
+	//Action could be already delivered live or fetched with the message
+	if (!Chat->ObjectsRepository->AppendMessageAction(GetInternalMessageID(), FPubnubChatMessageAction::FromPubnubMessageActionData(ActionData)))
+	{ return false; }
+	
+	if (!IsStreamingUpdates)
+	{ return true; }
+	
+	FPubnubChatMessageData ChatMessageData = GetMessageData();
+	
+	TWeakObjectPtr<UPubnubChatMessage> ThisWeak = MakeWeakObjectPtr(this);
+	AsyncTask(ENamedThreads::GameThread, [ThisWeak, ChatMessageData]()
+	{
+		if(!ThisWeak.IsValid())
+		{return;}
+		
+		ThisWeak->DispatchUpdated(ChatMessageData);
+	});
+	
+	return true;
+}
+
+void UPubnubChatMessage::DispatchUpdated(const FPubnubChatMessageData& ChatMessageData)
+{
+	if (!Chat)
+	{ return; }
+	
+	TWeakObjectPtr<UPubnubChatMessage> ThisWeak = MakeWeakObjectPtr(this);
+	Chat->DispatchEvent(this, [ThisWeak, ChatMessageData]()
+	{
+		if(!ThisWeak.IsValid() || !ThisWeak->IsInitialized)
+		{return;}
+		
+		const FString MessageTimetoken = ThisWeak->GetMessageTimetoken();
+		ThisWeak->OnUpdated.Broadcast(MessageTimetoken, ChatMessageData);
+		ThisWeak->OnUpdatedNative.Broadcast(MessageTimetoken, ChatMessageData);
+	}, Pubnub_Chat_Dispatch_Message_Updated_Key);
+}
+
+void UPubnubChatMessage::SetSendState(EPubnubChatMessageSendState NewSendState)
+{
+	if (SendState == NewSendState || !Chat)
+	{ return; }
+	
+	SendState = NewSendState;
+	
+	TWeakObjectPtr<UPubnubChatMessage> ThisWeak = MakeWeakObjectPtr(this);
+	Chat->DispatchEvent(this, [ThisWeak, NewSendState]()
+	{
+		if(!ThisWeak.IsValid() || !ThisWeak->IsInitialized)
+		{return;}
+		
+		ThisWeak->OnSendStateChanged.Broadcast(NewSendState);
+		ThisWeak->OnSendStateChangedNative.Broadcast(NewSendState);
+	}, Pubnub_Chat_Dispatch_Message_Send_State_Key);
+}
+
+bool UPubnubChatMessage::CreateUpdatesSubscription()
+{
+	if (UpdatesSubscription)
+	{ return true; }
+	
+	UPubnubChannelEntity* ChannelEntity = PubnubClient->CreateChannelEntity(ChannelID);
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(ChannelEntity, TEXT("Can't create Updates Subscription, Failed to create ChannelEntity"), false);
+
+	UpdatesSubscription = ChannelEntity->CreateSubscription();
+	return UpdatesSubscription != nullptr;
+}
+
 void UPubnubChatMessage::ClearAllSubscriptions()
 {
 	if (UpdatesSubscription)
@@ -871,8 +1220,14 @@ void UPubnubChatMessage::CleanUp()
 		ClearAllSubscriptions();
 	}
 	
+	//Release live object entry, so the chat never hands out this object once it's being destroyed
+	if (IsInitialized && Chat)
+	{
+		Chat->ReleaseLiveMessageObject(this);
+	}
+	
 	//Unregister from repository before destruction
-	if (IsInitialized && Chat && Chat->ObjectsRepository && !ChannelID.IsEmpty() && !Timetoken.IsEmpty())
+	if (IsInitialized && Chat && Chat->ObjectsRepository && !ChannelID.IsEmpty() && !GetMessageTimetoken().IsEmpty())
 	{
 		Chat->OnChatDestroyed.RemoveDynamic(this, &UPubnubChatMessage::OnChatDestroyed);
 		Chat->ObjectsRepository->UnregisterMessage(GetInternalMessageID());
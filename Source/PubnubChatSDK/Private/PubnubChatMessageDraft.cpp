@@ -464,7 +464,7 @@ FPubnubChatOperationResult UPubnubChatMessageDraft::Send(FPubnubChatSendTextPara
 	return Channel->SendTextInternal(DraftMessage, SendTextParams, QuotedMessage, MentionedUsers);
 }
 
-void UPubnubChatMessageDraft::SendAsync(FOnPubnubChatOperationResponse OnOperationResponse, FPubnubChatSendTextParams SendTextParams)
+FPubnubChatAsyncHandle UPubnubChatMessageDraft::SendAsync(FOnPubnubChatOperationResponse OnOperationResponse, FPubnubChatSendTextParams SendTextParams, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -472,28 +472,28 @@ void UPubnubChatMessageDraft::SendAsync(FOnPubnubChatOperationResponse OnOperati
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	SendAsync(NativeCallback, SendTextParams);
+	return SendAsync(NativeCallback, SendTextParams, DeadlineSeconds);
 }
 
-void UPubnubChatMessageDraft::SendAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, FPubnubChatSendTextParams SendTextParams)
+FPubnubChatAsyncHandle UPubnubChatMessageDraft::SendAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, FPubnubChatSendTextParams SendTextParams, float DeadlineSeconds)
 {
 	if (!Channel)
 	{
 		FString ErrorLogMessage = FString::Printf(TEXT("[%s]: Channel for this MessageDraft is invalid."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__)));
 		UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, FPubnubChatOperationResult::CreateError(ErrorLogMessage));
-		return;
+		return FPubnubChatAsyncHandle();
 	}
 	if (GetCurrentText().IsEmpty())
 	{
 		FString ErrorLogMessage = FString::Printf(TEXT("[%s]: Can't send empty message draft."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__)));
 		UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, FPubnubChatOperationResult::CreateError(ErrorLogMessage));
-		return;
+		return FPubnubChatAsyncHandle();
 	}
 	
 	FString DraftMessage = GetDraftTextToSend();
-	Channel->SendTextAsync(DraftMessage, OnOperationResponseNative, SendTextParams);
+	return Channel->SendTextAsync(DraftMessage, OnOperationResponseNative, SendTextParams, DeadlineSeconds);
 }
 
 FString UPubnubChatMessageDraft::GetTextToSend() const
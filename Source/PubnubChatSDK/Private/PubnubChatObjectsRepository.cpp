@@ -1,30 +1,150 @@
 // Copyright 2026 PubNub Inc. All Rights Reserved.
 
 #include "PubnubChatObjectsRepository.h"
+#include "PubnubChatPersistentStore.h"
+#include "PubnubChatConst.h"
+#include "PubnubChatStats.h"
+#include "FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "Misc/ScopeExit.h"
 #include "Misc/ScopeLock.h"
 
+namespace
+{
+	int64 GetApproximateDataSize(const FPubnubChatInternalUser& InternalUser)
+	{
+		const FPubnubChatUserData& UserData = InternalUser.UserData;
+		return InternalUser.UserID.GetAllocatedSize() + InternalUser.ServerUpdated.GetAllocatedSize()
+			+ UserData.UserName.GetAllocatedSize() + UserData.ExternalID.GetAllocatedSize() + UserData.ProfileUrl.GetAllocatedSize()
+			+ UserData.Email.GetAllocatedSize() + UserData.Custom.GetAllocatedSize() + UserData.Status.GetAllocatedSize() + UserData.Type.GetAllocatedSize();
+	}
+
+	int64 GetApproximateDataSize(const FPubnubChatInternalChannel& InternalChannel)
+	{
+		const FPubnubChatChannelData& ChannelData = InternalChannel.ChannelData;
+		return InternalChannel.ChannelID.GetAllocatedSize() + InternalChannel.ServerUpdated.GetAllocatedSize()
+			+ ChannelData.ChannelName.GetAllocatedSize() + ChannelData.Description.GetAllocatedSize() + ChannelData.Custom.GetAllocatedSize()
+			+ ChannelData.Status.GetAllocatedSize() + ChannelData.Type.GetAllocatedSize();
+	}
+
+	int64 GetApproximateDataSize(const FPubnubChatInternalMessage& InternalMessage)
+	{
+		const FPubnubChatMessageData& MessageData = InternalMessage.MessageData;
+		int64 Size = InternalMessage.ChannelID.GetAllocatedSize()
+			+ MessageData.Type.GetAllocatedSize() + MessageData.Text.GetAllocatedSize() + MessageData.ChannelID.GetAllocatedSize()
+			+ MessageData.UserID.GetAllocatedSize() + MessageData.Meta.GetAllocatedSize() + MessageData.MessageActions.GetAllocatedSize();
+		for (const FPubnubChatMessageAction& MessageAction : MessageData.MessageActions)
+		{
+			Size += MessageAction.Value.GetAllocatedSize() + MessageAction.Timetoken.GetAllocatedSize() + MessageAction.UserID.GetAllocatedSize();
+		}
+		return Size;
+	}
+
+	int64 GetApproximateDataSize(const FPubnubChatInternalMembership& InternalMembership)
+	{
+		const FPubnubChatMembershipData& MembershipData = InternalMembership.MembershipData;
+		return InternalMembership.MembershipID.GetAllocatedSize() + InternalMembership.ServerUpdated.GetAllocatedSize()
+			+ MembershipData.Custom.GetAllocatedSize() + MembershipData.Status.GetAllocatedSize() + MembershipData.Type.GetAllocatedSize();
+	}
+
+	int GetReferenceCountHistogramBucket(int32 ReferenceCount)
+	{
+		if (ReferenceCount <= 0)
+		{
+			return 0;
+		}
+		return FMath::Min(1 + static_cast<int>(FMath::FloorLog2(static_cast<uint32>(ReferenceCount))), Pubnub_Chat_Memory_Stats_Reference_Count_Buckets - 1);
+	}
+
+	/** Has to be called with the critical section of given entries locked */
+	template<typename KeyType, typename InternalDataType>
+	FPubnubChatRepositoryEntryStats GetEntryStats(const TMap<KeyType, InternalDataType>& Entries, const TMap<KeyType, int32>& ReferenceCounts)
+	{
+		FPubnubChatRepositoryEntryStats EntryStats;
+		EntryStats.EntriesCount = Entries.Num();
+		EntryStats.ReferenceCountHistogram.Init(0, Pubnub_Chat_Memory_Stats_Reference_Count_Buckets);
+		EntryStats.ApproximateBytes = Entries.GetAllocatedSize() + ReferenceCounts.GetAllocatedSize();
+		
+		//Keys are interned handles and timetokens, their strings are counted by the ID table
+		for (const TPair<KeyType, InternalDataType>& Entry : Entries)
+		{
+			EntryStats.ApproximateBytes += GetApproximateDataSize(Entry.Value);
+			EntryStats.ReferenceCountHistogram[GetReferenceCountHistogramBucket(ReferenceCounts.FindRef(Entry.Key))]++;
+		}
+		return EntryStats;
+	}
+
+	FPubnubChatIDHandle GetIDHandle(FPubnubChatIDHandle Key)
+	{
+		return Key;
+	}
+
+	FPubnubChatIDHandle GetIDHandle(const FPubnubChatMessageKey& Key)
+	{
+		return Key.ChannelHandle;
+	}
+
+	/**
+	 * Returns entry of the key, added if it doesn't exist. Every entry holds a reference of the interned ID of its key, so the ID is released with its last entry.
+	 * Caller has to hold a reference of the ID and the lock of the entries.
+	 */
+	template<typename KeyType, typename ValueType>
+	ValueType& FindOrAddInternedEntry(FPubnubChatIDTable& IDTable, TMap<KeyType, ValueType>& Entries, const KeyType& Key)
+	{
+		if (ValueType* Entry = Entries.Find(Key))
+		{
+			return *Entry;
+		}
+		IDTable.AddReference(GetIDHandle(Key));
+		return Entries.Add(Key, ValueType());
+	}
+
+	/** Removes entry of the key and releases its reference of the interned ID. Has to be called with the lock of the entries taken */
+	template<typename KeyType, typename ValueType>
+	bool RemoveInternedEntry(FPubnubChatIDTable& IDTable, TMap<KeyType, ValueType>& Entries, const KeyType& Key)
+	{
+		if (Entries.Remove(Key) == 0)
+		{
+			return false;
+		}
+		IDTable.Release(GetIDHandle(Key));
+		return true;
+	}
+
+	/** Removes all entries and releases their references of the interned IDs. Has to be called with the lock of the entries taken */
+	template<typename KeyType, typename ValueType>
+	void EmptyInternedEntries(FPubnubChatIDTable& IDTable, TMap<KeyType, ValueType>& Entries)
+	{
+		for (const TPair<KeyType, ValueType>& Entry : Entries)
+		{
+			IDTable.Release(GetIDHandle(Entry.Key));
+		}
+		Entries.Empty();
+	}
+}
+
 
 void UPubnubChatObjectsRepository::RegisterUser(const FString& UserID)
 {
+	LLM_SCOPE_BYTAG(PubnubChat_Repository);
 	if (UserID.IsEmpty())
 	{
 		return;
 	}
 
+	const FPubnubChatIDHandle UserHandle = IDTable.Intern(UserID);
+	ON_SCOPE_EXIT { IDTable.Release(UserHandle); };
 	FScopeLock Lock(&UsersCriticalSection);
 	
 	// Increment reference count
-	int32& Count = UserReferenceCounts.FindOrAdd(UserID, 0);
+	int32& Count = FindOrAddInternedEntry(IDTable, UserReferenceCounts, UserHandle);
 	Count++;
 	
 	// If this is the first reference, ensure data exists
 	if (Count == 1)
 	{
-		if (!Users.Contains(UserID))
+		if (!Users.Contains(UserHandle))
 		{
-			FPubnubChatInternalUser NewUser;
-			NewUser.UserID = UserID;
-			Users.Add(UserID, NewUser);
+			FindOrAddInternedEntry(IDTable, Users, UserHandle).UserID = UserID;
 		}
 	}
 }
@@ -37,8 +157,9 @@ void UPubnubChatObjectsRepository::UnregisterUser(const FString& UserID)
 	}
 
 	FScopeLock Lock(&UsersCriticalSection);
+	const FPubnubChatIDHandle UserHandle = IDTable.Find(UserID);
 	
-	int32* CountPtr = UserReferenceCounts.Find(UserID);
+	int32* CountPtr = UserReferenceCounts.Find(UserHandle);
 	if (!CountPtr)
 	{
 		return; // Already cleaned up or never registered
@@ -50,32 +171,33 @@ void UPubnubChatObjectsRepository::UnregisterUser(const FString& UserID)
 	// If no more references, clean up data
 	if (*CountPtr <= 0)
 	{
-		Users.Remove(UserID);
-		UserReferenceCounts.Remove(UserID);
+		RemoveInternedEntry(IDTable, Users, UserHandle);
+		RemoveInternedEntry(IDTable, UserReferenceCounts, UserHandle);
 	}
 }
 
 void UPubnubChatObjectsRepository::RegisterChannel(const FString& ChannelID)
 {
+	LLM_SCOPE_BYTAG(PubnubChat_Repository);
 	if (ChannelID.IsEmpty())
 	{
 		return;
 	}
 
+	const FPubnubChatIDHandle ChannelHandle = IDTable.Intern(ChannelID);
+	ON_SCOPE_EXIT { IDTable.Release(ChannelHandle); };
 	FScopeLock Lock(&ChannelsCriticalSection);
 	
 	// Increment reference count
-	int32& Count = ChannelReferenceCounts.FindOrAdd(ChannelID, 0);
+	int32& Count = FindOrAddInternedEntry(IDTable, ChannelReferenceCounts, ChannelHandle);
 	Count++;
 	
 	// If this is the first reference, ensure data exists
 	if (Count == 1)
 	{
-		if (!Channels.Contains(ChannelID))
+		if (!Channels.Contains(ChannelHandle))
 		{
-			FPubnubChatInternalChannel NewChannel;
-			NewChannel.ChannelID = ChannelID;
-			Channels.Add(ChannelID, NewChannel);
+			FindOrAddInternedEntry(IDTable, Channels, ChannelHandle).ChannelID = ChannelID;
 		}
 	}
 }
@@ -88,8 +210,9 @@ void UPubnubChatObjectsRepository::UnregisterChannel(const FString& ChannelID)
 	}
 
 	FScopeLock Lock(&ChannelsCriticalSection);
+	const FPubnubChatIDHandle ChannelHandle = IDTable.Find(ChannelID);
 	
-	int32* CountPtr = ChannelReferenceCounts.Find(ChannelID);
+	int32* CountPtr = ChannelReferenceCounts.Find(ChannelHandle);
 	if (!CountPtr)
 	{
 		return; // Already cleaned up or never registered
@@ -101,15 +224,16 @@ void UPubnubChatObjectsRepository::UnregisterChannel(const FString& ChannelID)
 	// If no more references, clean up data
 	if (*CountPtr <= 0)
 	{
-		Channels.Remove(ChannelID);
-		ChannelReferenceCounts.Remove(ChannelID);
+		RemoveInternedEntry(IDTable, Channels, ChannelHandle);
+		RemoveInternedEntry(IDTable, ChannelReferenceCounts, ChannelHandle);
 	}
 }
 
 bool UPubnubChatObjectsRepository::TryGetUserData(const FString& UserID, FPubnubChatUserData& OutUserData) const
 {
 	FScopeLock Lock(&UsersCriticalSection);
-	if (const FPubnubChatInternalUser* InternalUser = Users.Find(UserID))
+	const FPubnubChatIDHandle UserHandle = IDTable.Find(UserID);
+	if (const FPubnubChatInternalUser* InternalUser = Users.Find(UserHandle))
 	{
 		OutUserData = InternalUser->UserData;
 		return true;
@@ -117,32 +241,80 @@ bool UPubnubChatObjectsRepository::TryGetUserData(const FString& UserID, FPubnub
 	return false;
 }
 
-void UPubnubChatObjectsRepository::UpdateUserData(const FString& UserID, const FPubnubChatUserData& UserData)
+bool UPubnubChatObjectsRepository::UpdateUserData(const FString& UserID, const FPubnubChatUserData& UserData, const FString& ServerUpdated)
 {
+	LLM_SCOPE_BYTAG(PubnubChat_Repository);
+	const FPubnubChatIDHandle UserHandle = IDTable.Intern(UserID);
+	ON_SCOPE_EXIT { IDTable.Release(UserHandle); };
+	// Store writes queued under the lock are written after it's released
+	ON_SCOPE_EXIT { FlushStoreWrites(); };
 	FScopeLock Lock(&UsersCriticalSection);
 	
-	if (!Users.Contains(UserID))
+	FPubnubChatInternalUser* InternalUserPtr = Users.Find(UserHandle);
+	if (!InternalUserPtr)
 	{
-		FPubnubChatInternalUser NewUser;
-		NewUser.UserID = UserID;
-		Users.Add(UserID, NewUser);
+		InternalUserPtr = &FindOrAddInternedEntry(IDTable, Users, UserHandle);
+		InternalUserPtr->UserID = UserID;
 	}
 	
-	FPubnubChatInternalUser& InternalUser = Users[UserID];
+	FPubnubChatInternalUser& InternalUser = *InternalUserPtr;
+	if (IsServerUpdatedStale(InternalUser.ServerUpdated, ServerUpdated))
+	{ return false; }
+	
+	// Parse activity timestamp only when Custom changes, so IsActive doesn't have to parse it on every call
+	if (InternalUser.UserData.Custom != UserData.Custom)
+	{
+		InternalUser.LastActiveTimestamp = UPubnubChatInternalUtilities::TimetokenToInt64(UPubnubChatInternalUtilities::GetLastActiveTimestampFromCustom(UserData.Custom));
+	}
 	InternalUser.UserData = UserData;
-	InternalUser.LastUpdated = FDateTime::Now();
+	if (!ServerUpdated.IsEmpty())
+	{
+		InternalUser.ServerUpdated = ServerUpdated;
+	}
+	InternalUser.Version = NextDataVersion();
+	
+	// Queued under the repository lock, so the store gets updates of the same user in the same order
+	QueueStoreWrite([StoredUser = InternalUser](UPubnubChatPersistentStore& Store) { Store.StoreUser(StoredUser); });
+	return true;
+}
+
+int64 UPubnubChatObjectsRepository::GetUserDataVersion(const FString& UserID) const
+{
+	FScopeLock Lock(&UsersCriticalSection);
+	const FPubnubChatIDHandle UserHandle = IDTable.Find(UserID);
+	const FPubnubChatInternalUser* InternalUser = Users.Find(UserHandle);
+	return InternalUser ? InternalUser->Version : 0;
+}
+
+bool UPubnubChatObjectsRepository::TryGetUserLastActiveTimestamp(const FString& UserID, int64& OutTimestamp) const
+{
+	FScopeLock Lock(&UsersCriticalSection);
+	const FPubnubChatIDHandle UserHandle = IDTable.Find(UserID);
+	if (const FPubnubChatInternalUser* InternalUser = Users.Find(UserHandle))
+	{
+		if (InternalUser->LastActiveTimestamp > 0)
+		{
+			OutTimestamp = InternalUser->LastActiveTimestamp;
+			return true;
+		}
+	}
+	return false;
 }
 
 bool UPubnubChatObjectsRepository::RemoveUserData(const FString& UserID)
 {
+	ON_SCOPE_EXIT { FlushStoreWrites(); };
 	FScopeLock Lock(&UsersCriticalSection);
-	return Users.Remove(UserID) > 0;
+	const FPubnubChatIDHandle UserHandle = IDTable.Find(UserID);
+	QueueStoreWrite([UserID](UPubnubChatPersistentStore& Store) { Store.RemoveUser(UserID); });
+	return RemoveInternedEntry(IDTable, Users, UserHandle);
 }
 
 bool UPubnubChatObjectsRepository::TryGetChannelData(const FString& ChannelID, FPubnubChatChannelData& OutChannelData) const
 {
 	FScopeLock Lock(&ChannelsCriticalSection);
-	if (const FPubnubChatInternalChannel* InternalChannel = Channels.Find(ChannelID))
+	const FPubnubChatIDHandle ChannelHandle = IDTable.Find(ChannelID);
+	if (const FPubnubChatInternalChannel* InternalChannel = Channels.Find(ChannelHandle))
 	{
 		OutChannelData = InternalChannel->ChannelData;
 		return true;
@@ -150,63 +322,92 @@ bool UPubnubChatObjectsRepository::TryGetChannelData(const FString& ChannelID, F
 	return false;
 }
 
-void UPubnubChatObjectsRepository::UpdateChannelData(const FString& ChannelID, const FPubnubChatChannelData& ChannelData)
+bool UPubnubChatObjectsRepository::UpdateChannelData(const FString& ChannelID, const FPubnubChatChannelData& ChannelData, const FString& ServerUpdated)
 {
+	LLM_SCOPE_BYTAG(PubnubChat_Repository);
+	const FPubnubChatIDHandle ChannelHandle = IDTable.Intern(ChannelID);
+	ON_SCOPE_EXIT { IDTable.Release(ChannelHandle); };
+	ON_SCOPE_EXIT { FlushStoreWrites(); };
 	FScopeLock Lock(&ChannelsCriticalSection);
 	
-	if (!Channels.Contains(ChannelID))
+	FPubnubChatInternalChannel* InternalChannelPtr = Channels.Find(ChannelHandle);
+	if (!InternalChannelPtr)
 	{
-		FPubnubChatInternalChannel NewChannel;
-		NewChannel.ChannelID = ChannelID;
-		Channels.Add(ChannelID, NewChannel);
+		InternalChannelPtr = &FindOrAddInternedEntry(IDTable, Channels, ChannelHandle);
+		InternalChannelPtr->ChannelID = ChannelID;
 	}
 	
-	FPubnubChatInternalChannel& InternalChannel = Channels[ChannelID];
+	FPubnubChatInternalChannel& InternalChannel = *InternalChannelPtr;
+	if (IsServerUpdatedStale(InternalChannel.ServerUpdated, ServerUpdated))
+	{ return false; }
+	
 	InternalChannel.ChannelData = ChannelData;
-	InternalChannel.LastUpdated = FDateTime::Now();
+	if (!ServerUpdated.IsEmpty())
+	{
+		InternalChannel.ServerUpdated = ServerUpdated;
+	}
+	InternalChannel.Version = NextDataVersion();
+	
+	QueueStoreWrite([StoredChannel = InternalChannel](UPubnubChatPersistentStore& Store) { Store.StoreChannel(StoredChannel); });
+	return true;
+}
+
+int64 UPubnubChatObjectsRepository::GetChannelDataVersion(const FString& ChannelID) const
+{
+	FScopeLock Lock(&ChannelsCriticalSection);
+	const FPubnubChatIDHandle ChannelHandle = IDTable.Find(ChannelID);
+	const FPubnubChatInternalChannel* InternalChannel = Channels.Find(ChannelHandle);
+	return InternalChannel ? InternalChannel->Version : 0;
 }
 
 bool UPubnubChatObjectsRepository::RemoveChannelData(const FString& ChannelID)
 {
+	ON_SCOPE_EXIT { FlushStoreWrites(); };
 	FScopeLock Lock(&ChannelsCriticalSection);
-	return Channels.Remove(ChannelID) > 0;
+	const FPubnubChatIDHandle ChannelHandle = IDTable.Find(ChannelID);
+	QueueStoreWrite([ChannelID](UPubnubChatPersistentStore& Store) { Store.RemoveChannel(ChannelID); });
+	return RemoveInternedEntry(IDTable, Channels, ChannelHandle);
 }
 
 void UPubnubChatObjectsRepository::RegisterMessage(const FString& MessageID)
 {
+	LLM_SCOPE_BYTAG(PubnubChat_Repository);
 	if (MessageID.IsEmpty())
 	{
 		return;
 	}
 
+	FPubnubChatMessageKey MessageKey;
+	if (!MakeMessageKey(MessageID, true, MessageKey))
+	{
+		return;
+	}
+	
+	ON_SCOPE_EXIT { IDTable.Release(MessageKey.ChannelHandle); };
 	FScopeLock Lock(&MessagesCriticalSection);
 	
 	// Increment reference count
-	int32& Count = MessageReferenceCounts.FindOrAdd(MessageID, 0);
+	int32& Count = FindOrAddInternedEntry(IDTable, MessageReferenceCounts, MessageKey);
 	Count++;
 	
 	// If this is the first reference, ensure data exists
 	if (Count == 1)
 	{
-		if (!Messages.Contains(MessageID))
-		{
-			FPubnubChatInternalMessage NewMessage;
-			NewMessage.MessageID = MessageID;
-			Messages.Add(MessageID, NewMessage);
-		}
+		FindOrAddMessage(MessageKey, MessageID);
 	}
 }
 
 void UPubnubChatObjectsRepository::UnregisterMessage(const FString& MessageID)
 {
-	if (MessageID.IsEmpty())
+	FScopeLock Lock(&MessagesCriticalSection);
+	
+	FPubnubChatMessageKey MessageKey;
+	if (!MakeMessageKey(MessageID, false, MessageKey))
 	{
 		return;
 	}
-
-	FScopeLock Lock(&MessagesCriticalSection);
 	
-	int32* CountPtr = MessageReferenceCounts.Find(MessageID);
+	int32* CountPtr = MessageReferenceCounts.Find(MessageKey);
 	if (!CountPtr)
 	{
 		return; // Already cleaned up or never registered
@@ -218,15 +419,20 @@ void UPubnubChatObjectsRepository::UnregisterMessage(const FString& MessageID)
 	// If no more references, clean up data
 	if (*CountPtr <= 0)
 	{
-		Messages.Remove(MessageID);
-		MessageReferenceCounts.Remove(MessageID);
+		RemoveInternedEntry(IDTable, Messages, MessageKey);
+		RemoveInternedEntry(IDTable, MessageReferenceCounts, MessageKey);
 	}
 }
 
 bool UPubnubChatObjectsRepository::TryGetMessageData(const FString& MessageID, FPubnubChatMessageData& OutMessageData) const
 {
 	FScopeLock Lock(&MessagesCriticalSection);
-	if (const FPubnubChatInternalMessage* InternalMessage = Messages.Find(MessageID))
+	
+	FPubnubChatMessageKey MessageKey;
+	if (!MakeMessageKey(MessageID, false, MessageKey))
+	{ return false; }
+	
+	if (const FPubnubChatInternalMessage* InternalMessage = Messages.Find(MessageKey))
 	{
 		OutMessageData = InternalMessage->MessageData;
 		return true;
@@ -236,47 +442,226 @@ bool UPubnubChatObjectsRepository::TryGetMessageData(const FString& MessageID, F
 
 void UPubnubChatObjectsRepository::UpdateMessageData(const FString& MessageID, const FPubnubChatMessageData& MessageData)
 {
+	LLM_SCOPE_BYTAG(PubnubChat_Repository);
+	FPubnubChatMessageKey MessageKey;
+	if (!MakeMessageKey(MessageID, true, MessageKey))
+	{ return; }
+	
+	ON_SCOPE_EXIT { IDTable.Release(MessageKey.ChannelHandle); };
+	ON_SCOPE_EXIT { FlushStoreWrites(); };
 	FScopeLock Lock(&MessagesCriticalSection);
 	
-	if (!Messages.Contains(MessageID))
+	FPubnubChatInternalMessage& InternalMessage = FindOrAddMessage(MessageKey, MessageID);
+	InternalMessage.MessageData = MessageData;
+	InternalMessage.Version = NextDataVersion();
+	
+	WriteThroughMessage(InternalMessage);
+}
+
+int64 UPubnubChatObjectsRepository::GetMessageDataVersion(const FString& MessageID) const
+{
+	FScopeLock Lock(&MessagesCriticalSection);
+	
+	FPubnubChatMessageKey MessageKey;
+	if (!MakeMessageKey(MessageID, false, MessageKey))
+	{ return 0; }
+	
+	const FPubnubChatInternalMessage* InternalMessage = Messages.Find(MessageKey);
+	return InternalMessage ? InternalMessage->Version : 0;
+}
+
+bool UPubnubChatObjectsRepository::MutateMessageData(const FString& MessageID, TFunctionRef<void(FPubnubChatMessageData&)> Mutation)
+{
+	LLM_SCOPE_BYTAG(PubnubChat_Repository);
+	ON_SCOPE_EXIT { FlushStoreWrites(); };
+	FScopeLock Lock(&MessagesCriticalSection);
+	
+	FPubnubChatMessageKey MessageKey;
+	if (!MakeMessageKey(MessageID, false, MessageKey))
+	{ return false; }
+	
+	FPubnubChatInternalMessage* InternalMessage = Messages.Find(MessageKey);
+	if (!InternalMessage)
+	{ return false; }
+	
+	Mutation(InternalMessage->MessageData);
+	InternalMessage->Version = NextDataVersion();
+	
+	WriteThroughMessage(*InternalMessage);
+	return true;
+}
+
+bool UPubnubChatObjectsRepository::AppendMessageAction(const FString& MessageID, const FPubnubChatMessageAction& MessageAction)
+{
+	LLM_SCOPE_BYTAG(PubnubChat_Repository);
+	ON_SCOPE_EXIT { FlushStoreWrites(); };
+	FScopeLock Lock(&MessagesCriticalSection);
+	
+	FPubnubChatMessageKey MessageKey;
+	if (!MakeMessageKey(MessageID, false, MessageKey))
+	{ return false; }
+	
+	FPubnubChatInternalMessage* InternalMessage = Messages.Find(MessageKey);
+	if (!InternalMessage)
+	{ return false; }
+	
+	//The same action can arrive both from the API response and from the live updates stream
+	for (const FPubnubChatMessageAction& ExistingAction : InternalMessage->MessageData.MessageActions)
 	{
-		FPubnubChatInternalMessage NewMessage;
-		NewMessage.MessageID = MessageID;
-		Messages.Add(MessageID, NewMessage);
+		if (UPubnubChatInternalUtilities::AreChatMessageActionsEqual(ExistingAction, MessageAction))
+		{ return false; }
 	}
 	
-	FPubnubChatInternalMessage& InternalMessage = Messages[MessageID];
-	InternalMessage.MessageData = MessageData;
-	InternalMessage.LastUpdated = FDateTime::Now();
+	InternalMessage->MessageData.MessageActions.Add(MessageAction);
+	InternalMessage->Version = NextDataVersion();
+	
+	WriteThroughMessage(*InternalMessage);
+	return true;
+}
+
+bool UPubnubChatObjectsRepository::RemoveMessageAction(const FString& MessageID, const FPubnubChatMessageAction& MessageAction)
+{
+	ON_SCOPE_EXIT { FlushStoreWrites(); };
+	FScopeLock Lock(&MessagesCriticalSection);
+	
+	FPubnubChatMessageKey MessageKey;
+	if (!MakeMessageKey(MessageID, false, MessageKey))
+	{ return false; }
+	
+	FPubnubChatInternalMessage* InternalMessage = Messages.Find(MessageKey);
+	if (!InternalMessage)
+	{ return false; }
+	
+	TArray<FPubnubChatMessageAction>& MessageActions = InternalMessage->MessageData.MessageActions;
+	const int32 ActionIndex = MessageActions.IndexOfByPredicate([&MessageAction](const FPubnubChatMessageAction& ExistingAction)
+	{
+		return UPubnubChatInternalUtilities::AreChatMessageActionsEqual(ExistingAction, MessageAction);
+	});
+	if (ActionIndex == INDEX_NONE)
+	{ return false; }
+	
+	MessageActions.RemoveAt(ActionIndex);
+	InternalMessage->Version = NextDataVersion();
+	
+	WriteThroughMessage(*InternalMessage);
+	return true;
 }
 
 bool UPubnubChatObjectsRepository::RemoveMessageData(const FString& MessageID)
 {
+	ON_SCOPE_EXIT { FlushStoreWrites(); };
 	FScopeLock Lock(&MessagesCriticalSection);
-	return Messages.Remove(MessageID) > 0;
+	FPubnubChatMessageKey MessageKey;
+	const bool bHasKey = MakeMessageKey(MessageID, false, MessageKey);
+	QueueStoreWrite([MessageID](UPubnubChatPersistentStore& Store) { Store.RemoveMessage(MessageID); });
+	if (SearchIndex)
+	{
+		SearchIndex->RemoveMessage(MessageID);
+	}
+	return bHasKey && RemoveInternedEntry(IDTable, Messages, MessageKey);
+}
+
+void UPubnubChatObjectsRepository::RegisterAndUpdateMessages(const TArray<FString>& MessageIDs, const TArray<FPubnubChatMessageData>& MessagesData, const TArray<FString>& MessageIDsToRegister)
+{
+	LLM_SCOPE_BYTAG(PubnubChat_Repository);
+	if (MessageIDs.Num() != MessagesData.Num())
+	{
+		return;
+	}
+
+	TArray<FPubnubChatInternalMessage> MessagesToStore;
+	
+	// Keys are made before the lock, interning takes the ID table lock. Each key holds a reference of its channel until the end of the function
+	TArray<FPubnubChatMessageKey> MessageKeys;
+	TArray<FPubnubChatMessageKey> MessageKeysToRegister;
+	MessageKeys.SetNum(MessageIDs.Num());
+	for (int32 i = 0; i < MessageIDs.Num(); ++i)
+	{
+		if (!MakeMessageKey(MessageIDs[i], true, MessageKeys[i]))
+		{
+			MessageKeys[i].ChannelHandle = INDEX_NONE;
+		}
+	}
+	for (const FString& MessageID : MessageIDsToRegister)
+	{
+		FPubnubChatMessageKey MessageKey;
+		if (MakeMessageKey(MessageID, true, MessageKey))
+		{
+			MessageKeysToRegister.Add(MessageKey);
+		}
+	}
+	ON_SCOPE_EXIT
+	{
+		for (const FPubnubChatMessageKey& MessageKey : MessageKeys)
+		{
+			IDTable.Release(MessageKey.ChannelHandle);
+		}
+		for (const FPubnubChatMessageKey& MessageKey : MessageKeysToRegister)
+		{
+			IDTable.Release(MessageKey.ChannelHandle);
+		}
+	};
+	
+	ON_SCOPE_EXIT { FlushStoreWrites(); };
+	FScopeLock Lock(&MessagesCriticalSection);
+	
+	// Increment reference counts for new objects
+	for (const FPubnubChatMessageKey& MessageKey : MessageKeysToRegister)
+	{
+		FindOrAddInternedEntry(IDTable, MessageReferenceCounts, MessageKey)++;
+	}
+	
+	for (int32 i = 0; i < MessageIDs.Num(); ++i)
+	{
+		const FString& MessageID = MessageIDs[i];
+		if (MessageKeys[i].ChannelHandle == INDEX_NONE)
+		{
+			continue;
+		}
+		
+		FPubnubChatInternalMessage& InternalMessage = FindOrAddMessage(MessageKeys[i], MessageID);
+		InternalMessage.MessageData = MessagesData[i];
+		InternalMessage.Version = NextDataVersion();
+		
+		if (PersistentStore)
+		{
+			MessagesToStore.Add(InternalMessage);
+		}
+		if (SearchIndex)
+		{
+			SearchIndex->IndexMessage(MessageID, MessagesData[i]);
+		}
+	}
+	
+	// Whole page is written to the store at once as well
+	if (!MessagesToStore.IsEmpty())
+	{
+		QueueStoreWrite([MessagesToStore = MoveTemp(MessagesToStore)](UPubnubChatPersistentStore& Store) { Store.StoreMessages(MessagesToStore); });
+	}
 }
 
 void UPubnubChatObjectsRepository::RegisterMembership(const FString& MembershipID)
 {
+	LLM_SCOPE_BYTAG(PubnubChat_Repository);
 	if (MembershipID.IsEmpty())
 	{
 		return;
 	}
 
+	const FPubnubChatIDHandle MembershipHandle = IDTable.Intern(MembershipID);
+	ON_SCOPE_EXIT { IDTable.Release(MembershipHandle); };
 	FScopeLock Lock(&MembershipsCriticalSection);
 	
 	// Increment reference count
-	int32& Count = MembershipReferenceCounts.FindOrAdd(MembershipID, 0);
+	int32& Count = FindOrAddInternedEntry(IDTable, MembershipReferenceCounts, MembershipHandle);
 	Count++;
 	
 	// If this is the first reference, ensure data exists
 	if (Count == 1)
 	{
-		if (!Memberships.Contains(MembershipID))
+		if (!Memberships.Contains(MembershipHandle))
 		{
-			FPubnubChatInternalMembership NewMembership;
-			NewMembership.MembershipID = MembershipID;
-			Memberships.Add(MembershipID, NewMembership);
+			FindOrAddInternedEntry(IDTable, Memberships, MembershipHandle).MembershipID = MembershipID;
 		}
 	}
 }
@@ -289,8 +674,9 @@ void UPubnubChatObjectsRepository::UnregisterMembership(const FString& Membershi
 	}
 
 	FScopeLock Lock(&MembershipsCriticalSection);
+	const FPubnubChatIDHandle MembershipHandle = IDTable.Find(MembershipID);
 	
-	int32* CountPtr = MembershipReferenceCounts.Find(MembershipID);
+	int32* CountPtr = MembershipReferenceCounts.Find(MembershipHandle);
 	if (!CountPtr)
 	{
 		return; // Already cleaned up or never registered
@@ -302,15 +688,16 @@ void UPubnubChatObjectsRepository::UnregisterMembership(const FString& Membershi
 	// If no more references, clean up data
 	if (*CountPtr <= 0)
 	{
-		Memberships.Remove(MembershipID);
-		MembershipReferenceCounts.Remove(MembershipID);
+		RemoveInternedEntry(IDTable, Memberships, MembershipHandle);
+		RemoveInternedEntry(IDTable, MembershipReferenceCounts, MembershipHandle);
 	}
 }
 
 bool UPubnubChatObjectsRepository::TryGetMembershipData(const FString& MembershipID, FPubnubChatMembershipData& OutMembershipData) const
 {
 	FScopeLock Lock(&MembershipsCriticalSection);
-	if (const FPubnubChatInternalMembership* InternalMembership = Memberships.Find(MembershipID))
+	const FPubnubChatIDHandle MembershipHandle = IDTable.Find(MembershipID);
+	if (const FPubnubChatInternalMembership* InternalMembership = Memberships.Find(MembershipHandle))
 	{
 		OutMembershipData = InternalMembership->MembershipData;
 		return true;
@@ -318,26 +705,97 @@ bool UPubnubChatObjectsRepository::TryGetMembershipData(const FString& Membershi
 	return false;
 }
 
-void UPubnubChatObjectsRepository::UpdateMembershipData(const FString& MembershipID, const FPubnubChatMembershipData& MembershipData)
+bool UPubnubChatObjectsRepository::UpdateMembershipData(const FString& MembershipID, const FPubnubChatMembershipData& MembershipData, const FString& ServerUpdated)
 {
-	FScopeLock Lock(&MembershipsCriticalSection);
+	LLM_SCOPE_BYTAG(PubnubChat_Repository);
+	const FPubnubChatIDHandle MembershipHandle = IDTable.Intern(MembershipID);
+	ON_SCOPE_EXIT { IDTable.Release(MembershipHandle); };
+	{
+		FScopeLock Lock(&MembershipsCriticalSection);
+		
+		FPubnubChatInternalMembership* InternalMembershipPtr = Memberships.Find(MembershipHandle);
+		if (!InternalMembershipPtr)
+		{
+			InternalMembershipPtr = &FindOrAddInternedEntry(IDTable, Memberships, MembershipHandle);
+			InternalMembershipPtr->MembershipID = MembershipID;
+		}
+		
+		FPubnubChatInternalMembership& InternalMembership = *InternalMembershipPtr;
+		if (IsServerUpdatedStale(InternalMembership.ServerUpdated, ServerUpdated))
+		{ return false; }
+		
+		const bool bCustomChanged = InternalMembership.MembershipData.Custom != MembershipData.Custom;
+		InternalMembership.MembershipData = MembershipData;
+		if (bCustomChanged)
+		{
+			UpdateLastReadMessageTimetoken(InternalMembership);
+		}
+		if (!ServerUpdated.IsEmpty())
+		{
+			InternalMembership.ServerUpdated = ServerUpdated;
+		}
+		InternalMembership.Version = NextDataVersion();
+	}
 	
-	if (!Memberships.Contains(MembershipID))
+	//Listeners may read the repository again, so notify them after the lock is released
+	OnMembershipDataUpdatedNative.Broadcast(MembershipID, MembershipData);
+	return true;
+}
+
+int64 UPubnubChatObjectsRepository::GetMembershipDataVersion(const FString& MembershipID) const
+{
+	FScopeLock Lock(&MembershipsCriticalSection);
+	const FPubnubChatIDHandle MembershipHandle = IDTable.Find(MembershipID);
+	const FPubnubChatInternalMembership* InternalMembership = Memberships.Find(MembershipHandle);
+	return InternalMembership ? InternalMembership->Version : 0;
+}
+
+bool UPubnubChatObjectsRepository::TryGetLastReadMessageTimetoken(const FString& MembershipID, int64& OutTimetoken) const
+{
+	FScopeLock Lock(&MembershipsCriticalSection);
+	const FPubnubChatIDHandle MembershipHandle = IDTable.Find(MembershipID);
+	if (const FPubnubChatInternalMembership* InternalMembership = Memberships.Find(MembershipHandle))
 	{
-		FPubnubChatInternalMembership NewMembership;
-		NewMembership.MembershipID = MembershipID;
-		Memberships.Add(MembershipID, NewMembership);
+		if (InternalMembership->LastReadMessageTimetoken > 0)
+		{
+			OutTimetoken = InternalMembership->LastReadMessageTimetoken;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool UPubnubChatObjectsRepository::MutateMembershipData(const FString& MembershipID, TFunctionRef<void(FPubnubChatMembershipData&)> Mutation, const FString& ServerUpdated)
+{
+	LLM_SCOPE_BYTAG(PubnubChat_Repository);
+	FPubnubChatMembershipData MutatedMembershipData;
+	{
+		FScopeLock Lock(&MembershipsCriticalSection);
+		const FPubnubChatIDHandle MembershipHandle = IDTable.Find(MembershipID);
+		
+		FPubnubChatInternalMembership* InternalMembership = Memberships.Find(MembershipHandle);
+		if (!InternalMembership || IsServerUpdatedStale(InternalMembership->ServerUpdated, ServerUpdated))
+		{ return false; }
+		
+		Mutation(InternalMembership->MembershipData);
+		UpdateLastReadMessageTimetoken(*InternalMembership);
+		if (!ServerUpdated.IsEmpty())
+		{
+			InternalMembership->ServerUpdated = ServerUpdated;
+		}
+		InternalMembership->Version = NextDataVersion();
+		MutatedMembershipData = InternalMembership->MembershipData;
 	}
 	
-	FPubnubChatInternalMembership& InternalMembership = Memberships[MembershipID];
-	InternalMembership.MembershipData = MembershipData;
-	InternalMembership.LastUpdated = FDateTime::Now();
+	OnMembershipDataUpdatedNative.Broadcast(MembershipID, MutatedMembershipData);
+	return true;
 }
 
 bool UPubnubChatObjectsRepository::RemoveMembershipData(const FString& MembershipID)
 {
 	FScopeLock Lock(&MembershipsCriticalSection);
-	return Memberships.Remove(MembershipID) > 0;
+	const FPubnubChatIDHandle MembershipHandle = IDTable.Find(MembershipID);
+	return RemoveInternedEntry(IDTable, Memberships, MembershipHandle);
 }
 
 void UPubnubChatObjectsRepository::ClearAll()
@@ -348,13 +806,287 @@ void UPubnubChatObjectsRepository::ClearAll()
 	FScopeLock MessagesLock(&MessagesCriticalSection);
 	FScopeLock MembershipsLock(&MembershipsCriticalSection);
 	
-	Users.Empty();
-	Channels.Empty();
-	Messages.Empty();
-	Memberships.Empty();
-	UserReferenceCounts.Empty();
-	ChannelReferenceCounts.Empty();
-	MessageReferenceCounts.Empty();
-	MembershipReferenceCounts.Empty();
+	EmptyInternedEntries(IDTable, Users);
+	EmptyInternedEntries(IDTable, Channels);
+	EmptyInternedEntries(IDTable, Messages);
+	EmptyInternedEntries(IDTable, Memberships);
+	EmptyInternedEntries(IDTable, UserReferenceCounts);
+	EmptyInternedEntries(IDTable, ChannelReferenceCounts);
+	EmptyInternedEntries(IDTable, MessageReferenceCounts);
+	EmptyInternedEntries(IDTable, MembershipReferenceCounts);
+	//IDTable is not cleared, other threads can hold references of IDs they interned before taking the data lock
+	
+	if (SearchIndex)
+	{
+		SearchIndex->Clear();
+	}
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+int32 UPubnubChatObjectsRepository::GetUserReferenceCount(const FString& UserID) const
+{
+	FScopeLock Lock(&UsersCriticalSection);
+	const FPubnubChatIDHandle UserHandle = IDTable.Find(UserID);
+	return UserReferenceCounts.FindRef(UserHandle);
+}
+
+int32 UPubnubChatObjectsRepository::GetChannelReferenceCount(const FString& ChannelID) const
+{
+	FScopeLock Lock(&ChannelsCriticalSection);
+	const FPubnubChatIDHandle ChannelHandle = IDTable.Find(ChannelID);
+	return ChannelReferenceCounts.FindRef(ChannelHandle);
+}
+
+int32 UPubnubChatObjectsRepository::GetMessageReferenceCount(const FString& MessageID) const
+{
+	FScopeLock Lock(&MessagesCriticalSection);
+	
+	FPubnubChatMessageKey MessageKey;
+	if (!MakeMessageKey(MessageID, false, MessageKey))
+	{ return 0; }
+	
+	return MessageReferenceCounts.FindRef(MessageKey);
+}
+
+int32 UPubnubChatObjectsRepository::GetMembershipReferenceCount(const FString& MembershipID) const
+{
+	FScopeLock Lock(&MembershipsCriticalSection);
+	const FPubnubChatIDHandle MembershipHandle = IDTable.Find(MembershipID);
+	return MembershipReferenceCounts.FindRef(MembershipHandle);
+}
+#endif
+
+void UPubnubChatObjectsRepository::GetMemoryStats(FPubnubChatMemoryStats& OutMemoryStats) const
+{
+	{
+		FScopeLock Lock(&UsersCriticalSection);
+		OutMemoryStats.Users = GetEntryStats(Users, UserReferenceCounts);
+	}
+	{
+		FScopeLock Lock(&ChannelsCriticalSection);
+		OutMemoryStats.Channels = GetEntryStats(Channels, ChannelReferenceCounts);
+	}
+	{
+		FScopeLock Lock(&MessagesCriticalSection);
+		OutMemoryStats.Messages = GetEntryStats(Messages, MessageReferenceCounts);
+		OutMemoryStats.SearchIndexBytes = SearchIndex ? SearchIndex->GetMemorySize() : 0;
+	}
+	{
+		FScopeLock Lock(&MembershipsCriticalSection);
+		OutMemoryStats.Memberships = GetEntryStats(Memberships, MembershipReferenceCounts);
+	}
+	
+	OutMemoryStats.InternedIDsBytes = IDTable.GetMemorySize();
+	
+	OutMemoryStats.RepositoryBytes = OutMemoryStats.Users.ApproximateBytes + OutMemoryStats.Channels.ApproximateBytes
+		+ OutMemoryStats.Messages.ApproximateBytes + OutMemoryStats.Memberships.ApproximateBytes + OutMemoryStats.SearchIndexBytes
+		+ OutMemoryStats.InternedIDsBytes;
+}
+
+void UPubnubChatObjectsRepository::SetPersistentStore(UPubnubChatPersistentStore* InPersistentStore)
+{
+	// Writes queued for the previous store are not moved to the new one
+	FlushStoreWrites();
+	PersistentStore = InPersistentStore;
+}
+
+void UPubnubChatObjectsRepository::EnableSearchIndex(int64 MaxMemoryBytes)
+{
+	LLM_SCOPE_BYTAG(PubnubChat_Repository);
+	FScopeLock Lock(&MessagesCriticalSection);
+	
+	if (SearchIndex)
+	{
+		return;
+	}
+	
+	SearchIndex = MakeUnique<FPubnubChatSearchIndex>(MaxMemoryBytes);
+	for (const TPair<FPubnubChatMessageKey, FPubnubChatInternalMessage>& MessagePair : Messages)
+	{
+		SearchIndex->IndexMessage(GetMessageID(MessagePair.Value), MessagePair.Value.MessageData);
+	}
+}
+
+void UPubnubChatObjectsRepository::SearchMessages(const FString& Query, const FString& ChannelFilter, int Limit, TArray<FPubnubChatSearchIndexHit>& OutHits) const
+{
+	OutHits.Empty();
+	if (SearchIndex)
+	{
+		SearchIndex->Search(Query, ChannelFilter, Limit, OutHits);
+	}
+}
+
+bool UPubnubChatObjectsRepository::TryLoadStoredUserData(const FString& UserID, FPubnubChatUserData& OutUserData) const
+{
+	FPubnubChatInternalUser StoredUser;
+	if (!PersistentStore || !PersistentStore->LoadUser(UserID, StoredUser))
+	{
+		return false;
+	}
+	OutUserData = StoredUser.UserData;
+	return true;
+}
+
+bool UPubnubChatObjectsRepository::TryLoadStoredChannelData(const FString& ChannelID, FPubnubChatChannelData& OutChannelData) const
+{
+	FPubnubChatInternalChannel StoredChannel;
+	if (!PersistentStore || !PersistentStore->LoadChannel(ChannelID, StoredChannel))
+	{
+		return false;
+	}
+	OutChannelData = StoredChannel.ChannelData;
+	return true;
+}
+
+void UPubnubChatObjectsRepository::LoadStoredMessages(const FString& ChannelID, int64 StartTimetoken, int64 EndTimetoken, int Count, TArray<FString>& OutTimetokens, TArray<FPubnubChatMessageData>& OutMessagesData) const
+{
+	OutTimetokens.Empty();
+	OutMessagesData.Empty();
+	if (!PersistentStore)
+	{
+		return;
+	}
+	
+	TArray<FPubnubChatInternalMessage> StoredMessages;
+	PersistentStore->LoadMessages(ChannelID, StartTimetoken, EndTimetoken, Count, StoredMessages);
+	
+	OutTimetokens.Reserve(StoredMessages.Num());
+	OutMessagesData.Reserve(StoredMessages.Num());
+	for (FPubnubChatInternalMessage& StoredMessage : StoredMessages)
+	{
+		OutTimetokens.Add(UPubnubChatInternalUtilities::Int64ToTimetoken(StoredMessage.Timetoken));
+		OutMessagesData.Add(MoveTemp(StoredMessage.MessageData));
+	}
 }
 
+void UPubnubChatObjectsRepository::ReconcileStoredMessages(const FString& ChannelID, int64 StartTimetoken, int64 EndTimetoken, const TSet<int64>& ServerTimetokens)
+{
+	if (PersistentStore)
+	{
+		PersistentStore->ReconcileMessages(ChannelID, StartTimetoken, EndTimetoken, ServerTimetokens);
+	}
+}
+
+void UPubnubChatObjectsRepository::WriteThroughMessage(const FPubnubChatInternalMessage& InternalMessage)
+{
+	QueueStoreWrite([StoredMessage = InternalMessage](UPubnubChatPersistentStore& Store) { Store.StoreMessages({StoredMessage}); });
+	if (SearchIndex)
+	{
+		SearchIndex->IndexMessage(GetMessageID(InternalMessage), InternalMessage.MessageData);
+	}
+}
+
+void UPubnubChatObjectsRepository::QueueStoreWrite(TUniqueFunction<void(UPubnubChatPersistentStore&)>&& StoreWrite)
+{
+	if (!PersistentStore)
+	{ return; }
+	
+	FScopeLock Lock(&PendingStoreWritesCriticalSection);
+	PendingStoreWrites.Add(MoveTemp(StoreWrite));
+}
+
+void UPubnubChatObjectsRepository::FlushStoreWrites()
+{
+	if (!PersistentStore)
+	{ return; }
+	
+	// Writes are taken from the queue while StoreWritesCriticalSection is held, so a later batch can't overtake an earlier one
+	FScopeLock WritesLock(&StoreWritesCriticalSection);
+	TArray<TUniqueFunction<void(UPubnubChatPersistentStore&)>> StoreWrites;
+	{
+		FScopeLock Lock(&PendingStoreWritesCriticalSection);
+		StoreWrites = MoveTemp(PendingStoreWrites);
+	}
+	
+	for (TUniqueFunction<void(UPubnubChatPersistentStore&)>& StoreWrite : StoreWrites)
+	{
+		StoreWrite(*PersistentStore);
+	}
+}
+
+bool UPubnubChatObjectsRepository::MakeMessageKey(const FString& MessageID, bool bIntern, FPubnubChatMessageKey& OutKey) const
+{
+	int32 SeparatorIndex = INDEX_NONE;
+	if (!MessageID.FindLastChar(TEXT('.'), SeparatorIndex) || SeparatorIndex == 0)
+	{
+		return false;
+	}
+	
+	const FStringView MessageIDView(MessageID);
+	if (!UPubnubChatInternalUtilities::TryParseTimetoken(MessageIDView.RightChop(SeparatorIndex + 1), OutKey.Timetoken))
+	{
+		return false;
+	}
+	
+	const FStringView ChannelID = MessageIDView.Left(SeparatorIndex);
+	OutKey.ChannelHandle = bIntern ? IDTable.Intern(ChannelID) : IDTable.Find(ChannelID);
+	return OutKey.ChannelHandle != INDEX_NONE;
+}
+
+FPubnubChatInternalMessage& UPubnubChatObjectsRepository::FindOrAddMessage(const FPubnubChatMessageKey& Key, const FString& MessageID)
+{
+	if (FPubnubChatInternalMessage* InternalMessage = Messages.Find(Key))
+	{
+		return *InternalMessage;
+	}
+	
+	int32 SeparatorIndex = INDEX_NONE;
+	MessageID.FindLastChar(TEXT('.'), SeparatorIndex);
+	
+	FPubnubChatInternalMessage& NewMessage = FindOrAddInternedEntry(IDTable, Messages, Key);
+	NewMessage.ChannelID = MessageID.Left(SeparatorIndex);
+	NewMessage.Timetoken = Key.Timetoken;
+	return NewMessage;
+}
+
+void UPubnubChatObjectsRepository::UpdateLastReadMessageTimetoken(FPubnubChatInternalMembership& InternalMembership)
+{
+	InternalMembership.LastReadMessageTimetoken = UPubnubChatInternalUtilities::TimetokenToInt64(UPubnubChatInternalUtilities::GetLastReadMessageTimetokenFromMembershipData(InternalMembership.MembershipData));
+}
+
+FString UPubnubChatObjectsRepository::GetMessageID(const FPubnubChatInternalMessage& InternalMessage)
+{
+	return FString::Printf(TEXT("%s.%lld"), *InternalMessage.ChannelID, InternalMessage.Timetoken);
+}
+
+bool UPubnubChatObjectsRepository::IsServerUpdatedStale(const FString& StoredServerUpdated, const FString& ServerUpdated)
+{
+	if (ServerUpdated.IsEmpty() || StoredServerUpdated.IsEmpty())
+	{ return false; }
+	
+	// Timestamps can differ in precision ("...:05Z" and "...:05.5Z"), so they are compared as times, not as strings
+	FDateTime StoredDateTime;
+	FDateTime DateTime;
+	if (!TryParseServerUpdated(StoredServerUpdated, StoredDateTime) || !TryParseServerUpdated(ServerUpdated, DateTime))
+	{ return false; }
+	
+	return DateTime < StoredDateTime;
+}
+
+bool UPubnubChatObjectsRepository::TryParseServerUpdated(const FString& ServerUpdated, FDateTime& OutDateTime)
+{
+	int32 DotIndex = INDEX_NONE;
+	if (!ServerUpdated.FindChar(TEXT('.'), DotIndex))
+	{
+		return FDateTime::ParseIso8601(*ServerUpdated, OutDateTime);
+	}
+	
+	// FDateTime::ParseIso8601 accepts only milliseconds, so the fraction is parsed here with the full FDateTime resolution of 100ns
+	int32 FractionEnd = DotIndex + 1;
+	while (FractionEnd < ServerUpdated.Len() && FChar::IsDigit(ServerUpdated[FractionEnd]))
+	{
+		++FractionEnd;
+	}
+	
+	if (!FDateTime::ParseIso8601(*(ServerUpdated.Left(DotIndex) + ServerUpdated.Mid(FractionEnd)), OutDateTime))
+	{ return false; }
+	
+	int64 FractionTicks = 0;
+	for (int32 Digit = 0; Digit < 7; ++Digit)
+	{
+		const int32 Index = DotIndex + 1 + Digit;
+		FractionTicks = FractionTicks * 10 + (Index < FractionEnd ? ServerUpdated[Index] - TEXT('0') : 0);
+	}
+	OutDateTime += FTimespan(FractionTicks);
+	return true;
+}
@@ -5,13 +5,20 @@
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
 #include "HAL/CriticalSection.h"
+#include "HAL/ThreadSafeCounter64.h"
 #include "StructLibraries/PubnubChatUserStructLibrary.h"
 #include "StructLibraries/PubnubChatChannelStructLibrary.h"
 #include "StructLibraries/PubnubChatMessageStructLibrary.h"
 #include "StructLibraries/PubnubChatStructLibrary.h"
 #include "StructLibraries/PubnubChatInternalStructLibrary.h"
+#include "PubnubChatSearchIndex.h"
+#include "PubnubChatIDTable.h"
 #include "PubnubChatObjectsRepository.generated.h"
 
+class UPubnubChatPersistentStore;
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnPubnubChatRepositoryMembershipUpdatedNative, const FString& MembershipID, const FPubnubChatMembershipData& MembershipData);
+
 /**
  * Repository class that manages shared data for all Chat objects.
  * All User and Channel objects with the same ID reference the same data in this repository.
@@ -20,6 +27,9 @@
  * Objects must register themselves when created and unregister when destroyed.
  * When the reference count for an object ID reaches 0, the data is automatically cleaned up.
  * 
+ * Functions take string IDs, but entries are keyed internally by IDs interned in an ID table and by int64 message timetokens,
+ * so lookups hash and compare integers and every ID string is stored once.
+ * 
  * This is an internal class and should not be used directly.
  */
 UCLASS()
@@ -30,6 +40,12 @@ class PUBNUBCHATSDK_API UPubnubChatObjectsRepository : public UObject
 	friend class UPubnubChat;
 
 public:
+	/**
+	 * Broadcast after membership data is updated with UpdateMembershipData, outside of the repository lock.
+	 * Can be broadcast from any thread.
+	 */
+	FOnPubnubChatRepositoryMembershipUpdatedNative OnMembershipDataUpdatedNative;
+	
 	/**
 	 * Registers a User object. Call this when a User object is created.
 	 * Increments the reference count for this UserID.
@@ -70,8 +86,24 @@ public:
 	 * Updates user data in the repository. Creates entry if it doesn't exist.
 	 * @param UserID The unique identifier of the user
 	 * @param UserData The new user data to store
+	 * @param ServerUpdated Server "updated" timestamp of the data. If it's older than the timestamp of stored data, the update is rejected. Empty for local data
+	 * @return True if data was stored, false if it was rejected as stale
 	 */
-	void UpdateUserData(const FString& UserID, const FPubnubChatUserData& UserData);
+	bool UpdateUserData(const FString& UserID, const FPubnubChatUserData& UserData, const FString& ServerUpdated = "");
+
+	/**
+	 * Gets local version of stored user data. Version changes on every accepted write, so it can be compared to tell if data changed.
+	 * @return Version of the data, 0 if the user is not in the repository
+	 */
+	int64 GetUserDataVersion(const FString& UserID) const;
+
+	/**
+	 * Gets last active timestamp of the user, parsed once when its Custom data was stored.
+	 * @param UserID The unique identifier of the user
+	 * @param OutTimestamp Receives the timestamp as int64 timetoken
+	 * @return True if the user exists in the repository and has the timestamp set, false otherwise
+	 */
+	bool TryGetUserLastActiveTimestamp(const FString& UserID, int64& OutTimestamp) const;
 
 	/**
 	 * Removes user data from the repository.
@@ -92,8 +124,16 @@ public:
 	 * Updates channel data in the repository. Creates entry if it doesn't exist.
 	 * @param ChannelID The unique identifier of the channel
 	 * @param ChannelData The new channel data to store
+	 * @param ServerUpdated Server "updated" timestamp of the data. If it's older than the timestamp of stored data, the update is rejected. Empty for local data
+	 * @return True if data was stored, false if it was rejected as stale
+	 */
+	bool UpdateChannelData(const FString& ChannelID, const FPubnubChatChannelData& ChannelData, const FString& ServerUpdated = "");
+
+	/**
+	 * Gets local version of stored channel data. Version changes on every accepted write, so it can be compared to tell if data changed.
+	 * @return Version of the data, 0 if the channel is not in the repository
 	 */
-	void UpdateChannelData(const FString& ChannelID, const FPubnubChatChannelData& ChannelData);
+	int64 GetChannelDataVersion(const FString& ChannelID) const;
 
 	/**
 	 * Removes channel data from the repository.
@@ -131,6 +171,35 @@ public:
 	 */
 	void UpdateMessageData(const FString& MessageID, const FPubnubChatMessageData& MessageData);
 
+	/**
+	 * Gets local version of stored message data. Version changes on every update, mutation and message action delta.
+	 * @return Version of the data, 0 if the message is not in the repository
+	 */
+	int64 GetMessageDataVersion(const FString& MessageID) const;
+
+	/**
+	 * Modifies stored message data in place under the repository lock, so concurrent updates of the same message are not lost.
+	 * Mutation must not call back into the repository. Does nothing if the message is not in the repository.
+	 * @param MessageID The composite unique identifier of the message in format "[ChannelID].[Timetoken]"
+	 * @param Mutation Function that modifies the stored data
+	 * @return True if the message was found and mutated, false otherwise
+	 */
+	bool MutateMessageData(const FString& MessageID, TFunctionRef<void(FPubnubChatMessageData&)> Mutation);
+
+	/**
+	 * Adds message action to stored message data, unless the same action (type, value, user and timetoken) is already there.
+	 * @param MessageID The composite unique identifier of the message in format "[ChannelID].[Timetoken]"
+	 * @return True if the action was added, false if the message is not in the repository or already has the action
+	 */
+	bool AppendMessageAction(const FString& MessageID, const FPubnubChatMessageAction& MessageAction);
+
+	/**
+	 * Removes message action with the same type, value, user and timetoken from stored message data.
+	 * @param MessageID The composite unique identifier of the message in format "[ChannelID].[Timetoken]"
+	 * @return True if the action was found and removed, false otherwise
+	 */
+	bool RemoveMessageAction(const FString& MessageID, const FPubnubChatMessageAction& MessageAction);
+
 	/**
 	 * Removes message data from the repository.
 	 * @param MessageID The composite unique identifier of the message in format "[ChannelID].[Timetoken]"
@@ -138,6 +207,15 @@ public:
 	 */
 	bool RemoveMessageData(const FString& MessageID);
 
+	/**
+	 * Registers newly created Message objects and updates data of a whole batch of messages (e.g. a history page) under a single lock.
+	 * Reference count is incremented only for IDs listed in MessageIDsToRegister - already registered objects that are reused only get their data updated.
+	 * @param MessageIDs Composite identifiers of the messages in format "[ChannelID].[Timetoken]"
+	 * @param MessagesData New message data to store, has to match MessageIDs by index
+	 * @param MessageIDsToRegister Composite identifiers of newly created Message objects
+	 */
+	void RegisterAndUpdateMessages(const TArray<FString>& MessageIDs, const TArray<FPubnubChatMessageData>& MessagesData, const TArray<FString>& MessageIDsToRegister);
+
 	/**
 	 * Registers a Membership object. Call this when a Membership object is created.
 	 * Increments the reference count for this MembershipID.
@@ -164,8 +242,35 @@ public:
 	 * Updates membership data in the repository. Creates entry if it doesn't exist.
 	 * @param MembershipID The composite unique identifier of the membership in format "[UserID].[ChannelID]"
 	 * @param MembershipData The new membership data to store
+	 * @param ServerUpdated Server "updated" timestamp of the data. If it's older than the timestamp of stored data, the update is rejected. Empty for local data
+	 * @return True if data was stored, false if it was rejected as stale
 	 */
-	void UpdateMembershipData(const FString& MembershipID, const FPubnubChatMembershipData& MembershipData);
+	bool UpdateMembershipData(const FString& MembershipID, const FPubnubChatMembershipData& MembershipData, const FString& ServerUpdated = "");
+
+	/**
+	 * Gets local version of stored membership data. Version changes on every accepted write, so it can be compared to tell if data changed.
+	 * @return Version of the data, 0 if the membership is not in the repository
+	 */
+	int64 GetMembershipDataVersion(const FString& MembershipID) const;
+
+	/**
+	 * Gets last read message timetoken of the membership, parsed once when its Custom data was stored.
+	 * @param MembershipID The composite unique identifier of the membership in format "[UserID].[ChannelID]"
+	 * @param OutTimetoken Receives the timetoken as int64
+	 * @return True if the membership exists in the repository and has the timetoken set, false otherwise
+	 */
+	bool TryGetLastReadMessageTimetoken(const FString& MembershipID, int64& OutTimetoken) const;
+
+	/**
+	 * Modifies stored membership data in place under the repository lock, so concurrent updates of the same membership are not lost.
+	 * Mutation must not call back into the repository. Does nothing if the membership is not in the repository.
+	 * OnMembershipDataUpdatedNative is broadcast with the mutated data after the lock is released.
+	 * @param MembershipID The composite unique identifier of the membership in format "[UserID].[ChannelID]"
+	 * @param Mutation Function that modifies the stored data
+	 * @param ServerUpdated Server "updated" timestamp of the change. If it's older than the timestamp of stored data, the mutation is not applied. Empty for local changes
+	 * @return True if the membership was found and mutated, false otherwise
+	 */
+	bool MutateMembershipData(const FString& MembershipID, TFunctionRef<void(FPubnubChatMembershipData&)> Mutation, const FString& ServerUpdated = "");
 
 	/**
 	 * Removes membership data from the repository.
@@ -176,37 +281,162 @@ public:
 
 	/**
 	 * Clears all user, channel, message, and membership data from the repository.
+	 * Data kept in the persistent store stays there for the next session.
 	 */
 	void ClearAll();
 
+#if WITH_DEV_AUTOMATION_TESTS
+	/**
+	 * Returns how many objects are registered for the ID. Used by stress tests to check reference counting invariants.
+	 * @return Reference count, 0 if the ID is not registered
+	 */
+	int32 GetUserReferenceCount(const FString& UserID) const;
+	int32 GetChannelReferenceCount(const FString& ChannelID) const;
+	int32 GetMessageReferenceCount(const FString& MessageID) const;
+	int32 GetMembershipReferenceCount(const FString& MembershipID) const;
+	/** @return Number of IDs interned by the repository, used by tests to check that IDs are released with their entries */
+	int32 GetInternedIDCount() const { return IDTable.Num(); }
+#endif
+
+	/**
+	 * Fills repository part of the memory stats: entry counts, approximate bytes and reference count histograms
+	 * of all data types, and memory of the search index. Can be called from any thread.
+	 */
+	void GetMemoryStats(FPubnubChatMemoryStats& OutMemoryStats) const;
+
+	/**
+	 * Sets the store that user, channel and message updates and removals are written through to.
+	 * Has to be called before the repository is used from other threads.
+	 * @param InPersistentStore Opened store, or nullptr to stop persisting data
+	 */
+	void SetPersistentStore(UPubnubChatPersistentStore* InPersistentStore);
+
+	/**
+	 * Loads user data saved in the persistent store, also by previous sessions. Doesn't change data held by the repository.
+	 * @return True if persistent store is set and has the user, false otherwise
+	 */
+	bool TryLoadStoredUserData(const FString& UserID, FPubnubChatUserData& OutUserData) const;
+
+	/**
+	 * Loads channel data saved in the persistent store, also by previous sessions. Doesn't change data held by the repository.
+	 * @return True if persistent store is set and has the channel, false otherwise
+	 */
+	bool TryLoadStoredChannelData(const FString& ChannelID, FPubnubChatChannelData& OutChannelData) const;
+
+	/**
+	 * Loads the newest messages of the channel saved in the persistent store within timetoken range, both ends inclusive.
+	 * @param OutTimetokens Receives timetokens of the messages, oldest first
+	 * @param OutMessagesData Receives data of the messages, matching OutTimetokens by index
+	 */
+	void LoadStoredMessages(const FString& ChannelID, int64 StartTimetoken, int64 EndTimetoken, int Count, TArray<FString>& OutTimetokens, TArray<FPubnubChatMessageData>& OutMessagesData) const;
+
+	/**
+	 * Removes messages of the channel within timetoken range (both ends inclusive) from the persistent store if the server didn't return them for this range.
+	 * @param ServerTimetokens Timetokens of all messages the server has in the range
+	 */
+	void ReconcileStoredMessages(const FString& ChannelID, int64 StartTimetoken, int64 EndTimetoken, const TSet<int64>& ServerTimetokens);
+
+	/**
+	 * Starts indexing text of messages updated in the repository. Messages already held by the repository are indexed right away.
+	 * Indexed messages stay searchable after their objects are released, until they are deleted or evicted by the memory budget.
+	 * @param MaxMemoryBytes Approximate memory budget of the index
+	 */
+	void EnableSearchIndex(int64 MaxMemoryBytes);
+
+	bool IsSearchIndexEnabled() const { return SearchIndex.IsValid(); }
+
+	/**
+	 * Finds indexed messages that contain all words of the query, every word matched as a prefix. Does nothing if the search index is disabled.
+	 * @param ChannelFilter If not empty, only messages of this channel are returned
+	 * @param OutHits Receives found messages, newest first
+	 */
+	void SearchMessages(const FString& Query, const FString& ChannelFilter, int Limit, TArray<FPubnubChatSearchIndexHit>& OutHits) const;
+
 private:
-	/** Map of UserID to internal user data */
+	/**
+	 * Interned user, channel and membership IDs that entries are keyed by. Every entry holds a reference of its ID, so the ID is released with its last entry.
+	 * Handles are looked up with the lock of the entries taken, so a found handle can't be given to other ID before the entries are read.
+	 */
+	mutable FPubnubChatIDTable IDTable;
+
+	/** Map of interned UserID to internal user data */
 	UPROPERTY()
-	TMap<FString, FPubnubChatInternalUser> Users;
+	TMap<int32, FPubnubChatInternalUser> Users;
 
-	/** Map of ChannelID to internal channel data */
+	/** Map of interned ChannelID to internal channel data */
 	UPROPERTY()
-	TMap<FString, FPubnubChatInternalChannel> Channels;
+	TMap<int32, FPubnubChatInternalChannel> Channels;
+
+	/** Map of message key (interned ChannelID and timetoken) to internal message data. Not a UPROPERTY, as the key is not a reflected type */
+	TMap<FPubnubChatMessageKey, FPubnubChatInternalMessage> Messages;
 
-	/** Map of composite MessageID (format: "[ChannelID].[Timetoken]") to internal message data */
+	/** Map of interned composite MembershipID (format: "[UserID].[ChannelID]") to internal membership data */
 	UPROPERTY()
-	TMap<FString, FPubnubChatInternalMessage> Messages;
+	TMap<int32, FPubnubChatInternalMembership> Memberships;
+
+	/** Reference counts for User objects - tracks how many User objects exist for each interned UserID */
+	TMap<int32, int32> UserReferenceCounts;
+
+	/** Reference counts for Channel objects - tracks how many Channel objects exist for each interned ChannelID */
+	TMap<int32, int32> ChannelReferenceCounts;
+
+	/** Reference counts for Message objects - tracks how many Message objects exist for each message key */
+	TMap<FPubnubChatMessageKey, int32> MessageReferenceCounts;
 
-	/** Map of composite MembershipID (format: "[UserID].[ChannelID]") to internal membership data */
+	/** Reference counts for Membership objects - tracks how many Membership objects exist for each interned composite MembershipID */
+	TMap<int32, int32> MembershipReferenceCounts;
+
+	/** Store that data updates are written through to. Null if persistence is disabled */
 	UPROPERTY()
-	TMap<FString, FPubnubChatInternalMembership> Memberships;
+	TObjectPtr<UPubnubChatPersistentStore> PersistentStore = nullptr;
+
+	/** Full-text index that message updates are written through to. Null if search is disabled */
+	TUniquePtr<FPubnubChatSearchIndex> SearchIndex;
+
+	/** Source of data versions, shared by all entry types so a version is never reused */
+	FThreadSafeCounter64 DataVersionCounter;
 
-	/** Reference counts for User objects - tracks how many User objects exist for each UserID */
-	TMap<FString, int32> UserReferenceCounts;
+	int64 NextDataVersion() { return DataVersionCounter.Increment(); }
 
-	/** Reference counts for Channel objects - tracks how many Channel objects exist for each ChannelID */
-	TMap<FString, int32> ChannelReferenceCounts;
+	/** @return True if ServerUpdated is older than StoredServerUpdated. Timestamps that can't be parsed are never stale */
+	static bool IsServerUpdatedStale(const FString& StoredServerUpdated, const FString& ServerUpdated);
+	/** Parses ISO 8601 server timestamp with any number of fractional second digits, including none */
+	static bool TryParseServerUpdated(const FString& ServerUpdated, FDateTime& OutDateTime);
+
+	/**
+	 * Splits composite MessageID ("[ChannelID].[Timetoken]") into the key of the message. Timetoken is the part after the last dot, ChannelID can contain dots.
+	 * @param bIntern If true, ChannelID is interned and the key holds a reference of it that the caller has to release.
+	 * If false, IDs that are not interned are not added and false is returned, as no entry can have them. Has to be called with MessagesCriticalSection locked then
+	 * @return False if the MessageID is not valid or its channel is not interned
+	 */
+	bool MakeMessageKey(const FString& MessageID, bool bIntern, FPubnubChatMessageKey& OutKey) const;
 
-	/** Reference counts for Message objects - tracks how many Message objects exist for each composite MessageID (format: "[ChannelID].[Timetoken]") */
-	TMap<FString, int32> MessageReferenceCounts;
+	/** Returns internal data of the message, created with its ChannelID and timetoken if it doesn't exist. Has to be called with MessagesCriticalSection locked */
+	FPubnubChatInternalMessage& FindOrAddMessage(const FPubnubChatMessageKey& Key, const FString& MessageID);
 
-	/** Reference counts for Membership objects - tracks how many Membership objects exist for each composite MembershipID (format: "[UserID].[ChannelID]") */
-	TMap<FString, int32> MembershipReferenceCounts;
+	/** Sets last read message timetoken of internal membership from its Custom data */
+	static void UpdateLastReadMessageTimetoken(FPubnubChatInternalMembership& InternalMembership);
+
+	/** Composite MessageID of internal message, used by the search index */
+	static FString GetMessageID(const FPubnubChatInternalMessage& InternalMessage);
+
+	/** Writes updated message through to the search index and queues its copy for the persistent store. Has to be called with MessagesCriticalSection locked */
+	void WriteThroughMessage(const FPubnubChatInternalMessage& InternalMessage);
+
+	/**
+	 * Queues a persistent store write. Called with the data lock of the written entry locked, so writes are queued in the order of the updates.
+	 * Does nothing if persistence is disabled.
+	 */
+	void QueueStoreWrite(TUniqueFunction<void(UPubnubChatPersistentStore&)>&& StoreWrite);
+	/** Writes all queued store writes in the order they were queued. Has to be called without any data lock locked, store writes do file I/O */
+	void FlushStoreWrites();
+
+	/** Store writes waiting for FlushStoreWrites, oldest first */
+	TArray<TUniqueFunction<void(UPubnubChatPersistentStore&)>> PendingStoreWrites;
+	/** Guards only PendingStoreWrites, never held while anything else is locked or written */
+	FCriticalSection PendingStoreWritesCriticalSection;
+	/** Held by FlushStoreWrites while it writes, so batches taken by different threads reach the store in order */
+	FCriticalSection StoreWritesCriticalSection;
 
 	/** Critical section for thread-safe access to user data */
 	mutable FCriticalSection UsersCriticalSection;
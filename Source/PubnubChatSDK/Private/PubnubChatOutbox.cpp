@@ -0,0 +1,634 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatOutbox.h"
+#include "PubnubClient.h"
+#include "PubnubChat.h"
+#include "PubnubChatChannel.h"
+#include "PubnubChatConst.h"
+#include "PubnubChatInternalMacros.h"
+#include "PubnubChatObjectsRepository.h"
+#include "PubnubChatSubsystem.h"
+#include "FunctionLibraries/PubnubChatInternalConverters.h"
+#include "FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "FunctionLibraries/PubnubChatLogUtilities.h"
+#include "FunctionLibraries/PubnubTimetokenUtilities.h"
+#include "HAL/FileManager.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Threads/PubnubFunctionThread.h"
+
+
+void UPubnubChatOutbox::InitOutbox(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FPubnubChatOutboxConfig& InOutboxConfig)
+{
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InPubnubClient, TEXT("Can't init Outbox, PubnubClient is invalid"));
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InChat, TEXT("Can't init Outbox, Chat is invalid"));
+
+	PubnubClient = InPubnubClient;
+	Chat = InChat;
+	OutboxConfig = InOutboxConfig;
+}
+
+bool UPubnubChatOutbox::OpenJournal(const FString& InJournalFilePath)
+{
+	FScopeLock Lock(&OutboxCriticalSection);
+	JournalFilePath = InJournalFilePath;
+
+	TArray<FString> JournalLines;
+	if (FPaths::FileExists(JournalFilePath))
+	{
+		FFileHelper::LoadFileToStringArray(JournalLines, *JournalFilePath);
+	}
+	Entries = ReplayJournal(JournalLines, NumFinishedRecords);
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(JournalFilePath), true);
+	JournalWriter.Reset(IFileManager::Get().CreateFileWriter(*JournalFilePath, FILEWRITE_Append | FILEWRITE_AllowRead));
+	if (!JournalWriter)
+	{
+		Entries.Empty();
+		return false;
+	}
+
+	DropExpiredEntries();
+	if (NumFinishedRecords >= Pubnub_Chat_Outbox_Compaction_Threshold)
+	{
+		CompactJournal();
+	}
+	return true;
+}
+
+void UPubnubChatOutbox::CloseJournal()
+{
+	FScopeLock Lock(&OutboxCriticalSection);
+	if (JournalWriter)
+	{
+		JournalWriter->Close();
+		JournalWriter.Reset();
+	}
+	Entries.Empty();
+	SourceChannels.Empty();
+}
+
+bool UPubnubChatOutbox::ShouldQueue(const FString& ChannelID) const
+{
+	if (!OutboxConfig.Enabled)
+	{ return false; }
+
+	FScopeLock Lock(&OutboxCriticalSection);
+	if (!JournalWriter)
+	{ return false; }
+
+	//Newer mutations of a channel can't overtake its queued ones
+	return bOffline || Entries.ContainsByPredicate([&ChannelID](const FPubnubChatInternalOutboxEntry& Entry)
+	{
+		return Entry.ChannelID == ChannelID;
+	});
+}
+
+FPubnubChatOperationResult UPubnubChatOutbox::Enqueue(const FPubnubChatInternalOutboxEntry& Entry, UPubnubChatChannel* SourceChannel)
+{
+	FPubnubChatOperationResult FinalResult;
+	bool bRequestFlush = false;
+	{
+		FScopeLock Lock(&OutboxCriticalSection);
+		PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(JournalWriter.IsValid(), TEXT("Outbox journal is not open"));
+		PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED((Entries.Num() < OutboxConfig.MaxEntries), TEXT("Outbox is full, mutation can't be queued"));
+
+		//Only the newest last read message timetoken of a membership has to be sent
+		if (Entry.Operation == EPubnubChatOutboxOperation::PCOO_SetLastReadMessageTimetoken)
+		{
+			for (int i = Entries.Num() - 1; i >= 0; --i)
+			{
+				const FPubnubChatInternalOutboxEntry& QueuedEntry = Entries[i];
+				if (QueuedEntry.Operation == Entry.Operation && QueuedEntry.Attempts == 0 && QueuedEntry.ChannelID == Entry.ChannelID && QueuedEntry.MembershipUserID == Entry.MembershipUserID)
+				{
+					FinishEntry(i);
+				}
+			}
+		}
+
+		FPubnubChatInternalOutboxEntry& QueuedEntry = Entries.Add_GetRef(Entry);
+		QueuedEntry.QueuedTimetoken = UPubnubTimetokenUtilities::GetCurrentUnixTimetoken();
+		QueuedEntry.Attempts = 0;
+		AppendRecord(EPubnubChatOutboxRecordType::PCORT_Queued, QueuedEntry);
+		if (SourceChannel)
+		{
+			SourceChannels.Add(Entry.EntryID, SourceChannel);
+		}
+
+		//Mutation was queued only to keep the channel order, it can be sent right away
+		bRequestFlush = !bOffline;
+	}
+
+	if (bRequestFlush)
+	{
+		RequestFlush();
+	}
+
+	//It's not an error, but add it to the result
+	FinalResult.AddStep("QueueInOutbox", FPubnubOperationResult({0, false, TEXT("Mutation was queued in the outbox and will be sent when the connection is online")}));
+	return FinalResult;
+}
+
+bool UPubnubChatOutbox::CancelQueuedReaction(const FString& ChannelID, const FString& MessageTimetoken, const FString& Reaction)
+{
+	FScopeLock Lock(&OutboxCriticalSection);
+	for (int i = Entries.Num() - 1; i >= 0; --i)
+	{
+		const FPubnubChatInternalOutboxEntry& Entry = Entries[i];
+		const bool bIsReaction = Entry.Operation == EPubnubChatOutboxOperation::PCOO_AddReaction || Entry.Operation == EPubnubChatOutboxOperation::PCOO_RemoveReaction;
+		if (bIsReaction && Entry.Attempts == 0 && Entry.ChannelID == ChannelID && Entry.MessageTimetoken == MessageTimetoken && Entry.Text == Reaction)
+		{
+			FinishEntry(i);
+			return true;
+		}
+	}
+	return false;
+}
+
+void UPubnubChatOutbox::HandleConnectionStatusChanged(EPubnubChatConnectionStatus Status)
+{
+	if (!OutboxConfig.Enabled)
+	{ return; }
+
+	bool bRequestFlush = false;
+	{
+		FScopeLock Lock(&OutboxCriticalSection);
+		bOffline = Status != EPubnubChatConnectionStatus::PCCS_ConnectionOnline;
+		bRequestFlush = !bOffline && !Entries.IsEmpty();
+	}
+
+	if (bRequestFlush)
+	{
+		RequestFlush();
+	}
+}
+
+void UPubnubChatOutbox::RequestFlush()
+{
+	if (!Chat.IsValid() || !Chat->AsyncFunctionsThread)
+	{
+		return;
+	}
+
+	TWeakObjectPtr<UPubnubChatOutbox> WeakThis = MakeWeakObjectPtr(this);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis]
+	{
+		if(!WeakThis.IsValid())
+		{return;}
+
+		FPubnubChatOperationResult FlushResult = WeakThis.Get()->Flush();
+		if (FlushResult.Error)
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("Failed to send some mutations queued in the outbox, they will be sent again after reconnect: %s"), *FlushResult.ErrorMessage);
+		}
+	});
+}
+
+FPubnubChatOperationResult UPubnubChatOutbox::Flush()
+{
+	FPubnubChatOperationResult FinalResult;
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(PubnubClient && Chat.IsValid(), TEXT("Outbox is not initialized"));
+
+	{
+		FScopeLock Lock(&OutboxCriticalSection);
+		if (bFlushing)
+		{ return FinalResult; }
+		bFlushing = true;
+		DropExpiredEntries();
+	}
+
+	//Channel whose mutation failed is skipped, so its later mutations are not sent before the failed one
+	TSet<FString> BlockedChannelIDs;
+	while (true)
+	{
+		FPubnubChatInternalOutboxEntry Entry;
+		TWeakObjectPtr<UPubnubChatChannel> SourceChannel = nullptr;
+		{
+			FScopeLock Lock(&OutboxCriticalSection);
+			if (bOffline)
+			{ break; }
+
+			const int EntryIndex = Entries.IndexOfByPredicate([&BlockedChannelIDs](const FPubnubChatInternalOutboxEntry& QueuedEntry)
+			{
+				return !BlockedChannelIDs.Contains(QueuedEntry.ChannelID);
+			});
+			if (EntryIndex == INDEX_NONE)
+			{ break; }
+
+			//Started record is written before sending, so after a crash the mutation is looked up on the server before it's sent again
+			Entries[EntryIndex].Attempts++;
+			AppendRecord(EPubnubChatOutboxRecordType::PCORT_Started, Entries[EntryIndex]);
+			Entry = Entries[EntryIndex];
+			SourceChannel = SourceChannels.FindRef(Entry.EntryID);
+		}
+
+		FPubnubChatOperationResult SendResult = SendEntry(Entry, SourceChannel);
+
+		FScopeLock Lock(&OutboxCriticalSection);
+		if (SendResult.Error && Entry.Attempts < Pubnub_Chat_Outbox_Max_Attempts)
+		{
+			BlockedChannelIDs.Add(Entry.ChannelID);
+			FinalResult.Merge(SendResult);
+			continue;
+		}
+
+		if (SendResult.Error)
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("Mutation of channel %s queued in the outbox failed %d times and is dropped: %s"), *Entry.ChannelID, Entry.Attempts, *SendResult.ErrorMessage);
+			FailLocalEcho(Entry.EntryID, SourceChannel);
+		}
+
+		const int EntryIndex = Entries.IndexOfByPredicate([&Entry](const FPubnubChatInternalOutboxEntry& QueuedEntry)
+		{
+			return QueuedEntry.EntryID == Entry.EntryID;
+		});
+		if (EntryIndex != INDEX_NONE)
+		{
+			FinishEntry(EntryIndex);
+		}
+	}
+
+	FScopeLock Lock(&OutboxCriticalSection);
+	bFlushing = false;
+	return FinalResult;
+}
+
+int UPubnubChatOutbox::GetNumQueuedEntries() const
+{
+	FScopeLock Lock(&OutboxCriticalSection);
+	return Entries.Num();
+}
+
+FString UPubnubChatOutbox::GetJournalFilePath(const FString& UserID)
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), Pubnub_Chat_Outbox_Directory, FPaths::MakeValidFileName(UserID) + TEXT(".journal"));
+}
+
+FString UPubnubChatOutbox::SerializeRecord(const FPubnubChatInternalOutboxRecord& Record)
+{
+	FString RecordJson;
+	FJsonObjectConverter::UStructToJsonObjectString(Record, RecordJson, 0, 0, 0, nullptr, false);
+	return RecordJson;
+}
+
+TArray<FPubnubChatInternalOutboxEntry> UPubnubChatOutbox::ReplayJournal(const TArray<FString>& JournalLines, int& OutNumFinishedRecords)
+{
+	TArray<FPubnubChatInternalOutboxEntry> QueuedEntries;
+	OutNumFinishedRecords = 0;
+
+	for (const FString& Line : JournalLines)
+	{
+		FPubnubChatInternalOutboxRecord Record;
+		if (Line.IsEmpty() || !FJsonObjectConverter::JsonObjectStringToUStruct(Line, &Record, 0, 0) || Record.Version != Pubnub_Chat_Outbox_Version)
+		{ continue; }
+
+		const int EntryIndex = QueuedEntries.IndexOfByPredicate([&Record](const FPubnubChatInternalOutboxEntry& Entry)
+		{
+			return Entry.EntryID == Record.EntryID;
+		});
+
+		switch (Record.Type)
+		{
+		case EPubnubChatOutboxRecordType::PCORT_Queued:
+			if (EntryIndex == INDEX_NONE && !Record.EntryID.IsEmpty())
+			{
+				QueuedEntries.Add(Record.Entry);
+			}
+			break;
+		case EPubnubChatOutboxRecordType::PCORT_Started:
+			if (EntryIndex != INDEX_NONE)
+			{
+				QueuedEntries[EntryIndex].Attempts++;
+			}
+			break;
+		case EPubnubChatOutboxRecordType::PCORT_Finished:
+			if (EntryIndex != INDEX_NONE)
+			{
+				QueuedEntries.RemoveAt(EntryIndex);
+			}
+			OutNumFinishedRecords++;
+			break;
+		}
+	}
+
+	return QueuedEntries;
+}
+
+FPubnubChatOperationResult UPubnubChatOutbox::SendEntry(const FPubnubChatInternalOutboxEntry& Entry, TWeakObjectPtr<UPubnubChatChannel> SourceChannel)
+{
+	FPubnubChatOperationResult FinalResult;
+
+	//Mutation started by an earlier attempt may have reached the server before the attempt failed or the application crashed
+	if (Entry.Attempts > 1)
+	{
+		bool bApplied = false;
+		FString PublishedTimetoken;
+		FPubnubChatOperationResult LookupResult = FindAppliedEntry(Entry, bApplied, PublishedTimetoken);
+		//Sending the mutation again without the lookup could apply it twice, so it waits for the next flush
+		PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, LookupResult);
+		if (bApplied)
+		{
+			if (Entry.Operation == EPubnubChatOutboxOperation::PCOO_SendText)
+			{
+				return CompleteSendText(Entry, PublishedTimetoken, SourceChannel);
+			}
+			return FinalResult;
+		}
+	}
+
+	const FString MessageID = FString::Printf(TEXT("%s.%s"), *Entry.ChannelID, *Entry.MessageTimetoken);
+
+	switch (Entry.Operation)
+	{
+	case EPubnubChatOutboxOperation::PCOO_SendText:
+		{
+			FPubnubPublishSettings PublishSettings;
+			PublishSettings.MetaData = Entry.Meta;
+			PublishSettings.StoreInHistory = Entry.StoreInHistory;
+			if (Entry.SendByPost)
+			{
+				PublishSettings.PublishMethod = EPubnubPublishMethod::PPM_SendViaPOST;
+			}
+			FPubnubPublishMessageResult PublishResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Publish, "PublishMessage", FinalResult, PubnubClient->PublishMessage(Entry.ChannelID, UPubnubChatInternalUtilities::ChatMessageToPublishString(Entry.Text), PublishSettings));
+			PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, PublishResult.Result, "PublishMessage");
+
+			FPubnubChatOperationResult CompleteResult = CompleteSendText(Entry, PublishResult.PublishedMessage.Timetoken, SourceChannel);
+			FinalResult.Merge(CompleteResult);
+			break;
+		}
+	case EPubnubChatOutboxOperation::PCOO_AddReaction:
+	case EPubnubChatOutboxOperation::PCOO_EditText:
+		{
+			const EPubnubChatMessageActionType ActionType = Entry.Operation == EPubnubChatOutboxOperation::PCOO_EditText ? EPubnubChatMessageActionType::PCMAT_Edited : EPubnubChatMessageActionType::PCMAT_Reaction;
+			FPubnubAddMessageActionResult AddActionResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Publish, "AddMessageAction", FinalResult, PubnubClient->AddMessageAction(Entry.ChannelID, Entry.MessageTimetoken, UPubnubChatInternalConverters::ChatMessageActionTypeToString(ActionType), Entry.Text));
+			PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, AddActionResult.Result, "AddMessageAction");
+
+			Chat->ObjectsRepository->AppendMessageAction(MessageID, FPubnubChatMessageAction::FromPubnubMessageActionData(AddActionResult.MessageActionData));
+			break;
+		}
+	case EPubnubChatOutboxOperation::PCOO_RemoveReaction:
+		{
+			FPubnubOperationResult RemoveActionResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Write, "RemoveMessageAction", FinalResult, PubnubClient->RemoveMessageAction(Entry.ChannelID, Entry.MessageTimetoken, Entry.ActionTimetoken));
+			//Removal started by an earlier attempt may have already removed the reaction, any other error is retried
+			if (RemoveActionResult.Error && !IsReactionAlreadyRemoved(RemoveActionResult))
+			{
+				FinalResult.AddStep("RemoveMessageAction", RemoveActionResult);
+				return FinalResult;
+			}
+
+			FPubnubChatMessageAction Reaction;
+			Reaction.Type = EPubnubChatMessageActionType::PCMAT_Reaction;
+			Reaction.Value = Entry.Text;
+			Reaction.Timetoken = Entry.ActionTimetoken;
+			Reaction.UserID = Chat->CurrentUserID;
+			Chat->ObjectsRepository->RemoveMessageAction(MessageID, Reaction);
+			break;
+		}
+	case EPubnubChatOutboxOperation::PCOO_SetLastReadMessageTimetoken:
+		{
+			//Membership data in the repository can be newer than the queued one, the queued one is used only when there is none
+			const FString MembershipID = FString::Printf(TEXT("%s.%s"), *Entry.ChannelID, *Entry.MembershipUserID);
+			FPubnubChatMembershipData MembershipData = Entry.MembershipData;
+			Chat->ObjectsRepository->MutateMembershipData(MembershipID, [&](FPubnubChatMembershipData& StoredMembershipData)
+			{
+				UPubnubChatInternalUtilities::AddLastReadMessageTimetokenToMembershipData(StoredMembershipData, Entry.MessageTimetoken);
+				MembershipData = StoredMembershipData;
+			});
+
+			const FString Filter = UPubnubChatInternalUtilities::GetFilterForChannelID(Entry.ChannelID);
+			FPubnubMembershipsResult SetMembershipResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Write, "SetMemberships", FinalResult, PubnubClient->SetMemberships(Entry.MembershipUserID, {FPubnubChatUpdateMembershipInputData::FromChatMembershipData(MembershipData).ToPubnubMembershipInputData(Entry.ChannelID)}, FPubnubMembershipInclude::FromValue(true), 1, Filter));
+			PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, SetMembershipResult.Result, "SetMemberships");
+
+			if (!SetMembershipResult.MembershipsData.IsEmpty())
+			{
+				Chat->ObjectsRepository->UpdateMembershipData(MembershipID, FPubnubChatMembershipData::FromPubnubMembershipData(SetMembershipResult.MembershipsData[0]), SetMembershipResult.MembershipsData[0].Updated);
+			}
+
+			if (Entry.EmitReceiptEvent)
+			{
+				FPubnubChatOperationResult EmitEventResult = Chat->EmitChatEvent(EPubnubChatEventType::PCET_Receipt, Entry.ChannelID, UPubnubChatInternalUtilities::GetReceiptEventPayload(Entry.MessageTimetoken));
+				FinalResult.Merge(EmitEventResult);
+			}
+			break;
+		}
+	}
+
+	return FinalResult;
+}
+
+FPubnubChatOperationResult UPubnubChatOutbox::FindAppliedEntry(const FPubnubChatInternalOutboxEntry& Entry, bool& OutApplied, FString& OutPublishedTimetoken)
+{
+	FPubnubChatOperationResult FinalResult;
+	OutApplied = false;
+
+	//Removing a reaction and setting last read message timetoken can be safely sent again
+	if (Entry.Operation != EPubnubChatOutboxOperation::PCOO_SendText && Entry.Operation != EPubnubChatOutboxOperation::PCOO_AddReaction && Entry.Operation != EPubnubChatOutboxOperation::PCOO_EditText)
+	{ return FinalResult; }
+
+	int64 ServerTimetoken = 0;
+	FPubnubChatOperationResult TimeResult = Chat->FetchServerTimetoken(ServerTimetoken);
+	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, TimeResult);
+
+	const int64 LocalAge = UPubnubChatInternalUtilities::TimetokenToInt64(UPubnubTimetokenUtilities::GetCurrentUnixTimetoken()) - UPubnubChatInternalUtilities::TimetokenToInt64(Entry.QueuedTimetoken);
+	const int64 WindowStart = GetLookupWindowStart(ServerTimetoken, LocalAge, OutboxConfig.MaxAgeSeconds);
+	FString PageStartTimetoken = UPubnubChatInternalUtilities::Int64ToTimetoken(ServerTimetoken);
+
+	if (Entry.Operation == EPubnubChatOutboxOperation::PCOO_SendText)
+	{
+		//Message is matched by its client generated ID, pages go from the newest messages back to the start of the window
+		FPubnubFetchHistorySettings FetchHistorySettings;
+		FetchHistorySettings.End = UPubnubChatInternalUtilities::Int64ToTimetoken(WindowStart);
+		FetchHistorySettings.IncludeMeta = true;
+		FetchHistorySettings.IncludeUserID = true;
+		FetchHistorySettings.MaxPerChannel = Pubnub_Chat_Max_Message_Actions_Page;
+		while (true)
+		{
+			FetchHistorySettings.Start = PageStartTimetoken;
+			FPubnubFetchHistoryResult FetchHistoryResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Read, "FetchHistory", FinalResult, PubnubClient->FetchHistory(Entry.ChannelID, FetchHistorySettings));
+			PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, FetchHistoryResult.Result, "FetchHistory");
+
+			int64 OldestTimetoken = MAX_int64;
+			for (const FPubnubHistoryMessageData& Message : FetchHistoryResult.Messages)
+			{
+				if (Message.UserID == Chat->CurrentUserID && UPubnubChatInternalUtilities::GetClientMessageIDFromMeta(Message.Meta) == Entry.EntryID)
+				{
+					OutApplied = true;
+					OutPublishedTimetoken = Message.Timetoken;
+					return FinalResult;
+				}
+				OldestTimetoken = FMath::Min(OldestTimetoken, UPubnubChatInternalUtilities::TimetokenToInt64(Message.Timetoken));
+			}
+
+			if (FetchHistoryResult.Messages.Num() < FetchHistorySettings.MaxPerChannel || OldestTimetoken <= WindowStart)
+			{ return FinalResult; }
+
+			PageStartTimetoken = UPubnubChatInternalUtilities::Int64ToTimetoken(OldestTimetoken);
+		}
+	}
+
+	//Actions have no client generated ID, they are matched by message, user, type and value
+	const EPubnubChatMessageActionType ActionType = Entry.Operation == EPubnubChatOutboxOperation::PCOO_EditText ? EPubnubChatMessageActionType::PCMAT_Edited : EPubnubChatMessageActionType::PCMAT_Reaction;
+	const FString ActionTypeString = UPubnubChatInternalConverters::ChatMessageActionTypeToString(ActionType);
+	const FString WindowStartTimetoken = UPubnubChatInternalUtilities::Int64ToTimetoken(WindowStart);
+	while (true)
+	{
+		FPubnubGetMessageActionsResult GetMessageActionsResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Read, "GetMessageActions", FinalResult, PubnubClient->GetMessageActions(Entry.ChannelID, PageStartTimetoken, WindowStartTimetoken, Pubnub_Chat_Max_Message_Actions_Page));
+		PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, GetMessageActionsResult.Result, "GetMessageActions");
+
+		int64 OldestTimetoken = MAX_int64;
+		for (const FPubnubMessageActionData& ActionData : GetMessageActionsResult.MessageActions)
+		{
+			if (ActionData.MessageTimetoken == Entry.MessageTimetoken && ActionData.UserID == Chat->CurrentUserID && ActionData.Type == ActionTypeString && ActionData.Value == Entry.Text)
+			{
+				OutApplied = true;
+				return FinalResult;
+			}
+			OldestTimetoken = FMath::Min(OldestTimetoken, UPubnubChatInternalUtilities::TimetokenToInt64(ActionData.ActionTimetoken));
+		}
+
+		if (GetMessageActionsResult.MessageActions.Num() < Pubnub_Chat_Max_Message_Actions_Page || OldestTimetoken <= WindowStart)
+		{ return FinalResult; }
+
+		PageStartTimetoken = UPubnubChatInternalUtilities::Int64ToTimetoken(OldestTimetoken);
+	}
+}
+
+int64 UPubnubChatOutbox::GetLookupWindowStart(int64 ServerTimetoken, int64 LocalAge, int MaxAgeSeconds)
+{
+	//Timetoken has 100ns resolution, so 1s is 10000000 timetoken units
+	int64 Lookback = FMath::Max<int64>(LocalAge, 0);
+	//Expired mutations are dropped, so a local clock that jumped back can't make the window longer than the max age
+	if (MaxAgeSeconds > 0)
+	{
+		Lookback = FMath::Min<int64>(Lookback, static_cast<int64>(MaxAgeSeconds) * 10000000);
+	}
+	Lookback += static_cast<int64>(Pubnub_Chat_Outbox_Lookup_Margin_Seconds) * 10000000;
+	return FMath::Max<int64>(ServerTimetoken - Lookback, 0);
+}
+
+bool UPubnubChatOutbox::IsReactionAlreadyRemoved(const FPubnubOperationResult& RemoveActionResult)
+{
+	return RemoveActionResult.Error && RemoveActionResult.Status == 404;
+}
+
+FPubnubChatOperationResult UPubnubChatOutbox::CompleteSendText(const FPubnubChatInternalOutboxEntry& Entry, const FString& PublishedTimetoken, TWeakObjectPtr<UPubnubChatChannel> SourceChannel)
+{
+	FPubnubChatOperationResult FinalResult;
+
+	//Locally echoed message is moved to the server timetoken, thread channel adds its thread root action if it's the first message
+	if (UPubnubChatChannel* Channel = SourceChannel.Get())
+	{
+		Channel->ConfirmLocalEcho(Entry.EntryID, PublishedTimetoken);
+		FPubnubChatOperationResult OnSendTextResult = Channel->OnSendText();
+		FinalResult.Merge(OnSendTextResult);
+	}
+
+	for (const TPair<FString, FString>& MentionedUser : Entry.MentionedUsers)
+	{
+		FPubnubChatOperationResult EmitMentionResult = Chat->EmitChatEvent(EPubnubChatEventType::PCET_Mention, MentionedUser.Key, UPubnubChatInternalUtilities::GetMentionEventPayload(Entry.ChannelID, PublishedTimetoken, MentionedUser.Value, Entry.ParentChannelID));
+		FinalResult.Merge(EmitMentionResult);
+	}
+
+	return FinalResult;
+}
+
+void UPubnubChatOutbox::FinishEntry(int EntryIndex)
+{
+	const FString EntryID = Entries[EntryIndex].EntryID;
+	AppendRecord(EPubnubChatOutboxRecordType::PCORT_Finished, Entries[EntryIndex]);
+	Entries.RemoveAt(EntryIndex);
+	SourceChannels.Remove(EntryID);
+
+	NumFinishedRecords++;
+	if (NumFinishedRecords >= Pubnub_Chat_Outbox_Compaction_Threshold)
+	{
+		CompactJournal();
+	}
+}
+
+void UPubnubChatOutbox::DropExpiredEntries()
+{
+	if (OutboxConfig.MaxAgeSeconds <= 0)
+	{ return; }
+
+	//Timetoken has 100ns resolution, so 1s is 10000000 timetoken units
+	const int64 OldestAllowedTimetoken = UPubnubChatInternalUtilities::TimetokenToInt64(UPubnubTimetokenUtilities::GetCurrentUnixTimetoken()) - static_cast<int64>(OutboxConfig.MaxAgeSeconds) * 10000000;
+	for (int i = Entries.Num() - 1; i >= 0; --i)
+	{
+		if (UPubnubChatInternalUtilities::TimetokenToInt64(Entries[i].QueuedTimetoken) < OldestAllowedTimetoken)
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("Mutation of channel %s queued in the outbox is older than %d seconds and is dropped."), *Entries[i].ChannelID, OutboxConfig.MaxAgeSeconds);
+			FailLocalEcho(Entries[i].EntryID, SourceChannels.FindRef(Entries[i].EntryID));
+			FinishEntry(i);
+		}
+	}
+}
+
+void UPubnubChatOutbox::AppendRecord(EPubnubChatOutboxRecordType Type, const FPubnubChatInternalOutboxEntry& Entry)
+{
+	if (!JournalWriter)
+	{ return; }
+
+	FPubnubChatInternalOutboxRecord Record;
+	Record.Version = Pubnub_Chat_Outbox_Version;
+	Record.Type = Type;
+	Record.EntryID = Entry.EntryID;
+	if (Type == EPubnubChatOutboxRecordType::PCORT_Queued)
+	{
+		Record.Entry = Entry;
+	}
+
+	//Every record is a single line, flushed right away so it survives a crash
+	FTCHARToUTF8 RecordLine(*(SerializeRecord(Record) + TEXT("\n")));
+	JournalWriter->Serialize(const_cast<ANSICHAR*>(RecordLine.Get()), RecordLine.Length());
+	JournalWriter->Flush();
+}
+
+void UPubnubChatOutbox::CompactJournal()
+{
+	if (JournalWriter)
+	{
+		JournalWriter->Close();
+		JournalWriter.Reset();
+	}
+
+	//Journal is replaced by a complete new file, so a crash during compaction leaves the old journal intact
+	FString JournalContent;
+	for (const FPubnubChatInternalOutboxEntry& Entry : Entries)
+	{
+		FPubnubChatInternalOutboxRecord Record;
+		Record.Version = Pubnub_Chat_Outbox_Version;
+		Record.Type = EPubnubChatOutboxRecordType::PCORT_Queued;
+		Record.EntryID = Entry.EntryID;
+		Record.Entry = Entry;
+		JournalContent += SerializeRecord(Record) + TEXT("\n");
+
+		Record.Type = EPubnubChatOutboxRecordType::PCORT_Started;
+		Record.Entry = FPubnubChatInternalOutboxEntry();
+		for (int i = 0; i < Entry.Attempts; ++i)
+		{
+			JournalContent += SerializeRecord(Record) + TEXT("\n");
+		}
+	}
+
+	const FString TempFilePath = JournalFilePath + TEXT(".tmp");
+	if (FFileHelper::SaveStringToFile(JournalContent, *TempFilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM) && IFileManager::Get().Move(*JournalFilePath, *TempFilePath, true))
+	{
+		NumFinishedRecords = 0;
+	}
+	else
+	{
+		UE_LOG(PubnubChatLog, Warning, TEXT("Failed to compact outbox journal %s."), *JournalFilePath);
+	}
+
+	JournalWriter.Reset(IFileManager::Get().CreateFileWriter(*JournalFilePath, FILEWRITE_Append | FILEWRITE_AllowRead));
+}
+
+void UPubnubChatOutbox::FailLocalEcho(const FString& EntryID, TWeakObjectPtr<UPubnubChatChannel> SourceChannel)
+{
+	if (UPubnubChatChannel* Channel = SourceChannel.Get())
+	{
+		Channel->FailLocalEcho(EntryID);
+	}
+}
@@ -0,0 +1,132 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "HAL/CriticalSection.h"
+#include "PubnubChatEnumLibrary.h"
+#include "StructLibraries/PubnubChatStructLibrary.h"
+#include "StructLibraries/PubnubChatInternalStructLibrary.h"
+#include "PubnubChatOutbox.generated.h"
+
+class UPubnubClient;
+class UPubnubChat;
+class UPubnubChatChannel;
+
+/**
+ * Queue of chat mutations made while the connection is offline.
+ * Every queued mutation is appended to a journal file in Saved/ (one JSON record per line), together with records
+ * of flush attempts and finished mutations, so queued mutations survive application restarts.
+ * When the connection is back, mutations are sent in the order they were queued. A channel whose mutation fails
+ * is skipped until the next flush, so mutations of one channel are never reordered.
+ * Mutations that were started before a crash are first looked up on the server by their idempotency key,
+ * so a message or message action is never sent twice.
+ *
+ * This is an internal class and should not be used directly. Configure it with FPubnubChatConfig::Outbox.
+ */
+UCLASS()
+class PUBNUBCHATSDK_API UPubnubChatOutbox : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	void InitOutbox(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FPubnubChatOutboxConfig& InOutboxConfig);
+
+	/**
+	 * Opens the journal file, creating it if needed, and loads mutations queued by the previous session.
+	 * @return False if the journal can't be written
+	 */
+	bool OpenJournal(const FString& InJournalFilePath);
+	void CloseJournal();
+
+	/** True if mutations of given channel have to be queued - connection is offline or older mutations of the channel are still queued */
+	bool ShouldQueue(const FString& ChannelID) const;
+
+	/**
+	 * Queues mutation and writes it to the journal.
+	 * @param SourceChannel Channel object that sent a locally echoed message, its echo is confirmed when the message is published
+	 * @return Operation result. Fails if the outbox is full
+	 */
+	FPubnubChatOperationResult Enqueue(const FPubnubChatInternalOutboxEntry& Entry, UPubnubChatChannel* SourceChannel = nullptr);
+
+	/**
+	 * Removes queued reaction of given message that was not sent yet, so toggling a reaction twice while offline sends nothing.
+	 * @return True if a queued reaction was removed
+	 */
+	bool CancelQueuedReaction(const FString& ChannelID, const FString& MessageTimetoken, const FString& Reaction);
+
+	/** Remembers if the connection is offline and requests flush when it's back. Game thread only. */
+	void HandleConnectionStatusChanged(EPubnubChatConnectionStatus Status);
+
+	/** Queues Flush on the Chat async thread. */
+	void RequestFlush();
+
+	/**
+	 * Sends all queued mutations in order.
+	 * Blocking: performs network requests on the calling thread.
+	 */
+	FPubnubChatOperationResult Flush();
+
+	int GetNumQueuedEntries() const;
+
+	/** Path of the outbox journal of given user in Saved/ */
+	static FString GetJournalFilePath(const FString& UserID);
+	static FString SerializeRecord(const FPubnubChatInternalOutboxRecord& Record);
+	/**
+	 * Rebuilds queued mutations from journal lines, in the order they were queued. Broken lines (e.g. torn by a crash) are skipped.
+	 * @param OutNumFinishedRecords Receives number of records that are not needed anymore, used to decide about rewriting the journal
+	 */
+	static TArray<FPubnubChatInternalOutboxEntry> ReplayJournal(const TArray<FString>& JournalLines, int& OutNumFinishedRecords);
+	/**
+	 * Oldest server timetoken at which a started mutation can have been applied. Queued timetoken comes from the local clock, so only the age
+	 * of the mutation is taken from it and the window is anchored on the server time, with a margin for clock drift.
+	 * @param LocalAge Time since the mutation was queued, measured by the local clock
+	 */
+	static int64 GetLookupWindowStart(int64 ServerTimetoken, int64 LocalAge, int MaxAgeSeconds);
+	/** True if removal of a reaction failed only because the reaction is not on the server anymore */
+	static bool IsReactionAlreadyRemoved(const FPubnubOperationResult& RemoveActionResult);
+
+private:
+	UPROPERTY()
+	TObjectPtr<UPubnubClient> PubnubClient = nullptr;
+	TWeakObjectPtr<UPubnubChat> Chat = nullptr;
+	FPubnubChatOutboxConfig OutboxConfig;
+
+	FString JournalFilePath = "";
+	TUniquePtr<FArchive> JournalWriter;
+	int NumFinishedRecords = 0;
+
+	/** Queued mutations in the order they were queued */
+	TArray<FPubnubChatInternalOutboxEntry> Entries;
+	/** Channel objects of locally echoed messages, keyed by EntryID. Not persisted - echoes don't survive restarts */
+	TMap<FString, TWeakObjectPtr<UPubnubChatChannel>> SourceChannels;
+
+	bool bOffline = false;
+	bool bFlushing = false;
+
+	mutable FCriticalSection OutboxCriticalSection;
+
+	/** Sends single mutation. Started mutations are looked up on the server first. Blocking */
+	FPubnubChatOperationResult SendEntry(const FPubnubChatInternalOutboxEntry& Entry, TWeakObjectPtr<UPubnubChatChannel> SourceChannel);
+	/**
+	 * Checks if mutation started by an earlier attempt is already applied on the server. Blocking
+	 * @param OutApplied Receives true if the mutation was found on the server
+	 * @param OutPublishedTimetoken Receives timetoken of the found message, for SendText mutations
+	 * @return Operation result. Fails if the lookup couldn't be done, then it's not known if the mutation can be sent again
+	 */
+	FPubnubChatOperationResult FindAppliedEntry(const FPubnubChatInternalOutboxEntry& Entry, bool& OutApplied, FString& OutPublishedTimetoken);
+	/** Updates repository and source channel after a message was published */
+	FPubnubChatOperationResult CompleteSendText(const FPubnubChatInternalOutboxEntry& Entry, const FString& PublishedTimetoken, TWeakObjectPtr<UPubnubChatChannel> SourceChannel);
+
+	/** Removes entry and records it as finished. Has to be called with OutboxCriticalSection locked */
+	void FinishEntry(int EntryIndex);
+	/** Drops mutations older than MaxAgeSeconds. Has to be called with OutboxCriticalSection locked */
+	void DropExpiredEntries();
+	/** Has to be called with OutboxCriticalSection locked */
+	void AppendRecord(EPubnubChatOutboxRecordType Type, const FPubnubChatInternalOutboxEntry& Entry);
+	/** Rewrites the journal with only queued mutations. Has to be called with OutboxCriticalSection locked */
+	void CompactJournal();
+	/** Marks locally echoed message of dropped mutation as failed */
+	static void FailLocalEcho(const FString& EntryID, TWeakObjectPtr<UPubnubChatChannel> SourceChannel);
+};
@@ -0,0 +1,11 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatPersistentStore.h"
+#include "PubnubChatConst.h"
+#include "Misc/Paths.h"
+
+
+FString UPubnubChatPersistentStore::GetStoreDirectory(const FString& UserID)
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), Pubnub_Chat_Persistent_Store_Directory, FPaths::MakeValidFileName(UserID));
+}
@@ -0,0 +1,61 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "StructLibraries/PubnubChatInternalStructLibrary.h"
+#include "PubnubChatPersistentStore.generated.h"
+
+/**
+ * Persistence layer of UPubnubChatObjectsRepository. Keeps users, channels and messages between chat sessions.
+ * Repository writes every data update through to the store and reads it back only for cached data requests,
+ * so the store never changes what the repository holds in memory.
+ * Base class stores nothing - subclasses provide the actual storage (see UPubnubChatFilePersistentStore).
+ * All functions can be called from any thread.
+ *
+ * This is an internal class and should not be used directly. Configure it with FPubnubChatConfig::PersistentStore.
+ */
+UCLASS(Abstract)
+class PUBNUBCHATSDK_API UPubnubChatPersistentStore : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Opens the store kept in given directory, creating it if needed.
+	 * @param StoreDirectory Directory used only by this store
+	 * @param MaxSizeBytes Size after which least recently used data is dropped
+	 * @return False if the store can't be used
+	 */
+	virtual bool OpenStore(const FString& StoreDirectory, int64 MaxSizeBytes) { return false; }
+
+	/** Writes all pending data and closes the store. */
+	virtual void CloseStore() {}
+
+	virtual void StoreUser(const FPubnubChatInternalUser& User) {}
+	virtual bool LoadUser(const FString& UserID, FPubnubChatInternalUser& OutUser) { return false; }
+	virtual void RemoveUser(const FString& UserID) {}
+
+	virtual void StoreChannel(const FPubnubChatInternalChannel& Channel) {}
+	virtual bool LoadChannel(const FString& ChannelID, FPubnubChatInternalChannel& OutChannel) { return false; }
+	virtual void RemoveChannel(const FString& ChannelID) {}
+
+	virtual void StoreMessages(const TArray<FPubnubChatInternalMessage>& Messages) {}
+	virtual void RemoveMessage(const FString& MessageID) {}
+
+	/**
+	 * Loads the newest stored messages of the channel within timetoken range, both ends inclusive.
+	 * @param OutMessages Receives up to Count messages, oldest first - the same order as history fetched from the server
+	 */
+	virtual void LoadMessages(const FString& ChannelID, int64 StartTimetoken, int64 EndTimetoken, int Count, TArray<FPubnubChatInternalMessage>& OutMessages) {}
+
+	/**
+	 * Removes stored messages of the channel within timetoken range (both ends inclusive) that the server didn't return for this range.
+	 * @param ServerTimetokens Timetokens of all messages the server has in the range
+	 */
+	virtual void ReconcileMessages(const FString& ChannelID, int64 StartTimetoken, int64 EndTimetoken, const TSet<int64>& ServerTimetokens) {}
+
+	/** Directory of the persistent store of given user in Saved/ */
+	static FString GetStoreDirectory(const FString& UserID);
+};
@@ -0,0 +1,344 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatReactionCoordinator.h"
+#include "PubnubClient.h"
+#include "PubnubChatConst.h"
+#include "PubnubChatInternalMacros.h"
+#include "PubnubChatObjectsRepository.h"
+#include "PubnubChatSubsystem.h"
+#include "FunctionLibraries/PubnubChatInternalConverters.h"
+#include "FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "FunctionLibraries/PubnubUtilities.h"
+#include "HAL/PlatformTime.h"
+#include "Threads/PubnubFunctionThread.h"
+
+
+void UPubnubChatReactionCoordinator::BeginDestroy()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	Super::BeginDestroy();
+}
+
+void UPubnubChatReactionCoordinator::InitReactionCoordinator(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString& InCurrentUserID, int InToggleDebounce)
+{
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InPubnubClient, TEXT("Can't init ReactionCoordinator, PubnubClient is invalid"));
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InChat, TEXT("Can't init ReactionCoordinator, Chat is invalid"));
+
+	PubnubClient = InPubnubClient;
+	Chat = InChat;
+	CurrentUserID = InCurrentUserID;
+	ToggleDebounceSeconds = InToggleDebounce / 1000.0;
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UPubnubChatReactionCoordinator::OnFlushTicker), Pubnub_Chat_Reaction_Flush_Check_Period / 1000.0f);
+	}
+}
+
+void UPubnubChatReactionCoordinator::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	FScopeLock Lock(&ReactionCoordinatorCriticalSection);
+	PendingReactions.Empty();
+}
+
+FPubnubChatOperationResult UPubnubChatReactionCoordinator::ToggleReaction(const FString& MessageID, const FString& ChannelID, const FString& MessageTimetoken, const FString& Reaction)
+{
+	FPubnubChatOperationResult FinalResult;
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(Chat.IsValid() && Chat->ObjectsRepository, TEXT("Can't toggle reaction, Chat is invalid"));
+
+	const FPubnubChatReactionKey ReactionKey(MessageID, Reaction);
+	RegisterToggle(MessageID, ChannelID, MessageTimetoken, Reaction, [this, &MessageID]() { return GetStoredMessageActions(MessageID); }, FPlatformTime::Seconds());
+
+	TArray<FOnPubnubChatOperationResponseNative> SettledCallbacks;
+	FPubnubChatOperationResult SettledResult;
+	bool bSettled = false;
+	{
+		FScopeLock Lock(&ReactionCoordinatorCriticalSection);
+		FPubnubChatPendingReaction* PendingReaction = PendingReactions.Find(ReactionKey);
+		if (!PendingReaction)
+		{
+			return FinalResult;
+		}
+
+		//The toggle is sent by the flush ticker after the running request, so requests of one reaction don't race
+		if (PendingReaction->bInFlight)
+		{
+			//It's not an error, but add it to the result
+			FinalResult.AddStep("ToggleReaction", FPubnubOperationResult({0, false, TEXT("Request of this reaction is in progress, toggle will be sent after it finishes.")}));
+			return FinalResult;
+		}
+
+		//Toggle cancelled a collected async toggle - nothing to send
+		if (PendingReaction->bDesiredHasReaction == PendingReaction->ServerHasReaction())
+		{
+			SettledCallbacks = SettleReaction(ReactionKey, SettledResult);
+			bSettled = true;
+		}
+		else
+		{
+			PendingReaction->bInFlight = true;
+		}
+	}
+
+	if (bSettled)
+	{
+		CallCallbacks(SettledCallbacks, SettledResult);
+		return FinalResult;
+	}
+
+	return SendReactionChange(ReactionKey);
+}
+
+void UPubnubChatReactionCoordinator::ToggleReactionDebounced(const FString& MessageID, const FString& ChannelID, const FString& MessageTimetoken, const FString& Reaction, FOnPubnubChatOperationResponseNative Callback)
+{
+	RegisterToggle(MessageID, ChannelID, MessageTimetoken, Reaction, [this, &MessageID]() { return GetStoredMessageActions(MessageID); }, FPlatformTime::Seconds() + ToggleDebounceSeconds, Callback);
+}
+
+void UPubnubChatReactionCoordinator::ApplyPendingReactions(const FString& MessageID, TArray<FPubnubChatMessageAction>& InOutMessageActions) const
+{
+	FScopeLock Lock(&ReactionCoordinatorCriticalSection);
+	for (const TPair<FPubnubChatReactionKey, FPubnubChatPendingReaction>& Pair : PendingReactions)
+	{
+		if (Pair.Key.Key != MessageID)
+		{ continue; }
+
+		const FString& Reaction = Pair.Key.Value;
+		auto IsOwnReaction = [this, &Reaction](const FPubnubChatMessageAction& MessageAction)
+		{
+			return MessageAction.Type == EPubnubChatMessageActionType::PCMAT_Reaction && MessageAction.Value == Reaction && MessageAction.UserID == CurrentUserID;
+		};
+
+		if (!Pair.Value.bDesiredHasReaction)
+		{
+			InOutMessageActions.RemoveAll(IsOwnReaction);
+		}
+		else if (!InOutMessageActions.ContainsByPredicate(IsOwnReaction))
+		{
+			FPubnubChatMessageAction PendingAction;
+			PendingAction.Type = EPubnubChatMessageActionType::PCMAT_Reaction;
+			PendingAction.Value = Reaction;
+			PendingAction.UserID = CurrentUserID;
+			InOutMessageActions.Add(PendingAction);
+		}
+	}
+}
+
+bool UPubnubChatReactionCoordinator::RegisterToggle(const FString& MessageID, const FString& ChannelID, const FString& MessageTimetoken, const FString& Reaction, TFunctionRef<TArray<FPubnubChatMessageAction>()> GetServerMessageActions, double FlushAtSeconds, FOnPubnubChatOperationResponseNative Callback)
+{
+	const FPubnubChatReactionKey ReactionKey(MessageID, Reaction);
+
+	FScopeLock Lock(&ReactionCoordinatorCriticalSection);
+	FPubnubChatPendingReaction* PendingReaction = PendingReactions.Find(ReactionKey);
+	if (!PendingReaction)
+	{
+		PendingReaction = &PendingReactions.Add(ReactionKey);
+		PendingReaction->ChannelID = ChannelID;
+		PendingReaction->MessageTimetoken = MessageTimetoken;
+
+		TArray<FPubnubChatMessageAction> MessageReactions = UPubnubChatInternalUtilities::FilterMessageActionsOfType(GetServerMessageActions(), EPubnubChatMessageActionType::PCMAT_Reaction);
+		PendingReaction->ServerReaction = UPubnubChatInternalUtilities::GetMessageReactionForUserID(MessageReactions, Reaction, CurrentUserID);
+		PendingReaction->bDesiredHasReaction = PendingReaction->ServerHasReaction();
+	}
+
+	PendingReaction->bDesiredHasReaction = !PendingReaction->bDesiredHasReaction;
+	PendingReaction->FlushAtSeconds = FlushAtSeconds;
+	if (Callback.IsBound())
+	{
+		PendingReaction->Callbacks.Add(Callback);
+	}
+
+	return PendingReaction->bDesiredHasReaction;
+}
+
+TArray<FPubnubChatReactionKey> UPubnubChatReactionCoordinator::CollectDueReactions(double NowSeconds)
+{
+	TArray<FPubnubChatReactionKey> DueReactions;
+	TArray<TPair<TArray<FOnPubnubChatOperationResponseNative>, FPubnubChatOperationResult>> SettledReactions;
+	{
+		FScopeLock Lock(&ReactionCoordinatorCriticalSection);
+		for (auto It = PendingReactions.CreateIterator(); It; ++It)
+		{
+			FPubnubChatPendingReaction& PendingReaction = It.Value();
+			if (PendingReaction.bInFlight || PendingReaction.FlushAtSeconds > NowSeconds)
+			{ continue; }
+
+			//Even number of toggles - server already has the desired state
+			if (PendingReaction.bDesiredHasReaction == PendingReaction.ServerHasReaction())
+			{
+				SettledReactions.Emplace(MoveTemp(PendingReaction.Callbacks), MoveTemp(PendingReaction.Result));
+				It.RemoveCurrent();
+				continue;
+			}
+
+			PendingReaction.bInFlight = true;
+			DueReactions.Add(It.Key());
+		}
+	}
+
+	for (const TPair<TArray<FOnPubnubChatOperationResponseNative>, FPubnubChatOperationResult>& SettledReaction : SettledReactions)
+	{
+		CallCallbacks(SettledReaction.Key, SettledReaction.Value);
+	}
+
+	return DueReactions;
+}
+
+FPubnubChatOperationResult UPubnubChatReactionCoordinator::SendReactionChange(const FPubnubChatReactionKey& ReactionKey)
+{
+	FPubnubChatOperationResult FinalResult;
+	FString ChannelID;
+	FString MessageTimetoken;
+	FPubnubChatMessageAction ServerReaction;
+	{
+		FScopeLock Lock(&ReactionCoordinatorCriticalSection);
+		const FPubnubChatPendingReaction* PendingReaction = PendingReactions.Find(ReactionKey);
+		if (!PendingReaction)
+		{
+			return FinalResult;
+		}
+		ChannelID = PendingReaction->ChannelID;
+		MessageTimetoken = PendingReaction->MessageTimetoken;
+		ServerReaction = PendingReaction->ServerReaction;
+	}
+
+	const FString& MessageID = ReactionKey.Key;
+	const FString& Reaction = ReactionKey.Value;
+	FPubnubChatMessageAction NewServerReaction;
+
+	if (!PubnubClient || !Chat.IsValid() || !Chat->ObjectsRepository)
+	{
+		FinalResult = FPubnubChatOperationResult::CreateError(TEXT("Can't send reaction, Chat is invalid"));
+	}
+	//There is already such reaction from CurrentUser on the server, so we remove it
+	else if (!ServerReaction.Timetoken.IsEmpty())
+	{
+		FPubnubOperationResult RemoveActionResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Write, "RemoveMessageAction", FinalResult, PubnubClient->RemoveMessageAction(ChannelID, MessageTimetoken, ServerReaction.Timetoken));
+		FinalResult.AddStep("RemoveMessageAction", RemoveActionResult);
+		if (!RemoveActionResult.Error)
+		{
+			//Remove this message action from the stored message data
+			Chat->ObjectsRepository->RemoveMessageAction(MessageID, ServerReaction);
+		}
+	}
+	else
+	{
+		FString ActionType = UPubnubChatInternalConverters::ChatMessageActionTypeToString(EPubnubChatMessageActionType::PCMAT_Reaction);
+		FPubnubAddMessageActionResult AddActionResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Publish, "AddMessageAction", FinalResult, PubnubClient->AddMessageAction(ChannelID, MessageTimetoken, ActionType, Reaction));
+		FinalResult.AddStep("AddMessageAction", AddActionResult.Result);
+		if (!AddActionResult.Result.Error)
+		{
+			//Add this message action to the stored message data. Reactions of other users that arrived in the meantime are kept
+			NewServerReaction = FPubnubChatMessageAction::FromPubnubMessageActionData(AddActionResult.MessageActionData);
+			Chat->ObjectsRepository->AppendMessageAction(MessageID, NewServerReaction);
+		}
+	}
+
+	CompleteReactionChange(ReactionKey, FinalResult, NewServerReaction);
+	return FinalResult;
+}
+
+void UPubnubChatReactionCoordinator::CompleteReactionChange(const FPubnubChatReactionKey& ReactionKey, const FPubnubChatOperationResult& ChangeResult, const FPubnubChatMessageAction& NewServerReaction)
+{
+	TArray<FOnPubnubChatOperationResponseNative> SettledCallbacks;
+	FPubnubChatOperationResult SettledResult;
+	{
+		FScopeLock Lock(&ReactionCoordinatorCriticalSection);
+		FPubnubChatPendingReaction* PendingReaction = PendingReactions.Find(ReactionKey);
+		if (!PendingReaction)
+		{
+			return;
+		}
+
+		PendingReaction->bInFlight = false;
+		PendingReaction->Result.Merge(ChangeResult);
+		if (ChangeResult.Error)
+		{
+			//Roll back to the state stored on the server, toggles collected in the meantime are dropped with it
+			PendingReaction->bDesiredHasReaction = PendingReaction->ServerHasReaction();
+		}
+		else
+		{
+			PendingReaction->ServerReaction = NewServerReaction;
+		}
+
+		//Otherwise the reaction was toggled again during the request and the flush ticker sends it after its debounce time
+		if (PendingReaction->bDesiredHasReaction != PendingReaction->ServerHasReaction())
+		{
+			return;
+		}
+		SettledCallbacks = SettleReaction(ReactionKey, SettledResult);
+	}
+
+	CallCallbacks(SettledCallbacks, SettledResult);
+}
+
+int UPubnubChatReactionCoordinator::GetNumPendingReactions() const
+{
+	FScopeLock Lock(&ReactionCoordinatorCriticalSection);
+	return PendingReactions.Num();
+}
+
+bool UPubnubChatReactionCoordinator::OnFlushTicker(float DeltaTime)
+{
+	if (!Chat.IsValid() || !Chat->AsyncFunctionsThread)
+	{ return true; }
+
+	TArray<FPubnubChatReactionKey> DueReactions = CollectDueReactions(FPlatformTime::Seconds());
+	if (DueReactions.IsEmpty())
+	{ return true; }
+
+	TWeakObjectPtr<UPubnubChatReactionCoordinator> WeakThis = MakeWeakObjectPtr(this);
+	for (const FPubnubChatReactionKey& ReactionKey : DueReactions)
+	{
+		Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, ReactionKey]
+		{
+			if (!WeakThis.IsValid())
+			{ return; }
+
+			WeakThis.Get()->SendReactionChange(ReactionKey);
+		});
+	}
+
+	return true;
+}
+
+TArray<FPubnubChatMessageAction> UPubnubChatReactionCoordinator::GetStoredMessageActions(const FString& MessageID) const
+{
+	FPubnubChatMessageData MessageData;
+	if (Chat.IsValid() && Chat->ObjectsRepository)
+	{
+		Chat->ObjectsRepository->TryGetMessageData(MessageID, MessageData);
+	}
+	return MessageData.MessageActions;
+}
+
+TArray<FOnPubnubChatOperationResponseNative> UPubnubChatReactionCoordinator::SettleReaction(const FPubnubChatReactionKey& ReactionKey, FPubnubChatOperationResult& OutResult)
+{
+	TArray<FOnPubnubChatOperationResponseNative> Callbacks;
+	FPubnubChatPendingReaction PendingReaction;
+	if (PendingReactions.RemoveAndCopyValue(ReactionKey, PendingReaction))
+	{
+		Callbacks = MoveTemp(PendingReaction.Callbacks);
+		OutResult = MoveTemp(PendingReaction.Result);
+	}
+	return Callbacks;
+}
+
+void UPubnubChatReactionCoordinator::CallCallbacks(const TArray<FOnPubnubChatOperationResponseNative>& Callbacks, const FPubnubChatOperationResult& Result)
+{
+	for (const FOnPubnubChatOperationResponseNative& Callback : Callbacks)
+	{
+		UPubnubUtilities::CallPubnubDelegate(Callback, Result);
+	}
+}
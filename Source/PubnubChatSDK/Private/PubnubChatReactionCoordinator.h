@@ -0,0 +1,125 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "HAL/CriticalSection.h"
+#include "Containers/Ticker.h"
+#include "PubnubChat.h"
+#include "StructLibraries/PubnubChatStructLibrary.h"
+#include "StructLibraries/PubnubChatMessageStructLibrary.h"
+#include "PubnubChatReactionCoordinator.generated.h"
+
+class UPubnubClient;
+
+/** Message internal ID and reaction value */
+typedef TPair<FString, FString> FPubnubChatReactionKey;
+
+/**
+ * Reaction of the current user to a single message that was toggled locally and is not settled with the server yet.
+ */
+struct FPubnubChatPendingReaction
+{
+	FString ChannelID = "";
+	FString MessageTimetoken = "";
+	/** Reaction of the current user stored on the server. Empty Timetoken means the server has no such reaction */
+	FPubnubChatMessageAction ServerReaction;
+	/** State the user wants - applied to GetReactions right away */
+	bool bDesiredHasReaction = false;
+	/** FPlatformTime::Seconds after which the net change is sent */
+	double FlushAtSeconds = 0.0;
+	/** True while an add or remove request of this reaction is queued or running */
+	bool bInFlight = false;
+	/** Steps of requests sent so far, passed to callbacks */
+	FPubnubChatOperationResult Result;
+	TArray<FOnPubnubChatOperationResponseNative> Callbacks;
+
+	bool ServerHasReaction() const { return !ServerReaction.Timetoken.IsEmpty(); }
+};
+
+/**
+ * Coordinates reactions of the current user, so toggles are applied to GetReactions right away and rapid toggles
+ * of the same reaction send only the net change to the server.
+ * Async toggles are collected for the debounce time. Requests of the same (message, reaction) never run in parallel -
+ * toggles made while a request is running are sent after it finishes, based on its result.
+ * Failed request rolls the reaction back to the state stored on the server.
+ *
+ * This is an internal class and should not be used directly. Configure it with FPubnubChatConfig::ReactionToggleDebounce.
+ */
+UCLASS()
+class PUBNUBCHATSDK_API UPubnubChatReactionCoordinator : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual void BeginDestroy() override;
+
+	void InitReactionCoordinator(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString& InCurrentUserID, int InToggleDebounce);
+
+	/** Stops sending collected toggles. Toggles that were not sent yet are dropped. Game thread only. */
+	void Stop();
+
+	/**
+	 * Toggles the reaction and sends the net change right away, together with async toggles collected before.
+	 * Blocking: performs network requests on the calling thread. If a request of this reaction is already running,
+	 * returns right away and the toggle is sent after it.
+	 */
+	FPubnubChatOperationResult ToggleReaction(const FString& MessageID, const FString& ChannelID, const FString& MessageTimetoken, const FString& Reaction);
+
+	/**
+	 * Toggles the reaction locally and sends the net change after the debounce time. Can be called from any thread.
+	 * @param Callback Called when the reaction is settled with the server, with steps of all requests sent for it
+	 */
+	void ToggleReactionDebounced(const FString& MessageID, const FString& ChannelID, const FString& MessageTimetoken, const FString& Reaction, FOnPubnubChatOperationResponseNative Callback);
+
+	/** Applies reactions of the current user that are not settled yet to message actions of the message. Can be called from any thread. */
+	void ApplyPendingReactions(const FString& MessageID, TArray<FPubnubChatMessageAction>& InOutMessageActions) const;
+
+	/**
+	 * Toggles desired state of the reaction. When the reaction is not pending yet, its server state is taken from GetServerMessageActions.
+	 * GetServerMessageActions is called with the coordinator lock taken, so it can't read the state from before a concurrent request of the reaction settled.
+	 * @return Desired state of the reaction after the toggle
+	 */
+	bool RegisterToggle(const FString& MessageID, const FString& ChannelID, const FString& MessageTimetoken, const FString& Reaction, TFunctionRef<TArray<FPubnubChatMessageAction>()> GetServerMessageActions, double FlushAtSeconds, FOnPubnubChatOperationResponseNative Callback = nullptr);
+
+	/**
+	 * Returns reactions whose debounce time passed and marks them in flight. Reactions toggled back to the server state are settled without any request.
+	 */
+	TArray<FPubnubChatReactionKey> CollectDueReactions(double NowSeconds);
+
+	/**
+	 * Sends the change of the reaction marked in flight and settles it with the result.
+	 * Blocking: performs network requests on the calling thread.
+	 */
+	FPubnubChatOperationResult SendReactionChange(const FPubnubChatReactionKey& ReactionKey);
+
+	/**
+	 * Updates the reaction with the result of its request. Settles the reaction and calls its callbacks if it reached the desired state or the request failed.
+	 * @param NewServerReaction Reaction stored on the server after a successful request
+	 */
+	void CompleteReactionChange(const FPubnubChatReactionKey& ReactionKey, const FPubnubChatOperationResult& ChangeResult, const FPubnubChatMessageAction& NewServerReaction);
+
+	int GetNumPendingReactions() const;
+
+private:
+	UPROPERTY()
+	TObjectPtr<UPubnubClient> PubnubClient = nullptr;
+	TWeakObjectPtr<UPubnubChat> Chat = nullptr;
+	FString CurrentUserID = "";
+	/** Debounce time of async toggles in seconds */
+	double ToggleDebounceSeconds = 0.0;
+
+	TMap<FPubnubChatReactionKey, FPubnubChatPendingReaction> PendingReactions;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	mutable FCriticalSection ReactionCoordinatorCriticalSection;
+
+	bool OnFlushTicker(float DeltaTime);
+	/** Message actions of the message stored in the repository, empty if Chat is invalid */
+	TArray<FPubnubChatMessageAction> GetStoredMessageActions(const FString& MessageID) const;
+	/** Removes settled reaction and returns its callbacks. Has to be called with ReactionCoordinatorCriticalSection locked. */
+	TArray<FOnPubnubChatOperationResponseNative> SettleReaction(const FPubnubChatReactionKey& ReactionKey, FPubnubChatOperationResult& OutResult);
+	static void CallCallbacks(const TArray<FOnPubnubChatOperationResponseNative>& Callbacks, const FPubnubChatOperationResult& Result);
+};
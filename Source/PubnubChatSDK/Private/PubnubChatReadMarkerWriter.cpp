@@ -0,0 +1,453 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatReadMarkerWriter.h"
+#include "PubnubClient.h"
+#include "PubnubChatAccessManager.h"
+#include "PubnubChatConst.h"
+#include "PubnubChatInternalMacros.h"
+#include "PubnubChatObjectsRepository.h"
+#include "PubnubChatSubsystem.h"
+#include "FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "FunctionLibraries/PubnubUtilities.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+#include "Threads/PubnubFunctionThread.h"
+
+
+void UPubnubChatReadMarkerWriter::BeginDestroy()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	if (EnterBackgroundHandle.IsValid())
+	{
+		FCoreDelegates::ApplicationWillEnterBackgroundDelegate.Remove(EnterBackgroundHandle);
+		EnterBackgroundHandle.Reset();
+	}
+
+	Super::BeginDestroy();
+}
+
+void UPubnubChatReadMarkerWriter::InitReadMarkerWriter(UPubnubClient* InPubnubClient, UPubnubChat* InChat, int InFlushInterval)
+{
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InPubnubClient, TEXT("Can't init ReadMarkerWriter, PubnubClient is invalid"));
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InChat, TEXT("Can't init ReadMarkerWriter, Chat is invalid"));
+
+	PubnubClient = InPubnubClient;
+	Chat = InChat;
+	FlushIntervalSeconds = InFlushInterval / 1000.0;
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UPubnubChatReadMarkerWriter::OnFlushTicker), Pubnub_Chat_Read_Marker_Flush_Check_Period / 1000.0f);
+	}
+
+	if (!EnterBackgroundHandle.IsValid())
+	{
+		EnterBackgroundHandle = FCoreDelegates::ApplicationWillEnterBackgroundDelegate.AddUObject(this, &UPubnubChatReadMarkerWriter::OnApplicationWillEnterBackground);
+	}
+}
+
+void UPubnubChatReadMarkerWriter::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	if (EnterBackgroundHandle.IsValid())
+	{
+		FCoreDelegates::ApplicationWillEnterBackgroundDelegate.Remove(EnterBackgroundHandle);
+		EnterBackgroundHandle.Reset();
+	}
+
+	FScopeLock Lock(&ReadMarkerWriterCriticalSection);
+	PendingReadMarkers.Empty();
+}
+
+FPubnubChatOperationResult UPubnubChatReadMarkerWriter::WriteReadMarker(const FString& MembershipID, const FString& ChannelID, const FString& UserID, const FString& ChannelType, const FString& Timetoken)
+{
+	FPubnubChatOperationResult FinalResult;
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(Chat.IsValid() && Chat->ObjectsRepository, TEXT("Can't write read marker, Chat is invalid"));
+
+	if (!RegisterReadMarker(MembershipID, ChannelID, UserID, ChannelType, Timetoken, [this, &MembershipID]() { return GetStoredReadMarker(MembershipID); }, FPlatformTime::Seconds()))
+	{
+		//It's not an error, but add it to the result
+		FinalResult.AddStep("SetLastReadMessageTimetoken", FPubnubOperationResult({0, false, TEXT("Timetoken is not newer than the last read message timetoken, nothing to write.")}));
+		return FinalResult;
+	}
+	ApplyReadMarkerLocally(MembershipID, Timetoken);
+
+	{
+		FScopeLock Lock(&ReadMarkerWriterCriticalSection);
+		FPubnubChatPendingReadMarker* PendingReadMarker = PendingReadMarkers.Find(MembershipID);
+		if (!PendingReadMarker)
+		{
+			return FinalResult;
+		}
+
+		//The marker is written by the flush ticker after the running write, so writes of one membership don't race
+		if (PendingReadMarker->bInFlight)
+		{
+			//It's not an error, but add it to the result
+			FinalResult.AddStep("SetLastReadMessageTimetoken", FPubnubOperationResult({0, false, TEXT("Write of this membership is in progress, marker will be written after it finishes.")}));
+			return FinalResult;
+		}
+
+		PendingReadMarker->bInFlight = true;
+		PendingReadMarker->FlushAtSeconds = FPlatformTime::Seconds() + FlushIntervalSeconds;
+	}
+
+	return SendReadMarker(MembershipID);
+}
+
+void UPubnubChatReadMarkerWriter::WriteReadMarkerDebounced(const FString& MembershipID, const FString& ChannelID, const FString& UserID, const FString& ChannelType, const FString& Timetoken, FOnPubnubChatOperationResponseNative Callback)
+{
+	if (!RegisterReadMarker(MembershipID, ChannelID, UserID, ChannelType, Timetoken, [this, &MembershipID]() { return GetStoredReadMarker(MembershipID); }, FPlatformTime::Seconds() + FlushIntervalSeconds, Callback))
+	{
+		//It's not an error, but add it to the result
+		FPubnubChatOperationResult SkippedResult;
+		SkippedResult.AddStep("SetLastReadMessageTimetoken", FPubnubOperationResult({0, false, TEXT("Timetoken is not newer than the last read message timetoken, nothing to write.")}));
+		UPubnubUtilities::CallPubnubDelegate(Callback, SkippedResult);
+		return;
+	}
+	ApplyReadMarkerLocally(MembershipID, Timetoken);
+}
+
+FString UPubnubChatReadMarkerWriter::ApplyPendingReadMarker(const FString& MembershipID, const FString& StoredTimetoken) const
+{
+	FScopeLock Lock(&ReadMarkerWriterCriticalSection);
+	const FPubnubChatPendingReadMarker* PendingReadMarker = PendingReadMarkers.Find(MembershipID);
+	if (PendingReadMarker && IsNewerTimetoken(PendingReadMarker->DesiredTimetoken, StoredTimetoken))
+	{
+		return PendingReadMarker->DesiredTimetoken;
+	}
+	return StoredTimetoken;
+}
+
+void UPubnubChatReadMarkerWriter::FlushChannel(const FString& ChannelID)
+{
+	{
+		FScopeLock Lock(&ReadMarkerWriterCriticalSection);
+		for (TPair<FString, FPubnubChatPendingReadMarker>& Pair : PendingReadMarkers)
+		{
+			if (Pair.Value.ChannelID == ChannelID)
+			{
+				Pair.Value.FlushAtSeconds = 0.0;
+			}
+		}
+	}
+
+	QueueDueReadMarkers();
+}
+
+void UPubnubChatReadMarkerWriter::FlushAll()
+{
+	{
+		FScopeLock Lock(&ReadMarkerWriterCriticalSection);
+		for (TPair<FString, FPubnubChatPendingReadMarker>& Pair : PendingReadMarkers)
+		{
+			Pair.Value.FlushAtSeconds = 0.0;
+		}
+	}
+
+	QueueDueReadMarkers();
+}
+
+void UPubnubChatReadMarkerWriter::DiscardChannel(const FString& ChannelID, const FString& UserID)
+{
+	TArray<FOnPubnubChatOperationResponseNative> DiscardedCallbacks;
+	{
+		FScopeLock Lock(&ReadMarkerWriterCriticalSection);
+		for (auto It = PendingReadMarkers.CreateIterator(); It; ++It)
+		{
+			if (It.Value().bInFlight || It.Value().ChannelID != ChannelID || It.Value().UserID != UserID)
+			{ continue; }
+
+			DiscardedCallbacks.Append(MoveTemp(It.Value().Callbacks));
+			It.RemoveCurrent();
+		}
+	}
+
+	//It's not an error, but add it to the result
+	FPubnubChatOperationResult DiscardedResult;
+	DiscardedResult.AddStep("SetLastReadMessageTimetoken", FPubnubOperationResult({0, false, TEXT("Channel was left before the marker was written.")}));
+	CallCallbacks(DiscardedCallbacks, DiscardedResult);
+}
+
+bool UPubnubChatReadMarkerWriter::RegisterReadMarker(const FString& MembershipID, const FString& ChannelID, const FString& UserID, const FString& ChannelType, const FString& Timetoken, TFunctionRef<FString()> GetServerTimetoken, double FlushAtSeconds, FOnPubnubChatOperationResponseNative Callback)
+{
+	FScopeLock Lock(&ReadMarkerWriterCriticalSection);
+	FPubnubChatPendingReadMarker* PendingReadMarker = PendingReadMarkers.Find(MembershipID);
+	if (!PendingReadMarker)
+	{
+		const FString ServerTimetoken = GetServerTimetoken();
+		if (!IsNewerTimetoken(Timetoken, ServerTimetoken))
+		{
+			return false;
+		}
+
+		PendingReadMarker = &PendingReadMarkers.Add(MembershipID);
+		PendingReadMarker->ChannelID = ChannelID;
+		PendingReadMarker->UserID = UserID;
+		PendingReadMarker->ChannelType = ChannelType;
+		PendingReadMarker->ServerTimetoken = ServerTimetoken;
+		PendingReadMarker->FlushAtSeconds = FlushAtSeconds;
+	}
+	else if (!IsNewerTimetoken(Timetoken, PendingReadMarker->DesiredTimetoken))
+	{
+		return false;
+	}
+	else
+	{
+		//Later writes don't postpone the flush, so the marker is written while the user keeps scrolling
+		PendingReadMarker->FlushAtSeconds = FMath::Min(PendingReadMarker->FlushAtSeconds, FlushAtSeconds);
+	}
+
+	PendingReadMarker->DesiredTimetoken = Timetoken;
+	if (Callback.IsBound())
+	{
+		PendingReadMarker->Callbacks.Add(Callback);
+	}
+
+	return true;
+}
+
+TArray<FString> UPubnubChatReadMarkerWriter::CollectDueReadMarkers(double NowSeconds)
+{
+	TArray<FString> DueReadMarkers;
+
+	FScopeLock Lock(&ReadMarkerWriterCriticalSection);
+	for (TPair<FString, FPubnubChatPendingReadMarker>& Pair : PendingReadMarkers)
+	{
+		FPubnubChatPendingReadMarker& PendingReadMarker = Pair.Value;
+		if (PendingReadMarker.bInFlight || PendingReadMarker.FlushAtSeconds > NowSeconds)
+		{ continue; }
+
+		PendingReadMarker.bInFlight = true;
+		PendingReadMarker.FlushAtSeconds = NowSeconds + FlushIntervalSeconds;
+		DueReadMarkers.Add(Pair.Key);
+	}
+
+	return DueReadMarkers;
+}
+
+FPubnubChatOperationResult UPubnubChatReadMarkerWriter::SendReadMarker(const FString& MembershipID)
+{
+	FPubnubChatOperationResult FinalResult;
+	FString ChannelID;
+	FString UserID;
+	FString ChannelType;
+	FString Timetoken;
+	FString ServerTimetoken;
+	{
+		FScopeLock Lock(&ReadMarkerWriterCriticalSection);
+		const FPubnubChatPendingReadMarker* PendingReadMarker = PendingReadMarkers.Find(MembershipID);
+		if (!PendingReadMarker)
+		{
+			return FinalResult;
+		}
+		ChannelID = PendingReadMarker->ChannelID;
+		UserID = PendingReadMarker->UserID;
+		ChannelType = PendingReadMarker->ChannelType;
+		Timetoken = PendingReadMarker->DesiredTimetoken;
+		ServerTimetoken = PendingReadMarker->ServerTimetoken;
+	}
+
+	if (!PubnubClient || !Chat.IsValid() || !Chat->ObjectsRepository)
+	{
+		FinalResult = FPubnubChatOperationResult::CreateError(TEXT("Can't write read marker, Chat is invalid"));
+		CompleteReadMarkerWrite(MembershipID, FinalResult, Timetoken);
+		return FinalResult;
+	}
+
+	//Add Timetoken to the stored MembershipData, so the update is sent with Custom fields that arrived in the meantime
+	FPubnubChatMembershipData MembershipData;
+	Chat->ObjectsRepository->MutateMembershipData(MembershipID, [&](FPubnubChatMembershipData& StoredMembershipData)
+	{
+		UPubnubChatInternalUtilities::AddLastReadMessageTimetokenToMembershipData(StoredMembershipData, Timetoken);
+		MembershipData = StoredMembershipData;
+	});
+
+	const FString Filter = UPubnubChatInternalUtilities::GetFilterForChannelID(ChannelID);
+	FPubnubMembershipsResult SetMembershipResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Write, "SetMemberships", FinalResult, PubnubClient->SetMemberships(UserID, {FPubnubChatUpdateMembershipInputData::FromChatMembershipData(MembershipData).ToPubnubMembershipInputData(ChannelID)}, FPubnubMembershipInclude::FromValue(true), 1, Filter));
+	FinalResult.AddStep("SetMemberships", SetMembershipResult.Result);
+	if (SetMembershipResult.Result.Error)
+	{
+		CompleteReadMarkerWrite(MembershipID, FinalResult, Timetoken);
+		RollBackReadMarkerLocally(MembershipID, ServerTimetoken);
+		return FinalResult;
+	}
+
+	if (!SetMembershipResult.MembershipsData.IsEmpty())
+	{
+		Chat->ObjectsRepository->UpdateMembershipData(MembershipID, FPubnubChatMembershipData::FromPubnubMembershipData(SetMembershipResult.MembershipsData[0]), SetMembershipResult.MembershipsData[0].Updated);
+		//Server data doesn't contain markers set during the write
+		ApplyReadMarkerLocally(MembershipID, ApplyPendingReadMarker(MembershipID, Timetoken));
+	}
+
+	//Send Receipt event if it specified for this channel type in config. Permissions are checked once per write, not per marked message
+	if (UPubnubChatInternalUtilities::CanEmitReceiptEvent(ChannelType, Chat->ChatConfig))
+	{
+		FPubnubChatOperationResult EmitEventResult;
+		if (Chat->AccessManager->CanI(EPubnubChatAccessManagerPermission::PCAMP_Write, EPubnubChatAccessManagerResourceType::PCAMRT_Channels, ChannelID))
+		{
+			EmitEventResult = Chat->EmitChatEvent(EPubnubChatEventType::PCET_Receipt, ChannelID, UPubnubChatInternalUtilities::GetReceiptEventPayload(Timetoken));
+		}
+		else
+		{
+			//It's not an error, but add it to the result
+			EmitEventResult.AddStep("EmitChatEvent", FPubnubOperationResult({0, false, TEXT("Can't emit chat event, user doesn't have permissions")}));
+		}
+
+		FinalResult.Merge(EmitEventResult);
+	}
+
+	CompleteReadMarkerWrite(MembershipID, FinalResult, Timetoken);
+	return FinalResult;
+}
+
+void UPubnubChatReadMarkerWriter::CompleteReadMarkerWrite(const FString& MembershipID, const FPubnubChatOperationResult& WriteResult, const FString& WrittenTimetoken)
+{
+	TArray<FOnPubnubChatOperationResponseNative> SettledCallbacks;
+	FPubnubChatOperationResult SettledResult;
+	{
+		FScopeLock Lock(&ReadMarkerWriterCriticalSection);
+		FPubnubChatPendingReadMarker* PendingReadMarker = PendingReadMarkers.Find(MembershipID);
+		if (!PendingReadMarker)
+		{
+			return;
+		}
+
+		PendingReadMarker->bInFlight = false;
+		PendingReadMarker->Result.Merge(WriteResult);
+		if (!WriteResult.Error)
+		{
+			PendingReadMarker->ServerTimetoken = WrittenTimetoken;
+
+			//Otherwise the marker advanced during the write and the flush ticker writes it after the flush interval
+			if (IsNewerTimetoken(PendingReadMarker->DesiredTimetoken, PendingReadMarker->ServerTimetoken))
+			{
+				return;
+			}
+		}
+		SettledCallbacks = SettleReadMarker(MembershipID, SettledResult);
+	}
+
+	CallCallbacks(SettledCallbacks, SettledResult);
+}
+
+int UPubnubChatReadMarkerWriter::GetNumPendingReadMarkers() const
+{
+	FScopeLock Lock(&ReadMarkerWriterCriticalSection);
+	return PendingReadMarkers.Num();
+}
+
+bool UPubnubChatReadMarkerWriter::IsNewerTimetoken(const FString& Timetoken, const FString& CurrentTimetoken)
+{
+	if (CurrentTimetoken.IsEmpty())
+	{
+		return !Timetoken.IsEmpty();
+	}
+	return UPubnubChatInternalUtilities::TimetokenToInt64(Timetoken) > UPubnubChatInternalUtilities::TimetokenToInt64(CurrentTimetoken);
+}
+
+bool UPubnubChatReadMarkerWriter::OnFlushTicker(float DeltaTime)
+{
+	QueueDueReadMarkers();
+	return true;
+}
+
+void UPubnubChatReadMarkerWriter::OnApplicationWillEnterBackground()
+{
+	FlushAll();
+}
+
+void UPubnubChatReadMarkerWriter::QueueDueReadMarkers()
+{
+	if (!Chat.IsValid() || !Chat->AsyncFunctionsThread)
+	{ return; }
+
+	TArray<FString> DueReadMarkers = CollectDueReadMarkers(FPlatformTime::Seconds());
+	if (DueReadMarkers.IsEmpty())
+	{ return; }
+
+	TWeakObjectPtr<UPubnubChatReadMarkerWriter> WeakThis = MakeWeakObjectPtr(this);
+	for (const FString& MembershipID : DueReadMarkers)
+	{
+		Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, MembershipID]
+		{
+			if (!WeakThis.IsValid())
+			{ return; }
+
+			WeakThis.Get()->SendReadMarker(MembershipID);
+		});
+	}
+}
+
+FString UPubnubChatReadMarkerWriter::GetStoredReadMarker(const FString& MembershipID) const
+{
+	FPubnubChatMembershipData MembershipData;
+	if (Chat.IsValid() && Chat->ObjectsRepository)
+	{
+		Chat->ObjectsRepository->TryGetMembershipData(MembershipID, MembershipData);
+	}
+	return UPubnubChatInternalUtilities::GetLastReadMessageTimetokenFromMembershipData(MembershipData);
+}
+
+void UPubnubChatReadMarkerWriter::ApplyReadMarkerLocally(const FString& MembershipID, const FString& Timetoken)
+{
+	if (!Chat.IsValid() || !Chat->ObjectsRepository)
+	{ return; }
+
+	Chat->ObjectsRepository->MutateMembershipData(MembershipID, [&](FPubnubChatMembershipData& StoredMembershipData)
+	{
+		//Concurrent writes of the same membership never move the marker back
+		if (IsNewerTimetoken(Timetoken, UPubnubChatInternalUtilities::GetLastReadMessageTimetokenFromMembershipData(StoredMembershipData)))
+		{
+			UPubnubChatInternalUtilities::AddLastReadMessageTimetokenToMembershipData(StoredMembershipData, Timetoken);
+		}
+	});
+}
+
+void UPubnubChatReadMarkerWriter::RollBackReadMarkerLocally(const FString& MembershipID, const FString& ServerTimetoken)
+{
+	if (!Chat.IsValid() || !Chat->ObjectsRepository)
+	{ return; }
+
+	FScopeLock Lock(&ReadMarkerWriterCriticalSection);
+
+	//Marker set again after the failure is kept
+	const FPubnubChatPendingReadMarker* PendingReadMarker = PendingReadMarkers.Find(MembershipID);
+	if (PendingReadMarker && IsNewerTimetoken(PendingReadMarker->DesiredTimetoken, ServerTimetoken))
+	{ return; }
+
+	Chat->ObjectsRepository->MutateMembershipData(MembershipID, [&](FPubnubChatMembershipData& StoredMembershipData)
+	{
+		UPubnubChatInternalUtilities::AddLastReadMessageTimetokenToMembershipData(StoredMembershipData, ServerTimetoken);
+	});
+}
+
+TArray<FOnPubnubChatOperationResponseNative> UPubnubChatReadMarkerWriter::SettleReadMarker(const FString& MembershipID, FPubnubChatOperationResult& OutResult)
+{
+	TArray<FOnPubnubChatOperationResponseNative> Callbacks;
+	FPubnubChatPendingReadMarker PendingReadMarker;
+	if (PendingReadMarkers.RemoveAndCopyValue(MembershipID, PendingReadMarker))
+	{
+		Callbacks = MoveTemp(PendingReadMarker.Callbacks);
+		OutResult = MoveTemp(PendingReadMarker.Result);
+	}
+	return Callbacks;
+}
+
+void UPubnubChatReadMarkerWriter::CallCallbacks(const TArray<FOnPubnubChatOperationResponseNative>& Callbacks, const FPubnubChatOperationResult& Result)
+{
+	for (const FOnPubnubChatOperationResponseNative& Callback : Callbacks)
+	{
+		UPubnubUtilities::CallPubnubDelegate(Callback, Result);
+	}
+}
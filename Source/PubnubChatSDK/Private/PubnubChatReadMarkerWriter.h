@@ -0,0 +1,142 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "HAL/CriticalSection.h"
+#include "Containers/Ticker.h"
+#include "PubnubChat.h"
+#include "StructLibraries/PubnubChatStructLibrary.h"
+#include "PubnubChatReadMarkerWriter.generated.h"
+
+class UPubnubClient;
+
+/**
+ * Last read message timetoken of a single membership that was set locally and is not written to the server yet.
+ */
+struct FPubnubChatPendingReadMarker
+{
+	FString ChannelID = "";
+	FString UserID = "";
+	/** Type of the channel, decides if Receipt event is emitted */
+	FString ChannelType = "";
+	/** Last read timetoken stored on the server */
+	FString ServerTimetoken = "";
+	/** Highest timetoken set so far - returned by GetLastReadMessageTimetoken right away */
+	FString DesiredTimetoken = "";
+	/** FPlatformTime::Seconds after which the marker is written */
+	double FlushAtSeconds = 0.0;
+	/** True while a write of this marker is queued or running */
+	bool bInFlight = false;
+	/** Steps of writes sent so far, passed to callbacks */
+	FPubnubChatOperationResult Result;
+	TArray<FOnPubnubChatOperationResponseNative> Callbacks;
+};
+
+/**
+ * Writes last read message timetokens of memberships, so marking messages as read while scrolling doesn't send
+ * a membership update and Receipt event for every message.
+ * Only the highest timetoken of a membership is kept and timetokens that don't advance the marker are skipped.
+ * Async writes of a membership are sent at most once per flush interval, and right away when its channel is
+ * disconnected or left, or when the application goes to background. Writes of the same membership never run in parallel.
+ *
+ * This is an internal class and should not be used directly. Configure it with FPubnubChatConfig::ReadMarkerFlushInterval.
+ */
+UCLASS()
+class PUBNUBCHATSDK_API UPubnubChatReadMarkerWriter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual void BeginDestroy() override;
+
+	void InitReadMarkerWriter(UPubnubClient* InPubnubClient, UPubnubChat* InChat, int InFlushInterval);
+
+	/** Stops writing collected markers. Markers that were not written yet are dropped. Game thread only. */
+	void Stop();
+
+	/**
+	 * Sets the marker locally and writes it right away, together with async writes collected before.
+	 * Blocking: performs network requests on the calling thread. If a write of this membership is already running,
+	 * returns right away and the marker is written after it.
+	 */
+	FPubnubChatOperationResult WriteReadMarker(const FString& MembershipID, const FString& ChannelID, const FString& UserID, const FString& ChannelType, const FString& Timetoken);
+
+	/**
+	 * Sets the marker locally and writes it within the flush interval. Can be called from any thread.
+	 * @param Callback Called when the marker is written, with steps of all writes sent for it
+	 */
+	void WriteReadMarkerDebounced(const FString& MembershipID, const FString& ChannelID, const FString& UserID, const FString& ChannelType, const FString& Timetoken, FOnPubnubChatOperationResponseNative Callback);
+
+	/** Returns the newer of StoredTimetoken and the marker of the membership that is not written yet. Can be called from any thread. */
+	FString ApplyPendingReadMarker(const FString& MembershipID, const FString& StoredTimetoken) const;
+
+	/** Queues writes of markers of the channel right away, ignoring the flush interval. Can be called from any thread. */
+	void FlushChannel(const FString& ChannelID);
+
+	/** Queues writes of all markers right away, ignoring the flush interval. Can be called from any thread. */
+	void FlushAll();
+
+	/** Drops markers of the user in the channel that are not being written yet. Their callbacks are called with a skipped step. Can be called from any thread. */
+	void DiscardChannel(const FString& ChannelID, const FString& UserID);
+
+	/**
+	 * Raises the marker of the membership to Timetoken. When the membership is not pending yet, its server state is taken from GetServerTimetoken.
+	 * GetServerTimetoken is called with the writer lock taken, so it can't read the marker from before a concurrent write of the membership settled.
+	 * Markers that are already pending keep the earlier of their flush time and FlushAtSeconds.
+	 * @return False if Timetoken doesn't advance the marker, so there is nothing to write
+	 */
+	bool RegisterReadMarker(const FString& MembershipID, const FString& ChannelID, const FString& UserID, const FString& ChannelType, const FString& Timetoken, TFunctionRef<FString()> GetServerTimetoken, double FlushAtSeconds, FOnPubnubChatOperationResponseNative Callback = nullptr);
+
+	/**
+	 * Returns memberships whose flush time passed and marks them in flight. Next write of each of them is allowed after the flush interval.
+	 */
+	TArray<FString> CollectDueReadMarkers(double NowSeconds);
+
+	/**
+	 * Writes the marker of the membership marked in flight and completes it with the result.
+	 * Blocking: performs network requests on the calling thread.
+	 */
+	FPubnubChatOperationResult SendReadMarker(const FString& MembershipID);
+
+	/**
+	 * Updates the marker with the result of its write. Settles the marker and calls its callbacks if the written timetoken
+	 * is the highest one or the write failed.
+	 * @param WrittenTimetoken Timetoken that was sent by the write
+	 */
+	void CompleteReadMarkerWrite(const FString& MembershipID, const FPubnubChatOperationResult& WriteResult, const FString& WrittenTimetoken);
+
+	int GetNumPendingReadMarkers() const;
+
+	/** @return True if Timetoken is greater than CurrentTimetoken. Empty CurrentTimetoken is older than any timetoken. */
+	static bool IsNewerTimetoken(const FString& Timetoken, const FString& CurrentTimetoken);
+
+private:
+	UPROPERTY()
+	TObjectPtr<UPubnubClient> PubnubClient = nullptr;
+	TWeakObjectPtr<UPubnubChat> Chat = nullptr;
+	/** Minimal time between writes of one membership in seconds */
+	double FlushIntervalSeconds = 0.0;
+
+	TMap<FString, FPubnubChatPendingReadMarker> PendingReadMarkers;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle EnterBackgroundHandle;
+
+	mutable FCriticalSection ReadMarkerWriterCriticalSection;
+
+	bool OnFlushTicker(float DeltaTime);
+	/** Queues writes of markers that are due on the async thread */
+	void QueueDueReadMarkers();
+	void OnApplicationWillEnterBackground();
+	/** Last read timetoken of the membership data stored in the repository, empty if Chat is invalid */
+	FString GetStoredReadMarker(const FString& MembershipID) const;
+	/** Raises last read timetoken of the membership data in the repository to Timetoken */
+	void ApplyReadMarkerLocally(const FString& MembershipID, const FString& Timetoken);
+	/** Sets last read timetoken of the membership data in the repository back to ServerTimetoken after a failed write. Takes the writer lock before the repository lock, same as RegisterReadMarker */
+	void RollBackReadMarkerLocally(const FString& MembershipID, const FString& ServerTimetoken);
+	/** Removes settled marker and returns its callbacks. Has to be called with ReadMarkerWriterCriticalSection locked. */
+	TArray<FOnPubnubChatOperationResponseNative> SettleReadMarker(const FString& MembershipID, FPubnubChatOperationResult& OutResult);
+	static void CallCallbacks(const TArray<FOnPubnubChatOperationResponseNative>& Callbacks, const FPubnubChatOperationResult& Result);
+};
@@ -0,0 +1,441 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatReconnectCatchUp.h"
+#include "PubnubClient.h"
+#include "PubnubChat.h"
+#include "PubnubChatChannel.h"
+#include "PubnubChatMessage.h"
+#include "PubnubChatConst.h"
+#include "PubnubChatInternalMacros.h"
+#include "PubnubChatSubsystem.h"
+#include "FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "FunctionLibraries/PubnubChatLogUtilities.h"
+#include "Threads/PubnubFunctionThread.h"
+
+
+void UPubnubChatReconnectCatchUp::InitReconnectCatchUp(UPubnubClient* InPubnubClient, UPubnubChat* InChat)
+{
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InPubnubClient, TEXT("Can't init ReconnectCatchUp, PubnubClient is invalid"));
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InChat, TEXT("Can't init ReconnectCatchUp, Chat is invalid"));
+
+	PubnubClient = InPubnubClient;
+	Chat = InChat;
+}
+
+void UPubnubChatReconnectCatchUp::SetReplayLimits(int InReplayWindow, int InReplayMaxMessages)
+{
+	ReplayWindow = FMath::Max(InReplayWindow, 0);
+	ReplayMaxMessages = FMath::Max(InReplayMaxMessages, 0);
+}
+
+void UPubnubChatReconnectCatchUp::RegisterChannel(UPubnubChatChannel* Channel, int64 ConnectedTimetoken)
+{
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(Channel, TEXT("Can't register Channel in ReconnectCatchUp, Channel is invalid"));
+
+	FScopeLock Lock(&CatchUpCriticalSection);
+	const TWeakObjectPtr<UPubnubChatChannel> ChannelWeak = MakeWeakObjectPtr(Channel);
+	if (Entries.Contains(ChannelWeak))
+	{
+		return;
+	}
+
+	//Channel was not connected before, so anything older than the connection was never expected to be delivered
+	FPubnubChatReconnectCatchUpEntry Entry;
+	Entry.ChannelID = Channel->GetChannelID();
+	Entry.LastDeliveredTimetoken = FMath::Max<int64>(ConnectedTimetoken, 0);
+	if (bHadConnectionGap)
+	{
+		Entry.GapStartTimetoken = Entry.LastDeliveredTimetoken;
+		Entry.bRecordDelivered = true;
+	}
+	Entries.Add(ChannelWeak, MoveTemp(Entry));
+}
+
+void UPubnubChatReconnectCatchUp::UnregisterChannel(UPubnubChatChannel* Channel)
+{
+	FScopeLock Lock(&CatchUpCriticalSection);
+	Entries.Remove(MakeWeakObjectPtr(Channel));
+}
+
+void UPubnubChatReconnectCatchUp::Reset()
+{
+	FScopeLock Lock(&CatchUpCriticalSection);
+	Entries.Empty();
+	bHadConnectionGap = false;
+}
+
+bool UPubnubChatReconnectCatchUp::IsChannelRegistered(UPubnubChatChannel* Channel) const
+{
+	FScopeLock Lock(&CatchUpCriticalSection);
+	return Entries.Contains(MakeWeakObjectPtr(Channel));
+}
+
+int64 UPubnubChatReconnectCatchUp::GetLastDeliveredTimetoken(UPubnubChatChannel* Channel) const
+{
+	FScopeLock Lock(&CatchUpCriticalSection);
+	const FPubnubChatReconnectCatchUpEntry* Entry = Entries.Find(MakeWeakObjectPtr(Channel));
+	return Entry ? Entry->LastDeliveredTimetoken : 0;
+}
+
+bool UPubnubChatReconnectCatchUp::HandleMessageDelivered(UPubnubChatChannel* Channel, const FPubnubMessageData& MessageData)
+{
+	const int64 MessageTimetoken = UPubnubChatInternalUtilities::TimetokenToInt64(MessageData.Timetoken);
+
+	FScopeLock Lock(&CatchUpCriticalSection);
+	FPubnubChatReconnectCatchUpEntry* Entry = Entries.Find(MakeWeakObjectPtr(Channel));
+	if (!Entry)
+	{
+		return true;
+	}
+
+	//Subscription resumed from an older cursor can deliver messages that were already replayed
+	if (Entry->DeliveredTimetokens.Contains(MessageTimetoken))
+	{
+		return false;
+	}
+
+	if (Entry->bRecordDelivered)
+	{
+		Entry->DeliveredTimetokens.Add(MessageTimetoken);
+	}
+	Entry->LastDeliveredTimetoken = FMath::Max(Entry->LastDeliveredTimetoken, MessageTimetoken);
+
+	//Replayed messages are older, so this one waits until they are broadcast
+	if (Entry->bReplayPending)
+	{
+		Entry->DeferredMessages.Add(MessageData);
+		return false;
+	}
+	return true;
+}
+
+TArray<FPubnubMessageData> UPubnubChatReconnectCatchUp::FinishReplay(UPubnubChatChannel* Channel)
+{
+	FScopeLock Lock(&CatchUpCriticalSection);
+	FPubnubChatReconnectCatchUpEntry* Entry = Entries.Find(MakeWeakObjectPtr(Channel));
+	if (!Entry)
+	{
+		return TArray<FPubnubMessageData>();
+	}
+
+	Entry->bReplayPending = false;
+	return MoveTemp(Entry->DeferredMessages);
+}
+
+void UPubnubChatReconnectCatchUp::HandleConnectionStatusChanged(EPubnubChatConnectionStatus Status)
+{
+	//Replay window 0 means catch-up is disabled
+	if (ReplayWindow <= 0)
+	{
+		return;
+	}
+
+	if (Status != EPubnubChatConnectionStatus::PCCS_ConnectionOnline)
+	{
+		FScopeLock Lock(&CatchUpCriticalSection);
+		if (bHadConnectionGap)
+		{
+			return;
+		}
+		bHadConnectionGap = true;
+
+		//Everything delivered from now on is recorded, so catch-up won't deliver it again
+		for (TPair<TWeakObjectPtr<UPubnubChatChannel>, FPubnubChatReconnectCatchUpEntry>& Entry : Entries)
+		{
+			Entry.Value.GapStartTimetoken = Entry.Value.LastDeliveredTimetoken;
+			Entry.Value.DeliveredTimetokens.Reset();
+			Entry.Value.bRecordDelivered = true;
+		}
+		return;
+	}
+
+	bool bHasTrackedChannels = false;
+	{
+		FScopeLock Lock(&CatchUpCriticalSection);
+		if (!bHadConnectionGap)
+		{
+			return;
+		}
+		bHadConnectionGap = false;
+		bHasTrackedChannels = !Entries.IsEmpty();
+	}
+
+	if (bHasTrackedChannels)
+	{
+		RequestCatchUp();
+	}
+}
+
+TArray<FPubnubHistoryMessageData> UPubnubChatReconnectCatchUp::FilterMessagesToReplay(UPubnubChatChannel* Channel, TArray<FPubnubHistoryMessageData> Messages)
+{
+	TArray<FPubnubHistoryMessageData> MessagesToReplay;
+
+	Messages.Sort([](const FPubnubHistoryMessageData& A, const FPubnubHistoryMessageData& B)
+	{
+		return UPubnubChatInternalUtilities::TimetokenToInt64(A.Timetoken) < UPubnubChatInternalUtilities::TimetokenToInt64(B.Timetoken);
+	});
+
+	FScopeLock Lock(&CatchUpCriticalSection);
+	//Channel that didn't go through a gap has nothing to replay
+	FPubnubChatReconnectCatchUpEntry* Entry = Entries.Find(MakeWeakObjectPtr(Channel));
+	if (!Entry || !Entry->bRecordDelivered)
+	{
+		return MessagesToReplay;
+	}
+
+	MessagesToReplay.Reserve(Messages.Num());
+	for (FPubnubHistoryMessageData& Message : Messages)
+	{
+		const int64 MessageTimetoken = UPubnubChatInternalUtilities::TimetokenToInt64(Message.Timetoken);
+		if (MessageTimetoken <= Entry->GapStartTimetoken || Entry->DeliveredTimetokens.Contains(MessageTimetoken))
+		{
+			continue;
+		}
+
+		Entry->DeliveredTimetokens.Add(MessageTimetoken);
+		Entry->LastDeliveredTimetoken = FMath::Max(Entry->LastDeliveredTimetoken, MessageTimetoken);
+		MessagesToReplay.Add(MoveTemp(Message));
+	}
+
+	return MessagesToReplay;
+}
+
+int64 UPubnubChatReconnectCatchUp::GetReplayStartTimetoken(int64 LastDeliveredTimetoken, int64 CurrentTimetoken, int InReplayWindow)
+{
+	//Timetoken has 100ns resolution, so 1ms is 10000 timetoken units
+	const int64 WindowStartTimetoken = CurrentTimetoken - static_cast<int64>(InReplayWindow) * 10000;
+	return FMath::Max(LastDeliveredTimetoken, WindowStartTimetoken);
+}
+
+TMap<FString, int64> UPubnubChatReconnectCatchUp::BeginReplay(int64 CurrentTimetoken)
+{
+	//Channel objects connected to the same channel share one fetch that covers the oldest gap of them
+	TMap<FString, int64> ReplayStartPerChannelID;
+
+	FScopeLock Lock(&CatchUpCriticalSection);
+	for (TPair<TWeakObjectPtr<UPubnubChatChannel>, FPubnubChatReconnectCatchUpEntry>& Entry : Entries)
+	{
+		if (!Entry.Key.IsValid() || !Entry.Value.bRecordDelivered)
+		{ continue; }
+
+		Entry.Value.bReplayPending = true;
+
+		const int64 ReplayStartTimetoken = GetReplayStartTimetoken(Entry.Value.GapStartTimetoken, CurrentTimetoken, ReplayWindow);
+		const int64* ExistingStartTimetoken = ReplayStartPerChannelID.Find(Entry.Value.ChannelID);
+		if (!ExistingStartTimetoken || ReplayStartTimetoken < *ExistingStartTimetoken)
+		{
+			ReplayStartPerChannelID.Add(Entry.Value.ChannelID, ReplayStartTimetoken);
+		}
+	}
+
+	return ReplayStartPerChannelID;
+}
+
+FPubnubChatOperationResult UPubnubChatReconnectCatchUp::CatchUp()
+{
+	FPubnubChatOperationResult FinalResult;
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(PubnubClient && Chat.IsValid(), TEXT("ReconnectCatchUp is not initialized"));
+
+	//Gap ends at the server time, local clock can be skewed
+	int64 CurrentTimetoken = 0;
+	FPubnubChatOperationResult TimeResult = Chat->FetchServerTimetoken(CurrentTimetoken);
+	FinalResult.Merge(TimeResult);
+	if (TimeResult.Error)
+	{
+		StopRecordingDelivered();
+		return FinalResult;
+	}
+
+	const TMap<FString, int64> ReplayStartPerChannelID = BeginReplay(CurrentTimetoken);
+
+	for (const TPair<FString, int64>& ReplayStart : ReplayStartPerChannelID)
+	{
+		TArray<FPubnubHistoryMessageData> MissedMessages;
+		FPubnubChatOperationResult FetchResult = FetchMissedMessages(ReplayStart.Key, ReplayStart.Value, CurrentTimetoken, MissedMessages);
+		FinalResult.Merge(FetchResult);
+		//Failed fetch still goes through the replay, so live messages deferred for these channel objects are delivered
+		if (FetchResult.Error)
+		{
+			MissedMessages.Empty();
+		}
+
+		TSet<FString> ReplayedTimetokens;
+		for (const FPubnubHistoryMessageData& Message : MissedMessages)
+		{
+			ReplayedTimetokens.Add(Message.Timetoken);
+		}
+
+		TArray<TWeakObjectPtr<UPubnubChatChannel>> Channels;
+		{
+			FScopeLock Lock(&CatchUpCriticalSection);
+			for (const TPair<TWeakObjectPtr<UPubnubChatChannel>, FPubnubChatReconnectCatchUpEntry>& Entry : Entries)
+			{
+				if (Entry.Value.ChannelID == ReplayStart.Key)
+				{
+					Channels.Add(Entry.Key);
+				}
+			}
+		}
+
+		//Every channel object gets only messages it didn't receive live. Replay is requested even if it's empty, to deliver deferred live messages
+		for (const TWeakObjectPtr<UPubnubChatChannel>& ChannelWeak : Channels)
+		{
+			if (!ChannelWeak.IsValid())
+			{ continue; }
+
+			ChannelWeak->ReplayMissedMessages(FilterMessagesToReplay(ChannelWeak.Get(), MissedMessages));
+		}
+
+		if (FetchResult.Error)
+		{ continue; }
+
+		FPubnubChatOperationResult ActionsResult = ApplyMissedMessageActions(ReplayStart.Key, ReplayStart.Value, CurrentTimetoken, ReplayedTimetokens);
+		FinalResult.Merge(ActionsResult);
+	}
+
+	StopRecordingDelivered();
+
+	return FinalResult;
+}
+
+void UPubnubChatReconnectCatchUp::StopRecordingDelivered()
+{
+	//Live messages don't have to be recorded until the next gap, unless it already started
+	FScopeLock Lock(&CatchUpCriticalSection);
+	if (bHadConnectionGap)
+	{
+		return;
+	}
+
+	for (TPair<TWeakObjectPtr<UPubnubChatChannel>, FPubnubChatReconnectCatchUpEntry>& Entry : Entries)
+	{
+		Entry.Value.bRecordDelivered = false;
+	}
+}
+
+void UPubnubChatReconnectCatchUp::RequestCatchUp()
+{
+	if (!Chat.IsValid() || !Chat->AsyncFunctionsThread)
+	{
+		return;
+	}
+
+	TWeakObjectPtr<UPubnubChatReconnectCatchUp> WeakThis = MakeWeakObjectPtr(this);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis]
+	{
+		if(!WeakThis.IsValid())
+		{return;}
+
+		FPubnubChatOperationResult CatchUpResult = WeakThis.Get()->CatchUp();
+		if (CatchUpResult.Error)
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("Failed to replay messages missed during connection gap: %s"), *CatchUpResult.ErrorMessage);
+		}
+	});
+}
+
+FPubnubChatOperationResult UPubnubChatReconnectCatchUp::FetchMissedMessages(const FString& ChannelID, int64 StartTimetoken, int64 EndTimetoken, TArray<FPubnubHistoryMessageData>& OutMessages)
+{
+	FPubnubChatOperationResult FinalResult;
+
+	//End is inclusive, so the last delivered message itself is not fetched again
+	FPubnubFetchHistorySettings FetchHistorySettings;
+	FetchHistorySettings.End = UPubnubChatInternalUtilities::Int64ToTimetoken(StartTimetoken + 1);
+	FetchHistorySettings.IncludeUserID = true;
+	FetchHistorySettings.IncludeMessageActions = true;
+	FetchHistorySettings.IncludeMeta = true;
+	FString PageStartTimetoken = UPubnubChatInternalUtilities::Int64ToTimetoken(EndTimetoken);
+
+	while (OutMessages.Num() < ReplayMaxMessages)
+	{
+		FetchHistorySettings.Start = PageStartTimetoken;
+		FetchHistorySettings.MaxPerChannel = FMath::Min(Pubnub_Chat_Max_History_Page_With_Actions, ReplayMaxMessages - OutMessages.Num());
+		FPubnubFetchHistoryResult FetchHistoryResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Read, "FetchHistory", FinalResult, PubnubClient->FetchHistory(ChannelID, FetchHistorySettings));
+		PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, FetchHistoryResult.Result, "FetchHistory");
+
+		if (FetchHistoryResult.Messages.IsEmpty())
+		{ break; }
+
+		//Pages go from the newest messages back, so the next page starts at the oldest message of this one
+		int64 OldestTimetoken = MAX_int64;
+		for (const FPubnubHistoryMessageData& Message : FetchHistoryResult.Messages)
+		{
+			OldestTimetoken = FMath::Min(OldestTimetoken, UPubnubChatInternalUtilities::TimetokenToInt64(Message.Timetoken));
+		}
+
+		const bool bIsLastPage = FetchHistoryResult.Messages.Num() < FetchHistorySettings.MaxPerChannel;
+		OutMessages.Append(MoveTemp(FetchHistoryResult.Messages));
+		if (bIsLastPage)
+		{ break; }
+
+		PageStartTimetoken = UPubnubChatInternalUtilities::Int64ToTimetoken(OldestTimetoken);
+	}
+
+	if (OutMessages.Num() >= ReplayMaxMessages)
+	{
+		UE_LOG(PubnubChatLog, Warning, TEXT("%s: More than %d messages were missed on channel %s, only the newest ones are replayed."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__)), ReplayMaxMessages, *ChannelID);
+	}
+
+	return FinalResult;
+}
+
+FPubnubChatOperationResult UPubnubChatReconnectCatchUp::ApplyMissedMessageActions(const FString& ChannelID, int64 StartTimetoken, int64 EndTimetoken, const TSet<FString>& ReplayedTimetokens)
+{
+	FPubnubChatOperationResult FinalResult;
+
+	//Start is exclusive, so pages go from the newest actions back and the next page starts at the oldest action of this one
+	const FString GapStartTimetoken = UPubnubChatInternalUtilities::Int64ToTimetoken(StartTimetoken + 1);
+	FString PageStartTimetoken = UPubnubChatInternalUtilities::Int64ToTimetoken(EndTimetoken);
+	TArray<FPubnubMessageActionData> GapActions;
+	while (true)
+	{
+		FPubnubGetMessageActionsResult GetMessageActionsResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Read, "GetMessageActions", FinalResult, PubnubClient->GetMessageActions(ChannelID, PageStartTimetoken, GapStartTimetoken, Pubnub_Chat_Max_Message_Actions_Page));
+		PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, GetMessageActionsResult.Result, "GetMessageActions");
+
+		if (GetMessageActionsResult.MessageActions.IsEmpty())
+		{ break; }
+
+		int64 OldestTimetoken = MAX_int64;
+		for (const FPubnubMessageActionData& ActionData : GetMessageActionsResult.MessageActions)
+		{
+			OldestTimetoken = FMath::Min(OldestTimetoken, UPubnubChatInternalUtilities::TimetokenToInt64(ActionData.ActionTimetoken));
+		}
+
+		const bool bIsLastPage = GetMessageActionsResult.MessageActions.Num() < Pubnub_Chat_Max_Message_Actions_Page;
+		GapActions.Append(MoveTemp(GetMessageActionsResult.MessageActions));
+		if (bIsLastPage || OldestTimetoken <= StartTimetoken + 1)
+		{ break; }
+
+		PageStartTimetoken = UPubnubChatInternalUtilities::Int64ToTimetoken(OldestTimetoken);
+	}
+
+	//Older pages were fetched later, so actions are applied in the order they were added
+	GapActions.Sort([](const FPubnubMessageActionData& A, const FPubnubMessageActionData& B)
+	{
+		return UPubnubChatInternalUtilities::TimetokenToInt64(A.ActionTimetoken) < UPubnubChatInternalUtilities::TimetokenToInt64(B.ActionTimetoken);
+	});
+
+	//Replayed messages were fetched together with their actions
+	TArray<const FPubnubMessageActionData*> MissedActions;
+	TArray<FString> MessageIDs;
+	for (const FPubnubMessageActionData& ActionData : GapActions)
+	{
+		if (ReplayedTimetokens.Contains(ActionData.MessageTimetoken))
+		{ continue; }
+
+		MissedActions.Add(&ActionData);
+		MessageIDs.Add(FString::Printf(TEXT("%s.%s"), *ChannelID, *ActionData.MessageTimetoken));
+	}
+
+	//Only messages that still have objects can be affected, repository doesn't keep data of the others
+	const TArray<UPubnubChatMessage*> Messages = Chat->FindLiveMessageObjects(MessageIDs);
+	for (int32 i = 0; i < MissedActions.Num(); ++i)
+	{
+		if (Messages[i])
+		{
+			Messages[i]->ApplyMissedMessageAction(*MissedActions[i]);
+		}
+	}
+
+	return FinalResult;
+}
@@ -0,0 +1,142 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "HAL/CriticalSection.h"
+#include "PubnubChatEnumLibrary.h"
+#include "PubnubStructLibrary.h"
+#include "StructLibraries/PubnubChatStructLibrary.h"
+#include "PubnubChatReconnectCatchUp.generated.h"
+
+class UPubnubClient;
+class UPubnubChat;
+class UPubnubChatChannel;
+
+/**
+ * Internal delivery state of a single connected channel object. Do not use this directly.
+ */
+struct FPubnubChatReconnectCatchUpEntry
+{
+	FString ChannelID = "";
+	/** Timetoken of the newest message delivered to the channel object, live or replayed */
+	int64 LastDeliveredTimetoken = 0;
+	/** LastDeliveredTimetoken at the moment the connection gap started. Replay starts right after it */
+	int64 GapStartTimetoken = 0;
+	/** Timetokens delivered since the last gap started. Used to deliver every message only once */
+	TSet<int64> DeliveredTimetokens;
+	/** True from the start of a gap until its catch-up is finished - live messages are recorded in DeliveredTimetokens */
+	bool bRecordDelivered = false;
+	/** True from the start of catch-up until its replay is broadcast on the game thread - live messages are deferred to DeferredMessages */
+	bool bReplayPending = false;
+	/** Live messages received while the replay was pending, in arrival order */
+	TArray<FPubnubMessageData> DeferredMessages;
+};
+
+/**
+ * Replays messages missed during a connection gap to connected channels.
+ * Tracks the last delivered timetoken of every connected channel object. When connection is back after a gap,
+ * the gap is fetched with history (including message actions), deduplicated against already delivered messages
+ * and replayed in timetoken order through the regular OnMessageReceived delegates.
+ * Message actions added during the gap to messages that are already known to the repository are applied to them as well.
+ *
+ * This is an internal class and should not be used directly. Configure it with FPubnubChatConfig::ReconnectReplayWindow.
+ */
+UCLASS()
+class PUBNUBCHATSDK_API UPubnubChatReconnectCatchUp : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	void InitReconnectCatchUp(UPubnubClient* InPubnubClient, UPubnubChat* InChat);
+
+	/**
+	 * @param InReplayWindow Maximum age in milliseconds of missed messages that are replayed. 0 disables catch-up.
+	 * @param InReplayMaxMessages Maximum number of messages replayed per channel after a single gap.
+	 */
+	void SetReplayLimits(int InReplayWindow, int InReplayMaxMessages);
+
+	/** @return False if catch-up is disabled with ReplayWindow 0 */
+	bool IsEnabled() const { return ReplayWindow > 0; }
+
+	/**
+	 * Starts tracking delivered messages of given connected channel object. Messages published before ConnectedTimetoken are never replayed.
+	 * @param ConnectedTimetoken Server timetoken of the moment the channel connected. 0 if it's unknown - the whole replay window is replayed then.
+	 */
+	void RegisterChannel(UPubnubChatChannel* Channel, int64 ConnectedTimetoken);
+	/** Stops tracking given channel object. Called when the channel disconnects. */
+	void UnregisterChannel(UPubnubChatChannel* Channel);
+	/** Forgets all tracked channels. */
+	void Reset();
+
+	bool IsChannelRegistered(UPubnubChatChannel* Channel) const;
+	/** @return Timetoken of the newest message delivered to given channel object, or 0 if it's not tracked */
+	int64 GetLastDeliveredTimetoken(UPubnubChatChannel* Channel) const;
+
+	/**
+	 * Records live message delivered to given channel object. Can be called from any thread.
+	 * While a replay of the channel object is pending, the message is deferred and returned by FinishReplay, so it's not delivered before older replayed messages.
+	 * @return False if this message was already delivered (replayed) or was deferred, and should be skipped now
+	 */
+	bool HandleMessageDelivered(UPubnubChatChannel* Channel, const FPubnubMessageData& MessageData);
+
+	/**
+	 * Ends pending replay of given channel object. Called after replayed messages were broadcast on the game thread.
+	 * @return Live messages deferred during the replay, in arrival order. They were not delivered yet
+	 */
+	TArray<FPubnubMessageData> FinishReplay(UPubnubChatChannel* Channel);
+
+	/** Remembers connection gaps and requests catch-up of all tracked channels when connection is back. Game thread only. */
+	void HandleConnectionStatusChanged(EPubnubChatConnectionStatus Status);
+
+	/**
+	 * Sorts messages fetched for given channel object by timetoken and removes the ones that are older than the gap or were already delivered.
+	 * Returned messages are recorded as delivered. Returns nothing if the channel object didn't go through a gap.
+	 */
+	TArray<FPubnubHistoryMessageData> FilterMessagesToReplay(UPubnubChatChannel* Channel, TArray<FPubnubHistoryMessageData> Messages);
+
+	/**
+	 * Oldest timetoken that can be replayed for a gap that started after LastDeliveredTimetoken.
+	 * @param InReplayWindow Maximum age of replayed messages in milliseconds
+	 */
+	static int64 GetReplayStartTimetoken(int64 LastDeliveredTimetoken, int64 CurrentTimetoken, int InReplayWindow);
+
+	/**
+	 * Marks replay of every channel object that went through a gap as pending. Each of them has to get FinishReplay afterwards.
+	 * @param CurrentTimetoken Server timetoken at which the gap ended
+	 * @return Oldest timetoken to replay per ChannelID
+	 */
+	TMap<FString, int64> BeginReplay(int64 CurrentTimetoken);
+
+	/**
+	 * Fetches messages missed by all tracked channels since their gap started and replays them.
+	 * Live delivery to the caught up channel objects is deferred until their replay is broadcast.
+	 * Blocking: performs network requests on the calling thread.
+	 */
+	FPubnubChatOperationResult CatchUp();
+
+private:
+	UPROPERTY()
+	TObjectPtr<UPubnubClient> PubnubClient = nullptr;
+	TWeakObjectPtr<UPubnubChat> Chat = nullptr;
+	int ReplayWindow = 0;
+	int ReplayMaxMessages = 0;
+
+	/** Delivery state of all connected channel objects */
+	TMap<TWeakObjectPtr<UPubnubChatChannel>, FPubnubChatReconnectCatchUpEntry> Entries;
+
+	/** True if connection was lost since the last catch-up */
+	bool bHadConnectionGap = false;
+
+	mutable FCriticalSection CatchUpCriticalSection;
+
+	/** Queues CatchUp on the Chat async thread. */
+	void RequestCatchUp();
+	/** Stops recording live messages after catch-up, unless the next gap already started. */
+	void StopRecordingDelivered();
+	/** Fetches up to ReplayMaxMessages newest messages of given channel published after StartTimetoken, with their message actions. */
+	FPubnubChatOperationResult FetchMissedMessages(const FString& ChannelID, int64 StartTimetoken, int64 EndTimetoken, TArray<FPubnubHistoryMessageData>& OutMessages);
+	/** Applies message actions added during the gap to already known messages that were not replayed. Fetches all pages of actions added during the gap. */
+	FPubnubChatOperationResult ApplyMissedMessageActions(const FString& ChannelID, int64 StartTimetoken, int64 EndTimetoken, const TSet<FString>& ReplayedTimetokens);
+};
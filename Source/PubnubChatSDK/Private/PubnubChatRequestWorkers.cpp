@@ -0,0 +1,122 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatRequestWorkers.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "Threads/PubnubFunctionThread.h"
+
+
+namespace
+{
+	thread_local bool bIsRequestWorkerThread = false;
+
+	/** Tasks of one RunTasks call, shared with the workers. Workers that pick it up after all tasks were taken leave without touching Task */
+	struct FPubnubChatRequestWorkersRun
+	{
+		FCriticalSection CriticalSection;
+		int32 NumTasks = 0;
+		int32 NextTask = 0;
+		int32 NumFinishedTasks = 0;
+		const TFunctionRef<void(int32)>* Task = nullptr;
+		FEvent* FinishedEvent = nullptr;
+
+		FPubnubChatRequestWorkersRun()
+		{
+			FinishedEvent = FPlatformProcess::GetSynchEventFromPool(true);
+		}
+
+		~FPubnubChatRequestWorkersRun()
+		{
+			FPlatformProcess::ReturnSynchEventToPool(FinishedEvent);
+		}
+
+		void RunRemainingTasks()
+		{
+			for (;;)
+			{
+				int32 TaskIndex;
+				{
+					FScopeLock Lock(&CriticalSection);
+					if (NextTask >= NumTasks)
+					{ return; }
+					TaskIndex = NextTask++;
+				}
+
+				(*Task)(TaskIndex);
+
+				FScopeLock Lock(&CriticalSection);
+				if (++NumFinishedTasks == NumTasks)
+				{
+					FinishedEvent->Trigger();
+				}
+			}
+		}
+	};
+}
+
+FPubnubChatRequestWorkers::FPubnubChatRequestWorkers(int32 NumWorkers)
+{
+	for (int32 i = 0; i < NumWorkers; ++i)
+	{
+		FPubnubFunctionThread* WorkerThread = new FPubnubFunctionThread;
+		WorkerThread->AddFunctionToQueue([] { bIsRequestWorkerThread = true; });
+		WorkerThreads.Add(WorkerThread);
+	}
+}
+
+FPubnubChatRequestWorkers::~FPubnubChatRequestWorkers()
+{
+	Stop();
+}
+
+void FPubnubChatRequestWorkers::RunTasks(int32 NumTasks, TFunctionRef<void(int32 TaskIndex)> Task)
+{
+	if (NumTasks <= 0)
+	{ return; }
+
+	TSharedPtr<FPubnubChatRequestWorkersRun, ESPMode::ThreadSafe> Run = MakeShared<FPubnubChatRequestWorkersRun, ESPMode::ThreadSafe>();
+	Run->NumTasks = NumTasks;
+	Run->Task = &Task;
+
+	int32 NumQueuedWorkers = 0;
+	if (!bIsRequestWorkerThread)
+	{
+		FScopeLock Lock(&WorkerThreadsCriticalSection);
+		NumQueuedWorkers = FMath::Min(NumTasks, WorkerThreads.Num());
+		for (int32 i = 0; i < NumQueuedWorkers; ++i)
+		{
+			WorkerThreads[i]->AddFunctionToQueue([Run] { Run->RunRemainingTasks(); });
+		}
+	}
+
+	if (NumQueuedWorkers == 0)
+	{
+		Run->RunRemainingTasks();
+		return;
+	}
+
+	//Task is referenced by the workers until the last task finishes
+	Run->FinishedEvent->Wait();
+}
+
+void FPubnubChatRequestWorkers::Stop()
+{
+	TArray<FPubnubFunctionThread*> ThreadsToStop;
+	{
+		FScopeLock Lock(&WorkerThreadsCriticalSection);
+		ThreadsToStop = MoveTemp(WorkerThreads);
+		WorkerThreads.Empty();
+	}
+
+	for (FPubnubFunctionThread* WorkerThread : ThreadsToStop)
+	{
+		WorkerThread->Stop();
+		delete WorkerThread;
+	}
+}
+
+int32 FPubnubChatRequestWorkers::GetNumWorkers() const
+{
+	FScopeLock Lock(&WorkerThreadsCriticalSection);
+	return WorkerThreads.Num();
+}
@@ -0,0 +1,41 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FPubnubFunctionThread;
+
+/**
+ * Fixed set of threads that send independent blocking requests of one chat operation at the same time - invite events of a new conversation,
+ * moderation events of SetRestrictionsBulk, thread channels removed by DeleteMessages and bootstrap requests of InitChat.
+ * At most the number of workers requests of the chat run at once, and engine thread pool workers are never blocked by them.
+ * All functions are thread-safe.
+ *
+ * This is an internal class and should not be used directly. Use UPubnubChat::RunConcurrentRequests.
+ */
+class PUBNUBCHATSDK_API FPubnubChatRequestWorkers
+{
+public:
+	explicit FPubnubChatRequestWorkers(int32 NumWorkers);
+	~FPubnubChatRequestWorkers();
+
+	FPubnubChatRequestWorkers(const FPubnubChatRequestWorkers&) = delete;
+	FPubnubChatRequestWorkers& operator=(const FPubnubChatRequestWorkers&) = delete;
+
+	/**
+	 * Runs Task for every index in [0, NumTasks) on the worker threads and waits until all of them finish.
+	 * The calling thread only waits. When it's a worker thread itself, or the workers are stopped, tasks run on it one by one, so nested calls can't deadlock.
+	 * Tasks run in any order. They must not add steps to a result shared with other tasks - each task keeps its own result, merged by the caller.
+	 */
+	void RunTasks(int32 NumTasks, TFunctionRef<void(int32 TaskIndex)> Task);
+
+	/** Stops and deletes the worker threads. Has to be called when no RunTasks is waiting */
+	void Stop();
+
+	int32 GetNumWorkers() const;
+
+private:
+	TArray<FPubnubFunctionThread*> WorkerThreads;
+	mutable FCriticalSection WorkerThreadsCriticalSection;
+};
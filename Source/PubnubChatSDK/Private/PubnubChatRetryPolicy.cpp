@@ -0,0 +1,139 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatRetryPolicy.h"
+#include "PubnubChatSubsystem.h"
+
+
+FPubnubChatRetryPolicy::FPubnubChatRetryPolicy(const FPubnubChatRetryConfig& InRetryConfig)
+	: RetryConfig(InRetryConfig)
+{
+}
+
+bool FPubnubChatRetryPolicy::IsTransientError(const FPubnubOperationResult& OperationResult)
+{
+	const int Status = OperationResult.Status;
+	return Status == 408 || Status == 429 || (Status >= 500 && Status < 600) || IsTimeoutOrConnectionFailure(OperationResult);
+}
+
+bool FPubnubChatRetryPolicy::IsTimeoutOrConnectionFailure(const FPubnubOperationResult& OperationResult)
+{
+	if (!OperationResult.Error || OperationResult.Status != 0)
+	{
+		return false;
+	}
+
+	//Failures without HTTP status are only described by the transport error message. Invalid input rejected before sending doesn't match any of these
+	static const TCHAR* TransportFailureMarkers[] = {TEXT("timed out"), TEXT("timeout"), TEXT("connection"), TEXT("connect failed"), TEXT("resolution failed"), TEXT("network"), TEXT("communication error")};
+	for (const TCHAR* Marker : TransportFailureMarkers)
+	{
+		if (OperationResult.ErrorMessage.Contains(Marker, ESearchCase::IgnoreCase))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FPubnubChatRetryPolicy::CanRetry(const FPubnubOperationResult& OperationResult, EPubnubChatRetryOperationType OperationType)
+{
+	if (!IsTransientError(OperationResult))
+	{
+		return false;
+	}
+
+	//Publish that timed out or failed on the server may have been applied, repeating it could duplicate the message
+	if (OperationType == EPubnubChatRetryOperationType::PCROT_Publish)
+	{
+		return OperationResult.Status == 429;
+	}
+
+	return true;
+}
+
+float FPubnubChatRetryPolicy::GetBackoffDelaySeconds(int Attempt, float RandomFraction) const
+{
+	const int64 ExponentialDelayMs = static_cast<int64>(RetryConfig.BaseDelayMs) << FMath::Clamp(Attempt - 1, 0, 20);
+	const int64 CappedDelayMs = FMath::Min(ExponentialDelayMs, static_cast<int64>(RetryConfig.MaxDelayMs));
+
+	//Half of the delay is fixed, so retries always back off, the other half is random, so clients don't retry in sync
+	const float DelayMs = CappedDelayMs * 0.5f * (1.0f + FMath::Clamp(RandomFraction, 0.0f, 1.0f));
+	return DelayMs / 1000.0f;
+}
+
+float FPubnubChatRetryPolicy::GetDeadlineSeconds(EPubnubChatRetryOperationType OperationType) const
+{
+	switch (OperationType)
+	{
+	case EPubnubChatRetryOperationType::PCROT_Read:
+		return RetryConfig.ReadDeadlineMs / 1000.0f;
+	case EPubnubChatRetryOperationType::PCROT_Write:
+		return RetryConfig.WriteDeadlineMs / 1000.0f;
+	case EPubnubChatRetryOperationType::PCROT_Publish:
+	default:
+		return RetryConfig.PublishDeadlineMs / 1000.0f;
+	}
+}
+
+bool FPubnubChatRetryPolicy::IsCircuitBreakerEnabled() const
+{
+	return RetryConfig.CircuitBreakerEnabled && RetryConfig.CircuitBreakerFailureThreshold > 0;
+}
+
+bool FPubnubChatRetryPolicy::TryAcquire(double NowSeconds)
+{
+	FScopeLock Lock(&RetryPolicyCriticalSection);
+	switch (CircuitBreakerState)
+	{
+	case EPubnubChatCircuitBreakerState::PCCBS_Closed:
+		return true;
+	case EPubnubChatCircuitBreakerState::PCCBS_Open:
+		if (NowSeconds < OpenUntilSeconds)
+		{
+			return false;
+		}
+		CircuitBreakerState = EPubnubChatCircuitBreakerState::PCCBS_HalfOpen;
+		return true;
+	case EPubnubChatCircuitBreakerState::PCCBS_HalfOpen:
+	default:
+		//Test request is already in flight
+		return false;
+	}
+}
+
+void FPubnubChatRetryPolicy::RecordResult(bool bTransientFailure, double NowSeconds)
+{
+	if (!IsCircuitBreakerEnabled())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&RetryPolicyCriticalSection);
+	if (!bTransientFailure)
+	{
+		ConsecutiveFailures = 0;
+		CircuitBreakerState = EPubnubChatCircuitBreakerState::PCCBS_Closed;
+		return;
+	}
+
+	ConsecutiveFailures++;
+	if (CircuitBreakerState == EPubnubChatCircuitBreakerState::PCCBS_HalfOpen || ConsecutiveFailures >= RetryConfig.CircuitBreakerFailureThreshold)
+	{
+		if (CircuitBreakerState != EPubnubChatCircuitBreakerState::PCCBS_Open)
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("%d consecutive requests failed, PubNub requests will fail right away for the next %d ms."), ConsecutiveFailures, RetryConfig.CircuitBreakerCooldownMs);
+		}
+		CircuitBreakerState = EPubnubChatCircuitBreakerState::PCCBS_Open;
+		OpenUntilSeconds = NowSeconds + RetryConfig.CircuitBreakerCooldownMs / 1000.0;
+	}
+}
+
+EPubnubChatCircuitBreakerState FPubnubChatRetryPolicy::GetCircuitBreakerState() const
+{
+	FScopeLock Lock(&RetryPolicyCriticalSection);
+	return CircuitBreakerState;
+}
+
+FPubnubOperationResult FPubnubChatRetryPolicy::CreateCircuitOpenResult()
+{
+	return FPubnubOperationResult({0, true, TEXT("Request was not sent, too many requests failed recently. Circuit breaker is open, try again later.")});
+}
@@ -0,0 +1,167 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "StructLibraries/PubnubChatStructLibrary.h"
+#include "PubnubChatAsyncOperationScope.h"
+
+/** Kind of PubNub request, decides its deadline and which failures can be retried */
+enum class EPubnubChatRetryOperationType : uint8
+{
+	/** Request that doesn't change any data - history, metadata, memberships, presence, message counts */
+	PCROT_Read,
+	/** Request that can be safely repeated - setting or removing metadata, memberships, members, deleting messages */
+	PCROT_Write,
+	/** Request that creates new data when repeated - publish, signal, adding message actions. Retried only if the server didn't apply it */
+	PCROT_Publish
+};
+
+enum class EPubnubChatCircuitBreakerState : uint8
+{
+	/** Requests are sent */
+	PCCBS_Closed,
+	/** Requests fail right away until the cooldown passes */
+	PCCBS_Open,
+	/** Cooldown passed, a single request is sent to test the origin */
+	PCCBS_HalfOpen
+};
+
+/**
+ * Retry, backoff and circuit breaker policy wrapping PubNub requests made by the chat. Retries and the circuit breaker are enabled separately in FPubnubChatRetryConfig.
+ * Failures are classified as transient or fatal. Transient failures are retried with exponential backoff and jitter
+ * until the maximum attempts or the deadline of the operation type is reached. Requests made on the game thread are not retried, backoff would stall the frame.
+ * Consecutive transient failures of all requests open the circuit breaker, so requests fail fast while the origin is unhealthy.
+ * Deadlines limit retries only - a request that was already sent is not interrupted.
+ * Cancelling the async operation that makes the request stops its retries, reads of a cancelled operation are not sent at all.
+ * All functions are thread-safe.
+ *
+ * This is an internal class and should not be used directly. Configure it with FPubnubChatConfig::Retry,
+ * wrap requests with PUBNUB_CHAT_CALL_WITH_RETRY.
+ */
+class PUBNUBCHATSDK_API FPubnubChatRetryPolicy
+{
+public:
+	explicit FPubnubChatRetryPolicy(const FPubnubChatRetryConfig& InRetryConfig);
+
+	/**
+	 * Calls the request, retrying it according to the policy. Retries taken are added to OutOperationResult as non error steps.
+	 * Blocking: sleeps on the calling thread between retries. On the game thread the request is called once, only the circuit breaker applies.
+	 * @param RetryPolicy Policy to apply. When null, the request is called once
+	 * @param StepName Name of the request used in steps, e.g. "PublishMessage"
+	 * @param Call Request returning FPubnubOperationResult or a result struct with FPubnubOperationResult Result field
+	 */
+	template<typename TCallable>
+	static auto Execute(FPubnubChatRetryPolicy* RetryPolicy, EPubnubChatRetryOperationType OperationType, const FString& StepName, FPubnubChatOperationResult& OutOperationResult, TCallable&& Call) -> decltype(Call())
+	{
+		using TResult = decltype(Call());
+		//Reads have no side effects, so remaining steps of a cancelled operation can be skipped safely
+		if (OperationType == EPubnubChatRetryOperationType::PCROT_Read && FPubnubChatAsyncOperationScope::IsCurrentOperationCancelled())
+		{
+			return CreateCancelledResult<TResult>(OutOperationResult);
+		}
+		if (!RetryPolicy)
+		{
+			return Call();
+		}
+		const bool bCircuitBreakerEnabled = RetryPolicy->IsCircuitBreakerEnabled();
+		if (!RetryPolicy->RetryConfig.Enabled && !bCircuitBreakerEnabled)
+		{
+			return Call();
+		}
+
+		//Sleeping between retries would stall the frame, so blocking calls made on the game thread fail fast instead
+		const int MaxAttempts = RetryPolicy->RetryConfig.Enabled && !IsInGameThread() ? RetryPolicy->RetryConfig.MaxAttempts : 1;
+
+		const double DeadlineTime = FPlatformTime::Seconds() + RetryPolicy->GetDeadlineSeconds(OperationType);
+		for (int Attempt = 1; ; ++Attempt)
+		{
+			if (Attempt > 1 && FPubnubChatAsyncOperationScope::IsCurrentOperationCancelled())
+			{
+				return CreateCancelledResult<TResult>(OutOperationResult);
+			}
+			if (bCircuitBreakerEnabled && !RetryPolicy->TryAcquire(FPlatformTime::Seconds()))
+			{
+				TResult Result{};
+				SetOperationResult(Result, CreateCircuitOpenResult());
+				return Result;
+			}
+
+			TResult Result = Call();
+			const FPubnubOperationResult& PubnubResult = GetOperationResult(Result);
+			const bool bTransientFailure = PubnubResult.Error && IsTransientError(PubnubResult);
+			if (bCircuitBreakerEnabled)
+			{
+				RetryPolicy->RecordResult(bTransientFailure, FPlatformTime::Seconds());
+			}
+
+			if (!PubnubResult.Error || !CanRetry(PubnubResult, OperationType) || Attempt >= MaxAttempts)
+			{
+				return Result;
+			}
+
+			const float DelaySeconds = RetryPolicy->GetBackoffDelaySeconds(Attempt, FMath::FRand());
+			if (FPlatformTime::Seconds() + DelaySeconds > DeadlineTime)
+			{
+				return Result;
+			}
+
+			//It's not an error, but add it to the result
+			OutOperationResult.AddStep(StepName, FPubnubOperationResult({PubnubResult.Status, false, FString::Printf(TEXT("Attempt %d failed with status %d (%s), retrying in %.2fs"), Attempt, PubnubResult.Status, *PubnubResult.ErrorMessage, DelaySeconds)}));
+			FPlatformProcess::Sleep(DelaySeconds);
+		}
+	}
+
+	/** True for failures that may succeed when repeated - HTTP 408, 429 and 5xx, and client side timeouts and connection failures that have no status */
+	static bool IsTransientError(const FPubnubOperationResult& OperationResult);
+	/** True for failures without HTTP status where the request timed out or couldn't connect. Other failures without status (invalid input) are fatal */
+	static bool IsTimeoutOrConnectionFailure(const FPubnubOperationResult& OperationResult);
+	/** True if the failed request can be repeated. Publish type requests are repeated only when the server rejected them (HTTP 429) */
+	static bool CanRetry(const FPubnubOperationResult& OperationResult, EPubnubChatRetryOperationType OperationType);
+
+	/**
+	 * Delay before the next attempt: exponential backoff capped at MaxDelayMs, with the upper half randomized.
+	 * @param Attempt Number of the attempt that failed, starting at 1
+	 * @param RandomFraction Random value in [0, 1]
+	 */
+	float GetBackoffDelaySeconds(int Attempt, float RandomFraction) const;
+	float GetDeadlineSeconds(EPubnubChatRetryOperationType OperationType) const;
+
+	bool IsCircuitBreakerEnabled() const;
+	/** Returns false if the circuit breaker is open. When the cooldown passed, lets a single request through */
+	bool TryAcquire(double NowSeconds);
+	/** Updates the circuit breaker with the result of a request let through by TryAcquire */
+	void RecordResult(bool bTransientFailure, double NowSeconds);
+	EPubnubChatCircuitBreakerState GetCircuitBreakerState() const;
+
+private:
+	FPubnubChatRetryConfig RetryConfig;
+
+	EPubnubChatCircuitBreakerState CircuitBreakerState = EPubnubChatCircuitBreakerState::PCCBS_Closed;
+	int ConsecutiveFailures = 0;
+	double OpenUntilSeconds = 0.0;
+
+	mutable FCriticalSection RetryPolicyCriticalSection;
+
+	static FPubnubOperationResult CreateCircuitOpenResult();
+
+	template<typename TResult>
+	static TResult CreateCancelledResult(FPubnubChatOperationResult& OutOperationResult)
+	{
+		OutOperationResult.Cancelled = true;
+		TResult Result{};
+		SetOperationResult(Result, FPubnubOperationResult({0, true, TEXT("Request was not sent, the operation was cancelled.")}));
+		return Result;
+	}
+
+	static const FPubnubOperationResult& GetOperationResult(const FPubnubOperationResult& Result) { return Result; }
+	template<typename TResult>
+	static const FPubnubOperationResult& GetOperationResult(const TResult& Result) { return Result.Result; }
+
+	static void SetOperationResult(FPubnubOperationResult& Result, const FPubnubOperationResult& OperationResult) { Result = OperationResult; }
+	template<typename TResult>
+	static void SetOperationResult(TResult& Result, const FPubnubOperationResult& OperationResult) { Result.Result = OperationResult; }
+};
@@ -0,0 +1,406 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSearchIndex.h"
+#include "PubnubChatConst.h"
+#include "FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "Algo/BinarySearch.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+	/** Text of the latest edit, or the published text if the message wasn't edited */
+	FString GetCurrentMessageText(const FPubnubChatMessageData& MessageData)
+	{
+		TArray<FPubnubChatMessageAction> EditedActions;
+		for (const FPubnubChatMessageAction& Action : MessageData.MessageActions)
+		{
+			if (Action.Type == EPubnubChatMessageActionType::PCMAT_Edited)
+			{
+				EditedActions.Add(Action);
+			}
+		}
+
+		if (EditedActions.IsEmpty())
+		{
+			return MessageData.Text;
+		}
+
+		UPubnubChatInternalUtilities::SortMessageActionsByTimetoken(EditedActions);
+		return EditedActions.Last().Value;
+	}
+
+	bool IsMessageSoftDeleted(const FPubnubChatMessageData& MessageData)
+	{
+		for (const FPubnubChatMessageAction& Action : MessageData.MessageActions)
+		{
+			if (Action.Type == EPubnubChatMessageActionType::PCMAT_Deleted)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	int64 GetMessageDataMemorySize(const FPubnubChatMessageData& MessageData)
+	{
+		int64 Size = MessageData.Type.GetAllocatedSize() + MessageData.Text.GetAllocatedSize() + MessageData.ChannelID.GetAllocatedSize()
+			+ MessageData.UserID.GetAllocatedSize() + MessageData.Meta.GetAllocatedSize() + MessageData.MessageActions.GetAllocatedSize();
+		for (const FPubnubChatMessageAction& Action : MessageData.MessageActions)
+		{
+			Size += Action.Value.GetAllocatedSize() + Action.Timetoken.GetAllocatedSize() + Action.UserID.GetAllocatedSize();
+		}
+		return Size;
+	}
+
+	int64 GetTokenMemorySize(const FString& Token)
+	{
+		//Token text is kept twice - in the dictionary map and in the token array
+		return sizeof(FString) * 2 + Token.GetAllocatedSize() * 2 + sizeof(int32) * 3;
+	}
+
+	bool IsTokenLess(const FString& A, const FString& B)
+	{
+		return A.Compare(B, ESearchCase::CaseSensitive) < 0;
+	}
+}
+
+FPubnubChatSearchIndex::FPubnubChatSearchIndex(int64 InMaxMemoryBytes)
+	: MaxMemoryBytes(InMaxMemoryBytes)
+{
+}
+
+void FPubnubChatSearchIndex::IndexMessage(const FString& MessageID, const FPubnubChatMessageData& MessageData)
+{
+	int32 SeparatorIndex = INDEX_NONE;
+	if (!MessageID.FindLastChar(TEXT('.'), SeparatorIndex))
+	{
+		return;
+	}
+
+	const FString CurrentText = GetCurrentMessageText(MessageData);
+	const bool bSearchable = !CurrentText.IsEmpty() && !IsMessageSoftDeleted(MessageData);
+
+	FScopeLock Lock(&SearchIndexCriticalSection);
+
+	if (const int32* ExistingIndex = DocumentIndexByMessageID.Find(MessageID))
+	{
+		FDocument& ExistingDocument = Documents[*ExistingIndex];
+
+		//Reactions and receipts don't change the text, so postings can stay as they are
+		if (bSearchable && GetCurrentMessageText(ExistingDocument.MessageData).Equals(CurrentText, ESearchCase::CaseSensitive))
+		{
+			const int64 OldDataSize = GetMessageDataMemorySize(ExistingDocument.MessageData);
+			ExistingDocument.MessageData = MessageData;
+			const int64 NewDataSize = GetMessageDataMemorySize(ExistingDocument.MessageData);
+			ExistingDocument.MemorySize += NewDataSize - OldDataSize;
+			MemorySize += NewDataSize - OldDataSize;
+			return;
+		}
+
+		RemoveDocument(*ExistingIndex);
+	}
+
+	if (!bSearchable)
+	{
+		return;
+	}
+
+	int32 DocumentIndex;
+	if (!FreeDocumentIndices.IsEmpty())
+	{
+		DocumentIndex = FreeDocumentIndices.Pop();
+	}
+	else
+	{
+		DocumentIndex = Documents.AddDefaulted();
+	}
+
+	FDocument& Document = Documents[DocumentIndex];
+	Document.MessageID = MessageID;
+	Document.ChannelID = MessageID.Left(SeparatorIndex);
+	Document.Timetoken = MessageID.RightChop(SeparatorIndex + 1);
+	Document.TimetokenValue = UPubnubChatInternalUtilities::TimetokenToInt64(Document.Timetoken);
+	Document.MessageData = MessageData;
+	Document.bLive = true;
+
+	for (const FString& Token : Tokenize(CurrentText))
+	{
+		int32 TokenID;
+		if (const int32* ExistingTokenID = TokenIDs.Find(Token))
+		{
+			TokenID = *ExistingTokenID;
+		}
+		else if (!FreeTokenIDs.IsEmpty())
+		{
+			TokenID = FreeTokenIDs.Pop();
+			Tokens[TokenID] = Token;
+			TokenIDs.Add(Token, TokenID);
+			bSortedTokensDirty = true;
+			MemorySize += GetTokenMemorySize(Tokens[TokenID]);
+		}
+		else
+		{
+			TokenID = Tokens.Add(Token);
+			TokenIDs.Add(Token, TokenID);
+			TokenPostings.AddDefaulted();
+			bSortedTokensDirty = true;
+			MemorySize += GetTokenMemorySize(Tokens[TokenID]) + sizeof(FTokenPostings);
+		}
+
+		TokenPostings[TokenID].Postings.Add(FPosting{DocumentIndex, Document.Generation});
+		TokenPostings[TokenID].NumLive++;
+		Document.TokenIDs.Add(TokenID);
+	}
+
+	Document.MemorySize = sizeof(FDocument) + Document.MessageID.GetAllocatedSize() * 2 + Document.ChannelID.GetAllocatedSize()
+		+ Document.Timetoken.GetAllocatedSize() + GetMessageDataMemorySize(Document.MessageData)
+		+ Document.TokenIDs.GetAllocatedSize() + Document.TokenIDs.Num() * sizeof(FPosting);
+	MemorySize += Document.MemorySize;
+
+	DocumentIndexByMessageID.Add(MessageID, DocumentIndex);
+	NumLiveDocuments++;
+
+	if (MemorySize > MaxMemoryBytes)
+	{
+		EvictOldestDocuments();
+	}
+}
+
+void FPubnubChatSearchIndex::RemoveMessage(const FString& MessageID)
+{
+	FScopeLock Lock(&SearchIndexCriticalSection);
+
+	if (const int32* DocumentIndex = DocumentIndexByMessageID.Find(MessageID))
+	{
+		RemoveDocument(*DocumentIndex);
+	}
+}
+
+void FPubnubChatSearchIndex::Clear()
+{
+	FScopeLock Lock(&SearchIndexCriticalSection);
+
+	Documents.Empty();
+	FreeDocumentIndices.Empty();
+	DocumentIndexByMessageID.Empty();
+	TokenIDs.Empty();
+	Tokens.Empty();
+	TokenPostings.Empty();
+	FreeTokenIDs.Empty();
+	SortedTokenIDs.Empty();
+	bSortedTokensDirty = false;
+	MemorySize = 0;
+	NumLiveDocuments = 0;
+}
+
+void FPubnubChatSearchIndex::Search(const FString& Query, const FString& ChannelFilter, int Limit, TArray<FPubnubChatSearchIndexHit>& OutHits) const
+{
+	OutHits.Empty();
+
+	TArray<FString> QueryTokens = Tokenize(Query);
+	if (QueryTokens.IsEmpty() || Limit <= 0)
+	{
+		return;
+	}
+
+	//Longer prefixes match fewer tokens, so the intersection gets small sooner
+	QueryTokens.Sort([](const FString& A, const FString& B) { return A.Len() > B.Len(); });
+
+	FScopeLock Lock(&SearchIndexCriticalSection);
+
+	if (bSortedTokensDirty)
+	{
+		RebuildSortedTokens();
+	}
+
+	TBitArray<> Matches;
+	CollectPrefixMatches(QueryTokens[0], Matches);
+	for (int32 i = 1; i < QueryTokens.Num() && Matches.Contains(true); ++i)
+	{
+		TBitArray<> TokenMatches;
+		CollectPrefixMatches(QueryTokens[i], TokenMatches);
+		Matches.CombineWithBitwiseAND(TokenMatches, EBitwiseOperatorFlags::MinSize);
+	}
+
+	//Min-heap of the newest matching documents - its top is the oldest one that is still in the result
+	auto IsOlder = [this](int32 A, int32 B) { return Documents[A].TimetokenValue < Documents[B].TimetokenValue; };
+	TArray<int32> NewestDocuments;
+	for (TConstSetBitIterator<> It(Matches); It; ++It)
+	{
+		const int32 DocumentIndex = It.GetIndex();
+		if (!ChannelFilter.IsEmpty() && !Documents[DocumentIndex].ChannelID.Equals(ChannelFilter, ESearchCase::CaseSensitive))
+		{
+			continue;
+		}
+
+		if (NewestDocuments.Num() < Limit)
+		{
+			NewestDocuments.HeapPush(DocumentIndex, IsOlder);
+		}
+		else if (IsOlder(NewestDocuments.HeapTop(), DocumentIndex))
+		{
+			NewestDocuments.HeapPopDiscard(IsOlder);
+			NewestDocuments.HeapPush(DocumentIndex, IsOlder);
+		}
+	}
+
+	NewestDocuments.Sort([&IsOlder](int32 A, int32 B) { return IsOlder(B, A); });
+	OutHits.Reserve(NewestDocuments.Num());
+	for (int32 DocumentIndex : NewestDocuments)
+	{
+		const FDocument& Document = Documents[DocumentIndex];
+		OutHits.Add(FPubnubChatSearchIndexHit{Document.ChannelID, Document.Timetoken, Document.MessageData});
+	}
+}
+
+int FPubnubChatSearchIndex::GetNumMessages() const
+{
+	FScopeLock Lock(&SearchIndexCriticalSection);
+	return NumLiveDocuments;
+}
+
+int64 FPubnubChatSearchIndex::GetMemorySize() const
+{
+	FScopeLock Lock(&SearchIndexCriticalSection);
+	return MemorySize;
+}
+
+TArray<FString> FPubnubChatSearchIndex::Tokenize(const FString& Text)
+{
+	TArray<FString> Result;
+	FString CurrentToken;
+
+	auto FinishToken = [&Result, &CurrentToken]()
+	{
+		if (!CurrentToken.IsEmpty())
+		{
+			Result.AddUnique(CurrentToken);
+			CurrentToken.Reset();
+		}
+	};
+
+	for (const TCHAR Character : Text)
+	{
+		if (FChar::IsAlnum(Character) || Character == TEXT('_'))
+		{
+			if (CurrentToken.Len() < Pubnub_Chat_Search_Index_Max_Token_Length)
+			{
+				CurrentToken.AppendChar(FChar::ToLower(Character));
+			}
+		}
+		else
+		{
+			FinishToken();
+		}
+	}
+	FinishToken();
+
+	return Result;
+}
+
+void FPubnubChatSearchIndex::RemoveDocument(int32 DocumentIndex)
+{
+	FDocument& Document = Documents[DocumentIndex];
+	if (!Document.bLive)
+	{
+		return;
+	}
+	Document.bLive = false;
+
+	//Postings are not searched here - they are skipped by generation and compacted once most of them are stale
+	for (int32 TokenID : Document.TokenIDs)
+	{
+		FTokenPostings& Postings = TokenPostings[TokenID];
+		Postings.NumLive--;
+		Postings.NumStale++;
+		if (Postings.NumLive <= 0)
+		{
+			//Words of evicted messages would otherwise keep the dictionary growing
+			MemorySize -= GetTokenMemorySize(Tokens[TokenID]);
+			TokenIDs.Remove(Tokens[TokenID]);
+			Tokens[TokenID].Empty();
+			Postings.Postings.Empty();
+			Postings.NumStale = 0;
+			Postings.NumLive = 0;
+			FreeTokenIDs.Add(TokenID);
+			bSortedTokensDirty = true;
+		}
+		else if (Postings.NumStale * 2 > Postings.Postings.Num())
+		{
+			Postings.Postings.RemoveAll([this](const FPosting& Posting)
+			{
+				const FDocument& PostingDocument = Documents[Posting.DocumentIndex];
+				return !PostingDocument.bLive || PostingDocument.Generation != Posting.Generation;
+			});
+			Postings.NumStale = 0;
+		}
+	}
+
+	DocumentIndexByMessageID.Remove(Document.MessageID);
+	MemorySize -= Document.MemorySize;
+	NumLiveDocuments--;
+
+	const uint32 NextGeneration = Document.Generation + 1;
+	Document = FDocument();
+	Document.Generation = NextGeneration;
+	FreeDocumentIndices.Add(DocumentIndex);
+}
+
+void FPubnubChatSearchIndex::EvictOldestDocuments()
+{
+	const int64 TargetMemorySize = MaxMemoryBytes * Pubnub_Chat_Search_Index_Eviction_Target_Percent / 100;
+
+	TArray<int32> LiveDocuments;
+	LiveDocuments.Reserve(NumLiveDocuments);
+	for (int32 i = 0; i < Documents.Num(); ++i)
+	{
+		if (Documents[i].bLive)
+		{
+			LiveDocuments.Add(i);
+		}
+	}
+	LiveDocuments.Sort([this](int32 A, int32 B) { return Documents[A].TimetokenValue < Documents[B].TimetokenValue; });
+
+	for (int32 i = 0; i < LiveDocuments.Num() && MemorySize > TargetMemorySize; ++i)
+	{
+		RemoveDocument(LiveDocuments[i]);
+	}
+}
+
+void FPubnubChatSearchIndex::RebuildSortedTokens() const
+{
+	SortedTokenIDs.Reset(Tokens.Num());
+	for (int32 i = 0; i < Tokens.Num(); ++i)
+	{
+		if (!Tokens[i].IsEmpty())
+		{
+			SortedTokenIDs.Add(i);
+		}
+	}
+	SortedTokenIDs.Sort([this](int32 A, int32 B) { return IsTokenLess(Tokens[A], Tokens[B]); });
+	bSortedTokensDirty = false;
+}
+
+void FPubnubChatSearchIndex::CollectPrefixMatches(const FString& Prefix, TBitArray<>& OutMatches) const
+{
+	OutMatches.Init(false, Documents.Num());
+
+	int32 SortedIndex = Algo::LowerBoundBy(SortedTokenIDs, Prefix, [this](int32 TokenID) -> const FString& { return Tokens[TokenID]; }, IsTokenLess);
+	for (; SortedIndex < SortedTokenIDs.Num(); ++SortedIndex)
+	{
+		const int32 TokenID = SortedTokenIDs[SortedIndex];
+		if (!Tokens[TokenID].StartsWith(Prefix, ESearchCase::CaseSensitive))
+		{
+			break;
+		}
+
+		for (const FPosting& Posting : TokenPostings[TokenID].Postings)
+		{
+			const FDocument& Document = Documents[Posting.DocumentIndex];
+			if (Document.bLive && Document.Generation == Posting.Generation)
+			{
+				OutMatches[Posting.DocumentIndex] = true;
+			}
+		}
+	}
+}
@@ -0,0 +1,117 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "StructLibraries/PubnubChatMessageStructLibrary.h"
+
+/** Single message found by FPubnubChatSearchIndex::Search */
+struct FPubnubChatSearchIndexHit
+{
+	FString ChannelID;
+	FString Timetoken;
+	FPubnubChatMessageData MessageData;
+};
+
+/**
+ * In-memory inverted index of the current text of messages known to the chat.
+ * Text is split into lowercase word tokens, every token keeps a posting list of the messages that contain it.
+ * Every word of a query has to match a token by prefix, results are ordered by timetoken, newest first.
+ * Edited messages are indexed with their latest edit, soft deleted messages are removed from the index.
+ * The index keeps its own copy of message data, so messages can be found after their objects are released.
+ * When the approximate memory size exceeds the budget, the oldest messages are evicted.
+ * All functions are thread-safe.
+ *
+ * This is an internal class and should not be used directly. Configure it with FPubnubChatConfig::SearchIndex.
+ */
+class PUBNUBCHATSDK_API FPubnubChatSearchIndex
+{
+public:
+	/** @param InMaxMemoryBytes Approximate memory budget of the index */
+	explicit FPubnubChatSearchIndex(int64 InMaxMemoryBytes);
+
+	/**
+	 * Adds message to the index or replaces its indexed text.
+	 * Message that is soft deleted or has no text is removed from the index.
+	 * @param MessageID The composite unique identifier of the message in format "[ChannelID].[Timetoken]"
+	 */
+	void IndexMessage(const FString& MessageID, const FPubnubChatMessageData& MessageData);
+
+	/** @param MessageID The composite unique identifier of the message in format "[ChannelID].[Timetoken]" */
+	void RemoveMessage(const FString& MessageID);
+
+	void Clear();
+
+	/**
+	 * Finds messages that contain all words of the query, every word matched as a token prefix.
+	 * @param ChannelFilter If not empty, only messages of this channel are returned
+	 * @param Limit Maximum number of returned messages
+	 * @param OutHits Receives found messages, newest first
+	 */
+	void Search(const FString& Query, const FString& ChannelFilter, int Limit, TArray<FPubnubChatSearchIndexHit>& OutHits) const;
+
+	int GetNumMessages() const;
+	/** Approximate memory used by indexed messages, tokens and postings */
+	int64 GetMemorySize() const;
+
+	/** Splits text into unique lowercase tokens - runs of letters, digits and underscores, truncated to the max token length */
+	static TArray<FString> Tokenize(const FString& Text);
+
+private:
+	/** Indexed message. Slots of removed messages are reused, generation tells postings of the old message apart */
+	struct FDocument
+	{
+		FString MessageID;
+		FString ChannelID;
+		FString Timetoken;
+		int64 TimetokenValue = 0;
+		FPubnubChatMessageData MessageData;
+		TArray<int32> TokenIDs;
+		uint32 Generation = 0;
+		bool bLive = false;
+		int64 MemorySize = 0;
+	};
+
+	struct FPosting
+	{
+		int32 DocumentIndex = 0;
+		uint32 Generation = 0;
+	};
+
+	struct FTokenPostings
+	{
+		TArray<FPosting> Postings;
+		/** Postings of removed or reindexed messages. Skipped by search and removed when they outnumber live ones */
+		int32 NumStale = 0;
+		/** Token is removed from the dictionary when no indexed message contains it */
+		int32 NumLive = 0;
+	};
+
+	int64 MaxMemoryBytes = 0;
+	int64 MemorySize = 0;
+	int32 NumLiveDocuments = 0;
+
+	TArray<FDocument> Documents;
+	TArray<int32> FreeDocumentIndices;
+	TMap<FString, int32> DocumentIndexByMessageID;
+
+	TMap<FString, int32> TokenIDs;
+	TArray<FString> Tokens;
+	TArray<FTokenPostings> TokenPostings;
+	/** Slots of removed tokens, their text is empty until they are reused */
+	TArray<int32> FreeTokenIDs;
+
+	/** Token IDs sorted by token text, used to find all tokens with a given prefix. Rebuilt by search after new tokens were added */
+	mutable TArray<int32> SortedTokenIDs;
+	mutable bool bSortedTokensDirty = false;
+
+	mutable FCriticalSection SearchIndexCriticalSection;
+
+	/** Functions below have to be called with SearchIndexCriticalSection locked */
+	void RemoveDocument(int32 DocumentIndex);
+	void EvictOldestDocuments();
+	void RebuildSortedTokens() const;
+	/** Sets bits of all live documents that contain a token starting with the prefix */
+	void CollectPrefixMatches(const FString& Prefix, TBitArray<>& OutMatches) const;
+};
@@ -0,0 +1,23 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "HAL/LowLevelMemTracker.h"
+
+//Use "stat PubnubChat" in the console to display these
+DECLARE_STATS_GROUP(TEXT("PubnubChat"), STATGROUP_PubnubChat, STATCAT_Advanced);
+
+//Number of entries currently tracked by the Message objects pool
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Message Objects"), STAT_PubnubChatLiveMessages, STATGROUP_PubnubChat, );
+//Message objects constructed with NewObject (each of them has to be traced by GC)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Message Objects Created"), STAT_PubnubChatMessagesCreated, STATGROUP_PubnubChat, );
+//Message objects returned from the pool instead of being constructed
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Message Objects Reused"), STAT_PubnubChatMessagesReused, STATGROUP_PubnubChat, );
+
+//Run with -llm and use "stat LLM" or "stat LLMFULL" in the console to display memory allocated under these tags
+//Chat objects, their subscriptions and caches
+LLM_DECLARE_TAG(PubnubChat);
+//Data shared by chat objects, kept in the objects repository and its search index
+LLM_DECLARE_TAG(PubnubChat_Repository);
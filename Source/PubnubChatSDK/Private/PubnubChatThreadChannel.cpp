@@ -6,6 +6,7 @@
 #include "PubnubChat.h"
 #include "PubnubChatInternalMacros.h"
 #include "PubnubChatObjectsRepository.h"
+#include "PubnubChatReconnectCatchUp.h"
 #include "Entities/PubnubSubscription.h"
 #include "PubnubChatSubsystem.h"
 #include "PubnubClient.h"
@@ -14,6 +15,8 @@
 #include "FunctionLibraries/PubnubChatLogUtilities.h"
 #include "FunctionLibraries/PubnubUtilities.h"
 #include "Threads/PubnubFunctionThread.h"
+#include "Async/Async.h"
+#include "UObject/StrongObjectPtr.h"
 
 
 FPubnubChatGetThreadHistoryResult UPubnubChatThreadChannel::GetThreadHistory(const FString StartTimetoken, const FString EndTimetoken, const int Count)
@@ -30,14 +33,10 @@ FPubnubChatGetThreadHistoryResult UPubnubChatThreadChannel::GetThreadHistory(con
 	FetchHistorySettings.IncludeUserID = true;
 	FetchHistorySettings.IncludeMessageActions = true;
 	FetchHistorySettings.IncludeMeta = true;
-	FPubnubFetchHistoryResult FetchHistoryResult = PubnubClient->FetchHistory(ChannelID, FetchHistorySettings);
+	FPubnubFetchHistoryResult FetchHistoryResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Read, "FetchHistory", FinalResult.Result, PubnubClient->FetchHistory(ChannelID, FetchHistorySettings));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, FetchHistoryResult.Result, "FetchHistory");
 	
-	for (auto& MessageData : FetchHistoryResult.Messages)
-	{
-		UPubnubChatThreadMessage* ThreadMessage = Chat->CreateThreadMessageObject(MessageData.Timetoken, MessageData, ParentChannelID);
-		FinalResult.ThreadMessages.Add(ThreadMessage);
-	}
+	FinalResult.ThreadMessages = Chat->CreateThreadMessageObjects(FetchHistoryResult.Messages, ParentChannelID);
 	
 	//If we got the exact amount of messages as specified count, probably there are more events in a given range
 	FinalResult.IsMore = FetchHistoryResult.Messages.Num() == Count;
@@ -45,7 +44,7 @@ FPubnubChatGetThreadHistoryResult UPubnubChatThreadChannel::GetThreadHistory(con
 	return FinalResult;
 }
 
-void UPubnubChatThreadChannel::GetThreadHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatGetThreadHistoryResponse OnThreadHistoryResponse, const int Count)
+FPubnubChatAsyncHandle UPubnubChatThreadChannel::GetThreadHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatGetThreadHistoryResponse OnThreadHistoryResponse, const int Count, float DeadlineSeconds)
 {
 	FOnPubnubChatGetThreadHistoryResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnThreadHistoryResponse](const FPubnubChatGetThreadHistoryResult& ThreadHistoryResult)
@@ -53,23 +52,28 @@ void UPubnubChatThreadChannel::GetThreadHistoryAsync(const FString StartTimetoke
 		OnThreadHistoryResponse.ExecuteIfBound(ThreadHistoryResult);
 	});
 
-	GetThreadHistoryAsync(StartTimetoken, EndTimetoken, NativeCallback, Count);
+	return GetThreadHistoryAsync(StartTimetoken, EndTimetoken, NativeCallback, Count, DeadlineSeconds);
 }
 
-void UPubnubChatThreadChannel::GetThreadHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatGetThreadHistoryResponseNative OnThreadHistoryResponseNative, const int Count)
+FPubnubChatAsyncHandle UPubnubChatThreadChannel::GetThreadHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatGetThreadHistoryResponseNative OnThreadHistoryResponseNative, const int Count, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnThreadHistoryResponseNative, FPubnubChatGetThreadHistoryResult());
 	
 	TWeakObjectPtr<UPubnubChatThreadChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, StartTimetoken, EndTimetoken, Count, OnThreadHistoryResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, StartTimetoken, EndTimetoken, Count, OnThreadHistoryResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnThreadHistoryResponseNative);
 		
 		FPubnubChatGetThreadHistoryResult ThreadHistoryResult = WeakThis.Get()->GetThreadHistory(StartTimetoken, EndTimetoken, Count);
 		UPubnubUtilities::CallPubnubDelegate(OnThreadHistoryResponseNative, ThreadHistoryResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatThreadChannel::PinMessageToParentChannel(UPubnubChatThreadMessage* ThreadMessage)
@@ -88,7 +92,7 @@ FPubnubChatOperationResult UPubnubChatThreadChannel::PinMessageToParentChannel(U
 	return FinalResult;
 }
 
-void UPubnubChatThreadChannel::PinMessageToParentChannelAsync(UPubnubChatThreadMessage* ThreadMessage, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatThreadChannel::PinMessageToParentChannelAsync(UPubnubChatThreadMessage* ThreadMessage, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -96,23 +100,28 @@ void UPubnubChatThreadChannel::PinMessageToParentChannelAsync(UPubnubChatThreadM
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	PinMessageToParentChannelAsync(ThreadMessage, NativeCallback);
+	return PinMessageToParentChannelAsync(ThreadMessage, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatThreadChannel::PinMessageToParentChannelAsync(UPubnubChatThreadMessage* ThreadMessage, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatThreadChannel::PinMessageToParentChannelAsync(UPubnubChatThreadMessage* ThreadMessage, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatThreadChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, ThreadMessage, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, ThreadMessage, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult PinResult = WeakThis.Get()->PinMessageToParentChannel(ThreadMessage);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, PinResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatThreadChannel::UnpinMessageFromParentChannel()
@@ -129,7 +138,7 @@ FPubnubChatOperationResult UPubnubChatThreadChannel::UnpinMessageFromParentChann
 	return FinalResult;
 }
 
-void UPubnubChatThreadChannel::UnpinMessageFromParentChannelAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatThreadChannel::UnpinMessageFromParentChannelAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -137,23 +146,28 @@ void UPubnubChatThreadChannel::UnpinMessageFromParentChannelAsync(FOnPubnubChatO
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	UnpinMessageFromParentChannelAsync(NativeCallback);
+	return UnpinMessageFromParentChannelAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatThreadChannel::UnpinMessageFromParentChannelAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatThreadChannel::UnpinMessageFromParentChannelAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatThreadChannel> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult UnpinResult = WeakThis.Get()->UnpinMessageFromParentChannel();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, UnpinResult);
 	});
+
+	return AsyncHandle;
 }
 
 void UPubnubChatThreadChannel::InitThreadChannel(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString InThreadChannelID, UPubnubChatMessage* InParentMessage, bool InIsThreadConfirmed)
@@ -180,18 +194,16 @@ FPubnubChatOperationResult UPubnubChatThreadChannel::OnSendText()
 	FPubnubChatOperationResult FinalResult;
 	
 	//Set Channel Metadata for ThreadChannel using PubnubClient
-	FPubnubChannelMetadataResult SetChannelResult = PubnubClient->SetChannelMetadata(ChannelID, GetChannelData().ToPubnubChannelInputData());
+	FPubnubChannelMetadataResult SetChannelResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Write, "SetChannelMetadata", FinalResult, PubnubClient->SetChannelMetadata(ChannelID, GetChannelData().ToPubnubChannelInputData()));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, SetChannelResult.Result, "SetChannelMetadata");
 	
 	//AddMessageAction for the Parent Message, so it knows that is the Root of this ThreadChannel
 	FString ActionType = UPubnubChatInternalConverters::ChatMessageActionTypeToString(EPubnubChatMessageActionType::PCMAT_ThreadRootId);
-	FPubnubAddMessageActionResult AddMessageActionResult = PubnubClient->AddMessageAction(ParentChannelID, ParentMessage->GetMessageTimetoken(), ActionType, ChannelID);
+	FPubnubAddMessageActionResult AddMessageActionResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Publish, "AddMessageAction", FinalResult, PubnubClient->AddMessageAction(ParentChannelID, ParentMessage->GetMessageTimetoken(), ActionType, ChannelID));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, AddMessageActionResult.Result, "AddMessageAction");
 	
-	//Update MessageData with ThreadRoot MessageAction and update ObjectsRepository with that new MessageData
-	FPubnubChatMessageData MessageData = ParentMessage->GetMessageData();
-	MessageData.MessageActions.Add(FPubnubChatMessageAction::FromPubnubMessageActionData(AddMessageActionResult.MessageActionData));
-	ParentMessage->UpdateMessageData(MessageData);
+	//Add ThreadRoot MessageAction to the stored MessageData of the parent message
+	Chat->ObjectsRepository->AppendMessageAction(ParentMessage->GetInternalMessageID(), FPubnubChatMessageAction::FromPubnubMessageActionData(AddMessageActionResult.MessageActionData));
 	
 	//Now this thread is Confirmed to be on the server
 	IsThreadConfirmed = true;
@@ -215,8 +227,85 @@ void UPubnubChatThreadChannel::AddOnMessageReceivedLambdaToSubscription(TWeakObj
 
 		if(!ThisThreadChannel || !ThisThreadChannel->IsInitialized || !ThisThreadChannel->Chat || !ThisThreadChannel->IsConnected)
 		{return;}
+		
+		//Skip messages that were already replayed after a connection gap, or wait with them until the replay is broadcast
+		if(ThisThreadChannel->Chat->ReconnectCatchUp && !ThisThreadChannel->Chat->ReconnectCatchUp->HandleMessageDelivered(ThisThreadChannel, MessageData))
+		{return;}
 				
-		ThisThreadChannel->OnThreadMessageReceived.Broadcast(ThisThreadChannel->Chat->CreateThreadMessageObject(MessageData.Timetoken, MessageData, ThisThreadChannel->ParentChannelID));
-		ThisThreadChannel->OnThreadMessageReceivedNative.Broadcast(ThisThreadChannel->Chat->CreateThreadMessageObject(MessageData.Timetoken, MessageData, ThisThreadChannel->ParentChannelID));
+		ThisThreadChannel->DeliverLiveMessage(MessageData);
+	});
+}
+
+void UPubnubChatThreadChannel::DeliverLiveMessage(const FPubnubMessageData& MessageData)
+{
+	//Server echo of a locally echoed message updates the already delivered provisional message
+	if(ConsumeLocalEcho(MessageData.Metadata, MessageData.Timetoken))
+	{return;}
+	
+	//Dropped messages are skipped before their objects are created
+	bool bDroppable = true;
+	if(!AdmitReceivedMessage(MessageData, bDroppable))
+	{return;}
+	
+	DispatchMessageReceived(Chat->CreateThreadMessageObject(MessageData.Timetoken, MessageData, ParentChannelID), bDroppable);
+}
+
+UPubnubChatMessage* UPubnubChatThreadChannel::CreateLocalEchoMessageObject(const FString& ProvisionalTimetoken, const FPubnubChatMessageData& MessageData)
+{
+	return Chat->CreateThreadMessageObject(ProvisionalTimetoken, MessageData, ParentChannelID);
+}
+
+void UPubnubChatThreadChannel::ReplayMissedMessages(const TArray<FPubnubHistoryMessageData>& HistoryMessages)
+{
+	//Server echoes of locally echoed messages were already delivered as provisional messages
+	TArray<FPubnubHistoryMessageData> MessagesToReplay;
+	for (const FPubnubHistoryMessageData& HistoryMessage : HistoryMessages)
+	{
+		if (!ConsumeLocalEcho(HistoryMessage.Meta, HistoryMessage.Timetoken))
+		{
+			MessagesToReplay.Add(HistoryMessage);
+		}
+	}
+	
+	//Keep created thread messages alive until they are broadcast on the game thread
+	TArray<TStrongObjectPtr<UPubnubChatThreadMessage>> ThreadMessages;
+	for (UPubnubChatThreadMessage* ThreadMessage : Chat->CreateThreadMessageObjects(MessagesToReplay, ParentChannelID))
+	{
+		ThreadMessages.Emplace(ThreadMessage);
+	}
+	
+	TWeakObjectPtr<UPubnubChatThreadChannel> ThisThreadChannelWeak = MakeWeakObjectPtr(this);
+	AsyncTask(ENamedThreads::GameThread, [ThisThreadChannelWeak, ThreadMessages = MoveTemp(ThreadMessages)]()
+	{
+		if(!ThisThreadChannelWeak.IsValid())
+		{return;}
+		
+		UPubnubChatThreadChannel* ThisThreadChannel = ThisThreadChannelWeak.Get();
+		if(!ThisThreadChannel->IsInitialized || !ThisThreadChannel->IsConnected)
+		{return;}
+		
+		for (const TStrongObjectPtr<UPubnubChatThreadMessage>& ThreadMessage : ThreadMessages)
+		{
+			ThisThreadChannel->DispatchMessageReceived(ThreadMessage.Get());
+		}
+		
+		//Live messages received during the replay are newer, so they are delivered after it
+		if(ThisThreadChannel->Chat && ThisThreadChannel->Chat->ReconnectCatchUp)
+		{
+			for (const FPubnubMessageData& MessageData : ThisThreadChannel->Chat->ReconnectCatchUp->FinishReplay(ThisThreadChannel))
+			{
+				ThisThreadChannel->DeliverLiveMessage(MessageData);
+			}
+		}
 	});
 }
+
+void UPubnubChatThreadChannel::BroadcastMessageReceived(UPubnubChatMessage* Message)
+{
+	UPubnubChatThreadMessage* ThreadMessage = Cast<UPubnubChatThreadMessage>(Message);
+	if (!ThreadMessage)
+	{return;}
+	
+	OnThreadMessageReceived.Broadcast(ThreadMessage);
+	OnThreadMessageReceivedNative.Broadcast(ThreadMessage);
+}
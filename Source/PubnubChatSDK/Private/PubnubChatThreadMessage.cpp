@@ -5,6 +5,7 @@
 #include "PubnubChatChannel.h"
 #include "PubnubChatInternalMacros.h"
 #include "PubnubChatSubsystem.h"
+#include "FunctionLibraries/PubnubChatInternalUtilities.h"
 #include "FunctionLibraries/PubnubChatLogUtilities.h"
 #include "FunctionLibraries/PubnubUtilities.h"
 #include "Threads/PubnubFunctionThread.h"
@@ -25,7 +26,7 @@ FPubnubChatOperationResult UPubnubChatThreadMessage::PinMessageToParentChannel()
 	return FinalResult;
 }
 
-void UPubnubChatThreadMessage::PinMessageToParentChannelAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatThreadMessage::PinMessageToParentChannelAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -33,23 +34,28 @@ void UPubnubChatThreadMessage::PinMessageToParentChannelAsync(FOnPubnubChatOpera
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	PinMessageToParentChannelAsync(NativeCallback);
+	return PinMessageToParentChannelAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatThreadMessage::PinMessageToParentChannelAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatThreadMessage::PinMessageToParentChannelAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatThreadMessage> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult PinResult = WeakThis.Get()->PinMessageToParentChannel();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, PinResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatThreadMessage::UnpinMessageFromParentChannel()
@@ -65,7 +71,7 @@ FPubnubChatOperationResult UPubnubChatThreadMessage::UnpinMessageFromParentChann
 	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, PinnedMessageResult.Result);
 	
 	//Unpin message only if this message is actually pinned to the channel
-	if (PinnedMessageResult.Message && PinnedMessageResult.Message->GetMessageTimetoken() == Timetoken)
+	if (PinnedMessageResult.Message && PinnedMessageResult.Message->GetMessageTimetoken() == GetMessageTimetoken())
 	{
 		FPubnubChatOperationResult PinResult = GetChannelResult.Channel->UnpinMessage();
 		PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, PinResult);
@@ -73,7 +79,7 @@ FPubnubChatOperationResult UPubnubChatThreadMessage::UnpinMessageFromParentChann
 	return FinalResult;
 }
 
-void UPubnubChatThreadMessage::UnpinMessageFromParentChannelAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatThreadMessage::UnpinMessageFromParentChannelAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -81,30 +87,35 @@ void UPubnubChatThreadMessage::UnpinMessageFromParentChannelAsync(FOnPubnubChatO
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	UnpinMessageFromParentChannelAsync(NativeCallback);
+	return UnpinMessageFromParentChannelAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatThreadMessage::UnpinMessageFromParentChannelAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatThreadMessage::UnpinMessageFromParentChannelAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatThreadMessage> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult UnpinResult = WeakThis.Get()->UnpinMessageFromParentChannel();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, UnpinResult);
 	});
+
+	return AsyncHandle;
 }
 
-void UPubnubChatThreadMessage::InitThreadMessage(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString InChannelID, const FString InTimetoken, const FString InParentChannelID)
+void UPubnubChatThreadMessage::InitThreadMessage(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString InChannelID, const FString InTimetoken, const FString InParentChannelID, const bool RegisterInRepository)
 {
 	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(!InParentChannelID.IsEmpty(), TEXT("Can't init Thread Message, InParentChannelID is empty"));
 	
 	ParentChannelID = InParentChannelID;
 	
-	InitMessage(InPubnubClient, InChat, InChannelID, InTimetoken);
+	InitMessage(InPubnubClient, InChat, InChannelID, InTimetoken, RegisterInRepository);
 }
@@ -0,0 +1,384 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatUnreadTracker.h"
+#include "PubnubClient.h"
+#include "PubnubChat.h"
+#include "PubnubChatConst.h"
+#include "PubnubChatInternalMacros.h"
+#include "PubnubChatSubsystem.h"
+#include "Entities/PubnubChannelEntity.h"
+#include "Entities/PubnubSubscription.h"
+#include "FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "Async/Async.h"
+#include "Threads/PubnubFunctionThread.h"
+
+
+void UPubnubChatUnreadTracker::InitUnreadTracker(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString& InCurrentUserID)
+{
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InPubnubClient, TEXT("Can't init UnreadTracker, PubnubClient is invalid"));
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InChat, TEXT("Can't init UnreadTracker, Chat is invalid"));
+
+	PubnubClient = InPubnubClient;
+	Chat = InChat;
+	CurrentUserID = InCurrentUserID;
+}
+
+void UPubnubChatUnreadTracker::SeedChannel(const FString& ChannelID, const FString& LastReadTimetoken, int Count, const FString& SyncedAtTimetoken)
+{
+	FPubnubChatUnreadTrackerEntry Entry;
+	Entry.LastReadTimetoken = UPubnubChatInternalUtilities::TimetokenToInt64(LastReadTimetoken);
+	Entry.SyncedAtTimetoken = UPubnubChatInternalUtilities::TimetokenToInt64(SyncedAtTimetoken);
+	Entry.Count = Count;
+
+	{
+		FScopeLock Lock(&TrackerCriticalSection);
+		Entries.Add(ChannelID, MoveTemp(Entry));
+		//Same format as UPubnubChatMembership::GetInternalMembershipID
+		MembershipIDToChannelID.Add(FString::Printf(TEXT("%s.%s"), *ChannelID, *CurrentUserID), ChannelID);
+	}
+
+	BroadcastUnreadMessagesCountChanged(ChannelID);
+}
+
+FPubnubChatOperationResult UPubnubChatUnreadTracker::SubscribeToChannels(const TArray<FString>& ChannelIDs)
+{
+	FPubnubChatOperationResult FinalResult;
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(PubnubClient, TEXT("UnreadTracker is not initialized"));
+
+	TArray<FString> AllChannelIDs;
+	{
+		FScopeLock Lock(&TrackerCriticalSection);
+		bool bHasNewChannels = false;
+		for (const FString& ChannelID : ChannelIDs)
+		{
+			bHasNewChannels |= !SubscribedChannelIDs.Contains(ChannelID);
+		}
+		if (!bHasNewChannels)
+		{
+			return FinalResult;
+		}
+		AllChannelIDs = SubscribedChannelIDs.Array();
+		for (const FString& ChannelID : ChannelIDs)
+		{
+			AllChannelIDs.AddUnique(ChannelID);
+		}
+	}
+
+	UPubnubSubscriptionSet* NewSubscriptionSet = PubnubClient->CreateSubscriptionSet(AllChannelIDs, TArray<FString>());
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(NewSubscriptionSet, TEXT("Can't track unread messages, Failed to create SubscriptionSet"));
+
+	TWeakObjectPtr<UPubnubChatUnreadTracker> ThisWeak = MakeWeakObjectPtr(this);
+	NewSubscriptionSet->OnPubnubMessageNative.AddLambda([ThisWeak](const FPubnubMessageData& MessageData)
+	{
+		if(!ThisWeak.IsValid())
+		{return;}
+
+		if (ThisWeak.Get()->HandleMessageReceived(MessageData.Channel, MessageData.Timetoken, MessageData.Message))
+		{
+			ThisWeak.Get()->BroadcastUnreadMessagesCountChanged(MessageData.Channel);
+		}
+	});
+
+	FPubnubOperationResult SubscribeResult = NewSubscriptionSet->Subscribe();
+	FinalResult.AddStep("Subscribe", SubscribeResult);
+	if (SubscribeResult.Error)
+	{
+		ReleaseSubscriptionSet(NewSubscriptionSet);
+		return FinalResult;
+	}
+
+	//New set is subscribed before the old one is released, so no message is missed in between. Duplicates are ignored by HandleMessageReceived
+	UPubnubSubscriptionSet* OldSubscriptionSet = nullptr;
+	{
+		FScopeLock Lock(&TrackerCriticalSection);
+		OldSubscriptionSet = SubscriptionSet;
+		SubscriptionSet = NewSubscriptionSet;
+		SubscribedChannelIDs.Append(AllChannelIDs);
+	}
+	ReleaseSubscriptionSet(OldSubscriptionSet);
+
+	return FinalResult;
+}
+
+void UPubnubChatUnreadTracker::StopTracking()
+{
+	UPubnubSubscriptionSet* SubscriptionSetToRelease = nullptr;
+	{
+		FScopeLock Lock(&TrackerCriticalSection);
+		SubscriptionSetToRelease = SubscriptionSet;
+		SubscriptionSet = nullptr;
+		SubscribedChannelIDs.Empty();
+		Entries.Empty();
+		MembershipIDToChannelID.Empty();
+		bHadConnectionGap = false;
+	}
+
+	ReleaseSubscriptionSet(SubscriptionSetToRelease);
+}
+
+bool UPubnubChatUnreadTracker::IsChannelTracked(const FString& ChannelID) const
+{
+	FScopeLock Lock(&TrackerCriticalSection);
+	return Entries.Contains(ChannelID);
+}
+
+int UPubnubChatUnreadTracker::GetUnreadMessagesCount(const FString& ChannelID) const
+{
+	FScopeLock Lock(&TrackerCriticalSection);
+	const FPubnubChatUnreadTrackerEntry* Entry = Entries.Find(ChannelID);
+	return Entry ? Entry->Count : 0;
+}
+
+bool UPubnubChatUnreadTracker::HandleMessageReceived(const FString& ChannelID, const FString& Timetoken, const FString& MessageContent)
+{
+	if (UPubnubChatInternalUtilities::IsThisEventMessage(MessageContent))
+	{
+		return false;
+	}
+
+	const int64 MessageTimetoken = UPubnubChatInternalUtilities::TimetokenToInt64(Timetoken);
+
+	FScopeLock Lock(&TrackerCriticalSection);
+	FPubnubChatUnreadTrackerEntry* Entry = Entries.Find(ChannelID);
+	if (!Entry)
+	{
+		return false;
+	}
+
+	//Already read, or already included in the count taken from the server
+	if (MessageTimetoken <= Entry->LastReadTimetoken || MessageTimetoken <= Entry->SyncedAtTimetoken)
+	{
+		return false;
+	}
+
+	//The same message can be delivered again, for example after reconnecting
+	bool bAlreadyCounted = false;
+	Entry->ReceivedTimetokens.Add(MessageTimetoken, &bAlreadyCounted);
+	if (bAlreadyCounted)
+	{
+		return false;
+	}
+
+	Entry->Count++;
+	return true;
+}
+
+bool UPubnubChatUnreadTracker::HandleLastReadTimetokenChanged(const FString& ChannelID, const FString& LastReadTimetoken)
+{
+	const int64 NewLastReadTimetoken = UPubnubChatInternalUtilities::TimetokenToInt64(LastReadTimetoken);
+
+	{
+		FScopeLock Lock(&TrackerCriticalSection);
+		FPubnubChatUnreadTrackerEntry* Entry = Entries.Find(ChannelID);
+		if (!Entry || Entry->LastReadTimetoken == NewLastReadTimetoken)
+		{
+			return true;
+		}
+
+		Entry->LastReadTimetoken = NewLastReadTimetoken;
+
+		//Timetokens of messages older than the sync point are unknown, so only the server can count them
+		if (NewLastReadTimetoken < Entry->SyncedAtTimetoken)
+		{
+			return false;
+		}
+
+		//Everything up to the sync point is read now - only messages received later can still be unread
+		for (auto It = Entry->ReceivedTimetokens.CreateIterator(); It; ++It)
+		{
+			if (*It <= NewLastReadTimetoken)
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		if (Entry->Count == Entry->ReceivedTimetokens.Num())
+		{
+			return true;
+		}
+		Entry->Count = Entry->ReceivedTimetokens.Num();
+	}
+
+	BroadcastUnreadMessagesCountChanged(ChannelID);
+	return true;
+}
+
+void UPubnubChatUnreadTracker::HandleMembershipDataUpdated(const FString& MembershipID, const FPubnubChatMembershipData& MembershipData)
+{
+	FString ChannelID;
+	{
+		FScopeLock Lock(&TrackerCriticalSection);
+		const FString* ChannelIDPtr = MembershipIDToChannelID.Find(MembershipID);
+		if (!ChannelIDPtr)
+		{
+			return;
+		}
+		ChannelID = *ChannelIDPtr;
+	}
+
+	const FString LastReadTimetoken = UPubnubChatInternalUtilities::GetLastReadMessageTimetokenFromMembershipData(MembershipData);
+	if (LastReadTimetoken.IsEmpty())
+	{
+		return;
+	}
+
+	if (!HandleLastReadTimetokenChanged(ChannelID, LastReadTimetoken))
+	{
+		RequestSyncWithServer({ChannelID});
+	}
+}
+
+void UPubnubChatUnreadTracker::HandleConnectionStatusChanged(EPubnubChatConnectionStatus Status)
+{
+	bool bHasTrackedChannels = false;
+	{
+		FScopeLock Lock(&TrackerCriticalSection);
+		if (Status != EPubnubChatConnectionStatus::PCCS_ConnectionOnline)
+		{
+			bHadConnectionGap = true;
+			return;
+		}
+
+		if (!bHadConnectionGap)
+		{
+			return;
+		}
+		bHadConnectionGap = false;
+		bHasTrackedChannels = !Entries.IsEmpty();
+	}
+
+	//Messages published while offline were not received, so counts of all tracked channels may be outdated
+	if (bHasTrackedChannels)
+	{
+		RequestSyncWithServer({});
+	}
+}
+
+FPubnubChatOperationResult UPubnubChatUnreadTracker::SyncWithServer(const TArray<FString>& ChannelIDs)
+{
+	FPubnubChatOperationResult FinalResult;
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(PubnubClient, TEXT("UnreadTracker is not initialized"));
+
+	TArray<FString> Channels;
+	TArray<FString> Timetokens;
+	{
+		FScopeLock Lock(&TrackerCriticalSection);
+		for (const TPair<FString, FPubnubChatUnreadTrackerEntry>& Entry : Entries)
+		{
+			if (!ChannelIDs.IsEmpty() && !ChannelIDs.Contains(Entry.Key))
+			{ continue; }
+
+			Channels.Add(Entry.Key);
+			Timetokens.Add(Entry.Value.LastReadTimetoken > 0 ? UPubnubChatInternalUtilities::Int64ToTimetoken(Entry.Value.LastReadTimetoken) : Pubnub_Chat_Empty_Timetoken);
+		}
+	}
+
+	if (Channels.IsEmpty())
+	{
+		return FinalResult;
+	}
+
+	//Received messages are compared with this timetoken, so it has to come from the server and not from the local clock
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(Chat.IsValid(), TEXT("UnreadTracker is not initialized"));
+	int64 SyncedAtTimetoken = 0;
+	FPubnubChatOperationResult TimeResult = Chat->FetchServerTimetoken(SyncedAtTimetoken);
+	PUBNUB_CHAT_MERGE_CHAT_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, TimeResult);
+	
+	FPubnubMessageCountsMultipleResult MessageCountsResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Read, "MessageCountsMultiple", FinalResult, PubnubClient->MessageCountsMultiple(Channels, Timetokens));
+	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, MessageCountsResult.Result, "MessageCountsMultiple");
+
+	TArray<FString> ChangedChannelIDs;
+	{
+		FScopeLock Lock(&TrackerCriticalSection);
+		for (const FString& ChannelID : Channels)
+		{
+			FPubnubChatUnreadTrackerEntry* Entry = Entries.Find(ChannelID);
+			const int* ServerCountPtr = MessageCountsResult.MessageCountsPerChannel.Find(ChannelID);
+			if (!Entry || !ServerCountPtr)
+			{ continue; }
+
+			//Messages received after the new sync point are not included in the server count
+			for (auto It = Entry->ReceivedTimetokens.CreateIterator(); It; ++It)
+			{
+				if (*It <= SyncedAtTimetoken)
+				{
+					It.RemoveCurrent();
+				}
+			}
+			Entry->SyncedAtTimetoken = SyncedAtTimetoken;
+
+			const int NewCount = *ServerCountPtr + Entry->ReceivedTimetokens.Num();
+			if (NewCount != Entry->Count)
+			{
+				Entry->Count = NewCount;
+				ChangedChannelIDs.Add(ChannelID);
+			}
+		}
+	}
+
+	for (const FString& ChannelID : ChangedChannelIDs)
+	{
+		BroadcastUnreadMessagesCountChanged(ChannelID);
+	}
+
+	return FinalResult;
+}
+
+void UPubnubChatUnreadTracker::ReleaseSubscriptionSet(UPubnubSubscriptionSet* SubscriptionSetToRelease)
+{
+	if (SubscriptionSetToRelease)
+	{
+		SubscriptionSetToRelease->OnPubnubMessageNative.Clear();
+		SubscriptionSetToRelease->Unsubscribe();
+	}
+}
+
+void UPubnubChatUnreadTracker::RequestSyncWithServer(const TArray<FString>& ChannelIDs)
+{
+	if (!Chat.IsValid() || !Chat->AsyncFunctionsThread)
+	{
+		return;
+	}
+
+	TWeakObjectPtr<UPubnubChatUnreadTracker> WeakThis = MakeWeakObjectPtr(this);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, ChannelIDs]
+	{
+		if(!WeakThis.IsValid())
+		{return;}
+
+		FPubnubChatOperationResult SyncResult = WeakThis.Get()->SyncWithServer(ChannelIDs);
+		if (SyncResult.Error)
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("Failed to sync unread messages counts: %s"), *SyncResult.ErrorMessage);
+		}
+	});
+}
+
+void UPubnubChatUnreadTracker::BroadcastUnreadMessagesCountChanged(const FString& ChannelID)
+{
+	if (!Chat.IsValid())
+	{
+		return;
+	}
+
+	//Count is read when the broadcast runs, so listeners always get the latest value even if updates were queued out of order
+	TWeakObjectPtr<UPubnubChatUnreadTracker> WeakThis = MakeWeakObjectPtr(this);
+	auto Broadcast = [WeakThis, ChannelID]()
+	{
+		if (!WeakThis.IsValid() || !WeakThis->Chat.IsValid())
+		{return;}
+
+		const int Count = WeakThis->GetUnreadMessagesCount(ChannelID);
+		WeakThis->Chat->OnUnreadMessagesCountChanged.Broadcast(ChannelID, Count);
+		WeakThis->Chat->OnUnreadMessagesCountChangedNative.Broadcast(ChannelID, Count);
+	};
+
+	if (IsInGameThread())
+	{
+		Broadcast();
+	}
+	else
+	{
+		AsyncTask(ENamedThreads::GameThread, MoveTemp(Broadcast));
+	}
+}
@@ -0,0 +1,124 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "HAL/CriticalSection.h"
+#include "PubnubChatEnumLibrary.h"
+#include "StructLibraries/PubnubChatStructLibrary.h"
+#include "PubnubChatUnreadTracker.generated.h"
+
+class UPubnubClient;
+class UPubnubSubscriptionSet;
+class UPubnubChat;
+
+/**
+ * Internal unread state of a single tracked channel. Do not use this directly.
+ */
+struct FPubnubChatUnreadTrackerEntry
+{
+	/** Last read message timetoken of the current user membership (0 if nothing was read yet) */
+	int64 LastReadTimetoken = 0;
+	/** Timetoken at which Count was last taken from the server. Older messages are already included in Count */
+	int64 SyncedAtTimetoken = 0;
+	/** Timetokens of unread messages received after SyncedAtTimetoken */
+	TSet<int64> ReceivedTimetokens;
+	/** Current number of unread messages */
+	int Count = 0;
+};
+
+/**
+ * Tracks unread message counts of channels without polling MessageCounts.
+ * Counts are taken from the server once, then incremented by messages received on tracked channels
+ * and recalculated when the last read message timetoken of the current user's membership moves.
+ * Server is asked again only when the local data can't answer (marker moved back) or after a connection gap.
+ *
+ * This is an internal class and should not be used directly. Use UPubnubChat::StartUnreadMessagesTracking instead.
+ */
+UCLASS()
+class PUBNUBCHATSDK_API UPubnubChatUnreadTracker : public UObject
+{
+	GENERATED_BODY()
+
+	friend class UPubnubChat;
+
+public:
+	void InitUnreadTracker(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString& InCurrentUserID);
+
+	/**
+	 * Starts tracking given channel with a count taken from the server. Replaces previous state of this channel.
+	 * @param ChannelID Channel to track
+	 * @param LastReadTimetoken Last read message timetoken of the current user membership, empty if nothing was read yet
+	 * @param Count Unread messages count returned by the server
+	 * @param SyncedAtTimetoken Server timetoken taken right before Count was requested
+	 */
+	void SeedChannel(const FString& ChannelID, const FString& LastReadTimetoken, int Count, const FString& SyncedAtTimetoken);
+
+	/**
+	 * Subscribes to messages of given tracked channels. All subscribed channels share one subscription set,
+	 * which is replaced by a new one if any of the channels is not subscribed yet.
+	 * Blocking: performs network requests on the calling thread.
+	 */
+	FPubnubChatOperationResult SubscribeToChannels(const TArray<FString>& ChannelIDs);
+
+	/** Unsubscribes from all tracked channels and forgets their counts. */
+	void StopTracking();
+
+	bool IsChannelTracked(const FString& ChannelID) const;
+	/** @return Current unread messages count, or 0 if channel is not tracked */
+	int GetUnreadMessagesCount(const FString& ChannelID) const;
+
+	/**
+	 * Counts message received on a tracked channel if it's newer than the last read message and not counted yet.
+	 * Chat events (typing, receipts, invites...) are published as messages too, but are never unread.
+	 * @return True if count was changed
+	 */
+	bool HandleMessageReceived(const FString& ChannelID, const FString& Timetoken, const FString& MessageContent);
+
+	/**
+	 * Applies new last read message timetoken of a tracked channel.
+	 * @return False if count can't be calculated locally and the channel has to be synced with the server
+	 */
+	bool HandleLastReadTimetokenChanged(const FString& ChannelID, const FString& LastReadTimetoken);
+
+	/** Listener for UPubnubChatObjectsRepository::OnMembershipDataUpdatedNative. Can be called from any thread. */
+	void HandleMembershipDataUpdated(const FString& MembershipID, const FPubnubChatMembershipData& MembershipData);
+
+	/** Remembers connection gaps and requests a sync of all tracked channels when connection is back. Game thread only. */
+	void HandleConnectionStatusChanged(EPubnubChatConnectionStatus Status);
+
+	/**
+	 * Takes fresh counts from the server for given channels, or for all tracked channels if ChannelIDs is empty.
+	 * Blocking: performs network requests on the calling thread.
+	 */
+	FPubnubChatOperationResult SyncWithServer(const TArray<FString>& ChannelIDs);
+
+private:
+	UPROPERTY()
+	TObjectPtr<UPubnubClient> PubnubClient = nullptr;
+	TWeakObjectPtr<UPubnubChat> Chat = nullptr;
+	FString CurrentUserID = "";
+
+	/** Unread state of all tracked channels, keyed by ChannelID */
+	TMap<FString, FPubnubChatUnreadTrackerEntry> Entries;
+	/** Composite MembershipID (format: "[ChannelID].[UserID]") of the current user for every tracked channel */
+	TMap<FString, FString> MembershipIDToChannelID;
+	/** One message subscription for all tracked channels */
+	UPROPERTY()
+	TObjectPtr<UPubnubSubscriptionSet> SubscriptionSet = nullptr;
+	/** Channels included in SubscriptionSet */
+	TSet<FString> SubscribedChannelIDs;
+
+	/** True if connection was lost since the last successful sync. Guarded by TrackerCriticalSection */
+	bool bHadConnectionGap = false;
+
+	mutable FCriticalSection TrackerCriticalSection;
+
+	/** Clears delegates of the subscription set and unsubscribes it. Has to be called without TrackerCriticalSection locked */
+	static void ReleaseSubscriptionSet(UPubnubSubscriptionSet* SubscriptionSetToRelease);
+	/** Queues SyncWithServer on the Chat async thread. */
+	void RequestSyncWithServer(const TArray<FString>& ChannelIDs);
+	/** Broadcasts the current count of given channel through the Chat delegates on the game thread. */
+	void BroadcastUnreadMessagesCountChanged(const FString& ChannelID);
+};
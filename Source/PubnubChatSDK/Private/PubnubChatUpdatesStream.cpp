@@ -0,0 +1,266 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatUpdatesStream.h"
+#include "PubnubClient.h"
+#include "PubnubChat.h"
+#include "PubnubChatCallbackStop.h"
+#include "PubnubChatInternalMacros.h"
+#include "PubnubChatSubsystem.h"
+#include "Entities/PubnubSubscription.h"
+#include "FunctionLibraries/PubnubInternalUtilities.h"
+
+
+void UPubnubChatUpdatesStream::BeginDestroy()
+{
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+	}
+	ClearSubscriptionSet();
+
+	Super::BeginDestroy();
+}
+
+void UPubnubChatUpdatesStream::InitUpdatesStream(UPubnubChat* InChat, bool InListenForMessageActions, FGetRoutingIDFunction InGetRoutingID, FApplyUpdateFunction InApplyUpdate, FOnUpdatesBatchFunction InOnUpdatesBatch)
+{
+	Chat = InChat;
+	ListenForMessageActions = InListenForMessageActions;
+	GetRoutingID = MoveTemp(InGetRoutingID);
+	ApplyUpdate = MoveTemp(InApplyUpdate);
+	OnUpdatesBatch = MoveTemp(InOnUpdatesBatch);
+}
+
+void UPubnubChatUpdatesStream::AddObject(const FString& RoutingID, const FString& ChannelID, UObject* Object)
+{
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(Object, TEXT("Can't add object to UpdatesStream, Object is invalid"));
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(!RoutingID.IsEmpty() && !ChannelID.IsEmpty(), TEXT("Can't add object to UpdatesStream, RoutingID or ChannelID is empty"));
+
+	FScopeLock Lock(&UpdatesStreamCriticalSection);
+	RoutedObjects.Add(RoutingID, MakeWeakObjectPtr(Object));
+	SubscribedChannelIDs.Add(ChannelID);
+}
+
+FPubnubChatOperationResult UPubnubChatUpdatesStream::Start()
+{
+	FPubnubChatOperationResult FinalResult;
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(Chat.IsValid() && Chat->PubnubClient, TEXT("Can't start UpdatesStream, Chat is invalid"));
+
+	//Skip if it's already streaming
+	if (IsStreamingUpdates)
+	{ return FinalResult; }
+
+	TArray<FString> ChannelIDs;
+	{
+		FScopeLock Lock(&UpdatesStreamCriticalSection);
+		ChannelIDs = SubscribedChannelIDs.Array();
+	}
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(!ChannelIDs.IsEmpty(), TEXT("Can't start UpdatesStream, there are no objects to stream updates on"));
+
+	//One subscription set for the whole collection, no matter how many objects share the same channel
+	SubscriptionSet = Chat->PubnubClient->CreateSubscriptionSet(ChannelIDs, TArray<FString>());
+	PUBNUB_CHAT_RETURN_OPERATION_RESULT_IF_CONDITION_FAILED(SubscriptionSet, TEXT("Can't start UpdatesStream, Failed to create SubscriptionSet"));
+
+	TWeakObjectPtr<UPubnubChatUpdatesStream> ThisWeak = MakeWeakObjectPtr(this);
+	auto EventLambda = [ThisWeak](const FPubnubMessageData& MessageData)
+	{
+		if(!ThisWeak.IsValid())
+		{return;}
+
+		ThisWeak.Get()->HandleEvent(MessageData);
+	};
+
+	if (ListenForMessageActions)
+	{
+		SubscriptionSet->OnPubnubMessageActionNative.AddLambda(EventLambda);
+	}
+	else
+	{
+		SubscriptionSet->OnPubnubObjectEventNative.AddLambda(EventLambda);
+	}
+
+	FPubnubOperationResult SubscribeResult = SubscriptionSet->Subscribe();
+	FinalResult.AddStep("Subscribe", SubscribeResult);
+	if (SubscribeResult.Error)
+	{
+		ClearSubscriptionSet();
+		return FinalResult;
+	}
+
+	FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UPubnubChatUpdatesStream::OnFlushTicker));
+	IsStreamingUpdates = true;
+
+	return FinalResult;
+}
+
+FPubnubChatOperationResult UPubnubChatUpdatesStream::Stop()
+{
+	FPubnubChatOperationResult FinalResult;
+
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+	}
+
+	//Unsubscribe only if it's streaming updates, but always release the stream below
+	if (IsStreamingUpdates && SubscriptionSet)
+	{
+		SubscriptionSet->OnPubnubMessageActionNative.Clear();
+		SubscriptionSet->OnPubnubObjectEventNative.Clear();
+		FPubnubOperationResult UnsubscribeResult = SubscriptionSet->Unsubscribe();
+		FinalResult.AddStep("Unsubscribe", UnsubscribeResult);
+		SubscriptionSet = nullptr;
+	}
+	IsStreamingUpdates = false;
+
+	{
+		FScopeLock Lock(&UpdatesStreamCriticalSection);
+		PendingRoutingIDs.Empty();
+		PendingRoutingIDsSet.Empty();
+	}
+
+	//Chat doesn't have to keep this stream alive anymore
+	if (Chat.IsValid())
+	{
+		FScopeLock Lock(&Chat->UpdatesStreamsCriticalSection);
+		Chat->UpdatesStreams.Remove(this);
+	}
+
+	return FinalResult;
+}
+
+UPubnubChatCallbackStop* UPubnubChatUpdatesStream::CreateCallbackStop()
+{
+	if (CallbackStop)
+	{ return CallbackStop; }
+	
+	CallbackStop = UPubnubInternalUtilities::SafeNewObject<UPubnubChatCallbackStop>(this);
+	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(CallbackStop, TEXT("Can't create CallbackStop for UpdatesStream"), nullptr);
+	
+	TWeakObjectPtr<UPubnubChatUpdatesStream> ThisWeak = MakeWeakObjectPtr(this);
+	CallbackStop->InitCallbackStop([ThisWeak]()->FPubnubChatOperationResult
+	{
+		if(!ThisWeak.IsValid())
+		{return FPubnubChatOperationResult::CreateError("This updates stream is already destroyed");}
+
+		return ThisWeak.Get()->Stop();
+	});
+	return CallbackStop;
+}
+
+bool UPubnubChatUpdatesStream::RemoveObject(UObject* Object)
+{
+	FScopeLock Lock(&UpdatesStreamCriticalSection);
+	
+	bool bWasRouted = false;
+	for (auto It = RoutedObjects.CreateIterator(); It; ++It)
+	{
+		const bool bIsGivenObject = It.Value().Get() == Object;
+		bWasRouted |= bIsGivenObject;
+		
+		//Destroyed objects are removed as well, so they don't keep the stream alive
+		if (bIsGivenObject || !It.Value().IsValid())
+		{
+			PendingRoutingIDsSet.Remove(It.Key());
+			PendingRoutingIDs.Remove(It.Key());
+			It.RemoveCurrent();
+		}
+	}
+	
+	return bWasRouted && RoutedObjects.IsEmpty();
+}
+
+int UPubnubChatUpdatesStream::GetNumRoutedObjects() const
+{
+	FScopeLock Lock(&UpdatesStreamCriticalSection);
+	return RoutedObjects.Num();
+}
+
+int UPubnubChatUpdatesStream::GetNumSubscribedChannels() const
+{
+	FScopeLock Lock(&UpdatesStreamCriticalSection);
+	return SubscribedChannelIDs.Num();
+}
+
+void UPubnubChatUpdatesStream::HandleEvent(const FPubnubMessageData& MessageData)
+{
+	if (!GetRoutingID || !ApplyUpdate)
+	{ return; }
+
+	const FString RoutingID = GetRoutingID(MessageData);
+	if (RoutingID.IsEmpty())
+	{ return; }
+
+	UObject* Object = nullptr;
+	{
+		FScopeLock Lock(&UpdatesStreamCriticalSection);
+		const TWeakObjectPtr<UObject>* FoundObject = RoutedObjects.Find(RoutingID);
+		if (!FoundObject)
+		{ return; }
+		Object = FoundObject->Get();
+		if (!Object)
+		{
+			RoutedObjects.Remove(RoutingID);
+			return;
+		}
+	}
+
+	if (!ApplyUpdate(Object, MessageData))
+	{ return; }
+
+	FScopeLock Lock(&UpdatesStreamCriticalSection);
+	if (!PendingRoutingIDsSet.Contains(RoutingID))
+	{
+		PendingRoutingIDsSet.Add(RoutingID);
+		PendingRoutingIDs.Add(RoutingID);
+	}
+}
+
+void UPubnubChatUpdatesStream::FlushPendingUpdates()
+{
+	TArray<UObject*> UpdatedObjects;
+	{
+		FScopeLock Lock(&UpdatesStreamCriticalSection);
+		if (PendingRoutingIDs.IsEmpty())
+		{ return; }
+
+		UpdatedObjects.Reserve(PendingRoutingIDs.Num());
+		for (const FString& RoutingID : PendingRoutingIDs)
+		{
+			const TWeakObjectPtr<UObject>* FoundObject = RoutedObjects.Find(RoutingID);
+			if (FoundObject && FoundObject->IsValid())
+			{
+				UpdatedObjects.Add(FoundObject->Get());
+			}
+		}
+		PendingRoutingIDs.Reset();
+		PendingRoutingIDsSet.Reset();
+	}
+
+	if (!UpdatedObjects.IsEmpty() && OnUpdatesBatch)
+	{
+		OnUpdatesBatch(UpdatedObjects);
+	}
+}
+
+bool UPubnubChatUpdatesStream::OnFlushTicker(float DeltaTime)
+{
+	FlushPendingUpdates();
+	return true;
+}
+
+void UPubnubChatUpdatesStream::ClearSubscriptionSet()
+{
+	if (!SubscriptionSet)
+	{ return; }
+
+	SubscriptionSet->OnPubnubMessageActionNative.Clear();
+	SubscriptionSet->OnPubnubObjectEventNative.Clear();
+	if (IsStreamingUpdates)
+	{
+		SubscriptionSet->Unsubscribe();
+		IsStreamingUpdates = false;
+	}
+	SubscriptionSet = nullptr;
+}
@@ -0,0 +1,109 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "HAL/CriticalSection.h"
+#include "Containers/Ticker.h"
+#include "PubnubStructLibrary.h"
+#include "StructLibraries/PubnubChatStructLibrary.h"
+#include "PubnubChatUpdatesStream.generated.h"
+
+class UPubnubChat;
+class UPubnubSubscriptionSet;
+class UPubnubChatCallbackStop;
+
+/**
+ * Streams updates of a whole collection of chat objects (Messages, Users, Channels or Memberships) through a single
+ * subscription set instead of one subscription per object.
+ * Received events are routed to the objects by their composite IDs, and objects changed during a frame
+ * are delivered to the collection callback together, once per frame.
+ *
+ * This is an internal class and should not be used directly. Use StartUpdatesStreamOn of the given chat object class instead.
+ */
+UCLASS()
+class PUBNUBCHATSDK_API UPubnubChatUpdatesStream : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns composite ID of the object affected by given event, or empty string if the event should be ignored */
+	using FGetRoutingIDFunction = TFunction<FString(const FPubnubMessageData& MessageData)>;
+	/** Applies given event to the routed object. Returns true if the object was changed */
+	using FApplyUpdateFunction = TFunction<bool(UObject* Object, const FPubnubMessageData& MessageData)>;
+	/** Receives all objects changed during the last frame */
+	using FOnUpdatesBatchFunction = TFunction<void(const TArray<UObject*>& Objects)>;
+
+	virtual void BeginDestroy() override;
+
+	/**
+	 * @param InChat Chat that owns this stream. Can be null only in tests - then Start will fail.
+	 * @param InListenForMessageActions True to route message action events (Messages), false to route object events (Users, Channels, Memberships)
+	 */
+	void InitUpdatesStream(UPubnubChat* InChat, bool InListenForMessageActions, FGetRoutingIDFunction InGetRoutingID, FApplyUpdateFunction InApplyUpdate, FOnUpdatesBatchFunction InOnUpdatesBatch);
+
+	/**
+	 * Registers object to receive routed updates. Has to be called before Start.
+	 * @param RoutingID Composite ID of the object, has to match what GetRoutingID returns for its events
+	 * @param ChannelID PubNub channel on which updates of this object are published. Shared channels are subscribed only once.
+	 */
+	void AddObject(const FString& RoutingID, const FString& ChannelID, UObject* Object);
+
+	/**
+	 * Subscribes to all registered channels with one subscription set and starts delivering batches every frame.
+	 * Blocking: performs network requests on the calling thread.
+	 */
+	FPubnubChatOperationResult Start();
+
+	/**
+	 * Stops routing updates to given object. Channels stay subscribed until the stream is stopped.
+	 * @return True if the object was routed by this stream and no other object is left, so the stream should be stopped
+	 */
+	bool RemoveObject(UObject* Object);
+
+	/** Unsubscribes the whole collection with a single call and releases this stream. */
+	FPubnubChatOperationResult Stop();
+
+	/** Creates handle that stops this stream with a single call. The handle is kept alive by this stream, so dropping it doesn't stop streaming. */
+	UPubnubChatCallbackStop* CreateCallbackStop();
+
+	bool IsStreaming() const { return IsStreamingUpdates; }
+	int GetNumRoutedObjects() const;
+	int GetNumSubscribedChannels() const;
+
+	/** Routes received event to the matching object. Can be called from any thread. */
+	void HandleEvent(const FPubnubMessageData& MessageData);
+
+	/** Delivers objects changed since the last flush to the collection callback. Called once per frame while streaming. */
+	void FlushPendingUpdates();
+
+private:
+	TWeakObjectPtr<UPubnubChat> Chat = nullptr;
+	bool ListenForMessageActions = false;
+	bool IsStreamingUpdates = false;
+
+	FGetRoutingIDFunction GetRoutingID = nullptr;
+	FApplyUpdateFunction ApplyUpdate = nullptr;
+	FOnUpdatesBatchFunction OnUpdatesBatch = nullptr;
+
+	/** Routed objects keyed by their composite IDs */
+	TMap<FString, TWeakObjectPtr<UObject>> RoutedObjects;
+	/** Distinct channels that have to be subscribed to receive updates of all routed objects */
+	TSet<FString> SubscribedChannelIDs;
+	/** Composite IDs of objects changed since the last flush, in order of the first change */
+	TArray<FString> PendingRoutingIDs;
+	TSet<FString> PendingRoutingIDsSet;
+
+	UPROPERTY()
+	TObjectPtr<UPubnubSubscriptionSet> SubscriptionSet = nullptr;
+	UPROPERTY()
+	TObjectPtr<UPubnubChatCallbackStop> CallbackStop = nullptr;
+
+	FTSTicker::FDelegateHandle FlushTickerHandle;
+
+	mutable FCriticalSection UpdatesStreamCriticalSection;
+
+	bool OnFlushTicker(float DeltaTime);
+	void ClearSubscriptionSet();
+};
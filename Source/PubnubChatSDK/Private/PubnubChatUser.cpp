@@ -9,6 +9,8 @@
 #include "PubnubChatSubsystem.h"
 #include "PubnubChatMembership.h"
 #include "PubnubChatObjectsRepository.h"
+#include "PubnubChatUpdatesStream.h"
+#include "PubnubChatActivityHeartbeat.h"
 #include "Entities/PubnubUserMetadataEntity.h"
 #include "Entities/PubnubSubscription.h"
 #include "FunctionLibraries/PubnubChatInternalUtilities.h"
@@ -41,22 +43,35 @@ FPubnubChatUserData UPubnubChatUser::GetUserData() const
 	return FPubnubChatUserData();
 }
 
+int64 UPubnubChatUser::GetDataVersion() const
+{
+	PUBNUB_CHAT_OBJECT_RETURN_IF_NOT_INITIALIZED(0);
+
+	return Chat->ObjectsRepository->GetUserDataVersion(UserID);
+}
+
 FPubnubChatOperationResult UPubnubChatUser::Update(FPubnubChatUpdateUserInputData UpdateUserData)
 {
 	FPubnubChatOperationResult FinalResult;
 	PUBNUB_CHAT_OBJECT_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
 	
+	//Update of the current user that replaces Custom carries the activity timestamp, so it's not removed and doesn't need a separate write
+	if (UserID == Chat->CurrentUserID && Chat->ActivityHeartbeat)
+	{
+		Chat->ActivityHeartbeat->ApplyToUserUpdate(UpdateUserData);
+	}
+	
 	//SetChannelMetadata by PubnubClient
-	FPubnubUserMetadataResult SetUserResult = PubnubClient->SetUserMetadata(UserID, UpdateUserData.ToPubnubUserInputData(), FPubnubGetMetadataInclude::FromValue(true));
+	FPubnubUserMetadataResult SetUserResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Write, "SetUserMetadata", FinalResult, PubnubClient->SetUserMetadata(UserID, UpdateUserData.ToPubnubUserInputData(), FPubnubGetMetadataInclude::FromValue(true)));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_OPR_RESULT_IF_ERROR(FinalResult, SetUserResult.Result, "SetUserMetadata");
 	
 	//Update repository with updated channel data
-	Chat->ObjectsRepository->UpdateUserData(UserID, FPubnubChatUserData::FromPubnubUserData(SetUserResult.UserData));
+	Chat->ObjectsRepository->UpdateUserData(UserID, FPubnubChatUserData::FromPubnubUserData(SetUserResult.UserData), SetUserResult.UserData.Updated);
 	
 	return FinalResult;
 }
 
-void UPubnubChatUser::UpdateAsync(FPubnubChatUpdateUserInputData UpdateUserData, FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatUser::UpdateAsync(FPubnubChatUpdateUserInputData UpdateUserData, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -64,23 +79,28 @@ void UPubnubChatUser::UpdateAsync(FPubnubChatUpdateUserInputData UpdateUserData,
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	UpdateAsync(UpdateUserData, NativeCallback);
+	return UpdateAsync(UpdateUserData, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatUser::UpdateAsync(FPubnubChatUpdateUserInputData UpdateUserData, FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatUser::UpdateAsync(FPubnubChatUpdateUserInputData UpdateUserData, FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, UpdateUserData = MoveTemp(UpdateUserData), OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, UpdateUserData = MoveTemp(UpdateUserData), OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult UpdateResult = WeakThis.Get()->Update(UpdateUserData);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, UpdateResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatUser::Delete()
@@ -91,7 +111,7 @@ FPubnubChatOperationResult UPubnubChatUser::Delete()
 	return DeleteUserResult;
 }
 
-void UPubnubChatUser::DeleteAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatUser::DeleteAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -99,23 +119,28 @@ void UPubnubChatUser::DeleteAsync(FOnPubnubChatOperationResponse OnOperationResp
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	DeleteAsync(NativeCallback);
+	return DeleteAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatUser::DeleteAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatUser::DeleteAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
 
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
+
 		FPubnubChatOperationResult DeleteResult = WeakThis.Get()->Delete();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, DeleteResult);
 	});
+
+	return AsyncHandle;
 }
 
 bool UPubnubChatUser::IsActive() const
@@ -123,21 +148,10 @@ bool UPubnubChatUser::IsActive() const
 	if (!IsInitialized || !Chat)
 	{ return false; }
 
-	// Get user data to check lastActiveTimestamp
-	FPubnubChatUserData UserData = GetUserData();
-	FString LastActiveTimestamp = UPubnubChatInternalUtilities::GetLastActiveTimestampFromCustom(UserData.Custom);
-
-	// If no timestamp exists, user is not active
-	if (LastActiveTimestamp.IsEmpty())
-	{ return false; }
-
-	// Validate timestamp is numeric
-	if (!LastActiveTimestamp.IsNumeric())
-	{ return false; }
-
-	// Parse timestamp (stored as timetoken in 100ns units)
+	// Timestamp is parsed by the repository when user Custom data changes. If no valid timestamp exists, user is not active
 	int64 LastTimestampTimetoken = 0;
-	LexFromString(LastTimestampTimetoken, *LastActiveTimestamp);
+	if (!Chat->ObjectsRepository || !Chat->ObjectsRepository->TryGetUserLastActiveTimestamp(UserID, LastTimestampTimetoken))
+	{ return false; }
 
 	// Get current timetoken (17-digit format in 100ns units)
 	FString CurrentTimetokenString = UPubnubTimetokenUtilities::GetCurrentUnixTimetoken();
@@ -175,7 +189,7 @@ FPubnubChatWherePresentResult UPubnubChatUser::WherePresent()
 	return Chat->WherePresent(UserID);
 }
 
-void UPubnubChatUser::WherePresentAsync(FOnPubnubChatWherePresentResponse OnWherePresentResponse)
+FPubnubChatAsyncHandle UPubnubChatUser::WherePresentAsync(FOnPubnubChatWherePresentResponse OnWherePresentResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatWherePresentResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnWherePresentResponse](const FPubnubChatWherePresentResult& WherePresentResult)
@@ -183,23 +197,28 @@ void UPubnubChatUser::WherePresentAsync(FOnPubnubChatWherePresentResponse OnWher
 		OnWherePresentResponse.ExecuteIfBound(WherePresentResult);
 	});
 
-	WherePresentAsync(NativeCallback);
+	return WherePresentAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatUser::WherePresentAsync(FOnPubnubChatWherePresentResponseNative OnWherePresentResponseNative)
+FPubnubChatAsyncHandle UPubnubChatUser::WherePresentAsync(FOnPubnubChatWherePresentResponseNative OnWherePresentResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnWherePresentResponseNative, FPubnubChatWherePresentResult());
 	
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnWherePresentResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnWherePresentResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnWherePresentResponseNative);
 		
 		FPubnubChatWherePresentResult WherePresentResult = WeakThis.Get()->WherePresent();
 		UPubnubUtilities::CallPubnubDelegate(OnWherePresentResponseNative, WherePresentResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatIsPresentResult UPubnubChatUser::IsPresentOn(const FString ChannelID)
@@ -210,7 +229,7 @@ FPubnubChatIsPresentResult UPubnubChatUser::IsPresentOn(const FString ChannelID)
 	return Chat->IsPresent(UserID, ChannelID);
 }
 
-void UPubnubChatUser::IsPresentOnAsync(const FString ChannelID, FOnPubnubChatIsPresentResponse OnIsPresentResponse)
+FPubnubChatAsyncHandle UPubnubChatUser::IsPresentOnAsync(const FString ChannelID, FOnPubnubChatIsPresentResponse OnIsPresentResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatIsPresentResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnIsPresentResponse](const FPubnubChatIsPresentResult& IsPresentResult)
@@ -218,23 +237,28 @@ void UPubnubChatUser::IsPresentOnAsync(const FString ChannelID, FOnPubnubChatIsP
 		OnIsPresentResponse.ExecuteIfBound(IsPresentResult);
 	});
 
-	IsPresentOnAsync(ChannelID, NativeCallback);
+	return IsPresentOnAsync(ChannelID, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatUser::IsPresentOnAsync(const FString ChannelID, FOnPubnubChatIsPresentResponseNative OnIsPresentResponseNative)
+FPubnubChatAsyncHandle UPubnubChatUser::IsPresentOnAsync(const FString ChannelID, FOnPubnubChatIsPresentResponseNative OnIsPresentResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnIsPresentResponseNative, FPubnubChatIsPresentResult());
 	
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, ChannelID, OnIsPresentResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, ChannelID, OnIsPresentResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnIsPresentResponseNative);
 		
 		FPubnubChatIsPresentResult IsPresentResult = WeakThis.Get()->IsPresentOn(ChannelID);
 		UPubnubUtilities::CallPubnubDelegate(OnIsPresentResponseNative, IsPresentResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatMembershipsResult UPubnubChatUser::GetMemberships(const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page)
@@ -243,7 +267,7 @@ FPubnubChatMembershipsResult UPubnubChatUser::GetMemberships(const int Limit, co
 	PUBNUB_CHAT_OBJECT_RETURN_WRAPPER_IF_NOT_INITIALIZED(FinalResult);
 	
 	//GetMemberships using PubnubClient
-	FPubnubMembershipsResult GetMembershipsResult = PubnubClient->GetMemberships(UserID, FPubnubMembershipInclude::FromValue(true), Limit, Filter, Sort, Page);
+	FPubnubMembershipsResult GetMembershipsResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Read, "GetMemberships", FinalResult.Result, PubnubClient->GetMemberships(UserID, FPubnubMembershipInclude::FromValue(true), Limit, Filter, Sort, Page));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, GetMembershipsResult.Result, "GetMemberships");
 	
 	//Create corresponding Chat objects for all returned memberships
@@ -259,7 +283,7 @@ FPubnubChatMembershipsResult UPubnubChatUser::GetMemberships(const int Limit, co
 	return FinalResult;
 }
 
-void UPubnubChatUser::GetMembershipsAsync(FOnPubnubChatMembershipsResponse OnMembershipsResponse, const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChatUser::GetMembershipsAsync(FOnPubnubChatMembershipsResponse OnMembershipsResponse, const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	FOnPubnubChatMembershipsResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnMembershipsResponse](const FPubnubChatMembershipsResult& MembershipsResult)
@@ -267,23 +291,28 @@ void UPubnubChatUser::GetMembershipsAsync(FOnPubnubChatMembershipsResponse OnMem
 		OnMembershipsResponse.ExecuteIfBound(MembershipsResult);
 	});
 
-	GetMembershipsAsync(NativeCallback, Limit, Filter, Sort, Page);
+	return GetMembershipsAsync(NativeCallback, Limit, Filter, Sort, Page, DeadlineSeconds);
 }
 
-void UPubnubChatUser::GetMembershipsAsync(FOnPubnubChatMembershipsResponseNative OnMembershipsResponseNative, const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChatUser::GetMembershipsAsync(FOnPubnubChatMembershipsResponseNative OnMembershipsResponseNative, const int Limit, const FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnMembershipsResponseNative, FPubnubChatMembershipsResult());
 	
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnMembershipsResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Limit, Filter, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnMembershipsResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnMembershipsResponseNative);
 		
 		FPubnubChatMembershipsResult MembershipsResult = WeakThis.Get()->GetMemberships(Limit, Filter, Sort, Page);
 		UPubnubUtilities::CallPubnubDelegate(OnMembershipsResponseNative, MembershipsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatMembershipResult UPubnubChatUser::GetMembership(const FString ChannelID)
@@ -304,7 +333,7 @@ FPubnubChatMembershipResult UPubnubChatUser::GetMembership(const FString Channel
 	return FinalResult;
 }
 
-void UPubnubChatUser::GetMembershipAsync(const FString ChannelID, FOnPubnubChatMembershipResponse OnMembershipResponse)
+FPubnubChatAsyncHandle UPubnubChatUser::GetMembershipAsync(const FString ChannelID, FOnPubnubChatMembershipResponse OnMembershipResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatMembershipResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnMembershipResponse](const FPubnubChatMembershipResult& MembershipResult)
@@ -312,23 +341,28 @@ void UPubnubChatUser::GetMembershipAsync(const FString ChannelID, FOnPubnubChatM
 		OnMembershipResponse.ExecuteIfBound(MembershipResult);
 	});
 
-	GetMembershipAsync(ChannelID, NativeCallback);
+	return GetMembershipAsync(ChannelID, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatUser::GetMembershipAsync(const FString ChannelID, FOnPubnubChatMembershipResponseNative OnMembershipResponseNative)
+FPubnubChatAsyncHandle UPubnubChatUser::GetMembershipAsync(const FString ChannelID, FOnPubnubChatMembershipResponseNative OnMembershipResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnMembershipResponseNative, FPubnubChatMembershipResult());
 	
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, ChannelID, OnMembershipResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, ChannelID, OnMembershipResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnMembershipResponseNative);
 		
 		FPubnubChatMembershipResult MembershipResult = WeakThis.Get()->GetMembership(ChannelID);
 		UPubnubUtilities::CallPubnubDelegate(OnMembershipResponseNative, MembershipResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatIsMemberOnResult UPubnubChatUser::IsMemberOn(const FString ChannelID)
@@ -343,7 +377,7 @@ FPubnubChatIsMemberOnResult UPubnubChatUser::IsMemberOn(const FString ChannelID)
 	return FinalResult;
 }
 
-void UPubnubChatUser::IsMemberOnAsync(const FString ChannelID, FOnPubnubChatIsMemberOnResponse OnIsMemberOnResponse)
+FPubnubChatAsyncHandle UPubnubChatUser::IsMemberOnAsync(const FString ChannelID, FOnPubnubChatIsMemberOnResponse OnIsMemberOnResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatIsMemberOnResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnIsMemberOnResponse](const FPubnubChatIsMemberOnResult& IsMemberOnResult)
@@ -351,23 +385,28 @@ void UPubnubChatUser::IsMemberOnAsync(const FString ChannelID, FOnPubnubChatIsMe
 		OnIsMemberOnResponse.ExecuteIfBound(IsMemberOnResult);
 	});
 
-	IsMemberOnAsync(ChannelID, NativeCallback);
+	return IsMemberOnAsync(ChannelID, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatUser::IsMemberOnAsync(const FString ChannelID, FOnPubnubChatIsMemberOnResponseNative OnIsMemberOnResponseNative)
+FPubnubChatAsyncHandle UPubnubChatUser::IsMemberOnAsync(const FString ChannelID, FOnPubnubChatIsMemberOnResponseNative OnIsMemberOnResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnIsMemberOnResponseNative, FPubnubChatIsMemberOnResult());
 	
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, ChannelID, OnIsMemberOnResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, ChannelID, OnIsMemberOnResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnIsMemberOnResponseNative);
 		
 		FPubnubChatIsMemberOnResult IsMemberOnResult = WeakThis.Get()->IsMemberOn(ChannelID);
 		UPubnubUtilities::CallPubnubDelegate(OnIsMemberOnResponseNative, IsMemberOnResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatUser::SetRestrictions(const FString ChannelID, bool Ban, bool Mute, FString Reason)
@@ -378,7 +417,7 @@ FPubnubChatOperationResult UPubnubChatUser::SetRestrictions(const FString Channe
 	return Chat->SetRestrictions(FPubnubChatRestriction({UserID, ChannelID, Ban, Mute, Reason}));
 }
 
-void UPubnubChatUser::SetRestrictionsAsync(const FString ChannelID, bool Ban, bool Mute, FOnPubnubChatOperationResponse OnOperationResponse, FString Reason)
+FPubnubChatAsyncHandle UPubnubChatUser::SetRestrictionsAsync(const FString ChannelID, bool Ban, bool Mute, FOnPubnubChatOperationResponse OnOperationResponse, FString Reason, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -386,23 +425,28 @@ void UPubnubChatUser::SetRestrictionsAsync(const FString ChannelID, bool Ban, bo
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	SetRestrictionsAsync(ChannelID, Ban, Mute, NativeCallback, Reason);
+	return SetRestrictionsAsync(ChannelID, Ban, Mute, NativeCallback, Reason, DeadlineSeconds);
 }
 
-void UPubnubChatUser::SetRestrictionsAsync(const FString ChannelID, bool Ban, bool Mute, FOnPubnubChatOperationResponseNative OnOperationResponseNative, FString Reason)
+FPubnubChatAsyncHandle UPubnubChatUser::SetRestrictionsAsync(const FString ChannelID, bool Ban, bool Mute, FOnPubnubChatOperationResponseNative OnOperationResponseNative, FString Reason, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, ChannelID, Ban, Mute, Reason, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, ChannelID, Ban, Mute, Reason, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult SetRestrictionsResult = WeakThis.Get()->SetRestrictions(ChannelID, Ban, Mute, Reason);
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, SetRestrictionsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatGetRestrictionResult UPubnubChatUser::GetChannelRestrictions(UPubnubChatChannel* Channel)
@@ -431,7 +475,7 @@ FPubnubChatGetRestrictionResult UPubnubChatUser::GetChannelRestrictions(UPubnubC
 	return FinalResult;
 }
 
-void UPubnubChatUser::GetChannelRestrictionsAsync(UPubnubChatChannel* Channel, FOnPubnubChatGetRestrictionResponse OnRestrictionResponse)
+FPubnubChatAsyncHandle UPubnubChatUser::GetChannelRestrictionsAsync(UPubnubChatChannel* Channel, FOnPubnubChatGetRestrictionResponse OnRestrictionResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatGetRestrictionResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnRestrictionResponse](const FPubnubChatGetRestrictionResult& RestrictionResult)
@@ -439,23 +483,28 @@ void UPubnubChatUser::GetChannelRestrictionsAsync(UPubnubChatChannel* Channel, F
 		OnRestrictionResponse.ExecuteIfBound(RestrictionResult);
 	});
 
-	GetChannelRestrictionsAsync(Channel, NativeCallback);
+	return GetChannelRestrictionsAsync(Channel, NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatUser::GetChannelRestrictionsAsync(UPubnubChatChannel* Channel, FOnPubnubChatGetRestrictionResponseNative OnRestrictionResponseNative)
+FPubnubChatAsyncHandle UPubnubChatUser::GetChannelRestrictionsAsync(UPubnubChatChannel* Channel, FOnPubnubChatGetRestrictionResponseNative OnRestrictionResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnRestrictionResponseNative, FPubnubChatGetRestrictionResult());
 	
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Channel, OnRestrictionResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Channel, OnRestrictionResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnRestrictionResponseNative);
 		
 		FPubnubChatGetRestrictionResult RestrictionResult = WeakThis.Get()->GetChannelRestrictions(Channel);
 		UPubnubUtilities::CallPubnubDelegate(OnRestrictionResponseNative, RestrictionResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatGetRestrictionsResult UPubnubChatUser::GetChannelsRestrictions(const int Limit, FPubnubMembershipSort Sort, FPubnubPage Page)
@@ -466,7 +515,7 @@ FPubnubChatGetRestrictionsResult UPubnubChatUser::GetChannelsRestrictions(const
 	return GetRestrictions(Limit, UPubnubChatInternalUtilities::GetFilterForChannelsRestrictions(), Sort, Page);
 }
 
-void UPubnubChatUser::GetChannelsRestrictionsAsync(FOnPubnubChatGetRestrictionsResponse OnRestrictionsResponse, const int Limit, FPubnubMembershipSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChatUser::GetChannelsRestrictionsAsync(FOnPubnubChatGetRestrictionsResponse OnRestrictionsResponse, const int Limit, FPubnubMembershipSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	FOnPubnubChatGetRestrictionsResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnRestrictionsResponse](const FPubnubChatGetRestrictionsResult& RestrictionsResult)
@@ -474,23 +523,28 @@ void UPubnubChatUser::GetChannelsRestrictionsAsync(FOnPubnubChatGetRestrictionsR
 		OnRestrictionsResponse.ExecuteIfBound(RestrictionsResult);
 	});
 
-	GetChannelsRestrictionsAsync(NativeCallback, Limit, Sort, Page);
+	return GetChannelsRestrictionsAsync(NativeCallback, Limit, Sort, Page, DeadlineSeconds);
 }
 
-void UPubnubChatUser::GetChannelsRestrictionsAsync(FOnPubnubChatGetRestrictionsResponseNative OnRestrictionsResponseNative, const int Limit, FPubnubMembershipSort Sort, FPubnubPage Page)
+FPubnubChatAsyncHandle UPubnubChatUser::GetChannelsRestrictionsAsync(FOnPubnubChatGetRestrictionsResponseNative OnRestrictionsResponseNative, const int Limit, FPubnubMembershipSort Sort, FPubnubPage Page, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_WRAPPER(OnRestrictionsResponseNative, FPubnubChatGetRestrictionsResult());
 	
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, Limit, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnRestrictionsResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, Limit, Sort = MoveTemp(Sort), Page = MoveTemp(Page), OnRestrictionsResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnRestrictionsResponseNative);
 		
 		FPubnubChatGetRestrictionsResult RestrictionsResult = WeakThis.Get()->GetChannelsRestrictions(Limit, Sort, Page);
 		UPubnubUtilities::CallPubnubDelegate(OnRestrictionsResponseNative, RestrictionsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatUser::StreamMentions()
@@ -532,7 +586,7 @@ FPubnubChatOperationResult UPubnubChatUser::StreamMentions()
 	return FinalResult;
 }
 
-void UPubnubChatUser::StreamMentionsAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatUser::StreamMentionsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -540,23 +594,28 @@ void UPubnubChatUser::StreamMentionsAsync(FOnPubnubChatOperationResponse OnOpera
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StreamMentionsAsync(NativeCallback);
+	return StreamMentionsAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatUser::StreamMentionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatUser::StreamMentionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
 
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
+
 		FPubnubChatOperationResult StreamMentionsResult = WeakThis.Get()->StreamMentions();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StreamMentionsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatUser::StopStreamingMentions()
@@ -582,7 +641,7 @@ FPubnubChatOperationResult UPubnubChatUser::StopStreamingMentions()
 	return FinalResult;
 }
 
-void UPubnubChatUser::StopStreamingMentionsAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatUser::StopStreamingMentionsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -590,23 +649,28 @@ void UPubnubChatUser::StopStreamingMentionsAsync(FOnPubnubChatOperationResponse
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StopStreamingMentionsAsync(NativeCallback);
+	return StopStreamingMentionsAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatUser::StopStreamingMentionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatUser::StopStreamingMentionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
 
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
+
 		FPubnubChatOperationResult StopResult = WeakThis.Get()->StopStreamingMentions();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StopResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatUser::StreamInvitations()
@@ -648,7 +712,7 @@ FPubnubChatOperationResult UPubnubChatUser::StreamInvitations()
 	return FinalResult;
 }
 
-void UPubnubChatUser::StreamInvitationsAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatUser::StreamInvitationsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -656,23 +720,28 @@ void UPubnubChatUser::StreamInvitationsAsync(FOnPubnubChatOperationResponse OnOp
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StreamInvitationsAsync(NativeCallback);
+	return StreamInvitationsAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatUser::StreamInvitationsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatUser::StreamInvitationsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
 
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
+
 		FPubnubChatOperationResult StreamInvitationsResult = WeakThis.Get()->StreamInvitations();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StreamInvitationsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatUser::StopStreamingInvitations()
@@ -698,7 +767,7 @@ FPubnubChatOperationResult UPubnubChatUser::StopStreamingInvitations()
 	return FinalResult;
 }
 
-void UPubnubChatUser::StopStreamingInvitationsAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatUser::StopStreamingInvitationsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -706,23 +775,28 @@ void UPubnubChatUser::StopStreamingInvitationsAsync(FOnPubnubChatOperationRespon
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StopStreamingInvitationsAsync(NativeCallback);
+	return StopStreamingInvitationsAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatUser::StopStreamingInvitationsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatUser::StopStreamingInvitationsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
 
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
+
 		FPubnubChatOperationResult StopResult = WeakThis.Get()->StopStreamingInvitations();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StopResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatUser::StreamRestrictions()
@@ -767,7 +841,7 @@ FPubnubChatOperationResult UPubnubChatUser::StreamRestrictions()
 	return FinalResult;
 }
 
-void UPubnubChatUser::StreamRestrictionsAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatUser::StreamRestrictionsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -775,23 +849,28 @@ void UPubnubChatUser::StreamRestrictionsAsync(FOnPubnubChatOperationResponse OnO
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StreamRestrictionsAsync(NativeCallback);
+	return StreamRestrictionsAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatUser::StreamRestrictionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatUser::StreamRestrictionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
 
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
+
 		FPubnubChatOperationResult StreamRestrictionsResult = WeakThis.Get()->StreamRestrictions();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StreamRestrictionsResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatUser::StopStreamingRestrictions()
@@ -817,7 +896,7 @@ FPubnubChatOperationResult UPubnubChatUser::StopStreamingRestrictions()
 	return FinalResult;
 }
 
-void UPubnubChatUser::StopStreamingRestrictionsAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatUser::StopStreamingRestrictionsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -825,23 +904,28 @@ void UPubnubChatUser::StopStreamingRestrictionsAsync(FOnPubnubChatOperationRespo
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StopStreamingRestrictionsAsync(NativeCallback);
+	return StopStreamingRestrictionsAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatUser::StopStreamingRestrictionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatUser::StopStreamingRestrictionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
 
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
+
 		FPubnubChatOperationResult StopResult = WeakThis.Get()->StopStreamingRestrictions();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StopResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatUser::StreamUpdates()
@@ -866,34 +950,7 @@ FPubnubChatOperationResult UPubnubChatUser::StreamUpdates()
 		if(!ThisUser->IsInitialized || !ThisUser->Chat || !ThisUser->IsStreamingUpdates)
 		{return;}
 		
-		//If this is not UserUpdate, just ignore this message
-		if (UPubnubChatInternalUtilities::IsPubnubMessageUserUpdate(MessageData.Message))
-		{
-			//Check if user was deleted or updated
-			if (UPubnubChatInternalUtilities::IsPubnubMessageDeleteEvent(MessageData.Message))
-			{
-				//Remove this user from repository
-				ThisUser->Chat->ObjectsRepository->RemoveUserData(ThisUser->UserID);
-				
-				//Call OnDeleted delegates
-				ThisUser->OnDeleted.Broadcast();
-				ThisUser->OnDeletedNative.Broadcast();
-			}
-			else
-			{
-				//Adjust this user data based on the update message
-				FPubnubChatUserData ChatUserData = ThisUser->GetUserData();
-				FPubnubUserUpdateData UserUpdateData = UPubnubJsonUtilities::GetUserUpdateDataFromMessageContent(MessageData.Message);
-				UPubnubChatInternalUtilities::UpdateChatUserFromPubnubUserUpdateData(UserUpdateData, ChatUserData);
-							
-				//Update repository with new user data
-				ThisUser->Chat->ObjectsRepository->UpdateUserData(ThisUser->UserID, ChatUserData);
-							
-				//Call OnUpdated delegates with new user data
-				ThisUser->OnUpdated.Broadcast(ThisUser->UserID, ChatUserData);
-				ThisUser->OnUpdatedNative.Broadcast(ThisUser->UserID, ChatUserData);
-			}
-		}
+		ThisUser->HandleUpdatesEvent(MessageData);
 	});
 	
 	//Subscribe with UpdatesSubscription to receive user metadata updates
@@ -905,7 +962,7 @@ FPubnubChatOperationResult UPubnubChatUser::StreamUpdates()
 	return FinalResult;
 }
 
-void UPubnubChatUser::StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatUser::StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -913,23 +970,28 @@ void UPubnubChatUser::StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperat
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StreamUpdatesAsync(NativeCallback);
+	return StreamUpdatesAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatUser::StreamUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatUser::StreamUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StreamUpdatesResult = WeakThis.Get()->StreamUpdates();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StreamUpdatesResult);
 	});
+
+	return AsyncHandle;
 }
 
 FPubnubChatOperationResult UPubnubChatUser::StreamUpdatesOn(const TArray<UPubnubChatUser*>& Users)
@@ -944,11 +1006,107 @@ FPubnubChatOperationResult UPubnubChatUser::StreamUpdatesOn(const TArray<UPubnub
 	return FinalResult;
 }
 
+FPubnubChatListenForEventsResult UPubnubChatUser::StartUpdatesStreamOn(const TArray<UPubnubChatUser*>& Users, FOnPubnubChatUsersUpdated OnUsersUpdated)
+{
+	FOnPubnubChatUsersUpdatedNative NativeCallback;
+	NativeCallback.BindLambda([OnUsersUpdated](const TArray<UPubnubChatUser*>& UpdatedUsers)
+	{
+		OnUsersUpdated.ExecuteIfBound(UpdatedUsers);
+	});
+	
+	return StartUpdatesStreamOn(Users, NativeCallback);
+}
+
+FPubnubChatListenForEventsResult UPubnubChatUser::StartUpdatesStreamOn(const TArray<UPubnubChatUser*>& Users, FOnPubnubChatUsersUpdatedNative OnUsersUpdatedNative)
+{
+	FPubnubChatListenForEventsResult FinalResult;
+	
+	//Nothing to stream on
+	if (Users.IsEmpty())
+	{ return FinalResult; }
+	
+	//Skip users that can't stream updates, all others share one stream of the first valid user's Chat
+	TArray<UPubnubChatUser*> ValidUsers;
+	for (UPubnubChatUser* User : Users)
+	{
+		if (!User || !User->IsInitialized || !User->Chat || !User->PubnubClient)
+		{
+			//Not initialized object is reported as error, but doesn't stop streaming on all others
+			FString ErrorLogMessage = FString::Printf(TEXT("[%s]: Skipping user that is not initialized."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__)));
+			UE_LOG(PubnubChatLog, Error, TEXT("%s"), *ErrorLogMessage);
+			FinalResult.Result.Merge(FPubnubChatOperationResult::CreateError(ErrorLogMessage));
+			continue;
+		}
+		if (!ValidUsers.IsEmpty() && User->Chat != ValidUsers[0]->Chat)
+		{
+			UE_LOG(PubnubChatLog, Warning, TEXT("[%s]: Skipping user %s that belongs to a different Chat."), *UPubnubChatLogUtilities::ConvertFunctionNameMacroToLog(ANSI_TO_TCHAR(__FUNCTION__)), *User->UserID);
+			continue;
+		}
+		ValidUsers.Add(User);
+	}
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_CONDITION_FAILED(FinalResult, !ValidUsers.IsEmpty(), TEXT("None of given users is initialized"));
+	
+	UPubnubChatUpdatesStream* UpdatesStream = ValidUsers[0]->Chat->CreateUpdatesStream();
+	PUBNUB_CHAT_RETURN_WRAPPER_IF_CONDITION_FAILED(FinalResult, UpdatesStream, TEXT("Failed to create UpdatesStream"));
+	
+	//User metadata updates are published on the channel named after the user, so UserID is both the routing and subscribed ID
+	auto GetRoutingID = [](const FPubnubMessageData& MessageData)
+	{
+		return MessageData.Channel;
+	};
+	auto ApplyUpdate = [](UObject* Object, const FPubnubMessageData& MessageData)
+	{
+		UPubnubChatUser* User = Cast<UPubnubChatUser>(Object);
+		if (!User || !User->IsInitialized || !User->Chat)
+		{ return false; }
+		
+		//User that streams updates on its own already applied this event through its UpdatesSubscription
+		if (User->IsStreamingUpdates)
+		{ return UPubnubChatInternalUtilities::IsPubnubMessageUserUpdate(MessageData.Message); }
+		
+		return User->HandleUpdatesEvent(MessageData);
+	};
+	auto OnUpdatesBatch = [OnUsersUpdatedNative](const TArray<UObject*>& Objects)
+	{
+		TArray<UPubnubChatUser*> UpdatedUsers;
+		UpdatedUsers.Reserve(Objects.Num());
+		for (UObject* Object : Objects)
+		{
+			if (UPubnubChatUser* User = Cast<UPubnubChatUser>(Object))
+			{
+				UpdatedUsers.Add(User);
+			}
+		}
+		OnUsersUpdatedNative.ExecuteIfBound(UpdatedUsers);
+	};
+	UpdatesStream->InitUpdatesStream(ValidUsers[0]->Chat, false, GetRoutingID, ApplyUpdate, OnUpdatesBatch);
+	
+	for (UPubnubChatUser* User : ValidUsers)
+	{
+		UpdatesStream->AddObject(User->UserID, User->UserID, User);
+	}
+	
+	FPubnubChatOperationResult StartResult = UpdatesStream->Start();
+	FinalResult.Result.Merge(StartResult);
+	if (StartResult.Error)
+	{
+		UpdatesStream->Stop();
+		return FinalResult;
+	}
+	
+	FinalResult.CallbackStop = UpdatesStream->CreateCallbackStop();
+	
+	return FinalResult;
+}
+
 FPubnubChatOperationResult UPubnubChatUser::StopStreamingUpdates()
 {
 	PUBNUB_CHAT_OBJECT_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
 	FPubnubChatOperationResult FinalResult;
 
+	//Stop routing updates from streams started with StartUpdatesStreamOn, streams without any user left are stopped
+	FinalResult.Merge(Chat->RemoveFromUpdatesStreams(this));
+
 	//Remove message related delegates
 	UpdatesSubscription->OnPubnubObjectEventNative.Clear();
 	
@@ -963,7 +1121,7 @@ FPubnubChatOperationResult UPubnubChatUser::StopStreamingUpdates()
 	return FinalResult;
 }
 
-void UPubnubChatUser::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse)
+FPubnubChatAsyncHandle UPubnubChatUser::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds)
 {
 	FOnPubnubChatOperationResponseNative NativeCallback;
 	NativeCallback.BindLambda([OnOperationResponse](const FPubnubChatOperationResult& OperationResult)
@@ -971,26 +1129,66 @@ void UPubnubChatUser::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse O
 		OnOperationResponse.ExecuteIfBound(OperationResult);
 	});
 
-	StopStreamingUpdatesAsync(NativeCallback);
+	return StopStreamingUpdatesAsync(NativeCallback, DeadlineSeconds);
 }
 
-void UPubnubChatUser::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative)
+FPubnubChatAsyncHandle UPubnubChatUser::StopStreamingUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative, float DeadlineSeconds)
 {
 	PUBNUB_CHAT_OBJECT_RETURN_WITH_DELEGATE_IF_NOT_INITIALIZED_OPERATION_RESULT(OnOperationResponseNative);
 	
 	TWeakObjectPtr<UPubnubChatUser> WeakThis = MakeWeakObjectPtr(this);
 
-	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, OnOperationResponseNative]
+	FPubnubChatAsyncHandle AsyncHandle = Chat->CreateAsyncHandle(DeadlineSeconds);
+	Chat->AsyncFunctionsThread->AddFunctionToQueue([WeakThis, AsyncHandle, OnOperationResponseNative]
 	{
 		if (!WeakThis.IsValid())
 		{ return; }
+
+		PUBNUB_CHAT_START_ASYNC_OPERATION_OR_RETURN(AsyncHandle, OnOperationResponseNative);
 		
 		FPubnubChatOperationResult StopResult = WeakThis.Get()->StopStreamingUpdates();
 		UPubnubUtilities::CallPubnubDelegate(OnOperationResponseNative, StopResult);
 	});
+
+	return AsyncHandle;
 }
 
 
+bool UPubnubChatUser::HandleUpdatesEvent(const FPubnubMessageData& MessageData)
+{
+	//If this is not UserUpdate, just ignore this message
+	if (!UPubnubChatInternalUtilities::IsPubnubMessageUserUpdate(MessageData.Message))
+	{ return false; }
+	
+	//Check if user was deleted or updated
+	if (UPubnubChatInternalUtilities::IsPubnubMessageDeleteEvent(MessageData.Message))
+	{
+		//Remove this user from repository
+		Chat->ObjectsRepository->RemoveUserData(UserID);
+		
+		//Call OnDeleted delegates
+		OnDeleted.Broadcast();
+		OnDeletedNative.Broadcast();
+	}
+	else
+	{
+		//Adjust this user data based on the update message
+		FPubnubChatUserData ChatUserData = GetUserData();
+		FPubnubUserUpdateData UserUpdateData = UPubnubJsonUtilities::GetUserUpdateDataFromMessageContent(MessageData.Message);
+		UPubnubChatInternalUtilities::UpdateChatUserFromPubnubUserUpdateData(UserUpdateData, ChatUserData);
+					
+		//Update repository with new user data, skip the event if repository already has newer data
+		if (!Chat->ObjectsRepository->UpdateUserData(UserID, ChatUserData, UPubnubChatInternalUtilities::GetObjectsEventServerUpdated(MessageData.Message)))
+		{ return false; }
+					
+		//Call OnUpdated delegates with new user data
+		OnUpdated.Broadcast(UserID, ChatUserData);
+		OnUpdatedNative.Broadcast(UserID, ChatUserData);
+	}
+	
+	return true;
+}
+
 void UPubnubChatUser::InitUser(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString InUserID)
 {
 	PUBNUB_CHAT_RETURN_IF_CONDITION_FAILED(InPubnubClient, TEXT("Can't init User, PubnubClient is invalid"));
@@ -1026,7 +1224,7 @@ FPubnubChatGetRestrictionsResult UPubnubChatUser::GetRestrictions(const int Limi
 	FPubnubMembershipInclude Include;
 	Include.IncludeCustom = true;
 	Include.IncludeTotalCount = true;
-	FPubnubMembershipsResult GetMembershipsResult = PubnubClient->GetMemberships(UserID, Include, Limit, Filter, Sort, Page);
+	FPubnubMembershipsResult GetMembershipsResult = PUBNUB_CHAT_CALL_WITH_RETRY(Chat->RetryPolicy.Get(), PCROT_Read, "GetMemberships", FinalResult.Result, PubnubClient->GetMemberships(UserID, Include, Limit, Filter, Sort, Page));
 	PUBNUB_CHAT_ADD_PUBNUB_RESULT_AND_RETURN_WRAPPER_IF_ERROR(FinalResult, GetMembershipsResult.Result, "GetMemberships");
 	
 	//Convert Custom fields to Restrictions
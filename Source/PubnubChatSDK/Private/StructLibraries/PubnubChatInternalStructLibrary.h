@@ -26,15 +26,16 @@ struct FPubnubChatInternalUser
 	UPROPERTY()
 	FString UserID = "";
 
-	/** Timestamp of last update */
-	UPROPERTY()
-	FDateTime LastUpdated;
-	
-	
-	FPubnubChatInternalUser()
-		: LastUpdated(FDateTime::Now())
-	{
-	}
+	/** Server "updated" timestamp of the stored data, empty if it was never provided by the server. Older server data is not stored over it */
+	UPROPERTY()
+	FString ServerUpdated = "";
+
+	/** Local version of the stored data, taken from a repository-wide monotonic counter on every accepted write. 0 if data was never written */
+	UPROPERTY()
+	int64 Version = 0;
+
+	/** Last active timestamp (timetoken) parsed from UserData.Custom, 0 if not set */
+	int64 LastActiveTimestamp = 0;
 };
 
 /**
@@ -54,15 +55,13 @@ struct FPubnubChatInternalChannel
 	UPROPERTY()
 	FString ChannelID = "";
 
-	/** Timestamp of last update */
+	/** Server "updated" timestamp of the stored data, empty if it was never provided by the server. Older server data is not stored over it */
 	UPROPERTY()
-	FDateTime LastUpdated;
-	
-	
-	FPubnubChatInternalChannel()
-		: LastUpdated(FDateTime::Now())
-	{
-	}
+	FString ServerUpdated = "";
+
+	/** Local version of the stored data, taken from a repository-wide monotonic counter on every accepted write. 0 if data was never written */
+	UPROPERTY()
+	int64 Version = 0;
 };
 
 /**
@@ -78,19 +77,17 @@ struct FPubnubChatInternalMessage
 	UPROPERTY()
 	FPubnubChatMessageData MessageData;
 
-	/** Message's unique identifier */
+	/** Channel of the message, the first part of its composite "[ChannelID].[Timetoken]" identifier */
+	UPROPERTY()
+	FString ChannelID = "";
+
+	/** Timetoken of the message, the second part of its composite identifier */
 	UPROPERTY()
-	FString MessageID = "";
+	int64 Timetoken = 0;
 
-	/** Timestamp of last update */
+	/** Local version of the stored data, taken from a repository-wide monotonic counter on every accepted write. 0 if data was never written */
 	UPROPERTY()
-	FDateTime LastUpdated;
-	
-	
-	FPubnubChatInternalMessage()
-		: LastUpdated(FDateTime::Now())
-	{
-	}
+	int64 Version = 0;
 };
 
 /**
@@ -110,13 +107,191 @@ struct FPubnubChatInternalMembership
 	UPROPERTY()
 	FString MembershipID = "";
 
-	/** Timestamp of last update */
+	/** Server "updated" timestamp of the stored data, empty if it was never provided by the server. Older server data is not stored over it */
+	UPROPERTY()
+	FString ServerUpdated = "";
+
+	/** Local version of the stored data, taken from a repository-wide monotonic counter on every accepted write. 0 if data was never written */
+	UPROPERTY()
+	int64 Version = 0;
+
+	/** Last read message timetoken parsed from MembershipData.Custom, 0 if not set */
+	int64 LastReadMessageTimetoken = 0;
+};
+
+/**
+ * Internal bootstrap snapshot entry of a single membership. Do not use this directly.
+ */
+USTRUCT()
+struct FPubnubChatInternalSnapshotMembership
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString ChannelID = "";
+
+	UPROPERTY()
+	FPubnubChatChannelData ChannelData;
+
+	UPROPERTY()
+	FPubnubChatMembershipData MembershipData;
+
+	/** Unread messages count of the channel, -1 if it was not known */
+	UPROPERTY()
+	int UnreadMessagesCount = -1;
+};
+
+/**
+ * Internal bootstrap snapshot entry of a single message. Do not use this directly.
+ */
+USTRUCT()
+struct FPubnubChatInternalSnapshotMessage
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Timetoken = "";
+
+	UPROPERTY()
+	FPubnubChatMessageData MessageData;
+};
+
+/**
+ * Internal bootstrap data saved locally for warm start of the next InitChat. Do not use this directly.
+ */
+USTRUCT()
+struct FPubnubChatInternalBootstrapSnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int Version = 0;
+
+	UPROPERTY()
+	FString UserID = "";
+
+	UPROPERTY()
+	FPubnubChatUserData UserData;
+
+	UPROPERTY()
+	TArray<FPubnubChatInternalSnapshotMembership> Memberships;
+
+	UPROPERTY()
+	TArray<FPubnubChatInternalSnapshotMessage> LastMessages;
+
+	/** Timetoken of the moment the snapshot was saved */
+	UPROPERTY()
+	FString SavedTimetoken = "";
+};
+
+/**
+ * Internal kind of chat mutation kept in the outbox. Do not use this directly.
+ */
+UENUM()
+enum class EPubnubChatOutboxOperation : uint8
+{
+	PCOO_SendText,
+	PCOO_AddReaction,
+	PCOO_RemoveReaction,
+	PCOO_EditText,
+	PCOO_SetLastReadMessageTimetoken
+};
+
+/**
+ * Internal chat mutation made while the connection was offline. Do not use this directly.
+ * Only fields needed by its Operation are set.
+ */
+USTRUCT()
+struct FPubnubChatInternalOutboxEntry
+{
+	GENERATED_BODY()
+
+	/** Idempotency key of the mutation. Published messages carry it in Meta, so a message sent before a crash is not published again */
+	UPROPERTY()
+	FString EntryID = "";
+
+	UPROPERTY()
+	EPubnubChatOutboxOperation Operation = EPubnubChatOutboxOperation::PCOO_SendText;
+
+	UPROPERTY()
+	FString ChannelID = "";
+
+	/** Parent channel of a thread channel, used for mention events of sent messages */
+	UPROPERTY()
+	FString ParentChannelID = "";
+
+	/** Timetoken of the message that message actions are added to or removed from */
+	UPROPERTY()
+	FString MessageTimetoken = "";
+
+	/** Sent or edited text, or the reaction value */
+	UPROPERTY()
+	FString Text = "";
+
+	/** Timetoken of the reaction that is removed */
+	UPROPERTY()
+	FString ActionTimetoken = "";
+
+	UPROPERTY()
+	FString Meta = "";
+
+	UPROPERTY()
+	bool StoreInHistory = true;
+
+	UPROPERTY()
+	bool SendByPost = false;
+
+	/** Mentioned users of a sent message (UserID to mention text) */
+	UPROPERTY()
+	TMap<FString, FString> MentionedUsers;
+
+	/** Membership data with the new last read message timetoken, used when the membership is no longer in the repository */
+	UPROPERTY()
+	FString MembershipUserID = "";
+
+	UPROPERTY()
+	FPubnubChatMembershipData MembershipData;
+
+	UPROPERTY()
+	bool EmitReceiptEvent = false;
+
+	/** Timetoken of the moment the mutation was queued, from the local clock. Used only for the age of the mutation */
+	UPROPERTY()
+	FString QueuedTimetoken = "";
+
+	/** Number of flush attempts that were started. Mutations that were started can already be applied on the server */
+	int Attempts = 0;
+};
+
+/**
+ * Internal kind of outbox journal record. Do not use this directly.
+ */
+UENUM()
+enum class EPubnubChatOutboxRecordType : uint8
+{
+	PCORT_Queued,
+	PCORT_Started,
+	PCORT_Finished
+};
+
+/**
+ * Internal single line of the outbox journal. Do not use this directly.
+ */
+USTRUCT()
+struct FPubnubChatInternalOutboxRecord
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int Version = 0;
+
+	UPROPERTY()
+	EPubnubChatOutboxRecordType Type = EPubnubChatOutboxRecordType::PCORT_Queued;
+
+	UPROPERTY()
+	FString EntryID = "";
+
+	/** Queued mutation, set only for Queued records */
 	UPROPERTY()
-	FDateTime LastUpdated;
-	
-	
-	FPubnubChatInternalMembership()
-		: LastUpdated(FDateTime::Now())
-	{
-	}
+	FPubnubChatInternalOutboxEntry Entry;
 };
@@ -4,13 +4,47 @@
 #include "StructLibraries/PubnubChatStructLibrary.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "PubnubChatConst.h"
+#include <atomic>
 
+/**
+ * Internal state shared by all copies of FPubnubChatAsyncHandle.
+ */
+struct FPubnubChatAsyncOperationState
+{
+	std::atomic<bool> bCancelled{false};
+	std::atomic<bool> bStarted{false};
+	/** Absolute FPlatformTime::Seconds after which the operation is not started. 0 means no deadline. Set before the operation is queued and never changed */
+	double DeadlineTime = 0.0;
+};
 
 void FPubnubChatConfig::ValidateConfig()
 {
 	TypingTimeout = UKismetMathLibrary::Max(TypingTimeout, Pubnub_Chat_Min_Typing_Indicator_Timeout);
 	TypingTimeoutDifference = UKismetMathLibrary::Max(TypingTimeoutDifference, 0);
 	StoreUserActivityInterval = UKismetMathLibrary::Max(StoreUserActivityInterval, Pubnub_Chat_Min_StoreUserActivityInterval);
+	UserActivityIdleTimeout = UKismetMathLibrary::Max(UserActivityIdleTimeout, 0);
+	ReconnectReplayWindow = UKismetMathLibrary::Max(ReconnectReplayWindow, 0);
+	ReconnectReplayMaxMessages = UKismetMathLibrary::Max(ReconnectReplayMaxMessages, 0);
+	Bootstrap.MembershipsLimit = UKismetMathLibrary::Clamp(Bootstrap.MembershipsLimit, 1, 100);
+	Bootstrap.LastMessagesCount = UKismetMathLibrary::Clamp(Bootstrap.LastMessagesCount, 0, Pubnub_Chat_Max_History_Page_With_Actions);
+	PersistentStore.MaxSizeMB = UKismetMathLibrary::Max(PersistentStore.MaxSizeMB, 1);
+	Dispatch.FrameBudgetMs = UKismetMathLibrary::FMax(Dispatch.FrameBudgetMs, 0.1f);
+	FlowControl.MaxQueuedMessages = UKismetMathLibrary::Max(FlowControl.MaxQueuedMessages, 0);
+	FlowControl.SampleRate = UKismetMathLibrary::Max(FlowControl.SampleRate, 1);
+	SearchIndex.MaxMemoryMB = UKismetMathLibrary::Max(SearchIndex.MaxMemoryMB, 1);
+	Outbox.MaxEntries = UKismetMathLibrary::Max(Outbox.MaxEntries, 1);
+	Outbox.MaxAgeSeconds = UKismetMathLibrary::Max(Outbox.MaxAgeSeconds, 0);
+	Retry.MaxAttempts = UKismetMathLibrary::Max(Retry.MaxAttempts, 1);
+	Retry.BaseDelayMs = UKismetMathLibrary::Max(Retry.BaseDelayMs, 0);
+	Retry.MaxDelayMs = UKismetMathLibrary::Max(Retry.MaxDelayMs, Retry.BaseDelayMs);
+	Retry.ReadDeadlineMs = UKismetMathLibrary::Max(Retry.ReadDeadlineMs, 0);
+	Retry.WriteDeadlineMs = UKismetMathLibrary::Max(Retry.WriteDeadlineMs, 0);
+	Retry.PublishDeadlineMs = UKismetMathLibrary::Max(Retry.PublishDeadlineMs, 0);
+	Retry.CircuitBreakerFailureThreshold = UKismetMathLibrary::Max(Retry.CircuitBreakerFailureThreshold, 0);
+	Retry.CircuitBreakerCooldownMs = UKismetMathLibrary::Max(Retry.CircuitBreakerCooldownMs, 0);
+	AsyncOperationDeadline = UKismetMathLibrary::Max(AsyncOperationDeadline, 0);
+	ReactionToggleDebounce = UKismetMathLibrary::Max(ReactionToggleDebounce, 0);
+	ReadMarkerFlushInterval = UKismetMathLibrary::Max(ReadMarkerFlushInterval, 0);
 }
 
 FPubnubChatOperationResult& FPubnubChatOperationResult::MarkSuccess()
@@ -27,6 +61,13 @@ FPubnubChatOperationResult FPubnubChatOperationResult::CreateError(FString InErr
 	return Result;
 }
 
+FPubnubChatOperationResult FPubnubChatOperationResult::CreateCancelled(FString InErrorMessage)
+{
+	FPubnubChatOperationResult Result = CreateError(InErrorMessage);
+	Result.Cancelled = true;
+	return Result;
+}
+
 FPubnubChatOperationResult FPubnubChatOperationResult::FromSingleStep(const FString& StepName, const FPubnubOperationResult& OperationResult)
 {
 	FPubnubChatOperationResult Result;
@@ -77,6 +118,8 @@ FPubnubChatOperationResult& FPubnubChatOperationResult::Merge(const FPubnubChatO
 	StepResults.Append(OtherResult.StepResults);
 
 	// If the other result had errors, mark overall as error
+	Cancelled |= OtherResult.Cancelled;
+
 	if (OtherResult.Error)
 	{
 		Error = true;
@@ -95,6 +138,70 @@ FPubnubChatOperationResult& FPubnubChatOperationResult::Merge(const FPubnubChatO
 	return *this;
 }
 
+FPubnubChatAsyncHandle FPubnubChatAsyncHandle::Create(float DeadlineSeconds)
+{
+	FPubnubChatAsyncHandle Handle;
+	Handle.State = MakeShared<FPubnubChatAsyncOperationState, ESPMode::ThreadSafe>();
+	Handle.State->DeadlineTime = DeadlineSeconds > 0.0f ? FPlatformTime::Seconds() + DeadlineSeconds : 0.0;
+	return Handle;
+}
+
+bool FPubnubChatAsyncHandle::IsValid() const
+{
+	return State.IsValid();
+}
+
+void FPubnubChatAsyncHandle::Cancel() const
+{
+	if (State.IsValid())
+	{
+		State->bCancelled = true;
+	}
+}
+
+bool FPubnubChatAsyncHandle::IsCancelled() const
+{
+	return State.IsValid() && State->bCancelled;
+}
+
+bool FPubnubChatAsyncHandle::IsExpired() const
+{
+	if (!State.IsValid() || State->bStarted)
+	{
+		return false;
+	}
+	const double DeadlineTime = State->DeadlineTime;
+	return DeadlineTime > 0.0 && FPlatformTime::Seconds() > DeadlineTime;
+}
+
+bool FPubnubChatAsyncHandle::IsStarted() const
+{
+	return State.IsValid() && State->bStarted;
+}
+
+bool FPubnubChatAsyncHandle::TryStart() const
+{
+	if (!State.IsValid())
+	{
+		return true;
+	}
+	if (IsCancelled() || IsExpired())
+	{
+		return false;
+	}
+	State->bStarted = true;
+	return true;
+}
+
+FPubnubChatOperationResult FPubnubChatAsyncHandle::CreateCancelledResult() const
+{
+	if (IsCancelled())
+	{
+		return FPubnubChatOperationResult::CreateCancelled(TEXT("Operation was cancelled."));
+	}
+	return FPubnubChatOperationResult::CreateCancelled(TEXT("Operation deadline passed before it started."));
+}
+
 FPubnubMembershipInputData FPubnubChatMembershipData::ToPubnubMembershipInputData(const FString ChannelID) const
 {
 	FPubnubMembershipInputData MembershipInputData;
@@ -0,0 +1,43 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "StructLibraries/PubnubChatStructLibrary.h"
+#include "PubnubChatAsyncHandleUtilities.generated.h"
+
+
+/**
+ * Blueprint function library for handles returned by *Async functions - cancelling queued operations and checking their state.
+ * Deadline of an operation is passed to the *Async function with its DeadlineSeconds parameter.
+ */
+UCLASS()
+class PUBNUBCHATSDK_API UPubnubChatAsyncHandleUtilities : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+public:
+
+	/**
+	 * Cancels the operation. If it didn't start yet, it's skipped and its callback receives a result with Cancelled set to true.
+	 * If it's already running, its requests are not retried anymore and its remaining reads are not sent.
+	 *
+	 * @param AsyncHandle Handle returned by the *Async function.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Async Handle")
+	static void CancelAsyncOperation(const FPubnubChatAsyncHandle& AsyncHandle);
+
+	/**
+	 * @param AsyncHandle Handle returned by the *Async function.
+	 * @return True if the operation was cancelled with CancelAsyncOperation.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub Chat|Async Handle")
+	static bool IsAsyncOperationCancelled(const FPubnubChatAsyncHandle& AsyncHandle);
+
+	/**
+	 * @param AsyncHandle Handle returned by the *Async function.
+	 * @return True if the operation left the queue and started running. Started operation can't be skipped anymore.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub Chat|Async Handle")
+	static bool IsAsyncOperationStarted(const FPubnubChatAsyncHandle& AsyncHandle);
+};
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/ThreadSafeBool.h"
 #include "StructLibraries/PubnubChatStructLibrary.h"
 #include "StructLibraries/PubnubChatUserStructLibrary.h"
 #include "StructLibraries/PubnubChatChannelStructLibrary.h"
@@ -19,6 +21,18 @@ class UPubnubChatChannel;
 class UPubnubChatMembership;
 class UPubnubChatAccessManager;
 class UPubnubChatObjectsRepository;
+class UPubnubChatUnreadTracker;
+class UPubnubChatReconnectCatchUp;
+class UPubnubChatActivityHeartbeat;
+class UPubnubChatBootstrap;
+class UPubnubChatOutbox;
+class UPubnubChatReactionCoordinator;
+class UPubnubChatReadMarkerWriter;
+class FPubnubChatRetryPolicy;
+class FPubnubChatRequestWorkers;
+class UPubnubChatPersistentStore;
+class UPubnubChatUpdatesStream;
+class UPubnubChatDispatchQueue;
 class UPubnubChatThreadChannel;
 class UPubnubChatThreadMessage;
 enum class EPubnubSubscriptionStatus  : uint8;
@@ -32,6 +46,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnPubnubChatObjectDeleted);
 DECLARE_MULTICAST_DELEGATE(FOnPubnubChatObjectDeletedNative);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPubnubChatConnectionStatusChanged, EPubnubChatConnectionStatus, Status, const FPubnubChatConnectionStatusData&, StatusData);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnPubnubChatConnectionStatusChangedNative, EPubnubChatConnectionStatus Status, const FPubnubChatConnectionStatusData& StatusData);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPubnubChatUnreadMessagesCountChanged, FString, ChannelID, int, Count);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnPubnubChatUnreadMessagesCountChangedNative, const FString& ChannelID, int Count);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPubnubChatBootstrapCompleted, const FPubnubChatBootstrapResult&, BootstrapResult);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPubnubChatBootstrapCompletedNative, const FPubnubChatBootstrapResult& BootstrapResult);
 
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnPubnubChatEventReceived, FPubnubChatEvent, Event);
 DECLARE_DELEGATE_OneParam(FOnPubnubChatEventReceivedNative, const FPubnubChatEvent& Event);
@@ -120,6 +138,14 @@ class PUBNUBCHATSDK_API UPubnubChat : public UObject
 	friend class UPubnubChatMembership;
 	friend class UPubnubChatThreadChannel;
 	friend class UPubnubChatThreadMessage;
+	friend class UPubnubChatUnreadTracker;
+	friend class UPubnubChatReconnectCatchUp;
+	friend class UPubnubChatActivityHeartbeat;
+	friend class UPubnubChatBootstrap;
+	friend class UPubnubChatUpdatesStream;
+	friend class UPubnubChatOutbox;
+	friend class UPubnubChatReactionCoordinator;
+	friend class UPubnubChatReadMarkerWriter;
 	
 public:
 
@@ -156,6 +182,36 @@ public:
 	 */
 	FOnPubnubChatConnectionStatusChangedNative OnConnectionStatusChangedNative;
 
+	/**
+	 * Broadcast when unread messages count of a channel tracked with StartUnreadMessagesTracking changes.
+	 * Always broadcast on the game thread.
+	 * @param ChannelID The channel which count changed.
+	 * @param Count New number of unread messages on this channel.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Pubnub Chat|Delegates")
+	FOnPubnubChatUnreadMessagesCountChanged OnUnreadMessagesCountChanged;
+
+	/**
+	 * Same as OnUnreadMessagesCountChanged; native multicast delegate that accepts lambdas.
+	 * @param ChannelID The channel which count changed.
+	 * @param Count New number of unread messages on this channel.
+	 */
+	FOnPubnubChatUnreadMessagesCountChangedNative OnUnreadMessagesCountChangedNative;
+
+	/**
+	 * Broadcast when fresh bootstrap data is fetched after InitChat returned data from the local snapshot
+	 * (FPubnubChatBootstrapConfig::WarmStartFromSnapshot). Always broadcast on the game thread.
+	 * @param BootstrapResult Fresh current user memberships, their unread messages counts and last messages.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Pubnub Chat|Delegates")
+	FOnPubnubChatBootstrapCompleted OnBootstrapCompleted;
+
+	/**
+	 * Same as OnBootstrapCompleted; native multicast delegate that accepts lambdas.
+	 * @param BootstrapResult Fresh current user memberships, their unread messages counts and last messages.
+	 */
+	FOnPubnubChatBootstrapCompletedNative OnBootstrapCompletedNative;
+
 
 	/*  GENERAL  */
 
@@ -176,6 +232,20 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Pubnub Chat")
 	UPubnubClient* GetPubnubClient() const { return PubnubClient; }
+	
+	/**
+	 * Returns memory held by this chat: entry counts, approximate bytes and reference count histograms of repository data,
+	 * live chat objects per class, active subscriptions and sizes of caches and pending queues.
+	 * Local: does not perform any network requests. Game thread only, as it iterates live objects.
+	 * Use "pubnubchat.dumpstats" in the console to print these stats for all chats.
+	 *
+	 * @return Memory stats of this chat. Empty if chat is not initialized.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Pubnub Chat")
+	FPubnubChatMemoryStats GetMemoryStats() const;
+	
+	/** Prints memory stats of all initialized chats to OutputDevice. Backs the "pubnubchat.dumpstats" console command. */
+	static void DumpMemoryStats(FOutputDevice& OutputDevice);
 
 	
 	/*  USER  */
@@ -189,6 +259,14 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Pubnub Chat|User")
 	UPubnubChatUser* GetCurrentUser() const { return CurrentUser; }
 	
+	/**
+	 * Marks the current user as active. Sending messages does it automatically.
+	 * Local: does not perform any network requests. The activity timestamp is stored later by the activity heartbeat.
+	 * Only matters when StoreUserActivityTimestamps is enabled and UserActivityIdleTimeout is set - timestamps of idle users are not stored.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User")
+	void ReportUserActivity();
+	
 	/**
 	 * Creates a new user on the PubNub server and returns a chat user object.
 	 * Blocking: performs network requests on the calling thread.
@@ -210,9 +288,11 @@ public:
 	 * @param UserID Unique identifier for the user to create.
 	 * @param OnUserResponse Callback executed when the operation completes.
 	 * @param UserData Initial user metadata (name, external ID, profile URL, email, custom JSON, status, type).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User")
-	void CreateUserAsync(const FString UserID, FOnPubnubChatUserResponse OnUserResponse, FPubnubChatUserData UserData = FPubnubChatUserData());
+	FPubnubChatAsyncHandle CreateUserAsync(const FString UserID, FOnPubnubChatUserResponse OnUserResponse, FPubnubChatUserData UserData = FPubnubChatUserData(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Creates a new user asynchronously on the PubNub server and returns a chat user object.
 	 * Fails if a user with the same ID already exists (use GetUser instead).
@@ -221,8 +301,10 @@ public:
 	 * @param UserID Unique identifier for the user to create.
 	 * @param OnUserResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param UserData Initial user metadata (name, external ID, profile URL, email, custom JSON, status, type).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void CreateUserAsync(const FString UserID, FOnPubnubChatUserResponseNative OnUserResponseNative, FPubnubChatUserData UserData = FPubnubChatUserData());
+	FPubnubChatAsyncHandle CreateUserAsync(const FString UserID, FOnPubnubChatUserResponseNative OnUserResponseNative, FPubnubChatUserData UserData = FPubnubChatUserData(), float DeadlineSeconds = -1.0f);
 	
 	
 	/**
@@ -240,16 +322,31 @@ public:
 	 * 
 	 * @param UserID Unique identifier of the user to fetch.
 	 * @param OnUserResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User")
-	void GetUserAsync(const FString UserID, FOnPubnubChatUserResponse OnUserResponse);
+	FPubnubChatAsyncHandle GetUserAsync(const FString UserID, FOnPubnubChatUserResponse OnUserResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Retrieves a user asynchronously from the PubNub server and returns a chat user object.
 	 * 
 	 * @param UserID Unique identifier of the user to fetch.
 	 * @param OnUserResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
+	 */
+	FPubnubChatAsyncHandle GetUserAsync(const FString UserID, FOnPubnubChatUserResponseNative OnUserResponseNative, float DeadlineSeconds = -1.0f);
+	
+	/**
+	 * Returns a chat user object with data saved in the persistent store, also by previous sessions.
+	 * Local: does not perform any network requests. Data may be stale - use GetUser to get the current data.
+	 * Requires FPubnubChatConfig::PersistentStore to be enabled.
+	 *
+	 * @param UserID Unique identifier of the user.
+	 * @return Operation result and user object. User is null if it isn't in the persistent store.
 	 */
-	void GetUserAsync(const FString UserID, FOnPubnubChatUserResponseNative OnUserResponseNative);
+	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User")
+	FPubnubChatUserResult GetCachedUser(const FString UserID);
 
 	/**
 	 * Retrieves users from the PubNub server.
@@ -274,9 +371,11 @@ public:
 	 * @param Sort Key-value pair of a property to sort by, and a sort direction.
 	 * @param Page Pagination information. Use Page.Next to get the next page or Page.Prev to get the previous page.
 	 *             If both are provided, Next takes precedence.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User")
-	void GetUsersAsync(FOnPubnubChatGetUsersResponse OnUsersResponse, const int Limit = 0, const FString Filter = "", FPubnubGetAllSort Sort = FPubnubGetAllSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle GetUsersAsync(FOnPubnubChatGetUsersResponse OnUsersResponse, const int Limit = 0, const FString Filter = "", FPubnubGetAllSort Sort = FPubnubGetAllSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Retrieves users asynchronously from the PubNub server.
 	 * 
@@ -286,8 +385,10 @@ public:
 	 * @param Sort Key-value pair of a property to sort by, and a sort direction.
 	 * @param Page Pagination information. Use Page.Next to get the next page or Page.Prev to get the previous page.
 	 *             If both are provided, Next takes precedence.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetUsersAsync(FOnPubnubChatGetUsersResponseNative OnUsersResponseNative, const int Limit = 0, const FString Filter = "", FPubnubGetAllSort Sort = FPubnubGetAllSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle GetUsersAsync(FOnPubnubChatGetUsersResponseNative OnUsersResponseNative, const int Limit = 0, const FString Filter = "", FPubnubGetAllSort Sort = FPubnubGetAllSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Updates a user's metadata on the PubNub server and returns the updated user.
@@ -308,9 +409,11 @@ public:
 	 * @param UserID Unique identifier of the user to update.
 	 * @param UpdateUserData Fields to update and ForceSet flags to control replacements.
 	 * @param OnUserResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User")
-	void UpdateUserAsync(const FString UserID, FPubnubChatUpdateUserInputData UpdateUserData, FOnPubnubChatUserResponse OnUserResponse);
+	FPubnubChatAsyncHandle UpdateUserAsync(const FString UserID, FPubnubChatUpdateUserInputData UpdateUserData, FOnPubnubChatUserResponse OnUserResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Updates a user's metadata asynchronously on the PubNub server and returns the updated user.
 	 * Fails if the user does not exist.
@@ -318,8 +421,10 @@ public:
 	 * @param UserID Unique identifier of the user to update.
 	 * @param UpdateUserData Fields to update and ForceSet flags to control replacements.
 	 * @param OnUserResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void UpdateUserAsync(const FString UserID, FPubnubChatUpdateUserInputData UpdateUserData, FOnPubnubChatUserResponseNative OnUserResponseNative = nullptr);
+	FPubnubChatAsyncHandle UpdateUserAsync(const FString UserID, FPubnubChatUpdateUserInputData UpdateUserData, FOnPubnubChatUserResponseNative OnUserResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Deletes a user on the server.
@@ -336,16 +441,20 @@ public:
 	 * 
 	 * @param UserID Unique identifier of the user to delete.
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void DeleteUserAsync(const FString UserID, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle DeleteUserAsync(const FString UserID, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Deletes a user asynchronously on the server.
 	 * 
 	 * @param UserID Unique identifier of the user to delete.
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void DeleteUserAsync(const FString UserID, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle DeleteUserAsync(const FString UserID, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Returns users whose name starts with the provided text.
@@ -364,17 +473,21 @@ public:
 	 * @param Text Prefix text to match against the user name field (uses a name LIKE "Text*" filter).
 	 * @param OnSuggestionsResponse Callback executed when the operation completes.
 	 * @param Limit Max number of users to return.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User")
-	void GetUserSuggestionsAsync(const FString Text, FOnPubnubChatGetUserSuggestionsResponse OnSuggestionsResponse, int Limit = 10);
+	FPubnubChatAsyncHandle GetUserSuggestionsAsync(const FString Text, FOnPubnubChatGetUserSuggestionsResponse OnSuggestionsResponse, int Limit = 10, float DeadlineSeconds = -1.0f);
 	/**
 	 * Returns users asynchronously whose name starts with the provided text.
 	 * 
 	 * @param Text Prefix text to match against the user name field (uses a name LIKE "Text*" filter).
 	 * @param OnSuggestionsResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param Limit Max number of users to return.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetUserSuggestionsAsync(const FString Text, FOnPubnubChatGetUserSuggestionsResponseNative OnSuggestionsResponseNative, int Limit = 10);
+	FPubnubChatAsyncHandle GetUserSuggestionsAsync(const FString Text, FOnPubnubChatGetUserSuggestionsResponseNative OnSuggestionsResponseNative, int Limit = 10, float DeadlineSeconds = -1.0f);
 
 	
 	/*  CHANNEL  */
@@ -398,9 +511,11 @@ public:
 	 * @param ChannelID Unique identifier for the channel to create.
 	 * @param OnChannelResponse Callback executed when the operation completes.
 	 * @param ChannelData Initial channel metadata (name, description, custom JSON, status, type, etc.).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void CreatePublicConversationAsync(const FString ChannelID, FOnPubnubChatChannelResponse OnChannelResponse, FPubnubChatChannelData ChannelData = FPubnubChatChannelData());
+	FPubnubChatAsyncHandle CreatePublicConversationAsync(const FString ChannelID, FOnPubnubChatChannelResponse OnChannelResponse, FPubnubChatChannelData ChannelData = FPubnubChatChannelData(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Creates a public channel asynchronously on the PubNub server and returns a chat channel object.
 	 * Always sets the channel type to "public" regardless of ChannelData.Type.
@@ -408,13 +523,17 @@ public:
 	 * @param ChannelID Unique identifier for the channel to create.
 	 * @param OnChannelResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param ChannelData Initial channel metadata (name, description, custom JSON, status, type, etc.).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void CreatePublicConversationAsync(const FString ChannelID, FOnPubnubChatChannelResponseNative OnChannelResponseNative, FPubnubChatChannelData ChannelData = FPubnubChatChannelData());
+	FPubnubChatAsyncHandle CreatePublicConversationAsync(const FString ChannelID, FOnPubnubChatChannelResponseNative OnChannelResponseNative, FPubnubChatChannelData ChannelData = FPubnubChatChannelData(), float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Creates a group channel, adds the current user as host, and invites provided users.
 	 * Blocking: performs network requests on the calling thread.
 	 * Always sets the channel type to "group" regardless of ChannelData.Type.
+	 * Host and all invitees are written with a single members request (per 100 users) and invite events are emitted concurrently.
+	 * Can be called again with the same ChannelID after a partial failure - users that are already members keep their membership.
 	 *
 	 * @param Users Users to invite. At least one valid user is required.
 	 * @param ChannelID Optional channel ID. If empty, a GUID is generated.
@@ -434,9 +553,11 @@ public:
 	 * @param ChannelID Optional channel ID. If empty, a GUID is generated.
 	 * @param ChannelData Initial channel metadata (name, description, custom JSON, status, type, etc.).
 	 * @param HostMembershipData Membership metadata for the current user in the new channel.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void CreateGroupConversationAsync(TArray<UPubnubChatUser*> Users, FOnPubnubChatCreateGroupConversationResponse OnGroupConversationResponse, const FString ChannelID = "", FPubnubChatChannelData ChannelData = FPubnubChatChannelData(), FPubnubChatMembershipData HostMembershipData = FPubnubChatMembershipData());
+	FPubnubChatAsyncHandle CreateGroupConversationAsync(TArray<UPubnubChatUser*> Users, FOnPubnubChatCreateGroupConversationResponse OnGroupConversationResponse, const FString ChannelID = "", FPubnubChatChannelData ChannelData = FPubnubChatChannelData(), FPubnubChatMembershipData HostMembershipData = FPubnubChatMembershipData(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Creates a group channel asynchronously, adds the current user as host, and invites provided users.
 	 * Always sets the channel type to "group" regardless of ChannelData.Type.
@@ -446,13 +567,16 @@ public:
 	 * @param ChannelID Optional channel ID. If empty, a GUID is generated.
 	 * @param ChannelData Initial channel metadata (name, description, custom JSON, status, type, etc.).
 	 * @param HostMembershipData Membership metadata for the current user in the new channel.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void CreateGroupConversationAsync(TArray<UPubnubChatUser*> Users, FOnPubnubChatCreateGroupConversationResponseNative OnGroupConversationResponseNative, const FString ChannelID = "", FPubnubChatChannelData ChannelData = FPubnubChatChannelData(), FPubnubChatMembershipData HostMembershipData = FPubnubChatMembershipData());
+	FPubnubChatAsyncHandle CreateGroupConversationAsync(TArray<UPubnubChatUser*> Users, FOnPubnubChatCreateGroupConversationResponseNative OnGroupConversationResponseNative, const FString ChannelID = "", FPubnubChatChannelData ChannelData = FPubnubChatChannelData(), FPubnubChatMembershipData HostMembershipData = FPubnubChatMembershipData(), float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Creates a direct channel with a single user, adds the current user as host, and invites the provided user.
 	 * Blocking: performs network requests on the calling thread.
 	 * Always sets the channel type to "direct" regardless of ChannelData.Type.
+	 * Host and invitee are written with a single members request. If the user is already a member, the membership is kept.
 	 *
 	 * @param User User to invite. Must be valid.
 	 * @param ChannelID Optional channel ID. If empty, a deterministic ID is generated from both user IDs.
@@ -472,9 +596,11 @@ public:
 	 * @param ChannelID Optional channel ID. If empty, a deterministic ID is generated from both user IDs.
 	 * @param ChannelData Initial channel metadata (name, description, custom JSON, status, type, etc.).
 	 * @param HostMembershipData Membership metadata for the current user in the new channel.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void CreateDirectConversationAsync(UPubnubChatUser* User, FOnPubnubChatCreateDirectConversationResponse OnDirectConversationResponse, const FString ChannelID = "", FPubnubChatChannelData ChannelData = FPubnubChatChannelData(), FPubnubChatMembershipData HostMembershipData = FPubnubChatMembershipData());
+	FPubnubChatAsyncHandle CreateDirectConversationAsync(UPubnubChatUser* User, FOnPubnubChatCreateDirectConversationResponse OnDirectConversationResponse, const FString ChannelID = "", FPubnubChatChannelData ChannelData = FPubnubChatChannelData(), FPubnubChatMembershipData HostMembershipData = FPubnubChatMembershipData(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Creates a direct channel asynchronously with a single user, adds the current user as host, and invites the provided user.
 	 * Always sets the channel type to "direct" regardless of ChannelData.Type.
@@ -484,8 +610,10 @@ public:
 	 * @param ChannelID Optional channel ID. If empty, a deterministic ID is generated from both user IDs.
 	 * @param ChannelData Initial channel metadata (name, description, custom JSON, status, type, etc.).
 	 * @param HostMembershipData Membership metadata for the current user in the new channel.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void CreateDirectConversationAsync(UPubnubChatUser* User, FOnPubnubChatCreateDirectConversationResponseNative OnDirectConversationResponseNative, const FString ChannelID = "", FPubnubChatChannelData ChannelData = FPubnubChatChannelData(), FPubnubChatMembershipData HostMembershipData = FPubnubChatMembershipData());
+	FPubnubChatAsyncHandle CreateDirectConversationAsync(UPubnubChatUser* User, FOnPubnubChatCreateDirectConversationResponseNative OnDirectConversationResponseNative, const FString ChannelID = "", FPubnubChatChannelData ChannelData = FPubnubChatChannelData(), FPubnubChatMembershipData HostMembershipData = FPubnubChatMembershipData(), float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Retrieves a channel from the PubNub server and returns a chat channel object.
@@ -502,16 +630,31 @@ public:
 	 *
 	 * @param ChannelID Unique identifier of the channel to fetch.
 	 * @param OnChannelResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void GetChannelAsync(const FString ChannelID, FOnPubnubChatChannelResponse OnChannelResponse);
+	FPubnubChatAsyncHandle GetChannelAsync(const FString ChannelID, FOnPubnubChatChannelResponse OnChannelResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Retrieves a channel asynchronously from the PubNub server and returns a chat channel object.
 	 *
 	 * @param ChannelID Unique identifier of the channel to fetch.
 	 * @param OnChannelResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetChannelAsync(const FString ChannelID, FOnPubnubChatChannelResponseNative OnChannelResponseNative);
+	FPubnubChatAsyncHandle GetChannelAsync(const FString ChannelID, FOnPubnubChatChannelResponseNative OnChannelResponseNative, float DeadlineSeconds = -1.0f);
+	
+	/**
+	 * Returns a chat channel object with data saved in the persistent store, also by previous sessions.
+	 * Local: does not perform any network requests. Data may be stale - use GetChannel to get the current data.
+	 * Requires FPubnubChatConfig::PersistentStore to be enabled.
+	 *
+	 * @param ChannelID Unique identifier of the channel.
+	 * @return Operation result and channel object. Channel is null if it isn't in the persistent store.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
+	FPubnubChatChannelResult GetCachedChannel(const FString ChannelID);
 
 	/**
 	 * Retrieves channels from the PubNub server.
@@ -536,9 +679,11 @@ public:
 	 * @param Sort Key-value pair of a property to sort by, and a sort direction.
 	 * @param Page Pagination information. Use Page.Next to get the next page or Page.Prev to get the previous page.
 	 *             If both are provided, Next takes precedence.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void GetChannelsAsync(FOnPubnubChatGetChannelsResponse OnChannelsResponse, const int Limit = 0, const FString Filter = "", FPubnubGetAllSort Sort = FPubnubGetAllSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle GetChannelsAsync(FOnPubnubChatGetChannelsResponse OnChannelsResponse, const int Limit = 0, const FString Filter = "", FPubnubGetAllSort Sort = FPubnubGetAllSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Retrieves channels asynchronously from the PubNub server.
 	 *
@@ -548,8 +693,10 @@ public:
 	 * @param Sort Key-value pair of a property to sort by, and a sort direction.
 	 * @param Page Pagination information. Use Page.Next to get the next page or Page.Prev to get the previous page.
 	 *             If both are provided, Next takes precedence.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetChannelsAsync(FOnPubnubChatGetChannelsResponseNative OnChannelsResponseNative, const int Limit = 0, const FString Filter = "", FPubnubGetAllSort Sort = FPubnubGetAllSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle GetChannelsAsync(FOnPubnubChatGetChannelsResponseNative OnChannelsResponseNative, const int Limit = 0, const FString Filter = "", FPubnubGetAllSort Sort = FPubnubGetAllSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Updates a channel's metadata on the PubNub server and returns the updated channel.
@@ -570,9 +717,11 @@ public:
 	 * @param ChannelID Unique identifier of the channel to update.
 	 * @param UpdateChannelData Fields to update and ForceSet flags to control replacements.
 	 * @param OnChannelResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void UpdateChannelAsync(const FString ChannelID, FPubnubChatUpdateChannelInputData UpdateChannelData, FOnPubnubChatChannelResponse OnChannelResponse);
+	FPubnubChatAsyncHandle UpdateChannelAsync(const FString ChannelID, FPubnubChatUpdateChannelInputData UpdateChannelData, FOnPubnubChatChannelResponse OnChannelResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Updates a channel's metadata asynchronously on the PubNub server and returns the updated channel.
 	 * Fails if the channel does not exist.
@@ -580,8 +729,10 @@ public:
 	 * @param ChannelID Unique identifier of the channel to update.
 	 * @param UpdateChannelData Fields to update and ForceSet flags to control replacements.
 	 * @param OnChannelResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void UpdateChannelAsync(const FString ChannelID, FPubnubChatUpdateChannelInputData UpdateChannelData, FOnPubnubChatChannelResponseNative OnChannelResponseNative);
+	FPubnubChatAsyncHandle UpdateChannelAsync(const FString ChannelID, FPubnubChatUpdateChannelInputData UpdateChannelData, FOnPubnubChatChannelResponseNative OnChannelResponseNative, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Deletes a channel on the server.
@@ -598,16 +749,20 @@ public:
 	 *
 	 * @param ChannelID Unique identifier of the channel to delete.
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void DeleteChannelAsync(const FString ChannelID, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle DeleteChannelAsync(const FString ChannelID, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Deletes a channel asynchronously on the server.
 	 *
 	 * @param ChannelID Unique identifier of the channel to delete.
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void DeleteChannelAsync(const FString ChannelID, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle DeleteChannelAsync(const FString ChannelID, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Pins a message to a channel.
@@ -626,17 +781,21 @@ public:
 	 * @param Message Message to pin.
 	 * @param Channel Channel to pin the message to.
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void PinMessageToChannelAsync(UPubnubChatMessage* Message, UPubnubChatChannel* Channel, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle PinMessageToChannelAsync(UPubnubChatMessage* Message, UPubnubChatChannel* Channel, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Pins a message to a channel asynchronously.
 	 *
 	 * @param Message Message to pin.
 	 * @param Channel Channel to pin the message to.
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void PinMessageToChannelAsync(UPubnubChatMessage* Message, UPubnubChatChannel* Channel, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle PinMessageToChannelAsync(UPubnubChatMessage* Message, UPubnubChatChannel* Channel, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Unpins the currently pinned message from a channel.
@@ -653,16 +812,20 @@ public:
 	 *
 	 * @param Channel Channel to unpin the message from.
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void UnpinMessageFromChannelAsync(UPubnubChatChannel* Channel, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle UnpinMessageFromChannelAsync(UPubnubChatChannel* Channel, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Unpins the currently pinned message from a channel asynchronously.
 	 *
 	 * @param Channel Channel to unpin the message from.
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void UnpinMessageFromChannelAsync(UPubnubChatChannel* Channel, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle UnpinMessageFromChannelAsync(UPubnubChatChannel* Channel, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Returns channels whose name starts with the provided text.
@@ -681,17 +844,21 @@ public:
 	 * @param Text Prefix text to match against the channel name field (uses a name LIKE "Text*" filter).
 	 * @param OnSuggestionsResponse Callback executed when the operation completes.
 	 * @param Limit Max number of channels to return.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void GetChannelSuggestionsAsync(const FString Text, FOnPubnubChatGetChannelSuggestionsResponse OnSuggestionsResponse, int Limit = 10);
+	FPubnubChatAsyncHandle GetChannelSuggestionsAsync(const FString Text, FOnPubnubChatGetChannelSuggestionsResponse OnSuggestionsResponse, int Limit = 10, float DeadlineSeconds = -1.0f);
 	/**
 	 * Returns channels asynchronously whose name starts with the provided text.
 	 *
 	 * @param Text Prefix text to match against the channel name field (uses a name LIKE "Text*" filter).
 	 * @param OnSuggestionsResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param Limit Max number of channels to return.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetChannelSuggestionsAsync(const FString Text, FOnPubnubChatGetChannelSuggestionsResponseNative OnSuggestionsResponseNative, int Limit = 10);
+	FPubnubChatAsyncHandle GetChannelSuggestionsAsync(const FString Text, FOnPubnubChatGetChannelSuggestionsResponseNative OnSuggestionsResponseNative, int Limit = 10, float DeadlineSeconds = -1.0f);
 
 	
 	/* PRESENCE */
@@ -713,17 +880,21 @@ public:
 	 *
 	 * @param UserID Unique identifier of the user to query.
 	 * @param OnWherePresentResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Presence")
-	void WherePresentAsync(const FString UserID, FOnPubnubChatWherePresentResponse OnWherePresentResponse);
+	FPubnubChatAsyncHandle WherePresentAsync(const FString UserID, FOnPubnubChatWherePresentResponse OnWherePresentResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Lists channels asynchronously the specified user is actively subscribed to.
 	 * Presence is based on active subscriptions (messages, events, or updates), not memberships.
 	 *
 	 * @param UserID Unique identifier of the user to query.
 	 * @param OnWherePresentResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void WherePresentAsync(const FString UserID, FOnPubnubChatWherePresentResponseNative OnWherePresentResponseNative);
+	FPubnubChatAsyncHandle WherePresentAsync(const FString UserID, FOnPubnubChatWherePresentResponseNative OnWherePresentResponseNative, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Lists users currently present on a channel.
@@ -746,9 +917,11 @@ public:
 	 * @param OnWhoIsPresentResponse Callback executed when the operation completes.
 	 * @param Limit Max number of users to return.
 	 * @param Offset Number of users to skip for pagination.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Presence")
-	void WhoIsPresentAsync(const FString ChannelID, FOnPubnubChatWhoIsPresentResponse OnWhoIsPresentResponse, int Limit = 1000, int Offset = 0);
+	FPubnubChatAsyncHandle WhoIsPresentAsync(const FString ChannelID, FOnPubnubChatWhoIsPresentResponse OnWhoIsPresentResponse, int Limit = 1000, int Offset = 0, float DeadlineSeconds = -1.0f);
 	/**
 	 * Lists users asynchronously currently present on a channel.
 	 * Presence reflects active subscriptions (messages, events, or updates), not channel membership.
@@ -757,8 +930,10 @@ public:
 	 * @param OnWhoIsPresentResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param Limit Max number of users to return.
 	 * @param Offset Number of users to skip for pagination.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void WhoIsPresentAsync(const FString ChannelID, FOnPubnubChatWhoIsPresentResponseNative OnWhoIsPresentResponseNative, int Limit = 1000, int Offset = 0);
+	FPubnubChatAsyncHandle WhoIsPresentAsync(const FString ChannelID, FOnPubnubChatWhoIsPresentResponseNative OnWhoIsPresentResponseNative, int Limit = 1000, int Offset = 0, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Checks if a user is present on a channel.
@@ -779,9 +954,11 @@ public:
 	 * @param UserID Unique identifier of the user to check.
 	 * @param ChannelID Unique identifier of the channel to check.
 	 * @param OnIsPresentResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Presence")
-	void IsPresentAsync(const FString UserID, const FString ChannelID, FOnPubnubChatIsPresentResponse OnIsPresentResponse);
+	FPubnubChatAsyncHandle IsPresentAsync(const FString UserID, const FString ChannelID, FOnPubnubChatIsPresentResponse OnIsPresentResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Checks asynchronously if a user is present on a channel.
 	 * Presence reflects active subscriptions (messages, events, or updates), not channel membership.
@@ -789,8 +966,10 @@ public:
 	 * @param UserID Unique identifier of the user to check.
 	 * @param ChannelID Unique identifier of the channel to check.
 	 * @param OnIsPresentResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void IsPresentAsync(const FString UserID, const FString ChannelID, FOnPubnubChatIsPresentResponseNative OnIsPresentResponseNative);
+	FPubnubChatAsyncHandle IsPresentAsync(const FString UserID, const FString ChannelID, FOnPubnubChatIsPresentResponseNative OnIsPresentResponseNative, float DeadlineSeconds = -1.0f);
 
 
 	/* MODERATION */
@@ -810,16 +989,53 @@ public:
 	 *
 	 * @param Restriction Restriction settings (UserID, ChannelID, Ban/Mute flags, Reason).
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Moderation", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void SetRestrictionsAsync(FPubnubChatRestriction Restriction, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle SetRestrictionsAsync(FPubnubChatRestriction Restriction, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Sets or lifts moderation restrictions asynchronously for a user on a channel.
 	 *
 	 * @param Restriction Restriction settings (UserID, ChannelID, Ban/Mute flags, Reason).
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
+	 */
+	FPubnubChatAsyncHandle SetRestrictionsAsync(FPubnubChatRestriction Restriction, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
+	
+	/**
+	 * Sets or lifts many moderation restrictions at once (for example banning a user on multiple channels).
+	 * Restrictions are grouped by channel, so every channel needs at most one SetChannelMembers and one RemoveChannelMembers request.
+	 * If the same user is listed more than once for a channel, the last entry is used.
+	 * Moderation events for applied restrictions are emitted concurrently after the membership requests.
+	 * Blocking: performs network requests on the calling thread.
+	 *
+	 * @param Restrictions Restriction settings (UserID, ChannelID, Ban/Mute flags, Reason) to apply.
+	 * @return Operation result.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Moderation")
+	FPubnubChatOperationResult SetRestrictionsBulk(const TArray<FPubnubChatRestriction>& Restrictions);
+
+	/**
+	 * Sets or lifts many moderation restrictions at once asynchronously.
+	 *
+	 * @param Restrictions Restriction settings (UserID, ChannelID, Ban/Mute flags, Reason) to apply.
+	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Moderation", meta = (AutoCreateRefTerm = "OnOperationResponse"))
+	FPubnubChatAsyncHandle SetRestrictionsBulkAsync(const TArray<FPubnubChatRestriction>& Restrictions, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
+	/**
+	 * Sets or lifts many moderation restrictions at once asynchronously.
+	 *
+	 * @param Restrictions Restriction settings (UserID, ChannelID, Ban/Mute flags, Reason) to apply.
+	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void SetRestrictionsAsync(FPubnubChatRestriction Restriction, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle SetRestrictionsBulkAsync(const TArray<FPubnubChatRestriction>& Restrictions, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Fetches chat events history for a channel within a timetoken range.
@@ -844,9 +1060,11 @@ public:
 	 * @param EndTimetoken End timetoken (inclusive) for the history range. Must be lower (older) than StartTimetoken.
 	 * @param OnEventsResponse Callback executed when the operation completes.
 	 * @param Count Maximum number of events to return.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Moderation")
-	void GetEventsHistoryAsync(const FString ChannelID, const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatEventsResponse OnEventsResponse, int Count = 100);
+	FPubnubChatAsyncHandle GetEventsHistoryAsync(const FString ChannelID, const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatEventsResponse OnEventsResponse, int Count = 100, float DeadlineSeconds = -1.0f);
 	/**
 	 * Fetches chat events history asynchronously for a channel within a timetoken range.
 	 * StartTimetoken must be higher (newer) than EndTimetoken.
@@ -856,8 +1074,10 @@ public:
 	 * @param EndTimetoken End timetoken (inclusive) for the history range. Must be lower (older) than StartTimetoken.
 	 * @param OnEventsResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param Count Maximum number of events to return.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetEventsHistoryAsync(const FString ChannelID, const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatEventsResponseNative OnEventsResponseNative, int Count = 100);
+	FPubnubChatAsyncHandle GetEventsHistoryAsync(const FString ChannelID, const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatEventsResponseNative OnEventsResponseNative, int Count = 100, float DeadlineSeconds = -1.0f);
 	
 	
 	/* MESSAGES */
@@ -881,9 +1101,11 @@ public:
 	 * @param Message Message to forward.
 	 * @param Channel Channel to forward the message to (must be different from the message's channel).
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Messages", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void ForwardMessageAsync(UPubnubChatMessage* Message, UPubnubChatChannel* Channel, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle ForwardMessageAsync(UPubnubChatMessage* Message, UPubnubChatChannel* Channel, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Forwards a message asynchronously to another channel by publishing it to the target channel with forwarding metadata.
 	 * Fails if the target channel is the same as the message's channel.
@@ -891,8 +1113,63 @@ public:
 	 * @param Message Message to forward.
 	 * @param Channel Channel to forward the message to (must be different from the message's channel).
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
+	 */
+	FPubnubChatAsyncHandle ForwardMessageAsync(UPubnubChatMessage* Message, UPubnubChatChannel* Channel, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
+
+	/**
+	 * Permanently deletes multiple messages from the server (hard delete), together with their threads.
+	 * Blocking: performs network requests on the calling thread.
+	 * Messages are grouped by channel into delete ranges that end only where a message that is kept lies in between, found by fetching history of the channel first.
+	 * Channels and removal of thread channels are processed concurrently.
+	 * Invalid messages are skipped.
+	 *
+	 * @param Messages Messages to delete.
+	 * @return Operation result with a step for every performed request.
 	 */
-	void ForwardMessageAsync(UPubnubChatMessage* Message, UPubnubChatChannel* Channel, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Messages")
+	FPubnubChatOperationResult DeleteMessages(const TArray<UPubnubChatMessage*>& Messages);
+
+	/**
+	 * Permanently deletes multiple messages asynchronously from the server (hard delete), together with their threads.
+	 * Messages are grouped by channel into delete ranges that end only where a message that is kept lies in between, found by fetching history of the channel first.
+	 * Channels and removal of thread channels are processed concurrently.
+	 * Invalid messages are skipped.
+	 *
+	 * @param Messages Messages to delete.
+	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Messages", meta = (AutoCreateRefTerm = "OnOperationResponse"))
+	FPubnubChatAsyncHandle DeleteMessagesAsync(const TArray<UPubnubChatMessage*>& Messages, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
+	/**
+	 * Permanently deletes multiple messages asynchronously from the server (hard delete), together with their threads.
+	 * Messages are grouped by channel into delete ranges that end only where a message that is kept lies in between, found by fetching history of the channel first.
+	 * Channels and removal of thread channels are processed concurrently.
+	 * Invalid messages are skipped.
+	 *
+	 * @param Messages Messages to delete.
+	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
+	 */
+	FPubnubChatAsyncHandle DeleteMessagesAsync(const TArray<UPubnubChatMessage*>& Messages, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
+
+	/**
+	 * Finds messages known to the chat whose current text contains all words of the query.
+	 * Local: does not perform any network requests. Only messages received, fetched or edited since InitChat are indexed.
+	 * Requires FPubnubChatConfig::SearchIndex to be enabled.
+	 * Words are matched case-insensitively by prefix, so "hel wor" finds "Hello World". Soft deleted messages are not returned.
+	 *
+	 * @param Query Words to find.
+	 * @param ChannelFilter If not empty, only messages of the channel with this ID are returned.
+	 * @param Limit Maximum number of returned messages. Between 1 and 100.
+	 * @return Operation result and found messages, newest first.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Messages")
+	FPubnubChatSearchMessagesResult SearchMessages(const FString Query, const FString ChannelFilter = "", const int Limit = 25);
 
 	/**
 	 * Returns unread message counts per channel for the current user's memberships.
@@ -919,9 +1196,11 @@ public:
 	 * @param Sort Key-value pair of a property to sort by, and a sort direction.
 	 * @param Page Pagination information. Use Page.Next to get the next page or Page.Prev to get the previous page.
 	 *             If both are provided, Next takes precedence.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Messages")
-	void GetUnreadMessagesCountsAsync(FOnPubnubChatGetUnreadMessagesCountsResponse OnUnreadMessagesCountsResponse, const int Limit = 0, const FString Filter = "", FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle GetUnreadMessagesCountsAsync(FOnPubnubChatGetUnreadMessagesCountsResponse OnUnreadMessagesCountsResponse, const int Limit = 0, const FString Filter = "", FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Returns unread message counts asynchronously per channel for the current user's memberships.
 	 * Counts are based on last-read-message timetokens stored on each membership.
@@ -932,8 +1211,10 @@ public:
 	 * @param Sort Key-value pair of a property to sort by, and a sort direction.
 	 * @param Page Pagination information. Use Page.Next to get the next page or Page.Prev to get the previous page.
 	 *             If both are provided, Next takes precedence.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetUnreadMessagesCountsAsync(FOnPubnubChatGetUnreadMessagesCountsResponseNative OnUnreadMessagesCountsResponseNative, const int Limit = 0, const FString Filter = "", FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle GetUnreadMessagesCountsAsync(FOnPubnubChatGetUnreadMessagesCountsResponseNative OnUnreadMessagesCountsResponseNative, const int Limit = 0, const FString Filter = "", FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Marks all messages as read for the current user's memberships in the given range.
@@ -960,9 +1241,11 @@ public:
 	 * @param Sort Key-value pair of a property to sort by, and a sort direction.
 	 * @param Page Pagination information. Use Page.Next to get the next page or Page.Prev to get the previous page.
 	 *             If both are provided, Next takes precedence.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Messages")
-	void MarkAllMessagesAsReadAsync(FOnPubnubChatMarkAllMessagesAsReadResponse OnMarkAllMessagesAsReadResponse, const int Limit = 0, const FString Filter = "", FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle MarkAllMessagesAsReadAsync(FOnPubnubChatMarkAllMessagesAsReadResponse OnMarkAllMessagesAsReadResponse, const int Limit = 0, const FString Filter = "", FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Marks all messages as read asynchronously for the current user's memberships in the given range.
 	 * Updates last-read-message timetoken on each membership and emits receipt events on non-public channels.
@@ -973,8 +1256,75 @@ public:
 	 * @param Sort Key-value pair of a property to sort by, and a sort direction.
 	 * @param Page Pagination information. Use Page.Next to get the next page or Page.Prev to get the previous page.
 	 *             If both are provided, Next takes precedence.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
+	 */
+	FPubnubChatAsyncHandle MarkAllMessagesAsReadAsync(FOnPubnubChatMarkAllMessagesAsReadResponseNative OnMarkAllMessagesAsReadResponseNative, const int Limit = 0, const FString Filter = "", FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
+
+	/**
+	 * Starts keeping unread message counts of the current user's memberships up to date without polling.
+	 * Blocking: performs network requests on the calling thread.
+	 * Counts are taken from the server once, then updated locally from messages received on these channels and from
+	 * last-read-message timetoken changes (SetLastReadMessageTimetoken, MarkAllMessagesAsRead, membership updates).
+	 * Counts are taken from the server again only when they can't be calculated locally or after a connection gap.
+	 * All tracked channels share one subscription. Chat events published on these channels are not counted.
+	 * Changes are broadcast with OnUnreadMessagesCountChanged and UPubnubChatChannel::OnUnreadMessagesCountChanged.
+	 * Can be called again (e.g. with the next Page) to track more channels.
+	 *
+	 * @param Limit Max number of memberships to track. Pass 0 to use the server default.
+	 * @param Filter Expression used to filter the results. Check online documentation to see exact filter formulas.
+	 * @param Sort Key-value pair of a property to sort by, and a sort direction.
+	 * @param Page Pagination information. Use Page.Next to get the next page or Page.Prev to get the previous page.
+	 *             If both are provided, Next takes precedence.
+	 * @return Operation result.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Messages")
+	FPubnubChatOperationResult StartUnreadMessagesTracking(const int Limit = 0, const FString Filter = "", FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage());
+
+	/**
+	 * Starts keeping unread message counts of the current user's memberships up to date asynchronously.
+	 *
+	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param Limit Max number of memberships to track. Pass 0 to use the server default.
+	 * @param Filter Expression used to filter the results. Check online documentation to see exact filter formulas.
+	 * @param Sort Key-value pair of a property to sort by, and a sort direction.
+	 * @param Page Pagination information. Use Page.Next to get the next page or Page.Prev to get the previous page.
+	 *             If both are provided, Next takes precedence.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void MarkAllMessagesAsReadAsync(FOnPubnubChatMarkAllMessagesAsReadResponseNative OnMarkAllMessagesAsReadResponseNative, const int Limit = 0, const FString Filter = "", FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage());
+	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Messages", meta = (AutoCreateRefTerm = "OnOperationResponse"))
+	FPubnubChatAsyncHandle StartUnreadMessagesTrackingAsync(FOnPubnubChatOperationResponse OnOperationResponse, const int Limit = 0, const FString Filter = "", FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
+	/**
+	 * Starts keeping unread message counts of the current user's memberships up to date asynchronously.
+	 *
+	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param Limit Max number of memberships to track. Pass 0 to use the server default.
+	 * @param Filter Expression used to filter the results. Check online documentation to see exact filter formulas.
+	 * @param Sort Key-value pair of a property to sort by, and a sort direction.
+	 * @param Page Pagination information. Use Page.Next to get the next page or Page.Prev to get the previous page.
+	 *             If both are provided, Next takes precedence.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
+	 */
+	FPubnubChatAsyncHandle StartUnreadMessagesTrackingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, const int Limit = 0, const FString Filter = "", FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
+
+	/**
+	 * Stops tracking unread message counts of all channels and unsubscribes from them.
+	 * Local: does not perform any network requests.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Messages")
+	void StopUnreadMessagesTracking();
+
+	/**
+	 * Returns the current unread messages count of a channel tracked with StartUnreadMessagesTracking.
+	 * Local: does not perform any network requests.
+	 *
+	 * @param ChannelID Unique identifier of the channel.
+	 * @return Number of unread messages, or 0 if the channel is not tracked.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Pubnub Chat|Messages")
+	int GetTrackedUnreadMessagesCount(const FString ChannelID) const;
 	
 	
 	/* THREADS */
@@ -996,17 +1346,21 @@ public:
 	 *
 	 * @param Message Parent message to create the thread on.
 	 * @param OnThreadChannelResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Threads")
-	void CreateThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatThreadChannelResponse OnThreadChannelResponse);
+	FPubnubChatAsyncHandle CreateThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatThreadChannelResponse OnThreadChannelResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Creates a thread channel asynchronously for replying to a message (local only until first message is sent on the thread).
 	 * Fails if the message is already in a thread, if the message is deleted, or if a thread for this message already exists.
 	 *
 	 * @param Message Parent message to create the thread on.
 	 * @param OnThreadChannelResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void CreateThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatThreadChannelResponseNative OnThreadChannelResponseNative);
+	FPubnubChatAsyncHandle CreateThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatThreadChannelResponseNative OnThreadChannelResponseNative, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Retrieves the thread channel for a message if it already exists on the server.
@@ -1025,17 +1379,21 @@ public:
 	 *
 	 * @param Message Parent message whose thread channel to fetch.
 	 * @param OnThreadChannelResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Threads")
-	void GetThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatThreadChannelResponse OnThreadChannelResponse);
+	FPubnubChatAsyncHandle GetThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatThreadChannelResponse OnThreadChannelResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Retrieves asynchronously the thread channel for a message if it already exists on the server.
 	 * Fails if no thread exists for this message.
 	 *
 	 * @param Message Parent message whose thread channel to fetch.
 	 * @param OnThreadChannelResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatThreadChannelResponseNative OnThreadChannelResponseNative);
+	FPubnubChatAsyncHandle GetThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatThreadChannelResponseNative OnThreadChannelResponseNative, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Removes the thread from a message: deletes the thread root message action and the thread channel.
@@ -1054,17 +1412,21 @@ public:
 	 *
 	 * @param Message Parent message whose thread to remove.
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Threads", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void RemoveThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle RemoveThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Removes the thread from a message asynchronously: deletes the thread root message action and the thread channel.
 	 * Fails if the message has no thread or has an invalid thread root action.
 	 *
 	 * @param Message Parent message whose thread to remove.
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void RemoveThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle RemoveThreadChannelAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	
 	/* ACCESS MANAGER */
@@ -1086,6 +1448,7 @@ public:
 	 * Reconnects all active subscriptions (e.g. after unexpected disconnect or connection error).
 	 * Blocking: performs the reconnect on the calling thread.
 	 * Use after receiving a disconnected or connection-error status from OnConnectionStatusChanged, or after DisconnectSubscriptions.
+	 * Once connection is back, messages missed by connected channels are replayed through OnMessageReceived (see FPubnubChatConfig::ReconnectReplayWindow).
 	 *
 	 * @param Timetoken Optional timetoken to resume from; empty to use default.
 	 * @return Operation result.
@@ -1099,17 +1462,21 @@ public:
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
 	 * @param Timetoken Optional timetoken to resume from; empty to use default.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Connection Status", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void ReconnectSubscriptionsAsync(FOnPubnubChatOperationResponse OnOperationResponse, const FString Timetoken = "");
+	FPubnubChatAsyncHandle ReconnectSubscriptionsAsync(FOnPubnubChatOperationResponse OnOperationResponse, const FString Timetoken = "", float DeadlineSeconds = -1.0f);
 	/**
 	 * Reconnects all active subscriptions asynchronously (e.g. after unexpected disconnect or connection error).
 	 * Use after receiving a disconnected or connection-error status from OnConnectionStatusChanged, or after DisconnectSubscriptions.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param Timetoken Optional timetoken to resume from; empty to use default.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void ReconnectSubscriptionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, const FString Timetoken = "");
+	FPubnubChatAsyncHandle ReconnectSubscriptionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, const FString Timetoken = "", float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Pauses all active subscriptions (stops receiving messages and events until ReconnectSubscriptions is called).
@@ -1124,15 +1491,19 @@ public:
 	 * Pauses all active subscriptions asynchronously (stops receiving messages and events until ReconnectSubscriptions is called).
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Connection Status", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void DisconnectSubscriptionsAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle DisconnectSubscriptionsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Pauses all active subscriptions asynchronously (stops receiving messages and events until ReconnectSubscriptions is called).
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void DisconnectSubscriptionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle DisconnectSubscriptionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	
 private:
@@ -1151,29 +1522,66 @@ private:
 	/** Repository that manages shared data for all chat objects */
 	UPROPERTY()
 	TObjectPtr<UPubnubChatObjectsRepository> ObjectsRepository = nullptr;
+	/** Keeps unread messages counts up to date after StartUnreadMessagesTracking */
+	UPROPERTY()
+	TObjectPtr<UPubnubChatUnreadTracker> UnreadTracker = nullptr;
+	/** Replays messages missed by connected channels during a connection gap */
+	UPROPERTY()
+	TObjectPtr<UPubnubChatReconnectCatchUp> ReconnectCatchUp = nullptr;
+	/** Stores last active timestamp of the current user when StoreUserActivityTimestamps is enabled */
+	UPROPERTY()
+	TObjectPtr<UPubnubChatActivityHeartbeat> ActivityHeartbeat = nullptr;
+	/** Prefetches data together with the current user when FPubnubChatBootstrapConfig::PrefetchOnInit is enabled */
+	UPROPERTY()
+	TObjectPtr<UPubnubChatBootstrap> Bootstrap = nullptr;
+	/** Queues mutations made while offline in a journal on disk when FPubnubChatConfig::Outbox is enabled */
+	UPROPERTY()
+	TObjectPtr<UPubnubChatOutbox> Outbox = nullptr;
+	/** Applies reaction toggles locally right away and sends only their net change, debounced with FPubnubChatConfig::ReactionToggleDebounce */
+	UPROPERTY()
+	TObjectPtr<UPubnubChatReactionCoordinator> ReactionCoordinator = nullptr;
+	/** Keeps only the highest last read message timetoken of each membership and writes it at most once per FPubnubChatConfig::ReadMarkerFlushInterval */
+	UPROPERTY()
+	TObjectPtr<UPubnubChatReadMarkerWriter> ReadMarkerWriter = nullptr;
+	/** Retry, backoff and circuit breaker policy of all PubNub requests made by the chat, configured with FPubnubChatConfig::Retry */
+	TSharedPtr<FPubnubChatRetryPolicy, ESPMode::ThreadSafe> RetryPolicy = nullptr;
+	/** Keeps repository data on disk between sessions when FPubnubChatConfig::PersistentStore is enabled */
+	UPROPERTY()
+	TObjectPtr<UPubnubChatPersistentStore> PersistentStore = nullptr;
+	/** Delivers received events to delegates under a per-frame budget when FPubnubChatConfig::Dispatch is enabled */
+	UPROPERTY()
+	TObjectPtr<UPubnubChatDispatchQueue> DispatchQueue = nullptr;
 	UPROPERTY()
 	bool IsInitialized = false;
 	//Container for subscriptions used during listen for events - we need to keep them alive
 	UPROPERTY()
 	TArray<UPubnubSubscription*> ListenForEventsSubscriptions;
+	//Collection updates streams started with StartUpdatesStreamOn - they remove themselves when stopped
+	UPROPERTY()
+	TArray<TObjectPtr<UPubnubChatUpdatesStream>> UpdatesStreams;
+	mutable FCriticalSection UpdatesStreamsCriticalSection;
 	
 	
 	FPubnubFunctionThread* AsyncFunctionsThread = nullptr;
-	
-	//Timer handles for user activity timestamp management
-	FTimerHandle LastSavedActivityIntervalTimerHandle;
-	FTimerHandle RunWithDelayTimerHandle;
+	//Threads that send independent requests of bulk operations at the same time, see RunConcurrentRequests
+	TSharedPtr<FPubnubChatRequestWorkers, ESPMode::ThreadSafe> RequestWorkers = nullptr;
+	/**
+	 * Calls Request for every index in [0, NumRequests) on the request workers, at most Pubnub_Chat_Max_Concurrent_Requests at once, and waits until all are done.
+	 * Every request has to keep its own FPubnubChatOperationResult - steps can't be added to a shared result from multiple threads.
+	 * Without workers (chat not initialized or being destroyed) requests are called one by one on the calling thread.
+	 */
+	void RunConcurrentRequests(int32 NumRequests, TFunctionRef<void(int32 RequestIndex)> Request);
+	//Creates handle of an operation queued on AsyncFunctionsThread. Negative DeadlineSeconds uses the default deadline from ChatConfig
+	FPubnubChatAsyncHandle CreateAsyncHandle(float DeadlineSeconds) const;
 	
 	UFUNCTION()
 	void OnPubnubSubscriptionStatusChanged(EPubnubSubscriptionStatus Status, FPubnubSubscriptionStatusData StatusData);
 
 	FPubnubChatInitChatResult InitChat(const FString InUserID, const FPubnubChatConfig& InChatConfig, UPubnubClient* InPubnubClient, bool bInOwnsPubnubClient);
+	//Stops and releases all components created by InitChat and removes the client callback. Used by DestroyChat and by InitChat when it fails
+	void ReleaseChatComponents();
 	FPubnubChatUserResult GetUserForInit(const FString InUserID);
 	
-	void StoreUserActivityTimestamp();
-	void SaveTimestamp();
-	void RunSaveTimestampInterval();
-	
 	
 	/* CREATORS FOR CHAT OBJECTS */
 
@@ -1198,6 +1606,97 @@ private:
 	UPubnubChatThreadMessage* CreateThreadMessageObject(const FString Timetoken, const FPubnubMessageData& MessageData, const FString ParentChannelID);
 	UPubnubChatThreadMessage* CreateThreadMessageObject(const FString Timetoken, const FPubnubHistoryMessageData& HistoryMessageData, const FString ParentChannelID);
 	
+	//Batched creators for history pages - all messages are registered in the repository under a single lock
+	TArray<UPubnubChatMessage*> CreateMessageObjects(const TArray<FPubnubHistoryMessageData>& HistoryMessagesData);
+	TArray<UPubnubChatThreadMessage*> CreateThreadMessageObjects(const TArray<FPubnubHistoryMessageData>& HistoryMessagesData, const FString ParentChannelID);
+	
+	
+	/* LIVE MESSAGE OBJECTS */
+	
+	/**
+	 * Identity map of live Message objects keyed by composite MessageID ("[ChannelID].[Timetoken]"). While an object is alive, every function
+	 * that returns the same message (GetHistory, GetMessage, listeners, thread functions) returns this instance, so callers share it and see each other's updates.
+	 * Entries don't keep objects alive - every Message releases its entry in BeginDestroy with ReleaseLiveMessageObject, so a stored pointer is never dangling.
+	 * Objects are not recycled: GC destroys them once nothing references them, there is no point at which an unused object is still alive to be reused.
+	 * Resolved on the calling thread under LiveMessageObjectsCriticalSection, with GC blocked off the game thread.
+	 */
+	TMap<FString, UPubnubChatMessage*> LiveMessageObjects;
+	mutable FCriticalSection LiveMessageObjectsCriticalSection;
+	int64 MessageObjectsCreatedCount = 0;
+	int64 MessageObjectsReusedCount = 0;
+	
+	/**
+	 * Returns live Message object of exactly given class for given composite MessageID, or nullptr if there is none.
+	 * Objects already found unreachable by GC are skipped. Has to be called with LiveMessageObjectsCriticalSection locked and GC blocked.
+	 */
+	UPubnubChatMessage* FindLiveMessageObject(const FString& MessageID, const UClass* MessageClass);
+	//Has to be called with LiveMessageObjectsCriticalSection locked
+	void AddLiveMessageObject(UPubnubChatMessage* Message);
+	//Removes entry of given Message if the entry still belongs to it. Called by the Message when it's destroyed
+	void ReleaseLiveMessageObject(UPubnubChatMessage* Message);
+	/**
+	 * Returns live Message objects for given composite MessageIDs (nullptr for messages without an object).
+	 * Can be called from any thread, it doesn't wait for the game thread.
+	 */
+	TArray<UPubnubChatMessage*> FindLiveMessageObjects(const TArray<FString>& MessageIDs);
+	/**
+	 * Returns live Message objects for given composite MessageIDs and creates the missing ones with CreateMessage, on the calling thread.
+	 * Can be called from any thread, it doesn't wait for the game thread. Created objects are always shared with later callers.
+	 * @param OutCreated True for every returned object that was created by this call
+	 */
+	TArray<UPubnubChatMessage*> GetOrCreateLiveMessageObjects(const TArray<FString>& MessageIDs, const UClass* MessageClass, TFunctionRef<UPubnubChatMessage*(int32 Index)> CreateMessage, TArray<bool>& OutCreated);
+	UPubnubChatMessage* GetOrCreateMessageObject(const FString& ChannelID, const FString& Timetoken, const FPubnubChatMessageData& ChatMessageData);
+	UPubnubChatThreadMessage* GetOrCreateThreadMessageObject(const FString& ChannelID, const FString& Timetoken, const FPubnubChatMessageData& ChatMessageData, const FString& ParentChannelID);
+	//Moves locally echoed message from its provisional timetoken to the one assigned by the server, keeping the same object and its data
+	void RekeyMessageObject(UPubnubChatMessage* Message, const FString& NewTimetoken);
+	
+	/* DISPATCH */
+	
+	/**
+	 * Calls delegates of given listener through the dispatch queue when it's enabled, or right away otherwise.
+	 * @param CoalesceKey If not empty, pending event of this listener with the same key is superseded by this one
+	 * @param bDroppable True if flow control can drop the event while it's pending
+	 */
+	void DispatchEvent(UObject* Listener, TFunction<void()> Function, const FString& CoalesceKey = "", bool bDroppable = false);
+	
+	/* SERVER TIME */
+	
+	/**
+	 * Takes the current timetoken from the server. Use it instead of the local clock whenever the timetoken is compared with timetokens of messages,
+	 * as the local clock can be off by minutes.
+	 * Blocking: performs network requests on the calling thread.
+	 */
+	FPubnubChatOperationResult FetchServerTimetoken(int64& OutTimetoken);
+	
+	/* MODERATION */
+	
+	//Moderation channels that were already created (or confirmed) during this chat session
+	TSet<FString> CreatedModerationChannels;
+	mutable FCriticalSection CreatedModerationChannelsCriticalSection;
+	
+	//Creates moderation channel if it wasn't created yet in this session. Returns empty result if nothing had to be done
+	FPubnubChatOperationResult EnsureModerationChannelExists(const FString& ModerationChannelID);
+	//Emits moderation event to the restricted user. RestrictionType (banned/muted/lifted) is taken from given Restriction
+	FPubnubChatOperationResult EmitModerationEvent(const FPubnubChatRestriction& Restriction, const FString& ModerationChannelID);
+	
+	/* CONVERSATIONS */
+	
+	/**
+	 * Writes membership of the host and "pending" memberships of all invitees with batched SetChannelMembers requests,
+	 * last read message timetoken of invitees is embedded in the same write. Then emits invite events concurrently with RunConcurrentRequests.
+	 * Safe to call again after a partial failure - invitees that are already members keep their membership,
+	 * and only the ones that are still pending get the invite event again.
+	 * @param bCheckExistingMembers False if the channel was just created with a new ID, so no invitee can be a member yet
+	 */
+	FPubnubChatOperationResult BuildConversationMemberships(UPubnubChatChannel* Channel, const FPubnubChatMembershipData& HostMembershipData, const TArray<UPubnubChatUser*>& Invitees, bool bCheckExistingMembers, UPubnubChatMembership*& OutHostMembership, TArray<UPubnubChatMembership*>& OutInviteeMemberships);
+	
+	/* UPDATES STREAMS */
+	
+	//Creates collection updates stream that is kept alive by this Chat until it's stopped
+	UPubnubChatUpdatesStream* CreateUpdatesStream();
+	//Removes given object from all collection updates streams. Streams that have no objects left are stopped
+	FPubnubChatOperationResult RemoveFromUpdatesStreams(UObject* Object);
+	
 	/* EVENTS */
 	
 	FPubnubChatOperationResult EmitChatEvent(EPubnubChatEventType EventType, const FString ChannelID, const FString Payload, EPubnubChatEventMethod EventMethod = EPubnubChatEventMethod::PCEM_Default);
@@ -18,6 +18,7 @@ class PUBNUBCHATSDK_API UPubnubChatCallbackStop : public UObject
 	friend class UPubnubChatUser;
 	friend class UPubnubChatChannel;
 	friend class UPubnubChatMessage;
+	friend class UPubnubChatUpdatesStream;
 
 public:
 	virtual void BeginDestroy() override;
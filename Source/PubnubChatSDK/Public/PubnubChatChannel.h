@@ -21,6 +21,8 @@ class UPubnubChatMessageDraft;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPubnubChatMessageReceived, UPubnubChatMessage*, PubnubMessage);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnPubnubChatMessageReceivedNative, UPubnubChatMessage* PubnubMessage);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPubnubChatMessagesReceivedBatch, const TArray<UPubnubChatMessage*>&, PubnubMessages);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPubnubChatMessagesReceivedBatchNative, const TArray<UPubnubChatMessage*>& PubnubMessages);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPubnubChatChannelUpdated, FString, ChannelID, FPubnubChatChannelData, ChannelData);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnPubnubChatChannelUpdatedNative, FString ChannelID, const FPubnubChatChannelData& ChannelData);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPubnubChatTypingChanged, const TArray<FString>&, TypingUserIDs);
@@ -33,6 +35,25 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPubnubChatPresenceChanged, const
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnPubnubChatPresenceChangedNative, const TArray<FString>& UserIDs);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPubnubChatCustomEventReceived, FPubnubChatCustomEvent, CustomEvent);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnPubnubChatCustomEventReceivedNative, const FPubnubChatCustomEvent& CustomEvent);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPubnubChatChannelUnreadMessagesCountChanged, int, Count);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPubnubChatChannelUnreadMessagesCountChangedNative, int Count);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnPubnubChatChannelsUpdated, const TArray<UPubnubChatChannel*>&, Channels);
+DECLARE_DELEGATE_OneParam(FOnPubnubChatChannelsUpdatedNative, const TArray<UPubnubChatChannel*>& Channels);
+
+/** Message sent by SendText with LocalEcho enabled. Kept by its channel until both the publish and the echo from the server are confirmed */
+struct FPubnubChatPendingLocalEcho
+{
+	TWeakObjectPtr<UPubnubChatMessage> Message = nullptr;
+	//Composite repository ID of the provisional message, format: "[ChannelID].[ProvisionalTimetoken]"
+	FString ProvisionalMessageID = "";
+	FString Text = "";
+	FPubnubChatSendTextParams SendTextParams;
+	TWeakObjectPtr<UPubnubChatMessage> QuotedMessage = nullptr;
+	TMap<FString, FString> MentionedUsers;
+	EPubnubChatMessageSendState SendState = EPubnubChatMessageSendState::PCMSS_Pending;
+	bool bPublished = false;
+	bool bEchoReceived = false;
+};
 
 
 /**
@@ -45,6 +66,9 @@ class PUBNUBCHATSDK_API UPubnubChatChannel : public UObject
 
 	friend class UPubnubChat;
 	friend class UPubnubChatMessageDraft;
+	friend class UPubnubChatReconnectCatchUp;
+	friend class UPubnubChatMessage;
+	friend class UPubnubChatOutbox;
 public:
 
 	virtual void BeginDestroy() override;
@@ -59,6 +83,16 @@ public:
 	FOnPubnubChatMessageReceived OnMessageReceived;
 	FOnPubnubChatMessageReceivedNative OnMessageReceivedNative;
 	
+	/**
+	 * Broadcast with all messages received on this channel since the last batch, after they were delivered by OnMessageReceived.
+	 * When FPubnubChatConfig::Dispatch is enabled, it's broadcast at most once per frame; otherwise it's broadcast for every message.
+	 * Messages are collected only while this delegate is bound.
+	 * @param PubnubMessages Received message objects, oldest first.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Pubnub Chat|Delegates")
+	FOnPubnubChatMessagesReceivedBatch OnMessagesReceivedBatch;
+	FOnPubnubChatMessagesReceivedBatchNative OnMessagesReceivedBatchNative;
+	
 	/**
 	 * Broadcast when this channel's metadata is updated (after StreamUpdates is active).
 	 * For channel deletion, use OnDeleted instead.
@@ -118,6 +152,14 @@ public:
 	FOnPubnubChatCustomEventReceived OnCustomEventReceived;
 	FOnPubnubChatCustomEventReceivedNative OnCustomEventReceivedNative;
 	
+	/**
+	 * Broadcast when unread messages count of this channel changes (after UPubnubChat::StartUnreadMessagesTracking tracks this channel).
+	 * @param Count New number of unread messages on this channel.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Pubnub Chat|Delegates")
+	FOnPubnubChatChannelUnreadMessagesCountChanged OnUnreadMessagesCountChanged;
+	FOnPubnubChatChannelUnreadMessagesCountChangedNative OnUnreadMessagesCountChangedNative;
+	
 	
 	/* PUBLIC FUNCTIONS */
 	
@@ -129,6 +171,16 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub Chat|Channel")
 	FPubnubChatChannelData GetChannelData() const;
+
+	/**
+	 * Returns the local version of this channel's cached data. The version changes every time the cached data changes,
+	 * so comparing it with the version seen during the last refresh tells if GetChannelData has to be read again.
+	 * Local: does not perform any network requests.
+	 *
+	 * @return Version of the cached data, or 0 if channel is not initialized or not in cache.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub Chat|Channel")
+	int64 GetDataVersion() const;
 	
 	/**
 	 * Returns the unique identifier of this channel.
@@ -139,6 +191,16 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub Chat|Channel")
 	FString GetChannelID() const { return ChannelID; }
 	
+	/**
+	 * Returns flow control metrics of this channel: number of its events waiting in the dispatch queue
+	 * and number of received messages dropped because the queue was full (see FPubnubChatConfig::FlowControl).
+	 * Local: does not perform any network requests.
+	 *
+	 * @return Flow control metrics of this channel.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub Chat|Channel")
+	FPubnubChatFlowControlStats GetFlowControlStats() const;
+	
 	/**
 	 * Updates this channel's metadata on the PubNub server and updates the local cache.
 	 * Blocking: performs network requests on the calling thread. Blocks for the duration of the operation.
@@ -160,9 +222,11 @@ public:
 	 *        (ForceSetChannelName, ForceSetDescription, ForceSetCustom, ForceSetStatus, ForceSetType) to control
 	 *        whether each field is merged or fully replaced. Use ForceSetAllFields() for full replacement.
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void UpdateAsync(FPubnubChatUpdateChannelInputData UpdateChannelData, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle UpdateAsync(FPubnubChatUpdateChannelInputData UpdateChannelData, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Updates this channel's metadata asynchronously on the PubNub server and updates the local cache.
 	 * Fails if the channel is not initialized or the server request fails.
@@ -171,8 +235,10 @@ public:
 	 *        (ForceSetChannelName, ForceSetDescription, ForceSetCustom, ForceSetStatus, ForceSetType) to control
 	 *        whether each field is merged or fully replaced. Use ForceSetAllFields() for full replacement.
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void UpdateAsync(FPubnubChatUpdateChannelInputData UpdateChannelData, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle UpdateAsync(FPubnubChatUpdateChannelInputData UpdateChannelData, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Subscribes to this channel so that new messages are delivered via OnMessageReceived / OnMessageReceivedNative.
@@ -189,16 +255,20 @@ public:
 	 * No-op if already connected. Does not create or update membership; use JoinAsync() to join as a member.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void ConnectAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle ConnectAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Subscribes asynchronously to this channel so that new messages are delivered via OnMessageReceived / OnMessageReceivedNative.
 	 * No-op if already connected. Does not create or update membership; use JoinAsync() to join as a member.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void ConnectAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle ConnectAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Adds the current user as a member of this channel.
@@ -223,9 +293,11 @@ public:
 	 * @param OnJoinResponse Callback executed when the operation completes.
 	 * @param MembershipData Optional membership metadata (Custom, Status, Type) for the current user in this channel.
 	 *        If not provided, defaults are used. Status is forced to be set so a previously invited user is updated correctly.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Channel")
-	void JoinAsync(FOnPubnubChatJoinResponse OnJoinResponse, FPubnubChatMembershipData MembershipData = FPubnubChatMembershipData());
+	FPubnubChatAsyncHandle JoinAsync(FOnPubnubChatJoinResponse OnJoinResponse, FPubnubChatMembershipData MembershipData = FPubnubChatMembershipData(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Adds the current user as a member of this channel asynchronously.
 	 * Sets the user's membership (with optional metadata) and sets last-read-message timetoken.
@@ -235,8 +307,10 @@ public:
 	 * @param OnJoinResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param MembershipData Optional membership metadata (Custom, Status, Type) for the current user in this channel.
 	 *        If not provided, defaults are used. Status is forced to be set so a previously invited user is updated correctly.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void JoinAsync(FOnPubnubChatJoinResponseNative OnJoinResponseNative, FPubnubChatMembershipData MembershipData = FPubnubChatMembershipData());
+	FPubnubChatAsyncHandle JoinAsync(FOnPubnubChatJoinResponseNative OnJoinResponseNative, FPubnubChatMembershipData MembershipData = FPubnubChatMembershipData(), float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Unsubscribes from this channel. Stops receiving new messages; OnMessageReceived will no longer fire.
@@ -253,16 +327,20 @@ public:
 	 * Does not remove membership; use LeaveAsync() to leave the channel and remove membership.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void DisconnectAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle DisconnectAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Unsubscribes asynchronously from this channel. Stops receiving new messages when the operation completes; OnMessageReceived will no longer fire after that.
 	 * Does not remove membership; use LeaveAsync() to leave the channel and remove membership.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void DisconnectAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle DisconnectAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Removes the current user's membership from this channel.
@@ -279,16 +357,20 @@ public:
 	 * Does not unsubscribe from the channel; use DisconnectAsync() to stop receiving messages before or after leaving.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void LeaveAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle LeaveAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Removes the current user's membership from this channel asynchronously.
 	 * Does not unsubscribe from the channel; use DisconnectAsync() to stop receiving messages before or after leaving.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void LeaveAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle LeaveAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Publishes a text message to this channel on the PubNub server.
@@ -311,9 +393,11 @@ public:
 	 * @param OnOperationResponse Callback executed when the operation completes.
 	 * @param SendTextParams Optional settings: StoreInHistory (default true), SendByPost (default false), Meta (JSON string),
 	 *        QuotedMessage (message to quote; must be from this channel and have a valid timetoken).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void SendTextAsync(const FString Message, FOnPubnubChatOperationResponse OnOperationResponse,  FPubnubChatSendTextParams SendTextParams = FPubnubChatSendTextParams());
+	FPubnubChatAsyncHandle SendTextAsync(const FString Message, FOnPubnubChatOperationResponse OnOperationResponse,  FPubnubChatSendTextParams SendTextParams = FPubnubChatSendTextParams(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Publishes a text message asynchronously to this channel on the PubNub server.
 	 * Validates that a quoted message, if provided, belongs to this channel and has a valid timetoken.
@@ -322,8 +406,10 @@ public:
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param SendTextParams Optional settings: StoreInHistory (default true), SendByPost (default false), Meta (JSON string),
 	 *        QuotedMessage (message to quote; must be from this channel and have a valid timetoken).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void SendTextAsync(const FString Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, FPubnubChatSendTextParams SendTextParams = FPubnubChatSendTextParams());
+	FPubnubChatAsyncHandle SendTextAsync(const FString Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, FPubnubChatSendTextParams SendTextParams = FPubnubChatSendTextParams(), float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Invites a user to this channel. Adds the user as a member with "pending" status, emits an Invite event, and sets last-read timetoken.
@@ -342,17 +428,21 @@ public:
 	 *
 	 * @param User The chat user object to invite. Must be valid (non-null).
 	 * @param OnInviteResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Channel")
-	void InviteAsync(UPubnubChatUser* User, FOnPubnubChatInviteResponse OnInviteResponse);
+	FPubnubChatAsyncHandle InviteAsync(UPubnubChatUser* User, FOnPubnubChatInviteResponse OnInviteResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Invites a user asynchronously to this channel. Adds the user as a member with "pending" status, emits an Invite event, and sets last-read timetoken.
 	 * If the user is already a member, returns their existing membership without sending another invite.
 	 *
 	 * @param User The chat user object to invite. Must be valid (non-null).
 	 * @param OnInviteResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void InviteAsync(UPubnubChatUser* User, FOnPubnubChatInviteResponseNative OnInviteResponseNative);
+	FPubnubChatAsyncHandle InviteAsync(UPubnubChatUser* User, FOnPubnubChatInviteResponseNative OnInviteResponseNative, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Invites multiple users to this channel in one request. Adds each user as a member with "pending" status, emits Invite events, and sets last-read timetoken per user.
@@ -371,17 +461,21 @@ public:
 	 *
 	 * @param Users Array of chat user objects to invite. At least one valid user required; null/invalid entries are ignored.
 	 * @param OnInviteMultipleResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Channel")
-	void InviteMultipleAsync(TArray<UPubnubChatUser*> Users, FOnPubnubChatInviteMultipleResponse OnInviteMultipleResponse);
+	FPubnubChatAsyncHandle InviteMultipleAsync(TArray<UPubnubChatUser*> Users, FOnPubnubChatInviteMultipleResponse OnInviteMultipleResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Invites multiple users asynchronously to this channel in one request. Adds each user as a member with "pending" status, emits Invite events, and sets last-read timetoken per user.
 	 * Invalid or null users in the array are skipped. At least one valid user is required.
 	 *
 	 * @param Users Array of chat user objects to invite. At least one valid user required; null/invalid entries are ignored.
 	 * @param OnInviteMultipleResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void InviteMultipleAsync(TArray<UPubnubChatUser*> Users, FOnPubnubChatInviteMultipleResponseNative OnInviteMultipleResponseNative);
+	FPubnubChatAsyncHandle InviteMultipleAsync(TArray<UPubnubChatUser*> Users, FOnPubnubChatInviteMultipleResponseNative OnInviteMultipleResponseNative, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Pins a message to this channel. Stores the pinned message reference in the channel's custom metadata and updates the server.
@@ -400,17 +494,21 @@ public:
 	 *
 	 * @param Message The message to pin. Must be from this channel or from a thread on this channel. Must be valid (non-null).
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void PinMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle PinMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Pins a message asynchronously to this channel. Stores the pinned message reference in the channel's custom metadata and updates the server.
 	 * The message must belong to this channel or to a thread whose parent is this channel. Fails if the message is from another channel.
 	 *
 	 * @param Message The message to pin. Must be from this channel or from a thread on this channel. Must be valid (non-null).
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void PinMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle PinMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Unpins the currently pinned message from this channel. Removes the pinned message from the channel's custom metadata and updates the server.
@@ -427,16 +525,20 @@ public:
 	 * No-op if there is no pinned message.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void UnpinMessageAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle UnpinMessageAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Unpins the currently pinned message asynchronously from this channel. Removes the pinned message from the channel's custom metadata and updates the server.
 	 * No-op if there is no pinned message.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void UnpinMessageAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle UnpinMessageAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Returns the message currently pinned to this channel, if any. Reads from the local cache; if the pinned message is in a thread, fetches it from the server.
@@ -453,16 +555,20 @@ public:
 	 * Returns an empty result if no message is pinned. May perform network requests if the pinned message is in a thread channel.
 	 *
 	 * @param OnMessageResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void GetPinnedMessageAsync(FOnPubnubChatMessageResponse OnMessageResponse);
+	FPubnubChatAsyncHandle GetPinnedMessageAsync(FOnPubnubChatMessageResponse OnMessageResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Returns asynchronously the message currently pinned to this channel, if any. Reads from the local cache; if the pinned message is in a thread, fetches it from the server.
 	 * Returns an empty result if no message is pinned. May perform network requests if the pinned message is in a thread channel.
 	 *
 	 * @param OnMessageResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetPinnedMessageAsync(FOnPubnubChatMessageResponseNative OnMessageResponseNative);
+	FPubnubChatAsyncHandle GetPinnedMessageAsync(FOnPubnubChatMessageResponseNative OnMessageResponseNative, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Lists user IDs currently present (subscribed) on this channel. Presence reflects active subscriptions, not channel membership.
@@ -481,17 +587,21 @@ public:
 	 * @param OnWhoIsPresentResponse Callback executed when the operation completes.
 	 * @param Limit Maximum number of user IDs to return (default 1000).
 	 * @param Offset Number of users to skip for pagination (default 0).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void WhoIsPresentAsync(FOnPubnubChatWhoIsPresentResponse OnWhoIsPresentResponse, int Limit = 1000, int Offset = 0);
+	FPubnubChatAsyncHandle WhoIsPresentAsync(FOnPubnubChatWhoIsPresentResponse OnWhoIsPresentResponse, int Limit = 1000, int Offset = 0, float DeadlineSeconds = -1.0f);
 	/**
 	 * Lists user IDs asynchronously currently present (subscribed) on this channel. Presence reflects active subscriptions, not channel membership.
 	 *
 	 * @param OnWhoIsPresentResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param Limit Maximum number of user IDs to return (default 1000).
 	 * @param Offset Number of users to skip for pagination (default 0).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void WhoIsPresentAsync(FOnPubnubChatWhoIsPresentResponseNative OnWhoIsPresentResponseNative, int Limit = 1000, int Offset = 0);
+	FPubnubChatAsyncHandle WhoIsPresentAsync(FOnPubnubChatWhoIsPresentResponseNative OnWhoIsPresentResponseNative, int Limit = 1000, int Offset = 0, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Checks whether a user is currently present (subscribed) on this channel. Presence reflects active subscriptions, not channel membership.
@@ -508,16 +618,20 @@ public:
 	 *
 	 * @param UserID Unique identifier of the user to check.
 	 * @param OnIsPresentResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void IsPresentAsync(const FString UserID, FOnPubnubChatIsPresentResponse OnIsPresentResponse);
+	FPubnubChatAsyncHandle IsPresentAsync(const FString UserID, FOnPubnubChatIsPresentResponse OnIsPresentResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Checks asynchronously whether a user is currently present (subscribed) on this channel. Presence reflects active subscriptions, not channel membership.
 	 *
 	 * @param UserID Unique identifier of the user to check.
 	 * @param OnIsPresentResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void IsPresentAsync(const FString UserID, FOnPubnubChatIsPresentResponseNative OnIsPresentResponseNative);
+	FPubnubChatAsyncHandle IsPresentAsync(const FString UserID, FOnPubnubChatIsPresentResponseNative OnIsPresentResponseNative, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Deletes this channel on the PubNub server.
@@ -532,15 +646,19 @@ public:
 	 * Deletes this channel asynchronously on the PubNub server.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void DeleteAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle DeleteAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Deletes this channel asynchronously on the PubNub server.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void DeleteAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle DeleteAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Retrieves members of this channel from the PubNub server. Returns user and membership data for each member.
@@ -563,9 +681,11 @@ public:
 	 * @param Filter Expression used to filter the results. Check online documentation for filter formulas.
 	 * @param Sort Key-value pair of a property to sort by and sort direction.
 	 * @param Page Pagination information. Use Page.Next or Page.Prev for next/previous page; Next takes precedence if both set.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void GetMembersAsync(FOnPubnubChatMembershipsResponse OnMembershipsResponse, const int Limit = 0, const FString Filter = "", FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle GetMembersAsync(FOnPubnubChatMembershipsResponse OnMembershipsResponse, const int Limit = 0, const FString Filter = "", FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Retrieves members of this channel asynchronously from the PubNub server. Returns user and membership data for each member.
 	 *
@@ -574,8 +694,10 @@ public:
 	 * @param Filter Expression used to filter the results. Check online documentation for filter formulas.
 	 * @param Sort Key-value pair of a property to sort by and sort direction.
 	 * @param Page Pagination information. Use Page.Next or Page.Prev for next/previous page; Next takes precedence if both set.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetMembersAsync(FOnPubnubChatMembershipsResponseNative OnMembershipsResponseNative, const int Limit = 0, const FString Filter = "", FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle GetMembersAsync(FOnPubnubChatMembershipsResponseNative OnMembershipsResponseNative, const int Limit = 0, const FString Filter = "", FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Retrieves a single member of this channel by user ID.
@@ -592,16 +714,20 @@ public:
 	 *
 	 * @param UserID Unique identifier of the user whose membership should be returned.
 	 * @param OnMembershipResponse Callback executed when the operation completes. Returned Membership is nullptr if the user is not a member of this channel.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void GetMemberAsync(const FString UserID, FOnPubnubChatMembershipResponse OnMembershipResponse);
+	FPubnubChatAsyncHandle GetMemberAsync(const FString UserID, FOnPubnubChatMembershipResponse OnMembershipResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Retrieves a single member of this channel asynchronously by user ID.
 	 *
 	 * @param UserID Unique identifier of the user whose membership should be returned.
 	 * @param OnMembershipResponseNative Native callback executed when the operation completes (accepts lambdas). Returned Membership is nullptr if the user is not a member of this channel.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetMemberAsync(const FString UserID, FOnPubnubChatMembershipResponseNative OnMembershipResponseNative);
+	FPubnubChatAsyncHandle GetMemberAsync(const FString UserID, FOnPubnubChatMembershipResponseNative OnMembershipResponseNative, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Checks whether a user is a member of this channel.
@@ -618,16 +744,20 @@ public:
 	 *
 	 * @param UserID Unique identifier of the user to check.
 	 * @param OnHasMemberResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void HasMemberAsync(const FString UserID, FOnPubnubChatHasMemberResponse OnHasMemberResponse);
+	FPubnubChatAsyncHandle HasMemberAsync(const FString UserID, FOnPubnubChatHasMemberResponse OnHasMemberResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Checks asynchronously whether a user is a member of this channel.
 	 *
 	 * @param UserID Unique identifier of the user to check.
 	 * @param OnHasMemberResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void HasMemberAsync(const FString UserID, FOnPubnubChatHasMemberResponseNative OnHasMemberResponseNative);
+	FPubnubChatAsyncHandle HasMemberAsync(const FString UserID, FOnPubnubChatHasMemberResponseNative OnHasMemberResponseNative, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Retrieves invitees of this channel: members with "pending" status. Same as GetMembers with a filter for status == "pending".
@@ -650,9 +780,11 @@ public:
 	 * @param Filter Additional filter expression combined with status == "pending". Check online documentation for filter formulas.
 	 * @param Sort Key-value pair of a property to sort by and sort direction.
 	 * @param Page Pagination information. Use Page.Next or Page.Prev for next/previous page; Next takes precedence if both set.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void GetInviteesAsync(FOnPubnubChatMembershipsResponse OnMembershipsResponse, const int Limit = 0, const FString Filter = "", FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle GetInviteesAsync(FOnPubnubChatMembershipsResponse OnMembershipsResponse, const int Limit = 0, const FString Filter = "", FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Retrieves invitees of this channel asynchronously (members with "pending" status). Same as GetMembers with a filter for status == "pending".
 	 *
@@ -661,8 +793,10 @@ public:
 	 * @param Filter Additional filter expression combined with status == "pending". Check online documentation for filter formulas.
 	 * @param Sort Key-value pair of a property to sort by and sort direction.
 	 * @param Page Pagination information. Use Page.Next or Page.Prev for next/previous page; Next takes precedence if both set.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetInviteesAsync(FOnPubnubChatMembershipsResponseNative OnMembershipsResponseNative, const int Limit = 0, const FString Filter = "", FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle GetInviteesAsync(FOnPubnubChatMembershipsResponseNative OnMembershipsResponseNative, const int Limit = 0, const FString Filter = "", FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Fetches read receipts for this channel: for each member, returns UserID and last-read message timetoken.
@@ -685,9 +819,11 @@ public:
 	 * @param Filter Expression used to filter members. Check online documentation for filter formulas.
 	 * @param Sort Key-value pair of a property to sort by and sort direction.
 	 * @param Page Pagination information. Use Page.Next or Page.Prev for next/previous page; Next takes precedence if both set.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnFetchReadReceiptsResponse"))
-	void FetchReadReceiptsAsync(FOnPubnubChatFetchReadReceiptsResponse OnFetchReadReceiptsResponse, const int Limit = 0, const FString Filter = "", FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle FetchReadReceiptsAsync(FOnPubnubChatFetchReadReceiptsResponse OnFetchReadReceiptsResponse, const int Limit = 0, const FString Filter = "", FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Fetches read receipts for this channel asynchronously (UserID and last-read timetoken per member).
 	 *
@@ -696,8 +832,10 @@ public:
 	 * @param Filter Expression used to filter members. Check online documentation for filter formulas.
 	 * @param Sort Key-value pair of a property to sort by and sort direction.
 	 * @param Page Pagination information. Use Page.Next or Page.Prev for next/previous page; Next takes precedence if both set.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void FetchReadReceiptsAsync(FOnPubnubChatFetchReadReceiptsResponseNative OnFetchReadReceiptsResponseNative, const int Limit = 0, const FString Filter = "", FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle FetchReadReceiptsAsync(FOnPubnubChatFetchReadReceiptsResponseNative OnFetchReadReceiptsResponseNative, const int Limit = 0, const FString Filter = "", FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Sets or lifts moderation restrictions (ban, mute) for a user on this channel.
@@ -720,9 +858,11 @@ public:
 	 * @param Mute When true, mutes the user on this channel; when false, lifts mute if present.
 	 * @param OnOperationResponse Callback executed when the operation completes.
 	 * @param Reason Optional reason for the restriction (e.g. for audit).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void SetRestrictionsAsync(const FString UserID, bool Ban, bool Mute, FOnPubnubChatOperationResponse OnOperationResponse, FString Reason = "");
+	FPubnubChatAsyncHandle SetRestrictionsAsync(const FString UserID, bool Ban, bool Mute, FOnPubnubChatOperationResponse OnOperationResponse, FString Reason = "", float DeadlineSeconds = -1.0f);
 	/**
 	 * Sets or lifts moderation restrictions (ban, mute) asynchronously for a user on this channel.
 	 *
@@ -731,8 +871,10 @@ public:
 	 * @param Mute When true, mutes the user on this channel; when false, lifts mute if present.
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param Reason Optional reason for the restriction (e.g. for audit).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void SetRestrictionsAsync(const FString UserID, bool Ban, bool Mute, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, FString Reason = "");
+	FPubnubChatAsyncHandle SetRestrictionsAsync(const FString UserID, bool Ban, bool Mute, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, FString Reason = "", float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Retrieves moderation restrictions (ban, mute) for a specific user on this channel.
@@ -751,17 +893,21 @@ public:
 	 *
 	 * @param User The chat user object to query. Must be valid (non-null).
 	 * @param OnRestrictionResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void GetUserRestrictionsAsync(UPubnubChatUser* User, FOnPubnubChatGetRestrictionResponse OnRestrictionResponse);
+	FPubnubChatAsyncHandle GetUserRestrictionsAsync(UPubnubChatUser* User, FOnPubnubChatGetRestrictionResponse OnRestrictionResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Retrieves moderation restrictions (ban, mute) asynchronously for a specific user on this channel.
 	 * Returns a restriction with Ban/Mute false if the user has no restrictions on this channel.
 	 *
 	 * @param User The chat user object to query. Must be valid (non-null).
 	 * @param OnRestrictionResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetUserRestrictionsAsync(UPubnubChatUser* User, FOnPubnubChatGetRestrictionResponseNative OnRestrictionResponseNative);
+	FPubnubChatAsyncHandle GetUserRestrictionsAsync(UPubnubChatUser* User, FOnPubnubChatGetRestrictionResponseNative OnRestrictionResponseNative, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Retrieves moderation restrictions for all restricted users on this channel.
@@ -782,9 +928,11 @@ public:
 	 * @param Limit Maximum number of restrictions to return. Pass 0 to use the server default.
 	 * @param Sort Key-value pair of a property to sort by and sort direction.
 	 * @param Page Pagination information. Use Page.Next or Page.Prev for next/previous page; Next takes precedence if both set.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void GetUsersRestrictionsAsync(FOnPubnubChatGetRestrictionsResponse OnRestrictionsResponse, const int Limit = 0, FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle GetUsersRestrictionsAsync(FOnPubnubChatGetRestrictionsResponse OnRestrictionsResponse, const int Limit = 0, FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Retrieves moderation restrictions asynchronously for all restricted users on this channel.
 	 *
@@ -792,8 +940,10 @@ public:
 	 * @param Limit Maximum number of restrictions to return. Pass 0 to use the server default.
 	 * @param Sort Key-value pair of a property to sort by and sort direction.
 	 * @param Page Pagination information. Use Page.Next or Page.Prev for next/previous page; Next takes precedence if both set.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetUsersRestrictionsAsync(FOnPubnubChatGetRestrictionsResponseNative OnRestrictionsResponseNative, const int Limit = 0, FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle GetUsersRestrictionsAsync(FOnPubnubChatGetRestrictionsResponseNative OnRestrictionsResponseNative, const int Limit = 0, FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Fetches message history for this channel within a timetoken range from the PubNub server.
@@ -816,9 +966,11 @@ public:
 	 * @param EndTimetoken End timetoken (inclusive) for the history range. Must be lower (older) than StartTimetoken.
 	 * @param OnHistoryResponse Callback executed when the operation completes.
 	 * @param Count Maximum number of messages to return (default 25).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void GetHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatGetHistoryResponse OnHistoryResponse, const int Count = 25);
+	FPubnubChatAsyncHandle GetHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatGetHistoryResponse OnHistoryResponse, const int Count = 25, float DeadlineSeconds = -1.0f);
 	/**
 	 * Fetches message history asynchronously for this channel within a timetoken range from the PubNub server.
 	 * StartTimetoken must be higher (newer) than EndTimetoken. Result.IsMore is true when more messages exist in the range.
@@ -827,8 +979,24 @@ public:
 	 * @param EndTimetoken End timetoken (inclusive) for the history range. Must be lower (older) than StartTimetoken.
 	 * @param OnHistoryResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param Count Maximum number of messages to return (default 25).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatGetHistoryResponseNative OnHistoryResponseNative, const int Count = 25);
+	FPubnubChatAsyncHandle GetHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatGetHistoryResponseNative OnHistoryResponseNative, const int Count = 25, float DeadlineSeconds = -1.0f);
+	
+	/**
+	 * Returns message history for this channel within a timetoken range saved in the persistent store, also by previous sessions.
+	 * Local: does not perform any network requests. Use it to show scrollback right away, then call GetHistory with the same range -
+	 * it returns the current messages and removes messages deleted on the server from the store.
+	 * Requires FPubnubChatConfig::PersistentStore to be enabled.
+	 *
+	 * @param StartTimetoken Start timetoken (inclusive) for the history range. Must be higher (newer) than EndTimetoken.
+	 * @param EndTimetoken End timetoken (inclusive) for the history range. Must be lower (older) than StartTimetoken.
+	 * @param Count Maximum number of messages to return (default 25).
+	 * @return Operation result, list of stored messages in the range, and IsMore flag when more messages may exist in the range.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
+	FPubnubChatGetHistoryResult GetCachedHistory(const FString StartTimetoken, const FString EndTimetoken, const int Count = 25);
 	
 	/**
 	 * Fetches a single message by timetoken from this channel's history on the PubNub server.
@@ -845,16 +1013,20 @@ public:
 	 *
 	 * @param Timetoken The timetoken of the message to fetch. Must be non-empty.
 	 * @param OnMessageResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void GetMessageAsync(const FString Timetoken, FOnPubnubChatMessageResponse OnMessageResponse);
+	FPubnubChatAsyncHandle GetMessageAsync(const FString Timetoken, FOnPubnubChatMessageResponse OnMessageResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Fetches a single message asynchronously by timetoken from this channel's history on the PubNub server.
 	 *
 	 * @param Timetoken The timetoken of the message to fetch. Must be non-empty.
 	 * @param OnMessageResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetMessageAsync(const FString Timetoken, FOnPubnubChatMessageResponseNative OnMessageResponseNative);
+	FPubnubChatAsyncHandle GetMessageAsync(const FString Timetoken, FOnPubnubChatMessageResponseNative OnMessageResponseNative, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Forwards a message to this channel. Publishes the message to this channel with forwarding metadata (original channel, timetoken).
@@ -873,17 +1045,21 @@ public:
 	 *
 	 * @param Message The message to forward. Must be valid (non-null) and from a different channel.
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void ForwardMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle ForwardMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Forwards a message asynchronously to this channel. Publishes the message to this channel with forwarding metadata (original channel, timetoken).
 	 * The message must not already be from this channel (target must differ from source).
 	 *
 	 * @param Message The message to forward. Must be valid (non-null) and from a different channel.
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void ForwardMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle ForwardMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Publishes a custom event payload to this channel.
@@ -905,9 +1081,11 @@ public:
 	 * @param OnOperationResponse Callback executed when the operation completes.
 	 * @param Type Optional custom message type written to PublishSettings.CustomMessageType.
 	 * @param StoreInHistory Whether the message should be stored in history.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void EmitCustomEventAsync(FString Payload, FOnPubnubChatOperationResponse OnOperationResponse, FString Type = "", bool StoreInHistory = true);
+	FPubnubChatAsyncHandle EmitCustomEventAsync(FString Payload, FOnPubnubChatOperationResponse OnOperationResponse, FString Type = "", bool StoreInHistory = true, float DeadlineSeconds = -1.0f);
 	/**
 	 * Publishes a custom event payload to this channel asynchronously.
 	 * Always uses Publish (never Signal).
@@ -916,8 +1094,10 @@ public:
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param Type Optional custom message type written to PublishSettings.CustomMessageType.
 	 * @param StoreInHistory Whether the message should be stored in history.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void EmitCustomEventAsync(FString Payload, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, FString Type = "", bool StoreInHistory = true);
+	FPubnubChatAsyncHandle EmitCustomEventAsync(FString Payload, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, FString Type = "", bool StoreInHistory = true, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Emits a mention event for a user on a message in this channel (e.g. for @mention notifications).
@@ -938,9 +1118,11 @@ public:
 	 * @param Timetoken The timetoken of the message that contains the mention.
 	 * @param Text The mention text (e.g. the displayed snippet).
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void EmitUserMentionAsync(const FString UserID, const FString Timetoken, const FString Text, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle EmitUserMentionAsync(const FString UserID, const FString Timetoken, const FString Text, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Emits a mention event asynchronously for a user on a message in this channel (e.g. for @mention notifications).
 	 *
@@ -948,8 +1130,10 @@ public:
 	 * @param Timetoken The timetoken of the message that contains the mention.
 	 * @param Text The mention text (e.g. the displayed snippet).
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void EmitUserMentionAsync(const FString UserID, const FString Timetoken, const FString Text, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle EmitUserMentionAsync(const FString UserID, const FString Timetoken, const FString Text, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Starts listening for channel metadata updates (and delete events) on this channel. Updates are delivered via OnUpdated; deletions via OnDeleted.
@@ -966,16 +1150,20 @@ public:
 	 * No-op if already streaming updates.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Starts listening asynchronously for channel metadata updates (and delete events) on this channel. Updates are delivered via OnUpdated; deletions via OnDeleted.
 	 * No-op if already streaming updates.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StreamUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StreamUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Starts listening for channel metadata updates on each of the given channels. Calls StreamUpdates() on each channel.
@@ -987,6 +1175,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
 	static FPubnubChatOperationResult StreamUpdatesOn(const TArray<UPubnubChatChannel*>& Channels);
 	
+	/**
+	 * Starts one updates stream for all given channels, with a single subscription set instead of one subscription per channel.
+	 * Updates are still delivered to OnUpdated/OnDeleted of each channel, and all channels changed during a frame
+	 * are additionally delivered together to OnChannelsUpdated once per frame.
+	 * Not initialized channels are skipped and reported as errors in the returned result.
+	 * Blocking: subscribes on the calling thread. Blocks for the duration of the operation.
+	 *
+	 * @param Channels Array of channel objects on which to start streaming updates.
+	 * @param OnChannelsUpdated Callback executed once per frame with all channels updated or deleted during that frame.
+	 * @return Operation result and CallbackStop that stops the whole stream with a single call.
+	 *         StopStreamingUpdates of a single channel removes it from the stream, and the stream is stopped when no channel is left.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnChannelsUpdated"))
+	static FPubnubChatListenForEventsResult StartUpdatesStreamOn(const TArray<UPubnubChatChannel*>& Channels, FOnPubnubChatChannelsUpdated OnChannelsUpdated);
+	/**
+	 * Starts one updates stream for all given channels, with a single subscription set instead of one subscription per channel.
+	 * Updates are still delivered to OnUpdated/OnDeleted of each channel, and all channels changed during a frame
+	 * are additionally delivered together to OnChannelsUpdatedNative once per frame.
+	 * Not initialized channels are skipped and reported as errors in the returned result.
+	 * Blocking: subscribes on the calling thread. Blocks for the duration of the operation.
+	 *
+	 * @param Channels Array of channel objects on which to start streaming updates.
+	 * @param OnChannelsUpdatedNative Native callback executed once per frame with all channels updated or deleted during that frame (accepts lambdas).
+	 * @return Operation result and CallbackStop that stops the whole stream with a single call.
+	 *         StopStreamingUpdates of a single channel removes it from the stream, and the stream is stopped when no channel is left.
+	 */
+	static FPubnubChatListenForEventsResult StartUpdatesStreamOn(const TArray<UPubnubChatChannel*>& Channels, FOnPubnubChatChannelsUpdatedNative OnChannelsUpdatedNative = nullptr);
+	
 	/**
 	 * Stops listening for channel metadata updates on this channel. OnUpdated and OnDeleted will no longer fire.
 	 * Blocking: unsubscribes on the calling thread. Blocks for the duration of the operation.
@@ -1002,16 +1218,20 @@ public:
 	 * No-op if not streaming updates.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Stops listening asynchronously for channel metadata updates on this channel. OnUpdated and OnDeleted will no longer fire.
 	 * No-op if not streaming updates.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StopStreamingUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StopStreamingUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Starts listening for presence updates on this channel.
@@ -1026,15 +1246,19 @@ public:
 	 * Starts listening asynchronously for presence updates on this channel. No-op if already streaming presence.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StreamPresenceAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StreamPresenceAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Starts listening asynchronously for presence updates on this channel. No-op if already streaming presence.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StreamPresenceAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StreamPresenceAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Stops listening for presence updates on this channel.
@@ -1049,15 +1273,19 @@ public:
 	 * Stops listening asynchronously for presence updates on this channel. No-op if not streaming presence.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StopStreamingPresenceAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StopStreamingPresenceAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Stops listening asynchronously for presence updates on this channel. No-op if not streaming presence.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StopStreamingPresenceAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StopStreamingPresenceAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Emits a typing-start event for the current user on this channel. Not supported on public channels; use for group or direct channels.
@@ -1074,16 +1302,20 @@ public:
 	 * Rate-limited: repeated calls within a short window may be ignored to avoid spamming.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StartTypingAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StartTypingAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Emits a typing-start event asynchronously for the current user on this channel. Not supported on public channels; use for group or direct channels.
 	 * Rate-limited: repeated calls within a short window may be ignored to avoid spamming.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StartTypingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StartTypingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Emits a typing-stop event for the current user on this channel. Not supported on public channels.
@@ -1100,16 +1332,20 @@ public:
 	 * No-op if StartTyping was not recently called or the typing timeout has already elapsed.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StopTypingAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StopTypingAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Emits a typing-stop event asynchronously for the current user on this channel. Not supported on public channels.
 	 * No-op if StartTyping was not recently called or the typing timeout has already elapsed.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StopTypingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StopTypingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Starts listening for typing events on this channel. Typing indicators are delivered via OnTypingReceived / OnTypingReceivedNative.
@@ -1126,16 +1362,20 @@ public:
 	 * Not supported on public channels; use for group or direct channels. No-op if already streaming typing.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StreamTypingAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StreamTypingAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Starts listening asynchronously for typing events on this channel. Typing indicators are delivered via OnTypingReceived / OnTypingReceivedNative.
 	 * Not supported on public channels; use for group or direct channels. No-op if already streaming typing.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StreamTypingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StreamTypingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Stops listening for typing events on this channel. OnTypingReceived will no longer fire.
@@ -1151,16 +1391,20 @@ public:
 	 * No-op if not streaming typing.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StopStreamingTypingAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StopStreamingTypingAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Stops listening asynchronously for typing events on this channel. OnTypingReceived will no longer fire.
 	 * No-op if not streaming typing.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StopStreamingTypingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StopStreamingTypingAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Starts listening for read receipt events on this channel. Read receipts are delivered via OnReadReceiptReceived / OnReadReceiptReceivedNative.
@@ -1177,16 +1421,20 @@ public:
 	 * Not supported on public channels; use for group or direct channels.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StreamReadReceiptsAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StreamReadReceiptsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Starts listening asynchronously for read receipt events on this channel. Read receipts are delivered via OnReadReceiptReceived / OnReadReceiptReceivedNative.
 	 * Not supported on public channels; use for group or direct channels.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StreamReadReceiptsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StreamReadReceiptsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Stops listening for read receipt events on this channel. OnReadReceiptReceived will no longer fire.
@@ -1202,16 +1450,20 @@ public:
 	 * No-op if not streaming read receipts.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StopStreamingReadReceiptsAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StopStreamingReadReceiptsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Stops listening asynchronously for read receipt events on this channel. OnReadReceiptReceived will no longer fire.
 	 * No-op if not streaming read receipts.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StopStreamingReadReceiptsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StopStreamingReadReceiptsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Starts listening for message report events for this channel. Report events are delivered via OnMessageReportReceived / OnMessageReportReceivedNative.
@@ -1227,16 +1479,20 @@ public:
 	 * Sets up client-side listener on the channel's moderation/restrictions stream. No-op if already streaming.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StreamMessageReportsAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StreamMessageReportsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Starts listening asynchronously for message report events for this channel. Report events are delivered via OnMessageReportReceived / OnMessageReportReceivedNative.
 	 * Sets up client-side listener on the channel's moderation/restrictions stream. No-op if already streaming.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StreamMessageReportsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StreamMessageReportsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Stops listening for message report events for this channel. OnMessageReportReceived will no longer fire.
@@ -1252,16 +1508,20 @@ public:
 	 * No-op if not streaming message reports.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StopStreamingMessageReportsAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StopStreamingMessageReportsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Stops listening asynchronously for message report events on this channel. OnMessageReportReceived will no longer fire.
 	 * No-op if not streaming message reports.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StopStreamingMessageReportsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StopStreamingMessageReportsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Fetches message report events history for this channel within a timetoken range from the channel's moderation/restrictions stream.
@@ -1284,9 +1544,11 @@ public:
 	 * @param EndTimetoken End timetoken (inclusive) for the history range. Must be lower (older) than StartTimetoken.
 	 * @param OnEventsResponse Callback executed when the operation completes.
 	 * @param Count Maximum number of events to return (default 100).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void GetMessageReportsHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatEventsResponse OnEventsResponse, const int Count = 100);
+	FPubnubChatAsyncHandle GetMessageReportsHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatEventsResponse OnEventsResponse, const int Count = 100, float DeadlineSeconds = -1.0f);
 	/**
 	 * Fetches message report events history asynchronously for this channel within a timetoken range from the channel's moderation/restrictions stream.
 	 * StartTimetoken must be higher (newer) than EndTimetoken.
@@ -1295,8 +1557,10 @@ public:
 	 * @param EndTimetoken End timetoken (inclusive) for the history range. Must be lower (older) than StartTimetoken.
 	 * @param OnEventsResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param Count Maximum number of events to return (default 100).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetMessageReportsHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatEventsResponseNative OnEventsResponseNative, const int Count = 100);
+	FPubnubChatAsyncHandle GetMessageReportsHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatEventsResponseNative OnEventsResponseNative, const int Count = 100, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Starts listening for custom events on this channel. Custom events are delivered via OnCustomEventReceived / OnCustomEventReceivedNative.
@@ -1311,15 +1575,19 @@ public:
 	 * Starts listening asynchronously for custom events on this channel. No-op if already streaming custom events.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StreamCustomEventsAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StreamCustomEventsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Starts listening asynchronously for custom events on this channel. No-op if already streaming custom events.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StreamCustomEventsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StreamCustomEventsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Stops listening for custom events on this channel. OnCustomEventReceived will no longer fire.
@@ -1335,16 +1603,20 @@ public:
 	 * No-op if not streaming custom events.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StopStreamingCustomEventsAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StopStreamingCustomEventsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Stops listening asynchronously for custom events on this channel. OnCustomEventReceived will no longer fire.
 	 * No-op if not streaming custom events.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StopStreamingCustomEventsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StopStreamingCustomEventsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Creates a new message draft object for this channel. Use the draft to build a message (text, mentions, etc.) and send it via the draft's Send().
@@ -1378,6 +1650,9 @@ protected:
 	UPubnubChatCallbackStop* ReadReceiptsCallbackStop = nullptr;
 	UPROPERTY()
 	UPubnubChatCallbackStop* MessageReportsCallbackStop = nullptr;
+	//Messages delivered since the last OnMessagesReceivedBatch
+	UPROPERTY()
+	TArray<UPubnubChatMessage*> PendingBatchMessages;
 
 	bool IsInitialized = false;
 	bool IsStreamingUpdates = false;
@@ -1389,12 +1664,23 @@ protected:
 	bool IsStreamingCustomEvents = false;
 	
 	TArray<FString> StreamPresenceUserIDs;
+	/** Critical section for StreamPresenceUserIDs, presence events arrive on the subscription thread */
+	mutable FCriticalSection StreamPresenceCriticalSection;
 	
 	FDateTime LastTypingEventTime = FDateTime::MinValue();
 	TMap<FString, FTypingIndicatorData> TypingIndicators;
 	
 	/** Critical section for thread-safe access to typing indicators */
 	mutable FCriticalSection TypingIndicatorsCriticalSection;
+	
+	/** Flow control state of received messages */
+	int DroppedMessagesCount = 0;
+	int SampledOverflowCount = 0;
+	mutable FCriticalSection FlowControlCriticalSection;
+
+	/** Messages sent with LocalEcho enabled, keyed by their client generated ID */
+	TMap<FString, FPubnubChatPendingLocalEcho> PendingLocalEchoes;
+	mutable FCriticalSection LocalEchoCriticalSection;
 
 	/** Rate limiting state for SendText operations */
 	FDateTime LastSendTextTime = FDateTime::MinValue();
@@ -1409,9 +1695,37 @@ protected:
 
 	void InitChannel(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString InChannelID);
 	
+	//Applies channel update/delete event to this channel and calls its delegates. Returns true if event was related to this channel
+	bool HandleUpdatesEvent(const FPubnubMessageData& MessageData);
+	
 	FPubnubChatGetRestrictionsResult GetRestrictions(const int Limit = 0, const FString Filter = "", FPubnubMemberSort Sort = FPubnubMemberSort(), FPubnubPage Page = FPubnubPage());
 	
-	FPubnubChatOperationResult SendTextInternal(const FString Message, FPubnubChatSendTextParams SendTextParams = FPubnubChatSendTextParams(), UPubnubChatMessage* QuotedMessage = nullptr, TMap<FString,FString> MentionedUsers = TMap<FString, FString>());
+	//LocalEchoID is the client generated ID of an already created local echo of this message (SendTextAsync and RetrySend create it before sending)
+	FPubnubChatOperationResult SendTextInternal(const FString Message, FPubnubChatSendTextParams SendTextParams = FPubnubChatSendTextParams(), UPubnubChatMessage* QuotedMessage = nullptr, TMap<FString,FString> MentionedUsers = TMap<FString, FString>(), const FString& LocalEchoID = "");
+	FPubnubChatOperationResult PublishText(const FString& Message, const FPubnubChatSendTextParams& SendTextParams, UPubnubChatMessage* QuotedMessage, const TMap<FString,FString>& MentionedUsers, const FString& LocalEchoID);
+	
+	/**
+	 * Creates provisional message in Pending send state and delivers it to OnMessageReceived. Does nothing if the channel is not connected.
+	 * @return Client generated ID of the created local echo, empty if it wasn't created
+	 */
+	FString CreateLocalEcho(const FString& Message, const FPubnubChatSendTextParams& SendTextParams, UPubnubChatMessage* QuotedMessage, const TMap<FString,FString>& MentionedUsers);
+	//Creates the provisional message object. Virtual as Thread Channel will override it to create ThreadMessage
+	virtual UPubnubChatMessage* CreateLocalEchoMessageObject(const FString& ProvisionalTimetoken, const FPubnubChatMessageData& MessageData);
+	//Marks local echo as sent after its publish succeeded and moves the provisional message to the server timetoken
+	void ConfirmLocalEcho(const FString& LocalEchoID, const FString& ServerTimetoken);
+	//Marks pending local echo as failed after its publish failed
+	void FailLocalEcho(const FString& LocalEchoID);
+	/**
+	 * Checks if received message is the server echo of a message sent from this channel with LocalEcho enabled and confirms it.
+	 * @return True if the message is a known local echo and should not be delivered again
+	 */
+	bool ConsumeLocalEcho(const FString& Meta, const FString& ServerTimetoken);
+	//Moves provisional message to the server timetoken and sets it as Sent on the game thread. Has to be called with LocalEchoCriticalSection locked
+	void ApplyLocalEchoSent(const FPubnubChatPendingLocalEcho& LocalEcho, const FString& ServerTimetoken);
+	FPubnubChatOperationResult RetryLocalEcho(const FString& LocalEchoID);
+	FPubnubChatOperationResult DiscardLocalEcho(const FString& LocalEchoID);
+	//Sets send state of the provisional message on the game thread
+	void DispatchLocalEchoSendState(const TWeakObjectPtr<UPubnubChatMessage>& Message, EPubnubChatMessageSendState SendState);
 	
 	//This function is for ThreadChannel which does additional logic during SentText (SendText as UFUNCTION can't be directly overriden)
 	virtual FPubnubChatOperationResult OnSendText();
@@ -1421,9 +1735,30 @@ protected:
 	
 	//Add calling OnMessageReceived to ConnectSubscription. Virtual as Thread Channel will override it to use OnThreadMessageReceived
 	virtual void AddOnMessageReceivedLambdaToSubscription(TWeakObjectPtr<UPubnubChatChannel> ThisChannelWeak);
+	//Creates object of received live message and delivers it. Virtual as Thread Channel will override it to create ThreadMessage
+	virtual void DeliverLiveMessage(const FPubnubMessageData& MessageData);
+	//Creates message objects for messages missed during a connection gap and calls OnMessageReceived for them in order. Virtual as Thread Channel will override it to use OnThreadMessageReceived
+	virtual void ReplayMissedMessages(const TArray<FPubnubHistoryMessageData>& HistoryMessages);
+	
+	/**
+	 * Applies FPubnubChatConfig::FlowControl to a received message before its object is created. Can drop the oldest queued message to make room.
+	 * @param bOutDroppable False for messages exempt from flow control - they can't be dropped later either
+	 * @return False if the message should be dropped
+	 */
+	bool AdmitReceivedMessage(const FPubnubMessageData& MessageData, bool& bOutDroppable);
+	//Delivers received message through the Chat dispatch queue and adds it to the next OnMessagesReceivedBatch
+	void DispatchMessageReceived(UPubnubChatMessage* Message, bool bDroppable = true);
+	//Calls OnMessageReceived. Virtual as Thread Channel will override it to use OnThreadMessageReceived
+	virtual void BroadcastMessageReceived(UPubnubChatMessage* Message);
+	void BroadcastMessagesBatch();
+	//Typing and presence events are coalesced - only the latest pending list is delivered
+	void DispatchTypingChanged(const TArray<FString>& TypingUserIDs);
+	void DispatchPresenceChanged(const TArray<FString>& UserIDs);
 	
 	UFUNCTION()
 	void OnChatDestroyed(FString UserID);
+	//Relays Chat unread messages count changes of this channel to OnUnreadMessagesCountChanged
+	void OnChatUnreadMessagesCountChanged(const FString& InChannelID, int Count);
 	void ClearAllSubscriptions();
 	void CleanUp();
 };
@@ -89,4 +89,20 @@ enum class EPubnubChatMentionTargetType : uint8
 	PCMTT_User				UMETA(DisplayName="User"),
 	PCMTT_Channel			UMETA(DisplayName="Channel"),
 	PCMTT_Url				UMETA(DisplayName="Url")
-};
\ No newline at end of file
+};
+
+UENUM(BlueprintType)
+enum class EPubnubChatDropPolicy : uint8
+{
+	PCDP_DropOldest			UMETA(DisplayName="DropOldest"),
+	PCDP_DropNewest			UMETA(DisplayName="DropNewest"),
+	PCDP_Sample				UMETA(DisplayName="Sample")
+};
+
+UENUM(BlueprintType)
+enum class EPubnubChatMessageSendState : uint8
+{
+	PCMSS_Sent				UMETA(DisplayName="Sent"),
+	PCMSS_Pending			UMETA(DisplayName="Pending"),
+	PCMSS_Failed			UMETA(DisplayName="Failed")
+};
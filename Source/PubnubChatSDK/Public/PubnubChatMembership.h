@@ -18,6 +18,8 @@ class UPubnubSubscription;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnPubnubChatMembershipUpdated, FString, ChannelID, FString, UserID, FPubnubChatMembershipData, MembershipData);
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnPubnubChatMembershipUpdatedNative, FString ChannelID, FString UserID, const FPubnubChatMembershipData& MembershipData);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnPubnubChatMembershipsUpdated, const TArray<UPubnubChatMembership*>&, Memberships);
+DECLARE_DELEGATE_OneParam(FOnPubnubChatMembershipsUpdatedNative, const TArray<UPubnubChatMembership*>& Memberships);
 
 /**
  * Represents a user's membership in a channel in the PubNub Chat SDK. Provides access to membership metadata (custom, status, type),
@@ -64,6 +66,16 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub Chat|Membership")
 	FPubnubChatMembershipData GetMembershipData() const;
+
+	/**
+	 * Returns the local version of this membership's cached data. The version changes every time the cached data changes,
+	 * so comparing it with the version seen during the last refresh tells if GetMembershipData has to be read again.
+	 * Local: does not perform any network requests.
+	 *
+	 * @return Version of the cached data, or 0 if membership is not initialized or not in cache.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub Chat|Membership")
+	int64 GetDataVersion() const;
 	
 	/**
 	 * Returns the user object for this membership.
@@ -125,16 +137,20 @@ public:
 	 * Similar to Channel->Leave() for the current user: both remove the user's membership from the channel.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Membership", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void DeleteAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle DeleteAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Removes this membership asynchronously from the channel on the server (the user is removed from the channel's members).
 	 * Similar to Channel->Leave() for the current user: both remove the user's membership from the channel.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void DeleteAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle DeleteAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Updates this membership on the server with the given data (custom, status, type) and updates the local cache.
@@ -151,20 +167,26 @@ public:
 	 *
 	 * @param UpdateMembershipData The new membership data (custom, status, type) and optional ForceSet flags for full replacement.
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Membership", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void UpdateAsync(const FPubnubChatUpdateMembershipInputData& UpdateMembershipData, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle UpdateAsync(const FPubnubChatUpdateMembershipInputData& UpdateMembershipData, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Updates this membership asynchronously on the server with the given data (custom, status, type) and updates the local cache.
 	 *
 	 * @param UpdateMembershipData The new membership data (custom, status, type) and optional ForceSet flags for full replacement.
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void UpdateAsync(const FPubnubChatUpdateMembershipInputData& UpdateMembershipData, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle UpdateAsync(const FPubnubChatUpdateMembershipInputData& UpdateMembershipData, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Sets the last-read message timetoken for this membership on the server and updates the local cache.
 	 * For non-public channels, also emits a Receipt chat event so other clients can track read position (if the user has write permission).
+	 * Timetokens that are not newer than the current last-read message timetoken are skipped. Markers set with SetLastReadMessageTimetokenAsync
+	 * and not written yet are written together with this one.
 	 * Blocking: performs network requests on the calling thread. Blocks for the duration of the operation.
 	 *
 	 * @param Timetoken The message timetoken to set as last read. Must be non-empty.
@@ -176,20 +198,28 @@ public:
 	/**
 	 * Sets the last-read message timetoken asynchronously for this membership on the server and updates the local cache.
 	 * For non-public channels, also emits a Receipt chat event so other clients can track read position (if the user has write permission).
+	 * GetLastReadMessageTimetoken returns the new timetoken right away. Only the highest timetoken is written, at most once per
+	 * FPubnubChatConfig::ReadMarkerFlushInterval, and timetokens that are not newer than the current one are skipped.
 	 *
 	 * @param Timetoken The message timetoken to set as last read. Must be non-empty.
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Membership", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void SetLastReadMessageTimetokenAsync(const FString Timetoken, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle SetLastReadMessageTimetokenAsync(const FString Timetoken, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Sets the last-read message timetoken asynchronously for this membership on the server and updates the local cache.
 	 * For non-public channels, also emits a Receipt chat event so other clients can track read position (if the user has write permission).
+	 * GetLastReadMessageTimetoken returns the new timetoken right away. Only the highest timetoken is written, at most once per
+	 * FPubnubChatConfig::ReadMarkerFlushInterval, and timetokens that are not newer than the current one are skipped.
 	 *
 	 * @param Timetoken The message timetoken to set as last read. Must be non-empty.
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void SetLastReadMessageTimetokenAsync(const FString Timetoken, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle SetLastReadMessageTimetokenAsync(const FString Timetoken, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Sets the last-read message for this membership to the given message's timetoken on the server and updates the local cache.
@@ -208,17 +238,21 @@ public:
 	 *
 	 * @param Message The message to set as last read. Must be valid (non-null).
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Membership", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void SetLastReadMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle SetLastReadMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Sets the last-read message asynchronously for this membership to the given message's timetoken on the server and updates the local cache.
 	 * For non-public channels, also emits a Receipt chat event (if the user has write permission).
 	 *
 	 * @param Message The message to set as last read. Must be valid (non-null).
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void SetLastReadMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle SetLastReadMessageAsync(UPubnubChatMessage* Message, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Starts listening for membership metadata updates (update/delete) for this membership. Updates are delivered via OnUpdated; deletions via OnDeleted.
@@ -235,16 +269,20 @@ public:
 	 * No-op if already streaming updates.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Membership", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Starts listening asynchronously for membership metadata updates (update/delete) for this membership. Updates are delivered via OnUpdated; deletions via OnDeleted.
 	 * No-op if already streaming updates.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StreamUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StreamUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Starts listening for membership metadata updates on each of the given memberships. Calls StreamUpdates() on each membership.
@@ -256,6 +294,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Membership")
 	static FPubnubChatOperationResult StreamUpdatesOn(const TArray<UPubnubChatMembership*>& Memberships);
 	
+	/**
+	 * Starts one updates stream for all given memberships, with a single subscription set instead of one subscription per membership.
+	 * Updates are still delivered to OnUpdated/OnDeleted of each membership, and all memberships changed during a frame
+	 * are additionally delivered together to OnMembershipsUpdated once per frame.
+	 * Not initialized memberships are skipped and reported as errors in the returned result.
+	 * Blocking: subscribes on the calling thread. Blocks for the duration of the operation.
+	 *
+	 * @param Memberships Array of membership objects on which to start streaming updates.
+	 * @param OnMembershipsUpdated Callback executed once per frame with all memberships updated or deleted during that frame.
+	 * @return Operation result and CallbackStop that stops the whole stream with a single call.
+	 *         StopStreamingUpdates of a single membership removes it from the stream, and the stream is stopped when no membership is left.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Membership", meta = (AutoCreateRefTerm = "OnMembershipsUpdated"))
+	static FPubnubChatListenForEventsResult StartUpdatesStreamOn(const TArray<UPubnubChatMembership*>& Memberships, FOnPubnubChatMembershipsUpdated OnMembershipsUpdated);
+	/**
+	 * Starts one updates stream for all given memberships, with a single subscription set instead of one subscription per membership.
+	 * Updates are still delivered to OnUpdated/OnDeleted of each membership, and all memberships changed during a frame
+	 * are additionally delivered together to OnMembershipsUpdatedNative once per frame.
+	 * Not initialized memberships are skipped and reported as errors in the returned result.
+	 * Blocking: subscribes on the calling thread. Blocks for the duration of the operation.
+	 *
+	 * @param Memberships Array of membership objects on which to start streaming updates.
+	 * @param OnMembershipsUpdatedNative Native callback executed once per frame with all memberships updated or deleted during that frame (accepts lambdas).
+	 * @return Operation result and CallbackStop that stops the whole stream with a single call.
+	 *         StopStreamingUpdates of a single membership removes it from the stream, and the stream is stopped when no membership is left.
+	 */
+	static FPubnubChatListenForEventsResult StartUpdatesStreamOn(const TArray<UPubnubChatMembership*>& Memberships, FOnPubnubChatMembershipsUpdatedNative OnMembershipsUpdatedNative = nullptr);
+	
 	/**
 	 * Stops listening for membership metadata updates for this membership. OnUpdated and OnDeleted will no longer fire.
 	 * Blocking: unsubscribes on the calling thread. Blocks for the duration of the operation.
@@ -271,16 +337,20 @@ public:
 	 * No-op if not streaming updates. Success if unsubscribe succeeded or was not streaming.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Membership", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Stops listening asynchronously for membership metadata updates for this membership. OnUpdated and OnDeleted will no longer fire.
 	 * No-op if not streaming updates. Success if unsubscribe succeeded or was not streaming.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StopStreamingUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StopStreamingUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Returns the count of unread messages in this channel for the current user, based on the last-read message timetoken.
@@ -297,16 +367,20 @@ public:
 	 * Uses the membership's last-read timetoken (or empty timetoken if not set) to compute messages after that point.
 	 *
 	 * @param OnUnreadMessagesCountResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Membership")
-	void GetUnreadMessagesCountAsync(FOnPubnubChatGetUnreadMessagesCountResponse OnUnreadMessagesCountResponse);
+	FPubnubChatAsyncHandle GetUnreadMessagesCountAsync(FOnPubnubChatGetUnreadMessagesCountResponse OnUnreadMessagesCountResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Returns the count of unread messages asynchronously in this channel for the current user, based on the last-read message timetoken.
 	 * Uses the membership's last-read timetoken (or empty timetoken if not set) to compute messages after that point.
 	 *
 	 * @param OnUnreadMessagesCountResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetUnreadMessagesCountAsync(FOnPubnubChatGetUnreadMessagesCountResponseNative OnUnreadMessagesCountResponseNative);
+	FPubnubChatAsyncHandle GetUnreadMessagesCountAsync(FOnPubnubChatGetUnreadMessagesCountResponseNative OnUnreadMessagesCountResponseNative, float DeadlineSeconds = -1.0f);
 	
 private:
 	UPROPERTY()
@@ -326,6 +400,9 @@ private:
 	bool IsStreamingUpdates = false;
 
 	void InitMembership(UPubnubClient* InPubnubClient, UPubnubChat* InChat, UPubnubChatUser* InUser, UPubnubChatChannel* InChannel);
+	
+	//Applies membership update/delete event to this membership and calls its delegates. Returns true if event was a membership update
+	bool HandleUpdatesEvent(const FPubnubMessageData& MessageData);
 
 	/**
 	 * Gets the internal composite membership ID used for repository operations.
@@ -8,19 +8,27 @@
 #include "StructLibraries/PubnubChatMessageStructLibrary.h"
 #include "PubnubChatEnumLibrary.h"
 #include "StructLibraries/PubnubChatChannelStructLibrary.h"
+#include "Misc/ScopeRWLock.h"
 
 #include "PubnubChatMessage.generated.h"
 
 class UPubnubClient;
 class UPubnubChat;
 class UPubnubSubscription;
+class UPubnubChatMessage;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPubnubChatMessageUpdated, FString, Timetoken, FPubnubChatMessageData, MessageData);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnPubnubChatMessageUpdatedNative, FString Timetoken, const FPubnubChatMessageData& MessageData);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPubnubChatMessageSendStateChanged, EPubnubChatMessageSendState, SendState);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPubnubChatMessageSendStateChangedNative, EPubnubChatMessageSendState SendState);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnPubnubChatMessagesUpdated, const TArray<UPubnubChatMessage*>&, Messages);
+DECLARE_DELEGATE_OneParam(FOnPubnubChatMessagesUpdatedNative, const TArray<UPubnubChatMessage*>& Messages);
 
 /**
  * Represents a chat message in the PubNub Chat SDK. Provides access to message content, edits, reactions, pin/unpin,
  * forward, report, thread operations, and streaming updates for message actions (edits, reactions, etc.).
+ * While a Message object is alive, all chat functions and listeners that return the same message return this same object,
+ * so delegates bound to it and state like the local echo send state are shared by everyone who holds it.
  */
 UCLASS(BlueprintType)
 class PUBNUBCHATSDK_API UPubnubChatMessage : public UObject
@@ -28,7 +36,9 @@ class PUBNUBCHATSDK_API UPubnubChatMessage : public UObject
 	GENERATED_BODY()
 
 	friend class UPubnubChat;
+	friend class UPubnubChatChannel;
 	friend class UPubnubChatThreadChannel;
+	friend class UPubnubChatReconnectCatchUp;
 public:
 
 	virtual void BeginDestroy() override;
@@ -44,6 +54,15 @@ public:
 	FOnPubnubChatMessageUpdated OnUpdated;
 	FOnPubnubChatMessageUpdatedNative OnUpdatedNative;
 	
+	/**
+	 * Broadcast when the send state of a locally echoed message changes (see FPubnubChatSendTextParams::LocalEcho).
+	 * When the message becomes Sent, its timetoken is already replaced with the one assigned by the server.
+	 * @param SendState New send state of this message.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Pubnub Chat|Delegates")
+	FOnPubnubChatMessageSendStateChanged OnSendStateChanged;
+	FOnPubnubChatMessageSendStateChangedNative OnSendStateChangedNative;
+	
 	/* PUBLIC FUNCTIONS */
 	
 	/**
@@ -54,6 +73,16 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub Chat|Message")
 	FPubnubChatMessageData GetMessageData() const;
+
+	/**
+	 * Returns the local version of this message's cached data. The version changes every time the cached data changes,
+	 * so comparing it with the version seen during the last refresh tells if GetMessageData has to be read again.
+	 * Local: does not perform any network requests.
+	 *
+	 * @return Version of the cached data, or 0 if message is not initialized or not in cache.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub Chat|Message")
+	int64 GetDataVersion() const;
 	
 	/**
 	 * Returns the unique timetoken of this message.
@@ -62,7 +91,17 @@ public:
 	 * @return Message timetoken string.
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub Chat|Message")
-	FString GetMessageTimetoken() const { return Timetoken; }
+	FString GetMessageTimetoken() const;
+
+	/**
+	 * Returns the send state of this message. Only messages echoed locally by SendText with LocalEcho enabled can be Pending or Failed,
+	 * until they are confirmed by the server their timetoken is provisional and message actions (edit, reactions, etc.) should not be used.
+	 * Local: does not perform any network requests.
+	 *
+	 * @return Send state of this message.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub Chat|Message")
+	EPubnubChatMessageSendState GetSendState() const { return SendState; }
 
 	/**
 	 * Returns the quoted message data from this message's metadata, if any.
@@ -119,16 +158,20 @@ public:
 	 *
 	 * @param NewText The new text content for the message. Must be non-empty.
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Message", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void EditTextAsync(const FString NewText, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle EditTextAsync(const FString NewText, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Edits this message asynchronously by adding an Edited message action with the new text on the server and updating the local cache.
 	 *
 	 * @param NewText The new text content for the message. Must be non-empty.
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void EditTextAsync(const FString NewText, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle EditTextAsync(const FString NewText, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Deletes this message on the server. Hard delete removes the message; soft delete adds a Deleted message action.
@@ -147,17 +190,21 @@ public:
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
 	 * @param Soft When true, adds a Deleted message action instead of removing the message from the server (default false).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Message", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void DeleteAsync(FOnPubnubChatOperationResponse OnOperationResponse, bool Soft = false);
+	FPubnubChatAsyncHandle DeleteAsync(FOnPubnubChatOperationResponse OnOperationResponse, bool Soft = false, float DeadlineSeconds = -1.0f);
 	/**
 	 * Deletes this message asynchronously on the server. Hard delete removes the message; soft delete adds a Deleted message action.
 	 * If this message has a thread, the thread is also deleted (after the message delete succeeds).
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param Soft When true, adds a Deleted message action instead of removing the message from the server (default false).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void DeleteAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, bool Soft = false);
+	FPubnubChatAsyncHandle DeleteAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, bool Soft = false, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Restores a soft-deleted message by removing all Deleted message actions from the server and updating the local cache.
@@ -174,16 +221,20 @@ public:
 	 * If this message has a thread, the thread is also restored.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Message", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void RestoreAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle RestoreAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Restores a soft-deleted message asynchronously by removing all Deleted message actions from the server and updating the local cache.
 	 * If this message has a thread, the thread is also restored.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void RestoreAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle RestoreAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Checks whether this message is marked as deleted (soft-deleted) by looking for a Deleted message action in the local cache.
@@ -209,16 +260,20 @@ public:
 	 * Fails if the channel for this message does not exist.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Message", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void PinAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle PinAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Pins this message asynchronously to its channel. Resolves the channel, then pins the message.
 	 * Fails if the channel for this message does not exist.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void PinAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle PinAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Unpins this message from its channel if it is currently the pinned message. Resolves the channel and pinned message; if this message is pinned, unpins it.
@@ -235,16 +290,20 @@ public:
 	 * No-op if this message is not the one currently pinned on the channel.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Message", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void UnpinAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle UnpinAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Unpins this message asynchronously from its channel if it is currently the pinned message. Resolves the channel and pinned message; if this message is pinned, unpins it.
 	 * No-op if this message is not the one currently pinned on the channel.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void UnpinAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle UnpinAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Toggles a reaction (e.g. emoji) for the current user on this message. If the current user already has this reaction, removes it; otherwise adds it.
@@ -258,23 +317,34 @@ public:
 	
 	/**
 	 * Toggles a reaction asynchronously for the current user on this message. If the current user already has this reaction, removes it; otherwise adds it.
+	 * The toggle is shown by GetReactions right away. Toggles of the same reaction made within FPubnubChatConfig::ReactionToggleDebounce
+	 * are merged and only their net change is sent, the callback is executed when the reaction is settled with the server.
+	 * Failed request restores the reaction stored on the server. Online toggles can't be cancelled with the returned handle.
 	 *
 	 * @param Reaction The reaction value (e.g. emoji code or string). Must be non-empty.
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Message", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void ToggleReactionAsync(const FString Reaction, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle ToggleReactionAsync(const FString Reaction, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Toggles a reaction asynchronously for the current user on this message. If the current user already has this reaction, removes it; otherwise adds it.
+	 * The toggle is shown by GetReactions right away. Toggles of the same reaction made within FPubnubChatConfig::ReactionToggleDebounce
+	 * are merged and only their net change is sent, the callback is executed when the reaction is settled with the server.
+	 * Failed request restores the reaction stored on the server. Online toggles can't be cancelled with the returned handle.
 	 *
 	 * @param Reaction The reaction value (e.g. emoji code or string). Must be non-empty.
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void ToggleReactionAsync(const FString Reaction, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle ToggleReactionAsync(const FString Reaction, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Returns all reactions (message actions of type Reaction) on this message from the local cache.
 	 * Local: does not perform any network requests. Data may be stale if reactions were updated elsewhere.
+	 * Includes toggles of the current user that were not sent to the server yet.
 	 *
 	 * @return Operation result and list of reaction message actions (value, user ID, timetoken, etc.).
 	 */
@@ -308,17 +378,21 @@ public:
 	 *
 	 * @param Channel The channel to forward this message to. Must be valid (non-null) and different from this message's channel.
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Message", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void ForwardAsync(UPubnubChatChannel* Channel, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle ForwardAsync(UPubnubChatChannel* Channel, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Forwards this message asynchronously to the given channel. Publishes the message to the target channel with forwarding metadata (original channel, timetoken).
 	 * The target channel must be different from this message's channel.
 	 *
 	 * @param Channel The channel to forward this message to. Must be valid (non-null) and different from this message's channel.
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void ForwardAsync(UPubnubChatChannel* Channel, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle ForwardAsync(UPubnubChatChannel* Channel, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Reports this message by emitting a Report chat event to the channel's moderation/restrictions stream (e.g. for moderation review).
@@ -335,16 +409,20 @@ public:
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
 	 * @param Reason Optional reason or context for the report (e.g. for moderators).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Message", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void ReportAsync(FOnPubnubChatOperationResponse OnOperationResponse, const FString Reason = "");
+	FPubnubChatAsyncHandle ReportAsync(FOnPubnubChatOperationResponse OnOperationResponse, const FString Reason = "", float DeadlineSeconds = -1.0f);
 	/**
 	 * Reports this message asynchronously by emitting a Report chat event to the channel's moderation/restrictions stream (e.g. for moderation review).
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param Reason Optional reason or context for the report (e.g. for moderators).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void ReportAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, const FString Reason = "");
+	FPubnubChatAsyncHandle ReportAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, const FString Reason = "", float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Starts listening for message action updates (edits, reactions, delete actions) for this message. Updates are delivered via OnMessageUpdateReceived / OnMessageUpdateReceivedNative.
@@ -361,16 +439,20 @@ public:
 	 * No-op if already streaming updates.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Message", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Starts listening asynchronously for message action updates (edits, reactions, delete actions) for this message. Updates are delivered via OnMessageUpdateReceived / OnMessageUpdateReceivedNative.
 	 * No-op if already streaming updates.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StreamUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StreamUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Starts listening for message action updates on each of the given messages. Calls StreamUpdates() on each message.
@@ -382,6 +464,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Message")
 	static FPubnubChatOperationResult StreamUpdatesOn(const TArray<UPubnubChatMessage*>& Messages);
 	
+	/**
+	 * Starts one updates stream for all given messages, with a single subscription set instead of one subscription per message.
+	 * Messages from the same channel share one channel in that set. Updates are still delivered to OnUpdated of each message,
+	 * and all messages changed during a frame are additionally delivered together to OnMessagesUpdated once per frame.
+	 * Not initialized messages are skipped and reported as errors in the returned result.
+	 * Blocking: subscribes on the calling thread. Blocks for the duration of the operation.
+	 *
+	 * @param Messages Array of message objects on which to start streaming updates.
+	 * @param OnMessagesUpdated Callback executed once per frame with all messages updated during that frame.
+	 * @return Operation result and CallbackStop that stops the whole stream with a single call.
+	 *         StopStreamingUpdates of a single message removes it from the stream, and the stream is stopped when no message is left.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Message", meta = (AutoCreateRefTerm = "OnMessagesUpdated"))
+	static FPubnubChatListenForEventsResult StartUpdatesStreamOn(const TArray<UPubnubChatMessage*>& Messages, FOnPubnubChatMessagesUpdated OnMessagesUpdated);
+	/**
+	 * Starts one updates stream for all given messages, with a single subscription set instead of one subscription per message.
+	 * Messages from the same channel share one channel in that set. Updates are still delivered to OnUpdated of each message,
+	 * and all messages changed during a frame are additionally delivered together to OnMessagesUpdatedNative once per frame.
+	 * Not initialized messages are skipped and reported as errors in the returned result.
+	 * Blocking: subscribes on the calling thread. Blocks for the duration of the operation.
+	 *
+	 * @param Messages Array of message objects on which to start streaming updates.
+	 * @param OnMessagesUpdatedNative Native callback executed once per frame with all messages updated during that frame (accepts lambdas).
+	 * @return Operation result and CallbackStop that stops the whole stream with a single call.
+	 *         StopStreamingUpdates of a single message removes it from the stream, and the stream is stopped when no message is left.
+	 */
+	static FPubnubChatListenForEventsResult StartUpdatesStreamOn(const TArray<UPubnubChatMessage*>& Messages, FOnPubnubChatMessagesUpdatedNative OnMessagesUpdatedNative = nullptr);
+	
 	/**
 	 * Stops listening for message action updates for this message. OnMessageUpdateReceived will no longer fire.
 	 * Blocking: unsubscribes on the calling thread. Blocks for the duration of the operation.
@@ -397,16 +507,20 @@ public:
 	 * No-op if not streaming updates. Success if unsubscribe succeeded or was not streaming.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Message", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Stops listening asynchronously for message action updates for this message. OnMessageUpdateReceived will no longer fire.
 	 * No-op if not streaming updates. Success if unsubscribe succeeded or was not streaming.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StopStreamingUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StopStreamingUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Creates a thread channel for replying to this message. Blocking: may perform a network check to ensure the thread does not already exist.
@@ -423,16 +537,20 @@ public:
 	 * The thread is created on the server when the first reply is sent.
 	 *
 	 * @param OnThreadChannelResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Message")
-	void CreateThreadAsync(FOnPubnubChatThreadChannelResponse OnThreadChannelResponse);
+	FPubnubChatAsyncHandle CreateThreadAsync(FOnPubnubChatThreadChannelResponse OnThreadChannelResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Creates a thread channel asynchronously for replying to this message. Fails if the message is already in a thread, if the message is deleted, or if a thread for this message already exists.
 	 * The thread is created on the server when the first reply is sent.
 	 *
 	 * @param OnThreadChannelResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void CreateThreadAsync(FOnPubnubChatThreadChannelResponseNative OnThreadChannelResponseNative);
+	FPubnubChatAsyncHandle CreateThreadAsync(FOnPubnubChatThreadChannelResponseNative OnThreadChannelResponseNative, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Retrieves the thread channel for this message if it already exists on the server.
@@ -448,15 +566,19 @@ public:
 	 * Retrieves the thread channel asynchronously for this message if it already exists on the server. Fails if no thread exists for this message.
 	 *
 	 * @param OnThreadChannelResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Message")
-	void GetThreadAsync(FOnPubnubChatThreadChannelResponse OnThreadChannelResponse);
+	FPubnubChatAsyncHandle GetThreadAsync(FOnPubnubChatThreadChannelResponse OnThreadChannelResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Retrieves the thread channel asynchronously for this message if it already exists on the server. Fails if no thread exists for this message.
 	 *
 	 * @param OnThreadChannelResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetThreadAsync(FOnPubnubChatThreadChannelResponseNative OnThreadChannelResponseNative);
+	FPubnubChatAsyncHandle GetThreadAsync(FOnPubnubChatThreadChannelResponseNative OnThreadChannelResponseNative, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Checks whether this message has a thread by looking for a thread root message action in the local cache.
@@ -482,16 +604,60 @@ public:
 	 * Fails if the message has no thread or has an invalid thread root action.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Message", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void RemoveThreadAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle RemoveThreadAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Removes the thread asynchronously from this message: deletes the thread root message action and the thread channel on the server.
 	 * Fails if the message has no thread or has an invalid thread root action.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void RemoveThreadAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle RemoveThreadAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
+	
+	/**
+	 * Sends again a locally echoed message whose send failed. The message becomes Pending and is updated in place when the send is confirmed.
+	 * Blocking: performs network requests on the calling thread. Blocks for the duration of the operation.
+	 * Fails if the send state of this message is not Failed.
+	 *
+	 * @return Operation result. Success if the message was published.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Message")
+	FPubnubChatOperationResult RetrySend();
+	
+	/**
+	 * Sends again a locally echoed message whose send failed, asynchronously. The message becomes Pending and is updated in place when the send is confirmed.
+	 * Fails if the send state of this message is not Failed.
+	 *
+	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Message", meta = (AutoCreateRefTerm = "OnOperationResponse"))
+	FPubnubChatAsyncHandle RetrySendAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
+	/**
+	 * Sends again a locally echoed message whose send failed, asynchronously. The message becomes Pending and is updated in place when the send is confirmed.
+	 * Fails if the send state of this message is not Failed.
+	 *
+	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
+	 */
+	FPubnubChatAsyncHandle RetrySendAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
+	
+	/**
+	 * Discards a locally echoed message whose send failed. The message is removed from the local cache and this object becomes uninitialized.
+	 * Local: does not perform any network requests.
+	 * Fails if the send state of this message is not Failed.
+	 *
+	 * @return Operation result. Success if the message was discarded.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Message")
+	FPubnubChatOperationResult DiscardSend();
 
 protected:
 	UPROPERTY()
@@ -504,12 +670,35 @@ protected:
 	FString ChannelID = "";
 	UPROPERTY()
 	UPubnubSubscription* UpdatesSubscription = nullptr;
+	
+	//Composite repository ID and numeric timetoken are computed once in InitMessage (and moved once by UPubnubChat::RekeyMessageObject for local echoes), Timetoken string is kept for the Blueprint API
+	FString InternalMessageID = "";
+	int64 TimetokenValue = 0;
+	//Guards Timetoken, InternalMessageID and TimetokenValue - rekey of a local echo changes them while async operations read them
+	mutable FRWLock IdentityLock;
 
 	bool IsInitialized = false;
 	bool IsStreamingUpdates = false;
+	
+	//Local echo state, set only for messages created by SendText with LocalEcho enabled. Changed on the game thread
+	EPubnubChatMessageSendState SendState = EPubnubChatMessageSendState::PCMSS_Sent;
+	FString ClientMessageID = "";
+	TWeakObjectPtr<UPubnubChatChannel> LocalEchoChannel = nullptr;
 
-	void InitMessage(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString InChannelID, const FString InTimetoken);
+	//RegisterInRepository can be false only if caller registers this message itself (batched creation)
+	void InitMessage(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString InChannelID, const FString InTimetoken, const bool RegisterInRepository = true);
 	void UpdateMessageData(const FPubnubChatMessageData& NewMessageData);
+	
+	//UpdatesSubscription is created lazily, so messages that never stream updates don't allocate any subscription
+	bool CreateUpdatesSubscription();
+	//Applies message action event to this message and calls its delegates. Returns true if event was related to this message
+	bool HandleUpdatesEvent(const FPubnubMessageData& MessageData);
+	//Adds message action missed during a connection gap and calls delegates if this message streams updates. Returns false if this action is already known
+	bool ApplyMissedMessageAction(const FPubnubMessageActionData& ActionData);
+	//Calls OnUpdated through the Chat dispatch queue. Updates are coalesced - only the newest pending message data is delivered
+	void DispatchUpdated(const FPubnubChatMessageData& ChatMessageData);
+	//Sets SendState and calls OnSendStateChanged through the Chat dispatch queue. Has to be called on the game thread
+	void SetSendState(EPubnubChatMessageSendState NewSendState);
 
 	/**
 	 * Gets the internal composite message ID used for repository operations.
@@ -517,6 +706,9 @@ protected:
 	 * @return Composite message identifier
 	 */
 	FString GetInternalMessageID() const;
+	int64 GetTimetokenValue() const;
+	//Sets Timetoken, InternalMessageID and TimetokenValue together, so readers never see a mix of the old and new identity
+	void SetTimetoken(const FString& InTimetoken);
 	
 	UFUNCTION()
 	void OnChatDestroyed(FString InUserID);
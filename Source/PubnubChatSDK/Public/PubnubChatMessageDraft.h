@@ -28,6 +28,7 @@ class PUBNUBCHATSDK_API UPubnubChatMessageDraft : public UObject
 {
 	GENERATED_BODY()
 	friend class UPubnubChatChannel;
+	friend class UPubnubChat;
 
 public:
 	
@@ -187,16 +188,20 @@ public:
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
 	 * @param SendTextParams Optional parameters passed to the channel send (e.g. metadata, quoted message).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|Message Draft", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void SendAsync(FOnPubnubChatOperationResponse OnOperationResponse, FPubnubChatSendTextParams SendTextParams = FPubnubChatSendTextParams());
+	FPubnubChatAsyncHandle SendAsync(FOnPubnubChatOperationResponse OnOperationResponse, FPubnubChatSendTextParams SendTextParams = FPubnubChatSendTextParams(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Sends the draft asynchronously as a message on the associated channel. Fails if the channel is invalid or the draft text is empty.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param SendTextParams Optional parameters passed to the channel send (e.g. metadata, quoted message).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void SendAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, FPubnubChatSendTextParams SendTextParams = FPubnubChatSendTextParams());
+	FPubnubChatAsyncHandle SendAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, FPubnubChatSendTextParams SendTextParams = FPubnubChatSendTextParams(), float DeadlineSeconds = -1.0f);
 	
 private:
 	UPROPERTY()
@@ -76,10 +76,12 @@ public:
 	 * @param EndTimetoken End timetoken (inclusive) for the history range. Must be lower (older) than StartTimetoken.
 	 * @param OnThreadHistoryResponse Callback executed when the operation completes.
 	 * @param Count Maximum number of messages to return (default 25).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|ThreadChannel")
 	
-	void GetThreadHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatGetThreadHistoryResponse OnThreadHistoryResponse, const int Count = 25);
+	FPubnubChatAsyncHandle GetThreadHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatGetThreadHistoryResponse OnThreadHistoryResponse, const int Count = 25, float DeadlineSeconds = -1.0f);
 	/**
 	 * Fetches thread message history asynchronously within a timetoken range from the server. Messages are returned in descending order (newest first).
 	 * StartTimetoken must be higher (newer) than EndTimetoken. IsMore is true when the returned count equals Count, indicating more messages may exist in the range.
@@ -88,8 +90,10 @@ public:
 	 * @param EndTimetoken End timetoken (inclusive) for the history range. Must be lower (older) than StartTimetoken.
 	 * @param OnThreadHistoryResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param Count Maximum number of messages to return (default 25).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetThreadHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatGetThreadHistoryResponseNative OnThreadHistoryResponseNative, const int Count = 25);
+	FPubnubChatAsyncHandle GetThreadHistoryAsync(const FString StartTimetoken, const FString EndTimetoken, FOnPubnubChatGetThreadHistoryResponseNative OnThreadHistoryResponseNative, const int Count = 25, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Pins the given thread message to the parent channel so it appears as the pinned message on the parent. Resolves the parent channel, then calls PinMessage(ThreadMessage) on it.
@@ -107,17 +111,21 @@ public:
 	 *
 	 * @param ThreadMessage The thread message to pin to the parent channel. Must be valid and belong to this thread channel.
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|ThreadChannel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
 	
-	void PinMessageToParentChannelAsync(UPubnubChatThreadMessage* ThreadMessage, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle PinMessageToParentChannelAsync(UPubnubChatThreadMessage* ThreadMessage, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Pins the given thread message asynchronously to the parent channel. Fails if the thread message is from another thread channel, or if the parent channel cannot be resolved.
 	 *
 	 * @param ThreadMessage The thread message to pin to the parent channel. Must be valid and belong to this thread channel.
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void PinMessageToParentChannelAsync(UPubnubChatThreadMessage* ThreadMessage, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle PinMessageToParentChannelAsync(UPubnubChatThreadMessage* ThreadMessage, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Unpins the currently pinned message from the parent channel. Resolves the parent channel, then calls UnpinMessage() on it.
@@ -133,16 +141,20 @@ public:
 	 * Unpins the currently pinned message asynchronously from the parent channel. No-op if the parent channel has no pinned message.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|ThreadChannel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
 	
-	void UnpinMessageFromParentChannelAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle UnpinMessageFromParentChannelAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Unpins the currently pinned message asynchronously from the parent channel. No-op if the parent channel has no pinned message.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void UnpinMessageFromParentChannelAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle UnpinMessageFromParentChannelAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 private:
 	
@@ -163,4 +175,8 @@ private:
 	virtual FPubnubChatOperationResult OnSendText() override;
 	virtual FString CreateMentionEventPayload(FString Timetoken, FString Text) override;
 	virtual void AddOnMessageReceivedLambdaToSubscription(TWeakObjectPtr<UPubnubChatChannel> ThisChannelWeak) override;
+	virtual void DeliverLiveMessage(const FPubnubMessageData& MessageData) override;
+	virtual UPubnubChatMessage* CreateLocalEchoMessageObject(const FString& ProvisionalTimetoken, const FPubnubChatMessageData& MessageData) override;
+	virtual void ReplayMissedMessages(const TArray<FPubnubHistoryMessageData>& HistoryMessages) override;
+	virtual void BroadcastMessageReceived(UPubnubChatMessage* Message) override;
 };
\ No newline at end of file
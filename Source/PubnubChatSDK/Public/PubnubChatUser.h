@@ -23,6 +23,8 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPubnubChatUserInvited, FPubnubCha
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnPubnubChatUserInvitedNative, const FPubnubChatInviteEvent& InviteEvent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPubnubChatUserRestrictionChanged, FPubnubChatRestriction, Restriction);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnPubnubChatUserRestrictionChangedNative, const FPubnubChatRestriction& Restriction);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnPubnubChatUsersUpdated, const TArray<UPubnubChatUser*>&, Users);
+DECLARE_DELEGATE_OneParam(FOnPubnubChatUsersUpdatedNative, const TArray<UPubnubChatUser*>& Users);
 
 /**
  * Represents a chat user in the PubNub Chat SDK. Provides access to user metadata, memberships, presence, restrictions, and streaming updates.
@@ -79,6 +81,16 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub Chat|User")
 	FPubnubChatUserData GetUserData() const;
+
+	/**
+	 * Returns the local version of this user's cached data. The version changes every time the cached data changes,
+	 * so comparing it with the version seen during the last refresh tells if GetUserData has to be read again.
+	 * Local: does not perform any network requests.
+	 *
+	 * @return Version of the cached data, or 0 if user is not initialized or not in cache.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub Chat|User")
+	int64 GetDataVersion() const;
 	
 	/**
 	 * Returns the unique identifier of this user.
@@ -108,9 +120,11 @@ public:
 	 *
 	 * @param UpdateUserData Fields to update (UserName, ExternalID, ProfileUrl, Email, Custom, Status, Type) and ForceSet flags to control merge or full replacement.
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|User", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void UpdateAsync(FPubnubChatUpdateUserInputData UpdateUserData, FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle UpdateAsync(FPubnubChatUpdateUserInputData UpdateUserData, FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Updates this user's metadata asynchronously on the PubNub server and updates the local cache.
 	 * Fails if the user is not initialized or the server request fails.
@@ -119,8 +133,10 @@ public:
 	 *        (ForceSetUserName, ForceSetExternalID, ForceSetProfileUrl, ForceSetEmail, ForceSetCustom, ForceSetStatus, ForceSetType) to control
 	 *        whether each field is merged or fully replaced.
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void UpdateAsync(FPubnubChatUpdateUserInputData UpdateUserData, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle UpdateAsync(FPubnubChatUpdateUserInputData UpdateUserData, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Deletes this user on the PubNub server.
@@ -135,15 +151,19 @@ public:
 	 * Deletes this user asynchronously on the PubNub server.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Pubnub Chat|User", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void DeleteAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle DeleteAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Deletes this user asynchronously on the PubNub server.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void DeleteAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle DeleteAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Returns whether this user is considered active based on the last-active timestamp in the local cache.
@@ -176,15 +196,19 @@ public:
 	 * Lists channel IDs asynchronously where this user is currently present (subscribed). Presence reflects active subscriptions, not channel membership.
 	 *
 	 * @param OnWherePresentResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User")
-	void WherePresentAsync(FOnPubnubChatWherePresentResponse OnWherePresentResponse);
+	FPubnubChatAsyncHandle WherePresentAsync(FOnPubnubChatWherePresentResponse OnWherePresentResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Lists channel IDs asynchronously where this user is currently present (subscribed). Presence reflects active subscriptions, not channel membership.
 	 *
 	 * @param OnWherePresentResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void WherePresentAsync(FOnPubnubChatWherePresentResponseNative OnWherePresentResponseNative);
+	FPubnubChatAsyncHandle WherePresentAsync(FOnPubnubChatWherePresentResponseNative OnWherePresentResponseNative, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Checks whether this user is currently present (subscribed) on the given channel. Presence reflects active subscriptions, not channel membership.
@@ -201,16 +225,20 @@ public:
 	 *
 	 * @param ChannelID Unique identifier of the channel to check.
 	 * @param OnIsPresentResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User")
-	void IsPresentOnAsync(const FString ChannelID, FOnPubnubChatIsPresentResponse OnIsPresentResponse);
+	FPubnubChatAsyncHandle IsPresentOnAsync(const FString ChannelID, FOnPubnubChatIsPresentResponse OnIsPresentResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Checks asynchronously whether this user is currently present (subscribed) on the given channel. Presence reflects active subscriptions, not channel membership.
 	 *
 	 * @param ChannelID Unique identifier of the channel to check.
 	 * @param OnIsPresentResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void IsPresentOnAsync(const FString ChannelID, FOnPubnubChatIsPresentResponseNative OnIsPresentResponseNative);
+	FPubnubChatAsyncHandle IsPresentOnAsync(const FString ChannelID, FOnPubnubChatIsPresentResponseNative OnIsPresentResponseNative, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Retrieves this user's channel memberships from the PubNub server. Returns channel and membership data for each membership.
@@ -233,9 +261,11 @@ public:
 	 * @param Filter Expression used to filter the results. Check online documentation for filter formulas.
 	 * @param Sort Key-value pair of a property to sort by and sort direction.
 	 * @param Page Pagination information. Use Page.Next or Page.Prev for next/previous page; Next takes precedence if both set.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User")
-	void GetMembershipsAsync(FOnPubnubChatMembershipsResponse OnMembershipsResponse, const int Limit = 0, const FString Filter = "", FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle GetMembershipsAsync(FOnPubnubChatMembershipsResponse OnMembershipsResponse, const int Limit = 0, const FString Filter = "", FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Retrieves this user's channel memberships asynchronously from the PubNub server. Returns channel and membership data for each membership.
 	 *
@@ -244,8 +274,10 @@ public:
 	 * @param Filter Expression used to filter the results. Check online documentation for filter formulas.
 	 * @param Sort Key-value pair of a property to sort by and sort direction.
 	 * @param Page Pagination information. Use Page.Next or Page.Prev for next/previous page; Next takes precedence if both set.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetMembershipsAsync(FOnPubnubChatMembershipsResponseNative OnMembershipsResponseNative, const int Limit = 0, const FString Filter = "", FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle GetMembershipsAsync(FOnPubnubChatMembershipsResponseNative OnMembershipsResponseNative, const int Limit = 0, const FString Filter = "", FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Retrieves this user's membership on a specific channel.
@@ -262,16 +294,20 @@ public:
 	 *
 	 * @param ChannelID Unique identifier of the channel to query.
 	 * @param OnMembershipResponse Callback executed when the operation completes. Returned Membership is nullptr if the user is not a member of that channel.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User")
-	void GetMembershipAsync(const FString ChannelID, FOnPubnubChatMembershipResponse OnMembershipResponse);
+	FPubnubChatAsyncHandle GetMembershipAsync(const FString ChannelID, FOnPubnubChatMembershipResponse OnMembershipResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Retrieves this user's membership on a specific channel asynchronously.
 	 *
 	 * @param ChannelID Unique identifier of the channel to query.
 	 * @param OnMembershipResponseNative Native callback executed when the operation completes (accepts lambdas). Returned Membership is nullptr if the user is not a member of that channel.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetMembershipAsync(const FString ChannelID, FOnPubnubChatMembershipResponseNative OnMembershipResponseNative);
+	FPubnubChatAsyncHandle GetMembershipAsync(const FString ChannelID, FOnPubnubChatMembershipResponseNative OnMembershipResponseNative, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Checks whether this user is a member of a specific channel.
@@ -288,16 +324,20 @@ public:
 	 *
 	 * @param ChannelID Unique identifier of the channel to check.
 	 * @param OnIsMemberOnResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User")
-	void IsMemberOnAsync(const FString ChannelID, FOnPubnubChatIsMemberOnResponse OnIsMemberOnResponse);
+	FPubnubChatAsyncHandle IsMemberOnAsync(const FString ChannelID, FOnPubnubChatIsMemberOnResponse OnIsMemberOnResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Checks asynchronously whether this user is a member of a specific channel.
 	 *
 	 * @param ChannelID Unique identifier of the channel to check.
 	 * @param OnIsMemberOnResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void IsMemberOnAsync(const FString ChannelID, FOnPubnubChatIsMemberOnResponseNative OnIsMemberOnResponseNative);
+	FPubnubChatAsyncHandle IsMemberOnAsync(const FString ChannelID, FOnPubnubChatIsMemberOnResponseNative OnIsMemberOnResponseNative, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Sets or lifts moderation restrictions (ban, mute) for this user on the given channel.
@@ -320,9 +360,11 @@ public:
 	 * @param Mute When true, mutes this user on the channel; when false, lifts mute if present.
 	 * @param OnOperationResponse Callback executed when the operation completes.
 	 * @param Reason Optional reason for the restriction (e.g. for audit).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void SetRestrictionsAsync(const FString ChannelID, bool Ban, bool Mute, FOnPubnubChatOperationResponse OnOperationResponse, FString Reason = "");
+	FPubnubChatAsyncHandle SetRestrictionsAsync(const FString ChannelID, bool Ban, bool Mute, FOnPubnubChatOperationResponse OnOperationResponse, FString Reason = "", float DeadlineSeconds = -1.0f);
 	/**
 	 * Sets or lifts moderation restrictions (ban, mute) asynchronously for this user on the given channel.
 	 *
@@ -331,8 +373,10 @@ public:
 	 * @param Mute When true, mutes this user on the channel; when false, lifts mute if present.
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
 	 * @param Reason Optional reason for the restriction (e.g. for audit).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void SetRestrictionsAsync(const FString ChannelID, bool Ban, bool Mute, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, FString Reason = "");
+	FPubnubChatAsyncHandle SetRestrictionsAsync(const FString ChannelID, bool Ban, bool Mute, FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, FString Reason = "", float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Retrieves moderation restrictions (ban, mute) for this user on the given channel.
@@ -351,17 +395,21 @@ public:
 	 *
 	 * @param Channel The channel object to query. Must be valid (non-null).
 	 * @param OnRestrictionResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void GetChannelRestrictionsAsync(UPubnubChatChannel* Channel, FOnPubnubChatGetRestrictionResponse OnRestrictionResponse);
+	FPubnubChatAsyncHandle GetChannelRestrictionsAsync(UPubnubChatChannel* Channel, FOnPubnubChatGetRestrictionResponse OnRestrictionResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Retrieves moderation restrictions (ban, mute) asynchronously for this user on the given channel.
 	 * Returns a restriction with Ban/Mute false if this user has no restrictions on the channel.
 	 *
 	 * @param Channel The channel object to query. Must be valid (non-null).
 	 * @param OnRestrictionResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetChannelRestrictionsAsync(UPubnubChatChannel* Channel, FOnPubnubChatGetRestrictionResponseNative OnRestrictionResponseNative);
+	FPubnubChatAsyncHandle GetChannelRestrictionsAsync(UPubnubChatChannel* Channel, FOnPubnubChatGetRestrictionResponseNative OnRestrictionResponseNative, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Retrieves moderation restrictions for this user on all channels where they are restricted.
@@ -382,9 +430,11 @@ public:
 	 * @param Limit Maximum number of restrictions to return. Pass 0 to use the server default.
 	 * @param Sort Key-value pair of a property to sort by and sort direction.
 	 * @param Page Pagination information. Use Page.Next or Page.Prev for next/previous page; Next takes precedence if both set.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|Channel")
-	void GetChannelsRestrictionsAsync(FOnPubnubChatGetRestrictionsResponse OnRestrictionsResponse, const int Limit = 0, FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle GetChannelsRestrictionsAsync(FOnPubnubChatGetRestrictionsResponse OnRestrictionsResponse, const int Limit = 0, FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 	/**
 	 * Retrieves moderation restrictions asynchronously for this user on all channels where they are restricted.
 	 *
@@ -392,8 +442,10 @@ public:
 	 * @param Limit Maximum number of restrictions to return. Pass 0 to use the server default.
 	 * @param Sort Key-value pair of a property to sort by and sort direction.
 	 * @param Page Pagination information. Use Page.Next or Page.Prev for next/previous page; Next takes precedence if both set.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void GetChannelsRestrictionsAsync(FOnPubnubChatGetRestrictionsResponseNative OnRestrictionsResponseNative, const int Limit = 0, FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage());
+	FPubnubChatAsyncHandle GetChannelsRestrictionsAsync(FOnPubnubChatGetRestrictionsResponseNative OnRestrictionsResponseNative, const int Limit = 0, FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage(), float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Starts listening for mention events targeted to this user. Mentions are delivered via OnMentioned / OnMentionedNative.
@@ -408,15 +460,19 @@ public:
 	 * Starts listening asynchronously for mention events targeted to this user. No-op if already streaming mentions.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StreamMentionsAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StreamMentionsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Starts listening asynchronously for mention events targeted to this user. No-op if already streaming mentions.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StreamMentionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StreamMentionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Stops listening for mention events targeted to this user. OnMentioned and OnMentionedNative will no longer fire.
@@ -432,16 +488,20 @@ public:
 	 * No-op if not streaming mentions.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StopStreamingMentionsAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StopStreamingMentionsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Stops listening asynchronously for mention events targeted to this user.
 	 * No-op if not streaming mentions.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StopStreamingMentionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StopStreamingMentionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Starts listening for invite events targeted to this user. Invitations are delivered via OnInvited / OnInvitedNative.
@@ -456,15 +516,19 @@ public:
 	 * Starts listening asynchronously for invite events targeted to this user. No-op if already streaming invitations.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StreamInvitationsAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StreamInvitationsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Starts listening asynchronously for invite events targeted to this user. No-op if already streaming invitations.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StreamInvitationsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StreamInvitationsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Stops listening for invite events targeted to this user. OnInvited and OnInvitedNative will no longer fire.
@@ -480,16 +544,20 @@ public:
 	 * No-op if not streaming invitations.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StopStreamingInvitationsAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StopStreamingInvitationsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Stops listening asynchronously for invite events targeted to this user.
 	 * No-op if not streaming invitations.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StopStreamingInvitationsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StopStreamingInvitationsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Starts listening for moderation restriction events targeted to this user. Restriction changes are delivered via
@@ -507,16 +575,20 @@ public:
 	 * No-op if already streaming restrictions.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StreamRestrictionsAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StreamRestrictionsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Starts listening asynchronously for moderation restriction events targeted to this user.
 	 * No-op if already streaming restrictions.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StreamRestrictionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StreamRestrictionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 
 	/**
 	 * Stops listening for moderation restriction events targeted to this user.
@@ -533,16 +605,20 @@ public:
 	 * No-op if not streaming restrictions.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StopStreamingRestrictionsAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StopStreamingRestrictionsAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Stops listening asynchronously for moderation restriction events targeted to this user.
 	 * No-op if not streaming restrictions.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StopStreamingRestrictionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StopStreamingRestrictionsAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Starts listening for user metadata updates (and delete events) for this user. Updates are delivered via OnUpdated; deletions via OnDeleted.
@@ -559,16 +635,20 @@ public:
 	 * No-op if already streaming updates.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StreamUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Starts listening asynchronously for user metadata updates (and delete events) for this user. Updates are delivered via OnUpdated; deletions via OnDeleted.
 	 * No-op if already streaming updates.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StreamUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StreamUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 	/**
 	 * Starts listening for user metadata updates on each of the given users. Calls StreamUpdates() on each user.
@@ -580,6 +660,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User")
 	static FPubnubChatOperationResult StreamUpdatesOn(const TArray<UPubnubChatUser*>& Users);
 	
+	/**
+	 * Starts one updates stream for all given users, with a single subscription set instead of one subscription per user.
+	 * Updates are still delivered to OnUpdated/OnDeleted of each user, and all users changed during a frame
+	 * are additionally delivered together to OnUsersUpdated once per frame.
+	 * Not initialized users are skipped and reported as errors in the returned result.
+	 * Blocking: subscribes on the calling thread. Blocks for the duration of the operation.
+	 *
+	 * @param Users Array of user objects on which to start streaming updates.
+	 * @param OnUsersUpdated Callback executed once per frame with all users updated or deleted during that frame.
+	 * @return Operation result and CallbackStop that stops the whole stream with a single call.
+	 *         StopStreamingUpdates of a single user removes it from the stream, and the stream is stopped when no user is left.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User", meta = (AutoCreateRefTerm = "OnUsersUpdated"))
+	static FPubnubChatListenForEventsResult StartUpdatesStreamOn(const TArray<UPubnubChatUser*>& Users, FOnPubnubChatUsersUpdated OnUsersUpdated);
+	/**
+	 * Starts one updates stream for all given users, with a single subscription set instead of one subscription per user.
+	 * Updates are still delivered to OnUpdated/OnDeleted of each user, and all users changed during a frame
+	 * are additionally delivered together to OnUsersUpdatedNative once per frame.
+	 * Not initialized users are skipped and reported as errors in the returned result.
+	 * Blocking: subscribes on the calling thread. Blocks for the duration of the operation.
+	 *
+	 * @param Users Array of user objects on which to start streaming updates.
+	 * @param OnUsersUpdatedNative Native callback executed once per frame with all users updated or deleted during that frame (accepts lambdas).
+	 * @return Operation result and CallbackStop that stops the whole stream with a single call.
+	 *         StopStreamingUpdates of a single user removes it from the stream, and the stream is stopped when no user is left.
+	 */
+	static FPubnubChatListenForEventsResult StartUpdatesStreamOn(const TArray<UPubnubChatUser*>& Users, FOnPubnubChatUsersUpdatedNative OnUsersUpdatedNative = nullptr);
+	
 	/**
 	 * Stops listening for user metadata updates for this user. OnUpdated and OnDeleted will no longer fire.
 	 * Blocking: unsubscribes on the calling thread. Blocks for the duration of the operation.
@@ -595,16 +703,20 @@ public:
 	 * No-op if not streaming updates.
 	 *
 	 * @param OnOperationResponse Callback executed when the operation completes.
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pubnub Chat|User", meta = (AutoCreateRefTerm = "OnOperationResponse"))
-	void StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse);
+	FPubnubChatAsyncHandle StopStreamingUpdatesAsync(FOnPubnubChatOperationResponse OnOperationResponse, float DeadlineSeconds = -1.0f);
 	/**
 	 * Stops listening asynchronously for user metadata updates for this user. OnUpdated and OnDeleted will no longer fire.
 	 * No-op if not streaming updates.
 	 *
 	 * @param OnOperationResponseNative Native callback executed when the operation completes (accepts lambdas).
+	 * @param DeadlineSeconds Time in seconds after which the operation is skipped if it didn't start yet, set before it's queued. Negative uses FPubnubChatConfig::AsyncOperationDeadline, 0 means no deadline.
+	 * @return Handle to cancel the operation.
 	 */
-	void StopStreamingUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr);
+	FPubnubChatAsyncHandle StopStreamingUpdatesAsync(FOnPubnubChatOperationResponseNative OnOperationResponseNative = nullptr, float DeadlineSeconds = -1.0f);
 	
 private:
 	UPROPERTY()
@@ -630,6 +742,9 @@ private:
 
 	void InitUser(UPubnubClient* InPubnubClient, UPubnubChat* InChat, const FString InUserID);
 	
+	//Applies user update/delete event to this user and calls its delegates. Returns true if event was related to this user
+	bool HandleUpdatesEvent(const FPubnubMessageData& MessageData);
+	
 	FPubnubChatGetRestrictionsResult GetRestrictions(const int Limit = 0, const FString Filter = "", FPubnubMembershipSort Sort = FPubnubMembershipSort(), FPubnubPage Page = FPubnubPage());
 	
 	UFUNCTION()
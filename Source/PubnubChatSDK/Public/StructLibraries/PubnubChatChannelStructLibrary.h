@@ -322,3 +322,18 @@ struct FPubnubChatHasThreadResult
 	/** True if the message has a thread with at least one reply. */
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") bool HasThread = false;
 };
+
+/**
+ * Flow control metrics of a channel.
+ * Used to monitor how far behind the inbound rate listeners of a high-volume channel are.
+ */
+USTRUCT(BlueprintType)
+struct FPubnubChatFlowControlStats
+{
+	GENERATED_BODY()
+
+	/** Number of events of this channel waiting in the dispatch queue. Always 0 when FPubnubChatConfig::Dispatch is disabled. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int QueueDepth = 0;
+	/** Number of received messages dropped by FPubnubChatConfig::FlowControl since this channel object was created. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int DroppedMessagesCount = 0;
+};
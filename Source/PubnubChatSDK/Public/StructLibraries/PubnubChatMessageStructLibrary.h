@@ -109,6 +109,20 @@ struct FPubnubChatMessageResult
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") UPubnubChatMessage* Message = nullptr;
 };
 
+/**
+ * Result of searching messages in the local search index.
+ */
+USTRUCT(BlueprintType)
+struct FPubnubChatSearchMessagesResult
+{
+	GENERATED_BODY()
+
+	/** Operation result containing success/error status and detailed step information. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") FPubnubChatOperationResult Result;
+	/** Found messages, newest first. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") TArray<UPubnubChatMessage*> Messages;
+};
+
 /**
  * Result of fetching all reactions for a message.
  * Contains aggregated reaction data grouped by reaction value.
@@ -50,6 +50,196 @@ struct FPubnubChatRateLimiterConfig
 	float RateLimitFactor = 1.2f;
 };
 
+/**
+ * Bootstrap configuration - data fetched together with the current user during InitChat.
+ * Lets the UI render the conversation list right after InitChat instead of waiting for a chain of follow-up requests.
+ */
+USTRUCT(BlueprintType)
+struct FPubnubChatBootstrapConfig
+{
+	GENERATED_BODY()
+
+	/** When true, InitChat fetches the current user, the first page of its memberships, their unread messages counts and last messages. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Bootstrap")
+	bool PrefetchOnInit = false;
+
+	/** Number of memberships in the prefetched page. Between 1 and 100. Default: 20. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Bootstrap")
+	int MembershipsLimit = 20;
+
+	/** Number of newest messages prefetched for every membership channel. 0 disables last messages. Max 25. Default: 1. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Bootstrap")
+	int LastMessagesCount = 1;
+
+	/**
+	 * When true, bootstrap data is saved locally and the next InitChat of the same user returns it without waiting for the network.
+	 * Fresh data is fetched right after InitChat and delivered with UPubnubChat::OnBootstrapCompleted.
+	 */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Bootstrap")
+	bool WarmStartFromSnapshot = false;
+};
+
+/**
+ * Persistent store configuration - users, channels and messages kept on disk between sessions.
+ * Lets the UI render cached data and channel scrollback before the network responds.
+ */
+USTRUCT(BlueprintType)
+struct FPubnubChatPersistentStoreConfig
+{
+	GENERATED_BODY()
+
+	/** When true, users, channels and messages known to the chat are saved in Saved/ and can be read back with GetCachedUser, GetCachedChannel and GetCachedHistory. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|PersistentStore")
+	bool Enabled = false;
+
+	/** Maximum size of the store of a single user in megabytes. Least recently used data is dropped when it's exceeded. Min 1. Default: 64. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|PersistentStore")
+	int MaxSizeMB = 64;
+};
+
+/**
+ * Dispatch configuration - how received events are delivered to delegates on the game thread.
+ * When enabled, events are buffered per listener and delivered under a per-frame time budget,
+ * so bursts of messages are spread over several frames instead of stalling one.
+ */
+USTRUCT(BlueprintType)
+struct FPubnubChatDispatchConfig
+{
+	GENERATED_BODY()
+
+	/** When true, messages, typing, presence, read receipts and reactions are delivered from a per-frame dispatch queue. When false, delegates are called as soon as events are received. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Dispatch")
+	bool Enabled = false;
+
+	/** Time in milliseconds the dispatch queue may spend calling delegates in a single frame. At least one event is delivered every frame. Min 0.1. Default: 2.0. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Dispatch")
+	float FrameBudgetMs = 2.0f;
+};
+
+/**
+ * Flow control configuration - limits received messages of a single channel waiting in the dispatch queue,
+ * so a listener slower than the inbound rate degrades by dropping messages instead of growing memory.
+ * Applies only when FPubnubChatConfig::Dispatch is enabled.
+ */
+USTRUCT(BlueprintType)
+struct FPubnubChatFlowControlConfig
+{
+	GENERATED_BODY()
+
+	/** Maximum number of received messages of a single channel waiting to be delivered. 0 means unlimited. Default: 0. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|FlowControl")
+	int MaxQueuedMessages = 0;
+
+	/** What happens when a message is received while the channel queue is full. Default: DropOldest. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|FlowControl")
+	EPubnubChatDropPolicy DropPolicy = EPubnubChatDropPolicy::PCDP_DropOldest;
+
+	/** With Sample policy, one of every SampleRate messages received while the queue is full replaces the oldest queued message, the rest is dropped. Min 1. Default: 10. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|FlowControl")
+	int SampleRate = 10;
+
+	/** When true, messages that mention the current user are never dropped and don't count toward MaxQueuedMessages. Default: true. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|FlowControl")
+	bool ExemptMentionsOfCurrentUser = true;
+};
+
+/**
+ * Search index configuration - local full-text index of messages known to the chat.
+ * Messages are indexed as they are received, fetched or edited, and can be found with UPubnubChat::SearchMessages without network requests.
+ */
+USTRUCT(BlueprintType)
+struct FPubnubChatSearchIndexConfig
+{
+	GENERATED_BODY()
+
+	/** When true, text of all messages known to the chat is indexed in memory for UPubnubChat::SearchMessages. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|SearchIndex")
+	bool Enabled = false;
+
+	/** Approximate memory budget of the index in megabytes. Oldest messages are dropped from the index when it's exceeded. Min 1. Default: 64. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|SearchIndex")
+	int MaxMemoryMB = 64;
+};
+
+/**
+ * Outbox configuration - chat mutations made while the connection is offline.
+ * SendText, EditText, ToggleReaction and SetLastReadMessageTimetoken called while offline are kept in a journal in Saved/
+ * and sent in per-channel order when the connection is back, also after the application was restarted.
+ */
+USTRUCT(BlueprintType)
+struct FPubnubChatOutboxConfig
+{
+	GENERATED_BODY()
+
+	/** When true, supported mutations made while the connection is offline are queued instead of failing. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Outbox")
+	bool Enabled = false;
+
+	/** Maximum number of queued mutations. Mutations made when the outbox is full fail as if there was no outbox. Min 1. Default: 200. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Outbox")
+	int MaxEntries = 200;
+
+	/** Maximum age in seconds of a queued mutation. Older mutations are dropped instead of being sent. 0 means they never expire. Default: 86400 (1 day). */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Outbox")
+	int MaxAgeSeconds = 86400;
+};
+
+/**
+ * Retry configuration - policy applied to every PubNub request made by the chat. Disabled by default.
+ * Transient failures (HTTP 408, 429 and 5xx) are retried with exponential backoff and jitter,
+ * within a deadline of the operation type. Requests that can't be safely repeated (publish, adding message actions)
+ * are retried only when the server rejected them without applying them (HTTP 429).
+ * Too many consecutive transient failures open a circuit breaker - requests then fail right away until the cooldown passes.
+ * Retries taken are reported as steps of the operation result.
+ * Retries wait on the thread that made the request, so a blocking function can take up to the deadline of its requests to return,
+ * and *Async functions delay the ones queued after them.
+ */
+USTRUCT(BlueprintType)
+struct FPubnubChatRetryConfig
+{
+	GENERATED_BODY()
+
+	/** When true, transient failures are retried. Requests made on the game thread are never retried. Default: false. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Retry")
+	bool Enabled = false;
+
+	/** When true, consecutive transient failures open the circuit breaker, so requests fail fast while the origin is unhealthy. Independent of Enabled. Default: true. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Retry")
+	bool CircuitBreakerEnabled = true;
+
+	/** Maximum number of attempts of a single request, including the first one. Min 1. Default: 3. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Retry")
+	int MaxAttempts = 3;
+
+	/** Delay in milliseconds before the first retry, doubled with every next retry. Min 0. Default: 250ms. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Retry")
+	int BaseDelayMs = 250;
+
+	/** Maximum delay in milliseconds between retries. Min BaseDelayMs. Default: 4000ms. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Retry")
+	int MaxDelayMs = 4000;
+
+	/** Time in milliseconds after which reads (fetching history, metadata, memberships...) are not retried anymore. Default: 15000ms. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Retry")
+	int ReadDeadlineMs = 15000;
+
+	/** Time in milliseconds after which writes that can be safely repeated (setting metadata, memberships...) are not retried anymore. Default: 15000ms. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Retry")
+	int WriteDeadlineMs = 15000;
+
+	/** Time in milliseconds after which publishes and added message actions are not retried anymore. Default: 5000ms. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Retry")
+	int PublishDeadlineMs = 5000;
+
+	/** Number of consecutive transient failures that opens the circuit breaker. 0 disables the circuit breaker as well. Default: 5. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Retry")
+	int CircuitBreakerFailureThreshold = 5;
+
+	/** Time in milliseconds the circuit breaker stays open before a single request is let through to test the origin. Min 0. Default: 10000ms. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config|Retry")
+	int CircuitBreakerCooldownMs = 10000;
+};
+
 /**
  * Main configuration structure for initializing PubNub Chat.
  * Controls typing indicators, user activity tracking, rate limiting, and read receipts.
@@ -69,10 +259,36 @@ struct FPubnubChatConfig
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") int StoreUserActivityInterval = 600000;
 	/** When true, automatically stores user activity timestamps on server. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") bool StoreUserActivityTimestamps = false;
+	/** Time in milliseconds without activity (sent messages or UPubnubChat::ReportUserActivity) after which user activity timestamps are not stored. 0 means the user is never idle. Default: 0. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") int UserActivityIdleTimeout = 0;
 	/** Rate limiter configuration for controlling message frequency. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") FPubnubChatRateLimiterConfig RateLimiter;
 	/** Per-channel-type toggle for read receipt events. Keys: "public", "group", "direct". */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") TMap<FString, bool> EmitReadReceiptEvents;
+	/** Maximum age in milliseconds of messages missed during a connection gap that are replayed to connected channels after reconnect. 0 disables replay. Default: 300000ms (5 minutes). */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") int ReconnectReplayWindow = 300000;
+	/** Maximum number of missed messages replayed per channel after a single connection gap. Only the newest ones are replayed. Default: 100. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") int ReconnectReplayMaxMessages = 100;
+	/** Data fetched together with the current user during InitChat. Disabled by default. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") FPubnubChatBootstrapConfig Bootstrap;
+	/** Users, channels and messages kept on disk between sessions. Disabled by default. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") FPubnubChatPersistentStoreConfig PersistentStore;
+	/** Per-frame delivery of received events to delegates. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") FPubnubChatDispatchConfig Dispatch;
+	/** Per-channel limit of messages waiting in the dispatch queue. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") FPubnubChatFlowControlConfig FlowControl;
+	/** Local full-text index of messages. Disabled by default. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") FPubnubChatSearchIndexConfig SearchIndex;
+	/** Queue of mutations made while offline. Disabled by default. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") FPubnubChatOutboxConfig Outbox;
+	/** Retry, backoff and circuit breaker policy of PubNub requests. Retries are disabled by default, the circuit breaker is enabled. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") FPubnubChatRetryConfig Retry;
+	/** Time in milliseconds after which operations queued by *Async functions are skipped if they didn't start yet. Can be changed per operation with DeadlineSeconds parameter of the *Async function. 0 means no deadline. Default: 0. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") int AsyncOperationDeadline = 0;
+	/** Time in milliseconds that reaction toggles made with ToggleReactionAsync are collected before only their net change is sent. Default: 300ms. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") int ReactionToggleDebounce = 300;
+	/** Minimal time in milliseconds between last read message timetoken writes of one membership made with SetLastReadMessageTimetokenAsync. Only the highest timetoken is written. Default: 1000ms. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PubnubChat|Config") int ReadMarkerFlushInterval = 1000;
 
 	/** Default: public=false, group=true, direct=true for read receipt events. */
 	FPubnubChatConfig()
@@ -154,6 +370,8 @@ struct FPubnubChatOperationResult
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") FString ErrorMessage = "";
 	/** Array of results from each individual operation step. */
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") TArray<FPubnubChatOperationStepResult> StepResults;
+	/** True if the operation was cancelled with its FPubnubChatAsyncHandle or its deadline passed. Error is also true in that case. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") bool Cancelled = false;
 
 	/**
 	 * Sets Error to false, without affecting steps
@@ -165,6 +383,11 @@ struct FPubnubChatOperationResult
 	 */
 	static FPubnubChatOperationResult CreateError(FString InErrorMessage = "");
 
+	/**
+	 * Creates a result of an operation that was cancelled or whose deadline passed
+	 */
+	static FPubnubChatOperationResult CreateCancelled(FString InErrorMessage = "");
+
 	/**
 	 * Creates a result from a single Pubnub operation result
 	 * @param StepName Name of the operation step
@@ -190,6 +413,65 @@ struct FPubnubChatOperationResult
 	FPubnubChatOperationResult& Merge(const FPubnubChatOperationResult& OtherResult);
 };
 
+/** Internal state shared by all copies of FPubnubChatAsyncHandle, defined in the source file */
+struct FPubnubChatAsyncOperationState;
+
+/**
+ * Handle of an operation queued by an *Async function. Copies of the handle refer to the same operation.
+ * Cancelling the handle, or letting its deadline pass, before the operation starts skips the operation
+ * and its callback receives a result with Cancelled set to true.
+ * Cancelling a running operation stops retries of its requests - a request that was already sent is not interrupted.
+ * Default constructed handle doesn't refer to any operation, it's returned when the operation could not be queued.
+ */
+USTRUCT(BlueprintType)
+struct PUBNUBCHATSDK_API FPubnubChatAsyncHandle
+{
+	GENERATED_BODY()
+
+	/**
+	 * Creates a handle of a new operation, before it's queued
+	 * @param DeadlineSeconds Time after which the operation is skipped if it didn't start yet. 0 means no deadline. It can't be changed later
+	 */
+	static FPubnubChatAsyncHandle Create(float DeadlineSeconds = 0.0f);
+
+	/** True if the handle refers to an operation */
+	bool IsValid() const;
+	/** Skips the operation if it didn't start yet, otherwise stops retries of its requests */
+	void Cancel() const;
+	bool IsCancelled() const;
+	/** True if the operation didn't start before its deadline */
+	bool IsExpired() const;
+	bool IsStarted() const;
+
+	/** Marks the operation as started. Returns false if it was cancelled or its deadline passed, the operation should be skipped then */
+	bool TryStart() const;
+	/** Result passed to the callback of a skipped operation */
+	FPubnubChatOperationResult CreateCancelledResult() const;
+
+private:
+	TSharedPtr<FPubnubChatAsyncOperationState, ESPMode::ThreadSafe> State = nullptr;
+};
+
+/**
+ * Data prefetched during InitChat when FPubnubChatBootstrapConfig::PrefetchOnInit is enabled.
+ */
+USTRUCT(BlueprintType)
+struct FPubnubChatBootstrapResult
+{
+	GENERATED_BODY()
+
+	/** Operation result containing success/error status and detailed step information. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") FPubnubChatOperationResult Result;
+	/** True if the data comes from the locally saved snapshot and fresh data will follow with OnBootstrapCompleted. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") bool FromSnapshot = false;
+	/** First page of the current user memberships. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") TArray<UPubnubChatMembership*> Memberships;
+	/** Unread messages count per membership ChannelID. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") TMap<FString, int> UnreadMessagesCounts;
+	/** Newest messages of membership channels, oldest first within every channel. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") TArray<UPubnubChatMessage*> LastMessages;
+};
+
 /**
  * Result of initializing the PubNub Chat SDK.
  * Contains the main Chat object used for all subsequent operations.
@@ -203,6 +485,8 @@ struct FPubnubChatInitChatResult
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") FPubnubChatOperationResult Result;
 	/** The initialized Chat object. Null if initialization failed. */
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") UPubnubChat* Chat = nullptr;
+	/** Data prefetched with the current user. Empty unless FPubnubChatBootstrapConfig::PrefetchOnInit is enabled. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") FPubnubChatBootstrapResult Bootstrap;
 };
 
 /**
@@ -220,6 +504,12 @@ struct FPubnubChatSendTextParams
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") bool SendByPost = false;
 	/** JSON string with additional metadata to attach to the message. */
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") FString Meta = "";
+	/**
+	 * When true and the channel is connected, a provisional message in Pending send state is delivered to OnMessageReceived right away,
+	 * before the message is published. It's updated in place when the publish is confirmed, and the echo from the server is not delivered again.
+	 * Default: false.
+	 */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") bool LocalEcho = false;
 };
 
 /**
@@ -637,3 +927,79 @@ struct FPubnubChatMarkAllMessagesAsReadResult
 	/** Total number of channels where messages were marked as read. */
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int Total = 0;
 };
+
+/**
+ * Memory accounting of one type of data stored in the chat objects repository.
+ */
+USTRUCT(BlueprintType)
+struct FPubnubChatRepositoryEntryStats
+{
+	GENERATED_BODY()
+
+	/** Number of stored entries, including entries kept without any live object. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int EntriesCount = 0;
+	/** Approximate memory used by the entries and their reference counts, in bytes. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int64 ApproximateBytes = 0;
+	/** Number of entries per count of live objects using them: [0] no object, [1] 1, [2] 2-3, [3] 4-7, [4] 8-15, [5] 16 or more. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") TArray<int> ReferenceCountHistogram;
+};
+
+/**
+ * Snapshot of memory held by a chat instance.
+ * Use it to enforce memory budgets and to spot objects, subscriptions or cache entries that are never released.
+ */
+USTRUCT(BlueprintType)
+struct FPubnubChatMemoryStats
+{
+	GENERATED_BODY()
+
+	/** Users data stored in the repository. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") FPubnubChatRepositoryEntryStats Users;
+	/** Channels data stored in the repository, including thread channels. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") FPubnubChatRepositoryEntryStats Channels;
+	/** Messages data stored in the repository, including thread messages. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") FPubnubChatRepositoryEntryStats Messages;
+	/** Memberships data stored in the repository. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") FPubnubChatRepositoryEntryStats Memberships;
+	/** Approximate memory used by the search index, in bytes. 0 when FPubnubChatConfig::SearchIndex is disabled. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int64 SearchIndexBytes = 0;
+	/** Approximate memory used by interned user, channel and membership IDs that repository entries are keyed by, in bytes. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int64 InternedIDsBytes = 0;
+	/** Approximate memory used by the repository in total, in bytes. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int64 RepositoryBytes = 0;
+
+	/** Live User objects of this chat. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int UserObjectsCount = 0;
+	/** Live Channel objects of this chat, without thread channels. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int ChannelObjectsCount = 0;
+	/** Live ThreadChannel objects of this chat. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int ThreadChannelObjectsCount = 0;
+	/** Live Message objects of this chat, without thread messages. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int MessageObjectsCount = 0;
+	/** Live ThreadMessage objects of this chat. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int ThreadMessageObjectsCount = 0;
+	/** Live Membership objects of this chat. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int MembershipObjectsCount = 0;
+	/** Live MessageDraft objects created from channels of this chat. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int MessageDraftObjectsCount = 0;
+	/** Entries of the live Message objects identity map, including entries of objects that were already destroyed and are not compacted yet. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int LiveMessageObjectsCount = 0;
+
+	/** Subscriptions created by Connect, Stream* and ListenForEvents functions that were not stopped yet. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int ActiveSubscriptionsCount = 0;
+	/** Collection updates streams started with StartUpdatesStreamOn. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int UpdatesStreamsCount = 0;
+
+	/** Cached suggestion queries of all message drafts. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int SuggestionsCacheEntriesCount = 0;
+	/** Typing users tracked by all channels. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int TypingIndicatorsCount = 0;
+	/** Present users tracked by all channels streaming presence. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int StreamPresenceUserIDsCount = 0;
+	/** Events waiting in the dispatch queue. Always 0 when FPubnubChatConfig::Dispatch is disabled. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int PendingDispatchEventsCount = 0;
+	/** Reaction toggles that were not sent yet. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int PendingReactionsCount = 0;
+	/** Last read message timetokens that were not written yet. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "PubnubChat") int PendingReadMarkersCount = 0;
+};
@@ -1,6 +1,7 @@
 // Copyright 2026 PubNub Inc. All Rights Reserved.
 
 #include "PubnubChatSDK/Private/FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "PubnubChatSDK/Private/FunctionLibraries/PubnubChatJsonReader.h"
 #include "PubnubClient.h"
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -13,23 +14,17 @@
 // ============================================================================
 
 /**
- * Helper function to parse a JSON string and extract Resources object
+ * Helper function to extract text of the Resources object from a JSON string
  */
-static TSharedPtr<FJsonObject> ParseResourcesFromJson(const FString& JsonString)
+static FString GetResourcesJsonFromToken(const FString& JsonString)
 {
-	TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
-	if(!UPubnubJsonUtilities::StringToJsonObject(JsonString, RootObject))
+	FStringView ResourcesJson;
+	if(!FPubnubChatJsonReader::TryGetObjectField(JsonString, TEXT("Resources"), ResourcesJson))
 	{
-		return nullptr;
-	}
-	
-	const TSharedPtr<FJsonObject>* ResourcesObjectPtr = nullptr;
-	if(!RootObject->TryGetObjectField(TEXT("Resources"), ResourcesObjectPtr) || !ResourcesObjectPtr || !(*ResourcesObjectPtr).IsValid())
-	{
-		return nullptr;
+		return FString();
 	}
 	
-	return *ResourcesObjectPtr;
+	return FString(ResourcesJson);
 }
 
 /**
@@ -58,27 +53,27 @@ bool FPubnubChatAccessManagerCheckResourcePermissionValidTest::RunTest(const FSt
 {
 	// Parse Resources from JSON string matching token format
 	const FString TokenJson = TEXT(R"({"Resources":{"Channels":{"my_channel":{"Read":true,"Write":false,"Manage":true}}}})");
-	TSharedPtr<FJsonObject> ResourcesObject = ParseResourcesFromJson(TokenJson);
-	TestTrue("Resources object should be parsed", ResourcesObject.IsValid());
+	const FString ResourcesJson = GetResourcesJsonFromToken(TokenJson);
+	TestFalse("Resources object should be found", ResourcesJson.IsEmpty());
 	
-	if(!ResourcesObject.IsValid())
+	if(ResourcesJson.IsEmpty())
 	{
 		return false;
 	}
 	
 	// Test valid permission
 	bool HasReadPermission = UPubnubChatInternalUtilities::CheckResourcePermission(
-		ResourcesObject, TEXT("Channels"), TEXT("my_channel"), TEXT("Read"));
+		ResourcesJson, TEXT("Channels"), TEXT("my_channel"), TEXT("Read"));
 	TestTrue("Should have Read permission", HasReadPermission);
 	
 	// Test denied permission
 	bool HasWritePermission = UPubnubChatInternalUtilities::CheckResourcePermission(
-		ResourcesObject, TEXT("Channels"), TEXT("my_channel"), TEXT("Write"));
+		ResourcesJson, TEXT("Channels"), TEXT("my_channel"), TEXT("Write"));
 	TestFalse("Should not have Write permission", HasWritePermission);
 	
 	// Test another valid permission
 	bool HasManagePermission = UPubnubChatInternalUtilities::CheckResourcePermission(
-		ResourcesObject, TEXT("Channels"), TEXT("my_channel"), TEXT("Manage"));
+		ResourcesJson, TEXT("Channels"), TEXT("my_channel"), TEXT("Manage"));
 	TestTrue("Should have Manage permission", HasManagePermission);
 	
 	return true;
@@ -90,26 +85,26 @@ bool FPubnubChatAccessManagerCheckResourcePermissionUuidsTest::RunTest(const FSt
 {
 	// Parse Resources from JSON string for Uuids
 	const FString TokenJson = TEXT(R"({"Resources":{"Uuids":{"User1":{"Delete":true,"Get":false,"Update":true}}}})");
-	TSharedPtr<FJsonObject> ResourcesObject = ParseResourcesFromJson(TokenJson);
-	TestTrue("Resources object should be parsed", ResourcesObject.IsValid());
+	const FString ResourcesJson = GetResourcesJsonFromToken(TokenJson);
+	TestFalse("Resources object should be found", ResourcesJson.IsEmpty());
 	
-	if(!ResourcesObject.IsValid())
+	if(ResourcesJson.IsEmpty())
 	{
 		return false;
 	}
 	
 	// Test valid permissions
 	bool HasDeletePermission = UPubnubChatInternalUtilities::CheckResourcePermission(
-		ResourcesObject, TEXT("Uuids"), TEXT("User1"), TEXT("Delete"));
+		ResourcesJson, TEXT("Uuids"), TEXT("User1"), TEXT("Delete"));
 	TestTrue("Should have Delete permission", HasDeletePermission);
 	
 	bool HasUpdatePermission = UPubnubChatInternalUtilities::CheckResourcePermission(
-		ResourcesObject, TEXT("Uuids"), TEXT("User1"), TEXT("Update"));
+		ResourcesJson, TEXT("Uuids"), TEXT("User1"), TEXT("Update"));
 	TestTrue("Should have Update permission", HasUpdatePermission);
 	
 	// Test denied permission
 	bool HasGetPermission = UPubnubChatInternalUtilities::CheckResourcePermission(
-		ResourcesObject, TEXT("Uuids"), TEXT("User1"), TEXT("Get"));
+		ResourcesJson, TEXT("Uuids"), TEXT("User1"), TEXT("Get"));
 	TestFalse("Should not have Get permission", HasGetPermission);
 	
 	return true;
@@ -121,17 +116,17 @@ bool FPubnubChatAccessManagerCheckResourcePermissionMissingResourceTest::RunTest
 {
 	// Parse Resources from JSON string
 	const FString TokenJson = TEXT(R"({"Resources":{"Channels":{"my_channel":{"Read":true}}}})");
-	TSharedPtr<FJsonObject> ResourcesObject = ParseResourcesFromJson(TokenJson);
-	TestTrue("Resources object should be parsed", ResourcesObject.IsValid());
+	const FString ResourcesJson = GetResourcesJsonFromToken(TokenJson);
+	TestFalse("Resources object should be found", ResourcesJson.IsEmpty());
 	
-	if(!ResourcesObject.IsValid())
+	if(ResourcesJson.IsEmpty())
 	{
 		return false;
 	}
 	
 	// Test missing resource
 	bool HasPermission = UPubnubChatInternalUtilities::CheckResourcePermission(
-		ResourcesObject, TEXT("Channels"), TEXT("non_existent_channel"), TEXT("Read"));
+		ResourcesJson, TEXT("Channels"), TEXT("non_existent_channel"), TEXT("Read"));
 	TestFalse("Should not have permission for non-existent resource", HasPermission);
 	
 	return true;
@@ -143,17 +138,17 @@ bool FPubnubChatAccessManagerCheckResourcePermissionMissingPermissionFieldTest::
 {
 	// Parse Resources from JSON string without Write permission field
 	const FString TokenJson = TEXT(R"({"Resources":{"Channels":{"my_channel":{"Read":true}}}})");
-	TSharedPtr<FJsonObject> ResourcesObject = ParseResourcesFromJson(TokenJson);
-	TestTrue("Resources object should be parsed", ResourcesObject.IsValid());
+	const FString ResourcesJson = GetResourcesJsonFromToken(TokenJson);
+	TestFalse("Resources object should be found", ResourcesJson.IsEmpty());
 	
-	if(!ResourcesObject.IsValid())
+	if(ResourcesJson.IsEmpty())
 	{
 		return false;
 	}
 	
 	// Test missing permission field
 	bool HasWritePermission = UPubnubChatInternalUtilities::CheckResourcePermission(
-		ResourcesObject, TEXT("Channels"), TEXT("my_channel"), TEXT("Write"));
+		ResourcesJson, TEXT("Channels"), TEXT("my_channel"), TEXT("Write"));
 	TestFalse("Should not have permission when field is missing", HasWritePermission);
 	
 	return true;
@@ -164,37 +159,37 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatAccessManagerCheckResourcePermission
 bool FPubnubChatAccessManagerCheckResourcePermissionInvalidInputsTest::RunTest(const FString& Parameters)
 {
 	const FString TokenJson = TEXT(R"({"Resources":{"Channels":{"my_channel":{"Read":true}}}})");
-	TSharedPtr<FJsonObject> ResourcesObject = ParseResourcesFromJson(TokenJson);
-	TestTrue("Resources object should be parsed", ResourcesObject.IsValid());
+	const FString ResourcesJson = GetResourcesJsonFromToken(TokenJson);
+	TestFalse("Resources object should be found", ResourcesJson.IsEmpty());
 	
-	if(!ResourcesObject.IsValid())
+	if(ResourcesJson.IsEmpty())
 	{
 		return false;
 	}
 	
-	// Test null ResourcesObject
+	// Test empty ResourcesJson
 	bool HasPermission = UPubnubChatInternalUtilities::CheckResourcePermission(
-		nullptr, TEXT("Channels"), TEXT("my_channel"), TEXT("Read"));
-	TestFalse("Should return false for null ResourcesObject", HasPermission);
+		TEXT(""), TEXT("Channels"), TEXT("my_channel"), TEXT("Read"));
+	TestFalse("Should return false for empty ResourcesJson", HasPermission);
 	
 	// Test empty ResourceTypeStr
 	HasPermission = UPubnubChatInternalUtilities::CheckResourcePermission(
-		ResourcesObject, TEXT(""), TEXT("my_channel"), TEXT("Read"));
+		ResourcesJson, TEXT(""), TEXT("my_channel"), TEXT("Read"));
 	TestFalse("Should return false for empty ResourceTypeStr", HasPermission);
 	
 	// Test empty ResourceName
 	HasPermission = UPubnubChatInternalUtilities::CheckResourcePermission(
-		ResourcesObject, TEXT("Channels"), TEXT(""), TEXT("Read"));
+		ResourcesJson, TEXT("Channels"), TEXT(""), TEXT("Read"));
 	TestFalse("Should return false for empty ResourceName", HasPermission);
 	
 	// Test empty PermissionStr
 	HasPermission = UPubnubChatInternalUtilities::CheckResourcePermission(
-		ResourcesObject, TEXT("Channels"), TEXT("my_channel"), TEXT(""));
+		ResourcesJson, TEXT("Channels"), TEXT("my_channel"), TEXT(""));
 	TestFalse("Should return false for empty PermissionStr", HasPermission);
 	
 	// Test missing ResourceType
 	HasPermission = UPubnubChatInternalUtilities::CheckResourcePermission(
-		ResourcesObject, TEXT("NonExistentType"), TEXT("my_channel"), TEXT("Read"));
+		ResourcesJson, TEXT("NonExistentType"), TEXT("my_channel"), TEXT("Read"));
 	TestFalse("Should return false for non-existent ResourceType", HasPermission);
 	
 	return true;
@@ -0,0 +1,97 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/PubnubChatActivityHeartbeat.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PubnubChatSDK/Private/FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "FunctionLibraries/PubnubTimetokenUtilities.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/Package.h"
+
+// ============================================================================
+// ACTIVITY HEARTBEAT UNIT TESTS - Write decisions and coalescing (No API Calls)
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatActivityHeartbeatWriteDecisionTest, "PubnubChat.Unit.ActivityHeartbeat.WriteDecision", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatActivityHeartbeatWriteDecisionTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatActivityHeartbeat* Heartbeat = NewObject<UPubnubChatActivityHeartbeat>(GetTransientPackage());
+	TestNotNull("Heartbeat should be created", Heartbeat);
+	if(!Heartbeat)
+	{
+		return false;
+	}
+
+	// Heartbeat is not initialized with Chat, so only locally marked timestamps are known
+	const int StoreInterval = 600000;
+	Heartbeat->SetActivityLimits(StoreInterval, 0);
+	Heartbeat->ReportActivity();
+
+	const int64 CurrentTimetoken = UPubnubChatInternalUtilities::TimetokenToInt64(UPubnubTimetokenUtilities::GetCurrentUnixTimetoken());
+	const double CurrentTimeSeconds = FPlatformTime::Seconds();
+	TestTrue("Timestamp should be written when it was never marked", Heartbeat->ShouldWriteTimestamp(CurrentTimetoken, CurrentTimeSeconds));
+
+	// User is idle after the idle timeout without activity
+	Heartbeat->SetActivityLimits(StoreInterval, 60000);
+	TestTrue("Active user should get timestamp written", Heartbeat->ShouldWriteTimestamp(CurrentTimetoken, CurrentTimeSeconds + 30.0));
+	TestFalse("Idle user should not get timestamp written", Heartbeat->ShouldWriteTimestamp(CurrentTimetoken, CurrentTimeSeconds + 120.0));
+
+	Heartbeat->SetActivityLimits(StoreInterval, 0);
+	TestTrue("User without idle timeout should never be idle", Heartbeat->ShouldWriteTimestamp(CurrentTimetoken, CurrentTimeSeconds + 120.0));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatActivityHeartbeatCoalescingTest, "PubnubChat.Unit.ActivityHeartbeat.Coalescing", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatActivityHeartbeatCoalescingTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatActivityHeartbeat* Heartbeat = NewObject<UPubnubChatActivityHeartbeat>(GetTransientPackage());
+	if(!Heartbeat)
+	{
+		return false;
+	}
+
+	const int StoreInterval = 600000;
+	const int64 StoreIntervalTimetoken = StoreInterval * 10000LL;
+	Heartbeat->SetActivityLimits(StoreInterval, 0);
+
+	// Stopped heartbeat doesn't touch user updates
+	FPubnubChatUpdateUserInputData StoppedUpdate;
+	StoppedUpdate.Custom = TEXT("{\"team\":\"red\"}");
+	Heartbeat->ApplyToUserUpdate(StoppedUpdate);
+	TestEqual("Stopped heartbeat should not change Custom", StoppedUpdate.Custom, FString(TEXT("{\"team\":\"red\"}")));
+
+	Heartbeat->Start();
+	TestTrue("Heartbeat should be running", Heartbeat->IsRunning());
+
+	// Update that doesn't set Custom keeps the stored timestamp on the server
+	FPubnubChatUpdateUserInputData NameUpdate;
+	NameUpdate.UserName = TEXT("Player");
+	Heartbeat->ApplyToUserUpdate(NameUpdate);
+	TestTrue("Update without Custom should stay without Custom", NameUpdate.Custom.IsEmpty());
+
+	// Update that replaces Custom carries the timestamp
+	FPubnubChatUpdateUserInputData CustomUpdate;
+	CustomUpdate.Custom = TEXT("{\"team\":\"red\"}");
+	Heartbeat->ApplyToUserUpdate(CustomUpdate);
+	const FString InjectedTimestamp = UPubnubChatInternalUtilities::GetLastActiveTimestampFromCustom(CustomUpdate.Custom);
+	TestFalse("Timestamp should be added to replaced Custom", InjectedTimestamp.IsEmpty());
+	TestTrue("Other Custom fields should be kept", CustomUpdate.Custom.Contains(TEXT("team")));
+
+	// Pending update already marked the user, so heartbeat write is skipped until the interval passes
+	const int64 MarkedTimetoken = UPubnubChatInternalUtilities::TimetokenToInt64(InjectedTimestamp);
+	const double CurrentTimeSeconds = FPlatformTime::Seconds();
+	TestFalse("Recently marked user should not get timestamp written", Heartbeat->ShouldWriteTimestamp(MarkedTimetoken + 10000LL, CurrentTimeSeconds));
+	TestTrue("Timestamp should be written again after the interval", Heartbeat->ShouldWriteTimestamp(MarkedTimetoken + StoreIntervalTimetoken, CurrentTimeSeconds));
+
+	Heartbeat->Stop();
+	TestFalse("Heartbeat should not be running after stop", Heartbeat->IsRunning());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
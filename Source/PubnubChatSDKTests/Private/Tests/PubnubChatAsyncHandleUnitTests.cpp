@@ -0,0 +1,129 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/PubnubChatAsyncOperationScope.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PubnubChatSDK/Private/PubnubChatRetryPolicy.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+
+// ============================================================================
+// ASYNC HANDLE UNIT TESTS - Cancellation and deadlines of queued operations (No API Calls)
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatAsyncHandleCancelTest, "PubnubChat.Unit.AsyncHandle.Cancel", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatAsyncHandleCancelTest::RunTest(const FString& Parameters)
+{
+	FPubnubChatAsyncHandle EmptyHandle;
+	TestFalse("Default handle should not refer to any operation", EmptyHandle.IsValid());
+	EmptyHandle.Cancel();
+	TestTrue("Operation without handle should always start", EmptyHandle.TryStart());
+
+	FPubnubChatAsyncHandle AsyncHandle = FPubnubChatAsyncHandle::Create();
+	const FPubnubChatAsyncHandle HandleCopy = AsyncHandle;
+	HandleCopy.Cancel();
+	TestTrue("Cancelling a copy should cancel the operation", AsyncHandle.IsCancelled());
+	TestFalse("Cancelled operation should not start", AsyncHandle.TryStart());
+	TestFalse("Skipped operation should not be started", AsyncHandle.IsStarted());
+
+	const FPubnubChatOperationResult CancelledResult = AsyncHandle.CreateCancelledResult();
+	TestTrue("Cancelled result should be an error", CancelledResult.Error);
+	TestTrue("Cancelled result should be marked as cancelled", CancelledResult.Cancelled);
+
+	FPubnubChatOperationResult MergedResult;
+	MergedResult.Merge(CancelledResult);
+	TestTrue("Merged result should keep the cancelled flag", MergedResult.Cancelled);
+
+	FPubnubChatAsyncHandle StartedHandle = FPubnubChatAsyncHandle::Create();
+	TestTrue("Operation should start", StartedHandle.TryStart());
+	TestTrue("Operation should be started", StartedHandle.IsStarted());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatAsyncHandleDeadlineTest, "PubnubChat.Unit.AsyncHandle.Deadline", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatAsyncHandleDeadlineTest::RunTest(const FString& Parameters)
+{
+	FPubnubChatAsyncHandle AsyncHandle = FPubnubChatAsyncHandle::Create(0.001f);
+	FPlatformProcess::Sleep(0.01f);
+	TestTrue("Operation should expire after its deadline", AsyncHandle.IsExpired());
+	TestFalse("Expired operation should not start", AsyncHandle.TryStart());
+	TestFalse("Expired operation should not be reported as cancelled", AsyncHandle.IsCancelled());
+	TestTrue("Expired result should be marked as cancelled", AsyncHandle.CreateCancelledResult().Cancelled);
+
+	FPubnubChatAsyncHandle NoDeadlineHandle = FPubnubChatAsyncHandle::Create(0.0f);
+	FPlatformProcess::Sleep(0.01f);
+	TestFalse("Operation without deadline should not expire", NoDeadlineHandle.IsExpired());
+
+	FPubnubChatAsyncHandle ShortDeadlineHandle = FPubnubChatAsyncHandle::Create(0.001f);
+	TestTrue("Operation should start before its deadline", ShortDeadlineHandle.TryStart());
+	FPlatformProcess::Sleep(0.01f);
+	TestFalse("Started operation should not expire", ShortDeadlineHandle.IsExpired());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatAsyncHandleScopeTest, "PubnubChat.Unit.AsyncHandle.Scope", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatAsyncHandleScopeTest::RunTest(const FString& Parameters)
+{
+	FPubnubChatRetryConfig RetryConfig;
+	RetryConfig.Enabled = true;
+	RetryConfig.BaseDelayMs = 1;
+	RetryConfig.MaxDelayMs = 2;
+	RetryConfig.CircuitBreakerFailureThreshold = 0;
+	FPubnubChatRetryPolicy RetryPolicy(RetryConfig);
+
+	//Retries don't run on the game thread, so the operation runs on a separate thread, the same way async functions do
+	FPubnubChatAsyncHandle AsyncHandle = FPubnubChatAsyncHandle::Create();
+	bool bScopeStarted = false;
+	bool bCancelledBeforeRequest = true;
+	int NumRetriedCalls = 0;
+	int NumReadCalls = 0;
+	FPubnubOperationResult Result;
+	FPubnubChatOperationResult OperationResult;
+	bool bCancelledAfterScope = true;
+	Async(EAsyncExecution::Thread, [&]()
+	{
+		{
+			FPubnubChatAsyncOperationScope AsyncOperationScope(AsyncHandle);
+			bScopeStarted = AsyncOperationScope.IsStarted();
+			bCancelledBeforeRequest = FPubnubChatAsyncOperationScope::IsCurrentOperationCancelled();
+
+			//Operation cancelled by the first failed attempt is not retried
+			Result = FPubnubChatRetryPolicy::Execute(&RetryPolicy, EPubnubChatRetryOperationType::PCROT_Write, TEXT("SetUserMetadata"), OperationResult, [&]()
+			{
+				++NumRetriedCalls;
+				AsyncHandle.Cancel();
+				return FPubnubOperationResult({503, true, TEXT("")});
+			});
+
+			//Reads of cancelled operation are not sent
+			FPubnubChatRetryPolicy::Execute(nullptr, EPubnubChatRetryOperationType::PCROT_Read, TEXT("FetchHistory"), OperationResult, [&]()
+			{
+				++NumReadCalls;
+				return FPubnubOperationResult({200, false, TEXT("")});
+			});
+		}
+		bCancelledAfterScope = FPubnubChatAsyncOperationScope::IsCurrentOperationCancelled();
+	}).Wait();
+
+	TestTrue("Scope should start the operation", bScopeStarted);
+	TestFalse("Running operation should not be cancelled yet", bCancelledBeforeRequest);
+	TestEqual("Cancelled operation should not retry", NumRetriedCalls, 1);
+	TestTrue("Result of cancelled operation should be an error", Result.Error);
+	TestTrue("Operation result should be marked as cancelled", OperationResult.Cancelled);
+	TestEqual("Read of cancelled operation should not be sent", NumReadCalls, 0);
+	TestFalse("Ended scope should clear the current operation", bCancelledAfterScope);
+
+	FPubnubChatAsyncHandle CancelledHandle = FPubnubChatAsyncHandle::Create();
+	CancelledHandle.Cancel();
+	FPubnubChatAsyncOperationScope SkippedScope(CancelledHandle);
+	TestFalse("Scope of cancelled operation should not start it", SkippedScope.IsStarted());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
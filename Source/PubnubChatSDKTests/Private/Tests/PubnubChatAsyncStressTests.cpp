@@ -0,0 +1,434 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/PubnubChatAsyncOperationScope.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PubnubChatSDK/Private/PubnubChatReactionCoordinator.h"
+#include "PubnubChatSDK/Private/PubnubChatReadMarkerWriter.h"
+#include "PubnubChatSDK/Private/FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "Async/ParallelFor.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	//Sized to finish within a few seconds on a CI agent, while still interleaving every operation on every key
+	const int AsyncStressNumWorkers = 8;
+	const int AsyncStressOperationsPerWorker = 4000;
+	const int AsyncStressNumKeys = 8;
+	const int AsyncStressSeed = 20461;
+	//Drain loop gives up after this many rounds, so a coordinator that never settles fails the test instead of hanging it
+	const int AsyncStressMaxDrainRounds = 1000;
+
+	const FString AsyncStressChannelID = TEXT("async_stress");
+	const FString AsyncStressUserID = TEXT("async_stress_user");
+	const FString AsyncStressReaction = TEXT(":stress:");
+
+	/** Collects invariant violations found on worker threads, so they are reported on the test thread */
+	struct FAsyncStressViolations
+	{
+		FThreadSafeCounter Count;
+		FCriticalSection CriticalSection;
+		FString First = "";
+
+		void Add(const FString& Description)
+		{
+			if (Count.Increment() == 1)
+			{
+				FScopeLock Lock(&CriticalSection);
+				First = Description;
+			}
+		}
+	};
+
+	/**
+	 * Requests collected by the coordinator or writer and not completed yet, played by workers in random order like the async thread would.
+	 * Keys in flight are tracked, so a key collected again before its request completed is reported.
+	 */
+	template<typename RequestType>
+	struct FAsyncStressRequestQueue
+	{
+		FCriticalSection CriticalSection;
+		TArray<TPair<int32, RequestType>> Requests;
+		TSet<int32> KeysInFlight;
+
+		void Add(int32 KeyIndex, const RequestType& Request, FAsyncStressViolations& Violations)
+		{
+			FScopeLock Lock(&CriticalSection);
+			bool bAlreadyInFlight = false;
+			KeysInFlight.Add(KeyIndex, &bAlreadyInFlight);
+			if (bAlreadyInFlight)
+			{
+				Violations.Add(FString::Printf(TEXT("Key %d was collected while its request is in flight"), KeyIndex));
+			}
+			Requests.Emplace(KeyIndex, Request);
+		}
+
+		bool Pop(FRandomStream& Random, TPair<int32, RequestType>& OutRequest)
+		{
+			FScopeLock Lock(&CriticalSection);
+			if (Requests.IsEmpty())
+			{
+				return false;
+			}
+			const int32 RequestIndex = Random.RandRange(0, Requests.Num() - 1);
+			OutRequest = Requests[RequestIndex];
+			Requests.RemoveAtSwap(RequestIndex);
+			return true;
+		}
+
+		/** Has to be called after the server state is updated and before the request is completed, same as in the async thread */
+		void MarkCompleted(int32 KeyIndex)
+		{
+			FScopeLock Lock(&CriticalSection);
+			KeysInFlight.Remove(KeyIndex);
+		}
+	};
+
+	FString GetAsyncStressMessageID(int32 KeyIndex)
+	{
+		return FString::Printf(TEXT("%s.1700000000000000%d"), *AsyncStressChannelID, KeyIndex);
+	}
+
+	FString GetAsyncStressMembershipID(int32 KeyIndex)
+	{
+		return FString::Printf(TEXT("%s_%d.%s"), *AsyncStressChannelID, KeyIndex, *AsyncStressUserID);
+	}
+}
+
+// ============================================================================
+// ASYNC STRESS TESTS - Concurrent cancellation, reaction toggle and read marker storms with invariant checks (No API Calls)
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatAsyncStressCancelStormTest, "PubnubChat.Stress.Async.CancelStorm", EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter);
+
+bool FPubnubChatAsyncStressCancelStormTest::RunTest(const FString& Parameters)
+{
+	//Workers run in pairs - one starts operations of the pair, the other cancels them at the same time
+	const int NumPairs = AsyncStressNumWorkers / 2;
+	TArray<TArray<FPubnubChatAsyncHandle>> HandlesByPair;
+	HandlesByPair.SetNum(NumPairs);
+	for (TArray<FPubnubChatAsyncHandle>& Handles : HandlesByPair)
+	{
+		for (int Operation = 0; Operation < AsyncStressOperationsPerWorker; ++Operation)
+		{
+			Handles.Add(FPubnubChatAsyncHandle::Create());
+		}
+	}
+
+	FAsyncStressViolations Violations;
+	ParallelFor(AsyncStressNumWorkers, [&](int32 WorkerIndex)
+	{
+		FRandomStream Random(AsyncStressSeed + WorkerIndex);
+		const TArray<FPubnubChatAsyncHandle>& Handles = HandlesByPair[WorkerIndex / 2];
+
+		if (WorkerIndex % 2 == 1)
+		{
+			for (int Operation = 0; Operation < AsyncStressOperationsPerWorker; ++Operation)
+			{
+				if (Random.RandRange(0, 1) == 0)
+				{
+					Handles[Operation].Cancel();
+				}
+			}
+			return;
+		}
+
+		for (int Operation = 0; Operation < AsyncStressOperationsPerWorker; ++Operation)
+		{
+			const FPubnubChatAsyncHandle& AsyncHandle = Handles[Operation];
+			{
+				FPubnubChatAsyncOperationScope AsyncOperationScope(AsyncHandle);
+				if (!AsyncOperationScope.IsStarted())
+				{
+					if (!AsyncHandle.IsCancelled())
+					{
+						Violations.Add(FString::Printf(TEXT("Operation %d of worker %d was skipped without being cancelled"), Operation, WorkerIndex));
+					}
+					continue;
+				}
+				if (!AsyncHandle.IsStarted())
+				{
+					Violations.Add(FString::Printf(TEXT("Operation %d of worker %d ran without being started"), Operation, WorkerIndex));
+				}
+
+				//Cancel is never lost - once the handle is cancelled, the running operation sees it
+				if (AsyncHandle.IsCancelled() && !FPubnubChatAsyncOperationScope::IsCurrentOperationCancelled())
+				{
+					Violations.Add(FString::Printf(TEXT("Cancel of running operation %d of worker %d was not seen by its requests"), Operation, WorkerIndex));
+				}
+
+				//Nested operation replaces the current one only until its scope ends
+				{
+					FPubnubChatAsyncHandle NestedHandle = FPubnubChatAsyncHandle::Create();
+					FPubnubChatAsyncOperationScope NestedScope(NestedHandle);
+					NestedHandle.Cancel();
+					if (!FPubnubChatAsyncOperationScope::IsCurrentOperationCancelled())
+					{
+						Violations.Add(FString::Printf(TEXT("Cancel of nested operation in operation %d of worker %d was not seen"), Operation, WorkerIndex));
+					}
+				}
+				if (FPubnubChatAsyncOperationScope::IsCurrentOperationCancelled() && !AsyncHandle.IsCancelled())
+				{
+					Violations.Add(FString::Printf(TEXT("Cancel of nested operation leaked into operation %d of worker %d"), Operation, WorkerIndex));
+				}
+			}
+
+			if (FPubnubChatAsyncOperationScope::IsCurrentOperationCancelled())
+			{
+				Violations.Add(FString::Printf(TEXT("Operation %d of worker %d stayed current after its scope ended"), Operation, WorkerIndex));
+			}
+		}
+	});
+
+	TestEqual(FString::Printf(TEXT("Cancel storm should not violate any invariant. First violation: %s"), *Violations.First), Violations.Count.GetValue(), 0);
+
+	for (const TArray<FPubnubChatAsyncHandle>& Handles : HandlesByPair)
+	{
+		for (const FPubnubChatAsyncHandle& AsyncHandle : Handles)
+		{
+			if (!AsyncHandle.IsStarted() && !AsyncHandle.IsCancelled())
+			{
+				AddError(TEXT("Every operation should either start or be cancelled"));
+				return true;
+			}
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatAsyncStressReactionStormTest, "PubnubChat.Stress.Async.ReactionStorm", EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter);
+
+bool FPubnubChatAsyncStressReactionStormTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatReactionCoordinator* Coordinator = NewObject<UPubnubChatReactionCoordinator>(GetTransientPackage());
+	FAsyncStressViolations Violations;
+
+	//Toggles and collects of the user are ordered, so the desired state of every reaction is the parity of its toggles
+	FCriticalSection UserCriticalSection;
+	TArray<int32> NumToggles;
+	NumToggles.Init(0, AsyncStressNumKeys);
+
+	//Reaction stored on the server, updated by requests before they complete like the repository is
+	FCriticalSection ServerCriticalSection;
+	TArray<FPubnubChatMessageAction> ServerReactions;
+	ServerReactions.SetNum(AsyncStressNumKeys);
+	int64 NextActionTimetoken = 17000000000000000ll;
+
+	//Request adds the reaction when it's desired at the time it's collected, same as the coordinator decides in SendReactionChange
+	FAsyncStressRequestQueue<bool> RequestQueue;
+
+	auto CollectRequests = [&]()
+	{
+		FScopeLock UserLock(&UserCriticalSection);
+		for (const FPubnubChatReactionKey& ReactionKey : Coordinator->CollectDueReactions(1.0))
+		{
+			const int32 KeyIndex = FCString::Atoi(*ReactionKey.Key.Right(1));
+			TArray<FPubnubChatMessageAction> DesiredMessageActions;
+			Coordinator->ApplyPendingReactions(ReactionKey.Key, DesiredMessageActions);
+			RequestQueue.Add(KeyIndex, !DesiredMessageActions.IsEmpty(), Violations);
+		}
+	};
+
+	auto CompleteRequest = [&](FRandomStream& Random)
+	{
+		TPair<int32, bool> Request;
+		if (!RequestQueue.Pop(Random, Request))
+		{
+			return false;
+		}
+
+		const int32 KeyIndex = Request.Key;
+		const bool bAdd = Request.Value;
+		FPubnubChatMessageAction NewServerReaction;
+		{
+			FScopeLock ServerLock(&ServerCriticalSection);
+			const bool bServerHasReaction = !ServerReactions[KeyIndex].Timetoken.IsEmpty();
+			if (bAdd == bServerHasReaction)
+			{
+				Violations.Add(FString::Printf(TEXT("Reaction %d was %s while the server %s it"), KeyIndex, bAdd ? TEXT("added") : TEXT("removed"), bServerHasReaction ? TEXT("has") : TEXT("doesn't have")));
+			}
+			if (bAdd)
+			{
+				NewServerReaction.Type = EPubnubChatMessageActionType::PCMAT_Reaction;
+				NewServerReaction.Value = AsyncStressReaction;
+				NewServerReaction.Timetoken = UPubnubChatInternalUtilities::Int64ToTimetoken(++NextActionTimetoken);
+			}
+			ServerReactions[KeyIndex] = NewServerReaction;
+		}
+
+		RequestQueue.MarkCompleted(KeyIndex);
+		Coordinator->CompleteReactionChange(FPubnubChatReactionKey(GetAsyncStressMessageID(KeyIndex), AsyncStressReaction), FPubnubChatOperationResult(), NewServerReaction);
+		return true;
+	};
+
+	ParallelFor(AsyncStressNumWorkers, [&](int32 WorkerIndex)
+	{
+		FRandomStream Random(AsyncStressSeed + WorkerIndex);
+		for (int Operation = 0; Operation < AsyncStressOperationsPerWorker; ++Operation)
+		{
+			switch (Random.RandRange(0, 3))
+			{
+			case 0:
+			case 1:
+				{
+					const int32 KeyIndex = Random.RandRange(0, AsyncStressNumKeys - 1);
+					FScopeLock UserLock(&UserCriticalSection);
+					const bool bExpectedDesired = ++NumToggles[KeyIndex] % 2 == 1;
+					const bool bDesired = Coordinator->RegisterToggle(GetAsyncStressMessageID(KeyIndex), AsyncStressChannelID, GetAsyncStressMessageID(KeyIndex).Right(17), AsyncStressReaction, [&]()
+					{
+						FScopeLock ServerLock(&ServerCriticalSection);
+						TArray<FPubnubChatMessageAction> ServerMessageActions;
+						if (!ServerReactions[KeyIndex].Timetoken.IsEmpty())
+						{
+							ServerMessageActions.Add(ServerReactions[KeyIndex]);
+						}
+						return ServerMessageActions;
+					}, 0.0);
+
+					if (bDesired != bExpectedDesired)
+					{
+						Violations.Add(FString::Printf(TEXT("Toggle %d of reaction %d by worker %d left it %s"), NumToggles[KeyIndex], KeyIndex, WorkerIndex, bDesired ? TEXT("added") : TEXT("removed")));
+					}
+					break;
+				}
+			case 2:
+				CollectRequests();
+				break;
+			default:
+				CompleteRequest(Random);
+				break;
+			}
+		}
+	});
+
+	//Drain like the flush ticker and the async thread would after the user stops toggling
+	FRandomStream DrainRandom(AsyncStressSeed);
+	for (int Round = 0; Round < AsyncStressMaxDrainRounds && Coordinator->GetNumPendingReactions() > 0; ++Round)
+	{
+		CollectRequests();
+		while (CompleteRequest(DrainRandom)) {}
+	}
+
+	TestEqual(FString::Printf(TEXT("Reaction storm should not violate any invariant. First violation: %s"), *Violations.First), Violations.Count.GetValue(), 0);
+	TestEqual("All reactions should be settled", Coordinator->GetNumPendingReactions(), 0);
+	for (int32 KeyIndex = 0; KeyIndex < AsyncStressNumKeys; ++KeyIndex)
+	{
+		TestEqual(FString::Printf(TEXT("Server state of reaction %d should match the parity of its toggles"), KeyIndex), !ServerReactions[KeyIndex].Timetoken.IsEmpty(), NumToggles[KeyIndex] % 2 == 1);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatAsyncStressReadMarkerStormTest, "PubnubChat.Stress.Async.ReadMarkerStorm", EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter);
+
+bool FPubnubChatAsyncStressReadMarkerStormTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatReadMarkerWriter* Writer = NewObject<UPubnubChatReadMarkerWriter>(GetTransientPackage());
+	FAsyncStressViolations Violations;
+
+	//Writes and collects of the user are ordered, so a marker is accepted only when it's higher than every marker set before
+	FCriticalSection UserCriticalSection;
+	TArray<int64> HighestMarkers;
+	HighestMarkers.Init(0, AsyncStressNumKeys);
+
+	//Marker stored on the server, updated by writes before they complete like the repository is
+	FCriticalSection ServerCriticalSection;
+	TArray<int64> ServerMarkers;
+	ServerMarkers.Init(0, AsyncStressNumKeys);
+
+	FAsyncStressRequestQueue<FString> RequestQueue;
+
+	auto CollectRequests = [&]()
+	{
+		FScopeLock UserLock(&UserCriticalSection);
+		for (const FString& MembershipID : Writer->CollectDueReadMarkers(1.0))
+		{
+			const int32 KeyIndex = FCString::Atoi(*MembershipID.Mid(AsyncStressChannelID.Len() + 1));
+			RequestQueue.Add(KeyIndex, Writer->ApplyPendingReadMarker(MembershipID, FString()), Violations);
+		}
+	};
+
+	auto CompleteRequest = [&](FRandomStream& Random)
+	{
+		TPair<int32, FString> Request;
+		if (!RequestQueue.Pop(Random, Request))
+		{
+			return false;
+		}
+
+		const int32 KeyIndex = Request.Key;
+		const int64 WrittenMarker = UPubnubChatInternalUtilities::TimetokenToInt64(Request.Value);
+		{
+			FScopeLock ServerLock(&ServerCriticalSection);
+			if (WrittenMarker <= ServerMarkers[KeyIndex])
+			{
+				Violations.Add(FString::Printf(TEXT("Marker %d was written back from %lld to %lld"), KeyIndex, ServerMarkers[KeyIndex], WrittenMarker));
+			}
+			ServerMarkers[KeyIndex] = FMath::Max(ServerMarkers[KeyIndex], WrittenMarker);
+		}
+
+		RequestQueue.MarkCompleted(KeyIndex);
+		Writer->CompleteReadMarkerWrite(GetAsyncStressMembershipID(KeyIndex), FPubnubChatOperationResult(), Request.Value);
+		return true;
+	};
+
+	ParallelFor(AsyncStressNumWorkers, [&](int32 WorkerIndex)
+	{
+		FRandomStream Random(AsyncStressSeed + WorkerIndex);
+		for (int Operation = 0; Operation < AsyncStressOperationsPerWorker; ++Operation)
+		{
+			switch (Random.RandRange(0, 3))
+			{
+			case 0:
+			case 1:
+				{
+					const int32 KeyIndex = Random.RandRange(0, AsyncStressNumKeys - 1);
+					const int64 Marker = 17000000000000000ll + Random.RandRange(1, 1000000);
+					FScopeLock UserLock(&UserCriticalSection);
+					const bool bExpectedAccepted = Marker > HighestMarkers[KeyIndex];
+					const bool bAccepted = Writer->RegisterReadMarker(GetAsyncStressMembershipID(KeyIndex), FString::Printf(TEXT("%s_%d"), *AsyncStressChannelID, KeyIndex), AsyncStressUserID, TEXT("group"), UPubnubChatInternalUtilities::Int64ToTimetoken(Marker), [&]()
+					{
+						FScopeLock ServerLock(&ServerCriticalSection);
+						return ServerMarkers[KeyIndex] > 0 ? UPubnubChatInternalUtilities::Int64ToTimetoken(ServerMarkers[KeyIndex]) : FString();
+					}, 0.0);
+					HighestMarkers[KeyIndex] = FMath::Max(HighestMarkers[KeyIndex], Marker);
+
+					if (bAccepted != bExpectedAccepted)
+					{
+						Violations.Add(FString::Printf(TEXT("Marker %lld of membership %d by worker %d was %s"), Marker, KeyIndex, WorkerIndex, bAccepted ? TEXT("accepted below an earlier marker") : TEXT("skipped above every earlier marker")));
+					}
+					break;
+				}
+			case 2:
+				CollectRequests();
+				break;
+			default:
+				CompleteRequest(Random);
+				break;
+			}
+		}
+	});
+
+	//Drain like the flush ticker and the async thread would after the user stops reading
+	FRandomStream DrainRandom(AsyncStressSeed);
+	for (int Round = 0; Round < AsyncStressMaxDrainRounds && Writer->GetNumPendingReadMarkers() > 0; ++Round)
+	{
+		CollectRequests();
+		while (CompleteRequest(DrainRandom)) {}
+	}
+
+	TestEqual(FString::Printf(TEXT("Read marker storm should not violate any invariant. First violation: %s"), *Violations.First), Violations.Count.GetValue(), 0);
+	TestEqual("All markers should be settled", Writer->GetNumPendingReadMarkers(), 0);
+	for (int32 KeyIndex = 0; KeyIndex < AsyncStressNumKeys; ++KeyIndex)
+	{
+		TestEqual(FString::Printf(TEXT("Server marker of membership %d should be the highest one set"), KeyIndex), ServerMarkers[KeyIndex], HighestMarkers[KeyIndex]);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
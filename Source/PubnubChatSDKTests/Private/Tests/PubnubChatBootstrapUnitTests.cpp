@@ -0,0 +1,70 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/PubnubChatBootstrap.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PubnubChatSDK/Private/PubnubChatConst.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+// ============================================================================
+// BOOTSTRAP UNIT TESTS - Warm start snapshot (No API Calls)
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatBootstrapSnapshotTest, "PubnubChat.Unit.Bootstrap.Snapshot", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatBootstrapSnapshotTest::RunTest(const FString& Parameters)
+{
+	const FString TestUserID = TEXT("bootstrap_user");
+
+	FPubnubChatInternalBootstrapSnapshot Snapshot;
+	Snapshot.Version = Pubnub_Chat_Bootstrap_Snapshot_Version;
+	Snapshot.UserID = TestUserID;
+	Snapshot.UserData.UserName = TEXT("Bootstrap User");
+	Snapshot.SavedTimetoken = TEXT("17500000000000000");
+
+	FPubnubChatInternalSnapshotMembership& Membership = Snapshot.Memberships.AddDefaulted_GetRef();
+	Membership.ChannelID = TEXT("bootstrap_channel");
+	Membership.ChannelData.ChannelName = TEXT("Bootstrap Channel");
+	Membership.UnreadMessagesCount = 3;
+
+	FPubnubChatInternalSnapshotMessage& Message = Snapshot.LastMessages.AddDefaulted_GetRef();
+	Message.Timetoken = TEXT("17500000000000001");
+	Message.MessageData.ChannelID = TEXT("bootstrap_channel");
+	Message.MessageData.Text = TEXT("Last message");
+
+	// Snapshot survives the round trip
+	const FString SnapshotJson = UPubnubChatBootstrap::SerializeSnapshot(Snapshot);
+	TestFalse("Serialized snapshot should not be empty", SnapshotJson.IsEmpty());
+
+	FPubnubChatInternalBootstrapSnapshot LoadedSnapshot;
+	TestTrue("Snapshot should be deserialized", UPubnubChatBootstrap::DeserializeSnapshot(SnapshotJson, TestUserID, LoadedSnapshot));
+	TestEqual("User name should be restored", LoadedSnapshot.UserData.UserName, Snapshot.UserData.UserName);
+	TestEqual("Memberships should be restored", LoadedSnapshot.Memberships.Num(), 1);
+	TestEqual("Messages should be restored", LoadedSnapshot.LastMessages.Num(), 1);
+	if (LoadedSnapshot.Memberships.Num() == 1 && LoadedSnapshot.LastMessages.Num() == 1)
+	{
+		TestEqual("Channel name should be restored", LoadedSnapshot.Memberships[0].ChannelData.ChannelName, Membership.ChannelData.ChannelName);
+		TestEqual("Unread messages count should be restored", LoadedSnapshot.Memberships[0].UnreadMessagesCount, 3);
+		TestEqual("Message timetoken should be restored", LoadedSnapshot.LastMessages[0].Timetoken, Message.Timetoken);
+		TestEqual("Message text should be restored", LoadedSnapshot.LastMessages[0].MessageData.Text, Message.MessageData.Text);
+	}
+
+	// Snapshot of other user, other version or a broken file is never used
+	FPubnubChatInternalBootstrapSnapshot RejectedSnapshot;
+	TestFalse("Snapshot of other user should be rejected", UPubnubChatBootstrap::DeserializeSnapshot(SnapshotJson, TEXT("other_user"), RejectedSnapshot));
+
+	Snapshot.Version = Pubnub_Chat_Bootstrap_Snapshot_Version + 1;
+	TestFalse("Snapshot of other version should be rejected", UPubnubChatBootstrap::DeserializeSnapshot(UPubnubChatBootstrap::SerializeSnapshot(Snapshot), TestUserID, RejectedSnapshot));
+	TestFalse("Broken snapshot should be rejected", UPubnubChatBootstrap::DeserializeSnapshot(TEXT("{not json"), TestUserID, RejectedSnapshot));
+
+	// Every user has its own snapshot file in Saved/
+	const FString SnapshotPath = UPubnubChatBootstrap::GetSnapshotFilePath(TEXT("user/with:invalid*chars"));
+	TestTrue("Snapshot should be stored in Saved directory", SnapshotPath.StartsWith(FPaths::ProjectSavedDir()));
+	TestFalse("Snapshot file name should be valid", FPaths::GetCleanFilename(SnapshotPath).Contains(TEXT("/")) || FPaths::GetCleanFilename(SnapshotPath).Contains(TEXT(":")));
+	TestNotEqual("Users should have different snapshot files", UPubnubChatBootstrap::GetSnapshotFilePath(TEXT("user_a")), UPubnubChatBootstrap::GetSnapshotFilePath(TEXT("user_b")));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -4135,6 +4135,93 @@ bool FPubnubChatCreateGroupConversationMixedValidInvalidUsersTest::RunTest(const
 	return true;
 }
 
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubChatCreateGroupConversationRerunTest, FPubnubChatAutomationTestBase, "PubnubChat.Integration.Chat.Channel.CreateGroupConversation.4Advanced.RerunKeepsExistingMembers", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatCreateGroupConversationRerunTest::RunTest(const FString& Parameters)
+{
+	if(!InitTest())
+	{
+		AddError("TestInitialization failed");
+		return false;
+	}
+
+	const FString TestPublishKey = GetTestPublishKey();
+	const FString TestSubscribeKey = GetTestSubscribeKey();
+	const FString InitUserID = SDK_PREFIX + "test_create_group_rerun_init";
+	const FString TargetUserID1 = SDK_PREFIX + "test_create_group_rerun_target1";
+	const FString TargetUserID2 = SDK_PREFIX + "test_create_group_rerun_target2";
+	const FString TestChannelID = SDK_PREFIX + "test_create_group_rerun";
+	
+	FPubnubChatConfig ChatConfig;
+	FPubnubChatInitChatResult InitResult = ChatSubsystem->InitChat(TestPublishKey, TestSubscribeKey, InitUserID, ChatConfig);
+	
+	TestFalse("InitChat should succeed", InitResult.Result.Error);
+	
+	UPubnubChat* Chat = InitResult.Chat;
+	UPubnubClient* PubnubClient = GetPubnubClientFromChat(Chat);
+	if(!Chat || !PubnubClient)
+	{
+		AddError("Chat should be initialized");
+		CleanUpCurrentChatUser(Chat);
+		CleanUp();
+		return false;
+	}
+	
+	FPubnubChatUserResult CreateUser1Result = Chat->CreateUser(TargetUserID1, FPubnubChatUserData());
+	FPubnubChatUserResult CreateUser2Result = Chat->CreateUser(TargetUserID2, FPubnubChatUserData());
+	if(!CreateUser1Result.User || !CreateUser2Result.User)
+	{
+		AddError("Users should be created");
+		CleanUpCurrentChatUser(Chat);
+		CleanUp();
+		return false;
+	}
+	
+	// First attempt invited only the first user, who has already accepted the invite
+	FPubnubChatCreateGroupConversationResult FirstResult = Chat->CreateGroupConversation({CreateUser1Result.User}, TestChannelID);
+	TestFalse("First CreateGroupConversation should succeed", FirstResult.Result.Error);
+	FPubnubChatMembershipData JoinedMembershipData;
+	JoinedMembershipData.Status = TEXT("joined");
+	FPubnubChannelMembersResult JoinResult = PubnubClient->SetChannelMembers(TestChannelID, {JoinedMembershipData.ToPubnubChannelMemberInputData(TargetUserID1)}, FPubnubMemberInclude::FromValue(false), 1);
+	TestFalse("Accepting the invite should succeed", JoinResult.Result.Error);
+	
+	// Running it again with all users keeps the existing member and invites only the new one
+	FPubnubChatCreateGroupConversationResult RerunResult = Chat->CreateGroupConversation({CreateUser1Result.User, CreateUser2Result.User, CreateUser2Result.User}, TestChannelID);
+	TestFalse("Rerun of CreateGroupConversation should succeed", RerunResult.Result.Error);
+	TestNotNull("HostMembership should be created", RerunResult.HostMembership);
+	TestEqual("Every user should have one membership", RerunResult.InviteesMemberships.Num(), 2);
+	
+	for(UPubnubChatMembership* Membership : RerunResult.InviteesMemberships)
+	{
+		if(!Membership)
+		{ continue; }
+		
+		if(Membership->GetUserID() == TargetUserID1)
+		{
+			TestEqual("Existing member should keep its status", Membership->GetMembershipData().Status, FString(TEXT("joined")));
+		}
+		else
+		{
+			TestEqual("New invitee should have pending status", Membership->GetMembershipData().Status, FString(TEXT("pending")));
+			TestFalse("New invitee should have last read message timetoken set", Membership->GetLastReadMessageTimetoken().IsEmpty());
+		}
+	}
+	
+	FPubnubChannelMembersResult MembersResult = PubnubClient->GetChannelMembers(TestChannelID, FPubnubMemberInclude::FromValue(true), 10);
+	TestFalse("GetChannelMembers should succeed", MembersResult.Result.Error);
+	TestEqual("Channel should have host and both invitees", MembersResult.MembersData.Num(), 3);
+	
+	// Cleanup: Remove memberships, delete channel and users
+	PubnubClient->RemoveChannelMembers(TestChannelID, {InitUserID, TargetUserID1, TargetUserID2}, FPubnubMemberInclude::FromValue(false), 1);
+	Chat->DeleteChannel(TestChannelID);
+	Chat->DeleteUser(TargetUserID1);
+	Chat->DeleteUser(TargetUserID2);
+
+	CleanUpCurrentChatUser(Chat);
+	CleanUp();
+	return true;
+}
+
 // ============================================================================
 // GETCHANNELSUGGESTIONS TESTS
 // ============================================================================
@@ -1902,6 +1902,124 @@ bool FPubnubChatChannelGetHistoryOnThreadReturnsThreadMessagesTest::RunTest(cons
 	return true;
 }
 
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubChatChannelGetHistorySharesLiveMessageObjectsTest, FPubnubChatAutomationTestBase, "PubnubChat.Integration.Channel.GetHistory.4Advanced.SharesLiveMessageObjects", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatChannelGetHistorySharesLiveMessageObjectsTest::RunTest(const FString& Parameters)
+{
+	if(!InitTest())
+	{
+		AddError("TestInitialization failed");
+		return false;
+	}
+
+	const FString TestPublishKey = GetTestPublishKey();
+	const FString TestSubscribeKey = GetTestSubscribeKey();
+	const FString InitUserID = SDK_PREFIX + "test_get_history_shares_objects_init";
+	const FString TestChannelID = SDK_PREFIX + "test_get_history_shares_objects";
+	const FString TestMessageText = TEXT("Message for live message objects test");
+
+	FPubnubChatConfig ChatConfig;
+	FPubnubChatInitChatResult InitResult = ChatSubsystem->InitChat(TestPublishKey, TestSubscribeKey, InitUserID, ChatConfig);
+	TestFalse("InitChat should succeed", InitResult.Result.Error);
+
+	UPubnubChat* Chat = InitResult.Chat;
+	if(!Chat)
+	{
+		AddError("Chat should be initialized");
+		CleanUpCurrentChatUser(Chat);
+		CleanUp();
+		return false;
+	}
+
+	FPubnubChatChannelData ChannelData;
+	FPubnubChatChannelResult CreateChannelResult = Chat->CreatePublicConversation(TestChannelID, ChannelData);
+	TestFalse("CreatePublicConversation should succeed", CreateChannelResult.Result.Error);
+	TestNotNull("Channel should be created", CreateChannelResult.Channel);
+
+	if(!CreateChannelResult.Channel)
+	{
+		Chat->DeleteChannel(TestChannelID);
+		CleanUpCurrentChatUser(Chat);
+		CleanUp();
+		return false;
+	}
+
+	//Received message is created on the subscription thread, so it goes through the game thread lookup
+	TSharedPtr<UPubnubChatMessage*> ReceivedMessage = MakeShared<UPubnubChatMessage*>(nullptr);
+	CreateChannelResult.Channel->OnMessageReceivedNative.AddLambda([ReceivedMessage, TestMessageText](UPubnubChatMessage* Message)
+	{
+		if(Message && !*ReceivedMessage && Message->GetMessageData().Text == TestMessageText)
+		{
+			*ReceivedMessage = Message;
+		}
+	});
+
+	FPubnubChatOperationResult ConnectResult = CreateChannelResult.Channel->Connect();
+	TestFalse("Connect should succeed", ConnectResult.Error);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, CreateChannelResult, TestMessageText]()
+	{
+		FPubnubChatOperationResult SendResult = CreateChannelResult.Channel->SendText(TestMessageText);
+		TestFalse("SendText should succeed", SendResult.Error);
+	}, 0.5f));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitUntilLatentCommand([ReceivedMessage]() -> bool {
+		return *ReceivedMessage != nullptr;
+	}, MAX_WAIT_TIME));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, CreateChannelResult, ReceivedMessage]()
+	{
+		if(!*ReceivedMessage)
+		{
+			AddError("Message was not received");
+			return;
+		}
+		const FString MessageTimetoken = (*ReceivedMessage)->GetMessageTimetoken();
+		const FString CurrentTimetoken = UPubnubTimetokenUtilities::GetCurrentUnixTimetoken();
+		const FString EndTimetoken = UPubnubTimetokenUtilities::AddIntToTimetoken(CurrentTimetoken, -100000000);
+
+		//Every Chat function that returns the same message has to return the same live object
+		FPubnubChatGetHistoryResult FirstHistoryResult = CreateChannelResult.Channel->GetHistory(CurrentTimetoken, EndTimetoken);
+		FPubnubChatGetHistoryResult SecondHistoryResult = CreateChannelResult.Channel->GetHistory(CurrentTimetoken, EndTimetoken);
+		TestFalse("First GetHistory should succeed", FirstHistoryResult.Result.Error);
+		TestFalse("Second GetHistory should succeed", SecondHistoryResult.Result.Error);
+
+		UPubnubChatMessage* FirstHistoryMessage = nullptr;
+		UPubnubChatMessage* SecondHistoryMessage = nullptr;
+		for(UPubnubChatMessage* Message : FirstHistoryResult.Messages)
+		{
+			if(Message && Message->GetMessageTimetoken() == MessageTimetoken) { FirstHistoryMessage = Message; }
+		}
+		for(UPubnubChatMessage* Message : SecondHistoryResult.Messages)
+		{
+			if(Message && Message->GetMessageTimetoken() == MessageTimetoken) { SecondHistoryMessage = Message; }
+		}
+		TestNotNull("Message should be in history", FirstHistoryMessage);
+		TestTrue("History should return the received message object", FirstHistoryMessage == *ReceivedMessage);
+		TestTrue("Repeated history should return the same message object", SecondHistoryMessage == FirstHistoryMessage);
+
+		FPubnubChatMessageResult GetMessageResult = CreateChannelResult.Channel->GetMessage(MessageTimetoken);
+		TestFalse("GetMessage should succeed", GetMessageResult.Result.Error);
+		TestTrue("GetMessage should return the received message object", GetMessageResult.Message == *ReceivedMessage);
+	}, 1.0f));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, CreateChannelResult, Chat, TestChannelID]()
+	{
+		if(CreateChannelResult.Channel)
+		{
+			CreateChannelResult.Channel->Disconnect();
+		}
+		if(Chat)
+		{
+			Chat->DeleteChannel(TestChannelID);
+		}
+		CleanUpCurrentChatUser(Chat);
+		CleanUp();
+	}, 0.1f));
+
+	return true;
+}
+
 // ============================================================================
 // GETMESSAGE TESTS
 // ============================================================================
@@ -0,0 +1,121 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/PubnubChatDispatchQueue.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/PlatformProcess.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/Package.h"
+
+// ============================================================================
+// DISPATCH QUEUE UNIT TESTS - Listener turns, coalescing, frame budget and dropping (No API Calls)
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatDispatchQueueOrderTest, "PubnubChat.Unit.DispatchQueue.Order", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatDispatchQueueOrderTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatDispatchQueue* Queue = NewObject<UPubnubChatDispatchQueue>(GetTransientPackage());
+	UObject* ListenerA = NewObject<UPubnubChatDispatchQueue>(GetTransientPackage());
+	UObject* ListenerB = NewObject<UPubnubChatDispatchQueue>(GetTransientPackage());
+
+	TArray<FString> Delivered;
+	Queue->Enqueue(ListenerA, [&Delivered]() { Delivered.Add(TEXT("A1")); });
+	Queue->Enqueue(ListenerA, [&Delivered]() { Delivered.Add(TEXT("A2")); });
+	Queue->Enqueue(ListenerA, [&Delivered]() { Delivered.Add(TEXT("A3")); });
+	Queue->Enqueue(ListenerB, [&Delivered]() { Delivered.Add(TEXT("B1")); });
+	TestEqual("All events should be pending", Queue->GetNumPendingEvents(), 4);
+
+	// Listeners are drained in turns, events of one listener stay in order
+	TestEqual("All events should be delivered within the budget", Queue->DispatchPendingEvents(1.0), 4);
+	TestEqual("Events should be delivered in listener turns", FString::Join(Delivered, TEXT(",")), FString(TEXT("A1,B1,A2,A3")));
+	TestEqual("Nothing should be pending", Queue->GetNumPendingEvents(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatDispatchQueueCoalesceTest, "PubnubChat.Unit.DispatchQueue.Coalesce", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatDispatchQueueCoalesceTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatDispatchQueue* Queue = NewObject<UPubnubChatDispatchQueue>(GetTransientPackage());
+	UObject* ListenerA = NewObject<UPubnubChatDispatchQueue>(GetTransientPackage());
+	UObject* ListenerB = NewObject<UPubnubChatDispatchQueue>(GetTransientPackage());
+
+	TArray<FString> Delivered;
+	Queue->Enqueue(ListenerA, [&Delivered]() { Delivered.Add(TEXT("Typing1")); }, TEXT("Typing"));
+	Queue->Enqueue(ListenerA, [&Delivered]() { Delivered.Add(TEXT("Message")); });
+	Queue->Enqueue(ListenerA, [&Delivered]() { Delivered.Add(TEXT("Typing2")); }, TEXT("Typing"));
+	// Same key of another listener is not superseded
+	Queue->Enqueue(ListenerB, [&Delivered]() { Delivered.Add(TEXT("OtherTyping")); }, TEXT("Typing"));
+	TestEqual("Superseded event should not be counted", Queue->GetNumPendingEvents(), 3);
+
+	Queue->DispatchPendingEvents(1.0);
+	TestEqual("Only the latest event with the key should be delivered, in its position", FString::Join(Delivered, TEXT(",")), FString(TEXT("Message,OtherTyping,Typing2")));
+
+	// Key can be used again after its event was delivered
+	Delivered.Empty();
+	Queue->Enqueue(ListenerA, [&Delivered]() { Delivered.Add(TEXT("Typing3")); }, TEXT("Typing"));
+	Queue->DispatchPendingEvents(1.0);
+	TestEqual("New event with delivered key should be delivered", FString::Join(Delivered, TEXT(",")), FString(TEXT("Typing3")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatDispatchQueueBudgetTest, "PubnubChat.Unit.DispatchQueue.Budget", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatDispatchQueueBudgetTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatDispatchQueue* Queue = NewObject<UPubnubChatDispatchQueue>(GetTransientPackage());
+	UObject* Listener = NewObject<UPubnubChatDispatchQueue>(GetTransientPackage());
+
+	int DeliveredCount = 0;
+	for (int i = 0; i < 5; ++i)
+	{
+		Queue->Enqueue(Listener, [&DeliveredCount]() { DeliveredCount++; FPlatformProcess::Sleep(0.002f); });
+	}
+
+	// Used budget stops the frame, but at least one event is always delivered
+	TestEqual("Single event should be delivered when the budget is used by it", Queue->DispatchPendingEvents(0.0), 1);
+	TestEqual("Rest of events should stay pending", Queue->GetNumPendingEvents(), 4);
+
+	// Events enqueued by delegates are delivered in later turns of the same frame
+	Queue->Enqueue(Listener, [&DeliveredCount, Queue, Listener]() { Queue->Enqueue(Listener, [&DeliveredCount]() { DeliveredCount++; }); });
+	Queue->DispatchPendingEvents(1.0);
+	TestEqual("All events should be delivered", DeliveredCount, 6);
+	TestEqual("Nothing should be pending", Queue->GetNumPendingEvents(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatDispatchQueueDropTest, "PubnubChat.Unit.DispatchQueue.DropOldest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatDispatchQueueDropTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatDispatchQueue* Queue = NewObject<UPubnubChatDispatchQueue>(GetTransientPackage());
+	UObject* Listener = NewObject<UPubnubChatDispatchQueue>(GetTransientPackage());
+
+	TArray<FString> Delivered;
+	Queue->Enqueue(Listener, [&Delivered]() { Delivered.Add(TEXT("Priority")); });
+	Queue->Enqueue(Listener, [&Delivered]() { Delivered.Add(TEXT("M1")); }, TEXT(""), true);
+	Queue->Enqueue(Listener, [&Delivered]() { Delivered.Add(TEXT("Batch")); }, TEXT("Batch"));
+	Queue->Enqueue(Listener, [&Delivered]() { Delivered.Add(TEXT("M2")); }, TEXT(""), true);
+	Queue->Enqueue(Listener, [&Delivered]() { Delivered.Add(TEXT("M3")); }, TEXT(""), true);
+	TestEqual("Only droppable events should be counted as droppable", Queue->GetNumDroppableEvents(Listener), 3);
+
+	// Oldest droppable events are removed, other events are kept
+	TestTrue("Oldest droppable event should be dropped", Queue->DropOldestEvent(Listener));
+	TestTrue("Next droppable event should be dropped", Queue->DropOldestEvent(Listener));
+	TestEqual("Droppable count should decrease", Queue->GetNumDroppableEvents(Listener), 1);
+	TestEqual("Listener pending count should decrease", Queue->GetNumPendingEvents(Listener), 3);
+
+	Queue->DispatchPendingEvents(1.0);
+	TestEqual("Dropped events should not be delivered", FString::Join(Delivered, TEXT(",")), FString(TEXT("Priority,Batch,M3")));
+	TestFalse("Nothing should be dropped from empty queue", Queue->DropOldestEvent(Listener));
+	TestEqual("Nothing should be pending", Queue->GetNumPendingEvents(), 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,264 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/FunctionLibraries/PubnubChatJsonReader.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PubnubChatSDK/Private/FunctionLibraries/PubnubChatInternalConverters.h"
+#include "PubnubChatSDK/Private/FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "Dom/JsonObject.h"
+#include "FunctionLibraries/PubnubJsonUtilities.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/AutomationTest.h"
+
+// ============================================================================
+// JSON READER UNIT TESTS - Pull reader and utilities ported onto it (No API Calls)
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatJsonReaderFieldsTest, "PubnubChat.Unit.JsonReader.Fields", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatJsonReaderFieldsTest::RunTest(const FString& Parameters)
+{
+	const FString Json = TEXT(R"({"skipped":{"type":"nested","list":[1,{"a":[]},"x"]}, "type" : "text", "text":"Line\nwith \"quotes\" A","count":-1.5e3,"flag":true,"empty":null})");
+
+	FString Value;
+	TestTrue("Root field after nested values should be found", FPubnubChatJsonReader::TryGetStringField(Json, TEXT("type"), Value));
+	TestEqual("Nested field with the same name should be skipped", Value, FString(TEXT("text")));
+
+	TestTrue("Escaped string should be read", FPubnubChatJsonReader::TryGetStringField(Json, TEXT("text"), Value));
+	TestEqual("Escapes should be decoded", Value, FString(TEXT("Line\nwith \"quotes\" A")));
+
+	TestTrue("Number should be read as string", FPubnubChatJsonReader::TryGetStringField(Json, TEXT("count"), Value));
+	TestEqual("Number text should be kept", Value, FString(TEXT("-1.5e3")));
+
+	bool Flag = false;
+	TestTrue("Bool should be read", FPubnubChatJsonReader::TryGetBoolField(Json, TEXT("flag"), Flag));
+	TestTrue("Bool value should match", Flag);
+	TestFalse("Null should not be read as string", FPubnubChatJsonReader::TryGetStringField(Json, TEXT("empty"), Value));
+	TestFalse("Missing field should not be found", FPubnubChatJsonReader::TryGetStringField(Json, TEXT("missing"), Value));
+	TestTrue("Field lookup should ignore case like FJsonObject", FPubnubChatJsonReader::IsStringFieldEqual(Json, TEXT("TYPE"), TEXT("text")));
+
+	FStringView Object;
+	TestTrue("Object field should be read", FPubnubChatJsonReader::TryGetObjectField(Json, TEXT("skipped"), Object));
+	TestEqual("Object text should include braces", FString(Object), FString(TEXT(R"({"type":"nested","list":[1,{"a":[]},"x"]})")));
+
+	TestFalse("Malformed JSON should not return fields", FPubnubChatJsonReader::TryGetStringField(TEXT(R"({"type":"te)"), TEXT("type"), Value));
+	TestFalse("Non object JSON should not return fields", FPubnubChatJsonReader::TryGetStringField(TEXT(R"(["type","text"])"), TEXT("type"), Value));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatJsonReaderRemoveFieldTest, "PubnubChat.Unit.JsonReader.RemoveField", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatJsonReaderRemoveFieldTest::RunTest(const FString& Parameters)
+{
+	TestEqual("First field should be removed with its separator", FPubnubChatJsonReader::RemoveField(TEXT(R"({"type":"typing","value":true})"), TEXT("type")), FString(TEXT(R"({"value":true})")));
+	TestEqual("Last field should be removed with its separator", FPubnubChatJsonReader::RemoveField(TEXT(R"({"value":true,"type":"typing"})"), TEXT("type")), FString(TEXT(R"({"value":true})")));
+	TestEqual("Only field should leave empty object", FPubnubChatJsonReader::RemoveField(TEXT(R"({"type":"typing"})"), TEXT("type")), FString(TEXT("{}")));
+	TestEqual("Nested field should not be removed", FPubnubChatJsonReader::RemoveField(TEXT(R"({"data":{"type":"x"}})"), TEXT("type")), FString(TEXT(R"({"data":{"type":"x"}})")));
+	TestEqual("Invalid JSON should give empty object", FPubnubChatJsonReader::RemoveField(TEXT("not json"), TEXT("type")), FString(TEXT("{}")));
+
+	FPubnubMessageData MessageData;
+	MessageData.Message = TEXT(R"({"type":"receipt","messageTimetoken":"17000000000000001"})");
+	const FPubnubChatEvent Event = UPubnubChatInternalUtilities::GetEventFromPubnubMessageData(MessageData);
+	TestEqual("Event type should be read", Event.Type, EPubnubChatEventType::PCET_Receipt);
+	TestEqual("Event payload should not contain type", Event.Payload, FString(TEXT(R"({"messageTimetoken":"17000000000000001"})")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatJsonReaderUtilitiesTest, "PubnubChat.Unit.JsonReader.Utilities", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatJsonReaderUtilitiesTest::RunTest(const FString& Parameters)
+{
+	TestTrue("Typing message should be an event", UPubnubChatInternalUtilities::IsThisEventMessage(TEXT(R"({"value":true,"type":"typing"})")));
+	TestFalse("Text message should not be an event", UPubnubChatInternalUtilities::IsThisEventMessage(TEXT(R"({"type":"text","text":"typing"})")));
+	TestEqual("Text should be read from published message", UPubnubChatInternalUtilities::PublishedStringToChatMessage(TEXT(R"({"type":"text","text":"Hello"})")), FString(TEXT("Hello")));
+
+	const FPubnubChatQuotedMessageData Quoted = UPubnubChatInternalUtilities::GetQuotedMessageDataFromMeta(
+		TEXT(R"({"custom":[1,2],"quotedMessage":{"channelID":"ch","timetoken":"17000000000000001","text":"Quoted","userID":"user_a"}})"));
+	TestEqual("Quoted timetoken should be read", Quoted.Timetoken, FString(TEXT("17000000000000001")));
+	TestEqual("Quoted text should be read", Quoted.Text, FString(TEXT("Quoted")));
+	TestEqual("Quoted user should be read", Quoted.UserID, FString(TEXT("user_a")));
+
+	TArray<FString> UserIDs;
+	UPubnubChatInternalUtilities::UpdateUserIDByPresenceEvent(UserIDs, TEXT(R"({"action":"join","uuid":"user_a","occupancy":1})"));
+	UPubnubChatInternalUtilities::UpdateUserIDByPresenceEvent(UserIDs, TEXT(R"({"uuid":"user_b","action":"join"})"));
+	UPubnubChatInternalUtilities::UpdateUserIDByPresenceEvent(UserIDs, TEXT(R"({"action":"timeout","uuid":"user_a"})"));
+	TestEqual("Only the user who is still present should be kept", UserIDs, TArray<FString>({TEXT("user_b")}));
+
+	TestEqual("Timestamp should be read from custom", UPubnubChatInternalUtilities::GetLastActiveTimestampFromCustom(TEXT(R"({"lastActiveTimestamp":"17000000000000001"})")), FString(TEXT("17000000000000001")));
+	TestEqual("User ID should be read from membership update", UPubnubChatInternalUtilities::GetUserIDFromMembershipUpdate(TEXT(R"({"source":"objects","data":{"channel":{"id":"ch"},"uuid":{"id":"user_a"}}})")), FString(TEXT("user_a")));
+
+	return true;
+}
+
+// ============================================================================
+// ALLOCATIONS BENCHMARK - Heap allocations per received message, FJsonObject parsing vs JSON reader
+// ============================================================================
+
+namespace
+{
+	/** Forwards everything to the wrapped allocator, counting allocations made by a single thread */
+	class FPubnubChatCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FPubnubChatCountingMalloc(FMalloc* InInnerMalloc) : InnerMalloc(InInnerMalloc), CountedThreadId(FPlatformTLS::GetCurrentThreadId()) {}
+
+		int64 GetAllocationCount() const { return AllocationCount; }
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override { CountAllocation(); return InnerMalloc->Malloc(Count, Alignment); }
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override { CountAllocation(); return InnerMalloc->TryMalloc(Count, Alignment); }
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override { CountAllocation(); return InnerMalloc->Realloc(Original, Count, Alignment); }
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override { CountAllocation(); return InnerMalloc->TryRealloc(Original, Count, Alignment); }
+		virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void InitializeStatsMetadata() override { InnerMalloc->InitializeStatsMetadata(); }
+		virtual void UpdateStats() override { InnerMalloc->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { InnerMalloc->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { InnerMalloc->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return InnerMalloc->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return InnerMalloc->GetDescriptiveName(); }
+
+	private:
+		FMalloc* InnerMalloc;
+		uint32 CountedThreadId;
+		int64 AllocationCount = 0;
+
+		void CountAllocation()
+		{
+			if (FPlatformTLS::GetCurrentThreadId() == CountedThreadId)
+			{
+				++AllocationCount;
+			}
+		}
+	};
+
+	/** Counts heap allocations made by given function on the calling thread */
+	int64 CountAllocations(TFunctionRef<void()> Function)
+	{
+		//Other threads can still be using the proxy after it's removed, so it's never destroyed
+		FMalloc* PreviousMalloc = GMalloc;
+		FPubnubChatCountingMalloc* CountingMalloc = new FPubnubChatCountingMalloc(PreviousMalloc);
+		GMalloc = CountingMalloc;
+		Function();
+		GMalloc = PreviousMalloc;
+		return CountingMalloc->GetAllocationCount();
+	}
+
+	//Received message handling as it was done with FJsonObject trees, kept as the benchmark baseline
+	bool DomIsThisEventMessage(const FString& MessageContent)
+	{
+		TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+		UPubnubJsonUtilities::StringToJsonObject(MessageContent, JsonObject);
+		FString Type;
+		if (!JsonObject->TryGetStringField(TEXT("type"), Type))
+		{ return false; }
+		for (EPubnubChatEventType EventType : TEnumRange<EPubnubChatEventType>())
+		{
+			if (Type == UPubnubChatInternalConverters::ChatEventTypeToString(EventType))
+			{ return true; }
+		}
+		return false;
+	}
+
+	FString DomPublishedStringToChatMessage(const FString& PublishedMessage)
+	{
+		TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+		UPubnubJsonUtilities::StringToJsonObject(PublishedMessage, JsonObject);
+		return JsonObject->GetStringField(TEXT("text"));
+	}
+
+	FPubnubChatQuotedMessageData DomGetQuotedMessageDataFromMeta(const FString& Meta)
+	{
+		FPubnubChatQuotedMessageData Out;
+		TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+		const TSharedPtr<FJsonObject>* QuotedObj = nullptr;
+		if (UPubnubJsonUtilities::StringToJsonObject(Meta, JsonObject) && JsonObject->TryGetObjectField(TEXT("quotedMessage"), QuotedObj))
+		{
+			(*QuotedObj)->TryGetStringField(TEXT("timetoken"), Out.Timetoken);
+			(*QuotedObj)->TryGetStringField(TEXT("text"), Out.Text);
+			(*QuotedObj)->TryGetStringField(TEXT("userID"), Out.UserID);
+		}
+		return Out;
+	}
+
+	FPubnubChatEvent DomGetEventFromPubnubMessageData(const FPubnubMessageData& MessageData)
+	{
+		FPubnubChatEvent Event;
+		TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+		UPubnubJsonUtilities::StringToJsonObject(MessageData.Message, JsonObject);
+		FString Type;
+		JsonObject->TryGetStringField(TEXT("type"), Type);
+		Event.Type = UPubnubChatInternalConverters::StringToChatEventType(Type);
+		JsonObject->RemoveField(TEXT("type"));
+		Event.Payload = UPubnubJsonUtilities::JsonObjectToString(JsonObject);
+		return Event;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatJsonReaderAllocationsBenchmark, "PubnubChat.Benchmark.JsonReader.AllocationsPerMessage", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter);
+
+bool FPubnubChatJsonReaderAllocationsBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 Iterations = 1000;
+
+	FPubnubMessageData TextMessage;
+	TextMessage.Message = TEXT(R"({"type":"text","text":"Hey, are we still meeting at the usual place later today?"})");
+	TextMessage.Meta = TEXT(R"({"quotedMessage":{"timetoken":"17000000000000001","text":"Let's meet later","userID":"user_a","channelID":"main"}})");
+	FPubnubMessageData EventMessage;
+	EventMessage.Message = TEXT(R"({"type":"typing","value":true})");
+
+	//Work done for every received message - event check, then either text and quote or event data
+	FPubnubChatQuotedMessageData Quoted;
+	FPubnubChatEvent Event;
+	FString Text;
+	const int64 DomAllocations = CountAllocations([&]()
+	{
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			if (!DomIsThisEventMessage(TextMessage.Message))
+			{
+				Text = DomPublishedStringToChatMessage(TextMessage.Message);
+				Quoted = DomGetQuotedMessageDataFromMeta(TextMessage.Meta);
+			}
+			if (DomIsThisEventMessage(EventMessage.Message))
+			{
+				Event = DomGetEventFromPubnubMessageData(EventMessage);
+			}
+		}
+	});
+
+	const int64 ReaderAllocations = CountAllocations([&]()
+	{
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			if (!UPubnubChatInternalUtilities::IsThisEventMessage(TextMessage.Message))
+			{
+				Text = UPubnubChatInternalUtilities::PublishedStringToChatMessage(TextMessage.Message);
+				Quoted = UPubnubChatInternalUtilities::GetQuotedMessageDataFromMeta(TextMessage.Meta);
+			}
+			if (UPubnubChatInternalUtilities::IsThisEventMessage(EventMessage.Message))
+			{
+				Event = UPubnubChatInternalUtilities::GetEventFromPubnubMessageData(EventMessage);
+			}
+		}
+	});
+
+	//Each iteration handles two messages
+	const double MessagesCount = Iterations * 2.0;
+	AddInfo(FString::Printf(TEXT("Allocations per received message - FJsonObject: %.2f, JSON reader: %.2f"), DomAllocations / MessagesCount, ReaderAllocations / MessagesCount));
+
+	TestEqual("Reader should read the event", Event.Type, EPubnubChatEventType::PCET_Typing);
+	TestEqual("Reader should read the quote", Quoted.UserID, FString(TEXT("user_a")));
+	TestTrue("JSON reader should allocate less than FJsonObject parsing", ReaderAllocations < DomAllocations);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,269 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSubsystem.h"
+#include "PubnubChat.h"
+#include "PubnubChatChannel.h"
+#include "PubnubChatMessage.h"
+#include "StructLibraries/PubnubChatStructLibrary.h"
+#include "StructLibraries/PubnubChatChannelStructLibrary.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Tests/PubnubChatTestsUtils.h"
+#include "Tests/PubnubChatTestHelpers.h"
+#include "Misc/AutomationTest.h"
+
+using namespace PubnubChatTests;
+using namespace PubnubChatTestHelpers;
+
+namespace
+{
+	//Server echo of a published message arrives well within this time, so after it no more deliveries are expected
+	const float LocalEchoServerEchoWaitTime = 3.0f;
+	//Bigger than the publish size limit, so publish of this text always fails
+	const int LocalEchoOversizedTextLength = 40000;
+
+	/** State shared between the test and the delegates it binds */
+	struct FLocalEchoTestState
+	{
+		TWeakObjectPtr<UPubnubChatMessage> EchoMessage = nullptr;
+		FString ProvisionalTimetoken = "";
+		EPubnubChatMessageSendState FirstDeliveredSendState = EPubnubChatMessageSendState::PCMSS_Sent;
+		TArray<EPubnubChatMessageSendState> SendStateChanges;
+		int32 NumDelivered = 0;
+	};
+
+	void BindLocalEchoDelegates(UPubnubChatChannel* Channel, const FString& TestMessageText, TSharedPtr<FLocalEchoTestState> State)
+	{
+		Channel->OnMessageReceivedNative.AddLambda([TestMessageText, State](UPubnubChatMessage* Message)
+		{
+			if(!Message || !Message->GetMessageData().Text.StartsWith(TestMessageText.Left(32)))
+			{ return; }
+
+			State->NumDelivered++;
+			if(State->EchoMessage.IsValid())
+			{ return; }
+
+			State->EchoMessage = Message;
+			State->ProvisionalTimetoken = Message->GetMessageTimetoken();
+			State->FirstDeliveredSendState = Message->GetSendState();
+			Message->OnSendStateChangedNative.AddLambda([State](EPubnubChatMessageSendState SendState)
+			{
+				State->SendStateChanges.Add(SendState);
+			});
+		});
+	}
+}
+
+// ============================================================================
+// LOCAL ECHO TESTS
+// ============================================================================
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubChatMessageLocalEchoSentAndRekeyedTest, FPubnubChatAutomationTestBase, "PubnubChat.Integration.Message.LocalEcho.2HappyPath.SentAndRekeyed", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatMessageLocalEchoSentAndRekeyedTest::RunTest(const FString& Parameters)
+{
+	if(!InitTest())
+	{
+		AddError("TestInitialization failed");
+		return false;
+	}
+
+	const FString TestPublishKey = GetTestPublishKey();
+	const FString TestSubscribeKey = GetTestSubscribeKey();
+	const FString InitUserID = SDK_PREFIX + "test_message_local_echo_sent_init";
+	const FString TestChannelID = SDK_PREFIX + "test_message_local_echo_sent";
+	const FString TestMessageText = TEXT("Local echo sent text");
+
+	FPubnubChatConfig ChatConfig;
+	FPubnubChatInitChatResult InitResult = ChatSubsystem->InitChat(TestPublishKey, TestSubscribeKey, InitUserID, ChatConfig);
+	TestFalse("InitChat should succeed", InitResult.Result.Error);
+
+	UPubnubChat* Chat = InitResult.Chat;
+	if(!Chat)
+	{
+		CleanUpCurrentChatUser(Chat);
+		CleanUp();
+		return false;
+	}
+
+	FPubnubChatChannelResult CreateResult = Chat->CreatePublicConversation(TestChannelID, FPubnubChatChannelData());
+	TestFalse("CreatePublicConversation should succeed", CreateResult.Result.Error);
+	if(!CreateResult.Channel)
+	{
+		CleanUpCurrentChatUser(Chat);
+		CleanUp();
+		return false;
+	}
+
+	TSharedPtr<FLocalEchoTestState> State = MakeShared<FLocalEchoTestState>();
+	BindLocalEchoDelegates(CreateResult.Channel, TestMessageText, State);
+	CreateResult.Channel->Connect();
+
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, CreateResult, TestMessageText]()
+	{
+		FPubnubChatSendTextParams SendTextParams;
+		SendTextParams.StoreInHistory = true;
+		SendTextParams.LocalEcho = true;
+		FPubnubChatOperationResult SendResult = CreateResult.Channel->SendText(TestMessageText, SendTextParams);
+		TestFalse("SendText should succeed", SendResult.Error);
+	}, 0.5f));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitUntilLatentCommand([State]() { return State->SendStateChanges.Contains(EPubnubChatMessageSendState::PCMSS_Sent); }, MAX_WAIT_TIME));
+
+	//Server echo of the message has to be recognized as the local echo, not delivered again
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, State]()
+	{
+		TestEqual("Message should be delivered only once", State->NumDelivered, 1);
+		TestEqual("Local echo should be delivered as Pending", State->FirstDeliveredSendState, EPubnubChatMessageSendState::PCMSS_Pending);
+		TestEqual("Send state should change only to Sent", State->SendStateChanges.Num(), 1);
+
+		UPubnubChatMessage* EchoMessage = State->EchoMessage.Get();
+		if(!EchoMessage)
+		{
+			AddError("Local echo message is invalid");
+			return;
+		}
+		TestEqual("Local echo should be Sent", EchoMessage->GetSendState(), EPubnubChatMessageSendState::PCMSS_Sent);
+		TestNotEqual("Timetoken should be moved to the server timetoken", EchoMessage->GetMessageTimetoken(), State->ProvisionalTimetoken);
+	}, LocalEchoServerEchoWaitTime));
+
+	//Message fetched by the server timetoken is the same object, rekey moved it in the live objects
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, CreateResult, State]()
+	{
+		UPubnubChatMessage* EchoMessage = State->EchoMessage.Get();
+		if(!EchoMessage)
+		{ return; }
+
+		FPubnubChatMessageResult GetResult = CreateResult.Channel->GetMessage(EchoMessage->GetMessageTimetoken());
+		TestFalse("GetMessage should succeed", GetResult.Result.Error);
+		TestTrue("GetMessage should return the local echo object", GetResult.Message == EchoMessage);
+
+		FPubnubChatMessageResult GetProvisionalResult = CreateResult.Channel->GetMessage(State->ProvisionalTimetoken);
+		TestTrue("Provisional timetoken should not resolve to the local echo", GetProvisionalResult.Message != EchoMessage);
+
+		//Only failed local echoes can be sent again or discarded
+		TestTrue("RetrySend of sent message should fail", EchoMessage->RetrySend().Error);
+		TestTrue("DiscardSend of sent message should fail", EchoMessage->DiscardSend().Error);
+	}, 0.1f));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, CreateResult, Chat, TestChannelID]()
+	{
+		if(CreateResult.Channel)
+		{
+			CreateResult.Channel->Disconnect();
+		}
+		if(Chat)
+		{
+			Chat->DeleteChannel(TestChannelID);
+		}
+		CleanUpCurrentChatUser(Chat);
+		CleanUp();
+	}, 0.1f));
+
+	return true;
+}
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubChatMessageLocalEchoFailedRetryDiscardTest, FPubnubChatAutomationTestBase, "PubnubChat.Integration.Message.LocalEcho.4Advanced.FailedRetryDiscard", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatMessageLocalEchoFailedRetryDiscardTest::RunTest(const FString& Parameters)
+{
+	if(!InitTest())
+	{
+		AddError("TestInitialization failed");
+		return false;
+	}
+
+	const FString TestPublishKey = GetTestPublishKey();
+	const FString TestSubscribeKey = GetTestSubscribeKey();
+	const FString InitUserID = SDK_PREFIX + "test_message_local_echo_failed_init";
+	const FString TestChannelID = SDK_PREFIX + "test_message_local_echo_failed";
+	const FString TestMessageText = TEXT("Local echo failed text ") + FString::ChrN(LocalEchoOversizedTextLength, TEXT('x'));
+
+	FPubnubChatConfig ChatConfig;
+	FPubnubChatInitChatResult InitResult = ChatSubsystem->InitChat(TestPublishKey, TestSubscribeKey, InitUserID, ChatConfig);
+	TestFalse("InitChat should succeed", InitResult.Result.Error);
+
+	UPubnubChat* Chat = InitResult.Chat;
+	if(!Chat)
+	{
+		CleanUpCurrentChatUser(Chat);
+		CleanUp();
+		return false;
+	}
+
+	FPubnubChatChannelResult CreateResult = Chat->CreatePublicConversation(TestChannelID, FPubnubChatChannelData());
+	TestFalse("CreatePublicConversation should succeed", CreateResult.Result.Error);
+	if(!CreateResult.Channel)
+	{
+		CleanUpCurrentChatUser(Chat);
+		CleanUp();
+		return false;
+	}
+
+	TSharedPtr<FLocalEchoTestState> State = MakeShared<FLocalEchoTestState>();
+	BindLocalEchoDelegates(CreateResult.Channel, TestMessageText, State);
+	CreateResult.Channel->Connect();
+
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, CreateResult, TestMessageText]()
+	{
+		FPubnubChatSendTextParams SendTextParams;
+		SendTextParams.LocalEcho = true;
+		FPubnubChatOperationResult SendResult = CreateResult.Channel->SendText(TestMessageText, SendTextParams);
+		TestTrue("SendText of oversized message should fail", SendResult.Error);
+	}, 0.5f));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitUntilLatentCommand([State]() { return State->SendStateChanges.Contains(EPubnubChatMessageSendState::PCMSS_Failed); }, MAX_WAIT_TIME));
+
+	//Retry goes through Pending again and fails the same way, message stays at its provisional timetoken
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, State]()
+	{
+		TestEqual("Message should be delivered only once", State->NumDelivered, 1);
+		TestEqual("Local echo should be delivered as Pending", State->FirstDeliveredSendState, EPubnubChatMessageSendState::PCMSS_Pending);
+
+		UPubnubChatMessage* EchoMessage = State->EchoMessage.Get();
+		if(!EchoMessage)
+		{
+			AddError("Local echo message is invalid");
+			return;
+		}
+		TestEqual("Local echo should be Failed", EchoMessage->GetSendState(), EPubnubChatMessageSendState::PCMSS_Failed);
+
+		State->SendStateChanges.Empty();
+		TestTrue("RetrySend of oversized message should fail", EchoMessage->RetrySend().Error);
+	}, 0.1f));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitUntilLatentCommand([State]() { return State->SendStateChanges.Contains(EPubnubChatMessageSendState::PCMSS_Failed); }, MAX_WAIT_TIME));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, State]()
+	{
+		UPubnubChatMessage* EchoMessage = State->EchoMessage.Get();
+		if(!EchoMessage)
+		{
+			AddError("Local echo message is invalid");
+			return;
+		}
+		TestEqual("Retried message should go through Pending", State->SendStateChanges.Num() > 0 ? State->SendStateChanges[0] : EPubnubChatMessageSendState::PCMSS_Sent, EPubnubChatMessageSendState::PCMSS_Pending);
+		TestEqual("Timetoken should stay provisional", EchoMessage->GetMessageTimetoken(), State->ProvisionalTimetoken);
+		TestEqual("Retried message should not be delivered again", State->NumDelivered, 1);
+
+		TestFalse("DiscardSend of failed message should succeed", EchoMessage->DiscardSend().Error);
+		TestTrue("DiscardSend of discarded message should fail", EchoMessage->DiscardSend().Error);
+		TestTrue("RetrySend of discarded message should fail", EchoMessage->RetrySend().Error);
+	}, 0.1f));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, CreateResult, Chat, TestChannelID]()
+	{
+		if(CreateResult.Channel)
+		{
+			CreateResult.Channel->Disconnect();
+		}
+		if(Chat)
+		{
+			Chat->DeleteChannel(TestChannelID);
+		}
+		CleanUpCurrentChatUser(Chat);
+		CleanUp();
+	}, 0.1f));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,261 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatMessageDraft.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "FunctionLibraries/PubnubChatMessageDraftUtilities.h"
+#include "StructLibraries/PubnubChatMessageStructLibrary.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	const int DraftFuzzSeed = 20261;
+	const int DraftFuzzNumDrafts = 50;
+	const int DraftFuzzEditsPerDraft = 200;
+	const int MarkdownFuzzNumInputs = 5000;
+
+	//No '[' and '\' - plain text of a draft is sent without escaping, so these would change how the markdown is parsed
+	const FString DraftFuzzPlainAlphabet = TEXT("abc @#]()");
+	const FString MarkdownFuzzTokens[] = {TEXT("["), TEXT("]"), TEXT("("), TEXT(")"), TEXT("\\"), TEXT("a"), TEXT("b"), TEXT(" "), TEXT("pn-user://"), TEXT("pn-channel://"), TEXT("https://")};
+
+	FString MakeRandomPlainText(FRandomStream& Random, int MaxLength)
+	{
+		FString Text;
+		const int Length = Random.RandRange(1, MaxLength);
+		for (int i = 0; i < Length; ++i)
+		{
+			Text.AppendChar(DraftFuzzPlainAlphabet[Random.RandRange(0, DraftFuzzPlainAlphabet.Len() - 1)]);
+		}
+		return Text;
+	}
+
+	FPubnubChatMentionTarget MakeRandomMentionTarget(FRandomStream& Random)
+	{
+		switch (Random.RandRange(0, 2))
+		{
+		case 0:
+			return UPubnubChatMessageDraftUtilities::CreateUserMentionTarget(FString::Printf(TEXT("fuzz_user_%d"), Random.RandRange(0, 3)));
+		case 1:
+			return UPubnubChatMessageDraftUtilities::CreateChannelMentionTarget(FString::Printf(TEXT("fuzz_channel_%d"), Random.RandRange(0, 3)));
+		default:
+			//Characters that have to be escaped in the link url
+			return UPubnubChatMessageDraftUtilities::CreateUrlMentionTarget(FString::Printf(TEXT("https://example.com/page_(%d)\\x"), Random.RandRange(0, 3)));
+		}
+	}
+
+	/** @return Empty string if elements cover the text without gaps, otherwise description of the first problem */
+	FString CheckElementsCoverText(const TArray<FPubnubChatMessageElement>& Elements, const FString& ExpectedText)
+	{
+		FString ElementsText;
+		for (const FPubnubChatMessageElement& Element : Elements)
+		{
+			if (Element.Start != ElementsText.Len())
+			{
+				return FString::Printf(TEXT("element starts at %d instead of %d"), Element.Start, ElementsText.Len());
+			}
+			if (Element.Length != Element.Text.Len())
+			{
+				return FString::Printf(TEXT("element length %d doesn't match its text '%s'"), Element.Length, *Element.Text);
+			}
+			ElementsText.Append(Element.Text);
+		}
+		if (ElementsText != ExpectedText)
+		{
+			return FString::Printf(TEXT("elements text '%s' doesn't match '%s'"), *ElementsText, *ExpectedText);
+		}
+		return "";
+	}
+
+	/** Mentions in order, with consecutive plain text elements merged, so drafts and parsed messages can be compared */
+	FString DescribeMentions(const TArray<FPubnubChatMessageElement>& Elements)
+	{
+		FString Description;
+		for (const FPubnubChatMessageElement& Element : Elements)
+		{
+			if (Element.MentionTarget.MentionTargetType != EPubnubChatMentionTargetType::PCMTT_None)
+			{
+				Description += FString::Printf(TEXT("{%d|%s|%s}"), static_cast<int>(Element.MentionTarget.MentionTargetType), *Element.MentionTarget.Target, *Element.Text);
+			}
+		}
+		return Description;
+	}
+
+	/**
+	 * Applies a random edit to the draft and to the reference text. Reference text is only changed if the draft accepted the edit.
+	 * @return Short description of the edit, used in failure messages
+	 */
+	FString ApplyRandomEdit(UPubnubChatMessageDraft* Draft, FString& ExpectedText, FRandomStream& Random)
+	{
+		const int TextLength = ExpectedText.Len();
+		const int Position = Random.RandRange(0, TextLength);
+
+		switch (Random.RandRange(0, 5))
+		{
+		case 0:
+		case 1:
+			{
+				const FString Text = MakeRandomPlainText(Random, 6);
+				if (!Draft->InsertText(Position, Text).Error)
+				{
+					ExpectedText.InsertAt(Position, Text);
+				}
+				return FString::Printf(TEXT("InsertText(%d, '%s')"), Position, *Text);
+			}
+		case 2:
+			{
+				const int Length = Random.RandRange(1, 4);
+				if (!Draft->RemoveText(Position, Length).Error)
+				{
+					ExpectedText.RemoveAt(Position, Length);
+				}
+				return FString::Printf(TEXT("RemoveText(%d, %d)"), Position, Length);
+			}
+		case 3:
+			{
+				const int Length = Random.RandRange(1, 4);
+				Draft->AddMention(Position, Length, MakeRandomMentionTarget(Random));
+				return FString::Printf(TEXT("AddMention(%d, %d)"), Position, Length);
+			}
+		case 4:
+			{
+				//Removing a mention removes its whole text
+				FPubnubChatMessageElement RemovedElement;
+				for (const FPubnubChatMessageElement& Element : Draft->GetMessageElements())
+				{
+					if (Position >= Element.Start && Position < Element.Start + Element.Length)
+					{
+						RemovedElement = Element;
+					}
+				}
+				if (!Draft->RemoveMention(Position).Error)
+				{
+					ExpectedText.RemoveAt(RemovedElement.Start, RemovedElement.Length);
+				}
+				return FString::Printf(TEXT("RemoveMention(%d)"), Position);
+			}
+		default:
+			{
+				//Edit like a text box does it - replace a random range with new text
+				const int RangeStart = Random.RandRange(0, TextLength);
+				const int RangeLength = Random.RandRange(0, TextLength - RangeStart);
+				const FString NewText = ExpectedText.Left(RangeStart) + MakeRandomPlainText(Random, 3) + ExpectedText.Mid(RangeStart + RangeLength);
+				if (!Draft->Update(NewText).Error)
+				{
+					ExpectedText = NewText;
+				}
+				return FString::Printf(TEXT("Update('%s')"), *NewText);
+			}
+		}
+	}
+}
+
+// ============================================================================
+// MESSAGE DRAFT FUZZ TESTS - Random edit sequences and markdown round trips with fixed seeds (No API Calls)
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatMessageDraftFuzzRandomEditsTest, "PubnubChat.Stress.MessageDraft.RandomEdits", EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter);
+
+bool FPubnubChatMessageDraftFuzzRandomEditsTest::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(DraftFuzzSeed);
+
+	for (int DraftIndex = 0; DraftIndex < DraftFuzzNumDrafts; ++DraftIndex)
+	{
+		UPubnubChatMessageDraft* Draft = NewObject<UPubnubChatMessageDraft>(GetTransientPackage());
+		FString ExpectedText = "";
+
+		for (int EditIndex = 0; EditIndex < DraftFuzzEditsPerDraft; ++EditIndex)
+		{
+			const FString Edit = ApplyRandomEdit(Draft, ExpectedText, Random);
+
+			const FString CurrentText = Draft->GetCurrentText();
+			const FString Problem = CurrentText != ExpectedText
+				? FString::Printf(TEXT("text '%s' doesn't match expected '%s'"), *CurrentText, *ExpectedText)
+				: CheckElementsCoverText(Draft->GetMessageElements(), ExpectedText);
+			if (!Problem.IsEmpty())
+			{
+				AddError(FString::Printf(TEXT("Seed %d, draft %d, edit %d %s: %s"), DraftFuzzSeed, DraftIndex, EditIndex, *Edit, *Problem));
+				break;
+			}
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatMessageDraftFuzzMarkdownRoundTripTest, "PubnubChat.Stress.MessageDraft.MarkdownRoundTrip", EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter);
+
+bool FPubnubChatMessageDraftFuzzMarkdownRoundTripTest::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(DraftFuzzSeed + 1);
+
+	for (int DraftIndex = 0; DraftIndex < DraftFuzzNumDrafts; ++DraftIndex)
+	{
+		UPubnubChatMessageDraft* Draft = NewObject<UPubnubChatMessageDraft>(GetTransientPackage());
+		FString ExpectedText = "";
+
+		for (int EditIndex = 0; EditIndex < DraftFuzzEditsPerDraft; ++EditIndex)
+		{
+			const FString Edit = ApplyRandomEdit(Draft, ExpectedText, Random);
+
+			//Receivers have to see the same text and mentions that were in the draft
+			const FString TextToSend = Draft->GetTextToSend();
+			const TArray<FPubnubChatMessageElement> ParsedElements = UPubnubChatMessageDraftUtilities::ParseMessageMarkdownToElements(TextToSend);
+
+			FString Problem = CheckElementsCoverText(ParsedElements, Draft->GetCurrentText());
+			if (Problem.IsEmpty() && DescribeMentions(ParsedElements) != DescribeMentions(Draft->GetMessageElements()))
+			{
+				Problem = FString::Printf(TEXT("parsed mentions %s don't match draft mentions %s"), *DescribeMentions(ParsedElements), *DescribeMentions(Draft->GetMessageElements()));
+			}
+			if (!Problem.IsEmpty())
+			{
+				AddError(FString::Printf(TEXT("Seed %d, draft %d, edit %d %s, sent '%s': %s"), DraftFuzzSeed + 1, DraftIndex, EditIndex, *Edit, *TextToSend, *Problem));
+				break;
+			}
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatMarkdownFuzzAdversarialInputTest, "PubnubChat.Stress.Markdown.AdversarialInput", EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter);
+
+bool FPubnubChatMarkdownFuzzAdversarialInputTest::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(DraftFuzzSeed + 2);
+
+	//Messages from other clients can contain any text - parsing must never lose track of positions or invent text
+	for (int InputIndex = 0; InputIndex < MarkdownFuzzNumInputs; ++InputIndex)
+	{
+		FString Input;
+		const int NumTokens = Random.RandRange(0, 24);
+		for (int i = 0; i < NumTokens; ++i)
+		{
+			Input += MarkdownFuzzTokens[Random.RandRange(0, UE_ARRAY_COUNT(MarkdownFuzzTokens) - 1)];
+		}
+
+		const TArray<FPubnubChatMessageElement> Elements = UPubnubChatMessageDraftUtilities::ParseMessageMarkdownToElements(Input);
+
+		FString DisplayText;
+		for (const FPubnubChatMessageElement& Element : Elements)
+		{
+			DisplayText.Append(Element.Text);
+		}
+
+		FString Problem = CheckElementsCoverText(Elements, DisplayText);
+		if (Problem.IsEmpty() && DisplayText.Len() > Input.Len())
+		{
+			Problem = FString::Printf(TEXT("displayed text '%s' is longer than the input"), *DisplayText);
+		}
+		if (!Problem.IsEmpty())
+		{
+			AddError(FString::Printf(TEXT("Seed %d, input %d '%s': %s"), DraftFuzzSeed + 2, InputIndex, *Input, *Problem));
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,169 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/PubnubChatOutbox.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PubnubChatSDK/Private/PubnubChatConst.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	FPubnubChatInternalOutboxEntry MakeOutboxTestEntry(const FString& EntryID, EPubnubChatOutboxOperation Operation, const FString& ChannelID)
+	{
+		FPubnubChatInternalOutboxEntry Entry;
+		Entry.EntryID = EntryID;
+		Entry.Operation = Operation;
+		Entry.ChannelID = ChannelID;
+		Entry.MessageTimetoken = TEXT("17000000000000000");
+		Entry.Text = TEXT("outbox text");
+		return Entry;
+	}
+
+	FString MakeOutboxTestRecordLine(EPubnubChatOutboxRecordType Type, const FPubnubChatInternalOutboxEntry& Entry)
+	{
+		FPubnubChatInternalOutboxRecord Record;
+		Record.Version = Pubnub_Chat_Outbox_Version;
+		Record.Type = Type;
+		Record.EntryID = Entry.EntryID;
+		if (Type == EPubnubChatOutboxRecordType::PCORT_Queued)
+		{
+			Record.Entry = Entry;
+		}
+		return UPubnubChatOutbox::SerializeRecord(Record);
+	}
+}
+
+// ============================================================================
+// OUTBOX UNIT TESTS - Journal records, replay after restart and crash recovery (No API Calls)
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatOutboxRecordRoundTripTest, "PubnubChat.Unit.Outbox.RecordRoundTrip", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatOutboxRecordRoundTripTest::RunTest(const FString& Parameters)
+{
+	FPubnubChatInternalOutboxEntry Entry = MakeOutboxTestEntry(TEXT("entry_1"), EPubnubChatOutboxOperation::PCOO_SendText, TEXT("outbox_channel"));
+	Entry.Meta = TEXT("{\"clientMessageId\":\"entry_1\"}");
+	Entry.MentionedUsers.Add(TEXT("mentioned_user"), TEXT("@mentioned"));
+	Entry.QueuedTimetoken = TEXT("17000000000000001");
+
+	const FString Line = MakeOutboxTestRecordLine(EPubnubChatOutboxRecordType::PCORT_Queued, Entry);
+	TestFalse("Record should be serialized into a single line", Line.Contains(TEXT("\n")));
+
+	int NumFinishedRecords = 0;
+	TArray<FPubnubChatInternalOutboxEntry> Entries = UPubnubChatOutbox::ReplayJournal({Line}, NumFinishedRecords);
+	if (TestEqual("Queued record should be replayed", Entries.Num(), 1))
+	{
+		TestTrue("Operation should survive round trip", Entries[0].Operation == EPubnubChatOutboxOperation::PCOO_SendText);
+		TestEqual("ChannelID should survive round trip", Entries[0].ChannelID, FString(TEXT("outbox_channel")));
+		TestEqual("Meta should survive round trip", Entries[0].Meta, Entry.Meta);
+		TestEqual("QueuedTimetoken should survive round trip", Entries[0].QueuedTimetoken, Entry.QueuedTimetoken);
+		TestEqual("Mentioned users should survive round trip", Entries[0].MentionedUsers.FindRef(TEXT("mentioned_user")), FString(TEXT("@mentioned")));
+		TestEqual("Replayed entry should not be started", Entries[0].Attempts, 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatOutboxReplayTest, "PubnubChat.Unit.Outbox.Replay", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatOutboxReplayTest::RunTest(const FString& Parameters)
+{
+	const FPubnubChatInternalOutboxEntry First = MakeOutboxTestEntry(TEXT("entry_1"), EPubnubChatOutboxOperation::PCOO_SendText, TEXT("channel_a"));
+	const FPubnubChatInternalOutboxEntry Second = MakeOutboxTestEntry(TEXT("entry_2"), EPubnubChatOutboxOperation::PCOO_AddReaction, TEXT("channel_b"));
+	const FPubnubChatInternalOutboxEntry Third = MakeOutboxTestEntry(TEXT("entry_3"), EPubnubChatOutboxOperation::PCOO_EditText, TEXT("channel_a"));
+
+	TArray<FString> Lines;
+	Lines.Add(MakeOutboxTestRecordLine(EPubnubChatOutboxRecordType::PCORT_Queued, First));
+	Lines.Add(MakeOutboxTestRecordLine(EPubnubChatOutboxRecordType::PCORT_Queued, Second));
+	Lines.Add(MakeOutboxTestRecordLine(EPubnubChatOutboxRecordType::PCORT_Queued, Third));
+	Lines.Add(MakeOutboxTestRecordLine(EPubnubChatOutboxRecordType::PCORT_Started, First));
+	Lines.Add(MakeOutboxTestRecordLine(EPubnubChatOutboxRecordType::PCORT_Finished, First));
+	Lines.Add(MakeOutboxTestRecordLine(EPubnubChatOutboxRecordType::PCORT_Started, Second));
+	Lines.Add(MakeOutboxTestRecordLine(EPubnubChatOutboxRecordType::PCORT_Started, Second));
+	//Record torn by a crash in the middle of the write
+	Lines.Add(MakeOutboxTestRecordLine(EPubnubChatOutboxRecordType::PCORT_Finished, Second).LeftChop(10));
+	Lines.Add(TEXT(""));
+
+	int NumFinishedRecords = 0;
+	TArray<FPubnubChatInternalOutboxEntry> Entries = UPubnubChatOutbox::ReplayJournal(Lines, NumFinishedRecords);
+	TestEqual("Only the finished record should be counted", NumFinishedRecords, 1);
+	if (TestEqual("Finished entry should be removed, torn record ignored", Entries.Num(), 2))
+	{
+		TestEqual("Entries should keep the queue order", Entries[0].EntryID, FString(TEXT("entry_2")));
+		TestEqual("Started records should be counted as attempts", Entries[0].Attempts, 2);
+		TestEqual("Entries should keep the queue order", Entries[1].EntryID, FString(TEXT("entry_3")));
+		TestEqual("Entry that was not started should have no attempts", Entries[1].Attempts, 0);
+	}
+
+	//Record of a different journal version is skipped
+	FPubnubChatInternalOutboxRecord FutureRecord;
+	FutureRecord.Version = Pubnub_Chat_Outbox_Version + 1;
+	FutureRecord.Type = EPubnubChatOutboxRecordType::PCORT_Queued;
+	FutureRecord.EntryID = TEXT("entry_4");
+	FutureRecord.Entry = MakeOutboxTestEntry(TEXT("entry_4"), EPubnubChatOutboxOperation::PCOO_SendText, TEXT("channel_a"));
+	Entries = UPubnubChatOutbox::ReplayJournal({UPubnubChatOutbox::SerializeRecord(FutureRecord)}, NumFinishedRecords);
+	TestEqual("Record of unknown version should be skipped", Entries.Num(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatOutboxJournalTest, "PubnubChat.Unit.Outbox.Journal", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatOutboxJournalTest::RunTest(const FString& Parameters)
+{
+	const FString JournalFilePath = UPubnubChatOutbox::GetJournalFilePath(TEXT("outbox_unit_test_user"));
+	IFileManager::Get().Delete(*JournalFilePath, false, true, true);
+
+	UPubnubChatOutbox* Outbox = NewObject<UPubnubChatOutbox>(GetTransientPackage());
+	TestTrue("Journal should be opened", Outbox->OpenJournal(JournalFilePath));
+	TestFalse("Enqueue should succeed", Outbox->Enqueue(MakeOutboxTestEntry(TEXT("entry_1"), EPubnubChatOutboxOperation::PCOO_AddReaction, TEXT("channel_a"))).Error);
+	TestFalse("Enqueue should succeed", Outbox->Enqueue(MakeOutboxTestEntry(TEXT("entry_2"), EPubnubChatOutboxOperation::PCOO_EditText, TEXT("channel_a"))).Error);
+	TestTrue("Queued reaction should be cancelled", Outbox->CancelQueuedReaction(TEXT("channel_a"), TEXT("17000000000000000"), TEXT("outbox text")));
+	TestFalse("Edit should not be cancelled as a reaction", Outbox->CancelQueuedReaction(TEXT("channel_a"), TEXT("17000000000000000"), TEXT("outbox text")));
+
+	//Only the newest last read message timetoken of a membership is kept
+	FPubnubChatInternalOutboxEntry LastRead = MakeOutboxTestEntry(TEXT("entry_3"), EPubnubChatOutboxOperation::PCOO_SetLastReadMessageTimetoken, TEXT("channel_a"));
+	LastRead.MembershipUserID = TEXT("outbox_unit_test_user");
+	Outbox->Enqueue(LastRead);
+	LastRead.EntryID = TEXT("entry_4");
+	Outbox->Enqueue(LastRead);
+	TestEqual("Older last read update should be replaced", Outbox->GetNumQueuedEntries(), 2);
+	Outbox->CloseJournal();
+
+	//Queued entries are loaded by the next session
+	UPubnubChatOutbox* ReopenedOutbox = NewObject<UPubnubChatOutbox>(GetTransientPackage());
+	TestTrue("Journal should be reopened", ReopenedOutbox->OpenJournal(JournalFilePath));
+	TestEqual("Queued entries should survive restart", ReopenedOutbox->GetNumQueuedEntries(), 2);
+	ReopenedOutbox->CloseJournal();
+
+	IFileManager::Get().Delete(*JournalFilePath, false, true, true);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatOutboxLookupTest, "PubnubChat.Unit.Outbox.Lookup", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatOutboxLookupTest::RunTest(const FString& Parameters)
+{
+	const int64 ServerTimetoken = 17000000000000000;
+	const int64 OneSecond = 10000000;
+	const int64 Margin = static_cast<int64>(Pubnub_Chat_Outbox_Lookup_Margin_Seconds) * OneSecond;
+
+	//Window is anchored on the server time, only the age of the mutation comes from the local clock
+	TestEqual("Window should cover the age of the mutation", UPubnubChatOutbox::GetLookupWindowStart(ServerTimetoken, 60 * OneSecond, 0), ServerTimetoken - 60 * OneSecond - Margin);
+	TestEqual("Local clock that went back should not move the window past the server time", UPubnubChatOutbox::GetLookupWindowStart(ServerTimetoken, -60 * OneSecond, 0), ServerTimetoken - Margin);
+	TestEqual("Window should not be longer than the max age", UPubnubChatOutbox::GetLookupWindowStart(ServerTimetoken, 1000 * OneSecond, 100), ServerTimetoken - 100 * OneSecond - Margin);
+
+	//Only a reaction that is not on the server anymore counts as removed, other errors are retried
+	TestTrue("Not found reaction should be already removed", UPubnubChatOutbox::IsReactionAlreadyRemoved(FPubnubOperationResult({404, true, TEXT("Not found")})));
+	TestFalse("Server error should be retried", UPubnubChatOutbox::IsReactionAlreadyRemoved(FPubnubOperationResult({503, true, TEXT("Service unavailable")})));
+	TestFalse("Network error should be retried", UPubnubChatOutbox::IsReactionAlreadyRemoved(FPubnubOperationResult({0, true, TEXT("Timeout")})));
+	TestFalse("Forbidden removal should be retried", UPubnubChatOutbox::IsReactionAlreadyRemoved(FPubnubOperationResult({403, true, TEXT("Forbidden")})));
+	TestFalse("Successful removal should not be an error", UPubnubChatOutbox::IsReactionAlreadyRemoved(FPubnubOperationResult({200, false, TEXT("")})));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,158 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/PubnubChatFilePersistentStore.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PubnubChatSDK/Private/PubnubChatConst.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/Package.h"
+
+// ============================================================================
+// PERSISTENT STORE UNIT TESTS - Log, index, history ranges and compaction (No API Calls)
+// ============================================================================
+
+static FPubnubChatInternalMessage MakeStoredMessage(const FString& ChannelID, int64 Timetoken, const FString& Text)
+{
+	FPubnubChatInternalMessage Message;
+	Message.ChannelID = ChannelID;
+	Message.Timetoken = Timetoken;
+	Message.MessageData.ChannelID = ChannelID;
+	Message.MessageData.Text = Text;
+	return Message;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatPersistentStoreRoundTripTest, "PubnubChat.Unit.PersistentStore.RoundTrip", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatPersistentStoreRoundTripTest::RunTest(const FString& Parameters)
+{
+	const FString StoreDirectory = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("PersistentStoreRoundTrip"));
+	IFileManager::Get().DeleteDirectory(*StoreDirectory, false, true);
+
+	UPubnubChatFilePersistentStore* Store = NewObject<UPubnubChatFilePersistentStore>(GetTransientPackage());
+	TestTrue("Store should be opened", Store->OpenStore(StoreDirectory, 1024 * 1024));
+
+	FPubnubChatInternalUser User;
+	User.UserID = TEXT("store_user");
+	User.UserData.UserName = TEXT("Stored User");
+	Store->StoreUser(User);
+
+	const FString ChannelID = TEXT("store.channel");
+	TArray<FPubnubChatInternalMessage> Messages;
+	for (int64 i = 1; i <= 10; ++i)
+	{
+		Messages.Add(MakeStoredMessage(ChannelID, 17500000000000000LL + i, FString::Printf(TEXT("Message %lld"), i)));
+	}
+	Store->StoreMessages(Messages);
+
+	// Writing the same content again doesn't grow the log
+	const int64 SizeAfterWrites = Store->GetStoreSize();
+	Store->StoreMessages(Messages);
+	TestEqual("Unchanged messages should not be appended again", Store->GetStoreSize(), SizeAfterWrites);
+
+	// Newest messages of the range are returned oldest first, like a history page
+	TArray<FPubnubChatInternalMessage> LoadedMessages;
+	Store->LoadMessages(ChannelID, 17500000000000008LL, 17500000000000002LL, 3, LoadedMessages);
+	TestEqual("Count should limit loaded messages", LoadedMessages.Num(), 3);
+	if (LoadedMessages.Num() == 3)
+	{
+		TestEqual("Oldest of the newest messages should be first", LoadedMessages[0].MessageData.Text, FString(TEXT("Message 6")));
+		TestEqual("Start of the range should be inclusive", LoadedMessages[2].MessageData.Text, FString(TEXT("Message 8")));
+	}
+
+	// Messages the server doesn't have in the reconciled range are removed
+	TSet<int64> ServerTimetokens = {17500000000000001LL, 17500000000000003LL};
+	Store->ReconcileMessages(ChannelID, 17500000000000003LL, 17500000000000001LL, ServerTimetokens);
+	Store->LoadMessages(ChannelID, 17500000000000003LL, 17500000000000001LL, 10, LoadedMessages);
+	TestEqual("Message deleted on the server should be removed", LoadedMessages.Num(), 2);
+
+	Store->RemoveMessage(FString::Printf(TEXT("%s.%lld"), *ChannelID, 17500000000000010LL));
+	Store->CloseStore();
+
+	// Data survives the session, both with the index and with the index rebuilt from the log
+	for (const bool bDeleteIndex : {false, true})
+	{
+		if (bDeleteIndex)
+		{
+			IFileManager::Get().Delete(*FPaths::Combine(StoreDirectory, TEXT("Store.idx")));
+		}
+
+		UPubnubChatFilePersistentStore* ReopenedStore = NewObject<UPubnubChatFilePersistentStore>(GetTransientPackage());
+		TestTrue("Store should be reopened", ReopenedStore->OpenStore(StoreDirectory, 1024 * 1024));
+
+		FPubnubChatInternalUser LoadedUser;
+		TestTrue("User should be loaded", ReopenedStore->LoadUser(TEXT("store_user"), LoadedUser));
+		TestEqual("User data should be restored", LoadedUser.UserData.UserName, User.UserData.UserName);
+
+		ReopenedStore->LoadMessages(ChannelID, MAX_int64, 0, 100, LoadedMessages);
+		TestEqual("Removed messages should stay removed", LoadedMessages.Num(), 8);
+		ReopenedStore->CloseStore();
+	}
+
+	// Broken record at the end of the log (e.g. crash during write) is dropped
+	TArray<uint8> BrokenRecord = {static_cast<uint8>(EPubnubChatStoreRecordType::Message), 0, 0xFF};
+	FFileHelper::SaveArrayToFile(BrokenRecord, *FPaths::Combine(StoreDirectory, TEXT("Store.log")), &IFileManager::Get(), FILEWRITE_Append);
+
+	UPubnubChatFilePersistentStore* RecoveredStore = NewObject<UPubnubChatFilePersistentStore>(GetTransientPackage());
+	TestTrue("Store with broken record should be opened", RecoveredStore->OpenStore(StoreDirectory, 1024 * 1024));
+	RecoveredStore->LoadMessages(ChannelID, MAX_int64, 0, 100, LoadedMessages);
+	TestEqual("Valid records should be kept", LoadedMessages.Num(), 8);
+	RecoveredStore->CloseStore();
+
+	IFileManager::Get().DeleteDirectory(*StoreDirectory, false, true);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatPersistentStoreCompactionTest, "PubnubChat.Unit.PersistentStore.Compaction", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatPersistentStoreCompactionTest::RunTest(const FString& Parameters)
+{
+	const FString StoreDirectory = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("PersistentStoreCompaction"));
+	IFileManager::Get().DeleteDirectory(*StoreDirectory, false, true);
+
+	const int64 MaxSize = 64 * 1024;
+	UPubnubChatFilePersistentStore* Store = NewObject<UPubnubChatFilePersistentStore>(GetTransientPackage());
+	TestTrue("Store should be opened", Store->OpenStore(StoreDirectory, MaxSize));
+
+	FPubnubChatInternalChannel Channel;
+	Channel.ChannelID = TEXT("compaction_channel");
+	Channel.ChannelData.ChannelName = TEXT("Used Channel");
+	Store->StoreChannel(Channel);
+
+	// Write well over the maximum size, touching the channel so it's always recently used
+	const FString LongText = FString::ChrN(512, TEXT('x'));
+	for (int64 i = 1; i <= 400; ++i)
+	{
+		Store->StoreMessages({MakeStoredMessage(Channel.ChannelID, 17500000000000000LL + i, LongText + LexToString(i))});
+
+		FPubnubChatInternalChannel LoadedChannel;
+		Store->LoadChannel(Channel.ChannelID, LoadedChannel);
+	}
+	Store->CompactStore();
+
+	TestTrue("Compacted store should fit the target size", Store->GetStoreSize() <= MaxSize * Pubnub_Chat_Persistent_Store_Compaction_Target_Percent / 100);
+
+	FPubnubChatInternalChannel LoadedChannel;
+	TestTrue("Recently used channel should be kept", Store->LoadChannel(Channel.ChannelID, LoadedChannel));
+	TestEqual("Kept channel data should be readable", LoadedChannel.ChannelData.ChannelName, Channel.ChannelData.ChannelName);
+
+	TArray<FPubnubChatInternalMessage> LoadedMessages;
+	Store->LoadMessages(Channel.ChannelID, MAX_int64, 0, 1, LoadedMessages);
+	TestEqual("Newest message should be kept", LoadedMessages.Num(), 1);
+	if (LoadedMessages.Num() == 1)
+	{
+		TestEqual("Kept message data should be readable", LoadedMessages[0].MessageData.Text, LongText + TEXT("400"));
+	}
+
+	Store->LoadMessages(Channel.ChannelID, 17500000000000001LL, 17500000000000001LL, 1, LoadedMessages);
+	TestEqual("Least recently used message should be dropped", LoadedMessages.Num(), 0);
+
+	Store->CloseStore();
+	IFileManager::Get().DeleteDirectory(*StoreDirectory, false, true);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
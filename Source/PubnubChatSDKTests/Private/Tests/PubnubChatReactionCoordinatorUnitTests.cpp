@@ -0,0 +1,125 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/PubnubChatReactionCoordinator.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	const FString ReactionTestMessageID = TEXT("reaction_channel.17000000000000000");
+	const FString ReactionTestChannelID = TEXT("reaction_channel");
+	const FString ReactionTestMessageTimetoken = TEXT("17000000000000000");
+	const FString ReactionTestValue = TEXT(":thumbs_up:");
+
+	//Coordinator that was not initialized has empty current user ID
+	FPubnubChatMessageAction MakeOwnReactionAction(const FString& ActionTimetoken)
+	{
+		FPubnubChatMessageAction MessageAction;
+		MessageAction.Type = EPubnubChatMessageActionType::PCMAT_Reaction;
+		MessageAction.Value = ReactionTestValue;
+		MessageAction.Timetoken = ActionTimetoken;
+		return MessageAction;
+	}
+
+	bool RegisterTestToggle(UPubnubChatReactionCoordinator* Coordinator, const TArray<FPubnubChatMessageAction>& ServerMessageActions, double FlushAtSeconds)
+	{
+		return Coordinator->RegisterToggle(ReactionTestMessageID, ReactionTestChannelID, ReactionTestMessageTimetoken, ReactionTestValue, [&ServerMessageActions]() { return ServerMessageActions; }, FlushAtSeconds);
+	}
+}
+
+// ============================================================================
+// REACTION COORDINATOR UNIT TESTS - Optimistic state, toggle coalescing and per reaction ordering (No API Calls)
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatReactionCoordinatorCoalesceTest, "PubnubChat.Unit.ReactionCoordinator.Coalesce", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatReactionCoordinatorCoalesceTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatReactionCoordinator* Coordinator = NewObject<UPubnubChatReactionCoordinator>(GetTransientPackage());
+	const TArray<FPubnubChatMessageAction> NoActions;
+
+	TestTrue("First toggle should add the reaction", RegisterTestToggle(Coordinator, NoActions, 1.0));
+	TArray<FPubnubChatMessageAction> MessageActions;
+	Coordinator->ApplyPendingReactions(ReactionTestMessageID, MessageActions);
+	TestEqual("Pending reaction should be shown right away", MessageActions.Num(), 1);
+	TestEqual("Reaction should not be sent before the debounce time", Coordinator->CollectDueReactions(0.5).Num(), 0);
+
+	TestFalse("Second toggle should remove the reaction", RegisterTestToggle(Coordinator, NoActions, 1.0));
+	MessageActions.Empty();
+	Coordinator->ApplyPendingReactions(ReactionTestMessageID, MessageActions);
+	TestEqual("Reaction toggled back should not be shown", MessageActions.Num(), 0);
+
+	TestEqual("Net no-op should not be sent", Coordinator->CollectDueReactions(2.0).Num(), 0);
+	TestEqual("Net no-op should be settled", Coordinator->GetNumPendingReactions(), 0);
+
+	//Odd number of toggles sends a single request
+	RegisterTestToggle(Coordinator, NoActions, 1.0);
+	RegisterTestToggle(Coordinator, NoActions, 1.0);
+	RegisterTestToggle(Coordinator, NoActions, 1.0);
+	TestEqual("Only the net change should be sent", Coordinator->CollectDueReactions(2.0).Num(), 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatReactionCoordinatorOrderingTest, "PubnubChat.Unit.ReactionCoordinator.Ordering", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatReactionCoordinatorOrderingTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatReactionCoordinator* Coordinator = NewObject<UPubnubChatReactionCoordinator>(GetTransientPackage());
+	const TArray<FPubnubChatMessageAction> NoActions;
+
+	RegisterTestToggle(Coordinator, NoActions, 1.0);
+	TArray<FPubnubChatReactionKey> DueReactions = Coordinator->CollectDueReactions(1.0);
+	if (!TestEqual("Add should be sent", DueReactions.Num(), 1))
+	{
+		return true;
+	}
+
+	//Toggle made while the add is running waits for it
+	TestFalse("Toggle during the request should remove the reaction", RegisterTestToggle(Coordinator, NoActions, 1.5));
+	TestEqual("Second request should not run in parallel", Coordinator->CollectDueReactions(2.0).Num(), 0);
+
+	Coordinator->CompleteReactionChange(DueReactions[0], FPubnubChatOperationResult(), MakeOwnReactionAction(TEXT("17000000000000001")));
+	TestEqual("Reaction should stay pending until the remove is sent", Coordinator->GetNumPendingReactions(), 1);
+
+	DueReactions = Coordinator->CollectDueReactions(2.0);
+	if (!TestEqual("Remove should be sent after the add finished", DueReactions.Num(), 1))
+	{
+		return true;
+	}
+	Coordinator->CompleteReactionChange(DueReactions[0], FPubnubChatOperationResult(), FPubnubChatMessageAction());
+	TestEqual("Reaction should be settled after the remove", Coordinator->GetNumPendingReactions(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatReactionCoordinatorRollbackTest, "PubnubChat.Unit.ReactionCoordinator.Rollback", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatReactionCoordinatorRollbackTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatReactionCoordinator* Coordinator = NewObject<UPubnubChatReactionCoordinator>(GetTransientPackage());
+	const TArray<FPubnubChatMessageAction> ServerActions = {MakeOwnReactionAction(TEXT("17000000000000001"))};
+
+	TestFalse("Toggle of existing reaction should remove it", RegisterTestToggle(Coordinator, ServerActions, 1.0));
+	TArray<FPubnubChatMessageAction> MessageActions = ServerActions;
+	Coordinator->ApplyPendingReactions(ReactionTestMessageID, MessageActions);
+	TestEqual("Removed reaction should be hidden right away", MessageActions.Num(), 0);
+
+	TArray<FPubnubChatReactionKey> DueReactions = Coordinator->CollectDueReactions(1.0);
+	if (!TestEqual("Remove should be sent", DueReactions.Num(), 1))
+	{
+		return true;
+	}
+	Coordinator->CompleteReactionChange(DueReactions[0], FPubnubChatOperationResult::CreateError(TEXT("Remove failed")), FPubnubChatMessageAction());
+	TestEqual("Failed reaction should be settled", Coordinator->GetNumPendingReactions(), 0);
+
+	MessageActions = ServerActions;
+	Coordinator->ApplyPendingReactions(ReactionTestMessageID, MessageActions);
+	TestEqual("Server state should be shown after the failure", MessageActions.Num(), 1);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,114 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/PubnubChatReadMarkerWriter.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	const FString ReadMarkerTestMembershipID = TEXT("read_marker_channel.read_marker_user");
+	const FString ReadMarkerTestChannelID = TEXT("read_marker_channel");
+	const FString ReadMarkerTestUserID = TEXT("read_marker_user");
+	const FString ReadMarkerTestServerTimetoken = TEXT("17000000000000000");
+
+	bool RegisterTestReadMarker(UPubnubChatReadMarkerWriter* Writer, const FString& Timetoken, double FlushAtSeconds)
+	{
+		return Writer->RegisterReadMarker(ReadMarkerTestMembershipID, ReadMarkerTestChannelID, ReadMarkerTestUserID, TEXT("group"), Timetoken, []() { return ReadMarkerTestServerTimetoken; }, FlushAtSeconds);
+	}
+}
+
+// ============================================================================
+// READ MARKER WRITER UNIT TESTS - Highest timetoken coalescing and write ordering (No API Calls)
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatReadMarkerWriterCoalesceTest, "PubnubChat.Unit.ReadMarkerWriter.Coalesce", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatReadMarkerWriterCoalesceTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatReadMarkerWriter* Writer = NewObject<UPubnubChatReadMarkerWriter>(GetTransientPackage());
+
+	TestFalse("Marker older than the server one should be skipped", RegisterTestReadMarker(Writer, TEXT("16999999999999999"), 1.0));
+	TestFalse("Marker equal to the server one should be skipped", RegisterTestReadMarker(Writer, ReadMarkerTestServerTimetoken, 1.0));
+	TestEqual("Skipped markers should not be pending", Writer->GetNumPendingReadMarkers(), 0);
+
+	TestTrue("Newer marker should be registered", RegisterTestReadMarker(Writer, TEXT("17000000000000005"), 1.0));
+	TestTrue("Higher marker should be registered", RegisterTestReadMarker(Writer, TEXT("17000000000000010"), 1.5));
+	TestFalse("Lower marker should be skipped", RegisterTestReadMarker(Writer, TEXT("17000000000000007"), 1.5));
+	TestEqual("Only the highest marker should be shown", Writer->ApplyPendingReadMarker(ReadMarkerTestMembershipID, ReadMarkerTestServerTimetoken), FString(TEXT("17000000000000010")));
+	TestEqual("Newer stored marker should win", Writer->ApplyPendingReadMarker(ReadMarkerTestMembershipID, TEXT("17000000000000020")), FString(TEXT("17000000000000020")));
+
+	TestEqual("Marker should not be written before its flush time", Writer->CollectDueReadMarkers(0.5).Num(), 0);
+	TestEqual("Later markers should not postpone the flush", Writer->CollectDueReadMarkers(1.0).Num(), 1);
+	TestEqual("Membership should be written once", Writer->GetNumPendingReadMarkers(), 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatReadMarkerWriterOrderingTest, "PubnubChat.Unit.ReadMarkerWriter.Ordering", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatReadMarkerWriterOrderingTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatReadMarkerWriter* Writer = NewObject<UPubnubChatReadMarkerWriter>(GetTransientPackage());
+
+	RegisterTestReadMarker(Writer, TEXT("17000000000000005"), 1.0);
+	TArray<FString> DueReadMarkers = Writer->CollectDueReadMarkers(1.0);
+	if (!TestEqual("Marker should be written", DueReadMarkers.Num(), 1))
+	{
+		return true;
+	}
+
+	//Marker set while the write is running waits for it
+	TestTrue("Higher marker during the write should be registered", RegisterTestReadMarker(Writer, TEXT("17000000000000010"), 1.5));
+	TestEqual("Second write should not run in parallel", Writer->CollectDueReadMarkers(2.0).Num(), 0);
+
+	Writer->CompleteReadMarkerWrite(DueReadMarkers[0], FPubnubChatOperationResult(), TEXT("17000000000000005"));
+	TestEqual("Marker should stay pending until the higher one is written", Writer->GetNumPendingReadMarkers(), 1);
+
+	DueReadMarkers = Writer->CollectDueReadMarkers(2.0);
+	if (!TestEqual("Higher marker should be written after the first write finished", DueReadMarkers.Num(), 1))
+	{
+		return true;
+	}
+	Writer->CompleteReadMarkerWrite(DueReadMarkers[0], FPubnubChatOperationResult(), TEXT("17000000000000010"));
+	TestEqual("Marker should be settled after the highest one is written", Writer->GetNumPendingReadMarkers(), 0);
+
+	//Failed write is settled, so the marker can be set again
+	RegisterTestReadMarker(Writer, TEXT("17000000000000015"), 3.0);
+	DueReadMarkers = Writer->CollectDueReadMarkers(3.0);
+	if (!TestEqual("Marker should be written", DueReadMarkers.Num(), 1))
+	{
+		return true;
+	}
+	Writer->CompleteReadMarkerWrite(DueReadMarkers[0], FPubnubChatOperationResult::CreateError(TEXT("Write failed")), TEXT("17000000000000015"));
+	TestEqual("Failed marker should be settled", Writer->GetNumPendingReadMarkers(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatReadMarkerWriterDiscardTest, "PubnubChat.Unit.ReadMarkerWriter.Discard", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatReadMarkerWriterDiscardTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatReadMarkerWriter* Writer = NewObject<UPubnubChatReadMarkerWriter>(GetTransientPackage());
+
+	bool bCallbackCalled = false;
+	FOnPubnubChatOperationResponseNative Callback;
+	Callback.BindLambda([&bCallbackCalled](const FPubnubChatOperationResult& OperationResult)
+	{
+		bCallbackCalled = !OperationResult.Error;
+	});
+	Writer->RegisterReadMarker(ReadMarkerTestMembershipID, ReadMarkerTestChannelID, ReadMarkerTestUserID, TEXT("group"), TEXT("17000000000000005"), []() { return ReadMarkerTestServerTimetoken; }, 1.0, Callback);
+
+	Writer->DiscardChannel(TEXT("other_channel"), ReadMarkerTestUserID);
+	TestEqual("Markers of other channels should be kept", Writer->GetNumPendingReadMarkers(), 1);
+
+	Writer->DiscardChannel(ReadMarkerTestChannelID, ReadMarkerTestUserID);
+	TestEqual("Markers of the left channel should be dropped", Writer->GetNumPendingReadMarkers(), 0);
+	TestTrue("Callback of dropped marker should be called without error", bCallbackCalled);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
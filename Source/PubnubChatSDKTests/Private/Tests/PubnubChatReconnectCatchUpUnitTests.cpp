@@ -0,0 +1,181 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/PubnubChatReconnectCatchUp.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PubnubChatChannel.h"
+#include "PubnubChatSDK/Private/FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/Package.h"
+
+// ============================================================================
+// RECONNECT CATCH UP UNIT TESTS - Gap tracking and deduplication (No API Calls)
+// ============================================================================
+
+namespace
+{
+	FPubnubHistoryMessageData CreateHistoryMessage(int64 Timetoken)
+	{
+		FPubnubHistoryMessageData Message;
+		Message.Timetoken = UPubnubChatInternalUtilities::Int64ToTimetoken(Timetoken);
+		return Message;
+	}
+
+	FPubnubMessageData CreateLiveMessage(int64 Timetoken)
+	{
+		FPubnubMessageData Message;
+		Message.Timetoken = UPubnubChatInternalUtilities::Int64ToTimetoken(Timetoken);
+		return Message;
+	}
+
+	const int64 CatchUpTestConnectedTimetoken = 17000000000000000;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatReconnectCatchUpDeduplicationTest, "PubnubChat.Unit.ReconnectCatchUp.Deduplication", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatReconnectCatchUpDeduplicationTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatReconnectCatchUp* CatchUp = NewObject<UPubnubChatReconnectCatchUp>(GetTransientPackage());
+	TestNotNull("CatchUp should be created", CatchUp);
+	if(!CatchUp)
+	{
+		return false;
+	}
+
+	// Catch up is not initialized with Chat, so reconnect only updates the local state
+	CatchUp->SetReplayLimits(300000, 100);
+
+	// Channel is only used as a key, it doesn't have to be initialized
+	UPubnubChatChannel* Channel = NewObject<UPubnubChatChannel>(GetTransientPackage());
+	CatchUp->RegisterChannel(Channel, CatchUpTestConnectedTimetoken);
+	TestTrue("Channel should be registered", CatchUp->IsChannelRegistered(Channel));
+
+	const int64 ConnectedAt = CatchUp->GetLastDeliveredTimetoken(Channel);
+	TestEqual("Last delivered timetoken should start at connection time", ConnectedAt, CatchUpTestConnectedTimetoken);
+
+	const int64 Delivered = ConnectedAt + 100;
+	TestTrue("Live message should be delivered", CatchUp->HandleMessageDelivered(Channel, CreateLiveMessage(Delivered)));
+	TestEqual("Last delivered timetoken should follow live messages", CatchUp->GetLastDeliveredTimetoken(Channel), Delivered);
+
+	// Connection gap starts after the last delivered message
+	CatchUp->HandleConnectionStatusChanged(EPubnubChatConnectionStatus::PCCS_ConnectionOffline);
+	CatchUp->HandleConnectionStatusChanged(EPubnubChatConnectionStatus::PCCS_ConnectionOnline);
+
+	// One message arrived live before the gap was fetched
+	const int64 LiveDuringCatchUp = Delivered + 300;
+	TestTrue("Message received during catch up should be delivered", CatchUp->HandleMessageDelivered(Channel, CreateLiveMessage(LiveDuringCatchUp)));
+
+	// Fetched gap is unordered and overlaps with already delivered messages
+	TArray<FPubnubHistoryMessageData> FetchedMessages;
+	FetchedMessages.Add(CreateHistoryMessage(Delivered + 400));
+	FetchedMessages.Add(CreateHistoryMessage(LiveDuringCatchUp));
+	FetchedMessages.Add(CreateHistoryMessage(Delivered));
+	FetchedMessages.Add(CreateHistoryMessage(Delivered + 200));
+
+	TArray<FPubnubHistoryMessageData> MessagesToReplay = CatchUp->FilterMessagesToReplay(Channel, FetchedMessages);
+	TestEqual("Only missed messages should be replayed", MessagesToReplay.Num(), 2);
+	if (MessagesToReplay.Num() == 2)
+	{
+		TestEqual("Oldest missed message should be replayed first", MessagesToReplay[0].Timetoken, UPubnubChatInternalUtilities::Int64ToTimetoken(Delivered + 200));
+		TestEqual("Newest missed message should be replayed last", MessagesToReplay[1].Timetoken, UPubnubChatInternalUtilities::Int64ToTimetoken(Delivered + 400));
+	}
+	TestEqual("Last delivered timetoken should include replayed messages", CatchUp->GetLastDeliveredTimetoken(Channel), Delivered + 400);
+
+	// Subscription resumed from an older cursor delivers replayed message again
+	TestFalse("Replayed message should not be delivered again", CatchUp->HandleMessageDelivered(Channel, CreateLiveMessage(Delivered + 200)));
+	TestEqual("Second replay of the same gap should be empty", CatchUp->FilterMessagesToReplay(Channel, FetchedMessages).Num(), 0);
+
+	CatchUp->UnregisterChannel(Channel);
+	TestFalse("Channel should not be registered after disconnect", CatchUp->IsChannelRegistered(Channel));
+	TestTrue("Messages of not registered channel should always be delivered", CatchUp->HandleMessageDelivered(Channel, CreateLiveMessage(Delivered + 200)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatReconnectCatchUpReplayWindowTest, "PubnubChat.Unit.ReconnectCatchUp.ReplayWindow", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatReconnectCatchUpReplayWindowTest::RunTest(const FString& Parameters)
+{
+	const int64 CurrentTimetoken = 17000000000000000 + 10 * 60 * 1000 * 10000LL;
+
+	// 1 minute gap fits into 5 minutes window
+	const int64 RecentDelivered = CurrentTimetoken - 60 * 1000 * 10000LL;
+	TestEqual("Short gap should be replayed from the last delivered message", UPubnubChatReconnectCatchUp::GetReplayStartTimetoken(RecentDelivered, CurrentTimetoken, 300000), RecentDelivered);
+
+	// 10 minutes gap is capped to the last 5 minutes
+	const int64 OldDelivered = CurrentTimetoken - 10 * 60 * 1000 * 10000LL;
+	TestEqual("Long gap should be capped by the replay window", UPubnubChatReconnectCatchUp::GetReplayStartTimetoken(OldDelivered, CurrentTimetoken, 300000), CurrentTimetoken - 300000 * 10000LL);
+
+	// Disabled catch up doesn't start recording gaps
+	UPubnubChatReconnectCatchUp* CatchUp = NewObject<UPubnubChatReconnectCatchUp>(GetTransientPackage());
+	UPubnubChatChannel* Channel = NewObject<UPubnubChatChannel>(GetTransientPackage());
+	if(!CatchUp || !Channel)
+	{
+		return false;
+	}
+	CatchUp->SetReplayLimits(0, 100);
+	TestFalse("Catch up should be disabled with replay window 0", CatchUp->IsEnabled());
+	CatchUp->RegisterChannel(Channel, CatchUpTestConnectedTimetoken);
+	CatchUp->HandleConnectionStatusChanged(EPubnubChatConnectionStatus::PCCS_ConnectionOffline);
+
+	TArray<FPubnubHistoryMessageData> FetchedMessages;
+	FetchedMessages.Add(CreateHistoryMessage(CatchUp->GetLastDeliveredTimetoken(Channel) + 100));
+	TestEqual("Nothing should be replayed without a recorded gap", CatchUp->FilterMessagesToReplay(Channel, FetchedMessages).Num(), 0);
+	TestTrue("Message should still be delivered live", CatchUp->HandleMessageDelivered(Channel, CreateLiveMessage(CatchUp->GetLastDeliveredTimetoken(Channel) + 100)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatReconnectCatchUpDeferLiveMessagesTest, "PubnubChat.Unit.ReconnectCatchUp.DeferLiveMessages", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatReconnectCatchUpDeferLiveMessagesTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatReconnectCatchUp* CatchUp = NewObject<UPubnubChatReconnectCatchUp>(GetTransientPackage());
+	UPubnubChatChannel* Channel = NewObject<UPubnubChatChannel>(GetTransientPackage());
+	if(!CatchUp || !Channel)
+	{
+		return false;
+	}
+	CatchUp->SetReplayLimits(300000, 100);
+	CatchUp->RegisterChannel(Channel, CatchUpTestConnectedTimetoken);
+
+	CatchUp->HandleConnectionStatusChanged(EPubnubChatConnectionStatus::PCCS_ConnectionOffline);
+	CatchUp->HandleConnectionStatusChanged(EPubnubChatConnectionStatus::PCCS_ConnectionOnline);
+
+	// Nothing was delivered before the gap, so the replay starts at the connection
+	const int64 GapEnd = CatchUpTestConnectedTimetoken + 1000;
+	const TMap<FString, int64> ReplayStarts = CatchUp->BeginReplay(GapEnd);
+	TestEqual("Replay should start at the last delivered message", ReplayStarts.FindRef(Channel->GetChannelID()), CatchUpTestConnectedTimetoken);
+
+	// Live messages arriving before the replay is broadcast wait for it
+	TestFalse("Live message should be deferred during the replay", CatchUp->HandleMessageDelivered(Channel, CreateLiveMessage(GapEnd + 100)));
+	TestFalse("Second live message should be deferred during the replay", CatchUp->HandleMessageDelivered(Channel, CreateLiveMessage(GapEnd + 200)));
+
+	// Deferred live messages are recorded, so replay doesn't deliver them
+	TArray<FPubnubHistoryMessageData> FetchedMessages;
+	FetchedMessages.Add(CreateHistoryMessage(GapEnd + 100));
+	FetchedMessages.Add(CreateHistoryMessage(CatchUpTestConnectedTimetoken + 500));
+	TArray<FPubnubHistoryMessageData> MessagesToReplay = CatchUp->FilterMessagesToReplay(Channel, FetchedMessages);
+	TestEqual("Only the missed message should be replayed", MessagesToReplay.Num(), 1);
+
+	const TArray<FPubnubMessageData> DeferredMessages = CatchUp->FinishReplay(Channel);
+	TestEqual("Both live messages should be returned after the replay", DeferredMessages.Num(), 2);
+	if (DeferredMessages.Num() == 2)
+	{
+		TestEqual("Deferred messages should keep the arrival order", DeferredMessages[0].Timetoken, UPubnubChatInternalUtilities::Int64ToTimetoken(GapEnd + 100));
+		TestEqual("Deferred messages should keep the arrival order", DeferredMessages[1].Timetoken, UPubnubChatInternalUtilities::Int64ToTimetoken(GapEnd + 200));
+	}
+
+	TestTrue("Live messages should be delivered directly after the replay", CatchUp->HandleMessageDelivered(Channel, CreateLiveMessage(GapEnd + 300)));
+	TestEqual("Finished replay should have nothing deferred", CatchUp->FinishReplay(Channel).Num(), 0);
+
+	// Channel connected without server time replays the whole window
+	UPubnubChatChannel* UnknownTimeChannel = NewObject<UPubnubChatChannel>(GetTransientPackage());
+	CatchUp->RegisterChannel(UnknownTimeChannel, 0);
+	TestEqual("Channel connected at unknown time should start with no delivered messages", CatchUp->GetLastDeliveredTimetoken(UnknownTimeChannel), 0LL);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,354 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/PubnubChatObjectsRepository.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PubnubChatSDK/Private/FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "Async/ParallelFor.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	//Sized to finish within a few seconds on a CI agent, while still interleaving every operation on every ID
+	const int StressNumWorkers = 8;
+	const int StressOperationsPerWorker = 4000;
+	const int StressNumIDs = 16;
+	const int StressSeed = 20260;
+
+	/** Collects invariant violations found on worker threads, so they are reported on the test thread */
+	struct FStressViolations
+	{
+		FThreadSafeCounter Count;
+		FCriticalSection CriticalSection;
+		FString First = "";
+
+		void Add(const FString& Description)
+		{
+			if (Count.Increment() == 1)
+			{
+				FScopeLock Lock(&CriticalSection);
+				First = Description;
+			}
+		}
+	};
+
+	/** Repository functions of one entry type. Workers play the game thread, async thread and subscription callbacks at the same time */
+	struct FStressEntityOperations
+	{
+		TFunction<void(const FString& ID, FRandomStream& Random)> Register;
+		TFunction<void(const FString& ID)> Unregister;
+		TFunction<void(const FString& ID, FRandomStream& Random, int WorkerIndex)> Update;
+		TFunction<bool(const FString& ID)> Exists;
+		TFunction<int64(const FString& ID)> GetVersion;
+		TFunction<int32(const FString& ID)> GetReferenceCount;
+	};
+
+	/**
+	 * Runs a storm of random register/unregister/update/read operations on a small set of IDs from all workers.
+	 * Each worker tracks how many objects it holds for each ID, which gives the reference counts the repository has to report.
+	 */
+	void RunRegistrationStorm(FAutomationTestBase& Test, const FString& IDPrefix, const FStressEntityOperations& Operations)
+	{
+		TArray<TArray<int32>> HeldByWorker;
+		HeldByWorker.SetNum(StressNumWorkers);
+		FStressViolations Violations;
+
+		ParallelFor(StressNumWorkers, [&](int32 WorkerIndex)
+		{
+			FRandomStream Random(StressSeed + WorkerIndex);
+			TArray<int32>& Held = HeldByWorker[WorkerIndex];
+			Held.Init(0, StressNumIDs);
+			TArray<int64> LastVersions;
+			LastVersions.Init(0, StressNumIDs);
+
+			for (int Operation = 0; Operation < StressOperationsPerWorker; ++Operation)
+			{
+				const int IDIndex = Random.RandRange(0, StressNumIDs - 1);
+				const FString ID = FString::Printf(TEXT("%s_%d"), *IDPrefix, IDIndex);
+
+				switch (Random.RandRange(0, 3))
+				{
+				case 0:
+					Operations.Register(ID, Random);
+					++Held[IDIndex];
+					break;
+				case 1:
+					//Only objects created by this worker are destroyed by it, like objects owned by one caller
+					if (Held[IDIndex] > 0)
+					{
+						Operations.Unregister(ID);
+						--Held[IDIndex];
+						LastVersions[IDIndex] = 0;
+					}
+					break;
+				case 2:
+					Operations.Update(ID, Random, WorkerIndex);
+					break;
+				default:
+					break;
+				}
+
+				//Data of a registered object is never removed under it, and its version never goes back
+				if (Held[IDIndex] > 0)
+				{
+					if (!Operations.Exists(ID))
+					{
+						Violations.Add(FString::Printf(TEXT("Data of %s held by worker %d is missing at operation %d"), *ID, WorkerIndex, Operation));
+					}
+					const int64 Version = Operations.GetVersion(ID);
+					if (Version < LastVersions[IDIndex])
+					{
+						Violations.Add(FString::Printf(TEXT("Version of %s went back from %lld to %lld at operation %d of worker %d"), *ID, LastVersions[IDIndex], Version, Operation, WorkerIndex));
+					}
+					LastVersions[IDIndex] = Version;
+				}
+			}
+		});
+
+		Test.TestEqual(FString::Printf(TEXT("%s storm should not violate any invariant. First violation: %s"), *IDPrefix, *Violations.First), Violations.Count.GetValue(), 0);
+
+		for (int IDIndex = 0; IDIndex < StressNumIDs; ++IDIndex)
+		{
+			const FString ID = FString::Printf(TEXT("%s_%d"), *IDPrefix, IDIndex);
+			int32 ExpectedReferenceCount = 0;
+			for (const TArray<int32>& Held : HeldByWorker)
+			{
+				ExpectedReferenceCount += Held[IDIndex];
+			}
+
+			Test.TestEqual(FString::Printf(TEXT("Reference count of %s should match objects held by workers"), *ID), Operations.GetReferenceCount(ID), ExpectedReferenceCount);
+			if (ExpectedReferenceCount > 0)
+			{
+				Test.TestTrue(FString::Printf(TEXT("Data of registered %s should exist"), *ID), Operations.Exists(ID));
+			}
+
+			for (int i = 0; i < ExpectedReferenceCount; ++i)
+			{
+				Operations.Unregister(ID);
+			}
+			Test.TestEqual(FString::Printf(TEXT("Reference count of %s should be 0 after all objects are destroyed"), *ID), Operations.GetReferenceCount(ID), 0);
+		}
+	}
+}
+
+// ============================================================================
+// REPOSITORY STRESS TESTS - Concurrent register/unregister/update storms with invariant checks (No API Calls)
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryStressUserStormTest, "PubnubChat.Stress.Repository.UserStorm", EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter);
+
+bool FPubnubChatRepositoryStressUserStormTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+
+	FStressEntityOperations Operations;
+	Operations.Register = [Repository](const FString& ID, FRandomStream& Random) { Repository->RegisterUser(ID); };
+	Operations.Unregister = [Repository](const FString& ID) { Repository->UnregisterUser(ID); };
+	Operations.Update = [Repository](const FString& ID, FRandomStream& Random, int WorkerIndex)
+	{
+		FPubnubChatUserData UserData;
+		UserData.UserName = FString::Printf(TEXT("worker_%d"), WorkerIndex);
+		UserData.Custom = FString::Printf(TEXT("{\"value\":%d}"), Random.RandRange(0, 1000));
+		Repository->UpdateUserData(ID, UserData);
+	};
+	Operations.Exists = [Repository](const FString& ID) { FPubnubChatUserData UserData; return Repository->TryGetUserData(ID, UserData); };
+	Operations.GetVersion = [Repository](const FString& ID) { return Repository->GetUserDataVersion(ID); };
+	Operations.GetReferenceCount = [Repository](const FString& ID) { return Repository->GetUserReferenceCount(ID); };
+
+	RunRegistrationStorm(*this, TEXT("stress_user"), Operations);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryStressChannelStormTest, "PubnubChat.Stress.Repository.ChannelStorm", EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter);
+
+bool FPubnubChatRepositoryStressChannelStormTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+
+	FStressEntityOperations Operations;
+	Operations.Register = [Repository](const FString& ID, FRandomStream& Random) { Repository->RegisterChannel(ID); };
+	Operations.Unregister = [Repository](const FString& ID) { Repository->UnregisterChannel(ID); };
+	Operations.Update = [Repository](const FString& ID, FRandomStream& Random, int WorkerIndex)
+	{
+		FPubnubChatChannelData ChannelData;
+		ChannelData.ChannelName = FString::Printf(TEXT("worker_%d"), WorkerIndex);
+		ChannelData.Description = FString::Printf(TEXT("description_%d"), Random.RandRange(0, 1000));
+		Repository->UpdateChannelData(ID, ChannelData);
+	};
+	Operations.Exists = [Repository](const FString& ID) { FPubnubChatChannelData ChannelData; return Repository->TryGetChannelData(ID, ChannelData); };
+	Operations.GetVersion = [Repository](const FString& ID) { return Repository->GetChannelDataVersion(ID); };
+	Operations.GetReferenceCount = [Repository](const FString& ID) { return Repository->GetChannelReferenceCount(ID); };
+
+	RunRegistrationStorm(*this, TEXT("stress_channel"), Operations);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryStressMessageStormTest, "PubnubChat.Stress.Repository.MessageStorm", EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter);
+
+bool FPubnubChatRepositoryStressMessageStormTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+
+	auto MakeMessageData = [](FRandomStream& Random, int WorkerIndex)
+	{
+		FPubnubChatMessageData MessageData;
+		MessageData.ChannelID = TEXT("stress_message");
+		MessageData.UserID = FString::Printf(TEXT("worker_%d"), WorkerIndex);
+		MessageData.Text = FString::Printf(TEXT("text_%d"), Random.RandRange(0, 1000));
+		return MessageData;
+	};
+
+	FStressEntityOperations Operations;
+	//History pages register new objects and update data of the whole page under one lock
+	Operations.Register = [Repository, MakeMessageData](const FString& ID, FRandomStream& Random)
+	{
+		if (Random.RandRange(0, 1) == 0)
+		{
+			Repository->RegisterMessage(ID);
+			return;
+		}
+		Repository->RegisterAndUpdateMessages({ID}, {MakeMessageData(Random, -1)}, {ID});
+	};
+	Operations.Unregister = [Repository](const FString& ID) { Repository->UnregisterMessage(ID); };
+	//Updates come from edits, reactions of other users and history pages that reuse existing objects
+	Operations.Update = [Repository, MakeMessageData](const FString& ID, FRandomStream& Random, int WorkerIndex)
+	{
+		switch (Random.RandRange(0, 3))
+		{
+		case 0:
+			Repository->UpdateMessageData(ID, MakeMessageData(Random, WorkerIndex));
+			break;
+		case 1:
+			Repository->MutateMessageData(ID, [WorkerIndex](FPubnubChatMessageData& StoredMessageData)
+			{
+				StoredMessageData.Text = FString::Printf(TEXT("edit_%d"), WorkerIndex);
+			});
+			break;
+		case 2:
+			{
+				FPubnubChatMessageAction Reaction;
+				Reaction.Type = EPubnubChatMessageActionType::PCMAT_Reaction;
+				Reaction.Value = TEXT(":stress:");
+				Reaction.Timetoken = FString::Printf(TEXT("%d"), 100000 + Random.RandRange(0, 50));
+				Reaction.UserID = FString::Printf(TEXT("worker_%d"), WorkerIndex);
+				if (Random.RandRange(0, 1) == 0)
+				{
+					Repository->AppendMessageAction(ID, Reaction);
+				}
+				else
+				{
+					Repository->RemoveMessageAction(ID, Reaction);
+				}
+				break;
+			}
+		default:
+			Repository->RegisterAndUpdateMessages({ID}, {MakeMessageData(Random, WorkerIndex)}, {});
+			break;
+		}
+	};
+	Operations.Exists = [Repository](const FString& ID) { FPubnubChatMessageData MessageData; return Repository->TryGetMessageData(ID, MessageData); };
+	Operations.GetVersion = [Repository](const FString& ID) { return Repository->GetMessageDataVersion(ID); };
+	Operations.GetReferenceCount = [Repository](const FString& ID) { return Repository->GetMessageReferenceCount(ID); };
+
+	RunRegistrationStorm(*this, TEXT("stress_message.1700000000000000"), Operations);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryStressMembershipStormTest, "PubnubChat.Stress.Repository.MembershipStorm", EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter);
+
+bool FPubnubChatRepositoryStressMembershipStormTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+
+	FStressEntityOperations Operations;
+	Operations.Register = [Repository](const FString& ID, FRandomStream& Random) { Repository->RegisterMembership(ID); };
+	Operations.Unregister = [Repository](const FString& ID) { Repository->UnregisterMembership(ID); };
+	Operations.Update = [Repository](const FString& ID, FRandomStream& Random, int WorkerIndex)
+	{
+		if (Random.RandRange(0, 1) == 0)
+		{
+			FPubnubChatMembershipData MembershipData;
+			MembershipData.Status = FString::Printf(TEXT("worker_%d"), WorkerIndex);
+			Repository->UpdateMembershipData(ID, MembershipData);
+			return;
+		}
+		const FString Timetoken = FString::Printf(TEXT("%lld"), 17000000000000000ll + Random.RandRange(0, 1000000));
+		Repository->MutateMembershipData(ID, [&Timetoken](FPubnubChatMembershipData& StoredMembershipData)
+		{
+			UPubnubChatInternalUtilities::AddLastReadMessageTimetokenToMembershipData(StoredMembershipData, Timetoken);
+		});
+	};
+	Operations.Exists = [Repository](const FString& ID) { FPubnubChatMembershipData MembershipData; return Repository->TryGetMembershipData(ID, MembershipData); };
+	Operations.GetVersion = [Repository](const FString& ID) { return Repository->GetMembershipDataVersion(ID); };
+	Operations.GetReferenceCount = [Repository](const FString& ID) { return Repository->GetMembershipReferenceCount(ID); };
+
+	RunRegistrationStorm(*this, TEXT("stress_channel.stress_user"), Operations);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryStressMutateRaceTest, "PubnubChat.Stress.Repository.MutateRace", EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter);
+
+bool FPubnubChatRepositoryStressMutateRaceTest::RunTest(const FString& Parameters)
+{
+	const FString MembershipID = TEXT("stress_channel.stress_user");
+	const FString MessageID = TEXT("stress_channel.17000000000000000");
+
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+	Repository->RegisterMembership(MembershipID);
+	Repository->RegisterMessage(MessageID);
+
+	//Read-modify-write under the repository lock - no raise of the marker and no appended action can be lost
+	TArray<int64> HighestTimetokenByWorker;
+	HighestTimetokenByWorker.Init(0, StressNumWorkers);
+	ParallelFor(StressNumWorkers, [&](int32 WorkerIndex)
+	{
+		FRandomStream Random(StressSeed + WorkerIndex);
+		for (int Operation = 0; Operation < StressOperationsPerWorker; ++Operation)
+		{
+			const int64 Timetoken = 17000000000000000ll + Random.RandRange(0, 100000000);
+			HighestTimetokenByWorker[WorkerIndex] = FMath::Max(HighestTimetokenByWorker[WorkerIndex], Timetoken);
+
+			Repository->MutateMembershipData(MembershipID, [Timetoken](FPubnubChatMembershipData& StoredMembershipData)
+			{
+				const FString StoredTimetoken = UPubnubChatInternalUtilities::GetLastReadMessageTimetokenFromMembershipData(StoredMembershipData);
+				if (UPubnubChatInternalUtilities::TimetokenToInt64(StoredTimetoken) < Timetoken)
+				{
+					UPubnubChatInternalUtilities::AddLastReadMessageTimetokenToMembershipData(StoredMembershipData, UPubnubChatInternalUtilities::Int64ToTimetoken(Timetoken));
+				}
+			});
+
+			if (Operation % 16 == 0)
+			{
+				FPubnubChatMessageAction MessageAction;
+				MessageAction.Type = EPubnubChatMessageActionType::PCMAT_Reaction;
+				MessageAction.Value = TEXT(":stress:");
+				MessageAction.Timetoken = FString::Printf(TEXT("%d"), WorkerIndex * StressOperationsPerWorker + Operation);
+				MessageAction.UserID = FString::Printf(TEXT("worker_%d"), WorkerIndex);
+				Repository->AppendMessageAction(MessageID, MessageAction);
+			}
+		}
+	});
+
+	FPubnubChatMembershipData MembershipData;
+	TestTrue("Membership should exist", Repository->TryGetMembershipData(MembershipID, MembershipData));
+	TestEqual("Marker should be the highest one written by any worker", UPubnubChatInternalUtilities::TimetokenToInt64(UPubnubChatInternalUtilities::GetLastReadMessageTimetokenFromMembershipData(MembershipData)), FMath::Max(HighestTimetokenByWorker));
+
+	FPubnubChatMessageData MessageData;
+	TestTrue("Message should exist", Repository->TryGetMessageData(MessageID, MessageData));
+	const int ExpectedNumActions = StressNumWorkers * ((StressOperationsPerWorker + 15) / 16);
+	TestEqual("No appended action should be lost", MessageData.MessageActions.Num(), ExpectedNumActions);
+
+	Repository->UnregisterMembership(MembershipID);
+	Repository->UnregisterMessage(MessageID);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -4,9 +4,11 @@
 #if WITH_DEV_AUTOMATION_TESTS
 
 #include "Engine/Engine.h"
+#include "PubnubChatSDK/Private/FunctionLibraries/PubnubChatInternalUtilities.h"
 #include "StructLibraries/PubnubChatUserStructLibrary.h"
 #include "StructLibraries/PubnubChatChannelStructLibrary.h"
 #include "StructLibraries/PubnubChatMessageStructLibrary.h"
+#include "Async/ParallelFor.h"
 #include "Misc/AutomationTest.h"
 #include "UObject/UObjectGlobals.h"
 #include "UObject/Package.h"
@@ -241,6 +243,43 @@ bool FPubnubChatRepositoryUserEdgeCasesTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryUserLastActiveTimestampTest, "PubnubChat.Unit.Repository.User.LastActiveTimestamp", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRepositoryUserLastActiveTimestampTest::RunTest(const FString& Parameters)
+{
+	const FString TestUserID = TEXT("test_user_last_active");
+	
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+	TestNotNull("Repository should be created", Repository);
+	
+	if(!Repository)
+	{
+		return false;
+	}
+	
+	int64 Timestamp = 0;
+	TestFalse("Unknown user should not have timestamp", Repository->TryGetUserLastActiveTimestamp(TestUserID, Timestamp));
+	
+	FPubnubChatUserData UserData;
+	UserData.Custom = TEXT("{\"lastActiveTimestamp\":\"17500000000000000\",\"team\":\"red\"}");
+	Repository->UpdateUserData(TestUserID, UserData);
+	TestTrue("Timestamp should be parsed from Custom", Repository->TryGetUserLastActiveTimestamp(TestUserID, Timestamp));
+	TestEqual("Parsed timestamp should match Custom", Timestamp, 17500000000000000LL);
+	
+	// Update that doesn't change Custom keeps the cached timestamp
+	UserData.UserName = TEXT("Renamed");
+	Repository->UpdateUserData(TestUserID, UserData);
+	TestTrue("Timestamp should stay cached", Repository->TryGetUserLastActiveTimestamp(TestUserID, Timestamp));
+	TestEqual("Cached timestamp should not change", Timestamp, 17500000000000000LL);
+	
+	// Custom without valid timestamp clears it
+	UserData.Custom = TEXT("{\"lastActiveTimestamp\":\"not_a_timetoken\"}");
+	Repository->UpdateUserData(TestUserID, UserData);
+	TestFalse("Invalid timestamp should not be cached", Repository->TryGetUserLastActiveTimestamp(TestUserID, Timestamp));
+	
+	return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryChannelRegistrationTest, "PubnubChat.Unit.Repository.Channel.Registration", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
 
 bool FPubnubChatRepositoryChannelRegistrationTest::RunTest(const FString& Parameters)
@@ -616,6 +655,333 @@ bool FPubnubChatRepositoryMessageActionsTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryMessageBatchRegistrationTest, "PubnubChat.Unit.Repository.Message.BatchRegistration", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRepositoryMessageBatchRegistrationTest::RunTest(const FString& Parameters)
+{
+	const FString TestChannelID = TEXT("test_channel_batch");
+	
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GEngine);
+	TestNotNull("Repository should be created", Repository);
+	
+	if(!Repository)
+	{
+		return false;
+	}
+	
+	// Build a page of 100 messages, first one is already registered (simulating reused pooled object)
+	TArray<FString> MessageIDs;
+	TArray<FPubnubChatMessageData> MessagesData;
+	TArray<FString> MessageIDsToRegister;
+	for (int32 i = 0; i < 100; ++i)
+	{
+		const FString MessageID = FString::Printf(TEXT("%s.%lld"), *TestChannelID, 17000000000000000LL + i);
+		FPubnubChatMessageData MessageData;
+		MessageData.Text = FString::Printf(TEXT("Message %d"), i);
+		MessageData.ChannelID = TestChannelID;
+		MessageIDs.Add(MessageID);
+		MessagesData.Add(MessageData);
+		if (i > 0)
+		{
+			MessageIDsToRegister.Add(MessageID);
+		}
+	}
+	Repository->RegisterMessage(MessageIDs[0]);
+	
+	Repository->RegisterAndUpdateMessages(MessageIDs, MessagesData, MessageIDsToRegister);
+	
+	// All messages should have data from the batch
+	for (int32 i = 0; i < MessageIDs.Num(); ++i)
+	{
+		FPubnubChatMessageData MessageData;
+		TestTrue(FString::Printf(TEXT("Message %d data should exist"), i), Repository->TryGetMessageData(MessageIDs[i], MessageData));
+		TestEqual(FString::Printf(TEXT("Message %d text should match"), i), MessageData.Text, MessagesData[i].Text);
+	}
+	
+	// Reused message was registered only once, so single unregistration cleans it up
+	Repository->UnregisterMessage(MessageIDs[0]);
+	FPubnubChatMessageData MessageData;
+	TestFalse("Reused message should be cleaned up after single unregistration", Repository->TryGetMessageData(MessageIDs[0], MessageData));
+	
+	// Batch registered messages should be cleaned up after their unregistration
+	Repository->UnregisterMessage(MessageIDs[1]);
+	TestFalse("Batch registered message should be cleaned up after unregistration", Repository->TryGetMessageData(MessageIDs[1], MessageData));
+	TestTrue("Other batch registered messages should still exist", Repository->TryGetMessageData(MessageIDs[2], MessageData));
+	
+	// Mismatched arrays should be ignored
+	Repository->RegisterAndUpdateMessages({TEXT("test_channel_batch.1")}, {}, {});
+	TestFalse("Mismatched batch should not add any data", Repository->TryGetMessageData(TEXT("test_channel_batch.1"), MessageData));
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryMessageActionDeltasTest, "PubnubChat.Unit.Repository.Message.ActionDeltas", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRepositoryMessageActionDeltasTest::RunTest(const FString& Parameters)
+{
+	const FString CompositeMessageID = TEXT("test_channel_deltas.12345678901234567");
+	
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+	TestNotNull("Repository should be created", Repository);
+	
+	if(!Repository)
+	{
+		return false;
+	}
+	
+	FPubnubChatMessageAction Reaction;
+	Reaction.Type = EPubnubChatMessageActionType::PCMAT_Reaction;
+	Reaction.Value = TEXT("smile");
+	Reaction.Timetoken = TEXT("12345678901234568");
+	Reaction.UserID = TEXT("user_1");
+	
+	// Deltas are not applied to messages that are not in the repository
+	TestFalse("Action should not be added to unknown message", Repository->AppendMessageAction(CompositeMessageID, Reaction));
+	TestFalse("Unknown message should not be mutated", Repository->MutateMessageData(CompositeMessageID, [](FPubnubChatMessageData& StoredMessageData) {}));
+	
+	Repository->RegisterMessage(CompositeMessageID);
+	TestTrue("Action should be added", Repository->AppendMessageAction(CompositeMessageID, Reaction));
+	TestFalse("The same action should not be added twice", Repository->AppendMessageAction(CompositeMessageID, Reaction));
+	
+	FPubnubChatMessageAction OtherUserReaction = Reaction;
+	OtherUserReaction.UserID = TEXT("user_2");
+	TestTrue("The same reaction of other user should be added", Repository->AppendMessageAction(CompositeMessageID, OtherUserReaction));
+	
+	FPubnubChatMessageData MessageData;
+	Repository->TryGetMessageData(CompositeMessageID, MessageData);
+	TestEqual("Message should have both actions", MessageData.MessageActions.Num(), 2);
+	
+	TestTrue("Action should be removed", Repository->RemoveMessageAction(CompositeMessageID, Reaction));
+	TestFalse("Removed action should not be removed again", Repository->RemoveMessageAction(CompositeMessageID, Reaction));
+	Repository->TryGetMessageData(CompositeMessageID, MessageData);
+	TestEqual("Only the other action should be left", MessageData.MessageActions.Num(), 1);
+	if (MessageData.MessageActions.Num() == 1)
+	{
+		TestEqual("Action of the other user should be left", MessageData.MessageActions[0].UserID, OtherUserReaction.UserID);
+	}
+	
+	// Mutation modifies stored data in place
+	TestTrue("Message should be mutated", Repository->MutateMessageData(CompositeMessageID, [](FPubnubChatMessageData& StoredMessageData)
+	{
+		StoredMessageData.Text = TEXT("mutated");
+	}));
+	Repository->TryGetMessageData(CompositeMessageID, MessageData);
+	TestEqual("Text should be mutated", MessageData.Text, FString(TEXT("mutated")));
+	TestEqual("Actions should be kept by mutation", MessageData.MessageActions.Num(), 1);
+	
+	Repository->UnregisterMessage(CompositeMessageID);
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryMessageConcurrentActionsTest, "PubnubChat.Unit.Repository.Message.ConcurrentActions", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRepositoryMessageConcurrentActionsTest::RunTest(const FString& Parameters)
+{
+	const FString CompositeMessageID = TEXT("test_channel_concurrent.12345678901234567");
+	const int NumRemoteUsers = 4;
+	const int NumReactionsPerUser = 250;
+	
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+	TestNotNull("Repository should be created", Repository);
+	
+	if(!Repository)
+	{
+		return false;
+	}
+	
+	Repository->RegisterMessage(CompositeMessageID);
+	
+	auto MakeReaction = [](const FString& UserID, int Index)
+	{
+		FPubnubChatMessageAction Reaction;
+		Reaction.Type = EPubnubChatMessageActionType::PCMAT_Reaction;
+		Reaction.Value = FString::Printf(TEXT("reaction_%d"), Index % 8);
+		Reaction.Timetoken = FString::Printf(TEXT("%d"), 100000 + Index);
+		Reaction.UserID = UserID;
+		return Reaction;
+	};
+	
+	// Remote reactions arrive from the updates stream while the local user toggles reactions and the message is edited
+	ParallelFor(NumRemoteUsers + 2, [&](int32 WorkerIndex)
+	{
+		for (int i = 0; i < NumReactionsPerUser; ++i)
+		{
+			if (WorkerIndex < NumRemoteUsers)
+			{
+				Repository->AppendMessageAction(CompositeMessageID, MakeReaction(FString::Printf(TEXT("remote_%d"), WorkerIndex), i));
+			}
+			else if (WorkerIndex == NumRemoteUsers)
+			{
+				// Local user adds a reaction and toggles every second one off again
+				const FPubnubChatMessageAction LocalReaction = MakeReaction(TEXT("local"), i);
+				Repository->AppendMessageAction(CompositeMessageID, LocalReaction);
+				if (i % 2 == 1)
+				{
+					Repository->RemoveMessageAction(CompositeMessageID, LocalReaction);
+				}
+			}
+			else
+			{
+				Repository->MutateMessageData(CompositeMessageID, [i](FPubnubChatMessageData& StoredMessageData)
+				{
+					StoredMessageData.Text = FString::Printf(TEXT("edit_%d"), i);
+				});
+			}
+		}
+	});
+	
+	FPubnubChatMessageData MessageData;
+	TestTrue("Message should exist", Repository->TryGetMessageData(CompositeMessageID, MessageData));
+	
+	TMap<FString, int> ReactionsPerUser;
+	for (const FPubnubChatMessageAction& MessageAction : MessageData.MessageActions)
+	{
+		ReactionsPerUser.FindOrAdd(MessageAction.UserID)++;
+	}
+	for (int WorkerIndex = 0; WorkerIndex < NumRemoteUsers; ++WorkerIndex)
+	{
+		TestEqual(FString::Printf(TEXT("No reaction of remote user %d should be lost"), WorkerIndex), ReactionsPerUser.FindRef(FString::Printf(TEXT("remote_%d"), WorkerIndex)), NumReactionsPerUser);
+	}
+	TestEqual("Only local reactions that were not toggled off should be left", ReactionsPerUser.FindRef(TEXT("local")), NumReactionsPerUser / 2);
+	TestEqual("Last edit should be stored", MessageData.Text, FString::Printf(TEXT("edit_%d"), NumReactionsPerUser - 1));
+	
+	Repository->UnregisterMessage(CompositeMessageID);
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryStaleServerUpdateTest, "PubnubChat.Unit.Repository.Versioning.StaleServerUpdate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRepositoryStaleServerUpdateTest::RunTest(const FString& Parameters)
+{
+	const FString TestUserID = TEXT("test_user_stale");
+	const FString TestMembershipID = TEXT("test_user_stale.test_channel_stale");
+	
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+	TestNotNull("Repository should be created", Repository);
+	
+	if(!Repository)
+	{
+		return false;
+	}
+	
+	FPubnubChatUserData NewerUserData;
+	NewerUserData.UserName = TEXT("From stream event");
+	FPubnubChatUserData OlderUserData;
+	OlderUserData.UserName = TEXT("From slow GetUser");
+	
+	// Update event arrives before the response of a request that was sent earlier
+	TestTrue("Newer data should be stored", Repository->UpdateUserData(TestUserID, NewerUserData, TEXT("2026-01-01T10:00:05.000000Z")));
+	TestFalse("Older server data should be rejected", Repository->UpdateUserData(TestUserID, OlderUserData, TEXT("2026-01-01T10:00:01.000000Z")));
+	
+	FPubnubChatUserData UserData;
+	Repository->TryGetUserData(TestUserID, UserData);
+	TestEqual("Newer data should be kept", UserData.UserName, NewerUserData.UserName);
+	
+	// Same timestamp and local data without a timestamp are accepted
+	TestTrue("Data with the same timestamp should be stored", Repository->UpdateUserData(TestUserID, NewerUserData, TEXT("2026-01-01T10:00:05.000000Z")));
+	TestTrue("Local data should be stored", Repository->UpdateUserData(TestUserID, OlderUserData));
+	TestFalse("Stored timestamp should be kept by local data", Repository->UpdateUserData(TestUserID, NewerUserData, TEXT("2026-01-01T10:00:01.000000Z")));
+	
+	// Membership mutations from older events are not applied
+	FPubnubChatMembershipData MembershipData;
+	MembershipData.Status = TEXT("active");
+	TestTrue("Membership should be stored", Repository->UpdateMembershipData(TestMembershipID, MembershipData, TEXT("2026-01-01T10:00:05.000000Z")));
+	TestFalse("Older mutation should not be applied", Repository->MutateMembershipData(TestMembershipID, [](FPubnubChatMembershipData& StoredMembershipData)
+	{
+		StoredMembershipData.Status = TEXT("pending");
+	}, TEXT("2026-01-01T10:00:01.000000Z")));
+	Repository->TryGetMembershipData(TestMembershipID, MembershipData);
+	TestEqual("Membership status should be kept", MembershipData.Status, FString(TEXT("active")));
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryMixedPrecisionServerUpdateTest, "PubnubChat.Unit.Repository.Versioning.MixedPrecisionServerUpdate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRepositoryMixedPrecisionServerUpdateTest::RunTest(const FString& Parameters)
+{
+	const FString TestUserID = TEXT("test_user_precision");
+	
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+	TestNotNull("Repository should be created", Repository);
+	
+	if(!Repository)
+	{
+		return false;
+	}
+	
+	FPubnubChatUserData UserData;
+	
+	// "05Z" is lexically greater than "05.5Z", but it's half a second older
+	TestTrue("Timestamp with fraction should be stored", Repository->UpdateUserData(TestUserID, UserData, TEXT("2026-01-01T10:00:05.5Z")));
+	TestFalse("Older timestamp without fraction should be rejected", Repository->UpdateUserData(TestUserID, UserData, TEXT("2026-01-01T10:00:05Z")));
+	
+	// Same time written with different precision is not older
+	TestTrue("Same time with more digits should be stored", Repository->UpdateUserData(TestUserID, UserData, TEXT("2026-01-01T10:00:05.500000Z")));
+	
+	// Microseconds beyond the millisecond precision of FDateTime::ParseIso8601 still order the timestamps
+	TestTrue("Newer timestamp by microseconds should be stored", Repository->UpdateUserData(TestUserID, UserData, TEXT("2026-01-01T10:00:05.500001Z")));
+	TestFalse("Older timestamp with fewer digits should be rejected", Repository->UpdateUserData(TestUserID, UserData, TEXT("2026-01-01T10:00:05.5Z")));
+	
+	// Newer timestamp without fraction is accepted over a stored one with fraction
+	TestTrue("Newer timestamp without fraction should be stored", Repository->UpdateUserData(TestUserID, UserData, TEXT("2026-01-01T10:00:06Z")));
+	TestFalse("Older timestamp with fraction should be rejected", Repository->UpdateUserData(TestUserID, UserData, TEXT("2026-01-01T10:00:05.999999Z")));
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryDataVersionTest, "PubnubChat.Unit.Repository.Versioning.DataVersion", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRepositoryDataVersionTest::RunTest(const FString& Parameters)
+{
+	const FString TestChannelID = TEXT("test_channel_version");
+	const FString CompositeMessageID = TEXT("test_channel_version.12345678901234567");
+	
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+	TestNotNull("Repository should be created", Repository);
+	
+	if(!Repository)
+	{
+		return false;
+	}
+	
+	TestEqual("Unknown channel should have no version", Repository->GetChannelDataVersion(TestChannelID), (int64)0);
+	
+	Repository->UpdateChannelData(TestChannelID, FPubnubChatChannelData(), TEXT("2026-01-01T10:00:05.000000Z"));
+	const int64 FirstVersion = Repository->GetChannelDataVersion(TestChannelID);
+	TestTrue("Written channel should have a version", FirstVersion > 0);
+	
+	Repository->UpdateChannelData(TestChannelID, FPubnubChatChannelData(), TEXT("2026-01-01T10:00:01.000000Z"));
+	TestEqual("Rejected write should not change the version", Repository->GetChannelDataVersion(TestChannelID), FirstVersion);
+	
+	Repository->UpdateChannelData(TestChannelID, FPubnubChatChannelData(), TEXT("2026-01-01T10:00:06.000000Z"));
+	TestTrue("Accepted write should increase the version", Repository->GetChannelDataVersion(TestChannelID) > FirstVersion);
+	
+	// Message versions grow with every delta
+	Repository->RegisterMessage(CompositeMessageID);
+	FPubnubChatMessageAction Reaction;
+	Reaction.Value = TEXT("smile");
+	Reaction.Timetoken = TEXT("12345678901234568");
+	Reaction.UserID = TEXT("user_1");
+	
+	const int64 RegisteredVersion = Repository->GetMessageDataVersion(CompositeMessageID);
+	Repository->AppendMessageAction(CompositeMessageID, Reaction);
+	const int64 AppendedVersion = Repository->GetMessageDataVersion(CompositeMessageID);
+	TestTrue("Appended action should increase the version", AppendedVersion > RegisteredVersion);
+	
+	Repository->AppendMessageAction(CompositeMessageID, Reaction);
+	TestEqual("Duplicated action should not change the version", Repository->GetMessageDataVersion(CompositeMessageID), AppendedVersion);
+	
+	Repository->RemoveMessageAction(CompositeMessageID, Reaction);
+	TestTrue("Removed action should increase the version", Repository->GetMessageDataVersion(CompositeMessageID) > AppendedVersion);
+	
+	Repository->UnregisterMessage(CompositeMessageID);
+	
+	return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryClearAllTest, "PubnubChat.Unit.Repository.ClearAll", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
 
 bool FPubnubChatRepositoryClearAllTest::RunTest(const FString& Parameters)
@@ -671,4 +1037,175 @@ bool FPubnubChatRepositoryClearAllTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryMemoryStatsTest, "PubnubChat.Unit.Repository.MemoryStats", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRepositoryMemoryStatsTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+	
+	FPubnubChatMemoryStats EmptyStats;
+	Repository->GetMemoryStats(EmptyStats);
+	TestEqual("Empty repository should have no user entries", EmptyStats.Users.EntriesCount, 0);
+	TestEqual("Histogram should have all buckets", EmptyStats.Users.ReferenceCountHistogram.Num(), 6);
+	
+	// One user held by a single object, one by three objects and one cached without any object
+	Repository->RegisterUser(TEXT("stats_user_1"));
+	for (int i = 0; i < 3; ++i)
+	{
+		Repository->RegisterUser(TEXT("stats_user_3"));
+	}
+	FPubnubChatUserData UserData;
+	UserData.UserName = TEXT("Cached user with a name long enough to be allocated");
+	Repository->UpdateUserData(TEXT("stats_user_0"), UserData);
+	
+	Repository->RegisterMessage(TEXT("stats_channel.17000000000000000"));
+	
+	FPubnubChatMemoryStats MemoryStats;
+	Repository->GetMemoryStats(MemoryStats);
+	TestEqual("All user entries should be counted", MemoryStats.Users.EntriesCount, 3);
+	TestEqual("Cached user should be in bucket 0", MemoryStats.Users.ReferenceCountHistogram[0], 1);
+	TestEqual("User with one object should be in bucket 1", MemoryStats.Users.ReferenceCountHistogram[1], 1);
+	TestEqual("User with three objects should be in bucket 2-3", MemoryStats.Users.ReferenceCountHistogram[2], 1);
+	TestTrue("User entries should take memory", MemoryStats.Users.ApproximateBytes > 0);
+	TestEqual("Message entry should be counted", MemoryStats.Messages.EntriesCount, 1);
+	TestEqual("There should be no channel entries", MemoryStats.Channels.EntriesCount, 0);
+	TestEqual("Search index should not take memory when disabled", MemoryStats.SearchIndexBytes, 0ll);
+	TestEqual("Total should be the sum of all data types",
+		MemoryStats.RepositoryBytes, MemoryStats.Users.ApproximateBytes + MemoryStats.Channels.ApproximateBytes + MemoryStats.Messages.ApproximateBytes + MemoryStats.Memberships.ApproximateBytes + MemoryStats.InternedIDsBytes);
+	TestTrue("Interned IDs should take memory", MemoryStats.InternedIDsBytes > 0);
+	
+	// Released entries should not be accounted anymore
+	Repository->UnregisterUser(TEXT("stats_user_1"));
+	Repository->GetMemoryStats(MemoryStats);
+	TestEqual("Released user entry should be removed", MemoryStats.Users.EntriesCount, 2);
+	TestEqual("Bucket 1 should be empty after release", MemoryStats.Users.ReferenceCountHistogram[1], 0);
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryIDTableTest, "PubnubChat.Unit.Repository.IDTable", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRepositoryIDTableTest::RunTest(const FString& Parameters)
+{
+	FPubnubChatIDTable IDTable;
+	
+	const FPubnubChatIDHandle Handle = IDTable.Intern(TEXT("id_table_user"));
+	TestNotEqual("Interned ID should have a valid handle", Handle, INDEX_NONE);
+	TestEqual("Interning the same ID again should return the same handle", IDTable.Intern(TEXT("id_table_user")), Handle);
+	TestEqual("Find should return the interned handle", IDTable.Find(TEXT("id_table_user")), Handle);
+	TestEqual("Resolve should return the interned ID", IDTable.Resolve(Handle), FString(TEXT("id_table_user")));
+	TestEqual("Find of unknown ID should not intern it", IDTable.Find(TEXT("id_table_unknown")), INDEX_NONE);
+	TestEqual("Empty ID should not be interned", IDTable.Intern(TEXT("")), INDEX_NONE);
+	TestEqual("Only one ID should be interned", IDTable.Num(), 1);
+	
+	// PubNub IDs are case-sensitive, these are two different users
+	const FPubnubChatIDHandle UpperCaseHandle = IDTable.Intern(TEXT("ID_TABLE_USER"));
+	TestNotEqual("IDs differing only in case should get different handles", UpperCaseHandle, Handle);
+	TestEqual("Handles should be stable after more IDs are interned", IDTable.Find(TEXT("id_table_user")), Handle);
+	
+	// ID was interned twice, so it's kept until both references are released
+	IDTable.Release(Handle);
+	TestEqual("ID with a reference left should stay interned", IDTable.Find(TEXT("id_table_user")), Handle);
+	IDTable.Release(Handle);
+	TestEqual("Released ID should not be found", IDTable.Find(TEXT("id_table_user")), INDEX_NONE);
+	TestEqual("Only the upper case ID should be left", IDTable.Num(), 1);
+	
+	const FPubnubChatIDHandle ReusedHandle = IDTable.Intern(TEXT("id_table_channel"));
+	TestEqual("Handle of released ID should be reused", ReusedHandle, Handle);
+	TestEqual("Reused handle should resolve to the new ID", IDTable.Resolve(ReusedHandle), FString(TEXT("id_table_channel")));
+	TestEqual("Upper case ID should keep its handle", IDTable.Find(TEXT("ID_TABLE_USER")), UpperCaseHandle);
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryReleasesInternedIDsTest, "PubnubChat.Unit.Repository.ReleasesInternedIDs", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRepositoryReleasesInternedIDsTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+	
+	Repository->RegisterUser(TEXT("released_user"));
+	Repository->UpdateUserData(TEXT("cached_user"), FPubnubChatUserData());
+	Repository->RegisterChannel(TEXT("released_channel"));
+	Repository->RegisterMessage(TEXT("released_channel.17000000000000000"));
+	Repository->RegisterMembership(TEXT("released_channel.released_user"));
+	TestEqual("Every distinct ID should be interned once", Repository->GetInternedIDCount(), 4);
+	
+	// Message entry still references the channel ID
+	Repository->UnregisterChannel(TEXT("released_channel"));
+	TestEqual("Channel ID should stay while its message is held", Repository->GetInternedIDCount(), 4);
+	Repository->UnregisterMessage(TEXT("released_channel.17000000000000000"));
+	TestEqual("Channel ID should be released with its last entry", Repository->GetInternedIDCount(), 3);
+	
+	Repository->UnregisterUser(TEXT("released_user"));
+	Repository->RemoveUserData(TEXT("cached_user"));
+	TestEqual("User IDs should be released with their entries", Repository->GetInternedIDCount(), 1);
+	
+	FPubnubChatUserData UserData;
+	TestFalse("Released user should not be found", Repository->TryGetUserData(TEXT("released_user"), UserData));
+	
+	Repository->RegisterUser(TEXT("reinterned_user"));
+	Repository->ClearAll();
+	TestEqual("ClearAll should release all IDs", Repository->GetInternedIDCount(), 0);
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryCaseSensitiveIDsTest, "PubnubChat.Unit.Repository.CaseSensitiveIDs", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRepositoryCaseSensitiveIDsTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+	
+	FPubnubChatUserData LowerCaseData;
+	LowerCaseData.UserName = TEXT("Lower");
+	FPubnubChatUserData UpperCaseData;
+	UpperCaseData.UserName = TEXT("Upper");
+	Repository->UpdateUserData(TEXT("case_user"), LowerCaseData);
+	Repository->UpdateUserData(TEXT("CASE_USER"), UpperCaseData);
+	
+	FPubnubChatUserData UserData;
+	TestTrue("Lower case user should exist", Repository->TryGetUserData(TEXT("case_user"), UserData));
+	TestEqual("Lower case user should keep its own data", UserData.UserName, LowerCaseData.UserName);
+	TestTrue("Upper case user should exist", Repository->TryGetUserData(TEXT("CASE_USER"), UserData));
+	TestEqual("Upper case user should keep its own data", UserData.UserName, UpperCaseData.UserName);
+	
+	// Message keys are split into channel and numeric timetoken
+	FPubnubChatMessageData MessageData;
+	MessageData.Text = TEXT("Keyed by timetoken");
+	Repository->UpdateMessageData(TEXT("case.channel.17000000000000001"), MessageData);
+	FPubnubChatMessageData StoredMessageData;
+	TestTrue("Message with dots in channel should be found", Repository->TryGetMessageData(TEXT("case.channel.17000000000000001"), StoredMessageData));
+	TestFalse("Message in channel differing only in case should not be found", Repository->TryGetMessageData(TEXT("CASE.channel.17000000000000001"), StoredMessageData));
+	TestFalse("Message with non numeric timetoken should not be found", Repository->TryGetMessageData(TEXT("case.channel.abc"), StoredMessageData));
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRepositoryLastReadMessageTimetokenTest, "PubnubChat.Unit.Repository.Membership.LastReadMessageTimetoken", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRepositoryLastReadMessageTimetokenTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+	const FString MembershipID = TEXT("read_channel.read_user");
+	
+	int64 Timetoken = 0;
+	TestFalse("Unknown membership should have no last read timetoken", Repository->TryGetLastReadMessageTimetoken(MembershipID, Timetoken));
+	
+	FPubnubChatMembershipData MembershipData;
+	UPubnubChatInternalUtilities::AddLastReadMessageTimetokenToMembershipData(MembershipData, TEXT("17000000000000005"));
+	Repository->UpdateMembershipData(MembershipID, MembershipData);
+	TestTrue("Last read timetoken should be cached", Repository->TryGetLastReadMessageTimetoken(MembershipID, Timetoken));
+	TestEqual("Cached timetoken should match membership data", Timetoken, 17000000000000005ll);
+	
+	Repository->MutateMembershipData(MembershipID, [](FPubnubChatMembershipData& StoredMembershipData)
+	{
+		UPubnubChatInternalUtilities::AddLastReadMessageTimetokenToMembershipData(StoredMembershipData, TEXT("17000000000000009"));
+	});
+	TestTrue("Last read timetoken should still be cached", Repository->TryGetLastReadMessageTimetoken(MembershipID, Timetoken));
+	TestEqual("Cached timetoken should follow the mutation", Timetoken, 17000000000000009ll);
+	
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,92 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/PubnubChatRequestWorkers.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/ThreadSafeCounter.h"
+
+// ============================================================================
+// REQUEST WORKERS UNIT TESTS - Bounded concurrency of bulk operation requests (No API Calls)
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRequestWorkersRunsAllTasksTest, "PubnubChat.Unit.RequestWorkers.RunsAllTasks", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRequestWorkersRunsAllTasksTest::RunTest(const FString& Parameters)
+{
+	FPubnubChatRequestWorkers Workers(4);
+	const uint32 CallingThreadID = FPlatformTLS::GetCurrentThreadId();
+
+	TArray<int32> TaskRuns;
+	TaskRuns.SetNumZeroed(50);
+	FThreadSafeCounter TasksOnCallingThread;
+	Workers.RunTasks(TaskRuns.Num(), [&TaskRuns, &TasksOnCallingThread, CallingThreadID](int32 TaskIndex)
+	{
+		++TaskRuns[TaskIndex];
+		if (FPlatformTLS::GetCurrentThreadId() == CallingThreadID)
+		{
+			TasksOnCallingThread.Increment();
+		}
+	});
+
+	for (int32 i = 0; i < TaskRuns.Num(); ++i)
+	{
+		TestEqual(FString::Printf(TEXT("Task %d should run exactly once"), i), TaskRuns[i], 1);
+	}
+	TestEqual("Calling thread should only wait", TasksOnCallingThread.GetValue(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRequestWorkersBoundedConcurrencyTest, "PubnubChat.Unit.RequestWorkers.BoundedConcurrency", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRequestWorkersBoundedConcurrencyTest::RunTest(const FString& Parameters)
+{
+	FPubnubChatRequestWorkers Workers(3);
+
+	FCriticalSection RunningCriticalSection;
+	int32 Running = 0;
+	int32 MaxRunning = 0;
+	Workers.RunTasks(12, [&RunningCriticalSection, &Running, &MaxRunning](int32 TaskIndex)
+	{
+		{
+			FScopeLock Lock(&RunningCriticalSection);
+			MaxRunning = FMath::Max(MaxRunning, ++Running);
+		}
+		FPlatformProcess::Sleep(0.01f);
+		FScopeLock Lock(&RunningCriticalSection);
+		--Running;
+	});
+
+	TestTrue("No more tasks than workers should run at once", MaxRunning <= 3);
+	TestTrue("Tasks should run concurrently", MaxRunning > 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRequestWorkersNestedAndStoppedTest, "PubnubChat.Unit.RequestWorkers.NestedAndStopped", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRequestWorkersNestedAndStoppedTest::RunTest(const FString& Parameters)
+{
+	FPubnubChatRequestWorkers Workers(2);
+
+	//Nested calls from workers run inline instead of waiting for busy workers
+	FThreadSafeCounter NestedRuns;
+	Workers.RunTasks(2, [&Workers, &NestedRuns](int32 TaskIndex)
+	{
+		Workers.RunTasks(3, [&NestedRuns](int32 NestedIndex) { NestedRuns.Increment(); });
+	});
+	TestEqual("All nested tasks should run", NestedRuns.GetValue(), 6);
+
+	Workers.Stop();
+	TestEqual("Stopped workers should have no threads", Workers.GetNumWorkers(), 0);
+
+	int32 RunsAfterStop = 0;
+	Workers.RunTasks(5, [&RunsAfterStop](int32 TaskIndex) { ++RunsAfterStop; });
+	TestEqual("Tasks should run on the calling thread after stop", RunsAfterStop, 5);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
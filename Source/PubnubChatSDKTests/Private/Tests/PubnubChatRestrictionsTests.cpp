@@ -711,6 +711,183 @@ bool FPubnubChatSetRestrictionsBanAndMuteTest::RunTest(const FString& Parameters
 	return true;
 }
 
+// ============================================================================
+// SETRESTRICTIONSBULK TESTS (UPubnubChat::SetRestrictionsBulk)
+// ============================================================================
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubChatSetRestrictionsBulkNotInitializedTest, FPubnubChatAutomationTestBase, "PubnubChat.Integration.Chat.Moderation.SetRestrictionsBulk.1Validation.NotInitialized", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatSetRestrictionsBulkNotInitializedTest::RunTest(const FString& Parameters)
+{
+	if(!InitTest())
+	{
+		AddError("TestInitialization failed");
+		return false;
+	}
+
+	// Create Chat without initializing
+	UPubnubChat* Chat = NewObject<UPubnubChat>();
+	if(Chat)
+	{
+		FPubnubChatRestriction Restriction;
+		Restriction.UserID = SDK_PREFIX + "test_user";
+		Restriction.ChannelID = SDK_PREFIX + "test_channel";
+		Restriction.Ban = true;
+		
+		FPubnubChatOperationResult SetResult = Chat->SetRestrictionsBulk({Restriction});
+		
+		TestTrue("SetRestrictionsBulk should fail when Chat is not initialized", SetResult.Error);
+		TestFalse("ErrorMessage should not be empty", SetResult.ErrorMessage.IsEmpty());
+	}
+
+	CleanUpCurrentChatUser(Chat);
+	CleanUp();
+	return true;
+}
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubChatSetRestrictionsBulkEmptyUserIDTest, FPubnubChatAutomationTestBase, "PubnubChat.Integration.Chat.Moderation.SetRestrictionsBulk.1Validation.EmptyUserID", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatSetRestrictionsBulkEmptyUserIDTest::RunTest(const FString& Parameters)
+{
+	if(!InitTest())
+	{
+		AddError("TestInitialization failed");
+		return false;
+	}
+
+	const FString TestPublishKey = GetTestPublishKey();
+	const FString TestSubscribeKey = GetTestSubscribeKey();
+	const FString TestUserID = SDK_PREFIX + "test_set_restrictions_bulk_init";
+	
+	FPubnubChatConfig ChatConfig;
+	FPubnubChatInitChatResult InitResult = ChatSubsystem->InitChat(TestPublishKey, TestSubscribeKey, TestUserID, ChatConfig);
+	
+	TestFalse("InitChat should succeed", InitResult.Result.Error);
+	
+	UPubnubChat* Chat = InitResult.Chat;
+	if(Chat)
+	{
+		FPubnubChatRestriction ValidRestriction;
+		ValidRestriction.UserID = SDK_PREFIX + "test_user";
+		ValidRestriction.ChannelID = SDK_PREFIX + "test_channel";
+		ValidRestriction.Ban = true;
+		
+		FPubnubChatRestriction InvalidRestriction = ValidRestriction;
+		InvalidRestriction.UserID = TEXT(""); // Empty UserID
+		
+		// Whole batch is rejected before any request is made
+		FPubnubChatOperationResult SetResult = Chat->SetRestrictionsBulk({ValidRestriction, InvalidRestriction});
+		
+		TestTrue("SetRestrictionsBulk should fail with empty UserID", SetResult.Error);
+		TestFalse("ErrorMessage should not be empty", SetResult.ErrorMessage.IsEmpty());
+		TestEqual("No requests should be made", SetResult.StepResults.Num(), 0);
+	}
+
+	CleanUpCurrentChatUser(Chat);
+	CleanUp();
+	return true;
+}
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubChatSetRestrictionsBulkMultipleChannelsTest, FPubnubChatAutomationTestBase, "PubnubChat.Integration.Chat.Moderation.SetRestrictionsBulk.2HappyPath.MultipleChannels", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatSetRestrictionsBulkMultipleChannelsTest::RunTest(const FString& Parameters)
+{
+	if(!InitTest())
+	{
+		AddError("TestInitialization failed");
+		return false;
+	}
+
+	const FString TestPublishKey = GetTestPublishKey();
+	const FString TestSubscribeKey = GetTestSubscribeKey();
+	const FString InitUserID = SDK_PREFIX + "test_set_restrictions_bulk_multi_init";
+	const FString TargetUserID = SDK_PREFIX + "test_set_restrictions_bulk_multi_target";
+	const TArray<FString> TestChannelIDs = {SDK_PREFIX + "test_set_restrictions_bulk_multi_channel_1", SDK_PREFIX + "test_set_restrictions_bulk_multi_channel_2"};
+	
+	FPubnubChatConfig ChatConfig;
+	FPubnubChatInitChatResult InitResult = ChatSubsystem->InitChat(TestPublishKey, TestSubscribeKey, InitUserID, ChatConfig);
+	
+	TestFalse("InitChat should succeed", InitResult.Result.Error);
+	
+	UPubnubChat* Chat = InitResult.Chat;
+	if(!Chat)
+	{
+		AddError("Chat should be initialized");
+		CleanUpCurrentChatUser(Chat);
+		CleanUp();
+		return false;
+	}
+	
+	FPubnubChatUserResult CreateUserResult = Chat->CreateUser(TargetUserID);
+	TestFalse("CreateUser should succeed", CreateUserResult.Result.Error);
+	
+	TArray<UPubnubChatChannel*> Channels;
+	TArray<FPubnubChatRestriction> Restrictions;
+	for (const FString& TestChannelID : TestChannelIDs)
+	{
+		FPubnubChatChannelResult CreateChannelResult = Chat->CreatePublicConversation(TestChannelID);
+		TestFalse("CreateChannel should succeed", CreateChannelResult.Result.Error);
+		Channels.Add(CreateChannelResult.Channel);
+		
+		// First entry mutes the user, second one (for the same user and channel) bans - the last one has to win
+		FPubnubChatRestriction Restriction;
+		Restriction.UserID = TargetUserID;
+		Restriction.ChannelID = TestChannelID;
+		Restriction.Mute = true;
+		Restrictions.Add(Restriction);
+		
+		Restriction.Mute = false;
+		Restriction.Ban = true;
+		Restriction.Reason = TEXT("Spam");
+		Restrictions.Add(Restriction);
+	}
+	
+	FPubnubChatOperationResult SetResult = Chat->SetRestrictionsBulk(Restrictions);
+	TestFalse("SetRestrictionsBulk should succeed", SetResult.Error);
+	
+	// Calling it again shouldn't recreate already known moderation channels
+	FPubnubChatOperationResult SecondSetResult = Chat->SetRestrictionsBulk(Restrictions);
+	TestFalse("Second SetRestrictionsBulk should succeed", SecondSetResult.Error);
+	for (const FPubnubChatOperationStepResult& StepResult : SecondSetResult.StepResults)
+	{
+		TestNotEqual("Moderation channel should not be created again", StepResult.StepName, FString(TEXT("SetChannelMetadata")));
+	}
+	
+	for (int32 i = 0; i < Channels.Num(); ++i)
+	{
+		if(Channels[i] && CreateUserResult.User)
+		{
+			FPubnubChatGetRestrictionResult GetResult = Channels[i]->GetUserRestrictions(CreateUserResult.User);
+			TestFalse("GetUserRestrictions should succeed", GetResult.Result.Error);
+			TestTrue("Restriction Ban should be true", GetResult.Restriction.Ban);
+			TestFalse("Restriction Mute should be false", GetResult.Restriction.Mute);
+			TestEqual("Restriction Reason should match", GetResult.Restriction.Reason, FString(TEXT("Spam")));
+		}
+	}
+	
+	// Cleanup: Lift restrictions, delete channels and user
+	TArray<FPubnubChatRestriction> LiftRestrictions;
+	for (const FString& TestChannelID : TestChannelIDs)
+	{
+		FPubnubChatRestriction Restriction;
+		Restriction.UserID = TargetUserID;
+		Restriction.ChannelID = TestChannelID;
+		LiftRestrictions.Add(Restriction);
+	}
+	FPubnubChatOperationResult LiftResult = Chat->SetRestrictionsBulk(LiftRestrictions);
+	TestFalse("Lifting restrictions should succeed", LiftResult.Error);
+	
+	for (const FString& TestChannelID : TestChannelIDs)
+	{
+		Chat->DeleteChannel(TestChannelID);
+	}
+	Chat->DeleteUser(TargetUserID);
+
+	CleanUpCurrentChatUser(Chat);
+	CleanUp();
+	return true;
+}
+
 // ============================================================================
 // GETUSERRESTRICTIONS TESTS (UPubnubChatChannel::GetUserRestrictions)
 // ============================================================================
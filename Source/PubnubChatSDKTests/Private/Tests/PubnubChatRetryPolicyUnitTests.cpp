@@ -0,0 +1,279 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/PubnubChatRetryPolicy.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+
+namespace
+{
+	FPubnubOperationResult MakeRetryTestResult(int Status, bool bError, const FString& ErrorMessage = TEXT(""))
+	{
+		return FPubnubOperationResult({Status, bError, ErrorMessage});
+	}
+
+	FPubnubChatRetryConfig MakeFastRetryConfig()
+	{
+		FPubnubChatRetryConfig RetryConfig;
+		RetryConfig.Enabled = true;
+		RetryConfig.MaxAttempts = 3;
+		RetryConfig.BaseDelayMs = 1;
+		RetryConfig.MaxDelayMs = 2;
+		RetryConfig.CircuitBreakerFailureThreshold = 0;
+		return RetryConfig;
+	}
+
+	//Requests made on the game thread are never retried, so retries are tested on a separate thread
+	template<typename TFunc>
+	FPubnubOperationResult RunRetryTestOffGameThread(TFunc&& Func)
+	{
+		return Async(EAsyncExecution::Thread, Forward<TFunc>(Func)).Get();
+	}
+}
+
+// ============================================================================
+// RETRY POLICY UNIT TESTS - Error classification, backoff, retries and circuit breaker (No API Calls)
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRetryPolicyClassificationTest, "PubnubChat.Unit.RetryPolicy.Classification", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRetryPolicyClassificationTest::RunTest(const FString& Parameters)
+{
+	TestTrue("429 should be transient", FPubnubChatRetryPolicy::IsTransientError(MakeRetryTestResult(429, true)));
+	TestTrue("503 should be transient", FPubnubChatRetryPolicy::IsTransientError(MakeRetryTestResult(503, true)));
+	TestTrue("408 should be transient", FPubnubChatRetryPolicy::IsTransientError(MakeRetryTestResult(408, true)));
+	TestTrue("Client side timeout without status should be transient", FPubnubChatRetryPolicy::IsTransientError(MakeRetryTestResult(0, true, TEXT("Pubnub API transaction timed out"))));
+	TestTrue("Connection failure without status should be transient", FPubnubChatRetryPolicy::IsTransientError(MakeRetryTestResult(0, true, TEXT("Connection to Pubnub failed"))));
+	TestFalse("400 should be fatal", FPubnubChatRetryPolicy::IsTransientError(MakeRetryTestResult(400, true)));
+	TestFalse("403 should be fatal", FPubnubChatRetryPolicy::IsTransientError(MakeRetryTestResult(403, true)));
+	TestFalse("Invalid input without status should be fatal", FPubnubChatRetryPolicy::IsTransientError(MakeRetryTestResult(0, true, TEXT("Channel is empty"))));
+
+	TestTrue("Reads should be retried after 503", FPubnubChatRetryPolicy::CanRetry(MakeRetryTestResult(503, true), EPubnubChatRetryOperationType::PCROT_Read));
+	TestFalse("Publish should not be retried after 503, it may have been applied", FPubnubChatRetryPolicy::CanRetry(MakeRetryTestResult(503, true), EPubnubChatRetryOperationType::PCROT_Publish));
+	TestTrue("Publish should be retried after 429", FPubnubChatRetryPolicy::CanRetry(MakeRetryTestResult(429, true), EPubnubChatRetryOperationType::PCROT_Publish));
+	TestFalse("Publish should not be retried after a timeout, it may have been applied", FPubnubChatRetryPolicy::CanRetry(MakeRetryTestResult(0, true, TEXT("Pubnub API transaction timed out")), EPubnubChatRetryOperationType::PCROT_Publish));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRetryPolicyBackoffTest, "PubnubChat.Unit.RetryPolicy.Backoff", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRetryPolicyBackoffTest::RunTest(const FString& Parameters)
+{
+	FPubnubChatRetryConfig RetryConfig;
+	RetryConfig.BaseDelayMs = 100;
+	RetryConfig.MaxDelayMs = 1000;
+	FPubnubChatRetryPolicy RetryPolicy(RetryConfig);
+
+	TestEqual("First retry without jitter should wait half of the base delay", RetryPolicy.GetBackoffDelaySeconds(1, 0.0f), 0.05f, 0.0001f);
+	TestEqual("First retry with full jitter should wait the base delay", RetryPolicy.GetBackoffDelaySeconds(1, 1.0f), 0.1f, 0.0001f);
+	TestEqual("Delay should double with every retry", RetryPolicy.GetBackoffDelaySeconds(3, 1.0f), 0.4f, 0.0001f);
+	TestEqual("Delay should be capped", RetryPolicy.GetBackoffDelaySeconds(10, 1.0f), 1.0f, 0.0001f);
+	TestEqual("Delay of a very late retry should stay capped", RetryPolicy.GetBackoffDelaySeconds(100, 1.0f), 1.0f, 0.0001f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRetryPolicyExecuteTest, "PubnubChat.Unit.RetryPolicy.Execute", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRetryPolicyExecuteTest::RunTest(const FString& Parameters)
+{
+	FPubnubChatRetryPolicy RetryPolicy(MakeFastRetryConfig());
+
+	//Transient failure followed by success
+	int NumCalls = 0;
+	FPubnubChatOperationResult OperationResult;
+	FPubnubOperationResult Result = RunRetryTestOffGameThread([&]()
+	{
+		return FPubnubChatRetryPolicy::Execute(&RetryPolicy, EPubnubChatRetryOperationType::PCROT_Read, TEXT("GetUserMetadata"), OperationResult, [&]()
+		{
+			return ++NumCalls == 1 ? MakeRetryTestResult(503, true) : MakeRetryTestResult(200, false);
+		});
+	});
+	TestFalse("Request should succeed after retry", Result.Error);
+	TestEqual("Request should be called twice", NumCalls, 2);
+	TestEqual("Retry should be reported as a step", OperationResult.StepResults.Num(), 1);
+	TestFalse("Retry step should not be an error", OperationResult.Error);
+
+	//Fatal failure is not retried
+	NumCalls = 0;
+	OperationResult = FPubnubChatOperationResult();
+	Result = RunRetryTestOffGameThread([&]()
+	{
+		return FPubnubChatRetryPolicy::Execute(&RetryPolicy, EPubnubChatRetryOperationType::PCROT_Write, TEXT("SetUserMetadata"), OperationResult, [&]()
+		{
+			++NumCalls;
+			return MakeRetryTestResult(403, true);
+		});
+	});
+	TestTrue("Fatal failure should be returned", Result.Error);
+	TestEqual("Fatal failure should not be retried", NumCalls, 1);
+	TestEqual("No retry should be reported", OperationResult.StepResults.Num(), 0);
+
+	//Transient failure is retried up to MaxAttempts
+	NumCalls = 0;
+	Result = RunRetryTestOffGameThread([&]()
+	{
+		return FPubnubChatRetryPolicy::Execute(&RetryPolicy, EPubnubChatRetryOperationType::PCROT_Read, TEXT("FetchHistory"), OperationResult, [&]()
+		{
+			++NumCalls;
+			return MakeRetryTestResult(500, true);
+		});
+	});
+	TestTrue("Last failure should be returned", Result.Error);
+	TestEqual("Request should be called MaxAttempts times", NumCalls, 3);
+
+	//Publish that may have been applied is not repeated
+	NumCalls = 0;
+	Result = RunRetryTestOffGameThread([&]()
+	{
+		return FPubnubChatRetryPolicy::Execute(&RetryPolicy, EPubnubChatRetryOperationType::PCROT_Publish, TEXT("PublishMessage"), OperationResult, [&]()
+		{
+			++NumCalls;
+			return MakeRetryTestResult(500, true);
+		});
+	});
+	TestEqual("Publish should not be repeated after 500", NumCalls, 1);
+
+	//Without policy the request is called once
+	NumCalls = 0;
+	Result = FPubnubChatRetryPolicy::Execute(nullptr, EPubnubChatRetryOperationType::PCROT_Read, TEXT("FetchHistory"), OperationResult, [&]()
+	{
+		++NumCalls;
+		return MakeRetryTestResult(500, true);
+	});
+	TestEqual("Request without policy should be called once", NumCalls, 1);
+
+	//Retries are opt-in, default config calls the request once
+	FPubnubChatRetryPolicy DefaultRetryPolicy((FPubnubChatRetryConfig()));
+	NumCalls = 0;
+	Result = FPubnubChatRetryPolicy::Execute(&DefaultRetryPolicy, EPubnubChatRetryOperationType::PCROT_Read, TEXT("FetchHistory"), OperationResult, [&]()
+	{
+		++NumCalls;
+		return MakeRetryTestResult(500, true);
+	});
+	TestEqual("Request with default config should be called once", NumCalls, 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRetryPolicyGameThreadTest, "PubnubChat.Unit.RetryPolicy.GameThread", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRetryPolicyGameThreadTest::RunTest(const FString& Parameters)
+{
+	FPubnubChatRetryPolicy RetryPolicy(MakeFastRetryConfig());
+
+	//Automation tests run on the game thread, where backoff would stall the frame
+	int NumCalls = 0;
+	FPubnubChatOperationResult OperationResult;
+	FPubnubOperationResult Result = FPubnubChatRetryPolicy::Execute(&RetryPolicy, EPubnubChatRetryOperationType::PCROT_Read, TEXT("FetchHistory"), OperationResult, [&]()
+	{
+		++NumCalls;
+		return MakeRetryTestResult(503, true);
+	});
+	TestTrue("Transient failure should be returned right away", Result.Error);
+	TestEqual("Request on the game thread should not be retried", NumCalls, 1);
+	TestEqual("No retry should be reported", OperationResult.StepResults.Num(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRetryPolicyCircuitBreakerTest, "PubnubChat.Unit.RetryPolicy.CircuitBreaker", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRetryPolicyCircuitBreakerTest::RunTest(const FString& Parameters)
+{
+	FPubnubChatRetryConfig RetryConfig = MakeFastRetryConfig();
+	RetryConfig.CircuitBreakerFailureThreshold = 3;
+	RetryConfig.CircuitBreakerCooldownMs = 1000;
+	FPubnubChatRetryPolicy RetryPolicy(RetryConfig);
+
+	RetryPolicy.RecordResult(true, 0.0);
+	RetryPolicy.RecordResult(true, 0.0);
+	RetryPolicy.RecordResult(false, 0.0);
+	RetryPolicy.RecordResult(true, 0.0);
+	TestTrue("Success should reset consecutive failures", RetryPolicy.GetCircuitBreakerState() == EPubnubChatCircuitBreakerState::PCCBS_Closed);
+
+	RetryPolicy.RecordResult(true, 0.0);
+	RetryPolicy.RecordResult(true, 0.0);
+	TestTrue("Threshold of consecutive failures should open the breaker", RetryPolicy.GetCircuitBreakerState() == EPubnubChatCircuitBreakerState::PCCBS_Open);
+	TestFalse("Open breaker should reject requests", RetryPolicy.TryAcquire(0.5));
+
+	TestTrue("Single request should be let through after the cooldown", RetryPolicy.TryAcquire(1.5));
+	TestFalse("Second request should wait for the test request", RetryPolicy.TryAcquire(1.5));
+	RetryPolicy.RecordResult(true, 1.5);
+	TestTrue("Failed test request should open the breaker again", RetryPolicy.GetCircuitBreakerState() == EPubnubChatCircuitBreakerState::PCCBS_Open);
+	TestFalse("Breaker should reject requests for another cooldown", RetryPolicy.TryAcquire(2.0));
+
+	TestTrue("Request should be let through after the next cooldown", RetryPolicy.TryAcquire(3.0));
+	RetryPolicy.RecordResult(false, 3.0);
+	TestTrue("Successful test request should close the breaker", RetryPolicy.GetCircuitBreakerState() == EPubnubChatCircuitBreakerState::PCCBS_Closed);
+	TestTrue("Closed breaker should let requests through", RetryPolicy.TryAcquire(3.0));
+
+	//Open breaker fails requests without calling them
+	RetryPolicy.RecordResult(true, FPlatformTime::Seconds());
+	RetryPolicy.RecordResult(true, FPlatformTime::Seconds());
+	RetryPolicy.RecordResult(true, FPlatformTime::Seconds());
+	int NumCalls = 0;
+	FPubnubChatOperationResult OperationResult;
+	FPubnubOperationResult Result = FPubnubChatRetryPolicy::Execute(&RetryPolicy, EPubnubChatRetryOperationType::PCROT_Read, TEXT("FetchHistory"), OperationResult, [&]()
+	{
+		++NumCalls;
+		return MakeRetryTestResult(200, false);
+	});
+	TestTrue("Request should fail fast while the breaker is open", Result.Error);
+	TestEqual("Request should not be called while the breaker is open", NumCalls, 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatRetryPolicyCircuitBreakerWithoutRetriesTest, "PubnubChat.Unit.RetryPolicy.CircuitBreakerWithoutRetries", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatRetryPolicyCircuitBreakerWithoutRetriesTest::RunTest(const FString& Parameters)
+{
+	//Default config doesn't retry, but the circuit breaker is active
+	FPubnubChatRetryConfig RetryConfig;
+	TestFalse("Retries should be disabled by default", RetryConfig.Enabled);
+	TestTrue("Circuit breaker should be enabled by default", RetryConfig.CircuitBreakerEnabled);
+	FPubnubChatRetryPolicy RetryPolicy(RetryConfig);
+
+	int NumCalls = 0;
+	FPubnubChatOperationResult OperationResult;
+	for (int i = 0; i < RetryConfig.CircuitBreakerFailureThreshold; ++i)
+	{
+		FPubnubChatRetryPolicy::Execute(&RetryPolicy, EPubnubChatRetryOperationType::PCROT_Read, TEXT("FetchHistory"), OperationResult, [&]()
+		{
+			++NumCalls;
+			return MakeRetryTestResult(0, true, TEXT("Pubnub API transaction timed out"));
+		});
+	}
+	TestEqual("Every request should be called once", NumCalls, RetryConfig.CircuitBreakerFailureThreshold);
+	TestTrue("Consecutive timeouts should open the breaker", RetryPolicy.GetCircuitBreakerState() == EPubnubChatCircuitBreakerState::PCCBS_Open);
+
+	NumCalls = 0;
+	FPubnubOperationResult Result = FPubnubChatRetryPolicy::Execute(&RetryPolicy, EPubnubChatRetryOperationType::PCROT_Read, TEXT("FetchHistory"), OperationResult, [&]()
+	{
+		++NumCalls;
+		return MakeRetryTestResult(200, false);
+	});
+	TestTrue("Request should fail fast while the breaker is open", Result.Error);
+	TestEqual("Request should not be called while the breaker is open", NumCalls, 0);
+
+	//Disabled breaker never rejects requests
+	RetryConfig.CircuitBreakerEnabled = false;
+	FPubnubChatRetryPolicy NoBreakerRetryPolicy(RetryConfig);
+	NumCalls = 0;
+	for (int i = 0; i < RetryConfig.CircuitBreakerFailureThreshold + 1; ++i)
+	{
+		FPubnubChatRetryPolicy::Execute(&NoBreakerRetryPolicy, EPubnubChatRetryOperationType::PCROT_Read, TEXT("FetchHistory"), OperationResult, [&]()
+		{
+			++NumCalls;
+			return MakeRetryTestResult(503, true);
+		});
+	}
+	TestEqual("Requests should be called while the breaker is disabled", NumCalls, RetryConfig.CircuitBreakerFailureThreshold + 1);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,227 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/PubnubChatSearchIndex.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PubnubChatSDK/Private/PubnubChatObjectsRepository.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	FPubnubChatMessageData MakeSearchTestMessage(const FString& ChannelID, const FString& Text)
+	{
+		FPubnubChatMessageData MessageData;
+		MessageData.Type = TEXT("text");
+		MessageData.Text = Text;
+		MessageData.ChannelID = ChannelID;
+		MessageData.UserID = TEXT("search_user");
+		return MessageData;
+	}
+
+	FPubnubChatMessageAction MakeSearchTestAction(EPubnubChatMessageActionType Type, const FString& Value, const FString& Timetoken)
+	{
+		FPubnubChatMessageAction MessageAction;
+		MessageAction.Type = Type;
+		MessageAction.Value = Value;
+		MessageAction.Timetoken = Timetoken;
+		MessageAction.UserID = TEXT("search_user");
+		return MessageAction;
+	}
+
+	FString JoinHitTimetokens(const TArray<FPubnubChatSearchIndexHit>& Hits)
+	{
+		TArray<FString> Timetokens;
+		for (const FPubnubChatSearchIndexHit& Hit : Hits)
+		{
+			Timetokens.Add(Hit.Timetoken);
+		}
+		return FString::Join(Timetokens, TEXT(","));
+	}
+}
+
+// ============================================================================
+// SEARCH INDEX UNIT TESTS - Tokens, prefix queries, edits, deletes and memory budget (No API Calls)
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatSearchIndexTokenizeTest, "PubnubChat.Unit.SearchIndex.Tokenize", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatSearchIndexTokenizeTest::RunTest(const FString& Parameters)
+{
+	TestEqual("Text should be split into unique lowercase words", FString::Join(FPubnubChatSearchIndex::Tokenize(TEXT("Hello, World! hello_there HELLO 42")), TEXT(",")), FString(TEXT("hello,world,hello_there,42")));
+	TestEqual("Text without words should have no tokens", FPubnubChatSearchIndex::Tokenize(TEXT(" ?!. ")).Num(), 0);
+	TestEqual("Long words should be truncated", FPubnubChatSearchIndex::Tokenize(FString::ChrN(100, TEXT('a')))[0].Len(), 32);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatSearchIndexQueryTest, "PubnubChat.Unit.SearchIndex.Query", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatSearchIndexQueryTest::RunTest(const FString& Parameters)
+{
+	FPubnubChatSearchIndex Index(64 * 1024 * 1024);
+	Index.IndexMessage(TEXT("main.100"), MakeSearchTestMessage(TEXT("main"), TEXT("Hello World")));
+	Index.IndexMessage(TEXT("main.200"), MakeSearchTestMessage(TEXT("main"), TEXT("hello there")));
+	Index.IndexMessage(TEXT("other.channel.300"), MakeSearchTestMessage(TEXT("other.channel"), TEXT("Help wanted in the world")));
+	TestEqual("All messages should be indexed", Index.GetNumMessages(), 3);
+
+	TArray<FPubnubChatSearchIndexHit> Hits;
+	Index.Search(TEXT("HELLO"), TEXT(""), 10, Hits);
+	TestEqual("Search should be case insensitive and return newest first", JoinHitTimetokens(Hits), FString(TEXT("200,100")));
+
+	Index.Search(TEXT("hel"), TEXT(""), 10, Hits);
+	TestEqual("Words should be matched by prefix", JoinHitTimetokens(Hits), FString(TEXT("300,200,100")));
+
+	Index.Search(TEXT("hel wor"), TEXT(""), 10, Hits);
+	TestEqual("All query words should match", JoinHitTimetokens(Hits), FString(TEXT("300,100")));
+
+	Index.Search(TEXT("hel"), TEXT("other.channel"), 10, Hits);
+	TestEqual("Channel filter should limit results", JoinHitTimetokens(Hits), FString(TEXT("300")));
+	TestEqual("Channel ID should be read from message ID with dots", Hits.IsEmpty() ? FString() : Hits[0].ChannelID, FString(TEXT("other.channel")));
+
+	Index.Search(TEXT("hel"), TEXT(""), 2, Hits);
+	TestEqual("Limit should keep the newest messages", JoinHitTimetokens(Hits), FString(TEXT("300,200")));
+
+	Index.Search(TEXT("goodbye"), TEXT(""), 10, Hits);
+	TestEqual("Unknown word should find nothing", Hits.Num(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatSearchIndexEditDeleteTest, "PubnubChat.Unit.SearchIndex.EditDelete", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatSearchIndexEditDeleteTest::RunTest(const FString& Parameters)
+{
+	FPubnubChatSearchIndex Index(64 * 1024 * 1024);
+	FPubnubChatMessageData MessageData = MakeSearchTestMessage(TEXT("main"), TEXT("original text"));
+	Index.IndexMessage(TEXT("main.100"), MessageData);
+
+	// Latest edit replaces the indexed text
+	MessageData.MessageActions = {
+		MakeSearchTestAction(EPubnubChatMessageActionType::PCMAT_Edited, TEXT("second edit"), TEXT("120")),
+		MakeSearchTestAction(EPubnubChatMessageActionType::PCMAT_Edited, TEXT("first edit"), TEXT("110"))};
+	Index.IndexMessage(TEXT("main.100"), MessageData);
+
+	TArray<FPubnubChatSearchIndexHit> Hits;
+	Index.Search(TEXT("original"), TEXT(""), 10, Hits);
+	TestEqual("Original text should not be found after edit", Hits.Num(), 0);
+	Index.Search(TEXT("first"), TEXT(""), 10, Hits);
+	TestEqual("Older edit should not be found", Hits.Num(), 0);
+	Index.Search(TEXT("second"), TEXT(""), 10, Hits);
+	TestEqual("Latest edit should be found", Hits.Num(), 1);
+
+	// Soft deleted message is hidden, restoring it makes it searchable again
+	FPubnubChatMessageData DeletedMessageData = MessageData;
+	DeletedMessageData.MessageActions.Add(MakeSearchTestAction(EPubnubChatMessageActionType::PCMAT_Deleted, TEXT("deleted"), TEXT("130")));
+	Index.IndexMessage(TEXT("main.100"), DeletedMessageData);
+	Index.Search(TEXT("second"), TEXT(""), 10, Hits);
+	TestEqual("Soft deleted message should not be found", Hits.Num(), 0);
+	TestEqual("Soft deleted message should not be counted", Index.GetNumMessages(), 0);
+
+	Index.IndexMessage(TEXT("main.100"), MessageData);
+	Index.Search(TEXT("second"), TEXT(""), 10, Hits);
+	TestEqual("Restored message should be found", Hits.Num(), 1);
+
+	Index.RemoveMessage(TEXT("main.100"));
+	Index.Search(TEXT("second"), TEXT(""), 10, Hits);
+	TestEqual("Removed message should not be found", Hits.Num(), 0);
+	TestEqual("Removed message should not be counted", Index.GetNumMessages(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatSearchIndexMemoryBudgetTest, "PubnubChat.Unit.SearchIndex.MemoryBudget", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatSearchIndexMemoryBudgetTest::RunTest(const FString& Parameters)
+{
+	const int64 MaxMemoryBytes = 64 * 1024;
+	FPubnubChatSearchIndex Index(MaxMemoryBytes);
+	for (int32 i = 1; i <= 2000; ++i)
+	{
+		const FString Marker = i == 1 ? TEXT("first") : (i == 2000 ? TEXT("last") : TEXT("middle"));
+		Index.IndexMessage(FString::Printf(TEXT("main.%d"), i), MakeSearchTestMessage(TEXT("main"), FString::Printf(TEXT("budget %s message number%d"), *Marker, i)));
+	}
+
+	TestTrue("Index should stay within the memory budget", Index.GetMemorySize() <= MaxMemoryBytes);
+	TestTrue("Some messages should be evicted", Index.GetNumMessages() < 2000);
+
+	TArray<FPubnubChatSearchIndexHit> Hits;
+	Index.Search(TEXT("first"), TEXT(""), 10, Hits);
+	TestEqual("Oldest message should be evicted first", Hits.Num(), 0);
+	Index.Search(TEXT("last"), TEXT(""), 10, Hits);
+	TestEqual("Newest message should be kept", Hits.Num(), 1);
+
+	Index.Clear();
+	TestEqual("Clear should remove all messages", Index.GetNumMessages(), 0);
+	TestEqual("Clear should release all memory", Index.GetMemorySize(), static_cast<int64>(0));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatSearchIndexRepositoryTest, "PubnubChat.Unit.SearchIndex.Repository", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatSearchIndexRepositoryTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+	const FString MessageID = TEXT("main.100");
+
+	TArray<FPubnubChatSearchIndexHit> Hits;
+	Repository->UpdateMessageData(MessageID, MakeSearchTestMessage(TEXT("main"), TEXT("indexed later")));
+	Repository->EnableSearchIndex(64 * 1024 * 1024);
+	Repository->SearchMessages(TEXT("indexed"), TEXT(""), 10, Hits);
+	TestEqual("Messages held by the repository should be indexed when the index is enabled", Hits.Num(), 1);
+
+	// Released message objects stay searchable
+	Repository->RegisterAndUpdateMessages({TEXT("main.200")}, {MakeSearchTestMessage(TEXT("main"), TEXT("released message"))}, {TEXT("main.200")});
+	Repository->UnregisterMessage(TEXT("main.200"));
+	Repository->SearchMessages(TEXT("released"), TEXT(""), 10, Hits);
+	TestEqual("Released message should stay searchable", Hits.Num(), 1);
+
+	Repository->RemoveMessageData(TEXT("main.200"));
+	Repository->SearchMessages(TEXT("released"), TEXT(""), 10, Hits);
+	TestEqual("Deleted message should not be searchable", Hits.Num(), 0);
+
+	Repository->ClearAll();
+	Repository->SearchMessages(TEXT("indexed"), TEXT(""), 10, Hits);
+	TestEqual("Clearing the repository should clear the index", Hits.Num(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatSearchIndexBenchmark, "PubnubChat.Benchmark.SearchIndex.Search", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter);
+
+bool FPubnubChatSearchIndexBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 NumMessages = 1000000;
+	const int32 NumQueries = 100;
+	const TArray<FString> Words = {TEXT("meet"), TEXT("later"), TEXT("raid"), TEXT("guild"), TEXT("boss"), TEXT("loot"), TEXT("trade"), TEXT("quest"), TEXT("party"), TEXT("ready")};
+
+	FPubnubChatSearchIndex Index(static_cast<int64>(4096) * 1024 * 1024);
+	const double IndexStartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumMessages; ++i)
+	{
+		const FString Text = FString::Printf(TEXT("%s %s %s item%d"), *Words[i % 10], *Words[(i / 10) % 10], *Words[(i / 100) % 10], i % 5000);
+		Index.IndexMessage(FString::Printf(TEXT("channel%d.%d"), i % 50, 17000000 + i), MakeSearchTestMessage(FString::Printf(TEXT("channel%d"), i % 50), Text));
+	}
+	const double IndexSeconds = FPlatformTime::Seconds() - IndexStartTime;
+
+	TArray<FPubnubChatSearchIndexHit> Hits;
+	//First search sorts the token dictionary
+	Index.Search(TEXT("raid"), TEXT(""), 25, Hits);
+
+	const double SearchStartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumQueries; ++i)
+	{
+		Index.Search(FString::Printf(TEXT("%s bo item%d"), *Words[i % 10], i), TEXT(""), 25, Hits);
+	}
+	const double SearchMs = (FPlatformTime::Seconds() - SearchStartTime) * 1000.0 / NumQueries;
+
+	AddInfo(FString::Printf(TEXT("Indexed %d messages in %.2f s, %.1f MB. Average search: %.3f ms"), Index.GetNumMessages(), IndexSeconds, Index.GetMemorySize() / (1024.0 * 1024.0), SearchMs));
+	TestEqual("All messages should be indexed", Index.GetNumMessages(), NumMessages);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
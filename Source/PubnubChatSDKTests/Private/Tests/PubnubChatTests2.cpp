@@ -900,5 +900,109 @@ bool FPubnubChatMarkAllMessagesAsReadAsyncFullParametersTest::RunTest(const FStr
 	return true;
 }
 
-#endif // WITH_DEV_AUTOMATION_TESTS
+// ============================================================================
+// DELETEMESSAGES TESTS
+// ============================================================================
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubChatDeleteMessagesNotInitializedTest, FPubnubChatAutomationTestBase, "PubnubChat.Integration.Chat.Messages.DeleteMessages.1Validation.NotInitialized", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatDeleteMessagesNotInitializedTest::RunTest(const FString& Parameters)
+{
+	if(!InitTest())
+	{
+		AddError("TestInitialization failed");
+		return false;
+	}
+
+	// Create Chat without initializing
+	UPubnubChat* Chat = NewObject<UPubnubChat>(ChatSubsystem);
+	
+	if(Chat)
+	{
+		FPubnubChatOperationResult DeleteResult = Chat->DeleteMessages(TArray<UPubnubChatMessage*>());
+		
+		TestTrue("DeleteMessages should fail when Chat is not initialized", DeleteResult.Error);
+		TestFalse("ErrorMessage should not be empty", DeleteResult.ErrorMessage.IsEmpty());
+	}
+
+	CleanUp();
+	return true;
+}
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubChatDeleteMessagesHappyPathTest, FPubnubChatAutomationTestBase, "PubnubChat.Integration.Chat.Messages.DeleteMessages.2HappyPath.RequiredParametersOnly", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ClientContext);
+
+bool FPubnubChatDeleteMessagesHappyPathTest::RunTest(const FString& Parameters)
+{
+	if(!InitTest())
+	{
+		AddError("TestInitialization failed");
+		return false;
+	}
+
+	const FString TestPublishKey = GetTestPublishKey();
+	const FString TestSubscribeKey = GetTestSubscribeKey();
+	const FString InitUserID = SDK_PREFIX + "test_delete_messages_init";
+	const FString TestChannelID = SDK_PREFIX + "test_delete_messages";
+	
+	FPubnubChatConfig ChatConfig;
+	FPubnubChatInitChatResult InitResult = ChatSubsystem->InitChat(TestPublishKey, TestSubscribeKey, InitUserID, ChatConfig);
+	TestFalse("InitChat should succeed", InitResult.Result.Error);
+	
+	UPubnubChat* Chat = InitResult.Chat;
+	if(!Chat)
+	{
+		AddError("Chat should be initialized");
+		CleanUp();
+		return false;
+	}
+	
+	FPubnubChatChannelResult CreateResult = Chat->CreatePublicConversation(TestChannelID, FPubnubChatChannelData());
+	TestFalse("CreatePublicConversation should succeed", CreateResult.Result.Error);
+	if(!CreateResult.Channel)
+	{
+		CleanUpCurrentChatUser(Chat);
+		CleanUp();
+		return false;
+	}
+	
+	// Empty array is a valid no-op
+	FPubnubChatOperationResult EmptyDeleteResult = Chat->DeleteMessages(TArray<UPubnubChatMessage*>());
+	TestFalse("DeleteMessages with empty array should succeed", EmptyDeleteResult.Error);
+	
+	TestFalse("First SendText should succeed", CreateResult.Channel->SendText(TEXT("First message to delete")).Error);
+	TestFalse("Second SendText should succeed", CreateResult.Channel->SendText(TEXT("Second message to delete")).Error);
+	
+	// Wait for messages to be stored, then delete them all at once
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, CreateResult, Chat]()
+	{
+		FPubnubChatGetHistoryResult HistoryResult = CreateResult.Channel->GetHistory(UPubnubTimetokenUtilities::GetCurrentUnixTimetoken(), UPubnubTimetokenUtilities::AddIntToTimetoken(UPubnubTimetokenUtilities::GetCurrentUnixTimetoken(), -600000000), 10);
+		TestFalse("GetHistory should succeed", HistoryResult.Result.Error);
+		TestEqual("History should contain both messages", HistoryResult.Messages.Num(), 2);
+		
+		FPubnubChatOperationResult DeleteResult = Chat->DeleteMessages(HistoryResult.Messages);
+		TestFalse("DeleteMessages should succeed", DeleteResult.Error);
+		TestTrue("DeleteMessages should perform at least one request", DeleteResult.StepResults.Num() >= 1);
+	}, 2.0f));
+	
+	// Verify messages are gone
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, CreateResult]()
+	{
+		FPubnubChatGetHistoryResult HistoryResult = CreateResult.Channel->GetHistory(UPubnubTimetokenUtilities::GetCurrentUnixTimetoken(), UPubnubTimetokenUtilities::AddIntToTimetoken(UPubnubTimetokenUtilities::GetCurrentUnixTimetoken(), -600000000), 10);
+		TestFalse("GetHistory should succeed", HistoryResult.Result.Error);
+		TestEqual("History should be empty after DeleteMessages", HistoryResult.Messages.Num(), 0);
+	}, 1.0f));
+	
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, Chat, TestChannelID]()
+	{
+		if(Chat)
+		{
+			Chat->DeleteChannel(TestChannelID);
+		}
+		CleanUpCurrentChatUser(Chat);
+		CleanUp();
+	}, 0.1f));
+	
+	return true;
+}
 
+#endif // WITH_DEV_AUTOMATION_TESTS
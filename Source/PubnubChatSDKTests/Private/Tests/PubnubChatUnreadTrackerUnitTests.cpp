@@ -0,0 +1,141 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/PubnubChatUnreadTracker.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PubnubChatSDK/Private/PubnubChatObjectsRepository.h"
+#include "PubnubChatSDK/Private/FunctionLibraries/PubnubChatInternalUtilities.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/Package.h"
+
+// ============================================================================
+// UNREAD TRACKER UNIT TESTS - Local counting only (No API Calls)
+// ============================================================================
+
+namespace
+{
+	const FString UnreadTestMessageContent = TEXT("{\"type\":\"text\",\"text\":\"Unread message\"}");
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatUnreadTrackerMessageReceivedTest, "PubnubChat.Unit.UnreadTracker.MessageReceived", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatUnreadTrackerMessageReceivedTest::RunTest(const FString& Parameters)
+{
+	const FString TestChannelID = TEXT("test_unread_channel");
+
+	UPubnubChatUnreadTracker* Tracker = NewObject<UPubnubChatUnreadTracker>(GetTransientPackage());
+	TestNotNull("Tracker should be created", Tracker);
+	if(!Tracker)
+	{
+		return false;
+	}
+
+	// Server reported 3 unread messages older than the sync point
+	Tracker->SeedChannel(TestChannelID, TEXT("17000000000000100"), 3, TEXT("17000000000000200"));
+	TestTrue("Channel should be tracked", Tracker->IsChannelTracked(TestChannelID));
+	TestEqual("Seeded count should be used", Tracker->GetUnreadMessagesCount(TestChannelID), 3);
+
+	TestFalse("Message already included in the seed should not be counted", Tracker->HandleMessageReceived(TestChannelID, TEXT("17000000000000150"), UnreadTestMessageContent));
+	TestTrue("New message should be counted", Tracker->HandleMessageReceived(TestChannelID, TEXT("17000000000000300"), UnreadTestMessageContent));
+	TestFalse("The same message delivered again should not be counted", Tracker->HandleMessageReceived(TestChannelID, TEXT("17000000000000300"), UnreadTestMessageContent));
+	TestTrue("Another new message should be counted", Tracker->HandleMessageReceived(TestChannelID, TEXT("17000000000000400"), UnreadTestMessageContent));
+	TestEqual("Count should include new messages", Tracker->GetUnreadMessagesCount(TestChannelID), 5);
+
+	TestFalse("Message on not tracked channel should be ignored", Tracker->HandleMessageReceived(TEXT("other_channel"), TEXT("17000000000000500"), UnreadTestMessageContent));
+	TestEqual("Not tracked channel should have 0 count", Tracker->GetUnreadMessagesCount(TEXT("other_channel")), 0);
+
+	Tracker->StopTracking();
+	TestFalse("Channel should not be tracked after StopTracking", Tracker->IsChannelTracked(TestChannelID));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatUnreadTrackerLastReadTimetokenTest, "PubnubChat.Unit.UnreadTracker.LastReadTimetokenChanged", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatUnreadTrackerLastReadTimetokenTest::RunTest(const FString& Parameters)
+{
+	const FString TestChannelID = TEXT("test_unread_channel");
+
+	UPubnubChatUnreadTracker* Tracker = NewObject<UPubnubChatUnreadTracker>(GetTransientPackage());
+	if(!Tracker)
+	{
+		return false;
+	}
+
+	Tracker->SeedChannel(TestChannelID, TEXT("17000000000000100"), 3, TEXT("17000000000000200"));
+	Tracker->HandleMessageReceived(TestChannelID, TEXT("17000000000000300"), UnreadTestMessageContent);
+	Tracker->HandleMessageReceived(TestChannelID, TEXT("17000000000000400"), UnreadTestMessageContent);
+
+	// Marker moved past the sync point - count is calculated from received messages only
+	TestTrue("Count should be calculated locally", Tracker->HandleLastReadTimetokenChanged(TestChannelID, TEXT("17000000000000300")));
+	TestEqual("Only message newer than last read should stay unread", Tracker->GetUnreadMessagesCount(TestChannelID), 1);
+
+	TestTrue("Reading everything should be calculated locally", Tracker->HandleLastReadTimetokenChanged(TestChannelID, TEXT("17000000000000400")));
+	TestEqual("Count should be 0 after reading everything", Tracker->GetUnreadMessagesCount(TestChannelID), 0);
+
+	// Marker moved before the sync point - older messages are unknown locally
+	TestFalse("Moving marker before sync point should require server sync", Tracker->HandleLastReadTimetokenChanged(TestChannelID, TEXT("17000000000000150")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatUnreadTrackerRepositoryMembershipTest, "PubnubChat.Unit.UnreadTracker.RepositoryMembershipUpdate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatUnreadTrackerRepositoryMembershipTest::RunTest(const FString& Parameters)
+{
+	const FString TestChannelID = TEXT("test_unread_channel");
+
+	UPubnubChatObjectsRepository* Repository = NewObject<UPubnubChatObjectsRepository>(GetTransientPackage());
+	UPubnubChatUnreadTracker* Tracker = NewObject<UPubnubChatUnreadTracker>(GetTransientPackage());
+	if(!Repository || !Tracker)
+	{
+		return false;
+	}
+	Repository->OnMembershipDataUpdatedNative.AddUObject(Tracker, &UPubnubChatUnreadTracker::HandleMembershipDataUpdated);
+
+	// Tracker was not initialized, so CurrentUserID is empty and MembershipID is "[ChannelID]."
+	Tracker->SeedChannel(TestChannelID, TEXT(""), 0, TEXT("17000000000000200"));
+	Tracker->HandleMessageReceived(TestChannelID, TEXT("17000000000000300"), UnreadTestMessageContent);
+	Tracker->HandleMessageReceived(TestChannelID, TEXT("17000000000000400"), UnreadTestMessageContent);
+	TestEqual("Both messages should be unread", Tracker->GetUnreadMessagesCount(TestChannelID), 2);
+
+	// Membership update of another channel should not change anything
+	FPubnubChatMembershipData OtherMembershipData;
+	UPubnubChatInternalUtilities::AddLastReadMessageTimetokenToMembershipData(OtherMembershipData, TEXT("17000000000000400"));
+	Repository->UpdateMembershipData(TEXT("other_channel."), OtherMembershipData);
+	TestEqual("Other membership should not change the count", Tracker->GetUnreadMessagesCount(TestChannelID), 2);
+
+	// Membership update of the tracked channel moves the marker
+	FPubnubChatMembershipData MembershipData;
+	UPubnubChatInternalUtilities::AddLastReadMessageTimetokenToMembershipData(MembershipData, TEXT("17000000000000300"));
+	Repository->UpdateMembershipData(TestChannelID + TEXT("."), MembershipData);
+	TestEqual("Count should follow last read message timetoken from the repository", Tracker->GetUnreadMessagesCount(TestChannelID), 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatUnreadTrackerIgnoreEventsTest, "PubnubChat.Unit.UnreadTracker.IgnoreEvents", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatUnreadTrackerIgnoreEventsTest::RunTest(const FString& Parameters)
+{
+	const FString TestChannelID = TEXT("test_unread_channel");
+
+	UPubnubChatUnreadTracker* Tracker = NewObject<UPubnubChatUnreadTracker>(GetTransientPackage());
+	if(!Tracker)
+	{
+		return false;
+	}
+
+	Tracker->SeedChannel(TestChannelID, TEXT(""), 0, TEXT("17000000000000200"));
+
+	// Events are published to the same channel as messages, but are never unread
+	TestFalse("Typing event should not be counted", Tracker->HandleMessageReceived(TestChannelID, TEXT("17000000000000300"), TEXT("{\"type\":\"typing\",\"value\":true}")));
+	TestFalse("Receipt event should not be counted", Tracker->HandleMessageReceived(TestChannelID, TEXT("17000000000000400"), TEXT("{\"type\":\"receipt\",\"messageTimetoken\":\"17000000000000250\"}")));
+	TestTrue("Text message should be counted", Tracker->HandleMessageReceived(TestChannelID, TEXT("17000000000000500"), UnreadTestMessageContent));
+	TestEqual("Only the text message should be unread", Tracker->GetUnreadMessagesCount(TestChannelID), 1);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
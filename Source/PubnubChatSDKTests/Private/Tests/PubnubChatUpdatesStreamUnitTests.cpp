@@ -0,0 +1,154 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/PubnubChatUpdatesStream.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PubnubChatChannel.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/Package.h"
+
+// ============================================================================
+// UPDATES STREAM UNIT TESTS - Routing and per frame coalescing (No API Calls)
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatUpdatesStreamRoutingTest, "PubnubChat.Unit.UpdatesStream.RoutingAndCoalescing", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatUpdatesStreamRoutingTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatUpdatesStream* UpdatesStream = NewObject<UPubnubChatUpdatesStream>(GetTransientPackage());
+	TestNotNull("UpdatesStream should be created", UpdatesStream);
+	if(!UpdatesStream)
+	{
+		return false;
+	}
+
+	// Objects are only used as routing targets, they don't have to be initialized
+	UPubnubChatChannel* ObjectA = NewObject<UPubnubChatChannel>(GetTransientPackage());
+	UPubnubChatChannel* ObjectB = NewObject<UPubnubChatChannel>(GetTransientPackage());
+	UPubnubChatChannel* ObjectC = NewObject<UPubnubChatChannel>(GetTransientPackage());
+
+	TSharedPtr<TMap<UObject*, int32>> AppliedCounts = MakeShared<TMap<UObject*, int32>>();
+	TSharedPtr<TArray<TArray<UObject*>>> ReceivedBatches = MakeShared<TArray<TArray<UObject*>>>();
+
+	// Routing ID is taken from the channel, events with "ignore" content don't change the object
+	auto GetRoutingID = [](const FPubnubMessageData& MessageData)
+	{
+		return MessageData.Channel;
+	};
+	auto ApplyUpdate = [AppliedCounts](UObject* Object, const FPubnubMessageData& MessageData)
+	{
+		if (MessageData.Message == TEXT("ignore"))
+		{ return false; }
+
+		AppliedCounts->FindOrAdd(Object)++;
+		return true;
+	};
+	auto OnUpdatesBatch = [ReceivedBatches](const TArray<UObject*>& Objects)
+	{
+		ReceivedBatches->Add(Objects);
+	};
+	UpdatesStream->InitUpdatesStream(nullptr, false, GetRoutingID, ApplyUpdate, OnUpdatesBatch);
+
+	// Two objects share the same subscribed channel
+	UpdatesStream->AddObject(TEXT("route_a"), TEXT("shared_channel"), ObjectA);
+	UpdatesStream->AddObject(TEXT("route_b"), TEXT("shared_channel"), ObjectB);
+	UpdatesStream->AddObject(TEXT("route_c"), TEXT("other_channel"), ObjectC);
+	TestEqual("All objects should be routed", UpdatesStream->GetNumRoutedObjects(), 3);
+	TestEqual("Shared channel should be subscribed only once", UpdatesStream->GetNumSubscribedChannels(), 2);
+
+	FPubnubMessageData EventA;
+	EventA.Channel = TEXT("route_a");
+	EventA.Message = TEXT("update");
+	FPubnubMessageData EventB;
+	EventB.Channel = TEXT("route_b");
+	EventB.Message = TEXT("update");
+	FPubnubMessageData IgnoredEventC;
+	IgnoredEventC.Channel = TEXT("route_c");
+	IgnoredEventC.Message = TEXT("ignore");
+	FPubnubMessageData UnknownEvent;
+	UnknownEvent.Channel = TEXT("route_unknown");
+	UnknownEvent.Message = TEXT("update");
+
+	UpdatesStream->HandleEvent(EventA);
+	UpdatesStream->HandleEvent(EventB);
+	UpdatesStream->HandleEvent(EventA);
+	UpdatesStream->HandleEvent(IgnoredEventC);
+	UpdatesStream->HandleEvent(UnknownEvent);
+	UpdatesStream->HandleEvent(EventA);
+
+	TestEqual("Every event should be applied to object A", AppliedCounts->FindRef(ObjectA), 3);
+	TestEqual("Event should be applied to object B", AppliedCounts->FindRef(ObjectB), 1);
+	TestFalse("Ignored event should not count as applied", AppliedCounts->Contains(ObjectC));
+	TestEqual("Nothing should be delivered before flush", ReceivedBatches->Num(), 0);
+
+	// All changes of one frame are delivered together, each object once, in order of the first change
+	UpdatesStream->FlushPendingUpdates();
+	TestEqual("One batch should be delivered", ReceivedBatches->Num(), 1);
+	if (ReceivedBatches->Num() == 1)
+	{
+		const TArray<UObject*>& Batch = (*ReceivedBatches)[0];
+		TestEqual("Batch should contain only changed objects", Batch.Num(), 2);
+		if (Batch.Num() == 2)
+		{
+			TestTrue("Object A should be first", Batch[0] == ObjectA);
+			TestTrue("Object B should be second", Batch[1] == ObjectB);
+		}
+	}
+
+	UpdatesStream->FlushPendingUpdates();
+	TestEqual("Empty frame should not deliver a batch", ReceivedBatches->Num(), 1);
+
+	// Stream without Chat can't subscribe
+	FPubnubChatOperationResult StartResult = UpdatesStream->Start();
+	TestTrue("Start without Chat should fail", StartResult.Error);
+	TestFalse("Stream should not be streaming", UpdatesStream->IsStreaming());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatUpdatesStreamRemoveObjectTest, "PubnubChat.Unit.UpdatesStream.RemoveObject", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatUpdatesStreamRemoveObjectTest::RunTest(const FString& Parameters)
+{
+	UPubnubChatUpdatesStream* UpdatesStream = NewObject<UPubnubChatUpdatesStream>(GetTransientPackage());
+	if(!UpdatesStream)
+	{
+		return false;
+	}
+
+	UPubnubChatChannel* ObjectA = NewObject<UPubnubChatChannel>(GetTransientPackage());
+	UPubnubChatChannel* ObjectB = NewObject<UPubnubChatChannel>(GetTransientPackage());
+	UPubnubChatChannel* NotRoutedObject = NewObject<UPubnubChatChannel>(GetTransientPackage());
+
+	TSharedPtr<int32> AppliedCount = MakeShared<int32>(0);
+	auto GetRoutingID = [](const FPubnubMessageData& MessageData)
+	{
+		return MessageData.Channel;
+	};
+	auto ApplyUpdate = [AppliedCount](UObject* Object, const FPubnubMessageData& MessageData)
+	{
+		(*AppliedCount)++;
+		return true;
+	};
+	UpdatesStream->InitUpdatesStream(nullptr, false, GetRoutingID, ApplyUpdate, nullptr);
+	UpdatesStream->AddObject(TEXT("route_a"), TEXT("channel_a"), ObjectA);
+	UpdatesStream->AddObject(TEXT("route_b"), TEXT("channel_b"), ObjectB);
+
+	TestFalse("Removing object that is not routed should not stop the stream", UpdatesStream->RemoveObject(NotRoutedObject));
+	TestFalse("Stream with objects left should not be stopped", UpdatesStream->RemoveObject(ObjectA));
+	TestEqual("Removed object should not be routed", UpdatesStream->GetNumRoutedObjects(), 1);
+
+	// Events of the removed object are not applied anymore
+	FPubnubMessageData EventA;
+	EventA.Channel = TEXT("route_a");
+	UpdatesStream->HandleEvent(EventA);
+	TestEqual("Event of removed object should not be applied", *AppliedCount, 0);
+
+	TestTrue("Stream should be stopped when the last object is removed", UpdatesStream->RemoveObject(ObjectB));
+	TestEqual("No object should be routed", UpdatesStream->GetNumRoutedObjects(), 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
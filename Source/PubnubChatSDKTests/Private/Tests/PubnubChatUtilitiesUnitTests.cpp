@@ -0,0 +1,101 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubChatSDK/Private/FunctionLibraries/PubnubChatInternalUtilities.h"
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+// ============================================================================
+// INTERNAL UTILITIES UNIT TESTS - No API Calls
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatUtilitiesTimetokenParseTest, "PubnubChat.Unit.Utilities.Timetoken.Parse", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatUtilitiesTimetokenParseTest::RunTest(const FString& Parameters)
+{
+	int64 Value = 0;
+	TestTrue("Valid timetoken should be parsed", UPubnubChatInternalUtilities::TryParseTimetoken(TEXT("17000000000000001"), Value));
+	TestEqual("Parsed value should match", Value, 17000000000000001LL);
+
+	TestFalse("Empty timetoken should not be parsed", UPubnubChatInternalUtilities::TryParseTimetoken(TEXT(""), Value));
+	TestFalse("Non numeric timetoken should not be parsed", UPubnubChatInternalUtilities::TryParseTimetoken(TEXT("1700000000000000a"), Value));
+	TestFalse("Negative timetoken should not be parsed", UPubnubChatInternalUtilities::TryParseTimetoken(TEXT("-1"), Value));
+	TestFalse("Too long timetoken should not be parsed", UPubnubChatInternalUtilities::TryParseTimetoken(TEXT("1234567890123456789"), Value));
+
+	TestEqual("Invalid timetoken should convert to 0", UPubnubChatInternalUtilities::TimetokenToInt64(TEXT("abc")), 0LL);
+	TestEqual("Int64 should convert back to the same string", UPubnubChatInternalUtilities::Int64ToTimetoken(17000000000000001LL), FString(TEXT("17000000000000001")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatUtilitiesTimetokenAddIntTest, "PubnubChat.Unit.Utilities.Timetoken.AddInt", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatUtilitiesTimetokenAddIntTest::RunTest(const FString& Parameters)
+{
+	TestEqual("Adding 1 should increase timetoken", UPubnubChatInternalUtilities::AddIntToTimetoken(TEXT("17000000000000000"), 1), FString(TEXT("17000000000000001")));
+	TestEqual("Adding 1 should carry over digits", UPubnubChatInternalUtilities::AddIntToTimetoken(TEXT("16999999999999999"), 1), FString(TEXT("17000000000000000")));
+	TestEqual("Adding negative value should decrease timetoken", UPubnubChatInternalUtilities::AddIntToTimetoken(TEXT("17000000000000000"), -1), FString(TEXT("16999999999999999")));
+	TestEqual("Invalid timetoken should be returned unchanged", UPubnubChatInternalUtilities::AddIntToTimetoken(TEXT("invalid"), 1), FString(TEXT("invalid")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatUtilitiesSortMessageActionsTest, "PubnubChat.Unit.Utilities.MessageActions.SortByTimetoken", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatUtilitiesSortMessageActionsTest::RunTest(const FString& Parameters)
+{
+	TArray<FPubnubChatMessageAction> MessageActions;
+	const TArray<FString> Timetokens = {TEXT("17000000000000003"), TEXT("17000000000000001"), TEXT("9"), TEXT("17000000000000002")};
+	for (const FString& Timetoken : Timetokens)
+	{
+		FPubnubChatMessageAction Action;
+		Action.Timetoken = Timetoken;
+		Action.Value = Timetoken;
+		MessageActions.Add(Action);
+	}
+
+	UPubnubChatInternalUtilities::SortMessageActionsByTimetoken(MessageActions);
+
+	TestEqual("Actions count should not change", MessageActions.Num(), Timetokens.Num());
+	// Numeric comparison - shorter "9" has to be first, string comparison would put it last
+	TestEqual("First action should be the oldest", MessageActions[0].Timetoken, FString(TEXT("9")));
+	TestEqual("Second action should be in order", MessageActions[1].Timetoken, FString(TEXT("17000000000000001")));
+	TestEqual("Third action should be in order", MessageActions[2].Timetoken, FString(TEXT("17000000000000002")));
+	TestEqual("Last action should be the most recent", MessageActions[3].Timetoken, FString(TEXT("17000000000000003")));
+	TestEqual("Action data should move together with timetoken", MessageActions[3].Value, FString(TEXT("17000000000000003")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatUtilitiesUserMentionTest, "PubnubChat.Unit.Utilities.Messages.UserMention", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatUtilitiesUserMentionTest::RunTest(const FString& Parameters)
+{
+	const FString Message = TEXT(R"({"type":"text","text":"Hi [@Ann](pn-user://ann) and [@Bob (dev)](pn-user://bob\\)x)"})");
+	TestTrue("Mentioned user should be found", UPubnubChatInternalUtilities::IsUserMentionedInPublishedMessage(Message, TEXT("ann")));
+	TestTrue("User ID with escaped parenthesis should be found", UPubnubChatInternalUtilities::IsUserMentionedInPublishedMessage(Message, TEXT("bob)x")));
+	TestFalse("Prefix of mentioned user ID should not match", UPubnubChatInternalUtilities::IsUserMentionedInPublishedMessage(Message, TEXT("an")));
+	TestFalse("Plain text should not count as mention", UPubnubChatInternalUtilities::IsUserMentionedInPublishedMessage(TEXT(R"({"type":"text","text":"pn-user://ann"})"), TEXT("ann")));
+	TestFalse("Empty user ID should not match", UPubnubChatInternalUtilities::IsUserMentionedInPublishedMessage(Message, TEXT("")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubChatUtilitiesClientMessageIDTest, "PubnubChat.Unit.Utilities.Messages.ClientMessageID", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FPubnubChatUtilitiesClientMessageIDTest::RunTest(const FString& Parameters)
+{
+	const FString EmptyMeta = UPubnubChatInternalUtilities::AddClientMessageIDToMeta(TEXT(""), TEXT("local-1"));
+	TestEqual("Client message ID should be read from created meta", UPubnubChatInternalUtilities::GetClientMessageIDFromMeta(EmptyMeta), FString(TEXT("local-1")));
+	
+	const FString Meta = UPubnubChatInternalUtilities::AddClientMessageIDToMeta(TEXT(R"({"quotedMessage":{"timetoken":"1"},"custom":"value"})"), TEXT("local-2"));
+	TestEqual("Client message ID should be added to existing meta", UPubnubChatInternalUtilities::GetClientMessageIDFromMeta(Meta), FString(TEXT("local-2")));
+	TestEqual("Existing meta fields should be kept", UPubnubChatInternalUtilities::GetQuotedMessageDataFromMeta(Meta).Timetoken, FString(TEXT("1")));
+	
+	TestTrue("Meta without client message ID should give empty ID", UPubnubChatInternalUtilities::GetClientMessageIDFromMeta(TEXT(R"({"custom":"value"})")).IsEmpty());
+	TestTrue("Empty meta should give empty ID", UPubnubChatInternalUtilities::GetClientMessageIDFromMeta(TEXT("")).IsEmpty());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS